@@ -1,159 +1,229 @@
-#pragma once
-#include "VulkanAppBase.h"
-#include <glm/glm.hpp>
-#include <array>
-#include "Camera.h"
-
-class CubemapRenderingApp : public VulkanAppBase
-{
-public:
-  CubemapRenderingApp();
-
-  virtual void Prepare();
-  virtual void Cleanup();
-  virtual void Render();
-
-  virtual bool OnSizeChanged(uint32_t width, uint32_t height);
-  virtual bool OnMouseButtonDown(int button);
-  virtual bool OnMouseButtonUp(int button);
-  virtual bool OnMouseMove(int dx, int dy);
-
-private:
-  // {AvŎgp郌CAEg(fBXNv^CAEg/pCvCCAEg)쐬.
-  void CreateSampleLayouts();
-
-  void PrepareFramebuffers();
-  
-  void PrepareSceneResource();
- 
-  VkPipeline CreateRenderTeapotPipeline(
-    const std::string& renderPass,
-    uint32_t width, uint32_t height,
-    const std::string& layoutName,
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStages);
-
-  ImageObject LoadCubeTextureFromFile(const char* faceFiles[6]);
-
-  void PrepareRenderTargetForMultiPass();
-  void PrepareRenderTargetForSinglePass();
-
-  void PrepareCenterTeapotDescriptors();
-  void PrepareAroundTeapotDescriptors();
-
-  void RenderCubemapFaces(VkCommandBuffer command);
-  void RenderCubemapOnce(VkCommandBuffer command);
-  void RenderToMain(VkCommandBuffer command);
-  void RenderHUD(VkCommandBuffer command);
-
-  // \[XoA̐ݒ.
-  void BarrierRTToTexture(VkCommandBuffer command);
-  void BarrierTextureToRT(VkCommandBuffer command);
-
-private:
-  ImageObject m_depthBuffer;
-  std::vector<VkFramebuffer> m_framebuffers;
-
-  struct FrameCommandBuffer
-  {
-    VkCommandBuffer commandBuffer;
-    VkFence fence;
-  };
-  std::vector<FrameCommandBuffer> m_commandBuffers;
- 
-  uint32_t m_imageIndex;
-
-  Camera m_camera;
-  ModelData m_teapot;
-  ImageObject m_staticCubemap;
-  ImageObject m_cubemapRendered;
-  VkSampler m_cubemapSampler;
-
-  struct ShaderParameters
-  {
-    glm::mat4 world;
-    glm::mat4 view;
-    glm::mat4 proj;
-    glm::vec4 lightDir;
-    glm::vec4 cameraPos;
-  };
-
-  struct TeapotInstanceParameters {
-    glm::mat4 world[6];
-    glm::vec4 colors[6];
-  };
-  struct ViewProjMatrices
-  {
-    glm::mat4 view;
-    glm::mat4 proj;
-    glm::vec4 lightDir;
-  };
-  struct MultiViewProjMatrices
-  {
-    glm::mat4 view[6];
-    glm::mat4 proj;
-    glm::vec4 lightDir;
-  };
-  BufferObject m_cubemapEnvUniform;
-
-
-  // ӃeB[|bg:(To Main)
-  struct AroundTeapotsToMainScene
-  {
-    VkPipeline pipeline;
-    std::vector<BufferObject> cameraViewUniform;
-    std::vector<VkDescriptorSet> descriptors;
-
-  } m_aroundTeapotsToMain;
-  // ӃeB[|bg:(To CubemapFace)
-  struct AroundTeapotsToCubeFaceScene
-  {
-    VkPipeline pipeline;
-    std::vector<BufferObject> cameraViewUniform[6];
-    std::vector<VkDescriptorSet> descriptors[6];
-  } m_aroundTeapotsToFace;
-
-  // ӃeB[|bg:(To CubemapOnce)
-  struct AroundTeapotsToCubeScene
-  {
-    VkPipeline pipeline;
-    std::vector<BufferObject> cameraViewUniform;
-    std::vector<VkDescriptorSet> descriptors;
-  } m_aroundTeapotsToCubemap;
-
-  // S̃eB[|bg.
-  struct CenterTeapot
-  {
-    std::vector<VkDescriptorSet> dsCubemapStatic;
-    std::vector<VkDescriptorSet> dsCubemapRendered;
-    std::vector<BufferObject> sceneUBO;
-    VkPipeline pipeline;
-  } m_centerTeapot;
-
-  struct CubeFaceScene
-  {
-    VkImageView viewFaces[6];
-    ImageObject depth;
-    VkFramebuffer fbFaces[6];
-    VkRenderPass  renderPass;
-  } m_cubeFaceScene;
-
-  struct CubemapSingleScene
-  {
-    VkImageView view;
-    ImageObject depth;
-    VkFramebuffer framebuffer;
-    VkRenderPass renderPass;
-  } m_cubeScene;
-
-
-  const uint32_t CubeEdge = 512;
-  const VkFormat CubemapFormat = VK_FORMAT_R8G8B8A8_UNORM;
-  glm::mat4 m_projection;
-
-  enum Mode {
-    Mode_StaticCubemap,
-    Mode_MultiPassCubemap,
-    Mode_SinglePassCubemap,
-  };
-  Mode m_mode;
+#pragma once
+#include "VulkanAppBase.h"
+#include <glm/glm.hpp>
+#include <array>
+#include "Camera.h"
+#include "MatrixMath.h"
+
+class CubemapRenderingApp : public VulkanAppBase
+{
+public:
+  CubemapRenderingApp();
+
+  virtual void Prepare();
+  virtual void Cleanup();
+  virtual void Render();
+
+  virtual bool OnMouseButtonDown(int button);
+  virtual bool OnMouseButtonUp(int button);
+  virtual bool OnMouseMove(int dx, int dy);
+
+  virtual CameraPath CreateDefaultCameraPath();
+
+  struct ShaderParameters
+  {
+    glm::mat4 world;
+    glm::mat4 view;
+    glm::mat4 proj;
+    glm::vec4 lightDir;
+    glm::vec4 cameraPos;
+  };
+
+  struct TeapotInstanceParameters {
+    glm::mat4 world[6];
+    glm::vec4 colors[6];
+  };
+
+private:
+  // 本アプリで使用するレイアウト(ディスクリプタレイアウト/パイプラインレイアウト)を作成.
+  void CreateSampleLayouts();
+
+  void PrepareFramebuffers();
+  virtual void OnSwapchainRecreated();
+  virtual Camera* GetCamera() { return &m_camera; }
+  
+  void PrepareSceneResource();
+ 
+  VkPipeline CreateRenderTeapotPipeline(
+    const std::string& renderPass,
+    uint32_t width, uint32_t height,
+    const std::string& layoutName,
+    std::vector<VkPipelineShaderStageCreateInfo> shaderStages);
+
+  void PrepareRenderTargetForMultiPass();
+  void PrepareRenderTargetForSinglePass();
+
+  void PrepareCenterTeapotDescriptors();
+  // 静的なキューブマップの読み込みが完了した.
+  void OnStaticCubemapReady(const ImageObject& image);
+  void PrepareAroundTeapotDescriptors();
+  void PrepareClusterCulling();
+  // メッシュレット単位のカリングのパラメータを書き込み、CPU でも同じ判定を行って送る三角形の数を求める.
+  void UpdateClusterCulling(const book_util::Frustum& mainFrustum, const glm::vec3& cameraPos);
+  // コンピュートシェーダーでメッシュレットを判定し、間接描画のコマンドを作成する.
+  void CullMeshletsOnGpu(VkCommandBuffer command);
+  // 周辺ティーポットの詳細度をビューごとに、画面上の大きさから選ぶ.
+  void SelectAroundTeapotLods(const glm::vec3& cameraPos);
+
+  void RenderCubemapFaces(VkCommandBuffer command);
+  void RenderCubemapOnce(VkCommandBuffer command);
+  void RenderToMain(VkCommandBuffer command);
+  void RenderHUD(VkCommandBuffer command);
+  // 周辺ティーポットのうち visible が 1 のものを、連続する範囲ごとに firstInstance を指定して描画する.
+  // メッシュレット単位のカリングが有効であれば、view(0: メイン, 1～6: 各面)の間接描画のコマンドで描画する.
+  // 詳細度の異なるティーポットは範囲を分け、LOD 0 以外はインデックスバッファの該当する範囲を直接描画する.
+  void DrawAroundTeapots(VkCommandBuffer command, const uint8_t* visible, uint32_t view);
+
+  // リソースバリアの設定.
+  void BarrierRTToTexture(VkCommandBuffer command);
+  void BarrierTextureToRT(VkCommandBuffer command);
+
+private:
+  ImageObject m_depthBuffer;
+  std::vector<VkFramebuffer> m_framebuffers;
+
+  struct FrameCommandBuffer
+  {
+    VkCommandBuffer commandBuffer;
+    VkFence fence;
+  };
+  std::vector<FrameCommandBuffer> m_commandBuffers;
+ 
+  uint32_t m_imageIndex;
+
+  Camera m_camera;
+  ModelData m_teapot;
+  ImageObject m_staticCubemap;
+  ImageObject m_cubemapRendered;
+  VkSampler m_cubemapSampler;
+
+  struct ViewProjMatrices
+  {
+    glm::mat4 view;
+    glm::mat4 proj;
+    glm::vec4 lightDir;
+  };
+  struct MultiViewProjMatrices
+  {
+    glm::mat4 view[6];
+    glm::mat4 proj;
+    glm::vec4 lightDir;
+  };
+  BufferObject m_cubemapEnvUniform;
+
+
+  // 周辺ティーポット:(To Main)
+  struct AroundTeapotsToMainScene
+  {
+    VkPipeline pipeline;
+    std::vector<BufferObject> cameraViewUniform;
+    std::vector<VkDescriptorSet> descriptors;
+
+  } m_aroundTeapotsToMain;
+  // 周辺ティーポット:(To CubemapFace)
+  struct AroundTeapotsToCubeFaceScene
+  {
+    VkPipeline pipeline;
+    std::vector<BufferObject> cameraViewUniform[6];
+    std::vector<VkDescriptorSet> descriptors[6];
+  } m_aroundTeapotsToFace;
+
+  // 周辺ティーポット:(To CubemapOnce)
+  struct AroundTeapotsToCubeScene
+  {
+    VkPipeline pipeline;
+    std::vector<BufferObject> cameraViewUniform;
+    std::vector<VkDescriptorSet> descriptors;
+  } m_aroundTeapotsToCubemap;
+
+  // 中心のティーポット.
+  struct CenterTeapot
+  {
+    std::vector<VkDescriptorSet> dsCubemapStatic;
+    std::vector<VkDescriptorSet> dsCubemapRendered;
+    std::vector<BufferObject> sceneUBO;
+    VkPipeline pipeline;
+  } m_centerTeapot;
+
+  struct CubeFaceScene
+  {
+    VkImageView viewFaces[6];
+    ImageObject depth;
+    VkFramebuffer fbFaces[6];
+    VkRenderPass  renderPass;
+  } m_cubeFaceScene;
+
+  struct CubemapSingleScene
+  {
+    VkImageView view;
+    ImageObject depth;
+    VkFramebuffer framebuffer;
+    VkRenderPass renderPass;
+  } m_cubeScene;
+
+
+  const uint32_t CubeEdge = 512;
+  const VkFormat CubemapFormat = VK_FORMAT_R8G8B8A8_UNORM;
+  glm::mat4 m_projection;
+  // キューブマップ各面(+X, -X, +Y, -Y, +Z, -Z)のビュー、プロジェクション行列.
+  std::array<book_util::ViewProjection, 6> m_cubeFaceViews;
+
+  enum Mode {
+    Mode_StaticCubemap,
+    Mode_MultiPassCubemap,
+    Mode_SinglePassCubemap,
+  };
+  Mode m_mode;
+
+  // 視錐台カリング. 単一パスでのキューブマップ描画は全面を 1 回で描くため対象外.
+  static const uint32_t AroundTeapotCount = 6;
+  book_util::Aabb m_teapotBounds;
+  std::array<book_util::Aabb, AroundTeapotCount> m_aroundTeapotBounds;
+  std::array<glm::mat4, AroundTeapotCount> m_aroundTeapotWorlds;
+  uint8_t m_visibleToMain[AroundTeapotCount];
+  uint8_t m_visibleToFace[6][AroundTeapotCount];
+  bool m_isCenterVisible;
+  bool m_isCullingEnabled;
+  uint32_t m_drawCount;
+  uint32_t m_culledCount;
+
+  // メッシュレット単位のカリング(周辺ティーポットのみ). ビュー 0 がメイン、1～6 がマルチパスでの各面.
+  // 単一パスでのキューブマップ描画はジオメトリシェーダーで全面へ出力するため対象外.
+  static const uint32_t ClusterCullViewCount = 7;
+  // ティーポットの描画パイプラインのカリングモード. ティーポットは閉じた形状ではないため背面も描画する.
+  // 背面カリングを行わない間は、メッシュレットも法線の向きでは除かず視錐台でのみ判定する.
+  static const VkCullModeFlags TeapotCullMode = VK_CULL_MODE_NONE;
+  static const bool IsTeapotBackfaceCulled = (TeapotCullMode & VK_CULL_MODE_BACK_BIT) != 0;
+  struct ClusterCullParameters
+  {
+    glm::mat4 world[AroundTeapotCount];
+    glm::vec4 planes[ClusterCullViewCount][6];
+    glm::vec4 cameraPos[ClusterCullViewCount];
+    uint32_t meshletCount;
+    uint32_t instanceCount;
+    uint32_t isBackfaceCulled;
+    uint32_t padding;
+  };
+  struct ClusterCulling
+  {
+    VkPipeline pipeline;
+    std::vector<BufferObject> parameters;
+    std::vector<BufferObject> drawCommands;
+    std::vector<VkDescriptorSet> descriptors;
+    bool isSupported;           // drawIndirectFirstInstance に対応している.
+    bool isMultiDrawSupported;  // multiDrawIndirect に対応している.
+    bool isActive;              // このフレームで間接描画を使う.
+    uint32_t viewCount;         // このフレームで判定するビューの数.
+  } m_clusterCulling;
+  uint32_t m_submittedTriangles;
+  uint32_t m_monolithicTriangles;
+
+  // 周辺ティーポットの詳細度(ビューはメッシュレット単位のカリングと同じ並び).
+  // 単一パスでのキューブマップ描画は全面をまとめて描くため、各面で選んだうち最も細かいものを使う.
+  // 中央のティーポットはキューブマップを映すため常に LOD 0 とする.
+  uint32_t m_aroundTeapotLods[ClusterCullViewCount][AroundTeapotCount];
+  uint32_t m_cubemapOnceLod;
+  // 許容する画面上のずれ(ピクセル). キューブマップは中央のティーポットの曲面に映り込んで縮小されるため大きく取る.
+  float m_lodPixelError;
+  float m_cubemapLodPixelError;
 };
\ No newline at end of file
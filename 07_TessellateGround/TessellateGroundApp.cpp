@@ -1,838 +1,1329 @@
-#include "TessellateGroundApp.h"
-#include "VulkanBookUtil.h"
-
-
-#include <array>
-
-#include <glm/gtc/matrix_transform.hpp>
-
-#include "stb_image.h"
-
-#include "imgui.h"
-#include "examples/imgui_impl_vulkan.h"
-#include "examples/imgui_impl_glfw.h"
-
-using namespace std;
-
-TessellateGroundApp::TessellateGroundApp()
-{
-  m_camera.SetLookAt(
-    glm::vec3(48.5f, 25.0f, 65.0f),
-    glm::vec3(0.0f, 0.0f, 0.0f)
-  );
-  m_isWireframe = true;
-}
-
-void TessellateGroundApp::Prepare()
-{
-  CreateSampleLayouts();
-
-  auto colorFormat = m_swapchain->GetSurfaceFormat().format;
-  RegisterRenderPass("default", CreateRenderPass(colorFormat, VK_FORMAT_D32_SFLOAT));
-
-  // fvXobt@.
-  auto extent = m_swapchain->GetSurfaceExtent();
-  m_depthBuffer = CreateTexture(extent.width, extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
-
-  // t[obt@̏.
-  PrepareFramebuffers();
-  auto imageCount = m_swapchain->GetImageCount();
-
-  // R}hobt@̏.
-  m_commandBuffers.resize(imageCount);
-  for (auto& c : m_commandBuffers)
-  {
-    c.fence = CreateFence();
-    c.commandBuffer = CreateCommandBuffer(false); // R}hobt@JnԂɂȂ.
-  }
-
-  PrepareSceneResource();
-
-  PreparePrimitiveResource();
-}
-
-void TessellateGroundApp::Cleanup()
-{
-  vkDestroyPipeline(m_device, m_tessGroundPipeline, nullptr);
-  vkDestroyPipeline(m_device, m_tessGroundWired, nullptr);
-  vkDestroySampler(m_device, m_texSampler, nullptr);
-
-  DestroyImage(m_normalMap);
-  DestroyImage(m_heightMap);
-
-  for (auto& ubo : m_tessUniform)
-  {
-    DestroyBuffer(ubo);
-  }
-  m_tessUniform.clear();
-
-  DestroyBuffer(m_quad.resVertexBuffer);
-  DestroyBuffer(m_quad.resIndexBuffer);
-
-  DestroyImage(m_depthBuffer);
-  auto count = uint32_t(m_framebuffers.size());
-  DestroyFramebuffers(count, m_framebuffers.data());
-
-  for (auto& c : m_commandBuffers)
-  {
-    DestroyCommandBuffer(c.commandBuffer);
-    DestroyFence(c.fence);
-  }
-  m_commandBuffers.clear();
-}
-
-bool TessellateGroundApp::OnMouseButtonDown(int msg)
-{
-  if (VulkanAppBase::OnMouseButtonDown(msg))
-    return true;
-
-  m_camera.OnMouseButtonDown(msg);
-  return true;
-}
-
-bool TessellateGroundApp::OnMouseMove(int dx, int dy)
-{
-  if (VulkanAppBase::OnMouseMove(dx, dy))
-    return true;
-
-  m_camera.OnMouseMove(dx, dy);
-  return true;
-}
-
-bool TessellateGroundApp::OnMouseButtonUp(int msg)
-{
-  if (VulkanAppBase::OnMouseButtonUp(msg))
-    return true;
-
-  m_camera.OnMouseButtonUp();
-  return true;
-}
-
-void TessellateGroundApp::CreateSampleLayouts()
-{
-  // fBXNv^ZbgCAEg̏.
-  std::vector<VkDescriptorSetLayoutBinding > dsLayoutBindings;
-
-  // 0: uniformBuffer, 1: texture(+sampler) gpVF[_[pCAEg.
-  dsLayoutBindings = {
-    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
-    { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
-  };
-  VkDescriptorSetLayoutCreateInfo dsLayoutCI{
-    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-    nullptr, 0,
-    uint32_t(dsLayoutBindings.size()), dsLayoutBindings.data(),
-  };
-
-  VkResult result;
-  VkDescriptorSetLayout dsLayout;
-
-  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
-  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
-  RegisterLayout("u1t1", dsLayout);
-
-  // 0: uniformBuffer, 1,2: texture(+sampler) gpVF[_[pCAEg.
-  dsLayoutBindings = {
-    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
-    { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
-    { 2, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
-  };
-  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
-  dsLayoutCI.pBindings = dsLayoutBindings.data();
-  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
-  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
-  RegisterLayout("u1t2", dsLayout);
-
-  // 0: uniformBuffer, 1: uniformBuffer gpVF[_[pCAEg.
-  dsLayoutBindings = {
-    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
-    { 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL },
-  };
-  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
-  dsLayoutCI.pBindings = dsLayoutBindings.data();
-  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
-  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
-  RegisterLayout("u2", dsLayout);
-
-  dsLayoutBindings = {
-    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
-  };
-  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
-  dsLayoutCI.pBindings = dsLayoutBindings.data();
-  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
-  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
-  RegisterLayout("u1", dsLayout);
-
-  // pCvCCAEg̏
-  VkPipelineLayoutCreateInfo layoutCI{
-    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-    nullptr, 0,
-    0, nullptr, // SetLayouts
-    0, nullptr, // PushConstants
-  };
-  VkPipelineLayout layout;
-
-  dsLayout = GetDescriptorSetLayout("u1t1");
-  layoutCI.setLayoutCount = 1;
-  layoutCI.pSetLayouts = &dsLayout;
-  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
-  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
-  RegisterLayout("u1t1", layout);
-
-  dsLayout = GetDescriptorSetLayout("u1t2");
-  layoutCI.setLayoutCount = 1;
-  layoutCI.pSetLayouts = &dsLayout;
-  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
-  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
-  RegisterLayout("u1t2", layout);
-
-  dsLayout = GetDescriptorSetLayout("u2");
-  layoutCI.setLayoutCount = 1;
-  layoutCI.pSetLayouts = &dsLayout;
-  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
-  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
-  RegisterLayout("u2", layout);
-
-  dsLayout = GetDescriptorSetLayout("u1");
-  layoutCI.setLayoutCount = 1;
-  layoutCI.pSetLayouts = &dsLayout;
-  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
-  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
-  RegisterLayout("u1", layout);
-}
-
-void TessellateGroundApp::Render()
-{
-  if (m_isMinimizedWindow)
-  {
-    MsgLoopMinimizedWindow();
-  }
-  uint32_t imageIndex = 0;
-  auto result = m_swapchain->AcquireNextImage(&imageIndex, m_presentCompletedSem);
-  if (result == VK_ERROR_OUT_OF_DATE_KHR)
-  {
-    return;
-  }
-  array<VkClearValue, 2> clearValue = {
-    {
-      { 0.85f, 0.5f, 0.5f, 0.0f}, // for Color
-      { 1.0f, 0 }, // for Depth
-    }
-  };
-
-  auto renderArea = VkRect2D{
-    VkOffset2D{0,0},
-    m_swapchain->GetSurfaceExtent(),
-  };
-
-  VkRenderPassBeginInfo rpBI{
-    VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-    nullptr,
-    GetRenderPass("default"),
-    m_framebuffers[imageIndex],
-    renderArea,
-    uint32_t(clearValue.size()), clearValue.data()
-  };
-
-  VkCommandBufferBeginInfo commandBI{
-    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-    nullptr, 0, nullptr
-  };
-
-  {
-    auto extent = m_swapchain->GetSurfaceExtent();
-    m_projection = glm::perspectiveRH(
-      glm::radians(45.0f), float(extent.width) / float(extent.height), 0.1f, 1000.0f
-    );
-  }
-
-  {
-    TessellationShaderParameters tessParams;
-    tessParams.world = glm::mat4(1.0);
-    tessParams.view = m_camera.GetViewMatrix();
-    tessParams.proj = m_projection;
-    tessParams.lightPos = glm::vec4(0.0f);
-    tessParams.cameraPos = glm::vec4(m_camera.GetPosition(), 0.0f);
-    WriteToHostVisibleMemory(m_tessUniform[imageIndex].memory, sizeof(tessParams), &tessParams);
-  }
-
-  auto fence = m_commandBuffers[imageIndex].fence;
-  vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
-
-  auto command = m_commandBuffers[imageIndex].commandBuffer;
-
-  vkBeginCommandBuffer(command, &commandBI);
-
-  vkCmdBeginRenderPass(command, &rpBI, VK_SUBPASS_CONTENTS_INLINE);
-  auto extent = m_swapchain->GetSurfaceExtent();
-  VkViewport viewport = book_util::GetViewportFlipped(float(extent.width), float(extent.height));
-  VkRect2D scissor{
-    { 0, 0},
-    extent
-  };
-  VkDeviceSize offsets[] = { 0 };
-
-  vkCmdSetScissor(command, 0, 1, &scissor);
-  vkCmdSetViewport(command, 0, 1, &viewport);
- 
-  auto pipelineLayout = GetPipelineLayout("u1t2");
-  if (m_isWireframe)
-  {
-    vkCmdBindPipeline(command, VK_PIPELINE_BIND_POINT_GRAPHICS, m_tessGroundWired);
-  }
-  else
-  {
-    vkCmdBindPipeline(command, VK_PIPELINE_BIND_POINT_GRAPHICS, m_tessGroundPipeline);
-  }
-  vkCmdBindDescriptorSets(command, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &m_dsTessSample[imageIndex], 0, nullptr);
-  vkCmdBindIndexBuffer(command, m_quad.resIndexBuffer.buffer, 0, VK_INDEX_TYPE_UINT32);
-  vkCmdBindVertexBuffers(command, 0, 1, &m_quad.resVertexBuffer.buffer, offsets);
-  vkCmdDrawIndexed(command, m_quad.indexCount, 1, 0, 0, 0);
-
-  RenderHUD(command);
-
-  vkCmdEndRenderPass(command);
-  vkEndCommandBuffer(command);
-
-  VkPipelineStageFlags waitStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-  VkSubmitInfo submitInfo{
-    VK_STRUCTURE_TYPE_SUBMIT_INFO,
-    nullptr,
-    1, &m_presentCompletedSem, // WaitSemaphore
-    &waitStageMask, // DstStageMask
-    1, &command, // CommandBuffer
-    1, &m_renderCompletedSem, // SignalSemaphore
-  };
-  vkResetFences(m_device, 1, &fence);
-  vkQueueSubmit(m_deviceQueue, 1, &submitInfo, fence);
-
-  m_swapchain->QueuePresent(m_deviceQueue, imageIndex, m_renderCompletedSem);
-}
-
-void TessellateGroundApp::PrepareFramebuffers()
-{
-  auto imageCount = m_swapchain->GetImageCount();
-  auto extent = m_swapchain->GetSurfaceExtent();
-  m_framebuffers.resize(imageCount);
-  for (uint32_t i = 0; i < imageCount; ++i)
-  {
-    vector<VkImageView> views;
-    views.push_back(m_swapchain->GetImageView(i));
-    views.push_back(m_depthBuffer.view);
-
-    m_framebuffers[i] = CreateFramebuffer(
-      GetRenderPass("default"),
-      extent.width, extent.height,
-      uint32_t(views.size()), views.data()
-    );
-  }
-}
-
-bool TessellateGroundApp::OnSizeChanged(uint32_t width, uint32_t height)
-{
-  auto result = VulkanAppBase::OnSizeChanged(width, height);
-  if (result)
-  {
-    DestroyImage(m_depthBuffer);
-    DestroyFramebuffers(uint32_t(m_framebuffers.size()), m_framebuffers.data());
-
-    // fvXobt@Đ.
-    auto extent = m_swapchain->GetSurfaceExtent();
-    m_depthBuffer = CreateTexture(extent.width, extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
-
-    // t[obt@.
-    PrepareFramebuffers();
-  }
-  return result;
-}
-
-void TessellateGroundApp::PrepareSceneResource()
-{
-  VkSamplerCreateInfo samplerCI{
-    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, nullptr,
-    0,
-    VK_FILTER_LINEAR,
-    VK_FILTER_LINEAR,
-    VK_SAMPLER_MIPMAP_MODE_LINEAR,
-    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
-    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
-    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
-    0.0f,
-    VK_FALSE,
-    1.0f,
-    VK_FALSE,
-    VK_COMPARE_OP_NEVER,
-    0.0f,
-    1.0f,
-    VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE,
-    VK_FALSE
-  };
-  vkCreateSampler(m_device, &samplerCI, nullptr, &m_texSampler);
-
-  m_heightMap = Load2DTextureFromFile("heightmap.png");
-  m_normalMap = Load2DTextureFromFile("normalmap.png");
-}
-
-TessellateGroundApp::ImageObject TessellateGroundApp::Load2DTextureFromFile(const char* fileName)
-{
-  int width, height;
-  stbi_uc* rawimage = nullptr;
-  rawimage = stbi_load(fileName, &width, &height, nullptr, 4);
-
-  VkImageCreateInfo imageCI{
-    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
-    0,
-    VK_IMAGE_TYPE_2D,
-    VK_FORMAT_R8G8B8A8_UNORM, { uint32_t(width), uint32_t(height), 1u },
-    1, 1,
-    VK_SAMPLE_COUNT_1_BIT,
-    VK_IMAGE_TILING_OPTIMAL,
-    VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
-    VK_SHARING_MODE_EXCLUSIVE,
-    0, nullptr,
-    VK_IMAGE_LAYOUT_UNDEFINED
-  };
-  VkResult result;
-  VkImage image;
-  result = vkCreateImage(m_device, &imageCI, nullptr, &image);
-  ThrowIfFailed(result, "vkCreateImage failed.");
-  VkDeviceMemory memory;
-  VkMemoryRequirements reqs;
-  vkGetImageMemoryRequirements(m_device, image, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-  };
-  vkAllocateMemory(m_device, &info, nullptr, &memory);
-  vkBindImageMemory(m_device, image, memory, 0);
-
-  VkImageAspectFlags imageAspect = VK_IMAGE_ASPECT_COLOR_BIT;
-  VkImageViewCreateInfo viewCI{
-    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-    nullptr, 0,
-    image,
-    VK_IMAGE_VIEW_TYPE_2D, imageCI.format,
-    book_util::DefaultComponentMapping(),
-    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}
-  };
-  VkImageView view;
-  result = vkCreateImageView(m_device, &viewCI, nullptr, &view);
-
-  // Xe[WOp
-  auto bufferSize = uint32_t(width * height * sizeof(uint32_t));
-  BufferObject buffersSrc;
-  buffersSrc = CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-  WriteToHostVisibleMemory(buffersSrc.memory, bufferSize, rawimage);
-
-  // ].
-  auto command = CreateCommandBuffer();
-  VkImageSubresourceRange subresource{};
-  subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-  subresource.baseMipLevel = 0;
-  subresource.levelCount = 1;
-  subresource.baseArrayLayer = 0;
-  subresource.layerCount = 1;
-
-  VkImageMemoryBarrier imb{
-    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
-    0, VK_ACCESS_TRANSFER_WRITE_BIT,
-    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
-    image,
-    subresource
-  };
-  vkCmdPipelineBarrier(command,
-    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-    0, 0, nullptr,
-    0, nullptr,
-    1, &imb);
-
-  VkBufferImageCopy  region{};
-  region.imageExtent = { uint32_t(width), uint32_t(height), 1 };
-  region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
-  region.imageSubresource.baseArrayLayer = 0;
-
-  vkCmdCopyBufferToImage(
-    command,
-    buffersSrc.buffer,
-    image,
-    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-    1, &region
-  );
-
-  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-  imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-  vkCmdPipelineBarrier(
-    command,
-    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-    0, 0, nullptr,
-    0, nullptr,
-    1, &imb);
-
-  FinishCommandBuffer(command);
-
-  stbi_image_free(rawimage);
-  DestroyBuffer(buffersSrc);
-
-  ImageObject texture;
-  texture.image = image;
-  texture.memory = memory;
-  texture.view = view;
-  return texture;
-
-}
-
-TessellateGroundApp::ImageObject TessellateGroundApp::LoadCubeTextureFromFile(const char* faceFiles[6])
-{
-  int width, height;
-  stbi_uc* faceImages[6] = { 0 };
-  for (int i = 0; i < 6; ++i)
-  {
-    faceImages[i] = stbi_load(faceFiles[i], &width, &height, nullptr, 4);
-  }
-
-  VkImageCreateInfo imageCI{
-    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
-    VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT, // Cubemap ƂĎg.
-    VK_IMAGE_TYPE_2D,
-    VK_FORMAT_R8G8B8A8_UNORM, { uint32_t(width), uint32_t(height), 1u },
-    1,
-    6,
-    VK_SAMPLE_COUNT_1_BIT,
-    VK_IMAGE_TILING_OPTIMAL,
-    VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
-    VK_SHARING_MODE_EXCLUSIVE,
-    0, nullptr,
-    VK_IMAGE_LAYOUT_UNDEFINED
-  };
-  VkImage cubemapImage;
-  VkDeviceMemory cubemapMemory;
-  auto result = vkCreateImage(m_device, &imageCI, nullptr, &cubemapImage);
-  VkMemoryRequirements reqs;
-  vkGetImageMemoryRequirements(m_device, cubemapImage, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-  };
-  vkAllocateMemory(m_device, &info, nullptr, &cubemapMemory);
-  vkBindImageMemory(m_device, cubemapImage, cubemapMemory, 0);
-
-  VkImageAspectFlags imageAspect = VK_IMAGE_ASPECT_COLOR_BIT;
-  VkImageViewCreateInfo viewCI{
-    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-    nullptr, 0,
-    cubemapImage,
-    VK_IMAGE_VIEW_TYPE_CUBE, imageCI.format,
-    book_util::DefaultComponentMapping(),
-    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 6}
-  };
-  VkImageView cubemapView;
-  result = vkCreateImageView(m_device, &viewCI, nullptr, &cubemapView);
-
-  // Xe[WOp
-  auto bufferSize = uint32_t(width * height * sizeof(uint32_t));
-  BufferObject buffersSrc[6];
-  for (int i = 0; i < 6; ++i)
-  {
-    buffersSrc[i] = CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    WriteToHostVisibleMemory(buffersSrc[i].memory, bufferSize, faceImages[i]);
-  }
-  // ].
-  auto command = CreateCommandBuffer();
-
-  
-  VkImageSubresourceRange subresource{};
-  subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-  subresource.baseMipLevel = 0;
-  subresource.levelCount = 1;
-  subresource.baseArrayLayer = 0;
-  subresource.layerCount = 6;
-
-  VkImageMemoryBarrier imb{
-    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
-    0, VK_ACCESS_TRANSFER_WRITE_BIT,
-    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
-    cubemapImage,
-    subresource
-  };
-  vkCmdPipelineBarrier(command,
-    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-    0, 0, nullptr,
-    0, nullptr,
-    1, &imb);
-
-  for (int i = 0; i < 6; ++i)
-  {
-    VkBufferImageCopy  region{};
-    region.imageExtent = { uint32_t(width), uint32_t(height), 1 };
-    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
-    region.imageSubresource.baseArrayLayer = i;
-
-    vkCmdCopyBufferToImage(
-      command,
-      buffersSrc[i].buffer,
-      cubemapImage,
-      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-      1, &region
-    );
-  }
-
-  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-  imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-  vkCmdPipelineBarrier(
-    command,
-    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-    0, 0, nullptr,
-    0, nullptr,
-    1, &imb);
-
-  FinishCommandBuffer(command);
-
-
-  for (int i = 0; i < 6; ++i)
-  {
-    stbi_image_free(faceImages[i]);
-    vkDestroyBuffer(m_device, buffersSrc[i].buffer, nullptr);
-    vkFreeMemory(m_device, buffersSrc[i].memory, nullptr);
-  }
-
-  ImageObject cubemap;
-  cubemap.image = cubemapImage;
-  cubemap.memory = cubemapMemory;
-  cubemap.view = cubemapView;
-  return cubemap;
-}
-
-void TessellateGroundApp::PreparePrimitiveResource()
-{
-  using namespace glm;
-  using VertexData = std::vector<Vertex>;
-  using IndexData = std::vector<uint32_t>;
-  const float edge = 200.0f;
-  const int divide = 10;
-
-  VertexData vertices;
-  for (int z = 0; z < divide + 1; ++z)
-  {
-    for (int x = 0; x < divide + 1; ++x)
-    {
-      Vertex v;
-      v.Position = vec3(
-        edge * x / divide,
-        0.0f,
-        edge * z / divide
-      );
-      v.UV = vec2(
-        v.Position.x / edge,
-        v.Position.z / edge
-      );
-      vertices.push_back(v);
-    }
-  }
-  IndexData indices;
-  for (int z = 0; z < divide; ++z)
-  {
-    for (int x = 0; x < divide; ++x)
-    {
-      const int rows = divide + 1;
-      int v0 = x, v1 = x + 1;
-      v0 = v0 + rows * z;
-      v1 = v1 + rows * z;
-      indices.push_back(v0);
-      indices.push_back(v1);
-      indices.push_back(v0 + rows);
-      indices.push_back(v1 + rows);
-    }
-  }
-  // S␳.
-  for (auto& v : vertices)
-  {
-    v.Position.x -= edge * 0.5f;
-    v.Position.z -= edge * 0.5f;
-  }
-  m_quad = CreateSimpleModel(vertices, indices);
-
-  auto imageCount = int(m_swapchain->GetImageCount());
-  m_tessUniform = CreateUniformBuffers(sizeof(TessellationShaderParameters), imageCount);
-
-  VkResult result;
-  VkDescriptorSetLayout dsLayout = GetDescriptorSetLayout("u1t2");
-  VkDescriptorSetAllocateInfo dsAI{
-    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-    nullptr, m_descriptorPool,
-    1, &dsLayout
-  };
-  m_dsTessSample.resize(imageCount);
-  for (int i = 0; i < imageCount; ++i)
-  {
-    result = vkAllocateDescriptorSets(m_device, &dsAI, &m_dsTessSample[i]);
-    ThrowIfFailed(result, "vkAllocateDescriptorSets failed.");
-  }
-
-  for (int i = 0; i < imageCount; ++i)
-  {
-    VkDescriptorBufferInfo bufferInfo{
-      m_tessUniform[i].buffer, 0, VK_WHOLE_SIZE
-    };
-    VkDescriptorImageInfo imageInfo{
-      m_texSampler,
-      m_heightMap.view,
-      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-    };
-    VkDescriptorImageInfo imageInfo2{
-      m_texSampler,
-      m_normalMap.view,
-      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-    };
-
-    std::vector<VkWriteDescriptorSet> writeDS = {
-      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 0, &bufferInfo),
-      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 1, &imageInfo),
-      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 2, &imageInfo2)
-    };
-    vkUpdateDescriptorSets(m_device, uint32_t(writeDS.size()), writeDS.data(), 0, nullptr);
-  }
-
-  // pCvCCAEg̏
-  VkPipelineLayout layout = GetPipelineLayout("u1t2");
-
-  // pCvC\z.
-  auto stride = uint32_t(sizeof(Vertex));
-  VkVertexInputBindingDescription vibDesc{
-      0, // binding
-      stride,
-      VK_VERTEX_INPUT_RATE_VERTEX
-  };
-
-  array<VkVertexInputAttributeDescription, 2> inputAttribs{
-    {
-      { 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, Position) },
-      { 1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, UV) },
-    }
-  };
-  VkPipelineVertexInputStateCreateInfo pipelineVisCI{
-    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
-    nullptr, 0,
-    1, &vibDesc,
-    uint32_t(inputAttribs.size()), inputAttribs.data()
-  };
-
-  auto blendAttachmentState = book_util::GetOpaqueColorBlendAttachmentState();
-  VkPipelineColorBlendStateCreateInfo colorBlendStateCI{
-    VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
-    nullptr, 0,
-    VK_FALSE, VK_LOGIC_OP_CLEAR, // logicOpEnable
-    1, &blendAttachmentState,
-    { 0.0f, 0.0f, 0.0f,0.0f }
-  };
-  VkPipelineInputAssemblyStateCreateInfo inputAssemblyCI{
-    VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
-    nullptr, 0, VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
-    VK_FALSE,
-  };
-  VkPipelineMultisampleStateCreateInfo multisampleCI{
-    VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
-    nullptr, 0,
-    VK_SAMPLE_COUNT_1_BIT,
-    VK_FALSE, // sampleShadingEnable
-    0.0f, nullptr,
-    VK_FALSE, VK_FALSE,
-  };
-
-  VkPipelineTessellationStateCreateInfo tessStateCI{
-    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO, 
-    nullptr,
-    0,
-    4
-  };
-
-  auto extentBackbuffer = m_swapchain->GetSurfaceExtent();
-  auto viewportBackbuffer = book_util::GetViewportFlipped(float(extentBackbuffer.width), float(extentBackbuffer.height));
-  auto scissorBackbuffer = VkRect2D{
-    { 0, 0}, extentBackbuffer
-  };
-
-  auto viewportStateCI = VkPipelineViewportStateCreateInfo{
-    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
-    nullptr, 0,
-  };
-
-  auto rasterizerState = book_util::GetDefaultRasterizerState();
-  auto dsState = book_util::GetDefaultDepthStencilState();
-
-  rasterizerState.cullMode = VK_CULL_MODE_BACK_BIT;
-
-  // DynamicState
-  vector<VkDynamicState> dynamicStates{
-    VK_DYNAMIC_STATE_SCISSOR, VK_DYNAMIC_STATE_VIEWPORT
-  };
-  VkPipelineDynamicStateCreateInfo pipelineDynamicStateCI{
-    VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr, 0,
-    uint32_t(dynamicStates.size()), dynamicStates.data(),
-  };
-
-  std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
-  VkGraphicsPipelineCreateInfo pipelineCI{
-    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, nullptr, 0,
-  };
-  pipelineCI.pVertexInputState = &pipelineVisCI;
-  pipelineCI.pInputAssemblyState = &inputAssemblyCI;
-  pipelineCI.pRasterizationState = &rasterizerState;
-  pipelineCI.pMultisampleState = &multisampleCI;
-  pipelineCI.pDepthStencilState = &dsState;
-  pipelineCI.pColorBlendState = &colorBlendStateCI;
-
-  shaderStages = {
-    book_util::LoadShader(m_device, "tessVS.spv", VK_SHADER_STAGE_VERTEX_BIT),
-    book_util::LoadShader(m_device, "tessTCS.spv", VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT),
-    book_util::LoadShader(m_device, "tessTES.spv", VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT),
-    book_util::LoadShader(m_device, "tessFS.spv", VK_SHADER_STAGE_FRAGMENT_BIT)
-  };
-  viewportStateCI.scissorCount = 1;
-  viewportStateCI.pScissors = &scissorBackbuffer;
-  viewportStateCI.viewportCount = 1;
-  viewportStateCI.pViewports = &viewportBackbuffer;
-
-  pipelineCI.pViewportState = &viewportStateCI;
-  pipelineCI.pDynamicState = &pipelineDynamicStateCI;
-  pipelineCI.renderPass = GetRenderPass("default");
-  pipelineCI.layout = layout;
-  pipelineCI.pStages = shaderStages.data();
-  pipelineCI.stageCount = uint32_t(shaderStages.size());
-  pipelineCI.pTessellationState = &tessStateCI;
-
-  result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineCI, nullptr, &m_tessGroundPipeline);
-  ThrowIfFailed(result, "vkCreateGraphicsPipelines failed.");
-
-  // C[t[`p쐬.
-  rasterizerState.polygonMode = VK_POLYGON_MODE_LINE;
-  result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineCI, nullptr, &m_tessGroundWired);
-  ThrowIfFailed(result, "vkCreateGraphicsPipelines failed.");
-
-  book_util::DestroyShaderModules(m_device, shaderStages);
-}
-
-void TessellateGroundApp::RenderHUD(VkCommandBuffer command)
-{
-  ImGui_ImplVulkan_NewFrame();
-  ImGui_ImplGlfw_NewFrame();
-  ImGui::NewFrame();
-
-  {
-    ImGui::Begin("Control");
-    auto cameraPos = m_camera.GetPosition();
-    ImGui::Text("CameraPos: (%.2f, %.2f, %.2f)", cameraPos.x, cameraPos.y, cameraPos.z);
-    ImGui::Checkbox("WireFrame", &m_isWireframe);
-    ImGui::End();
-  }
-  ImGui::Render();
-  ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), command);
-}
-
+#include "TessellateGroundApp.h"
+#include "VulkanBookUtil.h"
+#include "MipmapGenerator.h"
+#include "KtxTexture.h"
+#include "MappedFile.h"
+#include "PixelConvert.h"
+#include "stb_image.h"
+
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include <sstream>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "imgui.h"
+#include "examples/imgui_impl_vulkan.h"
+#include "examples/imgui_impl_glfw.h"
+
+using namespace std;
+
+namespace
+{
+  // 仮想テクスチャを使う場合の地形. 従来(一辺 200、10x10 パッチ)より広く細かい.
+  // 高さは既定のカメラパスが地形の上を通るよう従来と同じにする.
+  const float VirtualTerrainEdge = 1600.0f;
+  const int VirtualTerrainDivide = 256;
+  const float VirtualHeightScale = 25.0f;
+  // 物理テクスチャのスロット数(一辺)と、1 フレームで転送するタイルの最大数.
+  const uint32_t VirtualSlotsPerSide = 32;
+  const uint32_t MaxTileUploadsPerFrame = 16;
+  // 視点の移動量から何フレーム先の位置を予測してページを読み込むか.
+  const float VirtualPredictionFrames = 30.0f;
+  // 描画する距離(射影行列の far と同じ).
+  const float TerrainDrawDistance = 1000.0f;
+}
+
+TessellateGroundApp::TessellateGroundApp()
+{
+  m_camera.SetLookAt(
+    glm::vec3(48.5f, 25.0f, 65.0f),
+    glm::vec3(0.0f, 0.0f, 0.0f)
+  );
+  m_isWireframe = true;
+  m_heightMapBitsPerTexel = 0;
+  m_heightMapBytes = 0;
+  m_heightMapRgba8Bytes = 0;
+
+  m_useVirtualTexture = false;
+  m_vtPhysical = ImageObject{};
+  m_vtPageTable = ImageObject{};
+  m_vtPageSampler = VK_NULL_HANDLE;
+  m_vtLastCameraPos = glm::vec3(0.0f);
+  m_vtUploadCount = 0;
+  m_terrainEdge = 200.0f;
+  m_terrainDivide = 10;
+  m_terrainHeightScale = 25.0f;
+  m_isCullingEnabled = true;
+  m_visiblePatchCount = 0;
+  m_patchDrawCount = 0;
+}
+
+void TessellateGroundApp::Prepare()
+{
+  CreateSampleLayouts();
+
+  auto colorFormat = m_swapchain->GetSurfaceFormat().format;
+  RegisterRenderPass("default", CreateRenderPass(colorFormat, VK_FORMAT_D32_SFLOAT));
+
+  // デプスバッファを準備する.
+  auto extent = m_swapchain->GetSurfaceExtent();
+  m_depthBuffer = CreateTexture(extent.width, extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+  // フレームバッファの準備.
+  PrepareFramebuffers();
+  auto imageCount = m_swapchain->GetImageCount();
+
+  // コマンドバッファの準備.
+  m_commandBuffers.resize(imageCount);
+  for (auto& c : m_commandBuffers)
+  {
+    c.fence = CreateFence();
+    c.commandBuffer = CreateCommandBuffer(false); // コマンドバッファ開始状態にしない.
+  }
+
+  PrepareSceneResource();
+
+  PreparePrimitiveResource();
+}
+
+void TessellateGroundApp::Cleanup()
+{
+  vkDestroyPipeline(m_device, m_tessGroundPipeline, nullptr);
+  vkDestroyPipeline(m_device, m_tessGroundWired, nullptr);
+  vkDestroySampler(m_device, m_texSampler, nullptr);
+
+  DestroyImage(m_normalMap);
+  DestroyImage(m_heightMap);
+
+  if (m_useVirtualTexture)
+  {
+    m_vtCache.Close();
+    DestroyImage(m_vtPhysical);
+    DestroyImage(m_vtPageTable);
+    vkDestroySampler(m_device, m_vtPageSampler, nullptr);
+    for (auto& staging : m_vtStaging)
+    {
+      DestroyBuffer(staging);
+    }
+    m_vtStaging.clear();
+  }
+
+  for (auto& ubo : m_tessUniform)
+  {
+    DestroyBuffer(ubo);
+  }
+  m_tessUniform.clear();
+
+  DestroyBuffer(m_quad.resVertexBuffer);
+  DestroyBuffer(m_quad.resIndexBuffer);
+
+  DestroyImage(m_depthBuffer);
+  auto count = uint32_t(m_framebuffers.size());
+  DestroyFramebuffers(count, m_framebuffers.data());
+
+  for (auto& c : m_commandBuffers)
+  {
+    DestroyCommandBuffer(c.commandBuffer);
+    DestroyFence(c.fence);
+  }
+  m_commandBuffers.clear();
+}
+
+bool TessellateGroundApp::OnMouseButtonDown(int msg)
+{
+  if (VulkanAppBase::OnMouseButtonDown(msg))
+    return true;
+
+  m_camera.OnMouseButtonDown(msg);
+  return true;
+}
+
+bool TessellateGroundApp::OnMouseMove(int dx, int dy)
+{
+  if (VulkanAppBase::OnMouseMove(dx, dy))
+    return true;
+
+  m_camera.OnMouseMove(dx, dy);
+  return true;
+}
+
+CameraPath TessellateGroundApp::CreateDefaultCameraPath()
+{
+  // 地形の上を低空で一周する.
+  // 視点が近づいたり離れたりすることで、テッセレーションの分割数が変化する.
+  struct FlyKey
+  {
+    float time;
+    glm::vec3 eye;
+    glm::vec3 target;
+  };
+  const FlyKey keys[] = {
+    {  0.0f, glm::vec3( 48.5f, 25.0f,  65.0f), glm::vec3(  0.0f, 0.0f,   0.0f) },
+    {  3.0f, glm::vec3(-30.0f, 18.0f,  70.0f), glm::vec3(-80.0f, 5.0f,   0.0f) },
+    {  6.0f, glm::vec3(-75.0f, 12.0f,  20.0f), glm::vec3(-40.0f, 5.0f, -80.0f) },
+    {  9.0f, glm::vec3(-40.0f, 15.0f, -75.0f), glm::vec3( 50.0f, 5.0f, -60.0f) },
+    { 12.0f, glm::vec3( 50.0f, 10.0f, -70.0f), glm::vec3( 80.0f, 5.0f,  20.0f) },
+    { 15.0f, glm::vec3( 80.0f, 20.0f,  10.0f), glm::vec3( 20.0f, 5.0f,  70.0f) },
+    { 18.0f, glm::vec3( 60.0f, 40.0f,  80.0f), glm::vec3(  0.0f, 0.0f,   0.0f) },
+    { 21.0f, glm::vec3( 48.5f, 25.0f,  65.0f), glm::vec3(  0.0f, 0.0f,   0.0f) },
+  };
+  CameraPath path;
+  for (const auto& k : keys)
+  {
+    path.AddLookAt(k.time, k.eye, k.target);
+  }
+  return path;
+}
+
+bool TessellateGroundApp::OnMouseButtonUp(int msg)
+{
+  if (VulkanAppBase::OnMouseButtonUp(msg))
+    return true;
+
+  m_camera.OnMouseButtonUp();
+  return true;
+}
+
+void TessellateGroundApp::CreateSampleLayouts()
+{
+  // ディスクリプタセットレイアウトの準備.
+  std::vector<VkDescriptorSetLayoutBinding > dsLayoutBindings;
+
+  // 0: uniformBuffer, 1: texture(+sampler) を使用するシェーダー用レイアウト.
+  dsLayoutBindings = {
+    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
+    { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
+  };
+  VkDescriptorSetLayoutCreateInfo dsLayoutCI{
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+    nullptr, 0,
+    uint32_t(dsLayoutBindings.size()), dsLayoutBindings.data(),
+  };
+
+  VkResult result;
+  VkDescriptorSetLayout dsLayout;
+
+  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
+  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
+  RegisterLayout("u1t1", dsLayout);
+
+  // 0: uniformBuffer, 1,2: texture(+sampler) を使用するシェーダー用レイアウト.
+  dsLayoutBindings = {
+    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
+    { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
+    { 2, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL },
+  };
+  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
+  dsLayoutCI.pBindings = dsLayoutBindings.data();
+  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
+  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
+  RegisterLayout("u1t2", dsLayout);
+
+  // 0: uniformBuffer, 1: uniformBuffer を使用するシェーダー用レイアウト.
+  dsLayoutBindings = {
+    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
+    { 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL },
+  };
+  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
+  dsLayoutCI.pBindings = dsLayoutBindings.data();
+  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
+  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
+  RegisterLayout("u2", dsLayout);
+
+  dsLayoutBindings = {
+    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, },
+  };
+  dsLayoutCI.bindingCount = uint32_t(dsLayoutBindings.size());
+  dsLayoutCI.pBindings = dsLayoutBindings.data();
+  result = vkCreateDescriptorSetLayout(m_device, &dsLayoutCI, nullptr, &dsLayout);
+  ThrowIfFailed(result, "vkCreateDescriptorSetLayout Failed.");
+  RegisterLayout("u1", dsLayout);
+
+  // パイプラインレイアウトの準備
+  VkPipelineLayoutCreateInfo layoutCI{
+    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+    nullptr, 0,
+    0, nullptr, // SetLayouts
+    0, nullptr, // PushConstants
+  };
+  VkPipelineLayout layout;
+
+  dsLayout = GetDescriptorSetLayout("u1t1");
+  layoutCI.setLayoutCount = 1;
+  layoutCI.pSetLayouts = &dsLayout;
+  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
+  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
+  RegisterLayout("u1t1", layout);
+
+  dsLayout = GetDescriptorSetLayout("u1t2");
+  layoutCI.setLayoutCount = 1;
+  layoutCI.pSetLayouts = &dsLayout;
+  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
+  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
+  RegisterLayout("u1t2", layout);
+
+  dsLayout = GetDescriptorSetLayout("u2");
+  layoutCI.setLayoutCount = 1;
+  layoutCI.pSetLayouts = &dsLayout;
+  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
+  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
+  RegisterLayout("u2", layout);
+
+  dsLayout = GetDescriptorSetLayout("u1");
+  layoutCI.setLayoutCount = 1;
+  layoutCI.pSetLayouts = &dsLayout;
+  result = vkCreatePipelineLayout(m_device, &layoutCI, nullptr, &layout);
+  ThrowIfFailed(result, "vkCreatePipelineLayout Failed.");
+  RegisterLayout("u1", layout);
+}
+
+void TessellateGroundApp::Render()
+{
+  if (m_isMinimizedWindow)
+  {
+    MsgLoopMinimizedWindow();
+  }
+  uint32_t imageIndex = 0;
+  if (!AcquireNextImage(&imageIndex))
+  {
+    return;
+  }
+  array<VkClearValue, 2> clearValue = {
+    {
+      { 0.85f, 0.5f, 0.5f, 0.0f}, // for Color
+      { GetDepthClearValue(), 0 }, // for Depth
+    }
+  };
+
+  auto renderArea = VkRect2D{
+    VkOffset2D{0,0},
+    m_swapchain->GetSurfaceExtent(),
+  };
+
+  VkRenderPassBeginInfo rpBI{
+    VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+    nullptr,
+    GetRenderPass("default"),
+    m_framebuffers[imageIndex],
+    renderArea,
+    uint32_t(clearValue.size()), clearValue.data()
+  };
+
+  VkCommandBufferBeginInfo commandBI{
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+    nullptr, 0, nullptr
+  };
+
+  {
+    auto extent = m_swapchain->GetSurfaceExtent();
+    m_projection = CreatePerspective(
+      glm::radians(45.0f), float(extent.width) / float(extent.height), 0.1f, TerrainDrawDistance
+    );
+  }
+
+  {
+    TessellationShaderParameters tessParams;
+    tessParams.world = glm::mat4(1.0);
+    tessParams.view = m_camera.GetViewMatrix();
+    tessParams.proj = m_projection;
+    tessParams.lightPos = glm::vec4(0.0f);
+    tessParams.cameraPos = glm::vec4(m_camera.GetPosition(), 0.0f);
+    tessParams.terrainParams = glm::vec4(m_terrainHeightScale, m_terrainEdge, 0.0f, TerrainDrawDistance);
+    tessParams.virtualParams = glm::vec4(0.0f);
+    if (m_useVirtualTexture)
+    {
+      const auto& file = m_vtCache.GetFile();
+      tessParams.terrainParams.z = float(VirtualSlotsPerSide * file.GetTileExtent());
+      tessParams.virtualParams = glm::vec4(
+        float(file.GetDesc().tileSize), float(file.GetDesc().border), float(file.GetTileExtent()), 0.0f);
+    }
+    WriteToHostVisibleMemory(m_tessUniform[imageIndex].memory, sizeof(tessParams), &tessParams);
+  }
+
+  auto fence = m_commandBuffers[imageIndex].fence;
+  vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
+
+  auto command = m_commandBuffers[imageIndex].commandBuffer;
+
+  vkBeginCommandBuffer(command, &commandBI);
+
+  if (m_useVirtualTexture)
+  {
+    BeginGpuPass(command, "virtualTexture");
+    UpdateVirtualTexture(command, imageIndex);
+    EndGpuPass(command);
+  }
+
+  BeginGpuPass(command, "main");
+  vkCmdBeginRenderPass(command, &rpBI, VK_SUBPASS_CONTENTS_INLINE);
+  auto extent = m_swapchain->GetSurfaceExtent();
+  VkViewport viewport = book_util::GetViewportFlipped(float(extent.width), float(extent.height));
+  VkRect2D scissor{
+    { 0, 0},
+    extent
+  };
+  VkDeviceSize offsets[] = { 0 };
+
+  vkCmdSetScissor(command, 0, 1, &scissor);
+  vkCmdSetViewport(command, 0, 1, &viewport);
+ 
+  auto pipelineLayout = GetPipelineLayout("u1t2");
+  if (m_isWireframe)
+  {
+    vkCmdBindPipeline(command, VK_PIPELINE_BIND_POINT_GRAPHICS, m_tessGroundWired);
+  }
+  else
+  {
+    vkCmdBindPipeline(command, VK_PIPELINE_BIND_POINT_GRAPHICS, m_tessGroundPipeline);
+  }
+  vkCmdBindDescriptorSets(command, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &m_dsTessSample[imageIndex], 0, nullptr);
+  vkCmdBindIndexBuffer(command, m_quad.resIndexBuffer.buffer, 0, VK_INDEX_TYPE_UINT32);
+  vkCmdBindVertexBuffers(command, 0, 1, &m_quad.resVertexBuffer.buffer, offsets);
+  DrawVisiblePatches(command);
+
+  RenderHUD(command);
+
+  vkCmdEndRenderPass(command);
+  EndGpuPass(command);
+  vkEndCommandBuffer(command);
+
+  SubmitFrame(command, fence, imageIndex);
+}
+
+void TessellateGroundApp::DrawVisiblePatches(VkCommandBuffer command)
+{
+  const auto patchCount = uint32_t(m_patchBounds.size());
+  if (m_isCullingEnabled)
+  {
+    auto frustum = m_camera.GetFrustum(m_projection);
+    m_visiblePatchCount = frustum.CullAabbs(m_patchBounds.data(), patchCount, m_patchVisible.data());
+  }
+  else
+  {
+    std::fill(m_patchVisible.begin(), m_patchVisible.end(), uint8_t(1));
+    m_visiblePatchCount = patchCount;
+  }
+
+  // 見えるパッチは各行で連続するため、描画の回数は行数程度に収まる.
+  m_patchDrawCount = 0;
+  uint32_t first = 0;
+  while (first < patchCount)
+  {
+    if (!m_patchVisible[first])
+    {
+      ++first;
+      continue;
+    }
+    uint32_t last = first + 1;
+    while (last < patchCount && m_patchVisible[last])
+    {
+      ++last;
+    }
+    vkCmdDrawIndexed(command, (last - first) * 4, 1, first * 4, 0, 0);
+    ++m_patchDrawCount;
+    first = last;
+  }
+}
+
+void TessellateGroundApp::PrepareFramebuffers()
+{
+  auto imageCount = m_swapchain->GetImageCount();
+  auto extent = m_swapchain->GetSurfaceExtent();
+  m_framebuffers.resize(imageCount);
+  for (uint32_t i = 0; i < imageCount; ++i)
+  {
+    vector<VkImageView> views;
+    views.push_back(m_swapchain->GetImageView(i));
+    views.push_back(m_depthBuffer.view);
+
+    m_framebuffers[i] = CreateFramebuffer(
+      GetRenderPass("default"),
+      extent.width, extent.height,
+      uint32_t(views.size()), views.data()
+    );
+  }
+}
+
+void TessellateGroundApp::OnSwapchainRecreated()
+{
+  // 古いデプスバッファ/フレームバッファは使用中のフレームの完了後に破棄する.
+  auto depthBuffer = m_depthBuffer;
+  auto framebuffers = m_framebuffers;
+  DeferredDestroy([=]() mutable {
+    DestroyImage(depthBuffer);
+    DestroyFramebuffers(uint32_t(framebuffers.size()), framebuffers.data());
+  });
+
+  // デプスバッファを再生成.
+  auto extent = m_swapchain->GetSurfaceExtent();
+  m_depthBuffer = CreateTexture(extent.width, extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+  // フレームバッファを準備.
+  PrepareFramebuffers();
+}
+
+void TessellateGroundApp::PrepareSceneResource()
+{
+  VkSamplerCreateInfo samplerCI{
+    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, nullptr,
+    0,
+    VK_FILTER_LINEAR,
+    VK_FILTER_LINEAR,
+    VK_SAMPLER_MIPMAP_MODE_LINEAR,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    0.0f,
+    VK_FALSE,
+    1.0f,
+    VK_FALSE,
+    VK_COMPARE_OP_NEVER,
+    0.0f,
+    VK_LOD_CLAMP_NONE, // 全てのミップレベルを使う.
+    VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE,
+    VK_FALSE
+  };
+  vkCreateSampler(m_device, &samplerCI, nullptr, &m_texSampler);
+
+  // 仮想テクスチャを使う場合、ハイトマップと法線マップは読み込まない(法線は高さから求める).
+  m_useVirtualTexture = PrepareVirtualTexture();
+  if (m_useVirtualTexture)
+  {
+    m_heightMap = ImageObject{};
+    m_normalMap = ImageObject{};
+    return;
+  }
+
+  // TextureCooker で変換したファイル(R16/BC5)があり、デバイスが対応していればそちらを使う.
+  // 遠方ではテッセレーションの粗さに合わせた縮小画像を参照するため、ミップマップを作成する.
+  const auto mipmaps = MipmapGeneration::Gpu;
+  // ハイトマップは形式や統計を表示に使うため、この場で読み込む.
+  m_heightMap = LoadHeightMap(mipmaps);
+  // 法線マップは別スレッドで読み込み、完了までは仮テクスチャ(平坦な法線に近い灰色)で描画する.
+  auto onReady = [this](const ImageObject& image) { OnNormalMapReady(image); };
+  m_normalMap = CanLoadTextureFromKtx("normalmap.ktx2") ?
+    LoadTextureFromKtxAsync("normalmap.ktx2", VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipmaps, onReady) :
+    Load2DTextureFromFileAsync("normalmap.png", VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipmaps, onReady);
+}
+
+void TessellateGroundApp::OnNormalMapReady(const ImageObject& image)
+{
+  // 仮テクスチャは呼び出し元で破棄される.
+  m_normalMap = image;
+  VkDescriptorImageInfo imageInfo{
+    m_texSampler,
+    m_normalMap.view,
+    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+  };
+  for (auto ds : m_dsTessSample)
+  {
+    auto writeDS = book_util::CreateWriteDescriptorSet(ds, 2, &imageInfo);
+    vkUpdateDescriptorSets(m_device, 1, &writeDS, 0, nullptr);
+  }
+}
+
+TessellateGroundApp::ImageObject TessellateGroundApp::LoadHeightMap(MipmapGeneration mipmaps)
+{
+  auto startTime = std::chrono::high_resolution_clock::now();
+  mipmaps = ResolveMipmapGeneration(mipmaps);
+
+  // ミップマップを含めたメモリ量. 1 テクセルの読み込みで転送する量もこの比率で変わる.
+  uint32_t width = 0, height = 0;
+  auto calcBytes = [&](uint32_t bitsPerTexel)
+  {
+    uint64_t bytes = 0;
+    auto levelCount = mipmaps == MipmapGeneration::None ? 1u : book_util::GetMipmapLevelCount(width, height);
+    for (uint32_t level = 0; level < levelCount; ++level)
+    {
+      bytes += uint64_t((std::max)(width >> level, 1u)) * (std::max)(height >> level, 1u) * bitsPerTexel / 8;
+    }
+    return bytes;
+  };
+  auto report = [&](const char* fileName)
+  {
+    std::stringstream ss;
+    ss << fileName << ": " << width << "x" << height << " " << m_heightMapFormat
+      << " " << m_heightMapBytes / 1024 << " KB (RGBA8: " << m_heightMapRgba8Bytes / 1024 << " KB)\n";
+    book_util::OutputLog(ss.str());
+  };
+
+  KtxTexture ktx;
+  if (CanLoadTextureFromKtx("heightmap.ktx2") && ktx.Open("heightmap.ktx2"))
+  {
+    width = ktx.GetWidth();
+    height = ktx.GetHeight();
+    KtxTexture::FormatInfo info;
+    KtxTexture::GetFormatInfo(ktx.GetFormat(), info);
+    m_heightMapFormat = ktx.GetFormat() == VK_FORMAT_R16_UNORM ? "R16_UNORM" :
+      ktx.GetFormat() == VK_FORMAT_BC4_UNORM_BLOCK ? "BC4_UNORM" : "KTX2";
+    m_heightMapBitsPerTexel = info.blockBytes * 8 / (info.blockWidth * info.blockHeight);
+    if (ktx.GetLevelCount() > 1 || info.blockWidth > 1)
+    {
+      // ファイル内のレベルをそのまま転送する(圧縮形式では GPU でミップマップを作成しない).
+      m_heightMapBytes = 0;
+      for (uint32_t level = 0; level < ktx.GetLevelCount(); ++level)
+      {
+        m_heightMapBytes += ktx.GetLevelSize(level);
+      }
+    }
+    else
+    {
+      m_heightMapBytes = calcBytes(m_heightMapBitsPerTexel);
+    }
+    m_heightMapRgba8Bytes = calcBytes(32);
+    ktx.Close();
+    report("heightmap.ktx2");
+    return LoadTextureFromKtx("heightmap.ktx2", VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipmaps);
+  }
+
+  // 16 ビットのテクスチャを扱えないデバイスでは、従来通り RGBA8 で読み込む.
+  VkFormatFeatureFlags required = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+  if (mipmaps != MipmapGeneration::None)
+  {
+    // ミップマップは常に GPU で作成するため縮小コピーができること.
+    required |= VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+  }
+  VkFormatProperties props;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, VK_FORMAT_R16_UNORM, &props);
+  if ((props.optimalTilingFeatures & required) != required)
+  {
+    int w = 0, h = 0, comp = 0;
+    stbi_info("heightmap.png", &w, &h, &comp);
+    width = uint32_t(w);
+    height = uint32_t(h);
+    m_heightMapFormat = "R8G8B8A8_UNORM";
+    m_heightMapBitsPerTexel = 32;
+    m_heightMapBytes = m_heightMapRgba8Bytes = calcBytes(32);
+    report("heightmap.png");
+    return FinishTextureUpload(Prepare2DTextureUpload("heightmap.png",
+      VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipmaps));
+  }
+
+  // heightmap.r16 は変換なしでそのまま転送する. PNG は 8 ビットでも 16 ビットへ広げて読み込む.
+  const char* fileName = "heightmap.r16";
+  // 画素はデコード結果から直接ステージングバッファへ書き込む.
+  MappedFile raw;
+  std::function<void(void*)> writePixels;
+  void* pImage = nullptr;
+  if (book_util::FileExists(fileName) && raw.Open(fileName))
+  {
+    width = height = uint32_t(std::sqrt(double(raw.GetSize() / 2)));
+    if (uint64_t(width) * height * 2 != raw.GetSize())
+    {
+      throw book_util::VulkanException("heightmap.r16 must be a square image.");
+    }
+    writePixels = [&](void* mapped) { memcpy(mapped, raw.GetData(), size_t(raw.GetSize())); };
+  }
+  else
+  {
+    // 8 ビットの画像は 16 ビットへ広げながら書き込む.
+    fileName = "heightmap.png";
+    int w, h;
+    const bool is16Bit = stbi_is_16_bit(fileName) != 0;
+    if (is16Bit)
+    {
+      pImage = stbi_load_16(fileName, &w, &h, nullptr, 1);
+    }
+    else
+    {
+      pImage = stbi_load(fileName, &w, &h, nullptr, 1);
+    }
+    if (pImage == nullptr)
+    {
+      throw book_util::VulkanException(std::string("cannot load ") + fileName);
+    }
+    width = uint32_t(w);
+    height = uint32_t(h);
+    writePixels = [&, is16Bit](void* mapped)
+    {
+      if (is16Bit)
+      {
+        memcpy(mapped, pImage, size_t(width) * height * sizeof(uint16_t));
+      }
+      else
+      {
+        book_util::Expand8To16(static_cast<const uint8_t*>(pImage), static_cast<uint16_t*>(mapped), 1, width, height);
+      }
+    };
+  }
+
+  // 16 ビットの縮小は CPU で行わないため、ミップマップは GPU で作成する.
+  if (mipmaps != MipmapGeneration::None)
+  {
+    mipmaps = MipmapGeneration::Gpu;
+  }
+  auto levelCount = mipmaps == MipmapGeneration::None ? 1u : book_util::GetMipmapLevelCount(width, height);
+  std::vector<VkBufferImageCopy> regions(1);
+  regions[0] = VkBufferImageCopy{};
+  regions[0].imageExtent = { width, height, 1 };
+  regions[0].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+  auto texture = CreateTextureFromPixels(VK_FORMAT_R16_UNORM, width, height, levelCount,
+    width * height * uint32_t(sizeof(uint16_t)), regions, mipmaps, writePixels);
+  stbi_image_free(pImage);
+
+  m_heightMapFormat = "R16_UNORM";
+  m_heightMapBitsPerTexel = 16;
+  m_heightMapBytes = calcBytes(16);
+  m_heightMapRgba8Bytes = calcBytes(32);
+  report(fileName);
+  RecordTextureLoadTime(fileName, startTime);
+  return texture;
+}
+
+TessellateGroundApp::ImageObject TessellateGroundApp::CreateTextureFromPixels(VkFormat format, uint32_t width, uint32_t height, uint32_t levelCount,
+  const void* pixels, uint32_t dataSize, const std::vector<VkBufferImageCopy>& regions, MipmapGeneration mipmaps)
+{
+  return CreateTextureFromPixels(format, width, height, levelCount, dataSize, regions, mipmaps,
+    [=](void* mapped) { memcpy(mapped, pixels, dataSize); });
+}
+
+TessellateGroundApp::ImageObject TessellateGroundApp::CreateTextureFromPixels(VkFormat format, uint32_t width, uint32_t height, uint32_t levelCount,
+  uint32_t dataSize, const std::vector<VkBufferImageCopy>& regions, MipmapGeneration mipmaps,
+  const std::function<void(void*)>& writePixels)
+{
+  VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  if (mipmaps == MipmapGeneration::Gpu)
+  {
+    usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
+    0,
+    VK_IMAGE_TYPE_2D,
+    format, { width, height, 1u },
+    levelCount, 1,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  VkResult result;
+  VkImage image;
+  result = vkCreateImage(m_device, &imageCI, nullptr, &image);
+  ThrowIfFailed(result, "vkCreateImage failed.");
+  auto memory = AllocateMemory(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  result = vkBindImageMemory(m_device, image, memory, 0);
+  ThrowIfFailed(result, "vkBindImageMemory failed.");
+
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    image,
+    VK_IMAGE_VIEW_TYPE_2D, imageCI.format,
+    book_util::DefaultComponentMapping(),
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 1}
+  };
+  VkImageView view;
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &view);
+  ThrowIfFailed(result, "vkCreateImageView failed.");
+
+  // ステージング用準備.
+  BufferObject buffersSrc;
+  buffersSrc = CreateBuffer(dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  void* mapped = nullptr;
+  result = vkMapMemory(m_device, buffersSrc.memory, 0, VK_WHOLE_SIZE, 0, &mapped);
+  ThrowIfFailed(result, "vkMapMemory failed.");
+  writePixels(mapped);
+  vkUnmapMemory(m_device, buffersSrc.memory);
+
+  // 転送.
+  auto command = CreateCommandBuffer();
+  VkImageSubresourceRange subresource{};
+  subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+  subresource.baseMipLevel = 0;
+  subresource.levelCount = levelCount;
+  subresource.baseArrayLayer = 0;
+  subresource.layerCount = 1;
+
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    0, VK_ACCESS_TRANSFER_WRITE_BIT,
+    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    image,
+    subresource
+  };
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+
+  vkCmdCopyBufferToImage(
+    command,
+    buffersSrc.buffer,
+    image,
+    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    uint32_t(regions.size()), regions.data()
+  );
+
+  if (mipmaps == MipmapGeneration::Gpu)
+  {
+    GenerateMipmapsOnGpu(command, image, imageCI.format, width, height,
+      levelCount, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+  }
+  else
+  {
+    imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    // ハイトマップ、ページテーブルはテッセレーションのシェーダーで参照する.
+    vkCmdPipelineBarrier(
+      command,
+      VK_PIPELINE_STAGE_TRANSFER_BIT,
+      VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT,
+      0, 0, nullptr,
+      0, nullptr,
+      1, &imb);
+  }
+
+  FinishCommandBuffer(command);
+  DestroyCommandBuffer(command);
+
+  DestroyBuffer(buffersSrc);
+
+  ImageObject texture;
+  texture.image = image;
+  texture.memory = memory;
+  texture.view = view;
+  return texture;
+
+}
+
+void TessellateGroundApp::CreateGroundGrid(float edge, int divide, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+  using namespace glm;
+  vertices.clear();
+  indices.clear();
+  for (int z = 0; z < divide + 1; ++z)
+  {
+    for (int x = 0; x < divide + 1; ++x)
+    {
+      Vertex v;
+      v.Position = vec3(
+        edge * x / divide,
+        0.0f,
+        edge * z / divide
+      );
+      v.UV = vec2(
+        v.Position.x / edge,
+        v.Position.z / edge
+      );
+      vertices.push_back(v);
+    }
+  }
+  for (int z = 0; z < divide; ++z)
+  {
+    for (int x = 0; x < divide; ++x)
+    {
+      const int rows = divide + 1;
+      int v0 = x, v1 = x + 1;
+      v0 = v0 + rows * z;
+      v1 = v1 + rows * z;
+      indices.push_back(v0);
+      indices.push_back(v1);
+      indices.push_back(v0 + rows);
+      indices.push_back(v1 + rows);
+    }
+  }
+  // 中心補正.
+  for (auto& v : vertices)
+  {
+    v.Position.x -= edge * 0.5f;
+    v.Position.z -= edge * 0.5f;
+  }
+}
+
+void TessellateGroundApp::PreparePrimitiveResource()
+{
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  CreateGroundGrid(m_terrainEdge, m_terrainDivide, vertices, indices);
+  m_quad = CreateSimpleModel(vertices, indices, VK_PRIMITIVE_TOPOLOGY_PATCH_LIST);
+
+  // パッチの範囲. 高さは 0 からハイトマップの最大値(倍率)までとする.
+  // インデックスはパッチごとに 4 個ずつ CreateGroundGrid と同じ順に並ぶ.
+  const auto patchCount = uint32_t(indices.size() / 4);
+  m_patchBounds.resize(patchCount);
+  m_patchVisible.assign(patchCount, 1);
+  for (uint32_t i = 0; i < patchCount; ++i)
+  {
+    const auto& p0 = vertices[indices[i * 4 + 0]].Position;
+    const auto& p3 = vertices[indices[i * 4 + 3]].Position;
+    m_patchBounds[i].min = glm::vec3(p0.x, 0.0f, p0.z);
+    m_patchBounds[i].max = glm::vec3(p3.x, m_terrainHeightScale, p3.z);
+  }
+
+  auto imageCount = int(m_swapchain->GetImageCount());
+  m_tessUniform = CreateUniformBuffers(sizeof(TessellationShaderParameters), imageCount);
+
+  VkResult result;
+  VkDescriptorSetLayout dsLayout = GetDescriptorSetLayout("u1t2");
+  VkDescriptorSetAllocateInfo dsAI{
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+    nullptr, m_descriptorPool,
+    1, &dsLayout
+  };
+  m_dsTessSample.resize(imageCount);
+  for (int i = 0; i < imageCount; ++i)
+  {
+    result = vkAllocateDescriptorSets(m_device, &dsAI, &m_dsTessSample[i]);
+    ThrowIfFailed(result, "vkAllocateDescriptorSets failed.");
+  }
+
+  for (int i = 0; i < imageCount; ++i)
+  {
+    VkDescriptorBufferInfo bufferInfo{
+      m_tessUniform[i].buffer, 0, VK_WHOLE_SIZE
+    };
+    VkDescriptorImageInfo imageInfo{
+      m_texSampler,
+      m_heightMap.view,
+      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    };
+    VkDescriptorImageInfo imageInfo2{
+      m_texSampler,
+      m_normalMap.view,
+      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    };
+    if (m_useVirtualTexture)
+    {
+      // 1: 物理テクスチャ, 2: ページテーブル.
+      imageInfo.imageView = m_vtPhysical.view;
+      imageInfo2.sampler = m_vtPageSampler;
+      imageInfo2.imageView = m_vtPageTable.view;
+    }
+
+    std::vector<VkWriteDescriptorSet> writeDS = {
+      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 0, &bufferInfo),
+      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 1, &imageInfo),
+      book_util::CreateWriteDescriptorSet(m_dsTessSample[i], 2, &imageInfo2)
+    };
+    vkUpdateDescriptorSets(m_device, uint32_t(writeDS.size()), writeDS.data(), 0, nullptr);
+  }
+
+  // パイプラインレイアウトの準備
+  VkPipelineLayout layout = GetPipelineLayout("u1t2");
+
+  // パイプライン構築.
+  auto stride = uint32_t(sizeof(Vertex));
+  VkVertexInputBindingDescription vibDesc{
+      0, // binding
+      stride,
+      VK_VERTEX_INPUT_RATE_VERTEX
+  };
+
+  array<VkVertexInputAttributeDescription, 2> inputAttribs{
+    {
+      { 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, Position) },
+      { 1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, UV) },
+    }
+  };
+  VkPipelineVertexInputStateCreateInfo pipelineVisCI{
+    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+    nullptr, 0,
+    1, &vibDesc,
+    uint32_t(inputAttribs.size()), inputAttribs.data()
+  };
+
+  auto blendAttachmentState = book_util::GetOpaqueColorBlendAttachmentState();
+  VkPipelineColorBlendStateCreateInfo colorBlendStateCI{
+    VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+    nullptr, 0,
+    VK_FALSE, VK_LOGIC_OP_CLEAR, // logicOpEnable
+    1, &blendAttachmentState,
+    { 0.0f, 0.0f, 0.0f,0.0f }
+  };
+  VkPipelineInputAssemblyStateCreateInfo inputAssemblyCI{
+    VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+    nullptr, 0, VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
+    VK_FALSE,
+  };
+  VkPipelineMultisampleStateCreateInfo multisampleCI{
+    VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+    nullptr, 0,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_FALSE, // sampleShadingEnable
+    0.0f, nullptr,
+    VK_FALSE, VK_FALSE,
+  };
+
+  VkPipelineTessellationStateCreateInfo tessStateCI{
+    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO, 
+    nullptr,
+    0,
+    4
+  };
+
+  auto extentBackbuffer = m_swapchain->GetSurfaceExtent();
+  auto viewportBackbuffer = book_util::GetViewportFlipped(float(extentBackbuffer.width), float(extentBackbuffer.height));
+  auto scissorBackbuffer = VkRect2D{
+    { 0, 0}, extentBackbuffer
+  };
+
+  auto viewportStateCI = VkPipelineViewportStateCreateInfo{
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+    nullptr, 0,
+  };
+
+  auto rasterizerState = book_util::GetDefaultRasterizerState();
+  auto dsState = book_util::GetDefaultDepthStencilState(GetDepthCompareOp());
+
+  rasterizerState.cullMode = VK_CULL_MODE_BACK_BIT;
+
+  // DynamicState
+  vector<VkDynamicState> dynamicStates{
+    VK_DYNAMIC_STATE_SCISSOR, VK_DYNAMIC_STATE_VIEWPORT
+  };
+  VkPipelineDynamicStateCreateInfo pipelineDynamicStateCI{
+    VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr, 0,
+    uint32_t(dynamicStates.size()), dynamicStates.data(),
+  };
+
+  std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
+  VkGraphicsPipelineCreateInfo pipelineCI{
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, nullptr, 0,
+  };
+  pipelineCI.pVertexInputState = &pipelineVisCI;
+  pipelineCI.pInputAssemblyState = &inputAssemblyCI;
+  pipelineCI.pRasterizationState = &rasterizerState;
+  pipelineCI.pMultisampleState = &multisampleCI;
+  pipelineCI.pDepthStencilState = &dsState;
+  pipelineCI.pColorBlendState = &colorBlendStateCI;
+
+  shaderStages = {
+    book_util::LoadShader(m_device, "tessVS.spv", VK_SHADER_STAGE_VERTEX_BIT),
+    book_util::LoadShader(m_device, m_useVirtualTexture ? "tessVtTCS.spv" : "tessTCS.spv", VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT),
+    book_util::LoadShader(m_device, m_useVirtualTexture ? "tessVtTES.spv" : "tessTES.spv", VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT),
+    book_util::LoadShader(m_device, "tessFS.spv", VK_SHADER_STAGE_FRAGMENT_BIT)
+  };
+  viewportStateCI.scissorCount = 1;
+  viewportStateCI.pScissors = &scissorBackbuffer;
+  viewportStateCI.viewportCount = 1;
+  viewportStateCI.pViewports = &viewportBackbuffer;
+
+  pipelineCI.pViewportState = &viewportStateCI;
+  pipelineCI.pDynamicState = &pipelineDynamicStateCI;
+  pipelineCI.renderPass = GetRenderPass("default");
+  pipelineCI.layout = layout;
+  pipelineCI.pStages = shaderStages.data();
+  pipelineCI.stageCount = uint32_t(shaderStages.size());
+  pipelineCI.pTessellationState = &tessStateCI;
+
+  result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineCI, nullptr, &m_tessGroundPipeline);
+  ThrowIfFailed(result, "vkCreateGraphicsPipelines failed.");
+
+  // ワイヤーフレーム描画用も作成.
+  rasterizerState.polygonMode = VK_POLYGON_MODE_LINE;
+  result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineCI, nullptr, &m_tessGroundWired);
+  ThrowIfFailed(result, "vkCreateGraphicsPipelines failed.");
+
+  book_util::DestroyShaderModules(m_device, shaderStages);
+}
+
+bool TessellateGroundApp::PrepareVirtualTexture()
+{
+  const char* fileName = "heightmap.vtex";
+  if (!book_util::FileExists(fileName))
+  {
+    return false;
+  }
+  VkFormatProperties props;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, VK_FORMAT_R16_UNORM, &props);
+  if ((props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) == 0)
+  {
+    return false;
+  }
+  // 使用中のフレームが参照しているスロットは再利用しない.
+  const auto imageCount = m_swapchain->GetImageCount();
+  if (!m_vtCache.Open(fileName, VirtualSlotsPerSide, imageCount) ||
+    m_vtCache.GetFile().GetDesc().format != VK_FORMAT_R16_UNORM)
+  {
+    m_vtCache.Close();
+    book_util::OutputLog(std::string("cannot open ") + fileName + "\n");
+    return false;
+  }
+  const auto& file = m_vtCache.GetFile();
+  const auto levelCount = file.GetLevelCount();
+
+  // 物理テクスチャ. 中身はタイルの読み込み後に転送する.
+  const auto physicalSize = VirtualSlotsPerSide * file.GetTileExtent();
+  m_vtPhysical = CreateTexture(physicalSize, physicalSize, VK_FORMAT_R16_UNORM,
+    VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+  {
+    auto command = CreateCommandBuffer();
+    VkImageMemoryBarrier imb{
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+      0, VK_ACCESS_SHADER_READ_BIT,
+      VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+      VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+      m_vtPhysical.image,
+      { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 }
+    };
+    vkCmdPipelineBarrier(command,
+      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+      0, 0, nullptr,
+      0, nullptr,
+      1, &imb);
+    FinishCommandBuffer(command);
+  }
+
+  // ページテーブル. レベルごとのページの並びをそのままミップレベルとする.
+  const auto& pageTable = m_vtCache.GetPageTable();
+  std::vector<VkBufferImageCopy> regions(levelCount);
+  for (uint32_t level = 0; level < levelCount; ++level)
+  {
+    regions[level] = VkBufferImageCopy{};
+    regions[level].bufferOffset = m_vtCache.GetPageTableOffset(level) * sizeof(VirtualTextureCache::PageEntry);
+    regions[level].imageExtent = { file.GetPageCountX(level), file.GetPageCountY(level), 1 };
+    regions[level].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+  }
+  const auto pageTableBytes = uint32_t(pageTable.size() * sizeof(VirtualTextureCache::PageEntry));
+  m_vtPageTable = CreateTextureFromPixels(VK_FORMAT_R8G8B8A8_UINT, file.GetPageCountX(0), file.GetPageCountY(0), levelCount,
+    pageTable.data(), pageTableBytes, regions, MipmapGeneration::None);
+
+  // ページテーブルは texelFetch で参照するため補間しない.
+  VkSamplerCreateInfo samplerCI{
+    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, nullptr,
+    0,
+    VK_FILTER_NEAREST,
+    VK_FILTER_NEAREST,
+    VK_SAMPLER_MIPMAP_MODE_NEAREST,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+    0.0f,
+    VK_FALSE,
+    1.0f,
+    VK_FALSE,
+    VK_COMPARE_OP_NEVER,
+    0.0f,
+    VK_LOD_CLAMP_NONE,
+    VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE,
+    VK_FALSE
+  };
+  auto result = vkCreateSampler(m_device, &samplerCI, nullptr, &m_vtPageSampler);
+  ThrowIfFailed(result, "vkCreateSampler failed.");
+
+  // フレームごとのステージングバッファ. タイルの後ろにページテーブルを置く.
+  const auto stagingSize = MaxTileUploadsPerFrame * file.GetTileBytes() + pageTableBytes;
+  m_vtStaging.resize(imageCount);
+  for (auto& staging : m_vtStaging)
+  {
+    staging = CreateBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  }
+
+  m_terrainEdge = VirtualTerrainEdge;
+  m_terrainDivide = VirtualTerrainDivide;
+  m_terrainHeightScale = VirtualHeightScale;
+  m_vtLastCameraPos = m_camera.GetPosition();
+
+  // GPU に置くのは物理テクスチャとページテーブルのみ. 全体を RGBA8 で置いた場合と比べて表示する.
+  uint64_t virtualTexels = 0;
+  for (uint32_t level = 0; level < levelCount; ++level)
+  {
+    uint64_t size = file.GetDesc().width >> level;
+    virtualTexels += size * size;
+  }
+  m_heightMapFormat = "R16_UNORM (virtual)";
+  m_heightMapBitsPerTexel = 16;
+  m_heightMapBytes = uint64_t(physicalSize) * physicalSize * 2 + pageTableBytes;
+  m_heightMapRgba8Bytes = virtualTexels * 4;
+
+  std::stringstream ss;
+  ss << fileName << ": " << file.GetDesc().width << "x" << file.GetDesc().height
+    << " tile " << file.GetDesc().tileSize << " levels " << levelCount
+    << " file " << file.GetTotalBytes() / (1024 * 1024) << " MB, resident "
+    << m_heightMapBytes / 1024 << " KB (RGBA8: " << m_heightMapRgba8Bytes / (1024 * 1024) << " MB)\n";
+  book_util::OutputLog(ss.str());
+  return true;
+}
+
+float TessellateGroundApp::CalcVirtualTextureLod(float distance) const
+{
+  const float TessNear = 2.0f, TessFar = 150.0f;
+  const float MaxTessFactor = 32.0f;
+  float tessFactor = MaxTessFactor - (MaxTessFactor - 1) * (distance - TessNear) / (TessFar - TessNear);
+  tessFactor = (std::min)((std::max)(tessFactor, 1.0f), MaxTessFactor);
+  float patchTexels = float(m_vtCache.GetFile().GetDesc().width) / float(m_terrainDivide);
+  return std::log2((std::max)(patchTexels / tessFactor, 1.0f));
+}
+
+void TessellateGroundApp::UpdateVirtualTexture(VkCommandBuffer command, uint32_t imageIndex)
+{
+  const auto& file = m_vtCache.GetFile();
+  const auto levelCount = file.GetLevelCount();
+
+  // 現在の視点と、このまま移動した場合の少し先の視点から必要なページを求める.
+  auto eye = m_camera.GetPosition();
+  const glm::vec3 eyes[] = { eye, eye + (eye - m_vtLastCameraPos) * VirtualPredictionFrames };
+  m_vtLastCameraPos = eye;
+
+  // 最も粗いページから幅優先でたどり、視点に近く細かいレベルが必要なページを 4 つの子ページへ分ける.
+  // キャッシュは登録順に優先するため、粗いページ、同じレベルでは近いページほど先に読み込まれる.
+  struct Page
+  {
+    uint32_t x, y;
+    float distance;
+  };
+  std::vector<Page> pages(1, Page{ 0, 0, 0.0f }), children;
+  m_vtCache.BeginFrame();
+  for (uint32_t level = levelCount; level-- > 0;)
+  {
+    const float pageEdge = m_terrainEdge / float(file.GetPageCountX(level));
+    for (auto& page : pages)
+    {
+      float x0 = page.x * pageEdge - m_terrainEdge * 0.5f;
+      float z0 = page.y * pageEdge - m_terrainEdge * 0.5f;
+      page.distance = FLT_MAX;
+      for (const auto& p : eyes)
+      {
+        float dx = (std::max)((std::max)(x0 - p.x, p.x - (x0 + pageEdge)), 0.0f);
+        float dz = (std::max)((std::max)(z0 - p.z, p.z - (z0 + pageEdge)), 0.0f);
+        float dy = (std::max)((std::max)(-p.y, p.y - m_terrainHeightScale), 0.0f);
+        page.distance = (std::min)(page.distance, std::sqrt(dx * dx + dy * dy + dz * dz));
+      }
+    }
+    std::sort(pages.begin(), pages.end(), [](const Page& a, const Page& b) { return a.distance < b.distance; });
+
+    children.clear();
+    for (const auto& page : pages)
+    {
+      m_vtCache.Request(level, page.x, page.y);
+      // 法線による分割数の増加(最大で 2 倍)の分、1 レベル細かいページまで読み込む.
+      if (level > 0 && CalcVirtualTextureLod(page.distance) - 1.0f < float(level))
+      {
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+          children.push_back(Page{ page.x * 2 + (i & 1), page.y * 2 + (i >> 1), 0.0f });
+        }
+      }
+    }
+    pages.swap(children);
+  }
+  m_vtCache.EndFrame();
+
+  std::vector<VirtualTextureCache::LoadedTile> tiles;
+  m_vtCache.FetchLoadedTiles(tiles, MaxTileUploadsPerFrame);
+  m_vtUploadCount = uint32_t(tiles.size());
+  if (tiles.empty() && !m_vtCache.IsPageTableDirty())
+  {
+    return;
+  }
+
+  // タイルとページテーブルをステージングバッファへ書き込む.
+  const auto tileBytes = file.GetTileBytes();
+  const auto tileExtent = file.GetTileExtent();
+  const auto& pageTable = m_vtCache.GetPageTable();
+  const VkDeviceSize pageTableOffset = VkDeviceSize(MaxTileUploadsPerFrame) * tileBytes;
+  const auto& staging = m_vtStaging[imageIndex];
+  uint8_t* p = nullptr;
+  vkMapMemory(m_device, staging.memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&p));
+  std::vector<VkBufferImageCopy> tileRegions(tiles.size());
+  for (size_t i = 0; i < tiles.size(); ++i)
+  {
+    memcpy(p + i * tileBytes, tiles[i].data.data(), tileBytes);
+    auto slot = tiles[i].slot;
+    tileRegions[i] = VkBufferImageCopy{};
+    tileRegions[i].bufferOffset = i * tileBytes;
+    tileRegions[i].imageOffset = {
+      int32_t(slot % VirtualSlotsPerSide * tileExtent), int32_t(slot / VirtualSlotsPerSide * tileExtent), 0
+    };
+    tileRegions[i].imageExtent = { tileExtent, tileExtent, 1 };
+    tileRegions[i].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+  }
+  memcpy(p + pageTableOffset, pageTable.data(), pageTable.size() * sizeof(VirtualTextureCache::PageEntry));
+  vkUnmapMemory(m_device, staging.memory);
+  m_vtCache.ClearPageTableDirty();
+
+  std::vector<VkBufferImageCopy> pageTableRegions(levelCount);
+  for (uint32_t level = 0; level < levelCount; ++level)
+  {
+    pageTableRegions[level] = VkBufferImageCopy{};
+    pageTableRegions[level].bufferOffset = pageTableOffset + m_vtCache.GetPageTableOffset(level) * sizeof(VirtualTextureCache::PageEntry);
+    pageTableRegions[level].imageExtent = { file.GetPageCountX(level), file.GetPageCountY(level), 1 };
+    pageTableRegions[level].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+  }
+
+  // 前のフレームのテッセレーションシェーダーが参照し終えてから書き換える.
+  const VkPipelineStageFlags shaderStages =
+    VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT;
+  std::array<VkImageMemoryBarrier, 2> barriers;
+  barriers[0] = VkImageMemoryBarrier{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    m_vtPageTable.image,
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 1 }
+  };
+  barriers[1] = barriers[0];
+  barriers[1].image = m_vtPhysical.image;
+  barriers[1].subresourceRange.levelCount = 1;
+  const auto barrierCount = tiles.empty() ? 1u : 2u;
+  vkCmdPipelineBarrier(command,
+    shaderStages, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    barrierCount, barriers.data());
+
+  if (!tiles.empty())
+  {
+    vkCmdCopyBufferToImage(command, staging.buffer, m_vtPhysical.image,
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, uint32_t(tileRegions.size()), tileRegions.data());
+  }
+  vkCmdCopyBufferToImage(command, staging.buffer, m_vtPageTable.image,
+    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, uint32_t(pageTableRegions.size()), pageTableRegions.data());
+
+  for (auto& imb : barriers)
+  {
+    std::swap(imb.srcAccessMask, imb.dstAccessMask);
+    std::swap(imb.oldLayout, imb.newLayout);
+  }
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TRANSFER_BIT, shaderStages,
+    0, 0, nullptr,
+    0, nullptr,
+    barrierCount, barriers.data());
+}
+
+void TessellateGroundApp::RenderHUD(VkCommandBuffer command)
+{
+  ImGui_ImplVulkan_NewFrame();
+  ImGui_ImplGlfw_NewFrame();
+  ImGui::NewFrame();
+
+  {
+    ImGui::Begin("Control");
+    auto cameraPos = m_camera.GetPosition();
+    ImGui::Text("CameraPos: (%.2f, %.2f, %.2f)", cameraPos.x, cameraPos.y, cameraPos.z);
+    ImGui::Checkbox("WireFrame", &m_isWireframe);
+    ImGui::Checkbox("Frustum Culling", &m_isCullingEnabled);
+    ImGui::Text("Patches: %u / %u (culled %u, %u draws)", m_visiblePatchCount, uint32_t(m_patchBounds.size()),
+      uint32_t(m_patchBounds.size()) - m_visiblePatchCount, m_patchDrawCount);
+    if (GetLoadingTextureCount() > 0)
+    {
+      ImGui::Text("Loading textures: %u", GetLoadingTextureCount());
+    }
+    ImGui::Text("HeightMap: %s (%u bits/texel)", m_heightMapFormat.c_str(), m_heightMapBitsPerTexel);
+    ImGui::Text("  %llu KB (RGBA8: %llu KB)", (unsigned long long)(m_heightMapBytes / 1024), (unsigned long long)(m_heightMapRgba8Bytes / 1024));
+    if (m_useVirtualTexture)
+    {
+      const auto& desc = m_vtCache.GetFile().GetDesc();
+      ImGui::Text("Virtual: %ux%u, tile %u", desc.width, desc.height, desc.tileSize);
+      ImGui::Text("  Resident %u / %u, Requested %u", m_vtCache.GetResidentCount(), m_vtCache.GetSlotCount(), m_vtCache.GetRequestedCount());
+      ImGui::Text("  Pending %u, Uploaded %u", m_vtCache.GetPendingCount(), m_vtUploadCount);
+    }
+    ImGui::End();
+  }
+  ImGui::Render();
+  ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), command);
+}
+
@@ -1,84 +1,142 @@
-#pragma once
-#include "VulkanAppBase.h"
-#include <glm/glm.hpp>
-#include <array>
-#include "Camera.h"
-
-class TessellateGroundApp : public VulkanAppBase
-{
-public:
-  TessellateGroundApp();
-
-  virtual void Prepare();
-  virtual void Cleanup();
-  virtual void Render();
-
-  virtual bool OnSizeChanged(uint32_t width, uint32_t height);
-  virtual bool OnMouseButtonDown(int button);
-  virtual bool OnMouseButtonUp(int button);
-  virtual bool OnMouseMove(int dx, int dy);
-
-  struct ShaderParameters
-  {
-    glm::mat4 world;
-    glm::mat4 view;
-    glm::mat4 proj;
-    glm::vec4 lightPos;
-    glm::vec4 cameraPos;
-  };
-
-private:
-  // {AvŎgp郌CAEg(fBXNv^CAEg/pCvCCAEg)쐬.
-  void CreateSampleLayouts();
-
-  void PrepareFramebuffers();
-  
-  void PrepareSceneResource();
-
-  struct Vertex
-  {
-    glm::vec3 Position;
-    glm::vec2 UV;
-  };
-
-  ImageObject Load2DTextureFromFile(const char* fileName);
-  ImageObject LoadCubeTextureFromFile(const char* faceFiles[6]);
-
-  void PreparePrimitiveResource();
-
-  void RenderHUD(VkCommandBuffer command);
-private:
-  ImageObject m_depthBuffer;
-  std::vector<VkFramebuffer> m_framebuffers;
-
-  struct FrameCommandBuffer
-  {
-    VkCommandBuffer commandBuffer;
-    VkFence fence;
-  };
-  std::vector<FrameCommandBuffer> m_commandBuffers;
-
-  Camera m_camera;
-  VkSampler m_texSampler;
-
-  glm::mat4 m_projection;
-
-  struct TessellationShaderParameters
-  {
-    glm::mat4 world;
-    glm::mat4 view;
-    glm::mat4 proj;
-    glm::vec4 lightPos;
-    glm::vec4 cameraPos;
-  };
-  ModelData m_quad;
-  ImageObject m_heightMap;
-  ImageObject m_normalMap;
-
-  std::vector<BufferObject> m_tessUniform;
-  std::vector<VkDescriptorSet> m_dsTessSample;
-  VkPipeline m_tessGroundPipeline;
-  VkPipeline m_tessGroundWired;
-
-  bool m_isWireframe;
+#pragma once
+#include "VulkanAppBase.h"
+#include <glm/glm.hpp>
+#include <array>
+#include "Camera.h"
+#include "VirtualTexture.h"
+
+class TessellateGroundApp : public VulkanAppBase
+{
+public:
+  TessellateGroundApp();
+
+  virtual void Prepare();
+  virtual void Cleanup();
+  virtual void Render();
+
+  virtual bool OnMouseButtonDown(int button);
+  virtual bool OnMouseButtonUp(int button);
+  virtual bool OnMouseMove(int dx, int dy);
+
+  virtual CameraPath CreateDefaultCameraPath();
+
+  struct ShaderParameters
+  {
+    glm::mat4 world;
+    glm::mat4 view;
+    glm::mat4 proj;
+    glm::vec4 lightPos;
+    glm::vec4 cameraPos;
+  };
+
+  struct TessellationShaderParameters
+  {
+    glm::mat4 world;
+    glm::mat4 view;
+    glm::mat4 proj;
+    glm::vec4 lightPos;
+    glm::vec4 cameraPos;
+    // 以下は仮想テクスチャを使う場合のみ参照する.
+    glm::vec4 terrainParams;  // x: 高さの倍率, y: 地形の一辺, z: 物理テクスチャの一辺, w: 描画する距離.
+    glm::vec4 virtualParams;  // x: タイルの一辺, y: 境界のテクセル数, z: スロットの一辺.
+  };
+
+  struct Vertex
+  {
+    glm::vec3 Position;
+    glm::vec2 UV;
+  };
+
+  // edge 四方を divide 分割したパッチ(4 頂点)の格子を作る.
+  static void CreateGroundGrid(float edge, int divide, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+private:
+  // 本アプリで使用するレイアウト(ディスクリプタレイアウト/パイプラインレイアウト)を作成.
+  void CreateSampleLayouts();
+
+  // 視錐台の内側のパッチのみを描画する.
+  void DrawVisiblePatches(VkCommandBuffer command);
+  void PrepareFramebuffers();
+  virtual void OnSwapchainRecreated();
+  virtual Camera* GetCamera() { return &m_camera; }
+  
+  void PrepareSceneResource();
+
+  // 法線マップの読み込みが完了した.
+  void OnNormalMapReady(const ImageObject& image);
+  // ハイトマップを 1 チャンネル 16 ビット(R16_UNORM)で読み込む.
+  // heightmap.ktx2, heightmap.r16 (16 ビットのリトルエンディアン、正方形), heightmap.png の順に探す.
+  ImageObject LoadHeightMap(MipmapGeneration mipmaps);
+  // 画素データからテクスチャを作成する. regions は pixels 内の各レベルの転送領域.
+  // mipmaps が Gpu の場合はレベル 0 のみを転送して残りを作成する.
+  ImageObject CreateTextureFromPixels(VkFormat format, uint32_t width, uint32_t height, uint32_t levelCount,
+    const void* pixels, uint32_t dataSize, const std::vector<VkBufferImageCopy>& regions, MipmapGeneration mipmaps);
+  // writePixels がマップしたステージングバッファ(dataSize バイト)へ画素を直接書き込む.
+  // 画素の変換を伴う場合に、変換結果を一時的なバッファへ置かずに済む.
+  ImageObject CreateTextureFromPixels(VkFormat format, uint32_t width, uint32_t height, uint32_t levelCount,
+    uint32_t dataSize, const std::vector<VkBufferImageCopy>& regions, MipmapGeneration mipmaps,
+    const std::function<void(void*)>& writePixels);
+
+  void PreparePrimitiveResource();
+
+  // heightmap.vtex があれば、仮想テクスチャのハイトマップで広い地形を描画する.
+  bool PrepareVirtualTexture();
+  // 視点から必要なページを求めて読み込みを要求し、読み込みの完了したタイルとページテーブルを転送する.
+  void UpdateVirtualTexture(VkCommandBuffer command, uint32_t imageIndex);
+  // テッセレーション評価シェーダーと同じ式で、視点からの距離で参照するミップレベルを求める.
+  float CalcVirtualTextureLod(float distance) const;
+
+  void RenderHUD(VkCommandBuffer command);
+private:
+  ImageObject m_depthBuffer;
+  std::vector<VkFramebuffer> m_framebuffers;
+
+  struct FrameCommandBuffer
+  {
+    VkCommandBuffer commandBuffer;
+    VkFence fence;
+  };
+  std::vector<FrameCommandBuffer> m_commandBuffers;
+
+  Camera m_camera;
+  VkSampler m_texSampler;
+
+  glm::mat4 m_projection;
+
+  ModelData m_quad;
+  ImageObject m_heightMap;
+  ImageObject m_normalMap;
+
+  // 読み込んだハイトマップの形式とメモリ量. 従来の RGBA8 の場合と並べて表示する.
+  std::string m_heightMapFormat;
+  uint32_t m_heightMapBitsPerTexel;
+  uint64_t m_heightMapBytes;
+  uint64_t m_heightMapRgba8Bytes;
+
+  std::vector<BufferObject> m_tessUniform;
+  std::vector<VkDescriptorSet> m_dsTessSample;
+  VkPipeline m_tessGroundPipeline;
+  VkPipeline m_tessGroundWired;
+
+  bool m_isWireframe;
+
+  // 仮想テクスチャ.
+  bool m_useVirtualTexture;
+  VirtualTextureCache m_vtCache;
+  ImageObject m_vtPhysical;     // タイルを格納するスロットを並べたテクスチャ.
+  ImageObject m_vtPageTable;    // ページごとのスロットの位置(レベルごとにミップレベルへ格納).
+  VkSampler m_vtPageSampler;
+  std::vector<BufferObject> m_vtStaging;
+  glm::vec3 m_vtLastCameraPos;
+  uint32_t m_vtUploadCount;
+  float m_terrainEdge;
+  int m_terrainDivide;
+  float m_terrainHeightScale;
+
+  // パッチ単位の視錐台カリング. 見えるパッチが連続する範囲ごとに描画する.
+  bool m_isCullingEnabled;
+  std::vector<book_util::Aabb> m_patchBounds;
+  std::vector<uint8_t> m_patchVisible;
+  uint32_t m_visiblePatchCount;
+  uint32_t m_patchDrawCount;
 };
\ No newline at end of file
@@ -1,13 +1,13 @@
-#version 450
-
-layout(location=0) in vec2 inUV;
-
-layout(location=0) out vec4 outColor;
-
-layout(set=0,binding=1)
-uniform sampler2D texImage;
-
-void main()
-{
-  outColor = texture(texImage, inUV);
-}
+#version 450
+
+layout(location=0) in vec2 inUV;
+
+layout(location=0) out vec4 outColor;
+
+layout(set=0,binding=1)
+uniform sampler2D texImage;
+
+void main()
+{
+  outColor = texture(texImage, inUV);
+}
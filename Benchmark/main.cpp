@@ -0,0 +1,941 @@
+#include "HelloGeometryShaderApp.h"
+#include "CubemapRenderingApp.h"
+#include "TessellateTeapotApp.h"
+#include "TessellateGroundApp.h"
+#include "ComputeFilterApp.h"
+#include "TeapotModel.h"
+#include "TeapotPatch.h"
+#include "BenchmarkRunner.h"
+#include "ImageDiff.h"
+#include "TextureCache.h"
+#include "KtxTexture.h"
+#include "MipmapGenerator.h"
+#include "BlockCompressor.h"
+#include "PixelConvert.h"
+#include "Camera.h"
+#include "MatrixMath.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantize.h"
+#include "MeshFile.h"
+#include "Meshlet.h"
+#include "MeshSimplifier.h"
+#include "stb_image.h"
+
+#include <glm/gtx/transform.hpp>
+#include <fstream>
+#include <future>
+#include <functional>
+#include <stdexcept>
+#include <cstring>
+#include <cfloat>
+#include <cstdio>
+#include <cstddef>
+
+// フレーム毎あるいは読み込み時にホスト側で実行される処理のベンチマーク.
+// 例: Benchmark --samples 30 --json result.json
+namespace
+{
+  BenchmarkRunner runner;
+
+  void RegisterCameraBenchmarks()
+  {
+    runner.Register("Camera/SetLookAt", [](uint64_t iterations)
+    {
+      Camera camera;
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        camera.SetLookAt(glm::vec3(0.0f, 2.0f, 10.0f + float(i & 0xF)), glm::vec3(0.0f));
+        BenchmarkRunner::DoNotOptimize(camera);
+      }
+    });
+
+    // マウスのボタンごとに回転/前後移動/平行移動の処理となる.
+    const char* dragNames[] = { "Camera/OnMouseMove.Rotate", "Camera/OnMouseMove.Dolly", "Camera/OnMouseMove.Pan" };
+    for (int button = 0; button < 3; ++button)
+    {
+      runner.Register(dragNames[button], [button](uint64_t iterations)
+      {
+        Camera camera;
+        camera.SetLookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f));
+        camera.OnMouseButtonDown(button);
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          // 行ったり来たりさせて行列が発散しないようにする.
+          int d = (i & 1) ? 1 : -1;
+          camera.OnMouseMove(d, -d);
+          camera.Update(Camera::FixedTimeStep);
+          BenchmarkRunner::DoNotOptimize(camera);
+        }
+      });
+    }
+    // 高いポーリングレートのマウスでは 1 フレームに複数の移動が届く. 行列の更新は Update の 1 回のみとなる.
+    runner.Register("Camera/OnMouseMove.Rotate.8perFrame", [](uint64_t iterations)
+    {
+      Camera camera;
+      camera.SetLookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f));
+      camera.OnMouseButtonDown(0);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        int d = (i & 1) ? 1 : -1;
+        for (int j = 0; j < 8; ++j)
+        {
+          camera.OnMouseMove(d, -d);
+        }
+        camera.Update(Camera::FixedTimeStep);
+        BenchmarkRunner::DoNotOptimize(camera);
+      }
+    });
+
+    runner.Register("Camera/GetViewMatrix+GetPosition", [](uint64_t iterations)
+    {
+      Camera camera;
+      camera.SetLookAt(glm::vec3(48.5f, 25.0f, 65.0f), glm::vec3(0.0f));
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto view = camera.GetViewMatrix();
+        auto pos = camera.GetPosition();
+        BenchmarkRunner::DoNotOptimize(view);
+        BenchmarkRunner::DoNotOptimize(pos);
+      }
+    });
+  }
+
+  // 視錐台カリング. 07_TessellateGround の仮想テクスチャ使用時と同じ 256x256 のパッチを対象とする.
+  void RegisterCullingBenchmarks()
+  {
+    const uint32_t divide = 256;
+    const float edge = 1600.0f;
+    auto createScene = [=](std::vector<book_util::Aabb>& boxes, std::vector<glm::vec4>& spheres)
+    {
+      for (uint32_t z = 0; z < divide; ++z)
+      {
+        for (uint32_t x = 0; x < divide; ++x)
+        {
+          auto p0 = glm::vec3(edge * x / divide - edge * 0.5f, 0.0f, edge * z / divide - edge * 0.5f);
+          auto p1 = glm::vec3(p0.x + edge / divide, 25.0f, p0.z + edge / divide);
+          boxes.push_back(book_util::Aabb{ p0, p1 });
+          spheres.push_back(glm::vec4((p0 + p1) * 0.5f, glm::length(p1 - p0) * 0.5f));
+        }
+      }
+    };
+    auto createFrustum = []()
+    {
+      Camera camera;
+      camera.SetLookAt(glm::vec3(48.5f, 25.0f, 65.0f), glm::vec3(0.0f));
+      return camera.GetFrustum(glm::perspectiveRH(glm::radians(45.0f), 1280.0f / 720.0f, 0.1f, 800.0f));
+    };
+
+    runner.Register("Culling/GetFrustum", [](uint64_t iterations)
+    {
+      Camera camera;
+      camera.SetLookAt(glm::vec3(48.5f, 25.0f, 65.0f), glm::vec3(0.0f));
+      auto proj = glm::perspectiveRH(glm::radians(45.0f), 1280.0f / 720.0f, 0.1f, 800.0f);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto frustum = camera.GetFrustum(proj);
+        BenchmarkRunner::DoNotOptimize(frustum);
+      }
+    });
+    // 1 個ずつ判定した場合と比べる.
+    runner.Register("Culling/IsVisible.scalar.65536", [=](uint64_t iterations)
+    {
+      std::vector<book_util::Aabb> boxes;
+      std::vector<glm::vec4> spheres;
+      createScene(boxes, spheres);
+      auto frustum = createFrustum();
+      std::vector<uint8_t> visible(boxes.size());
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        for (size_t j = 0; j < boxes.size(); ++j)
+        {
+          visible[j] = frustum.IsVisible(boxes[j]) ? 1 : 0;
+        }
+        BenchmarkRunner::DoNotOptimize(visible.data());
+      }
+    });
+    const std::string isa = book_util::GetFrustumInstructionSet();
+    runner.Register("Culling/CullAabbs." + isa + ".65536", [=](uint64_t iterations)
+    {
+      std::vector<book_util::Aabb> boxes;
+      std::vector<glm::vec4> spheres;
+      createScene(boxes, spheres);
+      auto frustum = createFrustum();
+      std::vector<uint8_t> visible(boxes.size());
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto count = frustum.CullAabbs(boxes.data(), uint32_t(boxes.size()), visible.data());
+        BenchmarkRunner::DoNotOptimize(count);
+      }
+    });
+    runner.Register("Culling/CullSpheres." + isa + ".65536", [=](uint64_t iterations)
+    {
+      std::vector<book_util::Aabb> boxes;
+      std::vector<glm::vec4> spheres;
+      createScene(boxes, spheres);
+      auto frustum = createFrustum();
+      std::vector<uint8_t> visible(spheres.size());
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto count = frustum.CullSpheres(spheres.data(), uint32_t(spheres.size()), visible.data());
+        BenchmarkRunner::DoNotOptimize(count);
+      }
+    });
+  }
+
+  void RegisterMatrixMathBenchmarks()
+  {
+    auto proj = glm::perspectiveFovRH(glm::radians(45.0f), 512.0f, 512.0f, 0.1f, 100.0f);
+    const glm::vec3 eye(0.0f);
+    const glm::vec3 dir[] = {
+      glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+      glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+      glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+    };
+    const glm::vec3 up[] = {
+      glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+      glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+      glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+    };
+    // キューブマップ 6 面分のビュー、プロジェクション行列.
+    runner.Register("MatrixMath/CubeFaceViews.glm", [=](uint64_t iterations)
+    {
+      book_util::ViewProjection views[6];
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        for (int face = 0; face < 6; ++face)
+        {
+          views[face].view = glm::lookAt(eye, dir[face], up[face]);
+          views[face].proj = proj;
+          views[face].viewProj = proj * views[face].view;
+        }
+        BenchmarkRunner::DoNotOptimize(views);
+      }
+    });
+    const std::string isa = book_util::GetMatrixMathInstructionSet();
+    runner.Register("MatrixMath/CubeFaceViews." + isa, [=](uint64_t iterations)
+    {
+      book_util::ViewProjection views[6];
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        book_util::ComputeLookAtViews(eye, dir, up, 6, proj, views);
+        BenchmarkRunner::DoNotOptimize(views);
+      }
+    });
+
+    auto world = glm::translate(glm::vec3(1.0f, 2.0f, 3.0f)) * glm::rotate(0.5f, glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f)));
+    runner.Register("MatrixMath/Inverse.glm", [=](uint64_t iterations)
+    {
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto m = glm::inverse(world);
+        BenchmarkRunner::DoNotOptimize(m);
+      }
+    });
+    runner.Register("MatrixMath/InverseRigid." + isa, [=](uint64_t iterations)
+    {
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto m = book_util::InverseRigid(world);
+        BenchmarkRunner::DoNotOptimize(m);
+      }
+    });
+  }
+
+  // ユニフォームバッファへの書き込みは、各サンプルの Render と同じくカメラから値を詰めて
+  // ホストのメモリへコピーするまでを計測する.
+  template<class T, class Func>
+  void RegisterUniformPacking(const std::string& name, Func fill)
+  {
+    runner.Register("UBO/" + name, [fill](uint64_t iterations)
+    {
+      Camera camera;
+      camera.SetLookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f));
+      auto proj = glm::perspectiveRH(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 1000.0f);
+
+      // マップしたメモリの代わりに 256 バイト境界のバッファへ書き込む.
+      const size_t stride = (sizeof(T) + 255) & ~size_t(255);
+      std::vector<uint8_t> mapped(stride * 3);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        T params;
+        fill(params, camera, proj);
+        memcpy(mapped.data() + stride * (i % 3), &params, sizeof(params));
+        BenchmarkRunner::DoNotOptimize(mapped[0]);
+      }
+    });
+  }
+
+  void RegisterUniformBenchmarks()
+  {
+    RegisterUniformPacking<HelloGeometryShaderApp::ShaderParameters>("HelloGeometryShader.ShaderParameters",
+      [](HelloGeometryShaderApp::ShaderParameters& p, const Camera& camera, const glm::mat4& proj)
+    {
+      p.world = glm::mat4(1.0f);
+      p.view = camera.GetViewMatrix();
+      p.proj = proj;
+      p.lightDir = glm::vec4(0.0f, 1.0f, 1.0f, 0.0f);
+    });
+    RegisterUniformPacking<CubemapRenderingApp::ShaderParameters>("CubemapRendering.ShaderParameters",
+      [](CubemapRenderingApp::ShaderParameters& p, const Camera& camera, const glm::mat4& proj)
+    {
+      p.world = glm::mat4(1.0f);
+      p.view = camera.GetViewMatrix();
+      p.proj = proj;
+      p.lightDir = glm::vec4(0.0f, 10.0f, 10.0f, 0.0f);
+      p.cameraPos = glm::vec4(camera.GetPosition(), 1.0f);
+    });
+    RegisterUniformPacking<CubemapRenderingApp::TeapotInstanceParameters>("CubemapRendering.TeapotInstanceParameters",
+      [](CubemapRenderingApp::TeapotInstanceParameters& p, const Camera&, const glm::mat4&)
+    {
+      for (int i = 0; i < 6; ++i)
+      {
+        p.world[i] = glm::translate(glm::vec3(float(i) * 2.0f - 5.0f, 0.0f, 0.0f));
+        p.colors[i] = glm::vec4(1.0f);
+      }
+    });
+    RegisterUniformPacking<TessellateTeapotApp::TessellationShaderParameters>("TessellateTeapot.TessellationShaderParameters",
+      [](TessellateTeapotApp::TessellationShaderParameters& p, const Camera& camera, const glm::mat4& proj)
+    {
+      p.world = glm::mat4(1.0f);
+      p.view = camera.GetViewMatrix();
+      p.proj = proj;
+      p.lightPos = glm::vec4(0.0f);
+      p.cameraPos = glm::vec4(camera.GetPosition(), 0.0f);
+      p.tessOuterLevel = 1.0f;
+      p.tessInnerLevel = 1.0f;
+    });
+    RegisterUniformPacking<TessellateGroundApp::TessellationShaderParameters>("TessellateGround.TessellationShaderParameters",
+      [](TessellateGroundApp::TessellationShaderParameters& p, const Camera& camera, const glm::mat4& proj)
+    {
+      p.world = glm::mat4(1.0f);
+      p.view = camera.GetViewMatrix();
+      p.proj = proj;
+      p.lightPos = glm::vec4(0.0f);
+      p.cameraPos = glm::vec4(camera.GetPosition(), 0.0f);
+    });
+    RegisterUniformPacking<ComputeFilterApp::ShaderParameters>("ComputeFilter.ShaderParameters",
+      [](ComputeFilterApp::ShaderParameters& p, const Camera&, const glm::mat4&)
+    {
+      p.proj = glm::ortho(-640.0f, 640.0f, -360.0f, 360.0f, -100.0f, 100.0f);
+    });
+  }
+
+  void RegisterObjectStoreBenchmarks()
+  {
+    // 各サンプルで登録している名前.
+    static const char* names[] = {
+      "default", "u1", "u2", "u1t1", "u1t2", "cubemap", "compute_filter",
+    };
+    auto createStore = []()
+    {
+      std::unique_ptr<VulkanObjectStore<VkPipelineLayout>> store(
+        new VulkanObjectStore<VkPipelineLayout>([](VkPipelineLayout) {}));
+      uint64_t handle = 1;
+      for (auto name : names)
+      {
+        store->Register(name, reinterpret_cast<VkPipelineLayout>(handle++));
+      }
+      return store;
+    };
+
+    runner.Register("ObjectStore/Get.Hit", [createStore](uint64_t iterations)
+    {
+      auto store = createStore();
+      const auto count = sizeof(names) / sizeof(names[0]);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto layout = store->Get(names[i % count]);
+        BenchmarkRunner::DoNotOptimize(layout);
+      }
+    });
+    runner.Register("ObjectStore/Get.Miss", [createStore](uint64_t iterations)
+    {
+      auto store = createStore();
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto layout = store->Get("not_registered");
+        BenchmarkRunner::DoNotOptimize(layout);
+      }
+    });
+  }
+
+  std::vector<uint8_t> ReadFile(const std::string& fileName)
+  {
+    std::ifstream infile(fileName, std::ios::binary);
+    if (!infile)
+    {
+      throw std::runtime_error("cannot open " + fileName);
+    }
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+  }
+
+  void RegisterImageBenchmarks()
+  {
+    static const char* files[] = {
+      "04_CubemapRendering/posx.jpg",
+      "07_TessellateGround/heightmap.png",
+      "07_TessellateGround/normalmap.png",
+      "09_ComputeFilter/image.png",
+    };
+    for (auto file : files)
+    {
+      std::string name = file;
+      // ファイル読み込みを含む、サンプルと同じ呼び出し.
+      runner.Register("Image/stbi_load." + name, [name](uint64_t iterations)
+      {
+        auto path = runner.GetDataPath(name);
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          int width, height;
+          auto pImage = stbi_load(path.c_str(), &width, &height, nullptr, 4);
+          if (pImage == nullptr)
+          {
+            throw std::runtime_error("stbi_load failed: " + path);
+          }
+          BenchmarkRunner::DoNotOptimize(pImage[0]);
+          stbi_image_free(pImage);
+        }
+      });
+      // デコード処理のみ.
+      runner.Register("Image/stbi_load_from_memory." + name, [name](uint64_t iterations)
+      {
+        auto data = ReadFile(runner.GetDataPath(name));
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          int width, height;
+          auto pImage = stbi_load_from_memory(data.data(), int(data.size()), &width, &height, nullptr, 4);
+          if (pImage == nullptr)
+          {
+            throw std::runtime_error("stbi_load_from_memory failed: " + name);
+          }
+          BenchmarkRunner::DoNotOptimize(pImage[0]);
+          stbi_image_free(pImage);
+        }
+      });
+      // キャッシュから読み込んでステージングバッファ相当のメモリへコピーするまで.
+      runner.Register("Image/TextureCache.Hit." + name, [name](uint64_t iterations)
+      {
+        auto path = runner.GetDataPath(name);
+        TextureCache cache;
+        TextureCache::Image image;
+        if (!cache.Load(path, 4, image))
+        {
+          throw std::runtime_error("TextureCache::Load failed: " + path);
+        }
+        std::vector<uint8_t> staging(size_t(image.GetDataSize()));
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          cache.Load(path, 4, image);
+          memcpy(staging.data(), image.GetPixels(), staging.size());
+          BenchmarkRunner::DoNotOptimize(staging[0]);
+        }
+      });
+      // 変換済みの KTX2 ファイルを開いてステージングバッファ相当のメモリへコピーするまで.
+      runner.Register("Image/KtxTexture.Open." + name, [name](uint64_t iterations)
+      {
+        auto path = runner.GetDataPath(name);
+        TextureCache decoder;
+        decoder.SetDirectory(std::string());
+        TextureCache::Image image;
+        if (!decoder.Load(path, 4, image))
+        {
+          throw std::runtime_error("TextureCache::Load failed: " + path);
+        }
+        KtxTexture::Desc desc = { VK_FORMAT_R8G8B8A8_UNORM, image.GetWidth(), image.GetHeight(), 0, 1 };
+        std::vector<KtxTexture::LevelData> levels = { { image.GetPixels(), image.GetDataSize() } };
+        const std::string ktxFile = "benchmark_texture.ktx2";
+        if (!KtxTexture::Write(ktxFile, desc, levels))
+        {
+          throw std::runtime_error("KtxTexture::Write failed: " + ktxFile);
+        }
+        std::vector<uint8_t> staging(size_t(image.GetDataSize()));
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          KtxTexture ktx;
+          ktx.Open(ktxFile);
+          memcpy(staging.data(), ktx.GetDataRange(), size_t(ktx.GetLevelSize(0)));
+          BenchmarkRunner::DoNotOptimize(staging[0]);
+        }
+        std::remove(ktxFile.c_str());
+      });
+    }
+  }
+
+  // VulkanAppBase::LoadCubeTextureFromFile のデコード部分. 6 面を逐次/並列に処理した場合を比べる.
+  void RegisterCubemapBenchmarks()
+  {
+    static const char* faces[] = { "posx.jpg", "negx.jpg", "posy.jpg", "negy.jpg", "posz.jpg", "negz.jpg" };
+    auto decodeFace = [](const std::string& path, std::vector<uint8_t>& dst)
+    {
+      int width, height;
+      auto pImage = stbi_load(path.c_str(), &width, &height, nullptr, 4);
+      if (pImage == nullptr)
+      {
+        throw std::runtime_error("stbi_load failed: " + path);
+      }
+      dst.assign(pImage, pImage + width * height * 4);
+      stbi_image_free(pImage);
+    };
+    runner.Register("Image/CubemapDecode.Sequential", [decodeFace](uint64_t iterations)
+    {
+      std::vector<uint8_t> pixels[6];
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        for (int face = 0; face < 6; ++face)
+        {
+          decodeFace(runner.GetDataPath(std::string("04_CubemapRendering/") + faces[face]), pixels[face]);
+        }
+        BenchmarkRunner::DoNotOptimize(pixels[5].data());
+      }
+    });
+    runner.Register("Image/CubemapDecode.Parallel", [decodeFace](uint64_t iterations)
+    {
+      std::vector<uint8_t> pixels[6];
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        std::future<void> decodes[6];
+        for (int face = 0; face < 6; ++face)
+        {
+          auto path = runner.GetDataPath(std::string("04_CubemapRendering/") + faces[face]);
+          auto dst = &pixels[face];
+          decodes[face] = std::async(std::launch::async, [=]() { decodeFace(path, *dst); });
+        }
+        for (auto& f : decodes)
+        {
+          f.get();
+        }
+        BenchmarkRunner::DoNotOptimize(pixels[5].data());
+      }
+    });
+  }
+
+  // CPU でのミップマップ作成. 1 スレッドと全スレッドで比べる.
+  // GPU での作成は SampleRunner --mipmaps gpu|box|kaiser の textureLoadMs で比べる.
+  void RegisterMipmapBenchmarks()
+  {
+    static const char* files[] = {
+      "07_TessellateGround/heightmap.png",
+      "09_ComputeFilter/image.png",
+    };
+    struct FilterInfo
+    {
+      const char* name;
+      book_util::MipmapFilter filter;
+    };
+    static const FilterInfo filters[] = {
+      { "Box", book_util::MipmapFilter::Box },
+      { "Kaiser", book_util::MipmapFilter::Kaiser },
+    };
+    const std::string isa = book_util::GetMipmapInstructionSet();
+    for (auto file : files)
+    {
+      std::string name = file;
+      for (const auto& info : filters)
+      {
+        for (uint32_t threadCount : { 1u, 0u })
+        {
+          auto filter = info.filter;
+          auto suffix = std::string(info.name) + "." + isa + (threadCount == 1 ? ".1thread." : ".threads.") + name;
+          runner.Register("Mipmap/GenerateMipmaps." + suffix, [name, filter, threadCount](uint64_t iterations)
+          {
+            auto path = runner.GetDataPath(name);
+            int width, height;
+            auto pImage = stbi_load(path.c_str(), &width, &height, nullptr, 4);
+            if (pImage == nullptr)
+            {
+              throw std::runtime_error("stbi_load failed: " + path);
+            }
+            std::vector<uint8_t> pixels;
+            for (uint64_t i = 0; i < iterations; ++i)
+            {
+              auto levels = book_util::GenerateMipmaps(pImage, width, height, 4, filter, pixels, threadCount);
+              BenchmarkRunner::DoNotOptimize(levels.size());
+              BenchmarkRunner::DoNotOptimize(pixels.data());
+            }
+            stbi_image_free(pImage);
+          });
+        }
+      }
+    }
+  }
+
+  // 読み込み時の画素形式の変換. 1920x1080 の画像について 1 スレッドと全スレッドで比べる.
+  void RegisterPixelConvertBenchmarks()
+  {
+    const uint32_t width = 1920, height = 1080;
+    auto createImage = [](uint32_t components)
+    {
+      std::vector<uint8_t> pixels(size_t(width) * height * components);
+      uint32_t seed = 1;
+      for (auto& v : pixels)
+      {
+        seed = seed * 1664525u + 1013904223u;
+        v = uint8_t(seed >> 24);
+      }
+      return pixels;
+    };
+    struct Kernel
+    {
+      const char* name;
+      uint32_t srcComponents;
+      std::function<void(const std::vector<uint8_t>&, std::vector<uint8_t>&, uint32_t)> run;
+    };
+    const std::vector<Kernel> kernels = {
+      { "RGBToRGBA", 3, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::ConvertChannels(src.data(), 3, dst.data(), 4, width, height, threads); } },
+      { "GrayToRGBA", 1, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::ConvertChannels(src.data(), 1, dst.data(), 4, width, height, threads); } },
+      { "SwapRedBlue", 4, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::SwapRedBlue(src.data(), dst.data(), width, height, threads); } },
+      { "Expand8To16", 4, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::Expand8To16(src.data(), reinterpret_cast<uint16_t*>(dst.data()), 4, width, height, threads); } },
+      { "ExtractChannel", 4, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::ExtractChannel(src.data(), 4, 0, dst.data(), width, height, threads); } },
+      { "SrgbToLinear", 4, [=](const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, uint32_t threads)
+        { book_util::ConvertSrgbToLinear(src.data(), reinterpret_cast<uint16_t*>(dst.data()), 4, width, height, threads); } },
+    };
+    const std::string isa = book_util::GetPixelConvertInstructionSet();
+    for (const auto& kernel : kernels)
+    {
+      for (uint32_t threadCount : { 1u, 0u })
+      {
+        auto suffix = std::string(kernel.name) + "." + isa + (threadCount == 1 ? ".1thread" : ".threads");
+        auto run = kernel.run;
+        auto srcComponents = kernel.srcComponents;
+        runner.Register("PixelConvert/" + suffix, [createImage, run, srcComponents, threadCount](uint64_t iterations)
+        {
+          auto src = createImage(srcComponents);
+          // 出力は最大で 4 チャンネル 16bit.
+          std::vector<uint8_t> dst(size_t(width) * height * 8);
+          for (uint64_t i = 0; i < iterations; ++i)
+          {
+            run(src, dst, threadCount);
+            BenchmarkRunner::DoNotOptimize(dst.data());
+          }
+        });
+      }
+    }
+  }
+
+  // TextureCooker でのブロック圧縮. 1 スレッドと全スレッドで比べる.
+  void RegisterBlockCompressionBenchmarks()
+  {
+    struct Target
+    {
+      const char* name;
+      const char* file;
+      book_util::BlockFormat format;
+    };
+    static const Target targets[] = {
+      { "BC1", "04_CubemapRendering/posx.jpg", book_util::BlockFormat::BC1 },
+      { "BC4", "07_TessellateGround/heightmap.png", book_util::BlockFormat::BC4 },
+      { "BC5", "07_TessellateGround/normalmap.png", book_util::BlockFormat::BC5 },
+      { "BC7", "04_CubemapRendering/posx.jpg", book_util::BlockFormat::BC7 },
+    };
+    const std::string isa = book_util::GetBlockCompressorInstructionSet();
+    for (const auto& target : targets)
+    {
+      for (uint32_t threadCount : { 1u, 0u })
+      {
+        std::string name = target.file;
+        auto format = target.format;
+        auto suffix = std::string(target.name) + "." + isa + (threadCount == 1 ? ".1thread." : ".threads.") + name;
+        runner.Register("BlockCompress/CompressImage." + suffix, [name, format, threadCount](uint64_t iterations)
+        {
+          auto path = runner.GetDataPath(name);
+          int width, height;
+          auto pImage = stbi_load(path.c_str(), &width, &height, nullptr, 4);
+          if (pImage == nullptr)
+          {
+            throw std::runtime_error("stbi_load failed: " + path);
+          }
+          std::vector<uint8_t> compressed(book_util::GetCompressedSize(format, width, height));
+          for (uint64_t i = 0; i < iterations; ++i)
+          {
+            book_util::CompressImage(pImage, width, height, format, compressed.data(), threadCount);
+            BenchmarkRunner::DoNotOptimize(compressed.data());
+          }
+          stbi_image_free(pImage);
+        });
+      }
+    }
+  }
+
+  void RegisterImageDiffBenchmarks()
+  {
+    // 09_ComputeFilter と同じ 1280x720 のキャプチャ同士の比較を想定する.
+    auto createImages = [](std::vector<uint8_t>& a, std::vector<uint8_t>& b)
+    {
+      const uint32_t width = 1280, height = 720;
+      a.resize(width * height * 4);
+      b.resize(width * height * 4);
+      uint32_t seed = 1;
+      for (size_t i = 0; i < a.size(); ++i)
+      {
+        seed = seed * 1664525u + 1013904223u;
+        a[i] = uint8_t(seed >> 24);
+        // 一部のピクセルだけ僅かに異なる画像とする.
+        b[i] = ((seed >> 8) & 0xF) == 0 ? uint8_t(a[i] ^ 1) : a[i];
+      }
+    };
+    runner.Register(std::string("ImageDiff/CompareImages.1280x720.") + book_util::GetImageDiffInstructionSet(),
+      [createImages](uint64_t iterations)
+    {
+      std::vector<uint8_t> a, b;
+      createImages(a, b);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto result = book_util::CompareImages(a.data(), b.data(), 1280, 720);
+        BenchmarkRunner::DoNotOptimize(result);
+      }
+    });
+    runner.Register("ImageDiff/CompareImages.1280x720.Heatmap", [createImages](uint64_t iterations)
+    {
+      std::vector<uint8_t> a, b, heatmap;
+      createImages(a, b);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto result = book_util::CompareImages(a.data(), b.data(), 1280, 720, 0, 0, &heatmap);
+        BenchmarkRunner::DoNotOptimize(result);
+        BenchmarkRunner::DoNotOptimize(heatmap.data());
+      }
+    });
+  }
+
+  void RegisterModelBenchmarks()
+  {
+    // TessellateGroundApp::PreparePrimitiveResource と同じ分割数と、より細かい分割.
+    const int divides[] = { 10, 64, 256 };
+    for (auto divide : divides)
+    {
+      runner.Register("Terrain/CreateGroundGrid." + std::to_string(divide), [divide](uint64_t iterations)
+      {
+        std::vector<TessellateGroundApp::Vertex> vertices;
+        std::vector<uint32_t> indices;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+          TessellateGroundApp::CreateGroundGrid(200.0f, divide, vertices, indices);
+          BenchmarkRunner::DoNotOptimize(vertices.data());
+          BenchmarkRunner::DoNotOptimize(indices.data());
+        }
+      });
+    }
+
+    runner.Register("Teapot/ModelVectors", [](uint64_t iterations)
+    {
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        std::vector<TeapotModel::Vertex> vertices(std::begin(TeapotModel::TeapotVerticesPN), std::end(TeapotModel::TeapotVerticesPN));
+        std::vector<uint32_t> indices(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+        BenchmarkRunner::DoNotOptimize(vertices.data());
+        BenchmarkRunner::DoNotOptimize(indices.data());
+      }
+    });
+    runner.Register("Teapot/PatchVectors", [](uint64_t iterations)
+    {
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto points = TeapotPatch::GetTeapotPatchPoints();
+        auto indices = TeapotPatch::GetTeapotPatchIndices();
+        BenchmarkRunner::DoNotOptimize(points.data());
+        BenchmarkRunner::DoNotOptimize(indices.data());
+      }
+    });
+
+    // CreateSimpleModel で行う並べ替えの費用と、頂点キャッシュの模擬の費用.
+    runner.Register("Teapot/OptimizeMesh", [](uint64_t iterations)
+    {
+      const std::vector<TeapotModel::Vertex> srcVertices(std::begin(TeapotModel::TeapotVerticesPN), std::end(TeapotModel::TeapotVerticesPN));
+      const std::vector<uint32_t> srcIndices(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto vertices = srcVertices;
+        auto indices = srcIndices;
+        auto result = book_util::OptimizeMesh(vertices, indices);
+        BenchmarkRunner::DoNotOptimize(&result);
+        BenchmarkRunner::DoNotOptimize(indices.data());
+      }
+    });
+    runner.Register("Teapot/AnalyzeVertexCache", [](uint64_t iterations)
+    {
+      const std::vector<uint32_t> indices(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+      const auto vertexCount = uint32_t(std::end(TeapotModel::TeapotVerticesPN) - std::begin(TeapotModel::TeapotVerticesPN));
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto stats = book_util::AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+        BenchmarkRunner::DoNotOptimize(&stats);
+      }
+    });
+    // CreateCompactModel で行う頂点の圧縮(位置の 16bit 化と法線の八面体エンコード).
+    runner.Register("Teapot/QuantizeVertices", [](uint64_t iterations)
+    {
+      const std::vector<TeapotModel::Vertex> vertices(std::begin(TeapotModel::TeapotVerticesPN), std::end(TeapotModel::TeapotVerticesPN));
+      const auto count = uint32_t(vertices.size());
+      const auto stride = uint32_t(sizeof(TeapotModel::Vertex));
+      std::vector<book_util::CompactVertex> compact(count);
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto quantization = book_util::ComputePositionQuantization(book_util::ComputeAabb(vertices.data(), count, stride));
+        book_util::QuantizeVertices(compact.data(), vertices.data(), count, stride,
+          uint32_t(offsetof(TeapotModel::Vertex, Normal)), quantization);
+        BenchmarkRunner::DoNotOptimize(compact.data());
+      }
+    });
+    // 調理済みのメッシュファイルを開いてステージングバッファ相当のメモリへコピーするまで.
+    // 上の OptimizeMesh と QuantizeVertices を実行時に行う場合と比べる.
+    runner.Register("Teapot/MeshFile.Open", [](uint64_t iterations)
+    {
+      std::vector<TeapotModel::Vertex> vertices(std::begin(TeapotModel::TeapotVerticesPN), std::end(TeapotModel::TeapotVerticesPN));
+      std::vector<uint32_t> indices(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+      book_util::OptimizeMesh(vertices, indices);
+      const auto count = uint32_t(vertices.size());
+      MeshFile::Desc desc{};
+      desc.vertexCount = count;
+      desc.indexCount = uint32_t(indices.size());
+      desc.bounds = book_util::ComputeAabb(vertices.data(), count, uint32_t(sizeof(TeapotModel::Vertex)));
+      desc.isCompact = desc.isOptimized = true;
+      desc.quantization = book_util::ComputePositionQuantization(desc.bounds);
+      std::vector<book_util::CompactVertex> compact(count);
+      book_util::QuantizeVertices(compact.data(), vertices.data(), count, uint32_t(sizeof(TeapotModel::Vertex)),
+        uint32_t(offsetof(TeapotModel::Vertex, Normal)), desc.quantization);
+      std::vector<uint16_t> indices16(indices.size());
+      book_util::PackIndices16(indices16.data(), indices.data(), indices.size());
+      desc.vertexStride = uint32_t(sizeof(book_util::CompactVertex));
+      desc.vertices = compact.data();
+      desc.indexType = VK_INDEX_TYPE_UINT16;
+      desc.indices = indices16.data();
+      const std::string meshFile = "benchmark_teapot.mesh";
+      if (!MeshFile::Write(meshFile, desc))
+      {
+        throw std::runtime_error("MeshFile::Write failed: " + meshFile);
+      }
+      std::vector<uint8_t> staging(compact.size() * sizeof(book_util::CompactVertex) + indices16.size() * sizeof(uint16_t));
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        MeshFile mesh;
+        mesh.Open(meshFile);
+        const auto vertexBytes = size_t(mesh.GetVertexCount()) * mesh.GetVertexStride();
+        memcpy(staging.data(), mesh.GetVertexData(), vertexBytes);
+        memcpy(staging.data() + vertexBytes, mesh.GetIndexData(), size_t(mesh.GetIndexCount()) * sizeof(uint16_t));
+        BenchmarkRunner::DoNotOptimize(staging[0]);
+      }
+      std::remove(meshFile.c_str());
+    });
+
+    // CreateCompactModel で行うメッシュレットの作成(並べ替え後のインデックスから).
+    auto createOptimizedTeapot = [](std::vector<TeapotModel::Vertex>& vertices, std::vector<uint32_t>& indices)
+    {
+      vertices.assign(std::begin(TeapotModel::TeapotVerticesPN), std::end(TeapotModel::TeapotVerticesPN));
+      indices.assign(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+      book_util::OptimizeMesh(vertices, indices);
+    };
+    runner.Register("Teapot/BuildMeshlets", [createOptimizedTeapot](uint64_t iterations)
+    {
+      std::vector<TeapotModel::Vertex> vertices;
+      std::vector<uint32_t> indices;
+      createOptimizedTeapot(vertices, indices);
+      book_util::MeshletMesh meshlets;
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        book_util::BuildMeshlets(meshlets, indices.data(), indices.size(),
+          vertices.data(), uint32_t(vertices.size()), uint32_t(sizeof(TeapotModel::Vertex)));
+        BenchmarkRunner::DoNotOptimize(meshlets.meshlets.data());
+      }
+    });
+    // 04_CubemapRendering の周辺ティーポット 6 個を、メインとキューブマップ 6 面の計 7 ビューで判定する.
+    // 各ビューで送る三角形の数は SampleRunner の --summary(clusterCullingTriangles)で得られる.
+    runner.Register("Culling/Meshlets.Teapot.7views", [createOptimizedTeapot](uint64_t iterations)
+    {
+      std::vector<TeapotModel::Vertex> vertices;
+      std::vector<uint32_t> indices;
+      createOptimizedTeapot(vertices, indices);
+      book_util::MeshletMesh meshlets;
+      book_util::BuildMeshlets(meshlets, indices.data(), indices.size(),
+        vertices.data(), uint32_t(vertices.size()), uint32_t(sizeof(TeapotModel::Vertex)));
+
+      const glm::vec3 offsets[] = {
+        glm::vec3(5.0f, 0.0f, 0.0f), glm::vec3(-5.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, -5.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f, 0.0f, -5.0f),
+      };
+      const glm::vec3 up[] = {
+        glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+        glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+      };
+      Camera camera;
+      camera.SetLookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f));
+      book_util::Frustum frustums[7];
+      glm::vec3 eyes[7];
+      frustums[0] = camera.GetFrustum(glm::perspectiveRH(glm::radians(45.0f), 1280.0f / 720.0f, 0.1f, 1000.0f));
+      eyes[0] = camera.GetPosition();
+      auto faceProj = glm::perspectiveRH(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+      for (int face = 0; face < 6; ++face)
+      {
+        frustums[1 + face] = book_util::Frustum(faceProj * glm::lookAt(glm::vec3(0.0f), offsets[face], up[face]));
+        eyes[1 + face] = glm::vec3(0.0f);
+      }
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        uint32_t triangles = 0;
+        for (int view = 0; view < 7; ++view)
+        {
+          for (const auto& offset : offsets)
+          {
+            triangles += book_util::CullMeshlets(meshlets.meshlets.data(), uint32_t(meshlets.meshlets.size()),
+              glm::translate(offset), frustums[view], eyes[view], true);
+          }
+        }
+        BenchmarkRunner::DoNotOptimize(triangles);
+      }
+    });
+
+    // CreateCompactModel、MeshCooker で行う詳細度の作成. 1 段(半分)のみと、全段(LOD 0～3)の場合.
+    runner.Register("Teapot/SimplifyMesh.Half", [createOptimizedTeapot](uint64_t iterations)
+    {
+      std::vector<TeapotModel::Vertex> vertices;
+      std::vector<uint32_t> indices;
+      createOptimizedTeapot(vertices, indices);
+      std::vector<uint32_t> simplified(indices.size());
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        auto count = book_util::SimplifyMesh(simplified.data(), indices.data(), indices.size(),
+          vertices.data(), uint32_t(vertices.size()), uint32_t(sizeof(TeapotModel::Vertex)),
+          uint32_t(offsetof(TeapotModel::Vertex, Normal)), indices.size() / 6 * 3, FLT_MAX);
+        BenchmarkRunner::DoNotOptimize(count);
+      }
+    });
+    runner.Register("Teapot/BuildLodChain", [createOptimizedTeapot](uint64_t iterations)
+    {
+      std::vector<TeapotModel::Vertex> vertices;
+      std::vector<uint32_t> indices;
+      createOptimizedTeapot(vertices, indices);
+      std::vector<book_util::MeshLod> lods;
+      std::vector<uint32_t> lodIndices;
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        book_util::BuildLodChain(lods, lodIndices, indices.data(), indices.size(),
+          vertices.data(), uint32_t(vertices.size()), uint32_t(sizeof(TeapotModel::Vertex)),
+          uint32_t(offsetof(TeapotModel::Vertex, Normal)));
+        BenchmarkRunner::DoNotOptimize(lodIndices.data());
+      }
+    });
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  RegisterCameraBenchmarks();
+  RegisterCullingBenchmarks();
+  RegisterMatrixMathBenchmarks();
+  RegisterUniformBenchmarks();
+  RegisterObjectStoreBenchmarks();
+  RegisterImageBenchmarks();
+  RegisterCubemapBenchmarks();
+  RegisterMipmapBenchmarks();
+  RegisterPixelConvertBenchmarks();
+  RegisterBlockCompressionBenchmarks();
+  RegisterImageDiffBenchmarks();
+  RegisterModelBenchmarks();
+  return runner.Run(argc, argv);
+}
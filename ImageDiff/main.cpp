@@ -0,0 +1,408 @@
+#include "ImageDiff.h"
+#include "ImageWriter.h"
+#include "PixelConvert.h"
+#include "Statistics.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+// 描画結果の画像を比較する.
+//  ImageDiff <a> <b> [options]
+//    a, b がディレクトリの場合は同じ名前のファイル同士を比較する.
+//    PNG/JPG の他、FrameCapture の raw 形式(frame_000000_WxH.rgba)を読み込める.
+//
+//  --max-error <n>     チャンネルの最大誤差の許容値(既定 0)
+//  --min-psnr <db>     PSNR の下限(最大誤差が許容値を超えた場合に使用)
+//  --min-ssim <s>      SSIM の下限(同上)
+//  --heatmap <path>    差分の画像を書き出す(ディレクトリ比較の場合は出力先ディレクトリ)
+//  --heatmap-scale <n> 差分を強調する倍率(既定 4)
+//  --threads <n>       並列に比較するファイル数(既定はハードウェアのスレッド数)
+//  --json <file>       結果の出力先
+namespace
+{
+  struct Options
+  {
+    std::string pathA, pathB;
+    uint32_t maxError = 0;
+    double minPSNR = 0.0;
+    double minSSIM = 0.0;
+    std::string heatmapPath;
+    uint32_t heatmapScale = 4;
+    uint32_t threads = 0;
+    std::string jsonPath;
+  };
+
+  struct Image
+  {
+    uint32_t width = 0, height = 0;
+    std::vector<uint8_t> pixels;
+  };
+
+  struct FileResult
+  {
+    std::string name;
+    std::string error;
+    book_util::ImageDiffResult diff;
+    bool isPassed;
+  };
+
+  bool IsDirectory(const std::string& path)
+  {
+#ifdef _WIN32
+    auto attr = GetFileAttributesA(path.c_str());
+    return attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+  }
+
+  std::vector<std::string> ListFiles(const std::string& directory)
+  {
+    std::vector<std::string> files;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    auto handle = FindFirstFileA((directory + "\\*").c_str(), &data);
+    if (handle != INVALID_HANDLE_VALUE)
+    {
+      do
+      {
+        if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+        {
+          files.push_back(data.cFileName);
+        }
+      } while (FindNextFileA(handle, &data));
+      FindClose(handle);
+    }
+#else
+    if (auto dir = opendir(directory.c_str()))
+    {
+      while (auto entry = readdir(dir))
+      {
+        std::string name = entry->d_name;
+        if (!IsDirectory(directory + "/" + name))
+        {
+          files.push_back(name);
+        }
+      }
+      closedir(dir);
+    }
+#endif
+    std::sort(files.begin(), files.end());
+    return files;
+  }
+
+  bool HasExtension(const std::string& name, const char* ext)
+  {
+    auto pos = name.find_last_of('.');
+    if (pos == std::string::npos)
+    {
+      return false;
+    }
+    auto e = name.substr(pos + 1);
+    std::transform(e.begin(), e.end(), e.begin(), [](char c) { return char(tolower(c)); });
+    return e == ext;
+  }
+
+  bool IsImageFile(const std::string& name)
+  {
+    return HasExtension(name, "png") || HasExtension(name, "jpg") || HasExtension(name, "rgba");
+  }
+
+  bool LoadImage(const std::string& fileName, Image& image)
+  {
+    if (HasExtension(fileName, "rgba"))
+    {
+      // サイズはファイル名の末尾 "_WxH.rgba" から得る.
+      auto pos = fileName.find_last_of('_');
+      unsigned w = 0, h = 0;
+      if (pos == std::string::npos || sscanf(fileName.c_str() + pos, "_%ux%u.", &w, &h) != 2)
+      {
+        return false;
+      }
+      std::ifstream infile(fileName, std::ios::binary);
+      if (!infile)
+      {
+        return false;
+      }
+      image.width = w;
+      image.height = h;
+      image.pixels.resize(size_t(w) * h * 4);
+      infile.read(reinterpret_cast<char*>(image.pixels.data()), image.pixels.size());
+      return bool(infile);
+    }
+
+    // ファイルは並列に比較するため、変換は 1 スレッドで行う.
+    int width, height, components;
+    auto pImage = stbi_load(fileName.c_str(), &width, &height, &components, 0);
+    if (pImage == nullptr)
+    {
+      return false;
+    }
+    image.width = uint32_t(width);
+    image.height = uint32_t(height);
+    image.pixels.resize(size_t(width) * height * 4);
+    book_util::ConvertChannels(pImage, uint32_t(components), image.pixels.data(), 4, image.width, image.height, 1);
+    stbi_image_free(pImage);
+    return true;
+  }
+
+  FileResult CompareFiles(const std::string& name, const std::string& fileA, const std::string& fileB,
+    const std::string& heatmapFile, const Options& opt)
+  {
+    FileResult result;
+    result.name = name;
+    result.diff = book_util::ImageDiffResult{};
+    result.isPassed = false;
+
+    Image a, b;
+    if (!LoadImage(fileA, a))
+    {
+      result.error = "cannot load " + fileA;
+      return result;
+    }
+    if (!LoadImage(fileB, b))
+    {
+      result.error = "cannot load " + fileB;
+      return result;
+    }
+    if (a.width != b.width || a.height != b.height)
+    {
+      result.error = "size mismatch";
+      return result;
+    }
+
+    std::vector<uint8_t> heatmap;
+    result.diff = book_util::CompareImages(a.pixels.data(), b.pixels.data(), a.width, a.height, 0, 0,
+      heatmapFile.empty() ? nullptr : &heatmap, opt.heatmapScale);
+    if (!heatmapFile.empty())
+    {
+      book_util::WritePNG(heatmapFile.c_str(), a.width, a.height, 4, heatmap.data());
+    }
+
+    const auto& d = result.diff;
+    uint32_t maxError = (std::max)((std::max)(d.maxError[0], d.maxError[1]), (std::max)(d.maxError[2], d.maxError[3]));
+    // 誤差が許容値内であれば合格とし、そうでなければ PSNR/SSIM の下限が指定されている場合のみそれで判定する.
+    bool hasQualityLimit = opt.minPSNR > 0.0 || opt.minSSIM > 0.0;
+    result.isPassed = maxError <= opt.maxError ||
+      (hasQualityLimit && d.psnr >= opt.minPSNR && d.ssim >= opt.minSSIM);
+    return result;
+  }
+
+  bool ParseOptions(int argc, char* argv[], Options& opt)
+  {
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      if (arg.compare(0, 2, "--") != 0)
+      {
+        positional.push_back(arg);
+        continue;
+      }
+      if (i + 1 >= argc)
+      {
+        std::cerr << "missing value: " << arg << std::endl;
+        return false;
+      }
+      if (arg == "--max-error")
+      {
+        opt.maxError = uint32_t(std::atoi(argv[++i]));
+      }
+      else if (arg == "--min-psnr")
+      {
+        opt.minPSNR = std::atof(argv[++i]);
+      }
+      else if (arg == "--min-ssim")
+      {
+        opt.minSSIM = std::atof(argv[++i]);
+      }
+      else if (arg == "--heatmap")
+      {
+        opt.heatmapPath = argv[++i];
+      }
+      else if (arg == "--heatmap-scale")
+      {
+        opt.heatmapScale = uint32_t(std::atoi(argv[++i]));
+      }
+      else if (arg == "--threads")
+      {
+        opt.threads = uint32_t(std::atoi(argv[++i]));
+      }
+      else if (arg == "--json")
+      {
+        opt.jsonPath = argv[++i];
+      }
+      else
+      {
+        std::cerr << "unknown option: " << arg << std::endl;
+        return false;
+      }
+    }
+    if (positional.size() != 2)
+    {
+      return false;
+    }
+    opt.pathA = positional[0];
+    opt.pathB = positional[1];
+    return true;
+  }
+
+  void WriteNumber(std::ostream& os, double value)
+  {
+    // JSON は無限大を表せないため null とする.
+    if (std::isinf(value))
+    {
+      os << "null";
+    }
+    else
+    {
+      os << value;
+    }
+  }
+
+  void WriteResults(std::ostream& os, const std::vector<FileResult>& results)
+  {
+    os << std::fixed << std::setprecision(6);
+    os << "{\n";
+    os << "  \"instructionSet\": \"" << book_util::GetImageDiffInstructionSet() << "\",\n";
+    os << "  \"files\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      const auto& r = results[i];
+      os << (i == 0 ? "\n" : ",\n") << "    { \"name\": \"" << book_util::EscapeJson(r.name) << "\", ";
+      if (!r.error.empty())
+      {
+        os << "\"error\": \"" << book_util::EscapeJson(r.error) << "\", \"passed\": false }";
+        continue;
+      }
+      const auto& d = r.diff;
+      os << "\"maxError\": [" << d.maxError[0] << ", " << d.maxError[1] << ", " << d.maxError[2] << ", " << d.maxError[3] << "], ";
+      os << "\"psnr\": ";
+      WriteNumber(os, d.psnr);
+      os << ", \"ssim\": " << d.ssim << ", \"differentPixels\": " << d.differentPixels;
+      os << ", \"passed\": " << (r.isPassed ? "true" : "false") << " }";
+    }
+    os << (results.empty() ? "]\n" : "\n  ]\n");
+    os << "}\n";
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options opt;
+  if (!ParseOptions(argc, argv, opt))
+  {
+    std::cerr <<
+      "usage: ImageDiff <a> <b> [--max-error n] [--min-psnr db] [--min-ssim s]\n"
+      "       [--heatmap path] [--heatmap-scale n] [--threads n] [--json file]\n";
+    return 2;
+  }
+
+  // 比較するファイルの組を作る.
+  struct Job
+  {
+    std::string name, fileA, fileB, heatmap;
+  };
+  std::vector<Job> jobs;
+  if (IsDirectory(opt.pathA) && IsDirectory(opt.pathB))
+  {
+    for (const auto& name : ListFiles(opt.pathA))
+    {
+      if (!IsImageFile(name))
+      {
+        continue;
+      }
+      Job job{ name, opt.pathA + "/" + name, opt.pathB + "/" + name, std::string() };
+      if (!opt.heatmapPath.empty())
+      {
+        auto base = name.substr(0, name.find_last_of('.'));
+        job.heatmap = opt.heatmapPath + "/" + base + "_diff.png";
+      }
+      jobs.push_back(job);
+    }
+  }
+  else
+  {
+    jobs.push_back(Job{ opt.pathA, opt.pathA, opt.pathB, opt.heatmapPath });
+  }
+
+  // ファイル単位で複数スレッドに分配する.
+  std::vector<FileResult> results(jobs.size());
+  std::atomic<size_t> next(0);
+  uint32_t threadCount = opt.threads > 0 ? opt.threads : (std::max)(std::thread::hardware_concurrency(), 1u);
+  threadCount = (std::min)(threadCount, uint32_t((std::max)(jobs.size(), size_t(1))));
+  std::vector<std::thread> workers;
+  for (uint32_t i = 0; i < threadCount; ++i)
+  {
+    workers.emplace_back([&]()
+    {
+      for (size_t index = next++; index < jobs.size(); index = next++)
+      {
+        const auto& job = jobs[index];
+        results[index] = CompareFiles(job.name, job.fileA, job.fileB, job.heatmap, opt);
+      }
+    });
+  }
+  for (auto& w : workers)
+  {
+    w.join();
+  }
+
+  uint32_t failed = 0;
+  for (const auto& r : results)
+  {
+    if (!r.error.empty())
+    {
+      std::cout << r.name << ": " << r.error << std::endl;
+    }
+    else
+    {
+      const auto& d = r.diff;
+      std::cout << r.name << ": max(" << d.maxError[0] << "," << d.maxError[1] << "," << d.maxError[2] << "," << d.maxError[3] << ")"
+        << " psnr " << std::fixed << std::setprecision(2) << d.psnr
+        << " ssim " << std::setprecision(5) << d.ssim
+        << " diff " << d.differentPixels << (r.isPassed ? "" : "  FAILED") << std::endl;
+    }
+    failed += r.isPassed ? 0 : 1;
+  }
+  std::cout << results.size() - failed << "/" << results.size() << " passed (" << book_util::GetImageDiffInstructionSet() << ")" << std::endl;
+
+  if (!opt.jsonPath.empty())
+  {
+    std::ofstream outfile(opt.jsonPath);
+    if (!outfile)
+    {
+      std::cerr << "cannot write results: " << opt.jsonPath << std::endl;
+      return 2;
+    }
+    WriteResults(outfile, results);
+  }
+  if (results.empty())
+  {
+    std::cerr << "no images to compare" << std::endl;
+    return 2;
+  }
+  return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,736 @@
+#include "MeshImporter.h"
+
+#include <glm/gtc/quaternion.hpp>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+namespace
+{
+  std::string GetDirectory(const std::string& fileName)
+  {
+    auto pos = fileName.find_last_of("/\\");
+    return pos == std::string::npos ? std::string() : fileName.substr(0, pos + 1);
+  }
+
+  bool ReadFile(const std::string& fileName, std::vector<uint8_t>& data)
+  {
+    std::ifstream infile(fileName, std::ios::binary);
+    if (!infile)
+    {
+      return false;
+    }
+    data.assign(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+    return true;
+  }
+
+  // 法線のない頂点について、位置を共有する面の法線(面積で重み付け)を平均して求める.
+  void ComputeMissingNormals(ImportedMesh& mesh, const std::vector<uint8_t>& hasNormal)
+  {
+    std::vector<glm::vec3> sums(mesh.vertices.size(), glm::vec3(0.0f));
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+    {
+      auto i0 = mesh.indices[i], i1 = mesh.indices[i + 1], i2 = mesh.indices[i + 2];
+      const auto& p0 = mesh.vertices[i0].position;
+      auto n = glm::cross(mesh.vertices[i1].position - p0, mesh.vertices[i2].position - p0);
+      sums[i0] += n;
+      sums[i1] += n;
+      sums[i2] += n;
+    }
+    for (size_t v = 0; v < mesh.vertices.size(); ++v)
+    {
+      if (!hasNormal[v])
+      {
+        float len = glm::length(sums[v]);
+        mesh.vertices[v].normal = len > 0.0f ? sums[v] / len : glm::vec3(0.0f, 1.0f, 0.0f);
+      }
+    }
+  }
+
+  // glTF の読み込みに必要な範囲の JSON.
+  struct JsonValue
+  {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::map<std::string, JsonValue> object;
+
+    const JsonValue& operator[](const std::string& key) const
+    {
+      static const JsonValue null;
+      auto it = object.find(key);
+      return it == object.end() ? null : it->second;
+    }
+    const JsonValue& operator[](size_t index) const
+    {
+      static const JsonValue null;
+      return index < array.size() ? array[index] : null;
+    }
+    bool IsNull() const { return type == Type::Null; }
+    size_t Size() const { return array.size(); }
+    double AsNumber(double defaultValue = 0.0) const { return type == Type::Number ? number : defaultValue; }
+    uint32_t AsUint(uint32_t defaultValue = 0) const { return type == Type::Number ? uint32_t(number) : defaultValue; }
+  };
+
+  class JsonParser
+  {
+  public:
+    JsonParser(const char* begin, const char* end) : m_p(begin), m_end(end) { }
+    bool Parse(JsonValue& value)
+    {
+      return ParseValue(value, 0) && (SkipSpace(), m_p == m_end);
+    }
+  private:
+    void SkipSpace()
+    {
+      while (m_p < m_end && (*m_p == ' ' || *m_p == '\t' || *m_p == '\r' || *m_p == '\n'))
+      {
+        ++m_p;
+      }
+    }
+    bool Consume(char c)
+    {
+      SkipSpace();
+      if (m_p < m_end && *m_p == c)
+      {
+        ++m_p;
+        return true;
+      }
+      return false;
+    }
+    bool ParseValue(JsonValue& value, int depth)
+    {
+      SkipSpace();
+      if (m_p >= m_end || depth > 64)
+      {
+        return false;
+      }
+      switch (*m_p)
+      {
+      case '{':
+        ++m_p;
+        value.type = JsonValue::Type::Object;
+        if (Consume('}'))
+        {
+          return true;
+        }
+        do
+        {
+          std::string key;
+          SkipSpace();
+          if (!ParseString(key) || !Consume(':') || !ParseValue(value.object[key], depth + 1))
+          {
+            return false;
+          }
+        } while (Consume(','));
+        return Consume('}');
+      case '[':
+        ++m_p;
+        value.type = JsonValue::Type::Array;
+        if (Consume(']'))
+        {
+          return true;
+        }
+        do
+        {
+          value.array.emplace_back();
+          if (!ParseValue(value.array.back(), depth + 1))
+          {
+            return false;
+          }
+        } while (Consume(','));
+        return Consume(']');
+      case '"':
+        value.type = JsonValue::Type::String;
+        return ParseString(value.string);
+      case 't':
+      case 'f':
+      case 'n':
+        return ParseLiteral(value);
+      default:
+      {
+        char* end = nullptr;
+        std::string token(m_p, std::min<size_t>(m_end - m_p, 64));
+        value.number = strtod(token.c_str(), &end);
+        if (end == token.c_str())
+        {
+          return false;
+        }
+        value.type = JsonValue::Type::Number;
+        m_p += end - token.c_str();
+        return true;
+      }
+      }
+    }
+    bool ParseLiteral(JsonValue& value)
+    {
+      struct Literal
+      {
+        const char* text;
+        JsonValue::Type type;
+        bool boolean;
+      };
+      static const Literal literals[] = {
+        { "true", JsonValue::Type::Bool, true },
+        { "false", JsonValue::Type::Bool, false },
+        { "null", JsonValue::Type::Null, false },
+      };
+      for (const auto& literal : literals)
+      {
+        auto length = strlen(literal.text);
+        if (size_t(m_end - m_p) >= length && strncmp(m_p, literal.text, length) == 0)
+        {
+          value.type = literal.type;
+          value.boolean = literal.boolean;
+          m_p += length;
+          return true;
+        }
+      }
+      return false;
+    }
+    bool ParseString(std::string& s)
+    {
+      if (m_p >= m_end || *m_p != '"')
+      {
+        return false;
+      }
+      ++m_p;
+      while (m_p < m_end && *m_p != '"')
+      {
+        char c = *m_p++;
+        if (c != '\\')
+        {
+          s.push_back(c);
+          continue;
+        }
+        if (m_p >= m_end)
+        {
+          return false;
+        }
+        c = *m_p++;
+        switch (c)
+        {
+        case 'n': s.push_back('\n'); break;
+        case 't': s.push_back('\t'); break;
+        case 'r': s.push_back('\r'); break;
+        case 'b': s.push_back('\b'); break;
+        case 'f': s.push_back('\f'); break;
+        case 'u':
+        {
+          // 名前やURIに使われる程度のため、UTF-8 へ変換するのみ(サロゲートペアは扱わない).
+          if (m_end - m_p < 4)
+          {
+            return false;
+          }
+          auto code = uint32_t(strtoul(std::string(m_p, 4).c_str(), nullptr, 16));
+          m_p += 4;
+          if (code < 0x80)
+          {
+            s.push_back(char(code));
+          }
+          else if (code < 0x800)
+          {
+            s.push_back(char(0xC0 | (code >> 6)));
+            s.push_back(char(0x80 | (code & 0x3F)));
+          }
+          else
+          {
+            s.push_back(char(0xE0 | (code >> 12)));
+            s.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+            s.push_back(char(0x80 | (code & 0x3F)));
+          }
+          break;
+        }
+        default: s.push_back(c); break;
+        }
+      }
+      if (m_p >= m_end)
+      {
+        return false;
+      }
+      ++m_p;
+      return true;
+    }
+
+    const char* m_p;
+    const char* m_end;
+  };
+
+  bool DecodeBase64(const std::string& text, std::vector<uint8_t>& data)
+  {
+    auto decode = [](char c) -> int
+    {
+      if (c >= 'A' && c <= 'Z') return c - 'A';
+      if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+      if (c >= '0' && c <= '9') return c - '0' + 52;
+      if (c == '+' || c == '-') return 62;
+      if (c == '/' || c == '_') return 63;
+      return -1;
+    };
+    uint32_t bits = 0;
+    int bitCount = 0;
+    for (char c : text)
+    {
+      if (c == '=')
+      {
+        break;
+      }
+      int v = decode(c);
+      if (v < 0)
+      {
+        return false;
+      }
+      bits = (bits << 6) | uint32_t(v);
+      bitCount += 6;
+      if (bitCount >= 8)
+      {
+        bitCount -= 8;
+        data.push_back(uint8_t(bits >> bitCount));
+      }
+    }
+    return true;
+  }
+
+  class GltfLoader
+  {
+  public:
+    GltfLoader(const JsonValue& root, std::vector<std::vector<uint8_t>>& buffers) : m_root(root), m_buffers(buffers) { }
+
+    // accessor の各要素を float の components 個として取り出す. 正規化された整数にも対応する.
+    bool ReadFloats(uint32_t accessorIndex, uint32_t components, std::vector<float>& out, std::string& error) const
+    {
+      const auto& accessor = m_root["accessors"][accessorIndex];
+      const uint8_t* data;
+      uint32_t stride, count;
+      if (!Locate(accessor, components, data, stride, count, error))
+      {
+        return false;
+      }
+      auto componentType = accessor["componentType"].AsUint();
+      bool isNormalized = accessor["normalized"].boolean;
+      out.resize(size_t(count) * components);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        for (uint32_t c = 0; c < components; ++c)
+        {
+          float v;
+          switch (componentType)
+          {
+          case 5126: memcpy(&v, data + size_t(stride) * i + c * 4, 4); break;
+          case 5120: v = float(int8_t(data[size_t(stride) * i + c])); v = isNormalized ? std::max(v / 127.0f, -1.0f) : v; break;
+          case 5121: v = float(data[size_t(stride) * i + c]); v = isNormalized ? v / 255.0f : v; break;
+          case 5122: { int16_t s; memcpy(&s, data + size_t(stride) * i + c * 2, 2); v = isNormalized ? std::max(s / 32767.0f, -1.0f) : float(s); break; }
+          case 5123: { uint16_t s; memcpy(&s, data + size_t(stride) * i + c * 2, 2); v = isNormalized ? s / 65535.0f : float(s); break; }
+          default:
+            error = "unsupported component type";
+            return false;
+          }
+          out[size_t(i) * components + c] = v;
+        }
+      }
+      return true;
+    }
+
+    bool ReadIndices(uint32_t accessorIndex, std::vector<uint32_t>& out, std::string& error) const
+    {
+      const auto& accessor = m_root["accessors"][accessorIndex];
+      const uint8_t* data;
+      uint32_t stride, count;
+      if (!Locate(accessor, 1, data, stride, count, error))
+      {
+        return false;
+      }
+      out.resize(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        switch (accessor["componentType"].AsUint())
+        {
+        case 5121: out[i] = data[size_t(stride) * i]; break;
+        case 5123: { uint16_t v; memcpy(&v, data + size_t(stride) * i, 2); out[i] = v; break; }
+        case 5125: memcpy(&out[i], data + size_t(stride) * i, 4); break;
+        default:
+          error = "unsupported index type";
+          return false;
+        }
+      }
+      return true;
+    }
+
+  private:
+    static uint32_t GetComponentSize(uint32_t componentType)
+    {
+      switch (componentType)
+      {
+      case 5120: case 5121: return 1;
+      case 5122: case 5123: return 2;
+      case 5125: case 5126: return 4;
+      default: return 0;
+      }
+    }
+
+    bool Locate(const JsonValue& accessor, uint32_t components, const uint8_t*& data, uint32_t& stride, uint32_t& count, std::string& error) const
+    {
+      if (accessor.IsNull() || !accessor["sparse"].IsNull() || accessor["bufferView"].IsNull())
+      {
+        error = "unsupported accessor (sparse or without bufferView)";
+        return false;
+      }
+      const auto& view = m_root["bufferViews"][accessor["bufferView"].AsUint()];
+      auto bufferIndex = view["buffer"].AsUint();
+      auto elementSize = GetComponentSize(accessor["componentType"].AsUint()) * components;
+      count = accessor["count"].AsUint();
+      stride = view["byteStride"].AsUint(elementSize);
+      uint64_t begin = uint64_t(view["byteOffset"].AsUint()) + accessor["byteOffset"].AsUint();
+      uint64_t viewEnd = uint64_t(view["byteOffset"].AsUint()) + view["byteLength"].AsUint();
+      if (elementSize == 0 || bufferIndex >= m_buffers.size() || viewEnd > m_buffers[bufferIndex].size() ||
+        (count > 0 && begin + uint64_t(stride) * (count - 1) + elementSize > viewEnd))
+      {
+        error = "accessor out of range";
+        return false;
+      }
+      data = m_buffers[bufferIndex].data() + begin;
+      return true;
+    }
+
+    const JsonValue& m_root;
+    std::vector<std::vector<uint8_t>>& m_buffers;
+  };
+
+  glm::mat4 GetNodeMatrix(const JsonValue& node)
+  {
+    const auto& matrix = node["matrix"];
+    if (matrix.Size() == 16)
+    {
+      glm::mat4 m;
+      for (int i = 0; i < 16; ++i)
+      {
+        m[i / 4][i % 4] = float(matrix[i].AsNumber());
+      }
+      return m;
+    }
+    const auto& t = node["translation"];
+    const auto& r = node["rotation"];
+    const auto& s = node["scale"];
+    auto translation = glm::vec3(float(t[0].AsNumber()), float(t[1].AsNumber()), float(t[2].AsNumber()));
+    auto rotation = glm::quat(float(r[3].AsNumber(1.0)), float(r[0].AsNumber()), float(r[1].AsNumber()), float(r[2].AsNumber()));
+    auto scale = glm::vec3(float(s[0].AsNumber(1.0)), float(s[1].AsNumber(1.0)), float(s[2].AsNumber(1.0)));
+    auto m = glm::mat4_cast(rotation);
+    m[0] *= scale.x;
+    m[1] *= scale.y;
+    m[2] *= scale.z;
+    m[3] = glm::vec4(translation, 1.0f);
+    return m;
+  }
+
+  bool AppendPrimitive(const GltfLoader& loader, const JsonValue& primitive, const glm::mat4& matrix,
+    ImportedMesh& mesh, std::vector<uint8_t>& hasNormal, std::string& error)
+  {
+    const auto& attributes = primitive["attributes"];
+    if (attributes["POSITION"].IsNull())
+    {
+      return true;
+    }
+    std::vector<float> positions, normals;
+    if (!loader.ReadFloats(attributes["POSITION"].AsUint(), 3, positions, error))
+    {
+      return false;
+    }
+    bool withNormals = !attributes["NORMAL"].IsNull();
+    if (withNormals && !loader.ReadFloats(attributes["NORMAL"].AsUint(), 3, normals, error))
+    {
+      return false;
+    }
+    auto vertexCount = uint32_t(positions.size() / 3);
+    std::vector<uint32_t> indices;
+    if (!primitive["indices"].IsNull())
+    {
+      if (!loader.ReadIndices(primitive["indices"].AsUint(), indices, error))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      indices.resize(vertexCount);
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        indices[i] = i;
+      }
+    }
+
+    // 法線は逆転置行列で変換する. 反転を含む変換では面の向きも入れ替える.
+    auto normalMatrix = glm::transpose(glm::inverse(glm::mat3(matrix)));
+    bool isFlipped = glm::determinant(glm::mat3(matrix)) < 0.0f;
+    auto base = uint32_t(mesh.vertices.size());
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      ImportedVertex v;
+      v.position = glm::vec3(matrix * glm::vec4(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2], 1.0f));
+      v.normal = glm::vec3(0.0f);
+      if (withNormals)
+      {
+        auto n = normalMatrix * glm::vec3(normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]);
+        float len = glm::length(n);
+        v.normal = len > 0.0f ? n / len : n;
+      }
+      mesh.vertices.push_back(v);
+      hasNormal.push_back(withNormals ? 1 : 0);
+    }
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+      if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount || indices[i + 2] >= vertexCount)
+      {
+        error = "index out of range";
+        return false;
+      }
+      mesh.indices.push_back(base + indices[i]);
+      mesh.indices.push_back(base + indices[isFlipped ? i + 2 : i + 1]);
+      mesh.indices.push_back(base + indices[isFlipped ? i + 1 : i + 2]);
+    }
+    return true;
+  }
+}
+
+bool ImportObj(const std::string& fileName, ImportedMesh& mesh, std::string& error)
+{
+  std::ifstream infile(fileName);
+  if (!infile)
+  {
+    error = "cannot open " + fileName;
+    return false;
+  }
+  std::vector<glm::vec3> positions, normals;
+  // 位置と法線の番号の組ごとに頂点を作る.
+  std::unordered_map<uint64_t, uint32_t> vertexMap;
+  std::vector<uint8_t> hasNormal;
+  std::vector<uint32_t> polygon;
+  std::string line;
+  uint32_t lineNumber = 0;
+  while (std::getline(infile, line))
+  {
+    ++lineNumber;
+    std::istringstream ss(line);
+    std::string tag;
+    ss >> tag;
+    if (tag == "v")
+    {
+      glm::vec3 p;
+      ss >> p.x >> p.y >> p.z;
+      positions.push_back(p);
+    }
+    else if (tag == "vn")
+    {
+      glm::vec3 n;
+      ss >> n.x >> n.y >> n.z;
+      normals.push_back(n);
+    }
+    else if (tag == "f")
+    {
+      polygon.clear();
+      std::string token;
+      while (ss >> token)
+      {
+        // v, v/vt, v//vn, v/vt/vn. 負の番号は末尾からの位置.
+        int indices[3] = { 0, 0, 0 };
+        size_t start = 0;
+        for (int k = 0; k < 3 && start <= token.size(); ++k)
+        {
+          auto slash = token.find('/', start);
+          auto part = token.substr(start, slash == std::string::npos ? std::string::npos : slash - start);
+          indices[k] = part.empty() ? 0 : atoi(part.c_str());
+          if (slash == std::string::npos)
+          {
+            break;
+          }
+          start = slash + 1;
+        }
+        int p = indices[0] < 0 ? int(positions.size()) + indices[0] : indices[0] - 1;
+        int n = indices[2] < 0 ? int(normals.size()) + indices[2] : indices[2] - 1;
+        if (p < 0 || p >= int(positions.size()) || n >= int(normals.size()) || (indices[2] != 0 && n < 0))
+        {
+          error = fileName + "(" + std::to_string(lineNumber) + "): index out of range";
+          return false;
+        }
+        uint64_t key = (uint64_t(uint32_t(p)) << 32) | uint32_t(indices[2] != 0 ? n + 1 : 0);
+        auto it = vertexMap.find(key);
+        if (it == vertexMap.end())
+        {
+          ImportedVertex v;
+          v.position = positions[p];
+          v.normal = indices[2] != 0 ? glm::normalize(normals[n]) : glm::vec3(0.0f);
+          it = vertexMap.emplace(key, uint32_t(mesh.vertices.size())).first;
+          mesh.vertices.push_back(v);
+          hasNormal.push_back(indices[2] != 0 ? 1 : 0);
+        }
+        polygon.push_back(it->second);
+      }
+      for (size_t k = 2; k < polygon.size(); ++k)
+      {
+        mesh.indices.push_back(polygon[0]);
+        mesh.indices.push_back(polygon[k - 1]);
+        mesh.indices.push_back(polygon[k]);
+      }
+    }
+  }
+  if (mesh.indices.empty())
+  {
+    error = "no faces in " + fileName;
+    return false;
+  }
+  ComputeMissingNormals(mesh, hasNormal);
+  return true;
+}
+
+bool ImportGltf(const std::string& fileName, ImportedMesh& mesh, std::string& error)
+{
+  std::vector<uint8_t> file;
+  if (!ReadFile(fileName, file))
+  {
+    error = "cannot open " + fileName;
+    return false;
+  }
+
+  // .glb はヘッダ(12 バイト)の後に JSON、BIN のチャンクが続く.
+  const char* jsonBegin = reinterpret_cast<const char*>(file.data());
+  const char* jsonEnd = jsonBegin + file.size();
+  std::vector<uint8_t> binChunk;
+  if (file.size() >= 12 && memcmp(file.data(), "glTF", 4) == 0)
+  {
+    size_t offset = 12;
+    jsonBegin = jsonEnd = nullptr;
+    while (offset + 8 <= file.size())
+    {
+      uint32_t chunkLength, chunkType;
+      memcpy(&chunkLength, file.data() + offset, 4);
+      memcpy(&chunkType, file.data() + offset + 4, 4);
+      offset += 8;
+      if (chunkLength > file.size() - offset)
+      {
+        break;
+      }
+      if (chunkType == 0x4E4F534A)  // "JSON"
+      {
+        jsonBegin = reinterpret_cast<const char*>(file.data() + offset);
+        jsonEnd = jsonBegin + chunkLength;
+      }
+      else if (chunkType == 0x004E4942)  // "BIN\0"
+      {
+        binChunk.assign(file.data() + offset, file.data() + offset + chunkLength);
+      }
+      offset += (chunkLength + 3) & ~3u;
+    }
+    if (jsonBegin == nullptr)
+    {
+      error = "no JSON chunk in " + fileName;
+      return false;
+    }
+  }
+
+  JsonValue root;
+  if (!JsonParser(jsonBegin, jsonEnd).Parse(root))
+  {
+    error = "invalid JSON in " + fileName;
+    return false;
+  }
+
+  std::vector<std::vector<uint8_t>> buffers;
+  const auto& bufferDescs = root["buffers"];
+  for (size_t i = 0; i < bufferDescs.Size(); ++i)
+  {
+    const auto& uri = bufferDescs[i]["uri"];
+    buffers.emplace_back();
+    if (uri.IsNull())
+    {
+      buffers.back() = binChunk;
+    }
+    else if (uri.string.compare(0, 5, "data:") == 0)
+    {
+      auto comma = uri.string.find(";base64,");
+      if (comma == std::string::npos || !DecodeBase64(uri.string.substr(comma + 8), buffers.back()))
+      {
+        error = "unsupported data URI in " + fileName;
+        return false;
+      }
+    }
+    else if (!ReadFile(GetDirectory(fileName) + uri.string, buffers.back()))
+    {
+      error = "cannot open " + GetDirectory(fileName) + uri.string;
+      return false;
+    }
+  }
+
+  GltfLoader loader(root, buffers);
+  std::vector<uint8_t> hasNormal;
+  const auto& nodes = root["nodes"];
+  const auto& meshes = root["meshes"];
+
+  // 既定のシーン(なければ最初のシーン)のノードを親から順に辿る.
+  std::vector<std::pair<uint32_t, glm::mat4>> stack;
+  const auto& scene = root["scenes"][root["scene"].AsUint()];
+  for (size_t i = 0; i < scene["nodes"].Size(); ++i)
+  {
+    stack.emplace_back(scene["nodes"][i].AsUint(), glm::mat4(1.0f));
+  }
+  if (scene.IsNull())
+  {
+    // シーンがなければ、メッシュを変換せずにそのまま取り込む.
+    for (size_t m = 0; m < meshes.Size(); ++m)
+    {
+      const auto& primitives = meshes[m]["primitives"];
+      for (size_t p = 0; p < primitives.Size(); ++p)
+      {
+        if (primitives[p]["mode"].AsUint(4) == 4 &&
+          !AppendPrimitive(loader, primitives[p], glm::mat4(1.0f), mesh, hasNormal, error))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  size_t visited = 0;
+  while (!stack.empty())
+  {
+    auto nodeIndex = stack.back().first;
+    auto parent = stack.back().second;
+    stack.pop_back();
+    if (nodeIndex >= nodes.Size() || ++visited > nodes.Size())
+    {
+      error = "invalid node hierarchy in " + fileName;
+      return false;
+    }
+    const auto& node = nodes[nodeIndex];
+    auto matrix = parent * GetNodeMatrix(node);
+    if (!node["mesh"].IsNull())
+    {
+      const auto& primitives = meshes[node["mesh"].AsUint()]["primitives"];
+      for (size_t p = 0; p < primitives.Size(); ++p)
+      {
+        // 三角形リスト以外(線、点、ストリップ)は取り込まない.
+        if (primitives[p]["mode"].AsUint(4) == 4 &&
+          !AppendPrimitive(loader, primitives[p], matrix, mesh, hasNormal, error))
+        {
+          return false;
+        }
+      }
+    }
+    for (size_t i = 0; i < node["children"].Size(); ++i)
+    {
+      stack.emplace_back(node["children"][i].AsUint(), matrix);
+    }
+  }
+  if (mesh.indices.empty())
+  {
+    error = "no triangles in " + fileName;
+    return false;
+  }
+  ComputeMissingNormals(mesh, hasNormal);
+  return true;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// 取り込んだ三角形リストのメッシュ. 位置は各頂点の先頭に置く(MeshOptimizer の要件).
+struct ImportedVertex
+{
+  glm::vec3 position;
+  glm::vec3 normal;
+};
+struct ImportedMesh
+{
+  std::vector<ImportedVertex> vertices;
+  std::vector<uint32_t> indices;
+};
+
+// Wavefront OBJ を読み込む. 多角形は扇状に三角形へ分割し、法線がなければ面の法線を平均して求める.
+// 複数のオブジェクト、グループは 1 つのメッシュにまとめる.
+bool ImportObj(const std::string& fileName, ImportedMesh& mesh, std::string& error);
+
+// glTF 2.0 (.gltf/.glb) を読み込む. 既定のシーンのノードの変換を適用し、三角形リストのプリミティブを 1 つにまとめる.
+// バッファは .glb の BIN チャンク、外部ファイル、base64 の data URI に対応する.
+bool ImportGltf(const std::string& fileName, ImportedMesh& mesh, std::string& error);
@@ -0,0 +1,255 @@
+#include "MeshFile.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantize.h"
+#include "Meshlet.h"
+#include "TeapotModel.h"
+#include "MeshImporter.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <iterator>
+#include <cstddef>
+#include <cctype>
+
+// モデルファイルを調理済みのメッシュ(.mesh)へ変換する.
+//  MeshCooker <input.obj|.gltf|.glb> -o <output.mesh> [options]
+//  MeshCooker --teapot -o <output.mesh> [options]
+//
+//  --format <compact|float>             頂点の形式(既定 compact)
+//                                       compact は CompactVertex(12 バイト)、float は位置と法線を float で格納する(24 バイト).
+//  --no-optimize                        頂点キャッシュ、オーバードロー向けの並べ替えを行わない
+//  --no-lod                             簡略化した詳細度を作らない(LOD 0 のみとする)
+//  --teapot                             サンプルに組み込まれているティーポット(TeapotModel.h)を入力とする
+namespace
+{
+  struct Options
+  {
+    std::string input;
+    std::string output;
+    bool isCompact = true;
+    bool isOptimizeEnabled = true;
+    bool isLodEnabled = true;
+    bool isTeapot = false;
+  };
+
+  bool EndsWith(const std::string& s, const std::string& suffix)
+  {
+    if (s.size() < suffix.size())
+    {
+      return false;
+    }
+    for (size_t i = 0; i < suffix.size(); ++i)
+    {
+      if (tolower(s[s.size() - suffix.size() + i]) != suffix[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool LoadInput(const Options& opt, ImportedMesh& mesh)
+  {
+    if (opt.isTeapot)
+    {
+      for (const auto& v : TeapotModel::TeapotVerticesPN)
+      {
+        mesh.vertices.push_back(ImportedVertex{ v.Position, v.Normal });
+      }
+      mesh.indices.assign(std::begin(TeapotModel::TeapotIndices), std::end(TeapotModel::TeapotIndices));
+      return true;
+    }
+    std::string error;
+    bool isLoaded = false;
+    if (EndsWith(opt.input, ".obj"))
+    {
+      isLoaded = ImportObj(opt.input, mesh, error);
+    }
+    else if (EndsWith(opt.input, ".gltf") || EndsWith(opt.input, ".glb"))
+    {
+      isLoaded = ImportGltf(opt.input, mesh, error);
+    }
+    else
+    {
+      error = "unknown file type: " + opt.input;
+    }
+    if (!isLoaded)
+    {
+      std::cerr << error << std::endl;
+    }
+    return isLoaded;
+  }
+
+  bool ParseOptions(int argc, char* argv[], Options& opt)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      if (arg == "-o" && i + 1 < argc)
+      {
+        opt.output = argv[++i];
+      }
+      else if (arg == "--format" && i + 1 < argc)
+      {
+        std::string format = argv[++i];
+        if (format == "compact" || format == "float")
+        {
+          opt.isCompact = format == "compact";
+        }
+        else
+        {
+          std::cerr << "unknown format: " << format << std::endl;
+          return false;
+        }
+      }
+      else if (arg == "--no-optimize")
+      {
+        opt.isOptimizeEnabled = false;
+      }
+      else if (arg == "--no-lod")
+      {
+        opt.isLodEnabled = false;
+      }
+      else if (arg == "--teapot")
+      {
+        opt.isTeapot = true;
+      }
+      else if (arg.compare(0, 1, "-") == 0)
+      {
+        std::cerr << "unknown option: " << arg << std::endl;
+        return false;
+      }
+      else if (opt.input.empty())
+      {
+        opt.input = arg;
+      }
+      else
+      {
+        std::cerr << "multiple inputs are not supported." << std::endl;
+        return false;
+      }
+    }
+    return (opt.isTeapot != !opt.input.empty()) && !opt.output.empty();
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options opt;
+  if (!ParseOptions(argc, argv, opt))
+  {
+    std::cerr <<
+      "usage: MeshCooker <input.obj|.gltf|.glb> -o <output.mesh> [--format compact|float] [--no-optimize] [--no-lod]\n"
+      "       MeshCooker --teapot -o <output.mesh> [...]\n";
+    return 2;
+  }
+
+  ImportedMesh mesh;
+  if (!LoadInput(opt, mesh))
+  {
+    return 1;
+  }
+  auto& vertices = mesh.vertices;
+  auto& indices = mesh.indices;
+  indices.resize(indices.size() / 3 * 3);
+
+  // 実行時に CreateSimpleModel が行う並べ替えをここで済ませておく.
+  book_util::MeshOptimizationResult optimization{};
+  if (opt.isOptimizeEnabled)
+  {
+    optimization = book_util::OptimizeMesh(vertices, indices);
+  }
+  const auto vertexCount = uint32_t(vertices.size());
+  const auto indexCount = uint32_t(indices.size());
+
+  // 詳細度は実行時の CreateCompactModel と同じく作り、インデックスは LOD 0 の後ろへ続けて格納する.
+  MeshFile::Desc desc{};
+  std::vector<uint32_t> lodIndices;
+  if (opt.isLodEnabled)
+  {
+    book_util::BuildLodChain(desc.lods, lodIndices, indices.data(), indexCount, vertices.data(), vertexCount,
+      uint32_t(sizeof(ImportedVertex)), uint32_t(offsetof(ImportedVertex, normal)));
+  }
+  else
+  {
+    desc.lods.push_back(MeshFile::Lod{ 0, indexCount, 0.0f, 0 });
+    lodIndices = indices;
+  }
+  const auto totalIndexCount = uint32_t(lodIndices.size());
+
+  desc.vertexCount = vertexCount;
+  desc.indexCount = totalIndexCount;
+  desc.bounds = book_util::ComputeAabb(vertices.data(), vertexCount, uint32_t(sizeof(ImportedVertex)));
+  desc.isCompact = opt.isCompact;
+  desc.isOptimized = opt.isOptimizeEnabled;
+  desc.quantization = book_util::ComputePositionQuantization(desc.bounds);
+
+  // 頂点入力の記述は実行時と同じものを使い、ファイルにはその location、形式、オフセットを記録する.
+  std::vector<book_util::CompactVertex> compactVertices;
+  book_util::VertexInputLayout layout;
+  if (opt.isCompact)
+  {
+    compactVertices.resize(vertexCount);
+    book_util::QuantizeVertices(compactVertices.data(), vertices.data(), vertexCount, uint32_t(sizeof(ImportedVertex)),
+      uint32_t(offsetof(ImportedVertex, normal)), desc.quantization);
+    layout = book_util::GetCompactVertexInputLayout();
+    desc.vertices = compactVertices.data();
+  }
+  else
+  {
+    layout = book_util::GetFloatVertexInputLayout(uint32_t(sizeof(ImportedVertex)), uint32_t(offsetof(ImportedVertex, normal)));
+    desc.vertices = vertices.data();
+  }
+  desc.vertexStride = layout.binding.stride;
+  for (const auto& attribute : layout.attributes)
+  {
+    desc.attributes.push_back(MeshFile::Attribute{ attribute.location, attribute.format, attribute.offset });
+  }
+
+  std::vector<uint16_t> indices16;
+  if (book_util::CanUse16BitIndices(vertexCount))
+  {
+    indices16.resize(totalIndexCount);
+    book_util::PackIndices16(indices16.data(), lodIndices.data(), totalIndexCount);
+    desc.indexType = VK_INDEX_TYPE_UINT16;
+    desc.indices = indices16.data();
+  }
+  else
+  {
+    desc.indexType = VK_INDEX_TYPE_UINT32;
+    desc.indices = lodIndices.data();
+  }
+
+  // メッシュレットは並べ替え後の LOD 0 のインデックスの順に作るため、インデックスバッファの範囲と一致する.
+  book_util::MeshletMesh meshlets;
+  book_util::BuildMeshlets(meshlets, indices.data(), indexCount, vertices.data(), vertexCount, uint32_t(sizeof(ImportedVertex)));
+  desc.meshlets = meshlets.meshlets;
+  desc.meshletVertices = meshlets.vertices;
+  desc.meshletTriangles = meshlets.triangles;
+
+  if (!MeshFile::Write(opt.output, desc))
+  {
+    std::cerr << "cannot write " << opt.output << std::endl;
+    return 1;
+  }
+
+  // 書き出したファイルを読み直して確認する.
+  MeshFile file;
+  if (!file.Open(opt.output))
+  {
+    std::cerr << "verification failed: " << opt.output << std::endl;
+    return 1;
+  }
+  std::cout << opt.output << ": vertices " << file.GetVertexCount() << " (" << file.GetVertexStride() << " bytes)"
+    << " triangles " << file.GetLods()[0].indexCount / 3
+    << " indices " << (file.GetIndexType() == VK_INDEX_TYPE_UINT16 ? 16 : 32) << "bit"
+    << " meshlets " << file.GetMeshletCount()
+    << " lods " << file.GetLodCount();
+  if (opt.isOptimizeEnabled)
+  {
+    std::cout << " acmr " << optimization.before.acmr << " -> " << optimization.after.acmr;
+  }
+  std::cout << std::endl;
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include "HelloGeometryShaderApp.h"
+#include "CubemapRenderingApp.h"
+#include "TessellateTeapotApp.h"
+#include "TessellateGroundApp.h"
+#include "ComputeFilterApp.h"
+#include "SampleRunner.h"
+
+// 全サンプルをまとめた実行ファイル.
+// 例: SampleRunner --sample TessellateGround --headless --frames 500 --warmup 50 --summary result.json
+int main(int argc, char* argv[])
+{
+  SampleRunner runner;
+  runner.Register<HelloGeometryShaderApp>("HelloGeometryShader", "HelloGeometryShader", 800, 600, "03_HelloGeometryShader");
+  runner.Register<CubemapRenderingApp>("CubemapRendering", "CubemapRendering", 800, 600, "04_CubemapRendering");
+  runner.Register<TessellateTeapotApp>("TessellateTeapot", "TessellateTeapot", 800, 600, "06_TessellateTeapot");
+  runner.Register<TessellateGroundApp>("TessellateGround", "GroundTessellation", 800, 600, "07_TessellateGround");
+  runner.Register<ComputeFilterApp>("ComputeFilter", "ComputeFilter", 1280, 720, "09_ComputeFilter");
+  return runner.Run(argc, argv);
+}
@@ -0,0 +1,602 @@
+#include "KtxTexture.h"
+#include "TextureCache.h"
+#include "BlockCompressor.h"
+#include "VirtualTexture.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstring>
+#include <cmath>
+
+// 画像ファイルを KTX2 形式へ変換する.
+//  TextureCooker <input> -o <output.ktx2> [options]
+//  TextureCooker --cube <+x> <-x> <+y> <-y> <+z> <-z> -o <output.ktx2> [options]
+//  TextureCooker --array <input>... -o <output.ktx2> [options]
+//  TextureCooker <heightmap> -o <output.vtex> --virtual <tileSize> [--upscale <n>]
+//
+//  --format <rgba8|rgba8_srgb|rg8|r8|r16|bc1|bc1_srgb|bc4|bc5|bc7|bc7_srgb>  出力形式(既定 rgba8)
+//                                       r16 は 16 ビットで読み込んだ R のみを格納する(ミップマップは実行時に作成する).
+//  --swizzle <xxxx>                     出力の各チャンネルに入れる入力のチャンネル(r,g,b,a,0,1)
+//                                       例えば rb01 は R と B を 2 チャンネルの形式へ格納する.
+//  --mips                               1x1 までのミップマップを含める
+//  --mip-filter <box|kaiser>            ミップマップの縮小フィルタ(既定 box)
+//  --virtual <tileSize>                 ハイトマップを仮想テクスチャのタイルファイル(R16)へ変換する
+//  --upscale <n>                        仮想テクスチャの一辺を入力の n 倍とし、細部をノイズで補う(既定 1)
+namespace
+{
+  struct Options
+  {
+    std::vector<std::string> inputs;
+    std::string output;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    uint32_t components = 4;
+    bool is16Bit = false;
+    bool isCompressed = false;
+    book_util::BlockFormat blockFormat = book_util::BlockFormat::BC1;
+    std::string swizzle;
+    bool isCube = false;
+    bool isArray = false;
+    bool withMipmaps = false;
+    book_util::MipmapFilter mipmapFilter = book_util::MipmapFilter::Box;
+    uint32_t virtualTileSize = 0;
+    uint32_t upscale = 1;
+  };
+
+  bool ParseBlockFormat(const std::string& format, Options& opt)
+  {
+    struct Entry
+    {
+      const char* name;
+      VkFormat format;
+      book_util::BlockFormat blockFormat;
+    };
+    static const Entry entries[] = {
+      { "bc1",      VK_FORMAT_BC1_RGB_UNORM_BLOCK, book_util::BlockFormat::BC1 },
+      { "bc1_srgb", VK_FORMAT_BC1_RGB_SRGB_BLOCK,  book_util::BlockFormat::BC1 },
+      { "bc4",      VK_FORMAT_BC4_UNORM_BLOCK,     book_util::BlockFormat::BC4 },
+      { "bc5",      VK_FORMAT_BC5_UNORM_BLOCK,     book_util::BlockFormat::BC5 },
+      { "bc7",      VK_FORMAT_BC7_UNORM_BLOCK,     book_util::BlockFormat::BC7 },
+      { "bc7_srgb", VK_FORMAT_BC7_SRGB_BLOCK,      book_util::BlockFormat::BC7 },
+    };
+    for (const auto& entry : entries)
+    {
+      if (format == entry.name)
+      {
+        // 圧縮は RGBA8 から行う.
+        opt.format = entry.format;
+        opt.components = 4;
+        opt.blockFormat = entry.blockFormat;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // 入力のチャンネルを並べ替える. swizzle[i] が出力のチャンネル i に入れる値.
+  void ApplySwizzle(uint8_t* pixels, size_t pixelCount, uint32_t components, const std::string& swizzle)
+  {
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+      uint8_t* p = pixels + i * components;
+      uint8_t src[4] = { 0, 0, 0, 255 };
+      memcpy(src, p, components);
+      for (uint32_t c = 0; c < components; ++c)
+      {
+        switch (swizzle[c])
+        {
+        case 'r': p[c] = src[0]; break;
+        case 'g': p[c] = src[1]; break;
+        case 'b': p[c] = src[2]; break;
+        case 'a': p[c] = src[3]; break;
+        case '0': p[c] = 0; break;
+        default:  p[c] = 255; break;
+        }
+      }
+    }
+  }
+
+  // 並べ替えた後の画像を元のチャンネルとして参照するための KTXswizzle を作る.
+  // 格納されていないチャンネルは RGB が 0、A が 1 となる.
+  std::string CreateKtxSwizzle(const std::string& swizzle, uint32_t storedChannels)
+  {
+    static const char channelNames[] = "rgba";
+    std::string result = "0001";
+    for (uint32_t c = 0; c < storedChannels; ++c)
+    {
+      auto pos = std::string(channelNames).find(swizzle[c]);
+      if (pos != std::string::npos)
+      {
+        result[pos] = channelNames[c];
+      }
+    }
+    return result;
+  }
+
+  uint32_t GetStoredChannels(const Options& opt)
+  {
+    if (!opt.isCompressed)
+    {
+      return opt.components;
+    }
+    switch (opt.blockFormat)
+    {
+    case book_util::BlockFormat::BC4: return 1;
+    case book_util::BlockFormat::BC5: return 2;
+    case book_util::BlockFormat::BC1: return 3;
+    default: return 4;
+    }
+  }
+
+  // 圧縮後の画像を展開して元の画像との PSNR を求める.
+  double CalcPsnr(const uint8_t* original, const uint8_t* compressed, uint32_t width, uint32_t height,
+    book_util::BlockFormat format, uint32_t channels)
+  {
+    std::vector<uint8_t> decoded(size_t(width) * height * 4);
+    if (!book_util::DecompressImage(compressed, width, height, format, decoded.data()))
+    {
+      return 0.0;
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < size_t(width) * height; ++i)
+    {
+      for (uint32_t c = 0; c < channels; ++c)
+      {
+        double d = double(original[i * 4 + c]) - decoded[i * 4 + c];
+        sum += d * d;
+      }
+    }
+    double mse = sum / (double(width) * height * channels);
+    return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+  }
+
+  // 仮想テクスチャのハイトマップ.
+  // 入力を双三次補間で拡大し、入力の解像度より細かい起伏を値ノイズの fBm で加える.
+  // 各レベルはそのレベルの解像度で表現できる周波数までを直接計算するため、レベル 0 全体をメモリに置かない.
+  class VirtualHeightMap
+  {
+  public:
+    VirtualHeightMap(const uint16_t* src, uint32_t width, uint32_t size)
+      : m_size(size)
+    {
+      // 粗いレベルで折り返しが出ないよう、入力を 2x2 平均で縮小したものも用意する.
+      std::vector<float> level(src, src + size_t(width) * width);
+      for (auto& v : level)
+      {
+        v /= 65535.0f;
+      }
+      m_sources.push_back(std::move(level));
+      m_sourceSizes.push_back(width);
+      while (m_sourceSizes.back() > 1)
+      {
+        const auto& s = m_sources.back();
+        auto w = m_sourceSizes.back(), hw = w / 2;
+        std::vector<float> half(size_t(hw) * hw);
+        for (uint32_t y = 0; y < hw; ++y)
+        {
+          for (uint32_t x = 0; x < hw; ++x)
+          {
+            half[y * hw + x] = 0.25f * (s[(2 * y) * w + 2 * x] + s[(2 * y) * w + 2 * x + 1] +
+              s[(2 * y + 1) * w + 2 * x] + s[(2 * y + 1) * w + 2 * x + 1]);
+          }
+        }
+        m_sources.push_back(std::move(half));
+        m_sourceSizes.push_back(hw);
+      }
+    }
+
+    // levelSize 四方のレベルのテクセル中心 (u, v) での高さ [0,1].
+    float Sample(float u, float v, uint32_t levelSize) const
+    {
+      uint32_t index = 0;
+      while (index + 1 < m_sourceSizes.size() && m_sourceSizes[index] > levelSize)
+      {
+        ++index;
+      }
+      float height = SampleBicubic(m_sources[index], m_sourceSizes[index], u, v);
+
+      // 入力の 1 テクセルを 1 周期とする周波数から、レベルで表現できる周波数まで重ねる.
+      const float DetailAmplitude = 0.004f;
+      float amplitude = DetailAmplitude;
+      for (uint32_t octave = 0; octave < 16; ++octave)
+      {
+        float frequency = float(m_sourceSizes[0]) * float(1u << octave);
+        float ratio = frequency / float(levelSize);
+        float weight = (std::min)((std::max)((0.5f - ratio) / 0.25f, 0.0f), 1.0f);
+        if (weight <= 0.0f)
+        {
+          break;
+        }
+        height += weight * amplitude * ValueNoise(u * frequency, v * frequency, octave);
+        amplitude *= 0.5f;
+      }
+      return (std::min)((std::max)(height, 0.0f), 1.0f);
+    }
+
+    uint32_t GetSize() const { return m_size; }
+
+  private:
+    static float SampleBicubic(const std::vector<float>& src, uint32_t width, float u, float v)
+    {
+      float x = u * width - 0.5f, y = v * width - 0.5f;
+      int ix = int(std::floor(x)), iy = int(std::floor(y));
+      float fx = x - ix, fy = y - iy;
+      auto fetch = [&](int px, int py)
+      {
+        px = (std::min)((std::max)(px, 0), int(width) - 1);
+        py = (std::min)((std::max)(py, 0), int(width) - 1);
+        return src[size_t(py) * width + px];
+      };
+      auto cubic = [](float p0, float p1, float p2, float p3, float t)
+      {
+        // Catmull-Rom.
+        return p1 + 0.5f * t * (p2 - p0 + t * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + t * (3.0f * (p1 - p2) + p3 - p0)));
+      };
+      float rows[4];
+      for (int j = 0; j < 4; ++j)
+      {
+        rows[j] = cubic(fetch(ix - 1, iy + j - 1), fetch(ix, iy + j - 1), fetch(ix + 1, iy + j - 1), fetch(ix + 2, iy + j - 1), fx);
+      }
+      return cubic(rows[0], rows[1], rows[2], rows[3], fy);
+    }
+
+    static float Hash(int x, int y, uint32_t seed)
+    {
+      uint32_t h = uint32_t(x) * 0x8DA6B343u ^ uint32_t(y) * 0xD8163841u ^ seed * 0xCB1AB31Fu;
+      h ^= h >> 13;
+      h *= 0x5BD1E995u;
+      h ^= h >> 15;
+      return float(h & 0xFFFF) / 32767.5f - 1.0f;
+    }
+
+    static float ValueNoise(float x, float y, uint32_t seed)
+    {
+      int ix = int(std::floor(x)), iy = int(std::floor(y));
+      float fx = x - ix, fy = y - iy;
+      // 5 次の補間で格子上でも傾きが連続になるようにする.
+      float sx = fx * fx * fx * (fx * (fx * 6.0f - 15.0f) + 10.0f);
+      float sy = fy * fy * fy * (fy * (fy * 6.0f - 15.0f) + 10.0f);
+      float a = Hash(ix, iy, seed), b = Hash(ix + 1, iy, seed);
+      float c = Hash(ix, iy + 1, seed), d = Hash(ix + 1, iy + 1, seed);
+      return (a + (b - a) * sx) + ((c + (d - c) * sx) - (a + (b - a) * sx)) * sy;
+    }
+
+    uint32_t m_size;
+    std::vector<std::vector<float>> m_sources;
+    std::vector<uint32_t> m_sourceSizes;
+  };
+
+  int CookVirtualTexture(const Options& opt)
+  {
+    int w, h;
+    auto pImage = stbi_load_16(opt.inputs[0].c_str(), &w, &h, nullptr, 1);
+    if (pImage == nullptr)
+    {
+      std::cerr << "cannot load " << opt.inputs[0] << std::endl;
+      return 1;
+    }
+    std::vector<uint16_t> src(pImage, pImage + size_t(w) * h);
+    stbi_image_free(pImage);
+
+    VirtualTextureFile::Desc desc;
+    desc.format = VK_FORMAT_R16_UNORM;
+    desc.width = desc.height = uint32_t(w) * opt.upscale;
+    desc.tileSize = opt.virtualTileSize;
+    desc.border = 1;  // 双線形補間で隣のテクセルを参照する分.
+    const auto pageCount = desc.width / desc.tileSize;
+    if (w != h || (w & (w - 1)) != 0 || desc.width % desc.tileSize != 0 || (pageCount & (pageCount - 1)) != 0)
+    {
+      std::cerr << "--virtual requires a square power-of-two image and tile size." << std::endl;
+      return 1;
+    }
+
+    VirtualHeightMap heightMap(src.data(), uint32_t(w), desc.width);
+    const auto extent = desc.tileSize + desc.border * 2;
+    auto generate = [&](uint32_t level, uint32_t x, uint32_t y, void* dst)
+    {
+      const uint32_t levelSize = desc.width >> level;
+      auto texels = static_cast<uint16_t*>(dst);
+      for (uint32_t j = 0; j < extent; ++j)
+      {
+        // 境界のテクセルは隣のページの値(端ではテクスチャの端の値)とする.
+        int ty = (std::min)((std::max)(int(y * desc.tileSize + j) - int(desc.border), 0), int(levelSize) - 1);
+        for (uint32_t i = 0; i < extent; ++i)
+        {
+          int tx = (std::min)((std::max)(int(x * desc.tileSize + i) - int(desc.border), 0), int(levelSize) - 1);
+          float height = heightMap.Sample((tx + 0.5f) / levelSize, (ty + 0.5f) / levelSize, levelSize);
+          texels[j * extent + i] = uint16_t(height * 65535.0f + 0.5f);
+        }
+      }
+    };
+    if (!VirtualTextureFile::Write(opt.output, desc, generate))
+    {
+      std::cerr << "cannot write " << opt.output << std::endl;
+      return 1;
+    }
+
+    // 書き出したファイルを読み直して確認する.
+    VirtualTextureFile file;
+    if (!file.Open(opt.output))
+    {
+      std::cerr << "verification failed: " << opt.output << std::endl;
+      return 1;
+    }
+    std::cout << opt.output << ": " << desc.width << "x" << desc.height << " tile " << desc.tileSize
+      << " levels " << file.GetLevelCount() << " " << file.GetTotalBytes() / (1024 * 1024) << "MB" << std::endl;
+    return 0;
+  }
+
+  bool ParseOptions(int argc, char* argv[], Options& opt)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      if (arg == "-o" && i + 1 < argc)
+      {
+        opt.output = argv[++i];
+      }
+      else if (arg == "--format" && i + 1 < argc)
+      {
+        std::string format = argv[++i];
+        if (format == "rgba8")
+        {
+          opt.format = VK_FORMAT_R8G8B8A8_UNORM;
+          opt.components = 4;
+        }
+        else if (format == "rgba8_srgb")
+        {
+          opt.format = VK_FORMAT_R8G8B8A8_SRGB;
+          opt.components = 4;
+        }
+        else if (format == "rg8")
+        {
+          opt.format = VK_FORMAT_R8G8_UNORM;
+          opt.components = 2;
+        }
+        else if (format == "r8")
+        {
+          opt.format = VK_FORMAT_R8_UNORM;
+          opt.components = 1;
+        }
+        else if (format == "r16")
+        {
+          opt.format = VK_FORMAT_R16_UNORM;
+          opt.components = 1;
+          opt.is16Bit = true;
+        }
+        else if (ParseBlockFormat(format, opt))
+        {
+          opt.isCompressed = true;
+        }
+        else
+        {
+          std::cerr << "unknown format: " << format << std::endl;
+          return false;
+        }
+      }
+      else if (arg == "--swizzle" && i + 1 < argc)
+      {
+        opt.swizzle = argv[++i];
+        if (opt.swizzle.size() != 4 || opt.swizzle.find_first_not_of("rgba01") != std::string::npos)
+        {
+          std::cerr << "invalid swizzle: " << opt.swizzle << std::endl;
+          return false;
+        }
+      }
+      else if (arg == "--mips")
+      {
+        opt.withMipmaps = true;
+      }
+      else if (arg == "--mip-filter" && i + 1 < argc)
+      {
+        std::string filter = argv[++i];
+        if (filter == "box")
+        {
+          opt.mipmapFilter = book_util::MipmapFilter::Box;
+        }
+        else if (filter == "kaiser")
+        {
+          opt.mipmapFilter = book_util::MipmapFilter::Kaiser;
+        }
+        else
+        {
+          std::cerr << "unknown mipmap filter: " << filter << std::endl;
+          return false;
+        }
+      }
+      else if (arg == "--virtual" && i + 1 < argc)
+      {
+        opt.virtualTileSize = uint32_t(std::stoul(argv[++i]));
+      }
+      else if (arg == "--upscale" && i + 1 < argc)
+      {
+        opt.upscale = uint32_t(std::stoul(argv[++i]));
+      }
+      else if (arg == "--cube")
+      {
+        opt.isCube = true;
+      }
+      else if (arg == "--array")
+      {
+        opt.isArray = true;
+      }
+      else if (arg.compare(0, 1, "-") == 0)
+      {
+        std::cerr << "unknown option: " << arg << std::endl;
+        return false;
+      }
+      else
+      {
+        opt.inputs.push_back(arg);
+      }
+    }
+    if (opt.inputs.empty() || opt.output.empty())
+    {
+      return false;
+    }
+    if (opt.isCube && opt.inputs.size() != 6)
+    {
+      std::cerr << "--cube requires 6 images." << std::endl;
+      return false;
+    }
+    if (!opt.isCube && !opt.isArray && opt.inputs.size() != 1)
+    {
+      std::cerr << "use --array for multiple images." << std::endl;
+      return false;
+    }
+    if (opt.is16Bit && (opt.withMipmaps || !opt.swizzle.empty()))
+    {
+      std::cerr << "r16 does not support --mips and --swizzle." << std::endl;
+      return false;
+    }
+    if (opt.virtualTileSize != 0 && (opt.isCube || opt.isArray || opt.upscale == 0))
+    {
+      std::cerr << "--virtual requires a single image." << std::endl;
+      return false;
+    }
+    return true;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options opt;
+  if (!ParseOptions(argc, argv, opt))
+  {
+    std::cerr <<
+      "usage: TextureCooker <input> -o <output.ktx2> [--format rgba8|rgba8_srgb|rg8|r8|r16|bc1|bc1_srgb|bc4|bc5|bc7|bc7_srgb]\n"
+      "       [--swizzle rgba] [--mips [--mip-filter box|kaiser]]\n"
+      "       TextureCooker --cube <+x> <-x> <+y> <-y> <+z> <-z> -o <output.ktx2> [...]\n"
+      "       TextureCooker --array <input>... -o <output.ktx2> [...]\n"
+      "       TextureCooker <heightmap> -o <output.vtex> --virtual <tileSize> [--upscale n]\n";
+    return 2;
+  }
+  if (opt.virtualTileSize != 0)
+  {
+    return CookVirtualTexture(opt);
+  }
+
+  // デコードとミップマップの作成はテクスチャキャッシュと同じ処理を使う. キャッシュファイルは作らない.
+  // 16 ビットの画像はキャッシュが扱わないため、ここで直接デコードする.
+  TextureCache decoder;
+  decoder.SetDirectory(std::string());
+  std::vector<TextureCache::Image> images(opt.is16Bit ? 0 : opt.inputs.size());
+  std::vector<uint8_t> pixels16;
+  uint32_t width = 0, height = 0;
+  for (size_t i = 0; opt.is16Bit && i < opt.inputs.size(); ++i)
+  {
+    int w, h;
+    auto pImage = stbi_load_16(opt.inputs[i].c_str(), &w, &h, nullptr, 1);
+    if (pImage == nullptr)
+    {
+      std::cerr << "cannot load " << opt.inputs[i] << std::endl;
+      return 1;
+    }
+    if (i > 0 && (uint32_t(w) != width || uint32_t(h) != height))
+    {
+      stbi_image_free(pImage);
+      std::cerr << "image size mismatch: " << opt.inputs[i] << std::endl;
+      return 1;
+    }
+    width = uint32_t(w);
+    height = uint32_t(h);
+    auto src = reinterpret_cast<const uint8_t*>(pImage);
+    pixels16.insert(pixels16.end(), src, src + size_t(width) * height * sizeof(uint16_t));
+    stbi_image_free(pImage);
+  }
+  for (size_t i = 0; i < images.size(); ++i)
+  {
+    if (!decoder.Load(opt.inputs[i], opt.components, images[i], opt.withMipmaps, opt.mipmapFilter))
+    {
+      std::cerr << "cannot load " << opt.inputs[i] << std::endl;
+      return 1;
+    }
+    if (images[i].GetWidth() != images[0].GetWidth() || images[i].GetHeight() != images[0].GetHeight())
+    {
+      std::cerr << "image size mismatch: " << opt.inputs[i] << std::endl;
+      return 1;
+    }
+  }
+
+  // レベルごとに、レイヤー(面)の画像を順に並べる. 圧縮形式では各画像を圧縮してから並べる.
+  if (!images.empty())
+  {
+    width = images[0].GetWidth();
+    height = images[0].GetHeight();
+  }
+  const auto levelCount = opt.is16Bit ? 1u : images[0].GetLevelCount();
+  const auto storedChannels = GetStoredChannels(opt);
+  std::vector<std::vector<uint8_t>> levelData(levelCount);
+  std::vector<KtxTexture::LevelData> levels(levelCount);
+  std::vector<uint8_t> pixels, compressed;
+  double minPsnr = 99.0;
+  for (uint32_t level = 0; level < levelCount && opt.is16Bit; ++level)
+  {
+    levels[level] = KtxTexture::LevelData{ pixels16.data(), pixels16.size() };
+  }
+  for (uint32_t level = 0; level < levelCount && !opt.is16Bit; ++level)
+  {
+    auto& data = levelData[level];
+    for (const auto& image : images)
+    {
+      const auto& info = image.GetLevel(level);
+      auto src = image.GetPixels(level);
+      pixels.assign(src, src + size_t(info.size));
+      if (!opt.swizzle.empty())
+      {
+        ApplySwizzle(pixels.data(), size_t(info.width) * info.height, opt.components, opt.swizzle);
+      }
+      if (opt.isCompressed)
+      {
+        compressed.resize(book_util::GetCompressedSize(opt.blockFormat, info.width, info.height));
+        book_util::CompressImage(pixels.data(), info.width, info.height, opt.blockFormat, compressed.data());
+        if (level == 0)
+        {
+          minPsnr = (std::min)(minPsnr, CalcPsnr(pixels.data(), compressed.data(), info.width, info.height, opt.blockFormat, storedChannels));
+        }
+        data.insert(data.end(), compressed.begin(), compressed.end());
+      }
+      else
+      {
+        data.insert(data.end(), pixels.begin(), pixels.end());
+      }
+    }
+    levels[level] = KtxTexture::LevelData{ data.data(), data.size() };
+  }
+
+  KtxTexture::Desc desc;
+  desc.format = opt.format;
+  desc.width = width;
+  desc.height = height;
+  desc.layerCount = opt.isArray ? uint32_t(opt.inputs.size()) : 0;
+  desc.faceCount = opt.isCube ? 6 : 1;
+  if (!opt.swizzle.empty())
+  {
+    desc.swizzle = CreateKtxSwizzle(opt.swizzle, storedChannels);
+  }
+  if (!KtxTexture::Write(opt.output, desc, levels))
+  {
+    std::cerr << "cannot write " << opt.output << std::endl;
+    return 1;
+  }
+
+  // 書き出したファイルを読み直して確認する.
+  KtxTexture ktx;
+  if (!ktx.Open(opt.output))
+  {
+    std::cerr << "verification failed: " << opt.output << std::endl;
+    return 1;
+  }
+  std::cout << opt.output << ": " << ktx.GetWidth() << "x" << ktx.GetHeight()
+    << " levels " << ktx.GetLevelCount() << " layers " << ktx.GetLayerCount()
+    << " faces " << ktx.GetFaceCount();
+  if (opt.isCompressed)
+  {
+    std::cout << " psnr " << minPsnr << "dB (" << book_util::GetBlockCompressorInstructionSet() << ")";
+  }
+  std::cout << std::endl;
+  return 0;
+}
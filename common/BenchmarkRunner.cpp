@@ -0,0 +1,208 @@
+#include "BenchmarkRunner.h"
+#include "Statistics.h"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+
+const volatile char* volatile BenchmarkRunner::s_sink = nullptr;
+
+void BenchmarkRunner::Register(const std::string& name, BenchmarkFunc func)
+{
+  m_benchmarks.push_back(BenchmarkInfo{ name, func });
+}
+
+std::string BenchmarkRunner::GetDataPath(const std::string& fileName) const
+{
+  if (m_dataRoot.empty())
+  {
+    return fileName;
+  }
+  return m_dataRoot + "/" + fileName;
+}
+
+bool BenchmarkRunner::ParseOptions(int argc, char* argv[], Options& opt)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    auto hasValue = (i + 1 < argc);
+    if (arg == "--list")
+    {
+      opt.isList = true;
+    }
+    else if (!hasValue)
+    {
+      std::cerr << "missing value: " << arg << std::endl;
+      return false;
+    }
+    else if (arg == "--filter")
+    {
+      opt.filter = argv[++i];
+    }
+    else if (arg == "--samples")
+    {
+      opt.samples = uint32_t(std::atoi(argv[++i]));
+    }
+    else if (arg == "--warmup")
+    {
+      opt.warmup = uint32_t(std::atoi(argv[++i]));
+    }
+    else if (arg == "--min-time")
+    {
+      opt.minTimeMs = std::atof(argv[++i]);
+    }
+    else if (arg == "--json")
+    {
+      opt.jsonPath = argv[++i];
+    }
+    else if (arg == "--data-root")
+    {
+      m_dataRoot = argv[++i];
+    }
+    else
+    {
+      std::cerr << "unknown option: " << arg << std::endl;
+      return false;
+    }
+  }
+  if (opt.samples == 0)
+  {
+    std::cerr << "--samples must be greater than 0" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void BenchmarkRunner::PrintUsage() const
+{
+  std::cerr <<
+    "usage: [--list] [--filter text] [--samples n] [--warmup n] [--min-time ms]\n"
+    "       [--json file.json] [--data-root dir]\n";
+}
+
+BenchmarkRunner::Result BenchmarkRunner::Measure(const BenchmarkInfo& info, const Options& opt) const
+{
+  using Clock = std::chrono::steady_clock;
+  auto runOnce = [&](uint64_t iterations)
+  {
+    auto start = Clock::now();
+    info.func(iterations);
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+  };
+
+  // 1 サンプルの計測時間が minTime を超えるまで反復回数を増やす.
+  // タイマーの分解能や呼び出しのオーバーヘッドが結果に出ないようにするため.
+  const double minTimeNs = opt.minTimeMs * 1.0e6;
+  uint64_t iterations = 1;
+  for (;;)
+  {
+    auto elapsed = runOnce(iterations);
+    if (elapsed >= minTimeNs || iterations >= (1ull << 40))
+    {
+      break;
+    }
+    double scale = elapsed > 0.0 ? minTimeNs * 1.2 / elapsed : 10.0;
+    scale = (std::min)((std::max)(scale, 2.0), 10.0);
+    iterations = uint64_t(double(iterations) * scale);
+  }
+
+  Result result;
+  result.name = info.name;
+  result.iterations = iterations;
+  for (uint32_t i = 0; i < opt.warmup; ++i)
+  {
+    runOnce(iterations);
+  }
+  result.samples.reserve(opt.samples);
+  for (uint32_t i = 0; i < opt.samples; ++i)
+  {
+    result.samples.push_back(runOnce(iterations) / double(iterations));
+  }
+  return result;
+}
+
+int BenchmarkRunner::Run(int argc, char* argv[])
+{
+  Options opt;
+  if (!ParseOptions(argc, argv, opt))
+  {
+    PrintUsage();
+    return 1;
+  }
+  if (opt.isList)
+  {
+    for (const auto& b : m_benchmarks)
+    {
+      std::cout << b.name << std::endl;
+    }
+    return 0;
+  }
+
+  std::vector<Result> results;
+  try
+  {
+    for (const auto& b : m_benchmarks)
+    {
+      if (!opt.filter.empty() && b.name.find(opt.filter) == std::string::npos)
+      {
+        continue;
+      }
+      results.push_back(Measure(b, opt));
+
+      // 進捗は標準エラーへ出し、標準出力は JSON のみとする.
+      auto sorted = results.back().samples;
+      std::sort(sorted.begin(), sorted.end());
+      std::cerr << std::left << std::setw(40) << b.name << std::right
+        << std::fixed << std::setprecision(2) << std::setw(14) << book_util::Percentile(sorted, 50.0) << " ns"
+        << std::setw(14) << results.back().iterations << " iterations" << std::endl;
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  if (opt.jsonPath.empty())
+  {
+    WriteResults(std::cout, opt, results);
+  }
+  else
+  {
+    std::ofstream outfile(opt.jsonPath);
+    if (!outfile)
+    {
+      std::cerr << "cannot write results: " << opt.jsonPath << std::endl;
+      return 1;
+    }
+    WriteResults(outfile, opt, results);
+  }
+  return 0;
+}
+
+void BenchmarkRunner::WriteResults(std::ostream& os, const Options& opt, const std::vector<Result>& results) const
+{
+  os << std::fixed << std::setprecision(4);
+  os << "{\n";
+  os << "  \"samplesPerBenchmark\": " << opt.samples << ",\n";
+  os << "  \"warmupSamples\": " << opt.warmup << ",\n";
+  os << "  \"minTimeMs\": " << opt.minTimeMs << ",\n";
+  os << "  \"benchmarks\": {";
+  bool isFirst = true;
+  for (const auto& r : results)
+  {
+    os << (isFirst ? "\n" : ",\n") << "    \"" << book_util::EscapeJson(r.name) << "\": {\n";
+    os << "      \"iterations\": " << r.iterations << ",\n";
+    os << "      \"ns\": ";
+    book_util::WriteJsonStatistics(os, r.samples, "      ", true);
+    os << "\n    }";
+    isFirst = false;
+  }
+  os << (isFirst ? "}\n" : "\n  }\n");
+  os << "}\n";
+}
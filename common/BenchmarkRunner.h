@@ -0,0 +1,77 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include <iosfwd>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ホスト側処理のマイクロベンチマーク.
+// 1 サンプルが一定時間以上になるよう反復回数を調整してから複数回計測し、
+// 1 反復あたりの時間(ナノ秒)の分布を JSON で出力する.
+//
+//  --list                 登録されているベンチマークの一覧
+//  --filter <text>        名前に text を含むものだけ実行
+//  --samples <n>          計測サンプル数
+//  --warmup <n>           計測前に捨てるサンプル数
+//  --min-time <ms>        1 サンプルあたりの最小計測時間
+//  --json <file>          計測結果の出力先(省略時は標準出力)
+//  --data-root <dir>      データファイルを探す基準位置
+class BenchmarkRunner
+{
+public:
+  // iterations 回処理を行う関数.
+  using BenchmarkFunc = std::function<void(uint64_t iterations)>;
+
+  void Register(const std::string& name, BenchmarkFunc func);
+  int Run(int argc, char* argv[]);
+
+  // 初期化時に指定されたデータの基準位置からのパスを返す.
+  std::string GetDataPath(const std::string& fileName) const;
+
+  // 計算結果が使われないことによる最適化での削除を防ぐ.
+  template<class T>
+  static void DoNotOptimize(const T& value)
+  {
+#ifdef _MSC_VER
+    s_sink = reinterpret_cast<const volatile char*>(&value);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+  }
+private:
+  struct BenchmarkInfo
+  {
+    std::string name;
+    BenchmarkFunc func;
+  };
+  struct Options
+  {
+    std::string filter;
+    uint32_t samples = 20;
+    uint32_t warmup = 3;
+    double minTimeMs = 10.0;
+    std::string jsonPath;
+    bool isList = false;
+  };
+  struct Result
+  {
+    std::string name;
+    uint64_t iterations;
+    std::vector<double> samples;  // 1 反復あたりのナノ秒.
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& opt);
+  void PrintUsage() const;
+  Result Measure(const BenchmarkInfo& info, const Options& opt) const;
+  void WriteResults(std::ostream& os, const Options& opt, const std::vector<Result>& results) const;
+
+  std::vector<BenchmarkInfo> m_benchmarks;
+  std::string m_dataRoot = "..";
+
+  static const volatile char* volatile s_sink;
+};
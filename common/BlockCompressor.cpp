@@ -0,0 +1,773 @@
+#include "BlockCompressor.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BLOCK_COMPRESSOR_USE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  using book_util::BlockFormat;
+
+  const uint32_t BlockPixels = 16;
+
+  // 画像からブロック 1 つ分の RGBA を取り出す.
+  void LoadBlock(const uint8_t* src, uint32_t width, uint32_t height, uint32_t bx, uint32_t by, uint8_t* block)
+  {
+    const uint32_t x0 = bx * 4, y0 = by * 4;
+    if (x0 + 4 <= width && y0 + 4 <= height)
+    {
+      for (uint32_t y = 0; y < 4; ++y)
+      {
+        memcpy(block + y * 16, src + (size_t(y0 + y) * width + x0) * 4, 16);
+      }
+      return;
+    }
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+      const uint32_t sy = (std::min)(y0 + y, height - 1);
+      for (uint32_t x = 0; x < 4; ++x)
+      {
+        const uint32_t sx = (std::min)(x0 + x, width - 1);
+        memcpy(block + (y * 4 + x) * 4, src + (size_t(sy) * width + sx) * 4, 4);
+      }
+    }
+  }
+
+  // 主成分の方向. 共分散行列のべき乗法で求める.
+  template<int N>
+  void PrincipalAxis(const float (&cov)[N][N], float (&axis)[N])
+  {
+    for (int i = 0; i < N; ++i)
+    {
+      axis[i] = 1.0f;
+    }
+    for (int iter = 0; iter < 8; ++iter)
+    {
+      float next[N] = {};
+      float len = 0.0f;
+      for (int i = 0; i < N; ++i)
+      {
+        for (int j = 0; j < N; ++j)
+        {
+          next[i] += cov[i][j] * axis[j];
+        }
+        len = (std::max)(len, std::fabs(next[i]));
+      }
+      if (len < 1e-6f)
+      {
+        return;
+      }
+      for (int i = 0; i < N; ++i)
+      {
+        axis[i] = next[i] / len;
+      }
+    }
+  }
+
+  // 主成分の方向に沿って両端の色を求める. 量子化の誤差を見込んで少し内側へ寄せる.
+  template<int N>
+  void FindEndpoints(const uint8_t* block, float (&e0)[N], float (&e1)[N])
+  {
+    float mean[N] = {};
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      for (int c = 0; c < N; ++c)
+      {
+        mean[c] += block[i * 4 + c];
+      }
+    }
+    for (int c = 0; c < N; ++c)
+    {
+      mean[c] /= float(BlockPixels);
+    }
+    float cov[N][N] = {};
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      for (int a = 0; a < N; ++a)
+      {
+        for (int b = a; b < N; ++b)
+        {
+          cov[a][b] += (block[i * 4 + a] - mean[a]) * (block[i * 4 + b] - mean[b]);
+        }
+      }
+    }
+    for (int a = 0; a < N; ++a)
+    {
+      for (int b = 0; b < a; ++b)
+      {
+        cov[a][b] = cov[b][a];
+      }
+    }
+    float axis[N];
+    PrincipalAxis(cov, axis);
+
+    float tMin = 1e30f, tMax = -1e30f;
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      float t = 0.0f;
+      for (int c = 0; c < N; ++c)
+      {
+        t += (block[i * 4 + c] - mean[c]) * axis[c];
+      }
+      tMin = (std::min)(tMin, t);
+      tMax = (std::max)(tMax, t);
+    }
+    const float inset = (tMax - tMin) / 32.0f;
+    tMin += inset;
+    tMax -= inset;
+    for (int c = 0; c < N; ++c)
+    {
+      e0[c] = (std::min)((std::max)(mean[c] + axis[c] * tMax, 0.0f), 255.0f);
+      e1[c] = (std::min)((std::max)(mean[c] + axis[c] * tMin, 0.0f), 255.0f);
+    }
+  }
+
+  // ---- BC1 ----
+
+  uint16_t PackRgb565(const float (&c)[3])
+  {
+    uint32_t r = uint32_t(c[0] * 31.0f / 255.0f + 0.5f);
+    uint32_t g = uint32_t(c[1] * 63.0f / 255.0f + 0.5f);
+    uint32_t b = uint32_t(c[2] * 31.0f / 255.0f + 0.5f);
+    return uint16_t((r << 11) | (g << 5) | b);
+  }
+
+  void UnpackRgb565(uint16_t v, int (&c)[4])
+  {
+    int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+    c[0] = (r << 3) | (r >> 2);
+    c[1] = (g << 2) | (g >> 4);
+    c[2] = (b << 3) | (b >> 2);
+    c[3] = 255;
+  }
+
+  void Bc1Palette(uint16_t c0, uint16_t c1, int (&palette)[4][4])
+  {
+    UnpackRgb565(c0, palette[0]);
+    UnpackRgb565(c1, palette[1]);
+    for (int c = 0; c < 3; ++c)
+    {
+      if (c0 > c1)
+      {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+      }
+      else
+      {
+        palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+        palette[3][c] = 0;
+      }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = (c0 > c1) ? 255 : 0;
+  }
+
+  // 各ピクセルに最も近いパレットの番号を選び、二乗誤差の合計を返す.
+  // useAlpha が false の場合は RGB のみで比べる.
+  uint32_t SelectNearest(const uint8_t* block, const int (*palette)[4], int paletteCount, bool useAlpha, uint8_t* indices)
+  {
+#ifdef BLOCK_COMPRESSOR_USE_SIMD
+    // 2 ピクセルずつ 16 ビットへ広げ、二乗誤差を 32 ビットで求める.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i channelMask = useAlpha ? _mm_set1_epi16(-1) : _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    __m128i px[8];
+    for (int j = 0; j < 4; ++j)
+    {
+      __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + j * 16));
+      px[j * 2 + 0] = _mm_and_si128(_mm_unpacklo_epi8(p, zero), channelMask);
+      px[j * 2 + 1] = _mm_and_si128(_mm_unpackhi_epi8(p, zero), channelMask);
+    }
+    __m128i bestErr[8], bestIdx[8];
+    for (int k = 0; k < paletteCount; ++k)
+    {
+      const __m128i color = _mm_and_si128(_mm_setr_epi16(
+        short(palette[k][0]), short(palette[k][1]), short(palette[k][2]), short(palette[k][3]),
+        short(palette[k][0]), short(palette[k][1]), short(palette[k][2]), short(palette[k][3])), channelMask);
+      const __m128i index = _mm_set1_epi32(k);
+      for (int j = 0; j < 8; ++j)
+      {
+        __m128i d = _mm_sub_epi16(px[j], color);
+        __m128i sq = _mm_madd_epi16(d, d);  // (r^2+g^2, b^2+a^2) × 2 ピクセル.
+        // 要素 0 と 2 が各ピクセルの誤差となる.
+        __m128i err = _mm_add_epi32(sq, _mm_shuffle_epi32(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        if (k == 0)
+        {
+          bestErr[j] = err;
+          bestIdx[j] = zero;
+        }
+        else
+        {
+          __m128i less = _mm_cmplt_epi32(err, bestErr[j]);
+          bestErr[j] = _mm_or_si128(_mm_and_si128(less, err), _mm_andnot_si128(less, bestErr[j]));
+          bestIdx[j] = _mm_or_si128(_mm_and_si128(less, index), _mm_andnot_si128(less, bestIdx[j]));
+        }
+      }
+    }
+    uint32_t total = 0;
+    for (int j = 0; j < 8; ++j)
+    {
+      alignas(16) uint32_t e[4], idx[4];
+      _mm_store_si128(reinterpret_cast<__m128i*>(e), bestErr[j]);
+      _mm_store_si128(reinterpret_cast<__m128i*>(idx), bestIdx[j]);
+      indices[j * 2 + 0] = uint8_t(idx[0]);
+      indices[j * 2 + 1] = uint8_t(idx[2]);
+      total += e[0] + e[2];
+    }
+    return total;
+#else
+    const int channels = useAlpha ? 4 : 3;
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      uint32_t best = ~0u;
+      for (int k = 0; k < paletteCount; ++k)
+      {
+        uint32_t err = 0;
+        for (int c = 0; c < channels; ++c)
+        {
+          int d = block[i * 4 + c] - palette[k][c];
+          err += uint32_t(d * d);
+        }
+        if (err < best)
+        {
+          best = err;
+          indices[i] = uint8_t(k);
+        }
+      }
+      total += best;
+    }
+    return total;
+#endif
+  }
+
+  // 選んだ番号に対して二乗誤差が最小となる両端の色を求める.
+  bool Bc1RefineEndpoints(const uint8_t* block, const uint8_t* indices, float (&e0)[3], float (&e1)[3])
+  {
+    static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[3] = {}, bx[3] = {};
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      float a = weights[indices[i]], b = 1.0f - a;
+      aa += a * a;
+      bb += b * b;
+      ab += a * b;
+      for (int c = 0; c < 3; ++c)
+      {
+        ax[c] += a * block[i * 4 + c];
+        bx[c] += b * block[i * 4 + c];
+      }
+    }
+    float det = aa * bb - ab * ab;
+    if (std::fabs(det) < 1e-6f)
+    {
+      return false;
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+      e0[c] = (std::min)((std::max)((ax[c] * bb - bx[c] * ab) / det, 0.0f), 255.0f);
+      e1[c] = (std::min)((std::max)((bx[c] * aa - ax[c] * ab) / det, 0.0f), 255.0f);
+    }
+    return true;
+  }
+
+  uint32_t Bc1TryEndpoints(const uint8_t* block, const float (&e0)[3], const float (&e1)[3],
+    uint16_t& c0, uint16_t& c1, uint8_t* indices)
+  {
+    c0 = PackRgb565(e0);
+    c1 = PackRgb565(e1);
+    // 4 色のモードとするため c0 > c1 とする.
+    if (c0 < c1)
+    {
+      std::swap(c0, c1);
+    }
+    int palette[4][4];
+    Bc1Palette(c0, c1, palette);
+    // 1 色のみの場合は 3 色のモードとなるため番号 0 だけを使う.
+    return SelectNearest(block, palette, c0 == c1 ? 1 : 4, false, indices);
+  }
+
+  void EncodeBc1(const uint8_t* block, uint8_t* out)
+  {
+    float e0[3], e1[3];
+    FindEndpoints<3>(block, e0, e1);
+    uint16_t c0, c1;
+    uint8_t indices[BlockPixels];
+    uint32_t error = Bc1TryEndpoints(block, e0, e1, c0, c1, indices);
+
+    // 番号を固定して両端の色を最適化し、誤差が減れば採用する.
+    float r0[3], r1[3];
+    if (error > 0 && Bc1RefineEndpoints(block, indices, r0, r1))
+    {
+      uint16_t rc0, rc1;
+      uint8_t refined[BlockPixels];
+      uint32_t refinedError = Bc1TryEndpoints(block, r0, r1, rc0, rc1, refined);
+      if (refinedError < error)
+      {
+        c0 = rc0;
+        c1 = rc1;
+        memcpy(indices, refined, sizeof(indices));
+      }
+    }
+
+    uint32_t bits = 0;
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      bits |= uint32_t(indices[i]) << (i * 2);
+    }
+    memcpy(out + 0, &c0, 2);
+    memcpy(out + 2, &c1, 2);
+    memcpy(out + 4, &bits, 4);
+  }
+
+  // ---- BC4 / BC5 ----
+
+  // 1 チャンネル 16 ピクセルを 8 段階の補間で表す.
+  void EncodeBc4(const uint8_t* values, uint8_t* out)
+  {
+    uint8_t indices[BlockPixels];
+#ifdef BLOCK_COMPRESSOR_USE_SIMD
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+    __m128i vmin = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+    __m128i vmax = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+    vmin = _mm_min_epu8(vmin, _mm_srli_si128(vmin, 4));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+    vmin = _mm_min_epu8(vmin, _mm_srli_si128(vmin, 2));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 2));
+    vmin = _mm_min_epu8(vmin, _mm_srli_si128(vmin, 1));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 1));
+    const int r1 = _mm_cvtsi128_si32(vmin) & 0xFF;
+    const int r0 = _mm_cvtsi128_si32(vmax) & 0xFF;
+#else
+    int r0 = 0, r1 = 255;
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      r0 = (std::max)(r0, int(values[i]));
+      r1 = (std::min)(r1, int(values[i]));
+    }
+#endif
+    out[0] = uint8_t(r0);
+    out[1] = uint8_t(r1);
+    if (r0 == r1)
+    {
+      memset(out + 2, 0, 6);
+      return;
+    }
+    // r0 > r1 のとき: 0 = r0, 1 = r1, 2～7 = r0 から r1 へ 1/7 ずつ.
+    uint8_t palette[8];
+    palette[0] = uint8_t(r0);
+    palette[1] = uint8_t(r1);
+    for (int i = 2; i < 8; ++i)
+    {
+      palette[i] = uint8_t(((8 - i) * r0 + (i - 1) * r1 + 3) / 7);
+    }
+#ifdef BLOCK_COMPRESSOR_USE_SIMD
+    // 16 ピクセルの差の絶対値を一度に求め、最小となる番号を選ぶ.
+    __m128i bestErr = _mm_set1_epi8(-1);
+    __m128i bestIdx = _mm_setzero_si128();
+    for (int i = 0; i < 8; ++i)
+    {
+      const __m128i p = _mm_set1_epi8(char(palette[i]));
+      const __m128i d = _mm_or_si128(_mm_subs_epu8(v, p), _mm_subs_epu8(p, v));
+      const __m128i err = _mm_min_epu8(d, bestErr);
+      const __m128i less = _mm_andnot_si128(_mm_cmpeq_epi8(err, bestErr), _mm_set1_epi8(-1));
+      bestIdx = _mm_or_si128(_mm_and_si128(less, _mm_set1_epi8(char(i))), _mm_andnot_si128(less, bestIdx));
+      bestErr = err;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), bestIdx);
+#else
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      int best = 256;
+      for (int k = 0; k < 8; ++k)
+      {
+        int d = std::abs(int(values[i]) - palette[k]);
+        if (d < best)
+        {
+          best = d;
+          indices[i] = uint8_t(k);
+        }
+      }
+    }
+#endif
+    uint64_t bits = 0;
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      bits |= uint64_t(indices[i]) << (i * 3);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+      out[2 + i] = uint8_t(bits >> (i * 8));
+    }
+  }
+
+  void ExtractChannel(const uint8_t* block, uint32_t channel, uint8_t* values)
+  {
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      values[i] = block[i * 4 + channel];
+    }
+  }
+
+  // ---- BC7 (モード 6) ----
+
+  const int Bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+  int Bc7Interpolate(int e0, int e1, int index)
+  {
+    return ((64 - Bc7Weights4[index]) * e0 + Bc7Weights4[index] * e1 + 32) >> 6;
+  }
+
+  // 7 ビットの値と p ビットから 8 ビットの端点を作る.
+  void Bc7Quantize(const float (&e)[4], int pbit, int (&q)[4], int (&value)[4])
+  {
+    for (int c = 0; c < 4; ++c)
+    {
+      int v = int((e[c] - pbit) * 0.5f + 0.5f);
+      q[c] = (std::min)((std::max)(v, 0), 127);
+      value[c] = (q[c] << 1) | pbit;
+    }
+  }
+
+  uint32_t Bc7SelectIndices(const uint8_t* block, const int (&v0)[4], const int (&v1)[4], uint8_t* indices)
+  {
+    int palette[16][4];
+    for (int k = 0; k < 16; ++k)
+    {
+      for (int c = 0; c < 4; ++c)
+      {
+        palette[k][c] = Bc7Interpolate(v0[c], v1[c], k);
+      }
+    }
+    return SelectNearest(block, palette, 16, true, indices);
+  }
+
+  class BitWriter
+  {
+  public:
+    explicit BitWriter(uint8_t* out) : m_out(out), m_pos(0) { memset(out, 0, 16); }
+    void Write(uint32_t value, uint32_t bits)
+    {
+      for (uint32_t i = 0; i < bits; ++i, ++m_pos)
+      {
+        m_out[m_pos / 8] |= uint8_t(((value >> i) & 1) << (m_pos % 8));
+      }
+    }
+  private:
+    uint8_t* m_out;
+    uint32_t m_pos;
+  };
+
+  class BitReader
+  {
+  public:
+    explicit BitReader(const uint8_t* in) : m_in(in), m_pos(0) {}
+    uint32_t Read(uint32_t bits)
+    {
+      uint32_t value = 0;
+      for (uint32_t i = 0; i < bits; ++i, ++m_pos)
+      {
+        value |= uint32_t((m_in[m_pos / 8] >> (m_pos % 8)) & 1) << i;
+      }
+      return value;
+    }
+  private:
+    const uint8_t* m_in;
+    uint32_t m_pos;
+  };
+
+  void EncodeBc7(const uint8_t* block, uint8_t* out)
+  {
+    float e0[4], e1[4];
+    FindEndpoints<4>(block, e0, e1);
+
+    // 両端の p ビットの組み合わせを全て試して誤差の小さいものを使う.
+    uint32_t bestError = ~0u;
+    int bestQ0[4] = {}, bestQ1[4] = {}, bestP0 = 0, bestP1 = 0;
+    uint8_t bestIndices[BlockPixels] = {};
+    for (int p0 = 0; p0 < 2; ++p0)
+    {
+      for (int p1 = 0; p1 < 2; ++p1)
+      {
+        int q0[4], q1[4], v0[4], v1[4];
+        Bc7Quantize(e0, p0, q0, v0);
+        Bc7Quantize(e1, p1, q1, v1);
+        uint8_t indices[BlockPixels];
+        uint32_t error = Bc7SelectIndices(block, v0, v1, indices);
+        if (error < bestError)
+        {
+          bestError = error;
+          memcpy(bestQ0, q0, sizeof(q0));
+          memcpy(bestQ1, q1, sizeof(q1));
+          bestP0 = p0;
+          bestP1 = p1;
+          memcpy(bestIndices, indices, sizeof(indices));
+        }
+      }
+    }
+    // 先頭ピクセルの番号は最上位ビットを省略するため 8 未満にする.
+    if (bestIndices[0] & 8)
+    {
+      std::swap(bestQ0, bestQ1);
+      std::swap(bestP0, bestP1);
+      for (auto& index : bestIndices)
+      {
+        index = uint8_t(15 - index);
+      }
+    }
+
+    BitWriter writer(out);
+    writer.Write(1u << 6, 7);  // モード 6.
+    for (int c = 0; c < 4; ++c)
+    {
+      writer.Write(uint32_t(bestQ0[c]), 7);
+      writer.Write(uint32_t(bestQ1[c]), 7);
+    }
+    writer.Write(uint32_t(bestP0), 1);
+    writer.Write(uint32_t(bestP1), 1);
+    writer.Write(bestIndices[0], 3);
+    for (uint32_t i = 1; i < BlockPixels; ++i)
+    {
+      writer.Write(bestIndices[i], 4);
+    }
+  }
+
+  void CompressBlock(const uint8_t* block, BlockFormat format, uint8_t* out)
+  {
+    uint8_t values[BlockPixels];
+    switch (format)
+    {
+    case BlockFormat::BC1:
+      EncodeBc1(block, out);
+      break;
+    case BlockFormat::BC4:
+      ExtractChannel(block, 0, values);
+      EncodeBc4(values, out);
+      break;
+    case BlockFormat::BC5:
+      ExtractChannel(block, 0, values);
+      EncodeBc4(values, out);
+      ExtractChannel(block, 1, values);
+      EncodeBc4(values, out + 8);
+      break;
+    case BlockFormat::BC7:
+      EncodeBc7(block, out);
+      break;
+    }
+  }
+
+  // ---- 展開 ----
+
+  void DecodeBc1(const uint8_t* in, uint8_t* block)
+  {
+    uint16_t c0, c1;
+    uint32_t bits;
+    memcpy(&c0, in + 0, 2);
+    memcpy(&c1, in + 2, 2);
+    memcpy(&bits, in + 4, 4);
+    int palette[4][4];
+    Bc1Palette(c0, c1, palette);
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      uint32_t index = (bits >> (i * 2)) & 3;
+      for (int c = 0; c < 4; ++c)
+      {
+        block[i * 4 + c] = uint8_t(palette[index][c]);
+      }
+    }
+  }
+
+  void DecodeBc4(const uint8_t* in, uint8_t* block, uint32_t channel)
+  {
+    const int r0 = in[0], r1 = in[1];
+    int palette[8] = { r0, r1 };
+    for (int i = 2; i < 8; ++i)
+    {
+      if (r0 > r1)
+      {
+        palette[i] = ((8 - i) * r0 + (i - 1) * r1 + 3) / 7;
+      }
+      else
+      {
+        palette[i] = i < 6 ? ((6 - i) * r0 + (i - 1) * r1 + 2) / 5 : (i == 6 ? 0 : 255);
+      }
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i)
+    {
+      bits |= uint64_t(in[2 + i]) << (i * 8);
+    }
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      block[i * 4 + channel] = uint8_t(palette[(bits >> (i * 3)) & 7]);
+    }
+  }
+
+  bool DecodeBc7(const uint8_t* in, uint8_t* block)
+  {
+    BitReader reader(in);
+    if (reader.Read(7) != (1u << 6))
+    {
+      return false;
+    }
+    int v0[4], v1[4];
+    for (int c = 0; c < 4; ++c)
+    {
+      v0[c] = int(reader.Read(7)) << 1;
+      v1[c] = int(reader.Read(7)) << 1;
+    }
+    int p0 = int(reader.Read(1)), p1 = int(reader.Read(1));
+    for (int c = 0; c < 4; ++c)
+    {
+      v0[c] |= p0;
+      v1[c] |= p1;
+    }
+    for (uint32_t i = 0; i < BlockPixels; ++i)
+    {
+      int index = int(reader.Read(i == 0 ? 3 : 4));
+      for (int c = 0; c < 4; ++c)
+      {
+        block[i * 4 + c] = uint8_t(Bc7Interpolate(v0[c], v1[c], index));
+      }
+    }
+    return true;
+  }
+
+  struct CompressParams
+  {
+    const uint8_t* src;
+    uint32_t width, height;
+    BlockFormat format;
+    uint8_t* dst;
+    uint32_t blocksX, blocksY;
+  };
+
+  void CompressRows(const CompressParams& p, uint32_t beginRow, uint32_t endRow)
+  {
+    const uint32_t blockBytes = book_util::GetBlockBytes(p.format);
+    uint8_t block[BlockPixels * 4];
+    for (uint32_t by = beginRow; by < endRow; ++by)
+    {
+      uint8_t* out = p.dst + size_t(by) * p.blocksX * blockBytes;
+      for (uint32_t bx = 0; bx < p.blocksX; ++bx, out += blockBytes)
+      {
+        LoadBlock(p.src, p.width, p.height, bx, by, block);
+        CompressBlock(block, p.format, out);
+      }
+    }
+  }
+
+  // ブロック数の少ない画像はスレッドを起動する方が高くつくため分割しない.
+  const uint32_t MinBlocksPerThread = 1024;
+}
+
+namespace book_util
+{
+  uint32_t GetBlockBytes(BlockFormat format)
+  {
+    return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+  }
+
+  size_t GetCompressedSize(BlockFormat format, uint32_t width, uint32_t height)
+  {
+    return size_t((width + 3) / 4) * ((height + 3) / 4) * GetBlockBytes(format);
+  }
+
+  void CompressImage(const uint8_t* src, uint32_t width, uint32_t height, BlockFormat format,
+    uint8_t* dst, uint32_t threadCount)
+  {
+    CompressParams p{ src, width, height, format, dst, (width + 3) / 4, (height + 3) / 4 };
+    if (threadCount == 0)
+    {
+      threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+    const uint64_t blocks = uint64_t(p.blocksX) * p.blocksY;
+    threadCount = uint32_t((std::min)(uint64_t(threadCount), (std::max)(blocks / MinBlocksPerThread, uint64_t(1))));
+    threadCount = (std::min)(threadCount, p.blocksY);
+    if (threadCount <= 1)
+    {
+      CompressRows(p, 0, p.blocksY);
+      return;
+    }
+
+    // ブロックの行を帯に分けて各スレッドで処理する.
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    const uint32_t rowsPerThread = (p.blocksY + threadCount - 1) / threadCount;
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+      uint32_t begin = i * rowsPerThread;
+      uint32_t end = (std::min)(begin + rowsPerThread, p.blocksY);
+      if (begin < end)
+      {
+        threads.emplace_back(CompressRows, std::cref(p), begin, end);
+      }
+    }
+    CompressRows(p, 0, (std::min)(rowsPerThread, p.blocksY));
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+  }
+
+  bool DecompressImage(const uint8_t* src, uint32_t width, uint32_t height, BlockFormat format, uint8_t* dst)
+  {
+    const uint32_t blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+    const uint32_t blockBytes = GetBlockBytes(format);
+    uint8_t block[BlockPixels * 4];
+    for (uint32_t by = 0; by < blocksY; ++by)
+    {
+      for (uint32_t bx = 0; bx < blocksX; ++bx, src += blockBytes)
+      {
+        // BC4/BC5 で格納していないチャンネルはサンプリング時と同じく G,B = 0, A = 1 となる.
+        for (uint32_t i = 0; i < BlockPixels; ++i)
+        {
+          block[i * 4 + 0] = block[i * 4 + 1] = block[i * 4 + 2] = 0;
+          block[i * 4 + 3] = 255;
+        }
+        switch (format)
+        {
+        case BlockFormat::BC1:
+          DecodeBc1(src, block);
+          break;
+        case BlockFormat::BC4:
+          DecodeBc4(src, block, 0);
+          break;
+        case BlockFormat::BC5:
+          DecodeBc4(src, block, 0);
+          DecodeBc4(src + 8, block, 1);
+          break;
+        case BlockFormat::BC7:
+          if (!DecodeBc7(src, block))
+          {
+            return false;
+          }
+          break;
+        }
+        for (uint32_t y = 0; y < 4 && by * 4 + y < height; ++y)
+        {
+          for (uint32_t x = 0; x < 4 && bx * 4 + x < width; ++x)
+          {
+            memcpy(dst + (size_t(by * 4 + y) * width + bx * 4 + x) * 4, block + (y * 4 + x) * 4, 4);
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  const char* GetBlockCompressorInstructionSet()
+  {
+#ifdef BLOCK_COMPRESSOR_USE_SIMD
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace book_util
+{
+  // 4x4 ピクセル単位のブロック圧縮形式.
+  enum class BlockFormat
+  {
+    BC1,  // RGB. 565 の 2 色とその補間. 8 バイト.
+    BC4,  // R のみ. 8 バイト. ハイトマップ向け.
+    BC5,  // R,G をそれぞれ BC4 と同じ方法で格納. 16 バイト. 法線マップ向け.
+    BC7,  // RGBA. 16 バイト. モード 6 (1 領域、4 ビットのインデックス)で出力する.
+  };
+
+  uint32_t GetBlockBytes(BlockFormat format);
+  size_t GetCompressedSize(BlockFormat format, uint32_t width, uint32_t height);
+
+  // RGBA8 の画像を圧縮して dst へ書き込む. 4 の倍数に満たない端のブロックは端のピクセルを繰り返して埋める.
+  // BC4 は R、BC5 は R,G のチャンネルを使う. threadCount が 0 ならハードウェアのスレッド数を使う.
+  void CompressImage(const uint8_t* src, uint32_t width, uint32_t height, BlockFormat format,
+    uint8_t* dst, uint32_t threadCount = 0);
+
+  // 圧縮したデータを RGBA8 へ展開する(誤差の確認用). BC7 はモード 6 のブロックのみ対応.
+  bool DecompressImage(const uint8_t* src, uint32_t width, uint32_t height, BlockFormat format, uint8_t* dst);
+
+  // 実行環境で使用している命令セットの名前("sse2"/"scalar").
+  const char* GetBlockCompressorInstructionSet();
+}
@@ -1,67 +1,150 @@
-#include "Camera.h"
-#include <glm/gtx/transform.hpp>
-#include <glm/gtc/matrix_access.hpp>
-
-using namespace glm;
-
-Camera::Camera() : m_isDragged(false)
-{
-}
-
-void Camera::SetLookAt(glm::vec3 eyePos, glm::vec3 target, glm::vec3 up)
-{
-  m_view = glm::lookAt(eyePos, target, up);
-}
-
-void Camera::OnMouseButtonDown(int buttonType)
-{
-  m_isDragged = true;
-  m_buttonType = buttonType;
-}
-void Camera::OnMouseButtonUp()
-{
-  m_isDragged = false;
-}
-
-void Camera::OnMouseMove(int dx, int dy)
-{
-  if (!m_isDragged)
-  {
-    return;
-  }
-
-  if (m_buttonType == 0)
-  {
-    auto axisX = glm::vec3(glm::row(m_view, 0));
-    auto ry = glm::rotate(float(dx) * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f));
-    auto rx = glm::rotate(float(dy) * 0.01f, axisX);
-    m_view = m_view * ry * rx;
-  }
-  if (m_buttonType == 1)
-  {
-    auto invMat = glm::inverse(m_view);
-    vec3 forward = glm::vec3(glm::column(invMat, 2));
-    vec3 pos = glm::vec3(glm::column(invMat, 3));
-    pos += forward * float(dy * 0.1f);
-    invMat[3] = vec4(pos, 1.0f);
-    m_view = glm::inverse(invMat);
-  }
-  if (m_buttonType == 2)
-  {
-    auto m = glm::translate(glm::vec3(dx*0.05f, dy * -0.05f, 0.0f));
-    m_view = m_view * m;
-  }
-}
-
-glm::vec3 Camera::GetPosition() const
-{
-  auto axis0 = glm::vec3(glm::column(m_view, 0));
-  auto axis1 = glm::vec3(glm::column(m_view, 1));
-  auto axis2 = glm::vec3(glm::column(m_view, 2));
-  auto axis3 = glm::vec3(glm::column(m_view, 3));
-
-  auto x = -glm::dot(axis0, axis3);
-  auto y = -glm::dot(axis1, axis3);
-  auto z = -glm::dot(axis2, axis3);
-  return glm::vec3(x, y, z);
-}
+#include "Camera.h"
+#include "MatrixMath.h"
+#include <glm/gtx/transform.hpp>
+#include <glm/gtc/matrix_access.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace glm;
+
+namespace
+{
+  // 長時間止まっていた場合に、まとめて大量の刻みを処理しないための上限.
+  const float MaxAccumulatedTime = 0.25f;
+  // これより小さい残りは最後の刻みで全量を反映する.
+  const float DragEpsilon = 0.01f;
+}
+
+const float Camera::FixedTimeStep = 1.0f / 120.0f;
+
+Camera::Camera() : m_isDragged(false), m_buttonType(0),
+  m_accumulatedTime(0.0f), m_smoothingTime(0.04f),
+  m_rotation(1.0f, 0.0f, 0.0f, 0.0f), m_position(0.0f), m_view(1.0f), m_inverseView(1.0f)
+{
+  for (auto& d : m_pendingDrag)
+  {
+    d = vec2(0.0f, 0.0f);
+  }
+}
+
+void Camera::SetLookAt(glm::vec3 eyePos, glm::vec3 target, glm::vec3 up)
+{
+  SetViewMatrix(glm::lookAt(eyePos, target, up));
+}
+
+void Camera::SetViewMatrix(const glm::mat4& view)
+{
+  // 与えられた行列はそのまま使い(再生結果を記録時と一致させるため)、回転と位置はそこから求める.
+  m_view = view;
+  m_inverseView = book_util::InverseRigid(view);
+  m_rotation = glm::normalize(glm::quat_cast(glm::mat3(m_inverseView)));
+  m_position = glm::vec3(m_inverseView[3]);
+  // 直接設定した姿勢を溜まっていた入力で動かさない.
+  for (auto& d : m_pendingDrag)
+  {
+    d = vec2(0.0f, 0.0f);
+  }
+  m_accumulatedTime = 0.0f;
+}
+
+void Camera::OnMouseButtonDown(int buttonType)
+{
+  m_isDragged = true;
+  m_buttonType = buttonType;
+}
+void Camera::OnMouseButtonUp()
+{
+  m_isDragged = false;
+}
+
+void Camera::OnMouseMove(int dx, int dy)
+{
+  if (!m_isDragged || m_buttonType < 0 || m_buttonType >= 3)
+  {
+    return;
+  }
+  m_pendingDrag[m_buttonType] += vec2(float(dx), float(dy));
+}
+
+void Camera::Update(float elapsedSeconds)
+{
+  bool isPending = false;
+  for (const auto& d : m_pendingDrag)
+  {
+    isPending |= (d.x != 0.0f || d.y != 0.0f);
+  }
+  if (!isPending)
+  {
+    m_accumulatedTime = 0.0f;
+    return;
+  }
+
+  // 刻みごとに残りの rate の割合を反映する. 刻み幅が固定のため、経過時間が同じなら結果も同じとなる.
+  int steps = 0;
+  float rate = 1.0f;
+  if (m_smoothingTime > 0.0f)
+  {
+    m_accumulatedTime = std::min(m_accumulatedTime + elapsedSeconds, MaxAccumulatedTime);
+    steps = int(m_accumulatedTime / FixedTimeStep);
+    m_accumulatedTime -= float(steps) * FixedTimeStep;
+    rate = 1.0f - std::exp(-FixedTimeStep / m_smoothingTime);
+  }
+  else
+  {
+    steps = 1;
+  }
+  if (steps == 0)
+  {
+    return;
+  }
+
+  for (int i = 0; i < steps; ++i)
+  {
+    for (int button = 0; button < 3; ++button)
+    {
+      auto& pending = m_pendingDrag[button];
+      if (pending.x == 0.0f && pending.y == 0.0f)
+      {
+        continue;
+      }
+      auto d = pending * rate;
+      if (std::abs(pending.x - d.x) < DragEpsilon && std::abs(pending.y - d.y) < DragEpsilon)
+      {
+        d = pending;
+      }
+      ApplyDrag(button, d.x, d.y);
+      pending -= d;
+    }
+  }
+  UpdateMatrix();
+}
+
+void Camera::ApplyDrag(int buttonType, float dx, float dy)
+{
+  if (buttonType == 0)
+  {
+    // 原点を中心にワールドの Y 軸とカメラの X 軸で回す.
+    // ビュー行列に右から掛けていた回転は、カメラの姿勢と位置に逆回転を左から掛けることと等しい.
+    auto axisX = m_rotation * vec3(1.0f, 0.0f, 0.0f);
+    auto ry = glm::angleAxis(dx * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f));
+    auto rx = glm::angleAxis(dy * 0.01f, axisX);
+    auto inv = glm::conjugate(ry * rx);
+    m_rotation = glm::normalize(inv * m_rotation);
+    m_position = inv * m_position;
+  }
+  if (buttonType == 1)
+  {
+    vec3 forward = m_rotation * vec3(0.0f, 0.0f, 1.0f);
+    m_position += forward * (dy * 0.1f);
+  }
+  if (buttonType == 2)
+  {
+    m_position -= vec3(dx * 0.05f, dy * -0.05f, 0.0f);
+  }
+}
+
+void Camera::UpdateMatrix()
+{
+  m_inverseView = book_util::ComposeRigid(m_rotation, m_position);
+  m_view = book_util::InverseRigid(m_inverseView);
+}
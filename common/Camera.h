@@ -1,25 +1,57 @@
-#pragma once
-#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
-#define GLM_FORCE_DEPTH_ZERO_TO_ONE
-#endif
-#include <glm/glm.hpp>
-
-class Camera
-{
-public:
-  Camera();
-  void SetLookAt(glm::vec3 eyePos, glm::vec3 target, glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f));
-
-  void OnMouseMove(int dx, int dy);
-  void OnMouseButtonDown(int buttonType);
-  void OnMouseButtonUp();
-
-  glm::mat4 GetViewMatrix()const { return m_view; }
-  glm::vec3 GetPosition() const;
-
-private:
-  void UpdateMatrix();
-  bool m_isDragged;
-  int m_buttonType;
-  glm::mat4 m_view;
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "Frustum.h"
+#include "MatrixMath.h"
+
+class Camera
+{
+public:
+  Camera();
+  void SetLookAt(glm::vec3 eyePos, glm::vec3 target, glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f));
+
+  // マウスの移動量はボタンごとに溜めておくだけで、姿勢と行列の更新は Update でまとめて行う.
+  void OnMouseMove(int dx, int dy);
+  void OnMouseButtonDown(int buttonType);
+  void OnMouseButtonUp();
+
+  // フレームごとに 1 回呼ぶ. 経過時間を固定の刻み幅で区切り、刻みごとに溜まった移動量の一定割合を姿勢へ反映する.
+  // マウスの更新頻度によらず行列の計算はフレームあたり 1 回となり、同じ入力と経過時間からは同じ結果となる.
+  void Update(float elapsedSeconds);
+  // 溜まった移動量を反映しきるまでの時定数(秒). 0 なら Update で全量を反映する.
+  void SetSmoothingTime(float seconds) { m_smoothingTime = seconds; }
+
+  static const float FixedTimeStep;
+
+  // 記録した経路の再生等でビュー行列を直接設定する. 回転と平行移動のみの行列であること.
+  void SetViewMatrix(const glm::mat4& view);
+
+  const glm::mat4& GetViewMatrix() const { return m_view; }
+  // ビュー行列の逆行列(カメラのワールド行列).
+  const glm::mat4& GetInverseViewMatrix() const { return m_inverseView; }
+  glm::vec3 GetPosition() const { return m_position; }
+  // カメラ空間からワールド空間への回転.
+  glm::quat GetRotation() const { return m_rotation; }
+  // 現在のビュー行列と proj による視錐台.
+  book_util::Frustum GetFrustum(const glm::mat4& proj) const { return book_util::Frustum(book_util::MultiplyMatrix(proj, m_view)); }
+
+private:
+  // m_rotation, m_position からビュー行列とその逆行列を作り直す.
+  void UpdateMatrix();
+  // ボタン buttonType でのドラッグ量を姿勢へ反映する.
+  void ApplyDrag(int buttonType, float dx, float dy);
+  bool m_isDragged;
+  int m_buttonType;
+  // 未反映の移動量(左, 右, 中ボタンの順).
+  glm::vec2 m_pendingDrag[3];
+  float m_accumulatedTime;
+  float m_smoothingTime;
+  // カメラは回転と位置のみの剛体変換として保持し、行列はその都度キャッシュする.
+  glm::quat m_rotation;
+  glm::vec3 m_position;
+  glm::mat4 m_view;
+  glm::mat4 m_inverseView;
 };
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "CameraPath.h"
+#include "MatrixMath.h"
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtx/transform.hpp>
+
+namespace
+{
+  // ファイル形式.
+  //  ヘッダ : "CPTH", バージョン, キー数 (各 4 バイト)
+  //  キー   : 時刻, 位置(xyz), 回転(xyzw) の float 8 個
+  const char FileMagic[4] = { 'C', 'P', 'T', 'H' };
+  const uint32_t FileVersion = 1;
+
+  struct FileHeader
+  {
+    char magic[4];
+    uint32_t version;
+    uint32_t keyCount;
+  };
+}
+
+CameraPath::Key CameraPath::MakeKey(float time, const glm::mat4& view)
+{
+  // ビュー行列の逆行列がカメラのワールド行列となる.
+  auto world = book_util::InverseRigid(view);
+  Key key;
+  key.time = time;
+  key.position = glm::vec3(world[3]);
+  key.rotation = glm::normalize(glm::quat_cast(glm::mat3(world)));
+  return key;
+}
+
+void CameraPath::AddKey(float time, const glm::mat4& view)
+{
+  m_keys.push_back(MakeKey(time, view));
+}
+
+void CameraPath::AddLookAt(float time, glm::vec3 eyePos, glm::vec3 target, glm::vec3 up)
+{
+  AddKey(time, glm::lookAt(eyePos, target, up));
+}
+
+void CameraPath::Record(float time, const glm::mat4& view)
+{
+  auto key = MakeKey(time, view);
+  if (!m_keys.empty())
+  {
+    const auto& last = m_keys.back();
+    if (last.position == key.position && last.rotation == key.rotation)
+    {
+      // 静止している間はキーを保留し、動き出したときに追加する.
+      m_holdKey = key;
+      m_hasHoldKey = true;
+      return;
+    }
+  }
+  if (m_hasHoldKey)
+  {
+    m_keys.push_back(m_holdKey);
+    m_hasHoldKey = false;
+  }
+  m_keys.push_back(key);
+}
+
+glm::mat4 CameraPath::Evaluate(float time, bool isLoop) const
+{
+  if (m_keys.empty())
+  {
+    return glm::mat4(1.0f);
+  }
+  auto duration = GetDuration();
+  if (isLoop && duration > 0.0f)
+  {
+    time = std::fmod(time, duration);
+  }
+
+  Key key = m_keys.back();
+  if (time <= m_keys.front().time)
+  {
+    key = m_keys.front();
+  }
+  else if (time < duration)
+  {
+    // time を挟む 2 つのキーを二分探索で求めて補間する.
+    auto it = std::upper_bound(m_keys.begin(), m_keys.end(), time,
+      [](float t, const Key& k) { return t < k.time; });
+    const auto& k1 = *it;
+    const auto& k0 = *(it - 1);
+    float span = k1.time - k0.time;
+    float a = span > 0.0f ? (time - k0.time) / span : 1.0f;
+    key.position = glm::mix(k0.position, k1.position, a);
+    key.rotation = glm::slerp(k0.rotation, k1.rotation, a);
+  }
+  return book_util::InverseRigid(book_util::ComposeRigid(key.rotation, key.position));
+}
+
+bool CameraPath::Save(const std::string& fileName) const
+{
+  std::ofstream outfile(fileName, std::ios::binary);
+  if (!outfile)
+  {
+    return false;
+  }
+  auto keys = m_keys;
+  if (m_hasHoldKey)
+  {
+    keys.push_back(m_holdKey);
+  }
+  FileHeader header;
+  memcpy(header.magic, FileMagic, sizeof(FileMagic));
+  header.version = FileVersion;
+  header.keyCount = uint32_t(keys.size());
+  outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (const auto& k : keys)
+  {
+    float v[8] = {
+      k.time,
+      k.position.x, k.position.y, k.position.z,
+      k.rotation.x, k.rotation.y, k.rotation.z, k.rotation.w,
+    };
+    outfile.write(reinterpret_cast<const char*>(v), sizeof(v));
+  }
+  return bool(outfile);
+}
+
+bool CameraPath::Load(const std::string& fileName)
+{
+  std::ifstream infile(fileName, std::ios::binary);
+  if (!infile)
+  {
+    return false;
+  }
+  FileHeader header;
+  infile.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!infile || memcmp(header.magic, FileMagic, sizeof(FileMagic)) != 0 || header.version != FileVersion)
+  {
+    return false;
+  }
+  std::vector<Key> keys(header.keyCount);
+  for (auto& k : keys)
+  {
+    float v[8];
+    infile.read(reinterpret_cast<char*>(v), sizeof(v));
+    if (!infile)
+    {
+      return false;
+    }
+    k.time = v[0];
+    k.position = glm::vec3(v[1], v[2], v[3]);
+    k.rotation = glm::quat(v[7], v[4], v[5], v[6]);
+  }
+  m_keys.swap(keys);
+  m_hasHoldKey = false;
+  return true;
+}
+
+CameraPath CameraPath::CreateOrbit(glm::vec3 target, float radius, float height, float duration, uint32_t keyCount)
+{
+  CameraPath path;
+  for (uint32_t i = 0; i <= keyCount; ++i)
+  {
+    float a = float(i) / float(keyCount);
+    float angle = a * glm::two_pi<float>();
+    auto eye = target + glm::vec3(std::sin(angle) * radius, height, std::cos(angle) * radius);
+    path.AddLookAt(a * duration, eye, target);
+  }
+  return path;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// カメラの移動経路. 時刻ごとのカメラ位置と向きを保持する.
+// 記録した経路はバイナリ形式で保存でき、再生時はキー間を補間してビュー行列を求める.
+class CameraPath
+{
+public:
+  struct Key
+  {
+    float time;
+    glm::vec3 position;
+    glm::quat rotation;
+  };
+
+  void Clear() { m_keys.clear(); m_hasHoldKey = false; }
+  bool IsEmpty() const { return m_keys.empty(); }
+  float GetDuration() const { return m_keys.empty() ? 0.0f : m_keys.back().time; }
+  const std::vector<Key>& GetKeys() const { return m_keys; }
+
+  // キーを追加する. 時刻は昇順で与えること.
+  void AddKey(float time, const glm::mat4& view);
+  void AddLookAt(float time, glm::vec3 eyePos, glm::vec3 target, glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f));
+
+  // 記録用. 直前と同じビュー行列の間はキーを作らず、動き出す直前の状態だけを残す.
+  void Record(float time, const glm::mat4& view);
+
+  // 指定時刻のビュー行列を求める. isLoop が true なら経路の長さで折り返す.
+  glm::mat4 Evaluate(float time, bool isLoop = true) const;
+
+  bool Save(const std::string& fileName) const;
+  bool Load(const std::string& fileName);
+
+  // target を中心に周回する経路を作る.
+  static CameraPath CreateOrbit(glm::vec3 target, float radius, float height, float duration, uint32_t keyCount = 16);
+private:
+  static Key MakeKey(float time, const glm::mat4& view);
+
+  std::vector<Key> m_keys;
+  Key m_holdKey;
+  bool m_hasHoldKey = false;
+};
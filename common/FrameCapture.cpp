@@ -0,0 +1,361 @@
+#include "FrameCapture.h"
+#include "VulkanAppBase.h"
+#include "VulkanBookUtil.h"
+#include "ImageWriter.h"
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace
+{
+  void MakeDirectory(const std::string& directory)
+  {
+#ifdef _WIN32
+    _mkdir(directory.c_str());
+#else
+    mkdir(directory.c_str(), 0755);
+#endif
+  }
+}
+
+FrameCapture::FrameCapture(VulkanAppBase* app)
+  : m_app(app), m_ringSize(0), m_nextSlot(0), m_format(Format::PNG),
+  m_isCapturing(false), m_maxFrames(0), m_frameIndex(0), m_capturedCount(0), m_droppedCount(0),
+  m_isExit(false)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+}
+
+void FrameCapture::Start(const std::string& directory, Format format, uint32_t ringSize, uint32_t maxFrames)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory = directory;
+    m_format = format;
+  }
+  m_maxFrames = maxFrames;
+  m_frameIndex = 0;
+  m_capturedCount = 0;
+  m_droppedCount = 0;
+  MakeDirectory(m_directory);
+
+  if (m_slots.size() < ringSize)
+  {
+    m_ringSize = ringSize;
+    m_slots.resize(ringSize, ReadbackSlot{});
+  }
+  if (!m_encoder.joinable())
+  {
+    m_isExit = false;
+    m_encoder = std::thread([this]() { EncodeThread(); });
+  }
+  m_isCapturing = true;
+}
+
+void FrameCapture::Stop()
+{
+  // 送信済みのものは Update で引き続き回収される.
+  m_isCapturing = false;
+}
+
+VkCommandBuffer FrameCapture::RecordCopy(VkImage image, VkExtent2D extent, VkFormat format, uint64_t serial)
+{
+  bool isBGRA = false;
+  switch (format)
+  {
+  case VK_FORMAT_B8G8R8A8_UNORM:
+  case VK_FORMAT_B8G8R8A8_SRGB:
+    isBGRA = true;
+    break;
+  case VK_FORMAT_R8G8B8A8_UNORM:
+  case VK_FORMAT_R8G8B8A8_SRGB:
+    break;
+  default:
+    // 8bit x 4 以外の形式は対象外.
+    return VK_NULL_HANDLE;
+  }
+  if (m_slots.empty())
+  {
+    return VK_NULL_HANDLE;
+  }
+
+  auto& slot = m_slots[m_nextSlot];
+  if (slot.isPending)
+  {
+    // GPU または書き出しが追いついていない. 待たずにこのフレームは諦める.
+    m_droppedCount++;
+    return VK_NULL_HANDLE;
+  }
+  m_nextSlot = (m_nextSlot + 1) % m_ringSize;
+
+  auto device = m_app->GetDevice();
+  VkDeviceSize size = VkDeviceSize(extent.width) * extent.height * 4;
+  if (slot.buffer == VK_NULL_HANDLE || slot.size < size)
+  {
+    if (slot.buffer != VK_NULL_HANDLE)
+    {
+      vkUnmapMemory(device, slot.memory);
+      vkDestroyBuffer(device, slot.buffer, nullptr);
+      vkFreeMemory(device, slot.memory, nullptr);
+    }
+    VkBufferCreateInfo bufferCI{
+      VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+      nullptr, 0,
+      size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+      VK_SHARING_MODE_EXCLUSIVE,
+      0, nullptr
+    };
+    auto result = vkCreateBuffer(device, &bufferCI, nullptr, &slot.buffer);
+    ThrowIfFailed(result, "vkCreateBuffer Failed.");
+
+    // CPU からの読み取りが速いキャッシュ付きメモリを優先する.
+    VkMemoryRequirements reqs;
+    vkGetBufferMemoryRequirements(device, slot.buffer, &reqs);
+    auto props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    auto typeIndex = m_app->GetMemoryTypeIndex(reqs.memoryTypeBits, props);
+    slot.isCoherent = false;
+    if (typeIndex == ~0u)
+    {
+      props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+      typeIndex = m_app->GetMemoryTypeIndex(reqs.memoryTypeBits, props);
+      slot.isCoherent = true;
+    }
+    VkMemoryAllocateInfo info{
+      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+      nullptr,
+      reqs.size,
+      typeIndex
+    };
+    result = vkAllocateMemory(device, &info, nullptr, &slot.memory);
+    ThrowIfFailed(result, "vkAllocateMemory Failed.");
+    vkBindBufferMemory(device, slot.buffer, slot.memory, 0);
+    vkMapMemory(device, slot.memory, 0, VK_WHOLE_SIZE, 0, &slot.mapped);
+    slot.size = size;
+  }
+  if (slot.command == VK_NULL_HANDLE)
+  {
+    slot.command = m_app->CreateCommandBuffer(false);
+  }
+
+  VkCommandBufferBeginInfo commandBI{
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+    nullptr, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr
+  };
+  auto command = slot.command;
+  vkBeginCommandBuffer(command, &commandBI);
+
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+    VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    image,
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 }
+  };
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr, 0, nullptr, 1, &imb);
+
+  VkBufferImageCopy region{};
+  region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+  region.imageExtent = { extent.width, extent.height, 1 };
+  vkCmdCopyImageToBuffer(command, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1, &region);
+
+  // 表示用のレイアウトへ戻す.
+  imb.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+  imb.dstAccessMask = 0;
+  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+  imb.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+  VkBufferMemoryBarrier bmb{
+    VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, nullptr,
+    VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    slot.buffer, 0, size
+  };
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+    0, 0, nullptr, 1, &bmb, 1, &imb);
+  vkEndCommandBuffer(command);
+
+  slot.isPending = true;
+  slot.serial = serial;
+  slot.frameIndex = m_frameIndex++;
+  slot.width = extent.width;
+  slot.height = extent.height;
+  slot.isBGRA = isBGRA;
+
+  if (m_maxFrames > 0 && m_frameIndex >= m_maxFrames)
+  {
+    Stop();
+  }
+  return command;
+}
+
+void FrameCapture::Update(uint64_t completedSerial)
+{
+  // 書き出し待ちが溜まりすぎないよう上限を設ける. 超えた分はリングに残したままにする.
+  const size_t maxQueuedJobs = std::max<size_t>(m_ringSize, 2) * 2;
+  auto device = m_app->GetDevice();
+
+  // 古い送信順に回収する.
+  std::vector<ReadbackSlot*> completed;
+  for (auto& slot : m_slots)
+  {
+    if (slot.isPending && slot.serial <= completedSerial)
+    {
+      completed.push_back(&slot);
+    }
+  }
+  std::sort(completed.begin(), completed.end(), [](auto a, auto b) { return a->serial < b->serial; });
+
+  for (auto slot : completed)
+  {
+    EncodeJob job;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_jobs.size() >= maxQueuedJobs)
+      {
+        break;
+      }
+      if (!m_freeBuffers.empty())
+      {
+        job.pixels = std::move(m_freeBuffers.back());
+        m_freeBuffers.pop_back();
+      }
+    }
+    auto size = VkDeviceSize(slot->width) * slot->height * 4;
+    if (!slot->isCoherent)
+    {
+      VkMappedMemoryRange range{
+        VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr,
+        slot->memory, 0, VK_WHOLE_SIZE
+      };
+      vkInvalidateMappedMemoryRanges(device, 1, &range);
+    }
+    job.frameIndex = slot->frameIndex;
+    job.width = slot->width;
+    job.height = slot->height;
+    job.isBGRA = slot->isBGRA;
+    job.pixels.resize(size_t(size));
+    memcpy(job.pixels.data(), slot->mapped, size_t(size));
+    slot->isPending = false;
+    m_capturedCount++;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      job.directory = m_directory;
+      job.format = m_format;
+      m_jobs.push_back(std::move(job));
+    }
+    m_cvJob.notify_one();
+  }
+}
+
+uint32_t FrameCapture::GetEncodeQueueCount()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return uint32_t(m_jobs.size());
+}
+
+void FrameCapture::Cleanup()
+{
+  m_isCapturing = false;
+  // 残っている読み戻しを全て書き出す.
+  bool hasPending = true;
+  while (hasPending)
+  {
+    Update(UINT64_MAX);
+    hasPending = std::any_of(m_slots.begin(), m_slots.end(), [](const auto& s) { return s.isPending; });
+    if (hasPending)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cvSpace.wait(lock, [&]() { return m_jobs.empty(); });
+    }
+  }
+
+  if (m_encoder.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isExit = true;
+    }
+    m_cvJob.notify_all();
+    m_encoder.join();
+  }
+  DestroySlots();
+  m_freeBuffers.clear();
+}
+
+void FrameCapture::DestroySlots()
+{
+  auto device = m_app->GetDevice();
+  for (auto& slot : m_slots)
+  {
+    if (slot.buffer != VK_NULL_HANDLE)
+    {
+      vkUnmapMemory(device, slot.memory);
+      vkDestroyBuffer(device, slot.buffer, nullptr);
+      vkFreeMemory(device, slot.memory, nullptr);
+    }
+    if (slot.command != VK_NULL_HANDLE)
+    {
+      m_app->DestroyCommandBuffer(slot.command);
+    }
+  }
+  m_slots.clear();
+  m_ringSize = 0;
+  m_nextSlot = 0;
+}
+
+void FrameCapture::EncodeThread()
+{
+  char fileName[512];
+  while (true)
+  {
+    EncodeJob job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cvJob.wait(lock, [&]() { return m_isExit || !m_jobs.empty(); });
+      if (m_jobs.empty())
+      {
+        break;
+      }
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+    }
+
+    if (job.isBGRA)
+    {
+      auto p = job.pixels.data();
+      for (size_t i = 0; i < job.pixels.size(); i += 4)
+      {
+        std::swap(p[i], p[i + 2]);
+      }
+    }
+    if (job.format == Format::PNG)
+    {
+      snprintf(fileName, sizeof(fileName), "%s/frame_%06u.png", job.directory.c_str(), job.frameIndex);
+      book_util::WritePNG(fileName, job.width, job.height, 4, job.pixels.data());
+    }
+    else
+    {
+      snprintf(fileName, sizeof(fileName), "%s/frame_%06u_%ux%u.rgba", job.directory.c_str(), job.frameIndex, job.width, job.height);
+      book_util::WriteRaw(fileName, job.pixels.data(), job.pixels.size());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_freeBuffers.push_back(std::move(job.pixels));
+    }
+    m_cvSpace.notify_all();
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define GLFW_INCLUDE_VULKAN
+#include <GLFW/glfw3.h>
+
+class VulkanAppBase;
+
+// 描画結果をホストへ読み戻してファイルへ書き出す.
+// リードバック用バッファをリング状に持ち、GPU の完了を確認できたものから
+// 取り出すため、描画ループを待たせることはない.
+// ファイルへの書き出しはバックグラウンドのスレッドで行う.
+class FrameCapture
+{
+public:
+  enum class Format
+  {
+    PNG,
+    Raw,
+  };
+
+  FrameCapture(VulkanAppBase* app);
+  ~FrameCapture();
+
+  // 出力先ディレクトリを指定してキャプチャを開始する. maxFrames が 0 なら停止するまで続ける.
+  void Start(const std::string& directory, Format format, uint32_t ringSize, uint32_t maxFrames = 0);
+  void Stop();
+  bool IsCapturing() const { return m_isCapturing; }
+
+  // スワップチェインイメージからのコピーを記録したコマンドバッファを返す.
+  // 空きバッファが無い場合は VK_NULL_HANDLE となりそのフレームは取りこぼす.
+  VkCommandBuffer RecordCopy(VkImage image, VkExtent2D extent, VkFormat format, uint64_t serial);
+
+  // completedSerial までの送信が完了済みとして、読み戻し結果を書き出しスレッドへ渡す.
+  void Update(uint64_t completedSerial);
+
+  // 全てのバッファと書き出しスレッドを解放する. GPU の処理完了後に呼ぶこと.
+  void Cleanup();
+
+  uint32_t GetCapturedCount() const { return m_capturedCount; }
+  uint32_t GetDroppedCount() const { return m_droppedCount; }
+  uint32_t GetEncodeQueueCount();
+private:
+  struct ReadbackSlot
+  {
+    VkBuffer buffer;
+    VkDeviceMemory memory;
+    void* mapped;
+    VkDeviceSize size;
+    VkCommandBuffer command;
+    bool isPending;
+    bool isCoherent;
+    uint64_t serial;
+    uint32_t frameIndex;
+    uint32_t width, height;
+    bool isBGRA;
+  };
+  // 書き出しスレッドは m_directory、m_format を参照せず、キューへ入れた時点の値を使う.
+  struct EncodeJob
+  {
+    std::string directory;
+    Format format;
+    uint32_t frameIndex;
+    uint32_t width, height;
+    bool isBGRA;
+    std::vector<uint8_t> pixels;
+  };
+
+  void DestroySlots();
+  void EncodeThread();
+
+  VulkanAppBase* m_app;
+  std::vector<ReadbackSlot> m_slots;
+  uint32_t m_ringSize;
+  uint32_t m_nextSlot;
+
+  std::string m_directory;
+  Format m_format;
+  bool m_isCapturing;
+  uint32_t m_maxFrames;
+  uint32_t m_frameIndex;
+  uint32_t m_capturedCount;
+  uint32_t m_droppedCount;
+
+  std::thread m_encoder;
+  std::mutex m_mutex;
+  std::condition_variable m_cvJob;
+  std::condition_variable m_cvSpace;
+  std::deque<EncodeJob> m_jobs;
+  std::vector<std::vector<uint8_t>> m_freeBuffers;
+  bool m_isExit;
+};
@@ -0,0 +1,232 @@
+#include "Frustum.h"
+#include <glm/gtc/matrix_access.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define FRUSTUM_USE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  bool IsAabbOutside(const glm::vec4& plane, const glm::vec3& center, const glm::vec3& extent)
+  {
+    // 平面の法線方向へ最も突き出た頂点が外側なら、箱全体が外側にある.
+    float d = glm::dot(glm::vec3(plane), center) + plane.w;
+    float r = glm::dot(glm::abs(glm::vec3(plane)), extent);
+    return d + r < 0.0f;
+  }
+}
+
+namespace book_util
+{
+  Aabb ComputeAabb(const void* vertices, uint32_t count, uint32_t stride)
+  {
+    Aabb box{ glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+    auto p = static_cast<const uint8_t*>(vertices);
+    for (uint32_t i = 0; i < count; ++i, p += stride)
+    {
+      glm::vec3 pos;
+      memcpy(&pos, p, sizeof(pos));
+      box.min = glm::min(box.min, pos);
+      box.max = glm::max(box.max, pos);
+    }
+    return box;
+  }
+
+  Aabb TransformAabb(const Aabb& box, const glm::mat4& matrix)
+  {
+    // 中心を変換し、範囲は行列の各要素の絶対値で広げる.
+    auto center = glm::vec3(matrix * glm::vec4((box.min + box.max) * 0.5f, 1.0f));
+    auto extent = (box.max - box.min) * 0.5f;
+    glm::vec3 newExtent(0.0f);
+    for (int i = 0; i < 3; ++i)
+    {
+      newExtent += glm::abs(glm::vec3(matrix[i])) * extent[i];
+    }
+    return Aabb{ center - newExtent, center + newExtent };
+  }
+
+  Frustum::Frustum()
+  {
+    for (auto& p : m_planes)
+    {
+      p = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+  }
+
+  Frustum::Frustum(const glm::mat4& viewProj)
+  {
+    SetMatrix(viewProj);
+  }
+
+  void Frustum::SetMatrix(const glm::mat4& viewProj)
+  {
+    // クリップ座標で -w <= x,y <= w, 0 <= z <= w となる条件を行列の行の組み合わせで表す.
+    auto r0 = glm::row(viewProj, 0);
+    auto r1 = glm::row(viewProj, 1);
+    auto r2 = glm::row(viewProj, 2);
+    auto r3 = glm::row(viewProj, 3);
+    m_planes[0] = r3 + r0;
+    m_planes[1] = r3 - r0;
+    m_planes[2] = r3 + r1;
+    m_planes[3] = r3 - r1;
+    m_planes[4] = r2;
+    m_planes[5] = r3 - r2;
+    for (auto& p : m_planes)
+    {
+      // 遠クリップ面が無限遠の投影では該当する平面の法線が 0 となる. 常に内側とする.
+      auto len = glm::length(glm::vec3(p));
+      p = (len > 0.0f) ? p / len : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+  }
+
+  bool Frustum::IsVisible(const Aabb& box) const
+  {
+    auto center = (box.min + box.max) * 0.5f;
+    auto extent = (box.max - box.min) * 0.5f;
+    for (const auto& p : m_planes)
+    {
+      if (IsAabbOutside(p, center, extent))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Frustum::IsVisible(const glm::vec3& center, float radius) const
+  {
+    for (const auto& p : m_planes)
+    {
+      if (glm::dot(glm::vec3(p), center) + p.w < -radius)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint32_t Frustum::CullAabbs(const Aabb* boxes, uint32_t count, uint8_t* visible) const
+  {
+    uint32_t i = 0;
+    uint32_t visibleCount = 0;
+#ifdef FRUSTUM_USE_SIMD
+    // 4 個の箱の中心と範囲を成分ごとのレジスタへ並べ替え、平面ごとに 4 個同時に判定する.
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 px[6], py[6], pz[6], pw[6], ax[6], ay[6], az[6];
+    for (int k = 0; k < 6; ++k)
+    {
+      px[k] = _mm_set1_ps(m_planes[k].x);
+      py[k] = _mm_set1_ps(m_planes[k].y);
+      pz[k] = _mm_set1_ps(m_planes[k].z);
+      pw[k] = _mm_set1_ps(m_planes[k].w);
+      ax[k] = _mm_set1_ps(std::abs(m_planes[k].x));
+      ay[k] = _mm_set1_ps(std::abs(m_planes[k].y));
+      az[k] = _mm_set1_ps(std::abs(m_planes[k].z));
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+      const Aabb* b = boxes + i;
+      __m128 minX = _mm_set_ps(b[3].min.x, b[2].min.x, b[1].min.x, b[0].min.x);
+      __m128 minY = _mm_set_ps(b[3].min.y, b[2].min.y, b[1].min.y, b[0].min.y);
+      __m128 minZ = _mm_set_ps(b[3].min.z, b[2].min.z, b[1].min.z, b[0].min.z);
+      __m128 maxX = _mm_set_ps(b[3].max.x, b[2].max.x, b[1].max.x, b[0].max.x);
+      __m128 maxY = _mm_set_ps(b[3].max.y, b[2].max.y, b[1].max.y, b[0].max.y);
+      __m128 maxZ = _mm_set_ps(b[3].max.z, b[2].max.z, b[1].max.z, b[0].max.z);
+      __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+      __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+      __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+      __m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+      __m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+      __m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+      __m128 outside = _mm_setzero_ps();
+      for (int k = 0; k < 6; ++k)
+      {
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px[k], cx), _mm_mul_ps(py[k], cy)),
+          _mm_add_ps(_mm_mul_ps(pz[k], cz), pw[k]));
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[k], ex), _mm_mul_ps(ay[k], ey)), _mm_mul_ps(az[k], ez));
+        outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), zero));
+      }
+      int mask = _mm_movemask_ps(outside);
+      for (int j = 0; j < 4; ++j)
+      {
+        uint8_t v = (mask & (1 << j)) ? 0 : 1;
+        visible[i + j] = v;
+        visibleCount += v;
+      }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      uint8_t v = IsVisible(boxes[i]) ? 1 : 0;
+      visible[i] = v;
+      visibleCount += v;
+    }
+    return visibleCount;
+  }
+
+  uint32_t Frustum::CullSpheres(const glm::vec4* spheres, uint32_t count, uint8_t* visible) const
+  {
+    uint32_t i = 0;
+    uint32_t visibleCount = 0;
+#ifdef FRUSTUM_USE_SIMD
+    static_assert(sizeof(glm::vec4) == sizeof(float) * 4, "vec4 must be tightly packed.");
+    __m128 px[6], py[6], pz[6], pw[6];
+    for (int k = 0; k < 6; ++k)
+    {
+      px[k] = _mm_set1_ps(m_planes[k].x);
+      py[k] = _mm_set1_ps(m_planes[k].y);
+      pz[k] = _mm_set1_ps(m_planes[k].z);
+      pw[k] = _mm_set1_ps(m_planes[k].w);
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+      // (x,y,z,r) × 4 を転置して成分ごとに並べる.
+      const float* s = &spheres[i].x;
+      __m128 x = _mm_loadu_ps(s);
+      __m128 y = _mm_loadu_ps(s + 4);
+      __m128 z = _mm_loadu_ps(s + 8);
+      __m128 r = _mm_loadu_ps(s + 12);
+      _MM_TRANSPOSE4_PS(x, y, z, r);
+      __m128 negR = _mm_sub_ps(_mm_setzero_ps(), r);
+
+      __m128 outside = _mm_setzero_ps();
+      for (int k = 0; k < 6; ++k)
+      {
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px[k], x), _mm_mul_ps(py[k], y)),
+          _mm_add_ps(_mm_mul_ps(pz[k], z), pw[k]));
+        outside = _mm_or_ps(outside, _mm_cmplt_ps(d, negR));
+      }
+      int mask = _mm_movemask_ps(outside);
+      for (int j = 0; j < 4; ++j)
+      {
+        uint8_t v = (mask & (1 << j)) ? 0 : 1;
+        visible[i + j] = v;
+        visibleCount += v;
+      }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      uint8_t v = IsVisible(glm::vec3(spheres[i]), spheres[i].w) ? 1 : 0;
+      visible[i] = v;
+      visibleCount += v;
+    }
+    return visibleCount;
+  }
+
+  const char* GetFrustumInstructionSet()
+  {
+#ifdef FRUSTUM_USE_SIMD
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
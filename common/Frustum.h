@@ -0,0 +1,48 @@
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace book_util
+{
+  struct Aabb
+  {
+    glm::vec3 min;
+    glm::vec3 max;
+  };
+
+  // 頂点位置を包む AABB. stride は 1 頂点のバイト数で、位置は各頂点の先頭にあること.
+  Aabb ComputeAabb(const void* vertices, uint32_t count, uint32_t stride);
+  // matrix で変換した AABB の 8 頂点を包む AABB.
+  Aabb TransformAabb(const Aabb& box, const glm::mat4& matrix);
+
+  // 視錐台の 6 平面(左, 右, 下, 上, 近, 遠. 反転深度の投影では近と遠が入れ替わる).
+  // 法線は内側を向き、dot(plane.xyz, p) + plane.w >= 0 であれば内側となる.
+  class Frustum
+  {
+  public:
+    Frustum();
+    // proj * view から平面を求める. 深度の範囲は Vulkan と同じ 0～1 とする.
+    explicit Frustum(const glm::mat4& viewProj);
+    void SetMatrix(const glm::mat4& viewProj);
+    const glm::vec4& GetPlane(int index) const { return m_planes[index]; }
+
+    // いずれかの平面の外側にあれば見えないと判定する(角付近では見えるとする場合がある).
+    bool IsVisible(const Aabb& box) const;
+    bool IsVisible(const glm::vec3& center, float radius) const;
+
+    // まとめて判定し、visible[i] に 0/1 を書き込んで見える数を返す.
+    // SSE2 が使える場合は 4 個ずつ判定する.
+    uint32_t CullAabbs(const Aabb* boxes, uint32_t count, uint8_t* visible) const;
+    // spheres の xyz は中心、w は半径.
+    uint32_t CullSpheres(const glm::vec4* spheres, uint32_t count, uint8_t* visible) const;
+
+  private:
+    glm::vec4 m_planes[6];
+  };
+
+  // 実行環境で使用している命令セットの名前("sse2"/"scalar").
+  const char* GetFrustumInstructionSet();
+}
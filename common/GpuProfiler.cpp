@@ -0,0 +1,127 @@
+#include "GpuProfiler.h"
+#include "VulkanBookUtil.h"
+
+GpuProfiler::GpuProfiler()
+  : m_device(VK_NULL_HANDLE), m_queryPool(VK_NULL_HANDLE), m_timestampPeriod(1.0), m_timestampMask(~0ull),
+  m_maxPasses(0), m_currentFrame(~0u)
+{
+}
+
+void GpuProfiler::Initialize(VkDevice device, VkPhysicalDevice physDev, uint32_t queueFamilyIndex, uint32_t frameCount, uint32_t maxPasses)
+{
+  m_device = device;
+  m_maxPasses = maxPasses;
+
+  VkPhysicalDeviceProperties props;
+  vkGetPhysicalDeviceProperties(physDev, &props);
+  uint32_t count = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(physDev, &count, nullptr);
+  std::vector<VkQueueFamilyProperties> queueProps(count);
+  vkGetPhysicalDeviceQueueFamilyProperties(physDev, &count, queueProps.data());
+
+  auto validBits = queueProps[queueFamilyIndex].timestampValidBits;
+  if (validBits == 0 || props.limits.timestampPeriod == 0.0f)
+  {
+    // タイムスタンプ非対応のキュー.
+    return;
+  }
+  m_timestampPeriod = double(props.limits.timestampPeriod);
+  m_timestampMask = validBits < 64 ? ((1ull << validBits) - 1) : ~0ull;
+
+  // パスごとに開始・終了の 2 つを使用する.
+  VkQueryPoolCreateInfo poolCI{
+    VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+    nullptr, 0,
+    VK_QUERY_TYPE_TIMESTAMP,
+    frameCount * maxPasses * 2,
+    0
+  };
+  auto result = vkCreateQueryPool(m_device, &poolCI, nullptr, &m_queryPool);
+  ThrowIfFailed(result, "vkCreateQueryPool Failed.");
+  m_frames.resize(frameCount, FrameQueries{ {}, false });
+}
+
+void GpuProfiler::Cleanup()
+{
+  if (m_queryPool != VK_NULL_HANDLE)
+  {
+    vkDestroyQueryPool(m_device, m_queryPool, nullptr);
+    m_queryPool = VK_NULL_HANDLE;
+  }
+  m_frames.clear();
+}
+
+void GpuProfiler::BeginFrame(VkCommandBuffer command, uint32_t frameIndex)
+{
+  if (!IsSupported())
+  {
+    return;
+  }
+  m_currentFrame = frameIndex % uint32_t(m_frames.size());
+  m_openPasses.clear();
+
+  // このフレーム領域の前回分は、呼び出し側がフェンスを待っているため完了済み.
+  Resolve(m_currentFrame);
+
+  auto& frame = m_frames[m_currentFrame];
+  frame.names.clear();
+  frame.isRecorded = false;
+  vkCmdResetQueryPool(command, m_queryPool, m_currentFrame * m_maxPasses * 2, m_maxPasses * 2);
+}
+
+void GpuProfiler::BeginPass(VkCommandBuffer command, const char* name)
+{
+  if (!IsSupported() || m_currentFrame == ~0u)
+  {
+    return;
+  }
+  auto& frame = m_frames[m_currentFrame];
+  if (frame.names.size() >= m_maxPasses)
+  {
+    return;
+  }
+  auto passIndex = uint32_t(frame.names.size());
+  frame.names.push_back(name);
+  frame.isRecorded = true;
+  m_openPasses.push_back(passIndex);
+
+  auto query = (m_currentFrame * m_maxPasses + passIndex) * 2;
+  vkCmdWriteTimestamp(command, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPool, query);
+}
+
+void GpuProfiler::EndPass(VkCommandBuffer command)
+{
+  if (!IsSupported() || m_openPasses.empty())
+  {
+    return;
+  }
+  auto passIndex = m_openPasses.back();
+  m_openPasses.pop_back();
+
+  auto query = (m_currentFrame * m_maxPasses + passIndex) * 2 + 1;
+  vkCmdWriteTimestamp(command, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool, query);
+}
+
+void GpuProfiler::Resolve(uint32_t frameIndex)
+{
+  auto& frame = m_frames[frameIndex];
+  if (!frame.isRecorded || frame.names.empty())
+  {
+    return;
+  }
+  std::vector<uint64_t> values(frame.names.size() * 2);
+  auto result = vkGetQueryPoolResults(m_device, m_queryPool,
+    frameIndex * m_maxPasses * 2, uint32_t(values.size()),
+    sizeof(uint64_t) * values.size(), values.data(), sizeof(uint64_t),
+    VK_QUERY_RESULT_64_BIT);
+  if (result != VK_SUCCESS)
+  {
+    // 終了が書き込まれなかったパスがある場合など.
+    return;
+  }
+  for (size_t i = 0; i < frame.names.size(); ++i)
+  {
+    auto ticks = (values[i * 2 + 1] - values[i * 2]) & m_timestampMask;
+    m_passTimes[frame.names[i]].push_back(double(ticks) * m_timestampPeriod * 1.0e-6);
+  }
+}
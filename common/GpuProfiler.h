@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+
+#define GLFW_INCLUDE_VULKAN
+#include <GLFW/glfw3.h>
+
+// タイムスタンプクエリによる GPU 処理時間の計測.
+// フレーム(スワップチェインイメージ)ごとにクエリ領域を持ち、
+// 同じ領域を次に使う時点で前回の結果を回収するため描画を待たせることはない.
+class GpuProfiler
+{
+public:
+  GpuProfiler();
+
+  void Initialize(VkDevice device, VkPhysicalDevice physDev, uint32_t queueFamilyIndex, uint32_t frameCount, uint32_t maxPasses = 16);
+  void Cleanup();
+
+  bool IsSupported() const { return m_queryPool != VK_NULL_HANDLE; }
+
+  // フレームの計測開始. 前回の結果を回収してクエリをリセットするため、レンダーパスの外で呼ぶこと.
+  void BeginFrame(VkCommandBuffer command, uint32_t frameIndex);
+  void BeginPass(VkCommandBuffer command, const char* name);
+  void EndPass(VkCommandBuffer command);
+
+  // 回収済みのパスごとの時間(ミリ秒).
+  const std::map<std::string, std::vector<double>>& GetPassTimes() const { return m_passTimes; }
+  void ResetPassTimes() { m_passTimes.clear(); }
+private:
+  struct FrameQueries
+  {
+    std::vector<std::string> names;
+    bool isRecorded;
+  };
+  void Resolve(uint32_t frameIndex);
+
+  VkDevice m_device;
+  VkQueryPool m_queryPool;
+  double m_timestampPeriod;
+  uint64_t m_timestampMask;
+  uint32_t m_maxPasses;
+  uint32_t m_currentFrame;
+  std::vector<FrameQueries> m_frames;
+  std::vector<uint32_t> m_openPasses;
+  std::map<std::string, std::vector<double>> m_passTimes;
+};
@@ -0,0 +1,392 @@
+#include "ImageDiff.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IMAGEDIFF_USE_SIMD
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define IMAGEDIFF_TARGET_AVX2
+#else
+#define IMAGEDIFF_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace
+{
+  // 誤差の集計. 二乗誤差は行ごとに 32bit から 64bit へ移す.
+  struct ErrorAccum
+  {
+    uint8_t maxDiff[4];
+    uint64_t squared[4];
+    uint64_t differentPixels;
+  };
+
+  void AccumulateRowScalar(ErrorAccum& acc, const uint8_t* a, const uint8_t* b, uint32_t begin, uint32_t end)
+  {
+    for (uint32_t x = begin; x < end; ++x)
+    {
+      bool isDifferent = false;
+      for (int c = 0; c < 4; ++c)
+      {
+        int d = std::abs(int(a[x * 4 + c]) - int(b[x * 4 + c]));
+        acc.maxDiff[c] = (std::max)(acc.maxDiff[c], uint8_t(d));
+        acc.squared[c] += uint64_t(d * d);
+        isDifferent |= (d != 0);
+      }
+      acc.differentPixels += isDifferent ? 1 : 0;
+    }
+  }
+
+#ifdef IMAGEDIFF_USE_SIMD
+  // 4bit のマスクで立っているビット数.
+  const uint8_t BitCount4[16] = { 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4 };
+
+  // SSE2 版. 4 ピクセル(16 バイト)ずつ処理する.
+  // 32bit 単位のレーン番号の下位 2bit がそのままチャンネルとなるよう展開して集計する.
+  void AccumulateImageSSE2(ErrorAccum& acc, const uint8_t* imageA, const uint8_t* imageB,
+    uint32_t width, uint32_t height, uint32_t strideA, uint32_t strideB)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i maxDiff = zero;
+    const uint32_t simdEnd = width & ~3u;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* a = imageA + size_t(y) * strideA;
+      const uint8_t* b = imageB + size_t(y) * strideB;
+      __m128i squared = zero;
+      for (uint32_t x = 0; x < simdEnd; x += 4)
+      {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x * 4));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x * 4));
+        __m128i d = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+        maxDiff = _mm_max_epu8(maxDiff, d);
+
+        __m128i d16lo = _mm_unpacklo_epi8(d, zero);
+        __m128i d16hi = _mm_unpackhi_epi8(d, zero);
+        // 255^2 は 16bit に収まる.
+        __m128i sqlo = _mm_mullo_epi16(d16lo, d16lo);
+        __m128i sqhi = _mm_mullo_epi16(d16hi, d16hi);
+        squared = _mm_add_epi32(squared, _mm_unpacklo_epi16(sqlo, zero));
+        squared = _mm_add_epi32(squared, _mm_unpackhi_epi16(sqlo, zero));
+        squared = _mm_add_epi32(squared, _mm_unpacklo_epi16(sqhi, zero));
+        squared = _mm_add_epi32(squared, _mm_unpackhi_epi16(sqhi, zero));
+
+        int sameMask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(d, zero)));
+        acc.differentPixels += 4 - BitCount4[sameMask];
+      }
+      alignas(16) uint32_t lanes[4];
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes), squared);
+      for (int c = 0; c < 4; ++c)
+      {
+        acc.squared[c] += lanes[c];
+      }
+      AccumulateRowScalar(acc, a, b, simdEnd, width);
+    }
+    alignas(16) uint8_t bytes[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(bytes), maxDiff);
+    for (int i = 0; i < 16; ++i)
+    {
+      acc.maxDiff[i % 4] = (std::max)(acc.maxDiff[i % 4], bytes[i]);
+    }
+  }
+
+  // AVX2 版. 8 ピクセル(32 バイト)ずつ処理する. unpack は 128bit 単位で行われるが、
+  // チャンネルとレーンの対応は SSE2 版と変わらない.
+  IMAGEDIFF_TARGET_AVX2
+  void AccumulateImageAVX2(ErrorAccum& acc, const uint8_t* imageA, const uint8_t* imageB,
+    uint32_t width, uint32_t height, uint32_t strideA, uint32_t strideB)
+  {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i maxDiff = zero;
+    const uint32_t simdEnd = width & ~7u;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* a = imageA + size_t(y) * strideA;
+      const uint8_t* b = imageB + size_t(y) * strideB;
+      __m256i squared = zero;
+      for (uint32_t x = 0; x < simdEnd; x += 8)
+      {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + x * 4));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + x * 4));
+        __m256i d = _mm256_or_si256(_mm256_subs_epu8(va, vb), _mm256_subs_epu8(vb, va));
+        maxDiff = _mm256_max_epu8(maxDiff, d);
+
+        __m256i d16lo = _mm256_unpacklo_epi8(d, zero);
+        __m256i d16hi = _mm256_unpackhi_epi8(d, zero);
+        __m256i sqlo = _mm256_mullo_epi16(d16lo, d16lo);
+        __m256i sqhi = _mm256_mullo_epi16(d16hi, d16hi);
+        squared = _mm256_add_epi32(squared, _mm256_unpacklo_epi16(sqlo, zero));
+        squared = _mm256_add_epi32(squared, _mm256_unpackhi_epi16(sqlo, zero));
+        squared = _mm256_add_epi32(squared, _mm256_unpacklo_epi16(sqhi, zero));
+        squared = _mm256_add_epi32(squared, _mm256_unpackhi_epi16(sqhi, zero));
+
+        int sameMask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(d, zero)));
+        acc.differentPixels += 8 - BitCount4[sameMask & 0xF] - BitCount4[sameMask >> 4];
+      }
+      alignas(32) uint32_t lanes[8];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), squared);
+      for (int i = 0; i < 8; ++i)
+      {
+        acc.squared[i % 4] += lanes[i];
+      }
+      AccumulateRowScalar(acc, a, b, simdEnd, width);
+    }
+    alignas(32) uint8_t bytes[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(bytes), maxDiff);
+    for (int i = 0; i < 32; ++i)
+    {
+      acc.maxDiff[i % 4] = (std::max)(acc.maxDiff[i % 4], bytes[i]);
+    }
+  }
+
+  bool HasAVX2()
+  {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+      return false;
+    }
+    __cpuid(info, 1);
+    const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+    const bool hasAVX = (info[2] & (1 << 28)) != 0;
+    // OS が YMM レジスタを保存しているかも確認する.
+    if (!hasOSXSAVE || !hasAVX || (_xgetbv(0) & 6) != 6)
+    {
+      return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+  }
+
+  bool IsAVX2Available()
+  {
+    static const bool isAvailable = HasAVX2();
+    return isAvailable;
+  }
+#endif
+
+  struct BlockSums
+  {
+    uint32_t a, b;
+    uint32_t aa, bb, ab;
+  };
+
+  double BlockSSIM(const BlockSums& s, uint32_t count)
+  {
+    const double C1 = (0.01 * 255.0) * (0.01 * 255.0);
+    const double C2 = (0.03 * 255.0) * (0.03 * 255.0);
+    double n = double(count);
+    double muA = s.a / n, muB = s.b / n;
+    double varA = s.aa / n - muA * muA;
+    double varB = s.bb / n - muB * muB;
+    double cov = s.ab / n - muA * muB;
+    return ((2.0 * muA * muB + C1) * (2.0 * cov + C2)) /
+      ((muA * muA + muB * muB + C1) * (varA + varB + C2));
+  }
+
+  BlockSums SumBlockScalar(const uint8_t* a, const uint8_t* b, uint32_t stride, uint32_t w, uint32_t h)
+  {
+    BlockSums s{};
+    for (uint32_t y = 0; y < h; ++y)
+    {
+      for (uint32_t x = 0; x < w; ++x)
+      {
+        uint32_t va = a[y * stride + x], vb = b[y * stride + x];
+        s.a += va; s.b += vb;
+        s.aa += va * va; s.bb += vb * vb; s.ab += va * vb;
+      }
+    }
+    return s;
+  }
+
+#ifdef IMAGEDIFF_USE_SIMD
+  // 8x8 ブロックの和と積和. 和は SAD 命令、積和は madd 命令で求める.
+  BlockSums SumBlock8x8SSE2(const uint8_t* a, const uint8_t* b, uint32_t stride)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sa = zero, sb = zero, saa = zero, sbb = zero, sab = zero;
+    for (uint32_t y = 0; y < 8; ++y)
+    {
+      __m128i va = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + y * stride));
+      __m128i vb = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + y * stride));
+      sa = _mm_add_epi64(sa, _mm_sad_epu8(va, zero));
+      sb = _mm_add_epi64(sb, _mm_sad_epu8(vb, zero));
+      __m128i a16 = _mm_unpacklo_epi8(va, zero);
+      __m128i b16 = _mm_unpacklo_epi8(vb, zero);
+      saa = _mm_add_epi32(saa, _mm_madd_epi16(a16, a16));
+      sbb = _mm_add_epi32(sbb, _mm_madd_epi16(b16, b16));
+      sab = _mm_add_epi32(sab, _mm_madd_epi16(a16, b16));
+    }
+    auto hsum = [](__m128i v)
+    {
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+      return uint32_t(_mm_cvtsi128_si32(v));
+    };
+    BlockSums s;
+    s.a = uint32_t(_mm_cvtsi128_si32(sa));
+    s.b = uint32_t(_mm_cvtsi128_si32(sb));
+    s.aa = hsum(saa);
+    s.bb = hsum(sbb);
+    s.ab = hsum(sab);
+    return s;
+  }
+#endif
+
+  void ToLuminance(std::vector<uint8_t>& out, const uint8_t* image, uint32_t width, uint32_t height, uint32_t stride)
+  {
+    out.resize(size_t(width) * height);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* src = image + size_t(y) * stride;
+      uint8_t* dst = &out[size_t(y) * width];
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        // BT.601 の係数を 8bit 固定小数点にしたもの.
+        dst[x] = uint8_t((77 * src[x * 4 + 0] + 150 * src[x * 4 + 1] + 29 * src[x * 4 + 2] + 128) >> 8);
+      }
+    }
+  }
+
+  double ComputeSSIM(const uint8_t* imageA, const uint8_t* imageB, uint32_t width, uint32_t height, uint32_t strideA, uint32_t strideB)
+  {
+    std::vector<uint8_t> lumaA, lumaB;
+    ToLuminance(lumaA, imageA, width, height, strideA);
+    ToLuminance(lumaB, imageB, width, height, strideB);
+
+    const uint32_t BlockSize = 8;
+    double total = 0.0;
+    double weight = 0.0;
+    for (uint32_t by = 0; by < height; by += BlockSize)
+    {
+      uint32_t h = (std::min)(BlockSize, height - by);
+      for (uint32_t bx = 0; bx < width; bx += BlockSize)
+      {
+        uint32_t w = (std::min)(BlockSize, width - bx);
+        const uint8_t* a = &lumaA[size_t(by) * width + bx];
+        const uint8_t* b = &lumaB[size_t(by) * width + bx];
+        BlockSums s;
+#ifdef IMAGEDIFF_USE_SIMD
+        if (w == BlockSize && h == BlockSize)
+        {
+          s = SumBlock8x8SSE2(a, b, width);
+        }
+        else
+#endif
+        {
+          s = SumBlockScalar(a, b, width, w, h);
+        }
+        // 端の小さいブロックはピクセル数で重み付けする.
+        total += BlockSSIM(s, w * h) * double(w * h);
+        weight += double(w * h);
+      }
+    }
+    return weight > 0.0 ? total / weight : 1.0;
+  }
+
+  void MakeHeatmap(std::vector<uint8_t>& out, const uint8_t* imageA, const uint8_t* imageB,
+    uint32_t width, uint32_t height, uint32_t strideA, uint32_t strideB, uint32_t scale)
+  {
+    out.resize(size_t(width) * height * 4);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* a = imageA + size_t(y) * strideA;
+      const uint8_t* b = imageB + size_t(y) * strideB;
+      uint8_t* dst = &out[size_t(y) * width * 4];
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        int d = 0;
+        for (int c = 0; c < 4; ++c)
+        {
+          d = (std::max)(d, std::abs(int(a[x * 4 + c]) - int(b[x * 4 + c])));
+        }
+        // 黒 -> 赤 -> 黄 -> 白 の順に変化させる.
+        int v = (std::min)(d * int(scale), 255) * 3;
+        dst[x * 4 + 0] = uint8_t((std::min)(v, 255));
+        dst[x * 4 + 1] = uint8_t((std::min)((std::max)(v - 255, 0), 255));
+        dst[x * 4 + 2] = uint8_t((std::min)((std::max)(v - 510, 0), 255));
+        dst[x * 4 + 3] = 255;
+      }
+    }
+  }
+}
+
+namespace book_util
+{
+  ImageDiffResult CompareImages(
+    const uint8_t* imageA, const uint8_t* imageB, uint32_t width, uint32_t height,
+    uint32_t strideA, uint32_t strideB,
+    std::vector<uint8_t>* heatmap, uint32_t heatmapScale)
+  {
+    if (strideA == 0)
+    {
+      strideA = width * 4;
+    }
+    if (strideB == 0)
+    {
+      strideB = width * 4;
+    }
+
+    ErrorAccum acc{};
+#ifdef IMAGEDIFF_USE_SIMD
+    if (IsAVX2Available())
+    {
+      AccumulateImageAVX2(acc, imageA, imageB, width, height, strideA, strideB);
+    }
+    else
+    {
+      AccumulateImageSSE2(acc, imageA, imageB, width, height, strideA, strideB);
+    }
+#else
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      AccumulateRowScalar(acc, imageA + size_t(y) * strideA, imageB + size_t(y) * strideB, 0, width);
+    }
+#endif
+
+    ImageDiffResult result;
+    const double pixelCount = double(width) * double(height);
+    for (int c = 0; c < 4; ++c)
+    {
+      result.maxError[c] = acc.maxDiff[c];
+      result.mse[c] = pixelCount > 0.0 ? double(acc.squared[c]) / pixelCount : 0.0;
+    }
+    result.differentPixels = acc.differentPixels;
+
+    double mseRGB = (result.mse[0] + result.mse[1] + result.mse[2]) / 3.0;
+    if (mseRGB > 0.0)
+    {
+      result.psnr = 10.0 * std::log10(255.0 * 255.0 / mseRGB);
+    }
+    else
+    {
+      result.psnr = std::numeric_limits<double>::infinity();
+    }
+    // 完全に一致していれば SSIM の計算は省略する.
+    result.ssim = acc.differentPixels == 0 ? 1.0 : ComputeSSIM(imageA, imageB, width, height, strideA, strideB);
+
+    if (heatmap)
+    {
+      MakeHeatmap(*heatmap, imageA, imageB, width, height, strideA, strideB, heatmapScale);
+    }
+    return result;
+  }
+
+  const char* GetImageDiffInstructionSet()
+  {
+#ifdef IMAGEDIFF_USE_SIMD
+    return IsAVX2Available() ? "avx2" : "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
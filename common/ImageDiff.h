@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace book_util
+{
+  // 2 枚の RGBA8 画像の差分の評価結果.
+  struct ImageDiffResult
+  {
+    uint32_t maxError[4];     // チャンネルごとの最大誤差.
+    double mse[4];            // チャンネルごとの平均二乗誤差.
+    double psnr;              // RGB の平均二乗誤差から求めた PSNR(dB). 一致する場合は無限大.
+    double ssim;              // 輝度の 8x8 ブロックごとの SSIM の平均.
+    uint64_t differentPixels; // いずれかのチャンネルが異なるピクセル数.
+  };
+
+  // 同じサイズの RGBA8 画像を比較する. stride が 0 の場合は width * 4 として扱う.
+  // heatmap を指定すると、ピクセルごとの最大誤差を色に変換した RGBA8 画像を格納する.
+  // heatmapScale 倍した誤差が 255 で白となる.
+  ImageDiffResult CompareImages(
+    const uint8_t* imageA, const uint8_t* imageB, uint32_t width, uint32_t height,
+    uint32_t strideA = 0, uint32_t strideB = 0,
+    std::vector<uint8_t>* heatmap = nullptr, uint32_t heatmapScale = 4);
+
+  // 実行環境で使用している命令セットの名前("avx2"/"sse2"/"scalar").
+  const char* GetImageDiffInstructionSet();
+}
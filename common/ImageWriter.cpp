@@ -0,0 +1,265 @@
+#include "ImageWriter.h"
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+  struct Crc32Table
+  {
+    uint32_t values[256];
+    Crc32Table()
+    {
+      for (uint32_t i = 0; i < 256; ++i)
+      {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k)
+        {
+          c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        values[i] = c;
+      }
+    }
+  };
+
+  uint32_t Crc32(uint32_t crc, const uint8_t* data, size_t size)
+  {
+    // 複数のスレッドから書き出せるよう、関数内 static の初期化で表を作る.
+    static const Crc32Table crcTable;
+    const auto& table = crcTable.values;
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i)
+    {
+      crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+  }
+
+  uint32_t Adler32(const uint8_t* data, size_t size)
+  {
+    uint32_t a = 1, b = 0;
+    while (size > 0)
+    {
+      // 5552 バイトごとに剰余を取ればオーバーフローしない.
+      size_t n = size < 5552 ? size : 5552;
+      size -= n;
+      while (n--)
+      {
+        a += *data++;
+        b += a;
+      }
+      a %= 65521;
+      b %= 65521;
+    }
+    return (b << 16) | a;
+  }
+
+  class BitWriter
+  {
+  public:
+    BitWriter(std::vector<uint8_t>& out) : m_out(out), m_bits(0), m_count(0) { }
+
+    void Write(uint32_t value, int count)
+    {
+      m_bits |= uint64_t(value) << m_count;
+      m_count += count;
+      while (m_count >= 8)
+      {
+        m_out.push_back(uint8_t(m_bits));
+        m_bits >>= 8;
+        m_count -= 8;
+      }
+    }
+    // ハフマン符号は上位ビットから格納するため反転して書き込む.
+    void WriteReversed(uint32_t code, int count)
+    {
+      uint32_t r = 0;
+      for (int i = 0; i < count; ++i)
+      {
+        r = (r << 1) | ((code >> i) & 1);
+      }
+      Write(r, count);
+    }
+    void Flush()
+    {
+      if (m_count > 0)
+      {
+        m_out.push_back(uint8_t(m_bits));
+      }
+      m_bits = 0;
+      m_count = 0;
+    }
+  private:
+    std::vector<uint8_t>& m_out;
+    uint64_t m_bits;
+    int m_count;
+  };
+
+  void WriteLiteral(BitWriter& bw, uint32_t c)
+  {
+    // 固定ハフマン符号.
+    if (c < 144) { bw.WriteReversed(0x30 + c, 8); }
+    else if (c < 256) { bw.WriteReversed(0x190 + c - 144, 9); }
+    else if (c < 280) { bw.WriteReversed(c - 256, 7); }
+    else { bw.WriteReversed(0xC0 + c - 280, 8); }
+  }
+
+  void WriteMatch(BitWriter& bw, int length, int distance)
+  {
+    static const uint16_t lengthBase[] = {
+      3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258
+    };
+    static const uint8_t lengthExtra[] = {
+      0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0
+    };
+    static const uint16_t distBase[] = {
+      1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577
+    };
+    static const uint8_t distExtra[] = {
+      0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13
+    };
+    int l = 28;
+    while (lengthBase[l] > length) { --l; }
+    WriteLiteral(bw, 257 + l);
+    bw.Write(length - lengthBase[l], lengthExtra[l]);
+
+    int d = 29;
+    while (distBase[d] > distance) { --d; }
+    bw.WriteReversed(d, 5);
+    bw.Write(distance - distBase[d], distExtra[d]);
+  }
+
+  // 固定ハフマン + ハッシュ1段の LZ77 による簡易 deflate.
+  // 圧縮率よりも速度を優先している.
+  void Deflate(std::vector<uint8_t>& out, const uint8_t* data, size_t size)
+  {
+    const int HashBits = 15;
+    const size_t WindowSize = 32768;
+    const int MinMatch = 3, MaxMatch = 258;
+    std::vector<int64_t> head(size_t(1) << HashBits, -1);
+
+    out.push_back(0x78); out.push_back(0x01);  // zlib ヘッダ.
+    BitWriter bw(out);
+    bw.Write(1, 1); // BFINAL
+    bw.Write(1, 2); // BTYPE = 固定ハフマン.
+
+    size_t i = 0;
+    while (i < size)
+    {
+      int bestLength = 0;
+      size_t bestDistance = 0;
+      if (i + MinMatch <= size)
+      {
+        uint32_t h = (uint32_t(data[i]) | (uint32_t(data[i + 1]) << 8) | (uint32_t(data[i + 2]) << 16)) * 2654435761u;
+        h >>= (32 - HashBits);
+        int64_t candidate = head[h];
+        head[h] = int64_t(i);
+        if (candidate >= 0 && i - size_t(candidate) <= WindowSize)
+        {
+          size_t limit = size - i < size_t(MaxMatch) ? size - i : size_t(MaxMatch);
+          const uint8_t* a = data + candidate;
+          const uint8_t* b = data + i;
+          size_t n = 0;
+          while (n < limit && a[n] == b[n]) { ++n; }
+          if (n >= size_t(MinMatch))
+          {
+            bestLength = int(n);
+            bestDistance = i - size_t(candidate);
+          }
+        }
+      }
+      if (bestLength > 0)
+      {
+        WriteMatch(bw, bestLength, int(bestDistance));
+        i += bestLength;
+      }
+      else
+      {
+        WriteLiteral(bw, data[i]);
+        ++i;
+      }
+    }
+    WriteLiteral(bw, 256);
+    bw.Flush();
+
+    uint32_t adler = Adler32(data, size);
+    out.push_back(uint8_t(adler >> 24)); out.push_back(uint8_t(adler >> 16));
+    out.push_back(uint8_t(adler >> 8)); out.push_back(uint8_t(adler));
+  }
+
+  void WriteChunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, size_t size)
+  {
+    uint8_t len[4] = { uint8_t(size >> 24), uint8_t(size >> 16), uint8_t(size >> 8), uint8_t(size) };
+    out.insert(out.end(), len, len + 4);
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    if (size > 0)
+    {
+      out.insert(out.end(), data, data + size);
+    }
+    uint32_t crc = Crc32(0, out.data() + start, size + 4);
+    uint8_t c[4] = { uint8_t(crc >> 24), uint8_t(crc >> 16), uint8_t(crc >> 8), uint8_t(crc) };
+    out.insert(out.end(), c, c + 4);
+  }
+}
+
+namespace book_util
+{
+  void EncodePNG(std::vector<uint8_t>& out, uint32_t width, uint32_t height, uint32_t comps, const void* pixels, uint32_t stride)
+  {
+    static const uint8_t colorTypes[] = { 0, 0, 4, 2, 6 };
+    if (stride == 0)
+    {
+      stride = width * comps;
+    }
+    const uint8_t* src = static_cast<const uint8_t*>(pixels);
+
+    // 各行を Sub フィルタで変換.
+    size_t rowBytes = size_t(width) * comps;
+    std::vector<uint8_t> filtered((rowBytes + 1) * height);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* row = src + size_t(y) * stride;
+      uint8_t* dst = &filtered[(rowBytes + 1) * y];
+      dst[0] = 1;
+      memcpy(dst + 1, row, comps);
+      for (size_t x = comps; x < rowBytes; ++x)
+      {
+        dst[1 + x] = uint8_t(row[x] - row[x - comps]);
+      }
+    }
+
+    std::vector<uint8_t> idat;
+    idat.reserve(filtered.size() / 2);
+    Deflate(idat, filtered.data(), filtered.size());
+
+    const uint8_t signature[] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    out.clear();
+    out.insert(out.end(), signature, signature + sizeof(signature));
+    uint8_t ihdr[13] = {
+      uint8_t(width >> 24), uint8_t(width >> 16), uint8_t(width >> 8), uint8_t(width),
+      uint8_t(height >> 24), uint8_t(height >> 16), uint8_t(height >> 8), uint8_t(height),
+      8, colorTypes[comps], 0, 0, 0
+    };
+    WriteChunk(out, "IHDR", ihdr, sizeof(ihdr));
+    WriteChunk(out, "IDAT", idat.data(), idat.size());
+    WriteChunk(out, "IEND", nullptr, 0);
+  }
+
+  bool WritePNG(const char* fileName, uint32_t width, uint32_t height, uint32_t comps, const void* pixels, uint32_t stride)
+  {
+    std::vector<uint8_t> png;
+    EncodePNG(png, width, height, comps, pixels, stride);
+    return WriteRaw(fileName, png.data(), png.size());
+  }
+
+  bool WriteRaw(const char* fileName, const void* pixels, size_t size)
+  {
+    std::ofstream outfile(fileName, std::ios::binary);
+    if (!outfile)
+    {
+      return false;
+    }
+    outfile.write(static_cast<const char*>(pixels), size);
+    return bool(outfile);
+  }
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace book_util
+{
+  // PNG 形式で書き出す. comps は 1(Gray)/2(GrayAlpha)/3(RGB)/4(RGBA).
+  // stride が 0 の場合は width * comps として扱う.
+  bool WritePNG(const char* fileName, uint32_t width, uint32_t height, uint32_t comps, const void* pixels, uint32_t stride = 0);
+
+  // メモリ上に PNG データを作成する.
+  void EncodePNG(std::vector<uint8_t>& out, uint32_t width, uint32_t height, uint32_t comps, const void* pixels, uint32_t stride = 0);
+
+  // ヘッダなしのピクセル列をそのまま書き出す.
+  bool WriteRaw(const char* fileName, const void* pixels, size_t size);
+}
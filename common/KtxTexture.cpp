@@ -0,0 +1,402 @@
+#include "KtxTexture.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+  const uint8_t KtxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+  struct KtxHeader
+  {
+    uint8_t identifier[12];
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+    // Index
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+  };
+  struct KtxLevelIndex
+  {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+  };
+  static_assert(sizeof(KtxHeader) == 80, "KTX2 header size");
+
+  const uint64_t PageSize = 4096;
+
+  // Data Format Descriptor の記述に使う情報.
+  enum ColorModel : uint8_t
+  {
+    ColorModelRGBSDA = 1,
+    ColorModelBC1A = 128,
+    ColorModelBC3 = 130,
+    ColorModelBC4 = 131,
+    ColorModelBC5 = 132,
+    ColorModelBC7 = 134,
+  };
+  const uint8_t ChannelR = 0, ChannelG = 1, ChannelB = 2, ChannelA = 15;
+  const uint8_t QualifierLinear = 0x10, QualifierSigned = 0x40, QualifierFloat = 0x80;
+
+  struct SampleDesc
+  {
+    uint8_t channel;  // チャンネル ID と修飾ビット.
+    uint16_t bitOffset;
+    uint8_t bitLength;
+  };
+  struct FormatEntry
+  {
+    VkFormat format;
+    KtxTexture::FormatInfo info;
+    uint8_t colorModel;
+    bool isSrgb;
+    bool isFloat;
+    uint32_t sampleCount;
+    SampleDesc samples[4];
+  };
+
+  const FormatEntry FormatTable[] = {
+    { VK_FORMAT_R8_UNORM,            { 1, 1, 1, 1 }, ColorModelRGBSDA, false, false, 1, { { ChannelR, 0, 8 } } },
+    { VK_FORMAT_R8G8_UNORM,          { 2, 1, 1, 1 }, ColorModelRGBSDA, false, false, 2, { { ChannelR, 0, 8 }, { ChannelG, 8, 8 } } },
+    { VK_FORMAT_R8G8B8A8_UNORM,      { 4, 1, 1, 1 }, ColorModelRGBSDA, false, false, 4, { { ChannelR, 0, 8 }, { ChannelG, 8, 8 }, { ChannelB, 16, 8 }, { ChannelA, 24, 8 } } },
+    { VK_FORMAT_R8G8B8A8_SRGB,       { 4, 1, 1, 1 }, ColorModelRGBSDA, true,  false, 4, { { ChannelR, 0, 8 }, { ChannelG, 8, 8 }, { ChannelB, 16, 8 }, { ChannelA, 24, 8 } } },
+    { VK_FORMAT_B8G8R8A8_UNORM,      { 4, 1, 1, 1 }, ColorModelRGBSDA, false, false, 4, { { ChannelB, 0, 8 }, { ChannelG, 8, 8 }, { ChannelR, 16, 8 }, { ChannelA, 24, 8 } } },
+    { VK_FORMAT_B8G8R8A8_SRGB,       { 4, 1, 1, 1 }, ColorModelRGBSDA, true,  false, 4, { { ChannelB, 0, 8 }, { ChannelG, 8, 8 }, { ChannelR, 16, 8 }, { ChannelA, 24, 8 } } },
+    { VK_FORMAT_R16_UNORM,           { 2, 1, 1, 2 }, ColorModelRGBSDA, false, false, 1, { { ChannelR, 0, 16 } } },
+    { VK_FORMAT_R16G16_UNORM,        { 4, 1, 1, 2 }, ColorModelRGBSDA, false, false, 2, { { ChannelR, 0, 16 }, { ChannelG, 16, 16 } } },
+    { VK_FORMAT_R16G16B16A16_UNORM,  { 8, 1, 1, 2 }, ColorModelRGBSDA, false, false, 4, { { ChannelR, 0, 16 }, { ChannelG, 16, 16 }, { ChannelB, 32, 16 }, { ChannelA, 48, 16 } } },
+    { VK_FORMAT_R16_SFLOAT,          { 2, 1, 1, 2 }, ColorModelRGBSDA, false, true,  1, { { ChannelR, 0, 16 } } },
+    { VK_FORMAT_R16G16B16A16_SFLOAT, { 8, 1, 1, 2 }, ColorModelRGBSDA, false, true,  4, { { ChannelR, 0, 16 }, { ChannelG, 16, 16 }, { ChannelB, 32, 16 }, { ChannelA, 48, 16 } } },
+    { VK_FORMAT_R32_SFLOAT,          { 4, 1, 1, 4 }, ColorModelRGBSDA, false, true,  1, { { ChannelR, 0, 32 } } },
+    { VK_FORMAT_R32G32B32A32_SFLOAT, { 16, 1, 1, 4 }, ColorModelRGBSDA, false, true, 4, { { ChannelR, 0, 32 }, { ChannelG, 32, 32 }, { ChannelB, 64, 32 }, { ChannelA, 96, 32 } } },
+    // ブロック圧縮形式. BC1 の RGBA は 1 ビットのアルファを持つことを示すチャンネルとなる.
+    { VK_FORMAT_BC1_RGB_UNORM_BLOCK,  { 8, 4, 4, 1 },  ColorModelBC1A, false, false, 1, { { 0, 0, 64 } } },
+    { VK_FORMAT_BC1_RGB_SRGB_BLOCK,   { 8, 4, 4, 1 },  ColorModelBC1A, true,  false, 1, { { 0, 0, 64 } } },
+    { VK_FORMAT_BC1_RGBA_UNORM_BLOCK, { 8, 4, 4, 1 },  ColorModelBC1A, false, false, 1, { { 1, 0, 64 } } },
+    { VK_FORMAT_BC1_RGBA_SRGB_BLOCK,  { 8, 4, 4, 1 },  ColorModelBC1A, true,  false, 1, { { 1, 0, 64 } } },
+    { VK_FORMAT_BC3_UNORM_BLOCK,      { 16, 4, 4, 1 }, ColorModelBC3,  false, false, 2, { { ChannelA, 0, 64 }, { 0, 64, 64 } } },
+    { VK_FORMAT_BC3_SRGB_BLOCK,       { 16, 4, 4, 1 }, ColorModelBC3,  true,  false, 2, { { ChannelA, 0, 64 }, { 0, 64, 64 } } },
+    { VK_FORMAT_BC4_UNORM_BLOCK,      { 8, 4, 4, 1 },  ColorModelBC4,  false, false, 1, { { 0, 0, 64 } } },
+    { VK_FORMAT_BC4_SNORM_BLOCK,      { 8, 4, 4, 1 },  ColorModelBC4,  false, false, 1, { { QualifierSigned, 0, 64 } } },
+    { VK_FORMAT_BC5_UNORM_BLOCK,      { 16, 4, 4, 1 }, ColorModelBC5,  false, false, 2, { { 0, 0, 64 }, { 1, 64, 64 } } },
+    { VK_FORMAT_BC5_SNORM_BLOCK,      { 16, 4, 4, 1 }, ColorModelBC5,  false, false, 2, { { QualifierSigned, 0, 64 }, { QualifierSigned | 1, 64, 64 } } },
+    { VK_FORMAT_BC7_UNORM_BLOCK,      { 16, 4, 4, 1 }, ColorModelBC7,  false, false, 1, { { 0, 0, 128 } } },
+    { VK_FORMAT_BC7_SRGB_BLOCK,       { 16, 4, 4, 1 }, ColorModelBC7,  true,  false, 1, { { 0, 0, 128 } } },
+  };
+
+  const FormatEntry* FindFormat(VkFormat format)
+  {
+    for (const auto& entry : FormatTable)
+    {
+      if (entry.format == format)
+      {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // Khronos Data Format の基本ディスクリプタブロックを作る.
+  std::vector<uint32_t> CreateDataFormatDescriptor(const FormatEntry& entry)
+  {
+    const uint32_t blockSize = 24 + 16 * entry.sampleCount;
+    std::vector<uint32_t> dfd;
+    dfd.push_back(4 + blockSize);     // dfdTotalSize
+    dfd.push_back(0);                 // vendorId = Khronos, descriptorType = basic
+    dfd.push_back(2 | (blockSize << 16)); // versionNumber = 1.3
+    uint32_t transfer = entry.isSrgb ? 2 : 1;
+    dfd.push_back(entry.colorModel | (1u << 8) | (transfer << 16)); // BT.709 primaries, straight alpha.
+    dfd.push_back((entry.info.blockWidth - 1) | ((entry.info.blockHeight - 1) << 8));
+    dfd.push_back(entry.info.blockBytes);  // bytesPlane0
+    dfd.push_back(0);
+    for (uint32_t i = 0; i < entry.sampleCount; ++i)
+    {
+      const auto& s = entry.samples[i];
+      uint8_t channel = s.channel;
+      if (entry.isFloat)
+      {
+        channel |= QualifierFloat | QualifierSigned;
+      }
+      // sRGB でもアルファは線形.
+      if (entry.isSrgb && (channel & 0x0F) == ChannelA && entry.colorModel == ColorModelRGBSDA)
+      {
+        channel |= QualifierLinear;
+      }
+      dfd.push_back(uint32_t(s.bitOffset) | (uint32_t(s.bitLength - 1) << 16) | (uint32_t(channel) << 24));
+      dfd.push_back(0);  // samplePosition
+      if (entry.isFloat)
+      {
+        dfd.push_back(0xBF800000u);  // -1.0f
+        dfd.push_back(0x3F800000u);  //  1.0f
+      }
+      else if (entry.colorModel != ColorModelRGBSDA)
+      {
+        dfd.push_back(0);
+        dfd.push_back(0xFFFFFFFFu);
+      }
+      else
+      {
+        dfd.push_back(0);
+        dfd.push_back(s.bitLength >= 32 ? 0xFFFFFFFFu : (1u << s.bitLength) - 1);
+      }
+    }
+    return dfd;
+  }
+
+  uint64_t AlignUp(uint64_t v, uint64_t alignment)
+  {
+    return (v + alignment - 1) / alignment * alignment;
+  }
+
+  // KTXswizzle の 1 文字をイメージビューの指定へ変換する.
+  bool ToComponentSwizzle(char c, VkComponentSwizzle& swizzle)
+  {
+    switch (c)
+    {
+    case 'r': swizzle = VK_COMPONENT_SWIZZLE_R; return true;
+    case 'g': swizzle = VK_COMPONENT_SWIZZLE_G; return true;
+    case 'b': swizzle = VK_COMPONENT_SWIZZLE_B; return true;
+    case 'a': swizzle = VK_COMPONENT_SWIZZLE_A; return true;
+    case '0': swizzle = VK_COMPONENT_SWIZZLE_ZERO; return true;
+    case '1': swizzle = VK_COMPONENT_SWIZZLE_ONE; return true;
+    default: return false;
+    }
+  }
+
+  // キーと値の組を 1 つ追加する. 各組は 4 バイト境界に揃える.
+  void AppendKeyValue(std::vector<uint8_t>& kvd, const std::string& key, const std::string& value)
+  {
+    uint32_t length = uint32_t(key.size() + 1 + value.size() + 1);
+    auto pos = kvd.size();
+    kvd.resize(pos + 4);
+    memcpy(kvd.data() + pos, &length, 4);
+    kvd.insert(kvd.end(), key.c_str(), key.c_str() + key.size() + 1);
+    kvd.insert(kvd.end(), value.c_str(), value.c_str() + value.size() + 1);
+    kvd.resize(size_t(AlignUp(kvd.size(), 4)), 0);
+  }
+}
+
+bool KtxTexture::GetFormatInfo(VkFormat format, FormatInfo& info)
+{
+  auto entry = FindFormat(format);
+  if (entry == nullptr)
+  {
+    return false;
+  }
+  info = entry->info;
+  return true;
+}
+
+bool KtxTexture::Open(const std::string& fileName)
+{
+  Close();
+  if (!m_mapped.Open(fileName) || m_mapped.GetSize() < sizeof(KtxHeader))
+  {
+    Close();
+    return false;
+  }
+  KtxHeader header;
+  memcpy(&header, m_mapped.GetData(), sizeof(header));
+  if (memcmp(header.identifier, KtxIdentifier, sizeof(KtxIdentifier)) != 0 ||
+    header.supercompressionScheme != 0 ||
+    (header.faceCount != 1 && header.faceCount != 6) ||
+    header.pixelWidth == 0 ||
+    !GetFormatInfo(VkFormat(header.vkFormat), m_formatInfo))
+  {
+    Close();
+    return false;
+  }
+  m_format = VkFormat(header.vkFormat);
+  m_width = header.pixelWidth;
+  m_height = (std::max)(header.pixelHeight, 1u);
+  m_depth = (std::max)(header.pixelDepth, 1u);
+  m_isArray = header.layerCount > 0;
+  m_layerCount = (std::max)(header.layerCount, 1u);
+  m_faceCount = header.faceCount;
+
+  // キーと値の組から KTXswizzle を探す. 他のキーは使わない.
+  m_components = VkComponentMapping{
+    VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY
+  };
+  if (uint64_t(header.kvdByteOffset) + header.kvdByteLength <= m_mapped.GetSize())
+  {
+    const uint8_t* kvd = m_mapped.GetData() + header.kvdByteOffset;
+    uint32_t pos = 0;
+    while (pos + 4 <= header.kvdByteLength)
+    {
+      uint32_t length;
+      memcpy(&length, kvd + pos, 4);
+      if (length > header.kvdByteLength - pos - 4)
+      {
+        break;
+      }
+      const char* key = reinterpret_cast<const char*>(kvd + pos + 4);
+      static const char swizzleKey[] = "KTXswizzle";
+      if (length >= sizeof(swizzleKey) + 4 && memcmp(key, swizzleKey, sizeof(swizzleKey)) == 0)
+      {
+        const char* value = key + sizeof(swizzleKey);
+        VkComponentMapping mapping;
+        if (ToComponentSwizzle(value[0], mapping.r) && ToComponentSwizzle(value[1], mapping.g) &&
+          ToComponentSwizzle(value[2], mapping.b) && ToComponentSwizzle(value[3], mapping.a))
+        {
+          m_components = mapping;
+        }
+      }
+      pos += uint32_t(AlignUp(4 + length, 4));
+    }
+  }
+
+  // levelCount が 0 の場合は基本レベルのみが格納されている.
+  uint32_t levelCount = (std::max)(header.levelCount, 1u);
+  if (sizeof(KtxHeader) + sizeof(KtxLevelIndex) * levelCount > m_mapped.GetSize())
+  {
+    Close();
+    return false;
+  }
+  m_levels.resize(levelCount);
+  m_dataBegin = m_mapped.GetSize();
+  m_dataEnd = 0;
+  for (uint32_t i = 0; i < levelCount; ++i)
+  {
+    KtxLevelIndex index;
+    memcpy(&index, m_mapped.GetData() + sizeof(KtxHeader) + sizeof(KtxLevelIndex) * i, sizeof(index));
+    // 加算で桁あふれしないよう、残りの大きさと比べる.
+    if (index.byteOffset > m_mapped.GetSize() || index.byteLength > m_mapped.GetSize() - index.byteOffset ||
+      index.byteLength < GetImageSize(i) * m_layerCount * m_faceCount)
+    {
+      Close();
+      return false;
+    }
+    m_levels[i] = Level{ index.byteOffset, index.byteLength };
+    m_dataBegin = (std::min)(m_dataBegin, index.byteOffset);
+    m_dataEnd = (std::max)(m_dataEnd, index.byteOffset + index.byteLength);
+  }
+  return true;
+}
+
+void KtxTexture::Close()
+{
+  m_mapped.Close();
+  m_levels.clear();
+  m_format = VK_FORMAT_UNDEFINED;
+  m_width = m_height = m_depth = 0;
+  m_layerCount = m_faceCount = 0;
+  m_dataBegin = m_dataEnd = 0;
+}
+
+uint64_t KtxTexture::GetImageSize(uint32_t level) const
+{
+  auto& fi = m_formatInfo;
+  uint64_t blocksX = (GetLevelWidth(level) + fi.blockWidth - 1) / fi.blockWidth;
+  uint64_t blocksY = (GetLevelHeight(level) + fi.blockHeight - 1) / fi.blockHeight;
+  uint64_t depth = (std::max)(m_depth >> level, 1u);
+  return blocksX * blocksY * depth * fi.blockBytes;
+}
+
+const uint8_t* KtxTexture::GetImageData(uint32_t level, uint32_t layer, uint32_t face) const
+{
+  return GetLevelData(level) + GetImageSize(level) * (layer * m_faceCount + face);
+}
+
+std::vector<VkBufferImageCopy> KtxTexture::GetCopyRegions(VkDeviceSize bufferOffset) const
+{
+  std::vector<VkBufferImageCopy> regions;
+  for (uint32_t i = 0; i < GetLevelCount(); ++i)
+  {
+    VkBufferImageCopy region{};
+    region.bufferOffset = bufferOffset + (m_levels[i].offset - m_dataBegin);
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, i, 0, m_layerCount * m_faceCount };
+    region.imageExtent = { GetLevelWidth(i), GetLevelHeight(i), (std::max)(m_depth >> i, 1u) };
+    regions.push_back(region);
+  }
+  return regions;
+}
+
+bool KtxTexture::Write(const std::string& fileName, const Desc& desc, const std::vector<LevelData>& levels)
+{
+  auto entry = FindFormat(desc.format);
+  if (entry == nullptr || levels.empty() || (desc.faceCount != 1 && desc.faceCount != 6))
+  {
+    return false;
+  }
+  auto dfd = CreateDataFormatDescriptor(*entry);
+
+  // 任意のキーと値. キーの順に並べる必要がある. 書き出したツールも記録しておく.
+  std::vector<uint8_t> kvd;
+  if (!desc.swizzle.empty())
+  {
+    if (desc.swizzle.size() != 4 || desc.swizzle.find_first_not_of("rgba01") != std::string::npos)
+    {
+      return false;
+    }
+    AppendKeyValue(kvd, "KTXswizzle", desc.swizzle);
+  }
+  AppendKeyValue(kvd, "KTXwriter", "vulkan_book TextureCooker");
+
+  const auto levelCount = uint32_t(levels.size());
+  KtxHeader header{};
+  memcpy(header.identifier, KtxIdentifier, sizeof(KtxIdentifier));
+  header.vkFormat = uint32_t(desc.format);
+  header.typeSize = entry->info.typeSize;
+  header.pixelWidth = desc.width;
+  header.pixelHeight = desc.height;
+  header.pixelDepth = 0;
+  header.layerCount = desc.layerCount;
+  header.faceCount = desc.faceCount;
+  header.levelCount = levelCount;
+  header.supercompressionScheme = 0;
+  header.dfdByteOffset = uint32_t(sizeof(KtxHeader) + sizeof(KtxLevelIndex) * levelCount);
+  header.dfdByteLength = uint32_t(dfd.size() * sizeof(uint32_t));
+  header.kvdByteOffset = header.dfdByteOffset + header.dfdByteLength;
+  header.kvdByteLength = uint32_t(kvd.size());
+
+  // レベルのデータはページ境界(かつブロックサイズの倍数)に置く. 格納順は小さいレベルから.
+  uint64_t alignment = PageSize;
+  while (alignment % entry->info.blockBytes != 0)
+  {
+    alignment += PageSize;
+  }
+  std::vector<KtxLevelIndex> levelIndex(levelCount);
+  uint64_t offset = header.kvdByteOffset + header.kvdByteLength;
+  for (uint32_t i = levelCount; i-- > 0;)
+  {
+    offset = AlignUp(offset, alignment);
+    levelIndex[i] = KtxLevelIndex{ offset, levels[i].size, levels[i].size };
+    offset += levels[i].size;
+  }
+
+  std::ofstream outfile(fileName, std::ios::binary);
+  if (!outfile)
+  {
+    return false;
+  }
+  uint64_t written = 0;
+  auto write = [&](const void* data, uint64_t size)
+  {
+    outfile.write(static_cast<const char*>(data), std::streamsize(size));
+    written += size;
+  };
+  write(&header, sizeof(header));
+  write(levelIndex.data(), sizeof(KtxLevelIndex) * levelIndex.size());
+  write(dfd.data(), dfd.size() * sizeof(uint32_t));
+  write(kvd.data(), kvd.size());
+  const std::vector<char> padding(size_t(alignment), 0);
+  for (uint32_t i = levelCount; i-- > 0;)
+  {
+    write(padding.data(), levelIndex[i].byteOffset - written);
+    write(levels[i].data, levels[i].size);
+  }
+  return bool(outfile);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "MappedFile.h"
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// KTX2 形式のテクスチャ.
+// ファイルをメモリへマップし、各ミップレベルのデータをそのまま参照する.
+// 対応するのは超圧縮(supercompression)なしのファイルのみ.
+// 1 つのレベル内はレイヤー、面、奥行きの順に画像が並んでおり、
+// vkCmdCopyBufferToImage でそのままレイヤー数分を転送できる.
+class KtxTexture
+{
+public:
+  struct FormatInfo
+  {
+    uint32_t blockBytes;
+    uint32_t blockWidth, blockHeight;
+    uint32_t typeSize;
+  };
+
+  bool Open(const std::string& fileName);
+  void Close();
+  bool IsOpen() const { return m_mapped.IsOpen(); }
+
+  VkFormat GetFormat() const { return m_format; }
+  uint32_t GetWidth() const { return m_width; }
+  uint32_t GetHeight() const { return m_height; }
+  uint32_t GetDepth() const { return m_depth; }
+  uint32_t GetLayerCount() const { return m_layerCount; }
+  uint32_t GetFaceCount() const { return m_faceCount; }
+  uint32_t GetLevelCount() const { return uint32_t(m_levels.size()); }
+  bool IsArray() const { return m_isArray; }
+  bool IsCubemap() const { return m_faceCount == 6; }
+  // KTXswizzle の指定. イメージビューの components に使う.
+  const VkComponentMapping& GetComponentMapping() const { return m_components; }
+
+  uint32_t GetLevelWidth(uint32_t level) const { return (std::max)(m_width >> level, 1u); }
+  uint32_t GetLevelHeight(uint32_t level) const { return (std::max)(m_height >> level, 1u); }
+  // レベル内の全レイヤー、全面のデータ.
+  const uint8_t* GetLevelData(uint32_t level) const { return m_mapped.GetData() + m_levels[level].offset; }
+  uint64_t GetLevelSize(uint32_t level) const { return m_levels[level].size; }
+  // レベル内の 1 レイヤー 1 面分の画像.
+  uint64_t GetImageSize(uint32_t level) const;
+  const uint8_t* GetImageData(uint32_t level, uint32_t layer, uint32_t face) const;
+
+  // 全レベルのデータを含むファイル内の範囲. この範囲を 1 回のコピーでステージングバッファへ転送する.
+  uint64_t GetDataRangeOffset() const { return m_dataBegin; }
+  uint64_t GetDataRangeSize() const { return m_dataEnd - m_dataBegin; }
+  const uint8_t* GetDataRange() const { return m_mapped.GetData() + m_dataBegin; }
+  // GetDataRange() を bufferOffset の位置へコピーしたバッファからの転送領域.
+  std::vector<VkBufferImageCopy> GetCopyRegions(VkDeviceSize bufferOffset = 0) const;
+
+  static bool GetFormatInfo(VkFormat format, FormatInfo& info);
+
+  // 書き出し. levels[i] はレベル i のデータ(レイヤー、面の順に並べたもの).
+  // レベルのデータはページ(4KB)境界に配置し、小さいレベルから順に格納する.
+  struct Desc
+  {
+    VkFormat format;
+    uint32_t width, height;
+    uint32_t layerCount;  // 0 なら配列ではないテクスチャ.
+    uint32_t faceCount;   // 1 または 6.
+    std::string swizzle;  // 空でなければ KTXswizzle ("r0g1" など)として記録する.
+  };
+  struct LevelData
+  {
+    const void* data;
+    uint64_t size;
+  };
+  static bool Write(const std::string& fileName, const Desc& desc, const std::vector<LevelData>& levels);
+
+private:
+  struct Level
+  {
+    uint64_t offset;
+    uint64_t size;
+  };
+  MappedFile m_mapped;
+  VkFormat m_format = VK_FORMAT_UNDEFINED;
+  uint32_t m_width = 0, m_height = 0, m_depth = 0;
+  uint32_t m_layerCount = 0, m_faceCount = 0;
+  bool m_isArray = false;
+  FormatInfo m_formatInfo = {};
+  VkComponentMapping m_components = {};
+  std::vector<Level> m_levels;
+  uint64_t m_dataBegin = 0, m_dataEnd = 0;
+};
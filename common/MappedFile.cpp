@@ -0,0 +1,130 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : m_data(nullptr), m_size(0)
+#ifdef _WIN32
+  , m_file(nullptr), m_mapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) : MappedFile()
+{
+  MoveFrom(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+  if (this != &other)
+  {
+    Close();
+    MoveFrom(other);
+  }
+  return *this;
+}
+
+void MappedFile::MoveFrom(MappedFile& other)
+{
+  m_data = other.m_data;
+  m_size = other.m_size;
+  other.m_data = nullptr;
+  other.m_size = 0;
+#ifdef _WIN32
+  m_file = other.m_file;
+  m_mapping = other.m_mapping;
+  other.m_file = nullptr;
+  other.m_mapping = nullptr;
+#endif
+}
+
+bool MappedFile::Open(const std::string& fileName)
+{
+  Close();
+#ifdef _WIN32
+  auto file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr)
+  {
+    CloseHandle(file);
+    return false;
+  }
+  auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == nullptr)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+  m_file = file;
+  m_mapping = mapping;
+  m_data = static_cast<const uint8_t*>(data);
+  m_size = size_t(size.QuadPart);
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+  auto data = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  // マップ後はファイル記述子を閉じてもよい.
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    return false;
+  }
+  m_data = static_cast<const uint8_t*>(data);
+  m_size = size_t(st.st_size);
+#endif
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data == nullptr)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  CloseHandle(m_file);
+  m_file = nullptr;
+  m_mapping = nullptr;
+#else
+  munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
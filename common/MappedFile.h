@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// 読み取り専用でファイルをメモリへマップする.
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+  MappedFile(MappedFile&& other);
+  MappedFile& operator=(MappedFile&& other);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // 空のファイルはマップできないため失敗とする.
+  bool Open(const std::string& fileName);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  const uint8_t* GetData() const { return m_data; }
+  size_t GetSize() const { return m_size; }
+
+private:
+  void MoveFrom(MappedFile& other);
+
+  const uint8_t* m_data;
+  size_t m_size;
+#ifdef _WIN32
+  void* m_file;
+  void* m_mapping;
+#endif
+};
@@ -0,0 +1,187 @@
+#include "MatrixMath.h"
+#include <glm/gtx/transform.hpp>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MATRIX_MATH_USE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+#ifdef MATRIX_MATH_USE_SIMD
+  static_assert(sizeof(glm::mat4) == sizeof(float) * 16, "mat4 must be tightly packed.");
+
+  __m128 Dot3(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz)
+  {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+  }
+
+  void Normalize3(__m128& x, __m128& y, __m128& z)
+  {
+    __m128 len = _mm_sqrt_ps(Dot3(x, y, z, x, y, z));
+    x = _mm_div_ps(x, len);
+    y = _mm_div_ps(y, len);
+    z = _mm_div_ps(z, len);
+  }
+#endif
+}
+
+namespace book_util
+{
+  glm::mat4 MultiplyMatrix(const glm::mat4& a, const glm::mat4& b)
+  {
+#ifdef MATRIX_MATH_USE_SIMD
+    // 結果の列 j は a の各列を b[j] の要素で重み付けした和.
+    __m128 a0 = _mm_loadu_ps(&a[0].x);
+    __m128 a1 = _mm_loadu_ps(&a[1].x);
+    __m128 a2 = _mm_loadu_ps(&a[2].x);
+    __m128 a3 = _mm_loadu_ps(&a[3].x);
+    glm::mat4 result;
+    for (int j = 0; j < 4; ++j)
+    {
+      const auto& c = b[j];
+      __m128 r = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(c.x)), _mm_mul_ps(a1, _mm_set1_ps(c.y))),
+        _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(c.z)), _mm_mul_ps(a3, _mm_set1_ps(c.w))));
+      _mm_storeu_ps(&result[j].x, r);
+    }
+    return result;
+#else
+    return a * b;
+#endif
+  }
+
+  glm::mat4 InverseRigid(const glm::mat4& m)
+  {
+#ifdef MATRIX_MATH_USE_SIMD
+    // 回転部分を転置し、平行移動は -R^T * t とする.
+    __m128 x = _mm_loadu_ps(&m[0].x);
+    __m128 y = _mm_loadu_ps(&m[1].x);
+    __m128 z = _mm_loadu_ps(&m[2].x);
+    __m128 w = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    const auto& t = m[3];
+    __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(t.x)), _mm_mul_ps(y, _mm_set1_ps(t.y))),
+      _mm_mul_ps(z, _mm_set1_ps(t.z)));
+    p = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), p);
+    glm::mat4 result;
+    _mm_storeu_ps(&result[0].x, x);
+    _mm_storeu_ps(&result[1].x, y);
+    _mm_storeu_ps(&result[2].x, z);
+    _mm_storeu_ps(&result[3].x, p);
+    return result;
+#else
+    auto r = glm::transpose(glm::mat3(m));
+    auto result = glm::mat4(r);
+    result[3] = glm::vec4(-(r * glm::vec3(m[3])), 1.0f);
+    return result;
+#endif
+  }
+
+  glm::mat4 ComposeRigid(const glm::quat& rotation, const glm::vec3& position)
+  {
+    auto m = glm::mat4_cast(rotation);
+    m[3] = glm::vec4(position, 1.0f);
+    return m;
+  }
+
+  void ComputeLookAtViews(const glm::vec3& eye, const glm::vec3* targets, const glm::vec3* ups,
+    uint32_t count, const glm::mat4& proj, ViewProjection* out)
+  {
+    uint32_t i = 0;
+#ifdef MATRIX_MATH_USE_SIMD
+    // 4 ビュー分の前方、右、上方向を成分ごとのレジスタで求め、最後に転置して列へ戻す.
+    const __m128 ex = _mm_set1_ps(eye.x);
+    const __m128 ey = _mm_set1_ps(eye.y);
+    const __m128 ez = _mm_set1_ps(eye.z);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4)
+    {
+      const glm::vec3* t = targets + i;
+      const glm::vec3* u = ups + i;
+      __m128 fx = _mm_sub_ps(_mm_set_ps(t[3].x, t[2].x, t[1].x, t[0].x), ex);
+      __m128 fy = _mm_sub_ps(_mm_set_ps(t[3].y, t[2].y, t[1].y, t[0].y), ey);
+      __m128 fz = _mm_sub_ps(_mm_set_ps(t[3].z, t[2].z, t[1].z, t[0].z), ez);
+      Normalize3(fx, fy, fz);
+      __m128 upX = _mm_set_ps(u[3].x, u[2].x, u[1].x, u[0].x);
+      __m128 upY = _mm_set_ps(u[3].y, u[2].y, u[1].y, u[0].y);
+      __m128 upZ = _mm_set_ps(u[3].z, u[2].z, u[1].z, u[0].z);
+
+      // s = normalize(cross(f, up)), u = cross(s, f).
+      __m128 sx = _mm_sub_ps(_mm_mul_ps(fy, upZ), _mm_mul_ps(fz, upY));
+      __m128 sy = _mm_sub_ps(_mm_mul_ps(fz, upX), _mm_mul_ps(fx, upZ));
+      __m128 sz = _mm_sub_ps(_mm_mul_ps(fx, upY), _mm_mul_ps(fy, upX));
+      Normalize3(sx, sy, sz);
+      __m128 ux = _mm_sub_ps(_mm_mul_ps(sy, fz), _mm_mul_ps(sz, fy));
+      __m128 uy = _mm_sub_ps(_mm_mul_ps(sz, fx), _mm_mul_ps(sx, fz));
+      __m128 uz = _mm_sub_ps(_mm_mul_ps(sx, fy), _mm_mul_ps(sy, fx));
+
+      __m128 tx = _mm_sub_ps(zero, Dot3(sx, sy, sz, ex, ey, ez));
+      __m128 ty = _mm_sub_ps(zero, Dot3(ux, uy, uz, ex, ey, ez));
+      __m128 tz = Dot3(fx, fy, fz, ex, ey, ez);
+
+      // 行 (s, u, -f, 0) を並べて転置すると、各レーンのビュー行列の列になる.
+      __m128 c0[4] = { sx, ux, _mm_sub_ps(zero, fx), zero };
+      __m128 c1[4] = { sy, uy, _mm_sub_ps(zero, fy), zero };
+      __m128 c2[4] = { sz, uz, _mm_sub_ps(zero, fz), zero };
+      __m128 c3[4] = { tx, ty, tz, _mm_set1_ps(1.0f) };
+      _MM_TRANSPOSE4_PS(c0[0], c0[1], c0[2], c0[3]);
+      _MM_TRANSPOSE4_PS(c1[0], c1[1], c1[2], c1[3]);
+      _MM_TRANSPOSE4_PS(c2[0], c2[1], c2[2], c2[3]);
+      _MM_TRANSPOSE4_PS(c3[0], c3[1], c3[2], c3[3]);
+      for (int k = 0; k < 4; ++k)
+      {
+        auto& vp = out[i + k];
+        _mm_storeu_ps(&vp.view[0].x, c0[k]);
+        _mm_storeu_ps(&vp.view[1].x, c1[k]);
+        _mm_storeu_ps(&vp.view[2].x, c2[k]);
+        _mm_storeu_ps(&vp.view[3].x, c3[k]);
+        vp.proj = proj;
+        vp.viewProj = MultiplyMatrix(proj, vp.view);
+      }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+      auto& vp = out[i];
+      vp.view = glm::lookAt(eye, targets[i], ups[i]);
+      vp.proj = proj;
+      vp.viewProj = MultiplyMatrix(proj, vp.view);
+    }
+  }
+
+  glm::mat4 PerspectiveReverseZ(float fovy, float aspect, float zNear, float zFar)
+  {
+    // glm::perspectiveRH の z の行を、-zNear で 1、-zFar で 0 となるよう置き換えたもの.
+    float f = 1.0f / std::tan(fovy * 0.5f);
+    glm::mat4 m(0.0f);
+    m[0][0] = f / aspect;
+    m[1][1] = f;
+    m[2][2] = zNear / (zFar - zNear);
+    m[2][3] = -1.0f;
+    m[3][2] = zFar * zNear / (zFar - zNear);
+    return m;
+  }
+
+  glm::mat4 PerspectiveInfiniteReverseZ(float fovy, float aspect, float zNear)
+  {
+    // PerspectiveReverseZ で zFar を無限大とした極限.
+    float f = 1.0f / std::tan(fovy * 0.5f);
+    glm::mat4 m(0.0f);
+    m[0][0] = f / aspect;
+    m[1][1] = f;
+    m[2][3] = -1.0f;
+    m[3][2] = zNear;
+    return m;
+  }
+
+  const char* GetMatrixMathInstructionSet()
+  {
+#ifdef MATRIX_MATH_USE_SIMD
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
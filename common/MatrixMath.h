@@ -0,0 +1,40 @@
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+
+namespace book_util
+{
+  struct ViewProjection
+  {
+    glm::mat4 view;
+    glm::mat4 proj;
+    glm::mat4 viewProj;  // proj * view.
+  };
+
+  // a * b. SSE2 が使える場合は列ごとにまとめて計算する.
+  glm::mat4 MultiplyMatrix(const glm::mat4& a, const glm::mat4& b);
+
+  // 回転と平行移動のみからなる行列の逆行列. 回転部分を転置して求めるため一般の逆行列より安価.
+  glm::mat4 InverseRigid(const glm::mat4& m);
+
+  // 姿勢 rotation と位置 position を持つ物体のワールド行列(translate * rotate).
+  glm::mat4 ComposeRigid(const glm::quat& rotation, const glm::vec3& position);
+
+  // eye から targets[i] を向く count 個のビュー行列と、共通の proj との積を求める.
+  // 結果は glm::lookAt と同じ右手系. SSE2 が使える場合は 4 ビューずつ計算する.
+  void ComputeLookAtViews(const glm::vec3& eye, const glm::vec3* targets, const glm::vec3* ups,
+    uint32_t count, const glm::mat4& proj, ViewProjection* out);
+
+  // 深度を反転(近クリップ面が 1、遠クリップ面が 0)した右手系の透視投影.
+  // 浮動小数点の深度バッファでは遠方の精度が大きく改善する. 深度のクリアは 0、比較は GREATER_OR_EQUAL とすること.
+  glm::mat4 PerspectiveReverseZ(float fovy, float aspect, float zNear, float zFar);
+  // 遠クリップ面を無限遠とした PerspectiveReverseZ. 深度は zNear / 距離 となる.
+  glm::mat4 PerspectiveInfiniteReverseZ(float fovy, float aspect, float zNear);
+
+  // 実行環境で使用している命令セットの名前("sse2"/"scalar").
+  const char* GetMatrixMathInstructionSet();
+}
@@ -0,0 +1,294 @@
+#include "MeshFile.h"
+
+#include <fstream>
+#include <cstring>
+
+namespace
+{
+  struct MeshFileHeader
+  {
+    char magic[4];        // "MESH"
+    uint32_t version;
+    uint32_t flags;
+    uint32_t vertexCount;
+    uint32_t vertexStride;
+    uint32_t indexCount;
+    uint32_t indexType;
+    uint32_t attributeCount;
+    uint32_t attributes[MeshFile::MaxAttributes][3];  // location, format, offset.
+    float boundsMin[3];
+    float boundsMax[3];
+    float positionScale[3];
+    float positionOffset[3];
+    uint32_t sectionCount;
+    uint32_t reserved;
+  };
+  struct MeshSectionEntry
+  {
+    uint32_t type;
+    uint32_t count;
+    uint64_t offset;
+    uint64_t size;
+  };
+  const uint32_t MeshFileVersion = 1;
+  const uint32_t MeshFileFlagCompact = 1;
+  const uint32_t MeshFileFlagOptimized = 2;
+  const uint64_t MeshSectionAlignment = 16;
+
+  uint64_t AlignUp(uint64_t v, uint64_t alignment)
+  {
+    return (v + alignment - 1) / alignment * alignment;
+  }
+}
+
+bool MeshFile::Open(const std::string& fileName)
+{
+  Close();
+  if (!m_mapped.Open(fileName))
+  {
+    return false;
+  }
+  const auto fileSize = uint64_t(m_mapped.GetSize());
+  MeshFileHeader header;
+  if (fileSize < sizeof(header))
+  {
+    Close();
+    return false;
+  }
+  memcpy(&header, m_mapped.GetData(), sizeof(header));
+  if (memcmp(header.magic, "MESH", 4) != 0 || header.version != MeshFileVersion ||
+    header.attributeCount > MaxAttributes || header.vertexStride == 0 ||
+    (header.indexType != VK_INDEX_TYPE_UINT16 && header.indexType != VK_INDEX_TYPE_UINT32) ||
+    fileSize < sizeof(header) + uint64_t(header.sectionCount) * sizeof(MeshSectionEntry))
+  {
+    Close();
+    return false;
+  }
+
+  auto entries = m_mapped.GetData() + sizeof(header);
+  for (uint32_t i = 0; i < header.sectionCount; ++i)
+  {
+    MeshSectionEntry entry;
+    memcpy(&entry, entries + sizeof(entry) * i, sizeof(entry));
+    if (entry.offset % MeshSectionAlignment != 0 || entry.offset > fileSize || entry.size > fileSize - entry.offset)
+    {
+      Close();
+      return false;
+    }
+    m_sections.emplace_back(Section(entry.type), SectionRange{ entry.offset, entry.size, entry.count });
+  }
+
+  m_vertexCount = header.vertexCount;
+  m_vertexStride = header.vertexStride;
+  m_indexCount = header.indexCount;
+  m_indexType = VkIndexType(header.indexType);
+  for (uint32_t i = 0; i < header.attributeCount; ++i)
+  {
+    m_attributes.push_back(Attribute{ header.attributes[i][0], VkFormat(header.attributes[i][1]), header.attributes[i][2] });
+  }
+  m_bounds.min = glm::vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+  m_bounds.max = glm::vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+  m_isCompact = (header.flags & MeshFileFlagCompact) != 0;
+  m_isOptimized = (header.flags & MeshFileFlagOptimized) != 0;
+  m_quantization.scale = glm::vec3(header.positionScale[0], header.positionScale[1], header.positionScale[2]);
+  m_quantization.offset = glm::vec3(header.positionOffset[0], header.positionOffset[1], header.positionOffset[2]);
+
+  // 各セクションの大きさが要素数と合っているか確認する.
+  auto vertices = FindSection(Section::Vertices);
+  auto indices = FindSection(Section::Indices);
+  const uint64_t indexBytes = m_indexType == VK_INDEX_TYPE_UINT16 ? 2 : 4;
+  bool isValid = vertices && indices &&
+    vertices->size == uint64_t(m_vertexCount) * m_vertexStride &&
+    indices->size == uint64_t(m_indexCount) * indexBytes;
+  auto checkArray = [&](Section type, uint64_t elementSize)
+  {
+    auto s = FindSection(type);
+    return s == nullptr || s->size == uint64_t(s->count) * elementSize;
+  };
+  isValid = isValid && checkArray(Section::Lods, sizeof(Lod)) && checkArray(Section::Meshlets, sizeof(Meshlet)) &&
+    checkArray(Section::MeshletVertices, sizeof(uint32_t)) && checkArray(Section::MeshletTriangles, 3);
+  for (uint32_t i = 0; isValid && i < GetLodCount(); ++i)
+  {
+    const auto& lod = GetLods()[i];
+    isValid = uint64_t(lod.indexOffset) + lod.indexCount <= m_indexCount;
+  }
+  // メッシュレットの三角形は LOD 0 のインデックスの範囲にあり、頂点数、三角形数は上限以下であること.
+  const uint64_t lodBegin = GetLodCount() > 0 ? GetLods()[0].indexOffset / 3 : 0;
+  const uint64_t lodEnd = GetLodCount() > 0 ? (uint64_t(GetLods()[0].indexOffset) + GetLods()[0].indexCount) / 3 : m_indexCount / 3;
+  const uint64_t meshletVertexCount = GetSectionCount(Section::MeshletVertices);
+  const uint64_t meshletTriangleCount = GetSectionCount(Section::MeshletTriangles);
+  for (uint32_t i = 0; isValid && i < GetMeshletCount(); ++i)
+  {
+    const auto& meshlet = GetMeshlets()[i];
+    isValid = meshlet.vertexCount <= book_util::MeshletMaxVertices && meshlet.triangleCount <= book_util::MeshletMaxTriangles &&
+      meshlet.triangleOffset >= lodBegin && uint64_t(meshlet.triangleOffset) + meshlet.triangleCount <= lodEnd &&
+      uint64_t(meshlet.vertexOffset) + meshlet.vertexCount <= meshletVertexCount &&
+      uint64_t(meshlet.triangleOffset) + meshlet.triangleCount <= meshletTriangleCount;
+  }
+  for (uint32_t i = 0; isValid && i < meshletVertexCount; ++i)
+  {
+    isValid = GetMeshletVertices()[i] < m_vertexCount;
+  }
+  // インデックスは頂点数未満であること. ファイルの内容はそのまま GPU へ転送するため、ここで確認する.
+  if (isValid && m_indexType == VK_INDEX_TYPE_UINT16)
+  {
+    auto indices16 = reinterpret_cast<const uint16_t*>(GetIndexData());
+    for (uint32_t i = 0; isValid && i < m_indexCount; ++i)
+    {
+      isValid = indices16[i] < m_vertexCount;
+    }
+  }
+  else if (isValid)
+  {
+    auto indices32 = reinterpret_cast<const uint32_t*>(GetIndexData());
+    for (uint32_t i = 0; isValid && i < m_indexCount; ++i)
+    {
+      isValid = indices32[i] < m_vertexCount;
+    }
+  }
+  // 属性は対応している形式で、頂点の範囲に収まること.
+  for (const auto& attribute : m_attributes)
+  {
+    auto size = GetAttributeSize(attribute.format);
+    isValid = isValid && size > 0 && attribute.offset <= m_vertexStride && size <= m_vertexStride - attribute.offset;
+  }
+  if (!isValid)
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void MeshFile::Close()
+{
+  m_mapped.Close();
+  m_vertexCount = m_vertexStride = m_indexCount = 0;
+  m_indexType = VK_INDEX_TYPE_UINT32;
+  m_attributes.clear();
+  m_sections.clear();
+  m_isCompact = m_isOptimized = false;
+}
+
+const MeshFile::SectionRange* MeshFile::FindSection(Section type) const
+{
+  for (const auto& s : m_sections)
+  {
+    if (s.first == type)
+    {
+      return &s.second;
+    }
+  }
+  return nullptr;
+}
+
+const uint8_t* MeshFile::GetSectionData(Section type) const
+{
+  auto s = FindSection(type);
+  return s ? m_mapped.GetData() + s->offset : nullptr;
+}
+
+uint32_t MeshFile::GetSectionCount(Section type) const
+{
+  auto s = FindSection(type);
+  return s ? s->count : 0;
+}
+
+uint32_t MeshFile::GetAttributeSize(VkFormat format)
+{
+  switch (format)
+  {
+  case VK_FORMAT_R32_SFLOAT: return 4;
+  case VK_FORMAT_R32G32_SFLOAT: return 8;
+  case VK_FORMAT_R32G32B32_SFLOAT: return 12;
+  case VK_FORMAT_R32G32B32A32_SFLOAT: return 16;
+  case VK_FORMAT_R16G16_SNORM: return 4;
+  case VK_FORMAT_R16G16B16A16_SNORM: return 8;
+  case VK_FORMAT_R16G16_SFLOAT: return 4;
+  case VK_FORMAT_R16G16B16A16_SFLOAT: return 8;
+  case VK_FORMAT_R8G8B8A8_UNORM: return 4;
+  case VK_FORMAT_R8G8B8A8_SNORM: return 4;
+  default: return 0;
+  }
+}
+
+bool MeshFile::Write(const std::string& fileName, const Desc& desc)
+{
+  if (desc.attributes.size() > MaxAttributes)
+  {
+    return false;
+  }
+  const uint64_t indexBytes = desc.indexType == VK_INDEX_TYPE_UINT16 ? 2 : 4;
+  struct Source
+  {
+    Section type;
+    uint32_t count;
+    const void* data;
+    uint64_t size;
+  };
+  std::vector<Source> sources = {
+    { Section::Vertices, desc.vertexCount, desc.vertices, uint64_t(desc.vertexCount) * desc.vertexStride },
+    { Section::Indices, desc.indexCount, desc.indices, desc.indexCount * indexBytes },
+  };
+  if (!desc.lods.empty())
+  {
+    sources.push_back({ Section::Lods, uint32_t(desc.lods.size()), desc.lods.data(), desc.lods.size() * sizeof(Lod) });
+  }
+  if (!desc.meshlets.empty())
+  {
+    sources.push_back({ Section::Meshlets, uint32_t(desc.meshlets.size()), desc.meshlets.data(), desc.meshlets.size() * sizeof(Meshlet) });
+    sources.push_back({ Section::MeshletVertices, uint32_t(desc.meshletVertices.size()),
+      desc.meshletVertices.data(), desc.meshletVertices.size() * sizeof(uint32_t) });
+    sources.push_back({ Section::MeshletTriangles, uint32_t(desc.meshletTriangles.size() / 3),
+      desc.meshletTriangles.data(), desc.meshletTriangles.size() });
+  }
+
+  MeshFileHeader header{};
+  memcpy(header.magic, "MESH", 4);
+  header.version = MeshFileVersion;
+  header.flags = (desc.isCompact ? MeshFileFlagCompact : 0) | (desc.isOptimized ? MeshFileFlagOptimized : 0);
+  header.vertexCount = desc.vertexCount;
+  header.vertexStride = desc.vertexStride;
+  header.indexCount = desc.indexCount;
+  header.indexType = uint32_t(desc.indexType);
+  header.attributeCount = uint32_t(desc.attributes.size());
+  for (size_t i = 0; i < desc.attributes.size(); ++i)
+  {
+    header.attributes[i][0] = desc.attributes[i].location;
+    header.attributes[i][1] = uint32_t(desc.attributes[i].format);
+    header.attributes[i][2] = desc.attributes[i].offset;
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    header.boundsMin[i] = desc.bounds.min[i];
+    header.boundsMax[i] = desc.bounds.max[i];
+    header.positionScale[i] = desc.quantization.scale[i];
+    header.positionOffset[i] = desc.quantization.offset[i];
+  }
+  header.sectionCount = uint32_t(sources.size());
+
+  std::vector<MeshSectionEntry> entries(sources.size());
+  uint64_t offset = AlignUp(sizeof(header) + sizeof(MeshSectionEntry) * entries.size(), MeshSectionAlignment);
+  for (size_t i = 0; i < sources.size(); ++i)
+  {
+    entries[i] = MeshSectionEntry{ uint32_t(sources[i].type), sources[i].count, offset, sources[i].size };
+    offset = AlignUp(offset + sources[i].size, MeshSectionAlignment);
+  }
+
+  std::ofstream outfile(fileName, std::ios::binary);
+  if (!outfile)
+  {
+    return false;
+  }
+  outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  outfile.write(reinterpret_cast<const char*>(entries.data()), sizeof(MeshSectionEntry) * entries.size());
+  uint64_t written = sizeof(header) + sizeof(MeshSectionEntry) * entries.size();
+  const char padding[MeshSectionAlignment] = {};
+  for (size_t i = 0; i < sources.size(); ++i)
+  {
+    outfile.write(padding, std::streamsize(entries[i].offset - written));
+    outfile.write(static_cast<const char*>(sources[i].data), std::streamsize(sources[i].size));
+    written = entries[i].offset + sources[i].size;
+  }
+  return bool(outfile);
+}
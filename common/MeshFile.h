@@ -0,0 +1,114 @@
+#pragma once
+#include "MappedFile.h"
+#include "Frustum.h"
+#include "VertexQuantize.h"
+#include "Meshlet.h"
+#include "MeshSimplifier.h"
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// 調理済みのメッシュ(.mesh). MeshCooker で作成する.
+// ヘッダ、セクション表、各セクションのデータ(16 バイト境界)の順に並ぶ.
+// 頂点とインデックスはバッファへそのまま転送できる形で格納し、読み込み時はファイルをメモリへマップして参照する.
+class MeshFile
+{
+public:
+  enum class Section : uint32_t
+  {
+    Vertices = 1,          // 頂点(GetVertexStride バイトごとに属性を詰めたもの).
+    Indices = 2,           // 三角形リストのインデックス(16 または 32 ビット).
+    Lods = 3,              // Lod の配列. 詳細度の高い順.
+    Meshlets = 4,          // Meshlet の配列.
+    MeshletVertices = 5,   // メッシュレットが参照する頂点番号(uint32_t).
+    MeshletTriangles = 6,  // メッシュレット内の頂点番号(uint8_t)を 3 つずつ並べたもの.
+  };
+
+  // 頂点属性. location は頂点シェーダーの入力位置、offset は頂点内の位置.
+  struct Attribute
+  {
+    uint32_t location;
+    VkFormat format;
+    uint32_t offset;
+  };
+  // 詳細度ごとのインデックスの範囲. error は元の形状からの誤差(モデル空間での距離). 形式は book_util::MeshLod(MeshSimplifier.h)と同じ.
+  using Lod = book_util::MeshLod;
+  // 少数の三角形をまとめた単位. 形式は book_util::Meshlet(Meshlet.h)と同じ.
+  using Meshlet = book_util::Meshlet;
+
+  bool Open(const std::string& fileName);
+  void Close();
+  bool IsOpen() const { return m_mapped.IsOpen(); }
+
+  uint32_t GetVertexCount() const { return m_vertexCount; }
+  uint32_t GetVertexStride() const { return m_vertexStride; }
+  const std::vector<Attribute>& GetAttributes() const { return m_attributes; }
+  const uint8_t* GetVertexData() const { return GetSectionData(Section::Vertices); }
+
+  uint32_t GetIndexCount() const { return m_indexCount; }
+  VkIndexType GetIndexType() const { return m_indexType; }
+  const uint8_t* GetIndexData() const { return GetSectionData(Section::Indices); }
+
+  const book_util::Aabb& GetBounds() const { return m_bounds; }
+  // 位置が CompactVertex と同じく量子化されているか.
+  bool IsCompact() const { return m_isCompact; }
+  const book_util::PositionQuantization& GetQuantization() const { return m_quantization; }
+  // 頂点キャッシュ、オーバードロー向けの並べ替え(OptimizeMesh)を済ませているか.
+  bool IsOptimized() const { return m_isOptimized; }
+
+  // セクションがなければ 0 個として扱う. Lod がない場合は全インデックスを 1 つの詳細度とする.
+  uint32_t GetLodCount() const { return GetSectionCount(Section::Lods); }
+  const Lod* GetLods() const { return reinterpret_cast<const Lod*>(GetSectionData(Section::Lods)); }
+  uint32_t GetMeshletCount() const { return GetSectionCount(Section::Meshlets); }
+  const Meshlet* GetMeshlets() const { return reinterpret_cast<const Meshlet*>(GetSectionData(Section::Meshlets)); }
+  const uint32_t* GetMeshletVertices() const { return reinterpret_cast<const uint32_t*>(GetSectionData(Section::MeshletVertices)); }
+  const uint8_t* GetMeshletTriangles() const { return GetSectionData(Section::MeshletTriangles); }
+
+  // 書き出し. 頂点、インデックス以外のセクションは空であれば書き出さない.
+  struct Desc
+  {
+    uint32_t vertexCount;
+    uint32_t vertexStride;
+    std::vector<Attribute> attributes;
+    const void* vertices;
+    uint32_t indexCount;
+    VkIndexType indexType;
+    const void* indices;
+    book_util::Aabb bounds;
+    bool isCompact;
+    bool isOptimized;
+    book_util::PositionQuantization quantization;
+    std::vector<Lod> lods;
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> meshletVertices;
+    std::vector<uint8_t> meshletTriangles;
+  };
+  static bool Write(const std::string& fileName, const Desc& desc);
+  // 頂点属性の形式の 1 要素のバイト数. 対応していない形式は 0.
+  static uint32_t GetAttributeSize(VkFormat format);
+
+  static const uint32_t MaxAttributes = 8;
+
+private:
+  struct SectionRange
+  {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t count;
+  };
+  const SectionRange* FindSection(Section type) const;
+  const uint8_t* GetSectionData(Section type) const;
+  uint32_t GetSectionCount(Section type) const;
+
+  MappedFile m_mapped;
+  uint32_t m_vertexCount = 0, m_vertexStride = 0;
+  uint32_t m_indexCount = 0;
+  VkIndexType m_indexType = VK_INDEX_TYPE_UINT32;
+  std::vector<Attribute> m_attributes;
+  book_util::Aabb m_bounds = {};
+  bool m_isCompact = false;
+  bool m_isOptimized = false;
+  book_util::PositionQuantization m_quantization = {};
+  std::vector<std::pair<Section, SectionRange>> m_sections;
+};
@@ -0,0 +1,356 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+  struct Float3
+  {
+    float x, y, z;
+  };
+
+  Float3 Sub(const Float3& a, const Float3& b) { return Float3{ a.x - b.x, a.y - b.y, a.z - b.z }; }
+  Float3 Cross(const Float3& a, const Float3& b)
+  {
+    return Float3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+  }
+  float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+  Float3 LoadPosition(const void* vertices, uint32_t stride, uint32_t index)
+  {
+    Float3 p;
+    memcpy(&p, static_cast<const uint8_t*>(vertices) + size_t(stride) * index, sizeof(p));
+    return p;
+  }
+
+  // FIFO の頂点キャッシュ. 頂点ごとに入った時刻を持ち、cacheSize 回の挿入で追い出されたとみなす.
+  class FifoCache
+  {
+  public:
+    FifoCache(uint32_t vertexCount, uint32_t cacheSize)
+      : m_stamps(vertexCount, 0), m_time(cacheSize + 1), m_cacheSize(cacheSize) { }
+    // 入っていなければ挿入して true を返す.
+    bool Miss(uint32_t v)
+    {
+      if (m_time - m_stamps[v] > m_cacheSize)
+      {
+        m_stamps[v] = m_time++;
+        return true;
+      }
+      return false;
+    }
+    void Clear() { m_time += m_cacheSize + 1; }
+  private:
+    std::vector<uint32_t> m_stamps;
+    uint32_t m_time;
+    uint32_t m_cacheSize;
+  };
+}
+
+namespace book_util
+{
+  VertexCacheStatistics AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t cacheSize)
+  {
+    VertexCacheStatistics stats{ 0.0f, 0.0f };
+    if (indexCount < 3)
+    {
+      return stats;
+    }
+    FifoCache cache(vertexCount, cacheSize);
+    std::vector<uint8_t> isUsed(vertexCount, 0);
+    uint32_t misses = 0, usedCount = 0;
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+      auto v = indices[i];
+      misses += cache.Miss(v) ? 1 : 0;
+      usedCount += isUsed[v] ? 0 : 1;
+      isUsed[v] = 1;
+    }
+    stats.acmr = float(misses) / float(indexCount / 3);
+    stats.atvr = float(misses) / float(usedCount);
+    return stats;
+  }
+
+  void OptimizeVertexCache(uint32_t* dst, const uint32_t* indices, size_t indexCount, uint32_t vertexCount,
+    uint32_t cacheSize, std::vector<uint32_t>* clusters)
+  {
+    auto triangleCount = indexCount / 3;
+    if (clusters)
+    {
+      clusters->clear();
+    }
+    if (triangleCount == 0)
+    {
+      std::copy(indices, indices + indexCount, dst);
+      return;
+    }
+
+    // 頂点ごとに、それを使う三角形の一覧と未出力の三角形の数を作る.
+    std::vector<uint32_t> liveCount(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+    {
+      liveCount[indices[i]]++;
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+      offsets[v + 1] = offsets[v] + liveCount[v];
+    }
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+      auto cursor = offsets;
+      for (size_t i = 0; i < triangleCount * 3; ++i)
+      {
+        adjacency[cursor[indices[i]]++] = uint32_t(i / 3);
+      }
+    }
+
+    std::vector<uint32_t> stamps(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    std::vector<uint8_t> isEmitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnd;
+    deadEnd.reserve(triangleCount * 3);
+    std::vector<uint32_t> candidates;
+    uint32_t cursor = 0;
+    size_t written = 0;
+
+    // 候補が尽きたら、最近出力した頂点、次に番号順で未出力の三角形を持つ頂点を探す.
+    auto skipDeadEnd = [&]() -> int64_t
+    {
+      while (!deadEnd.empty())
+      {
+        auto d = deadEnd.back();
+        deadEnd.pop_back();
+        if (liveCount[d] > 0)
+        {
+          return d;
+        }
+      }
+      for (; cursor < vertexCount; ++cursor)
+      {
+        if (liveCount[cursor] > 0)
+        {
+          return cursor;
+        }
+      }
+      return -1;
+    };
+
+    if (clusters)
+    {
+      clusters->push_back(0);
+    }
+    int64_t fan = skipDeadEnd();
+    while (fan >= 0)
+    {
+      // fan を共有する未出力の三角形をすべて出力する.
+      candidates.clear();
+      for (auto k = offsets[size_t(fan)]; k < offsets[size_t(fan) + 1]; ++k)
+      {
+        auto t = adjacency[k];
+        if (isEmitted[t])
+        {
+          continue;
+        }
+        isEmitted[t] = 1;
+        for (int j = 0; j < 3; ++j)
+        {
+          auto v = indices[t * 3 + j];
+          dst[written++] = v;
+          deadEnd.push_back(v);
+          candidates.push_back(v);
+          liveCount[v]--;
+          if (time - stamps[v] > cacheSize)
+          {
+            stamps[v] = time++;
+          }
+        }
+      }
+
+      // 残りの三角形を出力しても追い出されない頂点のうち、最も古いものを次の中心とする.
+      int64_t next = -1;
+      int64_t bestPriority = -1;
+      for (auto v : candidates)
+      {
+        if (liveCount[v] == 0)
+        {
+          continue;
+        }
+        int64_t priority = 0;
+        if (time - stamps[v] + 2 * liveCount[v] <= cacheSize)
+        {
+          priority = time - stamps[v];
+        }
+        if (priority > bestPriority)
+        {
+          bestPriority = priority;
+          next = v;
+        }
+      }
+      if (next < 0)
+      {
+        next = skipDeadEnd();
+        if (clusters && next >= 0 && clusters->back() != uint32_t(written / 3))
+        {
+          clusters->push_back(uint32_t(written / 3));
+        }
+      }
+      fan = next;
+    }
+    // 三角形にならない端数はそのまま残す.
+    std::copy(indices + triangleCount * 3, indices + indexCount, dst + written);
+  }
+
+  void OptimizeOverdraw(uint32_t* dst, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, float threshold, uint32_t cacheSize)
+  {
+    auto triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+    {
+      std::copy(indices, indices + indexCount, dst);
+      return;
+    }
+    const uint32_t* ordered = indices;
+    FifoCache cache(vertexCount, cacheSize);
+    auto countMisses = [&](uint32_t t)
+    {
+      uint32_t misses = 0;
+      for (int j = 0; j < 3; ++j)
+      {
+        misses += cache.Miss(ordered[t * 3 + j]) ? 1 : 0;
+      }
+      return misses;
+    };
+
+    // 3 頂点ともキャッシュになかった三角形の位置で分ける(そこではキャッシュが途切れている).
+    std::vector<uint32_t> hardBoundaries;
+    for (uint32_t t = 0; t < uint32_t(triangleCount); ++t)
+    {
+      if (countMisses(t) == 3 && (hardBoundaries.empty() || t > 0))
+      {
+        hardBoundaries.push_back(t);
+      }
+    }
+    if (hardBoundaries.empty() || hardBoundaries.front() != 0)
+    {
+      hardBoundaries.insert(hardBoundaries.begin(), 0);
+    }
+    hardBoundaries.push_back(uint32_t(triangleCount));
+
+    // さらに、キャッシュを空にしても ACMR の悪化が threshold 倍以内となる位置で細かく分ける.
+    std::vector<uint32_t> boundaries;
+    for (size_t c = 0; c + 1 < hardBoundaries.size(); ++c)
+    {
+      auto begin = hardBoundaries[c], end = hardBoundaries[c + 1];
+      cache.Clear();
+      uint32_t clusterMisses = 0;
+      for (auto t = begin; t < end; ++t)
+      {
+        clusterMisses += countMisses(t);
+      }
+      float limit = float(clusterMisses) / float(end - begin) * threshold;
+
+      cache.Clear();
+      boundaries.push_back(begin);
+      uint32_t start = begin, misses = 0;
+      for (auto t = begin; t < end; ++t)
+      {
+        misses += countMisses(t);
+        if (t + 1 < end && float(misses) <= limit * float(t + 1 - start))
+        {
+          boundaries.push_back(t + 1);
+          start = t + 1;
+          misses = 0;
+          cache.Clear();
+        }
+      }
+    }
+    boundaries.push_back(uint32_t(triangleCount));
+
+    // クラスタごとの面積で重み付けした中心と法線を求め、メッシュの中心から外側を向いているものほど先に描く.
+    auto clusterCount = boundaries.size() - 1;
+    std::vector<Float3> centers(clusterCount);
+    std::vector<Float3> normals(clusterCount);
+    Float3 meshCenter{ 0.0f, 0.0f, 0.0f };
+    float meshArea = 0.0f;
+    for (size_t c = 0; c < clusterCount; ++c)
+    {
+      Float3 center{ 0.0f, 0.0f, 0.0f }, normal{ 0.0f, 0.0f, 0.0f };
+      float area = 0.0f;
+      for (auto t = boundaries[c]; t < boundaries[c + 1]; ++t)
+      {
+        auto p0 = LoadPosition(vertices, stride, ordered[t * 3 + 0]);
+        auto p1 = LoadPosition(vertices, stride, ordered[t * 3 + 1]);
+        auto p2 = LoadPosition(vertices, stride, ordered[t * 3 + 2]);
+        auto n = Cross(Sub(p1, p0), Sub(p2, p0));
+        auto a = std::sqrt(Dot(n, n));
+        center.x += (p0.x + p1.x + p2.x) * a;
+        center.y += (p0.y + p1.y + p2.y) * a;
+        center.z += (p0.z + p1.z + p2.z) * a;
+        normal.x += n.x;
+        normal.y += n.y;
+        normal.z += n.z;
+        area += a;
+      }
+      meshCenter.x += center.x;
+      meshCenter.y += center.y;
+      meshCenter.z += center.z;
+      meshArea += area;
+      float inv = area > 0.0f ? 1.0f / (area * 3.0f) : 0.0f;
+      centers[c] = Float3{ center.x * inv, center.y * inv, center.z * inv };
+      float len = std::sqrt(Dot(normal, normal));
+      normals[c] = len > 0.0f ? Float3{ normal.x / len, normal.y / len, normal.z / len } : normal;
+    }
+    if (meshArea > 0.0f)
+    {
+      float inv = 1.0f / (meshArea * 3.0f);
+      meshCenter = Float3{ meshCenter.x * inv, meshCenter.y * inv, meshCenter.z * inv };
+    }
+
+    std::vector<float> sortKeys(clusterCount);
+    std::vector<uint32_t> clusterOrder(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c)
+    {
+      sortKeys[c] = Dot(Sub(centers[c], meshCenter), normals[c]);
+      clusterOrder[c] = uint32_t(c);
+    }
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(),
+      [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    size_t written = 0;
+    for (auto c : clusterOrder)
+    {
+      auto begin = size_t(boundaries[c]) * 3, end = size_t(boundaries[c + 1]) * 3;
+      std::copy(ordered + begin, ordered + end, dst + written);
+      written += end - begin;
+    }
+    // 三角形にならない端数はそのまま残す.
+    std::copy(indices + triangleCount * 3, indices + indexCount, dst + written);
+  }
+
+  uint32_t OptimizeVertexFetch(uint32_t* remap, uint32_t* indices, size_t indexCount, uint32_t vertexCount)
+  {
+    const uint32_t unused = ~0u;
+    std::fill(remap, remap + vertexCount, unused);
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+      auto& v = indices[i];
+      if (remap[v] == unused)
+      {
+        remap[v] = next++;
+      }
+      v = remap[v];
+    }
+    auto usedCount = next;
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+      if (remap[v] == unused)
+      {
+        remap[v] = next++;
+      }
+    }
+    return usedCount;
+  }
+}
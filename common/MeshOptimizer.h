@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace book_util
+{
+  // 頂点変換後キャッシュの効率.
+  struct VertexCacheStatistics
+  {
+    float acmr;  // 三角形あたりの頂点シェーダー実行回数(0.5～3, 小さいほど良い).
+    float atvr;  // 使用する頂点あたりの実行回数(1 が最良).
+  };
+
+  struct MeshOptimizationResult
+  {
+    uint32_t triangleCount;
+    uint32_t vertexCount;
+    VertexCacheStatistics before;
+    VertexCacheStatistics after;
+  };
+
+  // 大きさ cacheSize の FIFO キャッシュを模擬して効率を求める.
+  VertexCacheStatistics AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t cacheSize = 16);
+
+  // 三角形リストの順序を Tipsify (Sander ら, 2007) で並べ替え、頂点変換後キャッシュの効率を上げる.
+  // clusters が null でなければ、キャッシュが途切れて次の三角形を探し直した位置(三角形の番号)を格納する.
+  void OptimizeVertexCache(uint32_t* dst, const uint32_t* indices, size_t indexCount, uint32_t vertexCount,
+    uint32_t cacheSize = 16, std::vector<uint32_t>* clusters = nullptr);
+
+  // キャッシュ向けに並べた indices を、ACMR の悪化が threshold 倍以内に収まる単位のクラスタに分け、
+  // 外側を向いたクラスタから描くよう並べ替えてオーバードローを減らす.
+  // 位置(float × 3)は各頂点の先頭にあること. stride は 1 頂点のバイト数.
+  void OptimizeOverdraw(uint32_t* dst, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, float threshold = 1.05f, uint32_t cacheSize = 16);
+
+  // 頂点を最初に参照された順へ並べ替える対応表 remap[旧番号] = 新番号 を作り、indices を書き換える.
+  // 参照されない頂点は元の順で後ろへ回す. 戻り値は参照された頂点の数.
+  uint32_t OptimizeVertexFetch(uint32_t* remap, uint32_t* indices, size_t indexCount, uint32_t vertexCount);
+
+  // 三角形リストのメッシュへ上記を順に適用する. T の先頭は位置(float × 3)であること.
+  template<class T>
+  MeshOptimizationResult OptimizeMesh(std::vector<T>& vertices, std::vector<uint32_t>& indices)
+  {
+    MeshOptimizationResult result;
+    auto vertexCount = uint32_t(vertices.size());
+    result.triangleCount = uint32_t(indices.size() / 3);
+    result.vertexCount = vertexCount;
+    result.before = AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+    // 元の順序がすでにキャッシュに適している場合(帯状に並んだ格子等)はそちらを基準にする.
+    std::vector<uint32_t> optimized(indices.size());
+    OptimizeVertexCache(optimized.data(), indices.data(), indices.size(), vertexCount);
+    if (AnalyzeVertexCache(optimized.data(), optimized.size(), vertexCount).acmr > result.before.acmr)
+    {
+      optimized = indices;
+    }
+    auto cacheOrdered = optimized;
+    auto cacheAcmr = AnalyzeVertexCache(cacheOrdered.data(), cacheOrdered.size(), vertexCount).acmr;
+    const float threshold = 1.05f;
+    OptimizeOverdraw(optimized.data(), cacheOrdered.data(), cacheOrdered.size(), vertices.data(), vertexCount, uint32_t(sizeof(T)), threshold);
+    if (AnalyzeVertexCache(optimized.data(), optimized.size(), vertexCount).acmr > cacheAcmr * threshold)
+    {
+      optimized.swap(cacheOrdered);
+    }
+
+    std::vector<uint32_t> remap(vertexCount);
+    OptimizeVertexFetch(remap.data(), optimized.data(), optimized.size(), vertexCount);
+    auto reordered = vertices;
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      reordered[remap[i]] = vertices[i];
+    }
+    vertices.swap(reordered);
+    indices.swap(optimized);
+
+    result.after = AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+    return result;
+  }
+}
@@ -0,0 +1,447 @@
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace book_util
+{
+  namespace
+  {
+    glm::vec3 ReadVector(const uint8_t* base, uint32_t stride, uint32_t index, uint32_t offset)
+    {
+      float v[3];
+      memcpy(v, base + size_t(stride) * index + offset, sizeof(v));
+      return glm::vec3(v[0], v[1], v[2]);
+    }
+
+    // 平面までの距離の 2 乗の(重み付きの)和を表す二次形式. weight は重みの和.
+    struct Quadric
+    {
+      double a00, a01, a02, a11, a12, a22;
+      double b0, b1, b2;
+      double c;
+      double weight;
+    };
+
+    // 単位法線 n、dot(n, p) + d = 0 の平面.
+    Quadric MakePlaneQuadric(const glm::vec3& n, float d, double weight)
+    {
+      Quadric q;
+      q.a00 = weight * n.x * n.x; q.a01 = weight * n.x * n.y; q.a02 = weight * n.x * n.z;
+      q.a11 = weight * n.y * n.y; q.a12 = weight * n.y * n.z; q.a22 = weight * n.z * n.z;
+      q.b0 = weight * n.x * d; q.b1 = weight * n.y * d; q.b2 = weight * n.z * d;
+      q.c = weight * d * d;
+      q.weight = weight;
+      return q;
+    }
+
+    void AddQuadric(Quadric& q, const Quadric& r)
+    {
+      q.a00 += r.a00; q.a01 += r.a01; q.a02 += r.a02;
+      q.a11 += r.a11; q.a12 += r.a12; q.a22 += r.a22;
+      q.b0 += r.b0; q.b1 += r.b1; q.b2 += r.b2;
+      q.c += r.c;
+      q.weight += r.weight;
+    }
+
+    // p における平面までの距離の 2 乗の重み付き平均.
+    double EvaluateQuadric(const Quadric& q, const glm::vec3& p)
+    {
+      double x = p.x, y = p.y, z = p.z;
+      double r = q.a00 * x * x + q.a11 * y * y + q.a22 * z * z
+        + 2.0 * (q.a01 * x * y + q.a02 * x * z + q.a12 * y * z)
+        + 2.0 * (q.b0 * x + q.b1 * y + q.b2 * z) + q.c;
+      return q.weight > 0.0 ? (std::max)(r, 0.0) / q.weight : 0.0;
+    }
+
+    struct Edge
+    {
+      uint32_t a, b;  // a < b
+      bool operator<(const Edge& e) const { return a < e.a || (a == e.a && b < e.b); }
+      bool operator==(const Edge& e) const { return a == e.a && b == e.b; }
+    };
+
+    struct Collapse
+    {
+      uint32_t from, to;
+      double cost;
+    };
+
+    enum VertexKind : uint8_t
+    {
+      Kind_Manifold,  // 内部の頂点.
+      Kind_Border,    // 境界(1 つの三角形にのみ属する辺)上の頂点.
+      Kind_Locked,    // 3 つ以上の三角形が共有する辺を持つ. 動かさない.
+    };
+
+    // 境界の辺を面と垂直な平面で拘束する際の重み.
+    const double BorderWeight = 10.0;
+  }
+
+  size_t SimplifyMesh(uint32_t* dst, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, uint32_t normalOffset,
+    size_t targetIndexCount, float targetError, float* resultError)
+  {
+    const auto base = static_cast<const uint8_t*>(vertices);
+    indexCount = indexCount / 3 * 3;
+    std::vector<glm::vec3> positions(vertexCount), normals(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      positions[i] = ReadVector(base, stride, i, 0);
+      normals[i] = ReadVector(base, stride, i, normalOffset);
+    }
+
+    // 同じ位置の頂点をまとめる. group[v] は代表の頂点番号、nextMember で同じ位置の頂点をたどる.
+    const uint32_t None = ~0u;
+    std::vector<uint32_t> group(vertexCount), nextMember(vertexCount, None);
+    {
+      std::vector<uint32_t> order(vertexCount);
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        order[i] = i;
+      }
+      auto less = [&](uint32_t l, uint32_t r)
+      {
+        const auto& p = positions[l];
+        const auto& q = positions[r];
+        return p.x < q.x || (p.x == q.x && (p.y < q.y || (p.y == q.y && (p.z < q.z || (p.z == q.z && l < r)))));
+      };
+      std::sort(order.begin(), order.end(), less);
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        bool isSame = i > 0 && positions[order[i]] == positions[order[i - 1]];
+        group[order[i]] = isSame ? group[order[i - 1]] : order[i];
+        if (isSame)
+        {
+          nextMember[order[i - 1]] = order[i];
+        }
+      }
+    }
+
+    std::vector<uint32_t> triangles(indices, indices + indexCount);
+    auto triangleGroup = [&](size_t t, int k) { return group[triangles[t * 3 + k]]; };
+    auto isDegenerate = [&](size_t t)
+    {
+      auto a = triangleGroup(t, 0), b = triangleGroup(t, 1), c = triangleGroup(t, 2);
+      return a == b || b == c || c == a;
+    };
+
+    // 位置ごとの辺の一覧(三角形ごとに 3 本. 同じ辺は共有する三角形の数だけ並ぶ).
+    std::vector<Edge> edges;
+    auto collectEdges = [&]()
+    {
+      edges.clear();
+      for (size_t t = 0; t < triangles.size() / 3; ++t)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          auto a = triangleGroup(t, k), b = triangleGroup(t, (k + 1) % 3);
+          edges.push_back(Edge{ (std::min)(a, b), (std::max)(a, b) });
+        }
+      }
+      std::sort(edges.begin(), edges.end());
+    };
+    auto countEdge = [&](uint32_t a, uint32_t b)
+    {
+      auto range = std::equal_range(edges.begin(), edges.end(), Edge{ (std::min)(a, b), (std::max)(a, b) });
+      return size_t(range.second - range.first);
+    };
+
+    // 各面の平面と、境界の辺を面と垂直な平面で拘束する二次形式を位置ごとに足し合わせる.
+    std::vector<Quadric> quadrics(vertexCount, Quadric());
+    collectEdges();
+    for (size_t t = 0; t < triangles.size() / 3; ++t)
+    {
+      if (isDegenerate(t))
+      {
+        continue;
+      }
+      uint32_t g[3] = { triangleGroup(t, 0), triangleGroup(t, 1), triangleGroup(t, 2) };
+      auto n = glm::cross(positions[g[1]] - positions[g[0]], positions[g[2]] - positions[g[0]]);
+      float length = glm::length(n);
+      if (length <= 0.0f)
+      {
+        continue;
+      }
+      n /= length;
+      auto plane = MakePlaneQuadric(n, -glm::dot(n, positions[g[0]]), length * 0.5);
+      for (int k = 0; k < 3; ++k)
+      {
+        AddQuadric(quadrics[g[k]], plane);
+        auto a = g[k], b = g[(k + 1) % 3];
+        if (countEdge(a, b) == 1)
+        {
+          auto edge = positions[b] - positions[a];
+          auto border = glm::cross(edge, n);
+          float borderLength = glm::length(border);
+          if (borderLength > 0.0f)
+          {
+            border /= borderLength;
+            auto q = MakePlaneQuadric(border, -glm::dot(border, positions[a]), BorderWeight * glm::dot(edge, edge));
+            AddQuadric(quadrics[a], q);
+            AddQuadric(quadrics[b], q);
+          }
+        }
+      }
+    }
+
+    const double errorLimit = double(targetError) * targetError;
+    double maxError = 0.0;
+    std::vector<uint8_t> kinds(vertexCount);
+    std::vector<uint8_t> locked(vertexCount);
+    std::vector<uint32_t> collapseTo(vertexCount);
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1), adjacency;
+    std::vector<Collapse> collapses;
+    while (triangles.size() > targetIndexCount)
+    {
+      // 縮退した三角形を除き、辺と隣接する三角形の一覧を作り直す.
+      size_t writeCount = 0;
+      for (size_t t = 0; t < triangles.size() / 3; ++t)
+      {
+        if (!isDegenerate(t))
+        {
+          std::copy(&triangles[t * 3], &triangles[t * 3] + 3, &triangles[writeCount * 3]);
+          ++writeCount;
+        }
+      }
+      triangles.resize(writeCount * 3);
+      if (triangles.size() <= targetIndexCount)
+      {
+        break;
+      }
+      collectEdges();
+
+      std::fill(kinds.begin(), kinds.end(), uint8_t(Kind_Manifold));
+      for (size_t i = 0; i < edges.size();)
+      {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j] == edges[i])
+        {
+          ++j;
+        }
+        uint8_t kind = (j - i == 1) ? Kind_Border : (j - i > 2) ? Kind_Locked : Kind_Manifold;
+        kinds[edges[i].a] = (std::max)(kinds[edges[i].a], kind);
+        kinds[edges[i].b] = (std::max)(kinds[edges[i].b], kind);
+        i = j;
+      }
+
+      std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0u);
+      for (size_t t = 0; t < triangles.size() / 3; ++t)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          ++adjacencyOffsets[triangleGroup(t, k) + 1];
+        }
+      }
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+      }
+      adjacency.resize(triangles.size());
+      {
+        auto fill = adjacencyOffsets;
+        for (size_t t = 0; t < triangles.size() / 3; ++t)
+        {
+          for (int k = 0; k < 3; ++k)
+          {
+            adjacency[fill[triangleGroup(t, k)]++] = uint32_t(t);
+          }
+        }
+      }
+
+      // 辺ごとに、縮約できる向きのうち誤差の小さいほうを候補とする.
+      auto canMove = [&](uint32_t from, bool isBorderEdge)
+      {
+        return kinds[from] == Kind_Manifold || (kinds[from] == Kind_Border && isBorderEdge);
+      };
+      collapses.clear();
+      for (size_t i = 0; i < edges.size();)
+      {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j] == edges[i])
+        {
+          ++j;
+        }
+        auto a = edges[i].a, b = edges[i].b;
+        bool isBorderEdge = (j - i == 1);
+        i = j;
+        Quadric q = quadrics[a];
+        AddQuadric(q, quadrics[b]);
+        Collapse best{ 0, 0, std::numeric_limits<double>::max() };
+        if (canMove(a, isBorderEdge))
+        {
+          best = Collapse{ a, b, EvaluateQuadric(q, positions[b]) };
+        }
+        if (canMove(b, isBorderEdge))
+        {
+          auto cost = EvaluateQuadric(q, positions[a]);
+          if (cost < best.cost)
+          {
+            best = Collapse{ b, a, cost };
+          }
+        }
+        if (best.cost <= errorLimit)
+        {
+          collapses.push_back(best);
+        }
+      }
+      std::sort(collapses.begin(), collapses.end(), [](const Collapse& l, const Collapse& r) { return l.cost < r.cost; });
+
+      // 誤差の小さい順に、互いの周囲が重ならないものをまとめて縮約する.
+      // 動かす頂点の周りの三角形が裏返る場合は行わない.
+      std::fill(locked.begin(), locked.end(), uint8_t(0));
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        collapseTo[i] = i;
+      }
+      size_t remaining = triangles.size() / 3;
+      size_t applied = 0;
+      for (const auto& c : collapses)
+      {
+        if (remaining * 3 <= targetIndexCount)
+        {
+          break;
+        }
+        if (locked[c.from] || locked[c.to])
+        {
+          continue;
+        }
+        bool isValid = true;
+        size_t removed = 0;
+        for (uint32_t k = adjacencyOffsets[c.from]; isValid && k < adjacencyOffsets[c.from + 1]; ++k)
+        {
+          auto t = adjacency[k];
+          glm::vec3 before[3], after[3];
+          bool hasTarget = false;
+          for (int n = 0; n < 3; ++n)
+          {
+            auto g = triangleGroup(t, n);
+            hasTarget = hasTarget || g == c.to;
+            before[n] = positions[g];
+            after[n] = (g == c.from) ? positions[c.to] : positions[g];
+          }
+          if (hasTarget)
+          {
+            ++removed;
+            continue;
+          }
+          auto n0 = glm::cross(before[1] - before[0], before[2] - before[0]);
+          auto n1 = glm::cross(after[1] - after[0], after[2] - after[0]);
+          isValid = glm::dot(n0, n1) > 0.0f;
+        }
+        if (!isValid)
+        {
+          continue;
+        }
+        collapseTo[c.from] = c.to;
+        for (uint32_t k = adjacencyOffsets[c.from]; k < adjacencyOffsets[c.from + 1]; ++k)
+        {
+          for (int n = 0; n < 3; ++n)
+          {
+            locked[triangleGroup(adjacency[k], n)] = 1;
+          }
+        }
+        AddQuadric(quadrics[c.to], quadrics[c.from]);
+        maxError = (std::max)(maxError, c.cost);
+        remaining -= (std::min)(remaining, removed);
+        ++applied;
+      }
+      if (applied == 0)
+      {
+        break;
+      }
+
+      // 縮約した位置を参照する角を、移動先の位置の頂点のうち法線が最も近いものへ付け替える.
+      for (auto& v : triangles)
+      {
+        auto to = collapseTo[group[v]];
+        if (to == group[v])
+        {
+          continue;
+        }
+        uint32_t best = to;
+        float bestDot = -2.0f;
+        for (auto m = to; m != None; m = nextMember[m])
+        {
+          float d = glm::dot(normals[m], normals[v]);
+          if (d > bestDot)
+          {
+            bestDot = d;
+            best = m;
+          }
+        }
+        v = best;
+      }
+    }
+
+    size_t writeCount = 0;
+    for (size_t t = 0; t < triangles.size() / 3; ++t)
+    {
+      if (!isDegenerate(t))
+      {
+        std::copy(&triangles[t * 3], &triangles[t * 3] + 3, dst + writeCount * 3);
+        ++writeCount;
+      }
+    }
+    if (resultError)
+    {
+      *resultError = float(std::sqrt(maxError));
+    }
+    return writeCount * 3;
+  }
+
+  void BuildLodChain(std::vector<MeshLod>& lods, std::vector<uint32_t>& lodIndices, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, uint32_t normalOffset, uint32_t maxLodCount)
+  {
+    indexCount = indexCount / 3 * 3;
+    lods.clear();
+    lodIndices.assign(indices, indices + indexCount);
+    lods.push_back(MeshLod{ 0, uint32_t(indexCount), 0.0f, 0 });
+
+    // 段ごとに元の形状から簡略化し、誤差を元の形状に対する値とする.
+    std::vector<uint32_t> simplified(indexCount), optimized;
+    size_t targetCount = indexCount;
+    float error = 0.0f;
+    while (lods.size() < maxLodCount)
+    {
+      targetCount = targetCount / 6 * 3;
+      if (targetCount < 3)
+      {
+        break;
+      }
+      float lodError = 0.0f;
+      auto count = SimplifyMesh(simplified.data(), indices, indexCount, vertices, vertexCount, stride, normalOffset,
+        targetCount, std::numeric_limits<float>::max(), &lodError);
+      // 前の段から 2 割も減らせなければ終える.
+      if (count == 0 || count * 5 > size_t(lods.back().indexCount) * 4)
+      {
+        break;
+      }
+      optimized.resize(count);
+      OptimizeVertexCache(optimized.data(), simplified.data(), count, vertexCount);
+      error = (std::max)(error, lodError);
+      lods.push_back(MeshLod{ uint32_t(lodIndices.size()), uint32_t(count), error, 0 });
+      lodIndices.insert(lodIndices.end(), optimized.begin(), optimized.end());
+    }
+  }
+
+  uint32_t SelectLod(const MeshLod* lods, uint32_t lodCount, float distance, float pixelsPerUnit, float maxPixelError)
+  {
+    if (distance <= 0.0f)
+    {
+      return 0;
+    }
+    uint32_t selected = 0;
+    for (uint32_t i = 1; i < lodCount; ++i)
+    {
+      if (lods[i].error * pixelsPerUnit / distance <= maxPixelError)
+      {
+        selected = i;
+      }
+    }
+    return selected;
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace book_util
+{
+  // 詳細度(LOD)の 1 段. 三角形はインデックスバッファの indexOffset から indexCount 個.
+  // error は元の形状からのずれの目安(モデル空間での距離). LOD 0 は 0.
+  struct MeshLod
+  {
+    uint32_t indexOffset;
+    uint32_t indexCount;
+    float error;
+    uint32_t reserved;
+  };
+  static_assert(sizeof(MeshLod) == 16, "MeshLod must be 16 bytes.");
+
+  const uint32_t MeshMaxLodCount = 4;
+
+  // Garland と Heckbert (1997) の二次誤差(QEM)による辺の縮約で三角形リストを簡略化し、dst へ書き込んだインデックス数を返す.
+  // 頂点は追加せず既存の頂点へ寄せるため、結果は元の頂点バッファのまま描画できる.
+  // 同じ位置の頂点(法線の異なる継ぎ目)は 1 つとして縮約し、各角には元の法線に最も近い頂点を選ぶ.
+  // 境界の頂点は境界の辺に沿ってのみ動かす. 三角形が targetIndexCount 以下になるか、誤差が targetError を超える手前で止める.
+  // 位置(float × 3)は各頂点の先頭、法線(float × 3)は normalOffset にあること. dst は indexCount 個分の大きさが必要.
+  size_t SimplifyMesh(uint32_t* dst, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, uint32_t normalOffset,
+    size_t targetIndexCount, float targetError, float* resultError = nullptr);
+
+  // indices を LOD 0 とし、三角形をおよそ半分ずつ減らした詳細度を maxLodCount 段まで作る.
+  // 各段は元の形状から簡略化し、頂点キャッシュ向けに並べ替える. 減らせなくなった場合はそこで終える.
+  // lodIndices にはすべての段のインデックスを LOD 0 から順に続けて格納する.
+  void BuildLodChain(std::vector<MeshLod>& lods, std::vector<uint32_t>& lodIndices, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride, uint32_t normalOffset, uint32_t maxLodCount = MeshMaxLodCount);
+
+  // 画面上のずれが maxPixelError 以下に収まる最も粗い段を選ぶ.
+  // distance はカメラから物体(を包む球の表面)までの距離で、拡大縮小している場合はその倍率で割っておく.
+  // pixelsPerUnit は距離 1 にある長さ 1 が何ピクセルになるか(投影行列の [1][1] × ビューポートの高さ / 2).
+  uint32_t SelectLod(const MeshLod* lods, uint32_t lodCount, float distance, float pixelsPerUnit, float maxPixelError = 1.0f);
+}
@@ -0,0 +1,210 @@
+#include "Meshlet.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace book_util
+{
+  namespace
+  {
+    glm::vec3 GetPosition(const uint8_t* base, uint32_t stride, uint32_t index)
+    {
+      float p[3];
+      memcpy(p, base + size_t(stride) * index, sizeof(p));
+      return glm::vec3(p[0], p[1], p[2]);
+    }
+
+    // Ritter の方法で頂点を包む球を求める(最小ではないが 5% 程度の誤差に収まる).
+    void ComputeBoundingSphere(const std::vector<glm::vec3>& points, glm::vec3& center, float& radius)
+    {
+      // 各軸で最も離れた 2 点のうち、距離が最大の組を初期の直径とする.
+      size_t minIndex[3] = { 0, 0, 0 }, maxIndex[3] = { 0, 0, 0 };
+      for (size_t i = 1; i < points.size(); ++i)
+      {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          minIndex[axis] = points[i][axis] < points[minIndex[axis]][axis] ? i : minIndex[axis];
+          maxIndex[axis] = points[i][axis] > points[maxIndex[axis]][axis] ? i : maxIndex[axis];
+        }
+      }
+      int best = 0;
+      float bestDistance = -1.0f;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        auto d = points[maxIndex[axis]] - points[minIndex[axis]];
+        if (glm::dot(d, d) > bestDistance)
+        {
+          bestDistance = glm::dot(d, d);
+          best = axis;
+        }
+      }
+      center = (points[minIndex[best]] + points[maxIndex[best]]) * 0.5f;
+      radius = std::sqrt(bestDistance) * 0.5f;
+
+      // 外側の点を含むよう広げる.
+      for (const auto& p : points)
+      {
+        float distance = glm::length(p - center);
+        if (distance > radius)
+        {
+          float newRadius = (radius + distance) * 0.5f;
+          center += (p - center) * ((newRadius - radius) / distance);
+          radius = newRadius;
+        }
+      }
+    }
+
+    void ComputeMeshletBounds(Meshlet& meshlet, const MeshletMesh& mesh, const uint8_t* base, uint32_t stride)
+    {
+      std::vector<glm::vec3> points(meshlet.vertexCount);
+      for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+      {
+        points[i] = GetPosition(base, stride, mesh.vertices[meshlet.vertexOffset + i]);
+      }
+      glm::vec3 center;
+      float radius;
+      ComputeBoundingSphere(points, center, radius);
+
+      // 法線の向きの範囲. 軸は面の法線の平均とし、軸から最も離れた法線との角度 α を求める.
+      // 視線と軸のなす角が 90°- α 未満であれば、すべての面を裏から見ていることになる.
+      std::vector<glm::vec3> normals;
+      normals.reserve(meshlet.triangleCount);
+      glm::vec3 axis(0.0f);
+      for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+      {
+        const auto* tri = &mesh.triangles[(meshlet.triangleOffset + t) * 3];
+        auto p0 = points[tri[0]], p1 = points[tri[1]], p2 = points[tri[2]];
+        auto n = glm::cross(p1 - p0, p2 - p0);
+        float len = glm::length(n);
+        if (len > 0.0f)
+        {
+          normals.push_back(n / len);
+          axis += n / len;
+        }
+      }
+      float cutoff = 1.0f;
+      float axisLength = glm::length(axis);
+      if (axisLength > 1e-4f && !normals.empty())
+      {
+        axis /= axisLength;
+        float minDot = 1.0f;
+        for (const auto& n : normals)
+        {
+          minDot = (std::min)(minDot, glm::dot(n, axis));
+        }
+        if (minDot > 0.0f)
+        {
+          cutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+      }
+      else
+      {
+        axis = glm::vec3(0.0f, 0.0f, 1.0f);
+      }
+
+      for (int i = 0; i < 3; ++i)
+      {
+        meshlet.center[i] = center[i];
+        meshlet.coneAxis[i] = axis[i];
+      }
+      meshlet.radius = radius;
+      meshlet.coneCutoff = cutoff;
+    }
+  }
+
+  void BuildMeshlets(MeshletMesh& mesh, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride,
+    uint32_t maxVertices, uint32_t maxTriangles)
+  {
+    mesh.meshlets.clear();
+    mesh.vertices.clear();
+    mesh.triangles.clear();
+    const auto base = static_cast<const uint8_t*>(vertices);
+    // メッシュレット内の頂点番号は 8 ビットで持つ.
+    maxVertices = (std::min)(maxVertices, 256u);
+
+    // 頂点ごとの、作成中のメッシュレット内での番号.
+    const uint32_t NotAssigned = ~0u;
+    std::vector<uint32_t> localIndex(vertexCount, NotAssigned);
+    Meshlet current{};
+    auto finish = [&]()
+    {
+      if (current.triangleCount == 0)
+      {
+        return;
+      }
+      ComputeMeshletBounds(current, mesh, base, stride);
+      for (uint32_t i = 0; i < current.vertexCount; ++i)
+      {
+        localIndex[mesh.vertices[current.vertexOffset + i]] = NotAssigned;
+      }
+      mesh.meshlets.push_back(current);
+      current = Meshlet{};
+      current.vertexOffset = uint32_t(mesh.vertices.size());
+      current.triangleOffset = uint32_t(mesh.triangles.size() / 3);
+    };
+
+    for (size_t i = 0; i + 2 < indexCount; i += 3)
+    {
+      const uint32_t* tri = indices + i;
+      uint32_t newVertices = 0;
+      for (int k = 0; k < 3; ++k)
+      {
+        bool isDuplicate = (k > 0 && tri[k] == tri[0]) || (k > 1 && tri[k] == tri[1]);
+        newVertices += (localIndex[tri[k]] == NotAssigned && !isDuplicate) ? 1 : 0;
+      }
+      if (current.vertexCount + newVertices > maxVertices || current.triangleCount + 1 > maxTriangles)
+      {
+        finish();
+      }
+      for (int k = 0; k < 3; ++k)
+      {
+        if (localIndex[tri[k]] == NotAssigned)
+        {
+          localIndex[tri[k]] = current.vertexCount++;
+          mesh.vertices.push_back(tri[k]);
+        }
+        mesh.triangles.push_back(uint8_t(localIndex[tri[k]]));
+      }
+      ++current.triangleCount;
+    }
+    finish();
+  }
+
+  bool IsMeshletVisible(const Meshlet& meshlet, const glm::mat4& world, const Frustum& frustum, const glm::vec3& cameraPos,
+    bool isBackfaceCulled)
+  {
+    auto center = glm::vec3(world * glm::vec4(meshlet.center[0], meshlet.center[1], meshlet.center[2], 1.0f));
+    float scale = (std::max)((std::max)(glm::length(glm::vec3(world[0])), glm::length(glm::vec3(world[1]))), glm::length(glm::vec3(world[2])));
+    float radius = meshlet.radius * scale;
+    if (!frustum.IsVisible(center, radius))
+    {
+      return false;
+    }
+    if (!isBackfaceCulled || meshlet.coneCutoff >= 1.0f)
+    {
+      return true;
+    }
+    // 球内のどの点へ向かう視線も軸との角度が 90°- α 未満であれば裏向き.
+    auto axis = glm::normalize(glm::mat3(world) * glm::vec3(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]));
+    auto view = center - cameraPos;
+    return glm::dot(view, axis) < meshlet.coneCutoff * glm::length(view) + radius * (1.0f + meshlet.coneCutoff);
+  }
+
+  uint32_t CullMeshlets(const Meshlet* meshlets, uint32_t count, const glm::mat4& world,
+    const Frustum& frustum, const glm::vec3& cameraPos, bool isBackfaceCulled, uint8_t* visible)
+  {
+    uint32_t triangleCount = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      bool isVisible = IsMeshletVisible(meshlets[i], world, frustum, cameraPos, isBackfaceCulled);
+      triangleCount += isVisible ? meshlets[i].triangleCount : 0;
+      if (visible)
+      {
+        visible[i] = isVisible ? 1 : 0;
+      }
+    }
+    return triangleCount;
+  }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Frustum.h"
+
+namespace book_util
+{
+  // 少数の三角形をまとめた単位(メッシュレット). 48 バイトで、シェーダーからは std430 のバッファとして参照する.
+  // center、radius は包む球、coneAxis、coneCutoff は面の法線の向きの範囲(裏向きの判定用).
+  struct Meshlet
+  {
+    uint32_t vertexOffset;    // MeshletMesh::vertices 内の位置.
+    uint32_t triangleOffset;  // 三角形単位の位置. インデックスバッファ内の位置(の 1/3)と一致する.
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    float center[3];
+    float radius;
+    float coneAxis[3];
+    float coneCutoff;         // 法線の広がりの sin. 広がりが 90 度以上で判定できない場合は 1.
+  };
+  static_assert(sizeof(Meshlet) == 48, "Meshlet must be 48 bytes.");
+
+  struct MeshletMesh
+  {
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> vertices;   // 各メッシュレットが参照する頂点番号.
+    std::vector<uint8_t> triangles;   // メッシュレット内の頂点番号を 3 つずつ並べたもの.
+  };
+
+  const uint32_t MeshletMaxVertices = 64;
+  const uint32_t MeshletMaxTriangles = 124;
+
+  // 三角形リストを indices の順に詰めてメッシュレットに分ける.
+  // 順序を変えないため、メッシュレットの三角形はインデックスバッファの triangleOffset * 3 から triangleCount * 3 個と一致し、
+  // インデックスバッファをそのまま使って間接描画できる. 頂点キャッシュ向けに並べ替えた後であれば空間的にもまとまる.
+  // 位置(float × 3)は各頂点の先頭にあること. stride は 1 頂点のバイト数.
+  void BuildMeshlets(MeshletMesh& mesh, const uint32_t* indices, size_t indexCount,
+    const void* vertices, uint32_t vertexCount, uint32_t stride,
+    uint32_t maxVertices = MeshletMaxVertices, uint32_t maxTriangles = MeshletMaxTriangles);
+
+  // world で配置したメッシュレットが見えるか. 視錐台の外側にあれば見えない.
+  // isBackfaceCulled が true の場合は、cameraPos から見てすべての面が裏向きのものも見えないとする.
+  // 背面カリングを行わないパイプラインで true にすると、閉じていない形状の穴から見える裏面まで除かれるため false とすること.
+  // world は回転、平行移動、一様な拡大縮小のみとする. 判定は meshletCullCS.comp と同じ.
+  bool IsMeshletVisible(const Meshlet& meshlet, const glm::mat4& world, const Frustum& frustum, const glm::vec3& cameraPos,
+    bool isBackfaceCulled);
+
+  // まとめて判定し visible[i] に 0/1 を書き込み(visible は null でもよい)、見えるメッシュレットの三角形の数を返す.
+  uint32_t CullMeshlets(const Meshlet* meshlets, uint32_t count, const glm::mat4& world,
+    const Frustum& frustum, const glm::vec3& cameraPos, bool isBackfaceCulled, uint8_t* visible = nullptr);
+}
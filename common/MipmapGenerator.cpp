@@ -0,0 +1,366 @@
+#include "MipmapGenerator.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MIPMAP_USE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  // Kaiser 窓の sinc フィルタ. 縮小後の 1 ピクセルを単位として半径 3 の範囲を使う.
+  // 縮小率が常に 1/2 のため、縮小後のピクセル中心に対する元画像の 12 ピクセルの重みは位置によらず一定となる.
+  const int KaiserTaps = 12;
+  const int KaiserLeft = 5;  // 2x - 5 ～ 2x + 6 を参照する.
+  const double KaiserRadius = 3.0;
+  const double KaiserAlpha = 4.0;
+
+  // 第 1 種変形ベッセル関数 I0.
+  double BesselI0(double x)
+  {
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; ++k)
+    {
+      term *= (x * 0.5 / k) * (x * 0.5 / k);
+      sum += term;
+    }
+    return sum;
+  }
+
+  struct KaiserWeights
+  {
+    float w[KaiserTaps];
+    KaiserWeights()
+    {
+      const double pi = 3.14159265358979323846;
+      double total = 0.0;
+      double tmp[KaiserTaps];
+      for (int k = 0; k < KaiserTaps; ++k)
+      {
+        // 元画像のピクセル 2x + (k - KaiserLeft) の中心から、縮小後のピクセル中心までの距離.
+        double d = (double(k - KaiserLeft) - 0.5) * 0.5;
+        double sinc = std::sin(pi * d) / (pi * d);
+        double r = d / KaiserRadius;
+        double window = BesselI0(KaiserAlpha * std::sqrt((std::max)(1.0 - r * r, 0.0))) / BesselI0(KaiserAlpha);
+        tmp[k] = sinc * window;
+        total += tmp[k];
+      }
+      for (int k = 0; k < KaiserTaps; ++k)
+      {
+        w[k] = float(tmp[k] / total);
+      }
+    }
+  };
+
+  const KaiserWeights& GetKaiserWeights()
+  {
+    static const KaiserWeights weights;
+    return weights;
+  }
+
+  uint8_t ToUnorm8(float v)
+  {
+    v = (std::min)((std::max)(v, 0.0f), 255.0f);
+    return uint8_t(v + 0.5f);
+  }
+
+  struct DownsampleParams
+  {
+    const uint8_t* src;
+    uint32_t width, height, components;
+    uint8_t* dst;
+    uint32_t dstWidth, dstHeight;
+  };
+
+  void BoxRowScalar(const DownsampleParams& p, const uint8_t* row0, const uint8_t* row1, uint8_t* dst, uint32_t xBegin)
+  {
+    const auto c = p.components;
+    for (uint32_t x = xBegin; x < p.dstWidth; ++x)
+    {
+      auto x0 = (std::min)(x * 2, p.width - 1) * c;
+      auto x1 = (std::min)(x * 2 + 1, p.width - 1) * c;
+      for (uint32_t ch = 0; ch < c; ++ch)
+      {
+        uint32_t sum = row0[x0 + ch] + row0[x1 + ch] + row1[x0 + ch] + row1[x1 + ch];
+        dst[x * c + ch] = uint8_t((sum + 2) / 4);
+      }
+    }
+  }
+
+#ifdef MIPMAP_USE_SIMD
+  // 4 チャンネル. 元画像の 8 ピクセルから 4 ピクセルを作る.
+  uint32_t BoxRowSSE2RGBA(const DownsampleParams& p, const uint8_t* row0, const uint8_t* row1, uint8_t* dst)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+    uint32_t x = 0;
+    for (; x + 4 <= p.dstWidth && x * 2 + 8 <= p.width; x += 4)
+    {
+      __m128i out[2];
+      for (int half = 0; half < 2; ++half)
+      {
+        auto offset = (x * 2 + half * 4) * 4;
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + offset));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + offset));
+        // 縦方向の和. lo = p0,p1 / hi = p2,p3.
+        __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        // 横方向の和. (p0+p1), (p2+p3).
+        __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+        out[half] = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(out[0], out[1]));
+    }
+    return x;
+  }
+
+  // 1 チャンネル. 元画像の 16 ピクセルから 8 ピクセルを作る.
+  uint32_t BoxRowSSE2R(const DownsampleParams& p, const uint8_t* row0, const uint8_t* row1, uint8_t* dst)
+  {
+    const __m128i mask = _mm_set1_epi16(0xFF);
+    const __m128i round = _mm_set1_epi16(2);
+    uint32_t x = 0;
+    for (; x + 8 <= p.dstWidth && x * 2 + 16 <= p.width; x += 8)
+    {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 2));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 2));
+      // 偶数番目と奇数番目のピクセルを 16bit へ分けて足し合わせる.
+      __m128i sum = _mm_add_epi16(
+        _mm_add_epi16(_mm_and_si128(a, mask), _mm_srli_epi16(a, 8)),
+        _mm_add_epi16(_mm_and_si128(b, mask), _mm_srli_epi16(b, 8)));
+      sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(sum, sum));
+    }
+    return x;
+  }
+#endif
+
+  void BoxRows(const DownsampleParams& p, uint32_t yBegin, uint32_t yEnd)
+  {
+    const size_t srcStride = size_t(p.width) * p.components;
+    const size_t dstStride = size_t(p.dstWidth) * p.components;
+    for (uint32_t y = yBegin; y < yEnd; ++y)
+    {
+      auto row0 = p.src + (std::min)(y * 2, p.height - 1) * srcStride;
+      auto row1 = p.src + (std::min)(y * 2 + 1, p.height - 1) * srcStride;
+      auto dst = p.dst + y * dstStride;
+      uint32_t x = 0;
+#ifdef MIPMAP_USE_SIMD
+      if (p.components == 4)
+      {
+        x = BoxRowSSE2RGBA(p, row0, row1, dst);
+      }
+      else if (p.components == 1)
+      {
+        x = BoxRowSSE2R(p, row0, row1, dst);
+      }
+#endif
+      BoxRowScalar(p, row0, row1, dst, x);
+    }
+  }
+
+  // 縦方向のフィルタ. 12 行を重み付きで足し合わせ、左右を端の値で埋めた行を作る.
+  void KaiserVertical(const DownsampleParams& p, uint32_t y, float* padded)
+  {
+    const auto& weights = GetKaiserWeights();
+    const size_t srcStride = size_t(p.width) * p.components;
+    const uint8_t* rows[KaiserTaps];
+    for (int k = 0; k < KaiserTaps; ++k)
+    {
+      int r = int(y * 2) + k - KaiserLeft;
+      r = (std::min)((std::max)(r, 0), int(p.height) - 1);
+      rows[k] = p.src + r * srcStride;
+    }
+    float* out = padded + KaiserLeft * p.components;
+    size_t i = 0;
+#ifdef MIPMAP_USE_SIMD
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= srcStride; i += 16)
+    {
+      __m128 acc[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+      for (int k = 0; k < KaiserTaps; ++k)
+      {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k] + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        __m128 w = _mm_set1_ps(weights.w[k]);
+        acc[0] = _mm_add_ps(acc[0], _mm_mul_ps(w, _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero))));
+        acc[1] = _mm_add_ps(acc[1], _mm_mul_ps(w, _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero))));
+        acc[2] = _mm_add_ps(acc[2], _mm_mul_ps(w, _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero))));
+        acc[3] = _mm_add_ps(acc[3], _mm_mul_ps(w, _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero))));
+      }
+      for (int j = 0; j < 4; ++j)
+      {
+        _mm_storeu_ps(out + i + j * 4, acc[j]);
+      }
+    }
+#endif
+    for (; i < srcStride; ++i)
+    {
+      float sum = 0.0f;
+      for (int k = 0; k < KaiserTaps; ++k)
+      {
+        sum += weights.w[k] * rows[k][i];
+      }
+      out[i] = sum;
+    }
+
+    // 横方向で範囲外を参照する分は端のピクセルで埋める.
+    const auto c = p.components;
+    const uint32_t rightPad = KaiserTaps - KaiserLeft + 1;
+    for (uint32_t x = 0; x < KaiserLeft; ++x)
+    {
+      memcpy(padded + x * c, out, sizeof(float) * c);
+    }
+    for (uint32_t x = 0; x < rightPad; ++x)
+    {
+      memcpy(out + (p.width + x) * c, out + (p.width - 1) * c, sizeof(float) * c);
+    }
+  }
+
+  void KaiserHorizontal(const DownsampleParams& p, const float* padded, uint8_t* dst)
+  {
+    const auto& weights = GetKaiserWeights();
+    const auto c = p.components;
+    uint32_t x = 0;
+#ifdef MIPMAP_USE_SIMD
+    if (c == 4)
+    {
+      for (; x < p.dstWidth; ++x)
+      {
+        // padded 上では 2x - KaiserLeft の位置が先頭となる.
+        const float* s = padded + size_t(x) * 2 * 4;
+        __m128 acc = _mm_setzero_ps();
+        for (int k = 0; k < KaiserTaps; ++k)
+        {
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights.w[k]), _mm_loadu_ps(s + k * 4)));
+        }
+        __m128i v = _mm_cvtps_epi32(acc);
+        v = _mm_packs_epi32(v, v);
+        v = _mm_packus_epi16(v, v);
+        *reinterpret_cast<int32_t*>(dst + x * 4) = _mm_cvtsi128_si32(v);
+      }
+    }
+#endif
+    for (; x < p.dstWidth; ++x)
+    {
+      const float* s = padded + size_t(x) * 2 * c;
+      for (uint32_t ch = 0; ch < c; ++ch)
+      {
+        float sum = 0.0f;
+        for (int k = 0; k < KaiserTaps; ++k)
+        {
+          sum += weights.w[k] * s[k * c + ch];
+        }
+        dst[x * c + ch] = ToUnorm8(sum);
+      }
+    }
+  }
+
+  void KaiserRows(const DownsampleParams& p, uint32_t yBegin, uint32_t yEnd)
+  {
+    // 左右に端の値を埋める分を含めた 1 行分の作業領域.
+    std::vector<float> padded(size_t(p.width + KaiserTaps + 1) * p.components);
+    const size_t dstStride = size_t(p.dstWidth) * p.components;
+    for (uint32_t y = yBegin; y < yEnd; ++y)
+    {
+      KaiserVertical(p, y, padded.data());
+      KaiserHorizontal(p, padded.data(), p.dst + y * dstStride);
+    }
+  }
+
+  // 小さい画像はスレッドを起動する方が高くつくため分割しない.
+  const uint32_t MinPixelsPerThread = 64 * 1024;
+}
+
+namespace book_util
+{
+  uint32_t GetMipmapLevelCount(uint32_t width, uint32_t height)
+  {
+    uint32_t count = 1;
+    while (width > 1 || height > 1)
+    {
+      width = (std::max)(width / 2, 1u);
+      height = (std::max)(height / 2, 1u);
+      ++count;
+    }
+    return count;
+  }
+
+  void DownsampleImage(const uint8_t* src, uint32_t width, uint32_t height, uint32_t components,
+    uint8_t* dst, MipmapFilter filter, uint32_t threadCount)
+  {
+    DownsampleParams p{ src, width, height, components, dst, (std::max)(width / 2, 1u), (std::max)(height / 2, 1u) };
+    auto process = (filter == MipmapFilter::Kaiser) ? KaiserRows : BoxRows;
+
+    if (threadCount == 0)
+    {
+      threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+    const uint64_t pixels = uint64_t(p.dstWidth) * p.dstHeight;
+    threadCount = uint32_t((std::min)(uint64_t(threadCount), (std::max)(pixels / MinPixelsPerThread, uint64_t(1))));
+    threadCount = (std::min)(threadCount, p.dstHeight);
+    if (threadCount <= 1)
+    {
+      process(p, 0, p.dstHeight);
+      return;
+    }
+
+    // 縮小後の行を帯に分けて各スレッドで処理する.
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    const uint32_t rowsPerThread = (p.dstHeight + threadCount - 1) / threadCount;
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+      uint32_t begin = i * rowsPerThread;
+      uint32_t end = (std::min)(begin + rowsPerThread, p.dstHeight);
+      if (begin < end)
+      {
+        threads.emplace_back(process, std::cref(p), begin, end);
+      }
+    }
+    process(p, 0, (std::min)(rowsPerThread, p.dstHeight));
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+  }
+
+  std::vector<MipmapLevel> GenerateMipmaps(const uint8_t* src, uint32_t width, uint32_t height, uint32_t components,
+    MipmapFilter filter, std::vector<uint8_t>& pixels, uint32_t threadCount)
+  {
+    std::vector<MipmapLevel> levels(GetMipmapLevelCount(width, height));
+    size_t offset = 0;
+    for (auto& level : levels)
+    {
+      level.width = width;
+      level.height = height;
+      level.offset = offset;
+      level.size = size_t(width) * height * components;
+      offset += level.size;
+      width = (std::max)(width / 2, 1u);
+      height = (std::max)(height / 2, 1u);
+    }
+    pixels.resize(offset);
+    memcpy(pixels.data(), src, levels[0].size);
+    for (size_t i = 1; i < levels.size(); ++i)
+    {
+      const auto& prev = levels[i - 1];
+      DownsampleImage(pixels.data() + prev.offset, prev.width, prev.height, components,
+        pixels.data() + levels[i].offset, filter, threadCount);
+    }
+    return levels;
+  }
+
+  const char* GetMipmapInstructionSet()
+  {
+#ifdef MIPMAP_USE_SIMD
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
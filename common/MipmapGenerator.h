@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace book_util
+{
+  // CPU で 1/2 に縮小する際のフィルタ.
+  enum class MipmapFilter
+  {
+    Box,     // 2x2 の平均.
+    Kaiser,  // Kaiser 窓の sinc (12 タップ). 高周波の折り返しが少ない.
+  };
+
+  struct MipmapLevel
+  {
+    uint32_t width, height;
+    size_t offset;  // 画素データ先頭からの位置.
+    size_t size;
+  };
+
+  // 1x1 までのレベル数.
+  uint32_t GetMipmapLevelCount(uint32_t width, uint32_t height);
+
+  // 8bit × components(1～4) チャンネルの画像を縦横 1/2 (最小 1) に縮小して dst へ書き込む.
+  // 奇数サイズの場合は最後の行、列を捨てる. threadCount が 0 ならハードウェアのスレッド数を使う.
+  void DownsampleImage(const uint8_t* src, uint32_t width, uint32_t height, uint32_t components,
+    uint8_t* dst, MipmapFilter filter, uint32_t threadCount = 0);
+
+  // src をレベル 0 として 1x1 までの全レベルを pixels へ連続して格納し、各レベルの位置を返す.
+  std::vector<MipmapLevel> GenerateMipmaps(const uint8_t* src, uint32_t width, uint32_t height, uint32_t components,
+    MipmapFilter filter, std::vector<uint8_t>& pixels, uint32_t threadCount = 0);
+
+  // 実行環境で使用している命令セットの名前("sse2"/"scalar").
+  const char* GetMipmapInstructionSet();
+}
@@ -0,0 +1,412 @@
+#include "PixelConvert.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PIXEL_CONVERT_USE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  // 小さい画像はスレッドを起動する方が高くつくため分割しない.
+  const uint32_t MinPixelsPerThread = 128 * 1024;
+
+  // 行を帯に分けて process(yBegin, yEnd) を各スレッドで呼び出す.
+  template<class Process>
+  void ParallelRows(uint32_t width, uint32_t height, uint32_t threadCount, const Process& process)
+  {
+    if (threadCount == 0)
+    {
+      threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+    const uint64_t pixels = uint64_t(width) * height;
+    threadCount = uint32_t((std::min)(uint64_t(threadCount), (std::max)(pixels / MinPixelsPerThread, uint64_t(1))));
+    threadCount = (std::min)(threadCount, (std::max)(height, 1u));
+    if (threadCount <= 1)
+    {
+      process(0u, height);
+      return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    const uint32_t rowsPerThread = (height + threadCount - 1) / threadCount;
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+      uint32_t begin = i * rowsPerThread;
+      uint32_t end = (std::min)(begin + rowsPerThread, height);
+      if (begin < end)
+      {
+        threads.emplace_back([&process, begin, end]() { process(begin, end); });
+      }
+    }
+    process(0u, (std::min)(rowsPerThread, height));
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+  }
+
+  uint8_t Luminance(uint8_t r, uint8_t g, uint8_t b)
+  {
+    return uint8_t((r * 77 + g * 150 + b * 29) >> 8);
+  }
+
+  // 1 行分のチャンネル数の変換. SIMD で処理しきれなかった残りのピクセルにも使う.
+  void ConvertChannelsScalar(const uint8_t* src, uint32_t srcComponents, uint8_t* dst, uint32_t dstComponents,
+    uint32_t xBegin, uint32_t width)
+  {
+    src += size_t(xBegin) * srcComponents;
+    dst += size_t(xBegin) * dstComponents;
+    for (uint32_t x = xBegin; x < width; ++x, src += srcComponents, dst += dstComponents)
+    {
+      // いったん輝度、RGB、アルファへ分けてから出力のチャンネルへ並べる.
+      uint8_t r, g, b, a = 255;
+      switch (srcComponents)
+      {
+      case 1: r = g = b = src[0]; break;
+      case 2: r = g = b = src[0]; a = src[1]; break;
+      case 3: r = src[0]; g = src[1]; b = src[2]; break;
+      default: r = src[0]; g = src[1]; b = src[2]; a = src[3]; break;
+      }
+      switch (dstComponents)
+      {
+      case 1:
+        dst[0] = srcComponents <= 2 ? r : Luminance(r, g, b);
+        break;
+      case 2:
+        dst[0] = srcComponents <= 2 ? r : Luminance(r, g, b);
+        dst[1] = a;
+        break;
+      case 3:
+        dst[0] = r; dst[1] = g; dst[2] = b;
+        break;
+      default:
+        dst[0] = r; dst[1] = g; dst[2] = b; dst[3] = a;
+        break;
+      }
+    }
+  }
+
+#ifdef PIXEL_CONVERT_USE_SIMD
+  int32_t LoadInt32(const uint8_t* p)
+  {
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  // RGB -> RGBA. 4 ピクセルずつ 4 バイト単位で読み込み、4 バイト目をアルファで上書きする.
+  // 最後のピクセルの 4 バイト目は次のピクセルを読むため、行末の 1 ピクセルは残す.
+  uint32_t RGBToRGBASSE2(const uint8_t* src, uint8_t* dst, uint32_t width)
+  {
+    const __m128i alpha = _mm_set1_epi32(int32_t(0xFF000000));
+    uint32_t x = 0;
+    for (; x + 5 <= width; x += 4)
+    {
+      const uint8_t* s = src + x * 3;
+      __m128i v = _mm_setr_epi32(LoadInt32(s), LoadInt32(s + 3), LoadInt32(s + 6), LoadInt32(s + 9));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_or_si128(v, alpha));
+    }
+    return x;
+  }
+
+  // 輝度 -> RGBA. 16 ピクセルずつ.
+  uint32_t GrayToRGBASSE2(const uint8_t* src, uint8_t* dst, uint32_t width)
+  {
+    const __m128i alpha = _mm_set1_epi32(int32_t(0xFF000000));
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+      __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+      __m128i lo = _mm_unpacklo_epi8(g, g);
+      __m128i hi = _mm_unpackhi_epi8(g, g);
+      auto out = reinterpret_cast<__m128i*>(dst + x * 4);
+      _mm_storeu_si128(out + 0, _mm_or_si128(_mm_unpacklo_epi16(lo, lo), alpha));
+      _mm_storeu_si128(out + 1, _mm_or_si128(_mm_unpackhi_epi16(lo, lo), alpha));
+      _mm_storeu_si128(out + 2, _mm_or_si128(_mm_unpacklo_epi16(hi, hi), alpha));
+      _mm_storeu_si128(out + 3, _mm_or_si128(_mm_unpackhi_epi16(hi, hi), alpha));
+    }
+    return x;
+  }
+
+  // 輝度+アルファ -> RGBA. 8 ピクセルずつ.
+  uint32_t GrayAlphaToRGBASSE2(const uint8_t* src, uint8_t* dst, uint32_t width)
+  {
+    const __m128i lumMask = _mm_set1_epi32(0x00FF00FF);
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alphaMask = _mm_set1_epi32(int32_t(0xFF000000));
+    uint32_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 2));
+      __m128i halves[2] = { _mm_unpacklo_epi16(v, v), _mm_unpackhi_epi16(v, v) };
+      for (int i = 0; i < 2; ++i)
+      {
+        // (L,A,L,A) から (L,L,L,L) を作り、4 バイト目をアルファに戻す.
+        __m128i lum = _mm_and_si128(halves[i], lumMask);
+        lum = _mm_or_si128(lum, _mm_slli_epi32(lum, 8));
+        __m128i out = _mm_or_si128(_mm_and_si128(lum, rgbMask), _mm_and_si128(halves[i], alphaMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (x + i * 4) * 4), out);
+      }
+    }
+    return x;
+  }
+
+  uint32_t SwapRedBlueSSE2(const uint8_t* src, uint8_t* dst, uint32_t width)
+  {
+    const __m128i gaMask = _mm_set1_epi32(int32_t(0xFF00FF00));
+    const __m128i rbMask = _mm_set1_epi32(0x00FF00FF);
+    uint32_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+      __m128i rb = _mm_and_si128(v, rbMask);
+      rb = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_or_si128(_mm_and_si128(v, gaMask), rb));
+    }
+    return x;
+  }
+
+  // 16 個の値ずつ. 同じ値を上位と下位のバイトに並べると v * 257 になる.
+  size_t Expand8To16SSE2(const uint8_t* src, uint16_t* dst, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, v));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, v));
+    }
+    return i;
+  }
+
+  // 4 チャンネルから 1 チャンネルを取り出す. 16 ピクセルずつ.
+  uint32_t ExtractChannelRGBASSE2(const uint8_t* src, uint32_t channel, uint8_t* dst, uint32_t width)
+  {
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128i shift = _mm_cvtsi32_si128(int(channel * 8));
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+      auto s = reinterpret_cast<const __m128i*>(src + x * 4);
+      __m128i v[4];
+      for (int i = 0; i < 4; ++i)
+      {
+        v[i] = _mm_and_si128(_mm_srl_epi32(_mm_loadu_si128(s + i), shift), mask);
+      }
+      __m128i lo = _mm_packs_epi32(v[0], v[1]);
+      __m128i hi = _mm_packs_epi32(v[2], v[3]);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(lo, hi));
+    }
+    return x;
+  }
+#endif
+
+  // sRGB と線形の変換表. 8bit -> 16bit は 256 要素、16bit -> 8bit は全ての値について持つ(64KB).
+  // どちらも表引きが主な処理のため、SIMD は使わない.
+  struct SrgbTables
+  {
+    uint16_t toLinear[256];
+    std::vector<uint8_t> toSrgb;
+    SrgbTables() : toSrgb(65536)
+    {
+      for (int i = 0; i < 256; ++i)
+      {
+        double c = i / 255.0;
+        double l = c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+        toLinear[i] = uint16_t(l * 65535.0 + 0.5);
+      }
+      for (int i = 0; i < 65536; ++i)
+      {
+        double l = i / 65535.0;
+        double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+        toSrgb[i] = uint8_t((std::min)((std::max)(c * 255.0 + 0.5, 0.0), 255.0));
+      }
+    }
+  };
+
+  const SrgbTables& GetSrgbTables()
+  {
+    static const SrgbTables tables;
+    return tables;
+  }
+
+  bool HasAlpha(uint32_t components)
+  {
+    return components == 2 || components == 4;
+  }
+}
+
+namespace book_util
+{
+  void ConvertChannels(const uint8_t* src, uint32_t srcComponents, uint8_t* dst, uint32_t dstComponents,
+    uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const size_t srcStride = size_t(width) * srcComponents;
+    const size_t dstStride = size_t(width) * dstComponents;
+    if (srcComponents == dstComponents)
+    {
+      ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+      {
+        memcpy(dst + yBegin * dstStride, src + yBegin * srcStride, (yEnd - yBegin) * dstStride);
+      });
+      return;
+    }
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      for (uint32_t y = yBegin; y < yEnd; ++y)
+      {
+        auto s = src + y * srcStride;
+        auto d = dst + y * dstStride;
+        uint32_t x = 0;
+#ifdef PIXEL_CONVERT_USE_SIMD
+        if (dstComponents == 4)
+        {
+          switch (srcComponents)
+          {
+          case 1: x = GrayToRGBASSE2(s, d, width); break;
+          case 2: x = GrayAlphaToRGBASSE2(s, d, width); break;
+          case 3: x = RGBToRGBASSE2(s, d, width); break;
+          }
+        }
+#endif
+        ConvertChannelsScalar(s, srcComponents, d, dstComponents, x, width);
+      }
+    });
+  }
+
+  void SwapRedBlue(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const size_t stride = size_t(width) * 4;
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      for (uint32_t y = yBegin; y < yEnd; ++y)
+      {
+        auto s = src + y * stride;
+        auto d = dst + y * stride;
+        uint32_t x = 0;
+#ifdef PIXEL_CONVERT_USE_SIMD
+        x = SwapRedBlueSSE2(s, d, width);
+#endif
+        for (; x < width; ++x)
+        {
+          uint8_t r = s[x * 4 + 0], g = s[x * 4 + 1], b = s[x * 4 + 2], a = s[x * 4 + 3];
+          d[x * 4 + 0] = b;
+          d[x * 4 + 1] = g;
+          d[x * 4 + 2] = r;
+          d[x * 4 + 3] = a;
+        }
+      }
+    });
+  }
+
+  void Expand8To16(const uint8_t* src, uint16_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const size_t stride = size_t(width) * components;
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      // 行の区切りはないため、帯全体を 1 列として扱う.
+      const size_t count = (yEnd - yBegin) * stride;
+      auto s = src + yBegin * stride;
+      auto d = dst + yBegin * stride;
+      size_t i = 0;
+#ifdef PIXEL_CONVERT_USE_SIMD
+      i = Expand8To16SSE2(s, d, count);
+#endif
+      for (; i < count; ++i)
+      {
+        d[i] = uint16_t(s[i] * 257);
+      }
+    });
+  }
+
+  void ExtractChannel(const uint8_t* src, uint32_t components, uint32_t channel, uint8_t* dst,
+    uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const size_t srcStride = size_t(width) * components;
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      for (uint32_t y = yBegin; y < yEnd; ++y)
+      {
+        auto s = src + y * srcStride;
+        auto d = dst + size_t(y) * width;
+        uint32_t x = 0;
+#ifdef PIXEL_CONVERT_USE_SIMD
+        if (components == 4)
+        {
+          x = ExtractChannelRGBASSE2(s, channel, d, width);
+        }
+#endif
+        for (; x < width; ++x)
+        {
+          d[x] = s[x * components + channel];
+        }
+      }
+    });
+  }
+
+  void ConvertSrgbToLinear(const uint8_t* src, uint16_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const auto& tables = GetSrgbTables();
+    const uint32_t colorComponents = HasAlpha(components) ? components - 1 : components;
+    const size_t stride = size_t(width) * components;
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      auto s = src + yBegin * stride;
+      auto d = dst + yBegin * stride;
+      const size_t pixels = size_t(yEnd - yBegin) * width;
+      for (size_t i = 0; i < pixels; ++i, s += components, d += components)
+      {
+        for (uint32_t c = 0; c < colorComponents; ++c)
+        {
+          d[c] = tables.toLinear[s[c]];
+        }
+        if (colorComponents != components)
+        {
+          d[colorComponents] = uint16_t(s[colorComponents] * 257);
+        }
+      }
+    });
+  }
+
+  void ConvertLinearToSrgb(const uint16_t* src, uint8_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount)
+  {
+    const auto& tables = GetSrgbTables();
+    const uint32_t colorComponents = HasAlpha(components) ? components - 1 : components;
+    const size_t stride = size_t(width) * components;
+    ParallelRows(width, height, threadCount, [&](uint32_t yBegin, uint32_t yEnd)
+    {
+      auto s = src + yBegin * stride;
+      auto d = dst + yBegin * stride;
+      const size_t pixels = size_t(yEnd - yBegin) * width;
+      for (size_t i = 0; i < pixels; ++i, s += components, d += components)
+      {
+        for (uint32_t c = 0; c < colorComponents; ++c)
+        {
+          d[c] = tables.toSrgb[s[c]];
+        }
+        if (colorComponents != components)
+        {
+          d[colorComponents] = uint8_t((s[colorComponents] + 128) / 257);
+        }
+      }
+    });
+  }
+
+  const char* GetPixelConvertInstructionSet()
+  {
+#ifdef PIXEL_CONVERT_USE_SIMD
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
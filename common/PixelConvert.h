@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+
+namespace book_util
+{
+  // 画像の読み込み時に使う画素形式の変換.
+  // いずれも行を帯に分けて複数のスレッドで処理する. threadCount が 0 ならハードウェアのスレッド数を使う.
+  // 出力先はステージングバッファをマップしたメモリでもよい(書き込みのみで読み戻さない).
+
+  // 8bit 画素のチャンネル数(1～4)を変換する. stb_image の req_comp と同じ規則で、
+  // 1,2 チャンネルは輝度(+アルファ)として扱い、追加するアルファは 255 とする.
+  // チャンネルを減らす場合の輝度は (77R + 150G + 29B) / 256 とする.
+  void ConvertChannels(const uint8_t* src, uint32_t srcComponents, uint8_t* dst, uint32_t dstComponents,
+    uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // RGBA と BGRA を相互に変換する(R と B の入れ替え). src と dst は同じでもよい.
+  void SwapRedBlue(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // 8bit の値を 16bit へ広げる(v * 257). components は 1 ピクセルのチャンネル数.
+  void Expand8To16(const uint8_t* src, uint16_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // components チャンネルの画像から channel 番目のチャンネルだけを取り出す.
+  void ExtractChannel(const uint8_t* src, uint32_t components, uint32_t channel, uint8_t* dst,
+    uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // sRGB の 8bit 値を線形の 16bit 値へ変換する. 8bit のままでは暗部の階調が失われるため 16bit で出力する.
+  // components が 2, 4 の場合、最後のチャンネルはアルファとして線形のまま広げる.
+  void ConvertSrgbToLinear(const uint8_t* src, uint16_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // 線形の 16bit 値を sRGB の 8bit 値へ変換する. アルファの扱いは ConvertSrgbToLinear と同じ.
+  void ConvertLinearToSrgb(const uint16_t* src, uint8_t* dst, uint32_t components,
+    uint32_t width, uint32_t height, uint32_t threadCount = 0);
+
+  // 実行環境で使用している命令セットの名前("sse2"/"scalar").
+  const char* GetPixelConvertInstructionSet();
+}
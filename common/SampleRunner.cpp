@@ -0,0 +1,645 @@
+#include "SampleRunner.h"
+#include "VulkanBookUtil.h"
+#include "Statistics.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <direct.h>
+#define chdir _chdir
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+  void KeyboardInputCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+  {
+    auto pApp = book_util::GetApplication<VulkanAppBase>(window);
+    if (pApp == nullptr)
+    {
+      return;
+    }
+    switch (action)
+    {
+    case GLFW_PRESS:
+      if (key == GLFW_KEY_ESCAPE)
+      {
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+      }
+      if (key == GLFW_KEY_ENTER && mods == GLFW_MOD_ALT)
+      {
+        pApp->SwitchFullscreen(window);
+      }
+      if (key == GLFW_KEY_F12)
+      {
+        // フレームキャプチャの開始/停止.
+        if (pApp->IsFrameCapturing())
+        {
+          pApp->StopFrameCapture();
+        }
+        else
+        {
+          pApp->StartFrameCapture("capture");
+        }
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+  void MouseMoveCallback(GLFWwindow* window, double x, double y)
+  {
+    static int lastPosX, lastPosY;
+    auto pApp = book_util::GetApplication<VulkanAppBase>(window);
+    if (pApp == nullptr)
+    {
+      return;
+    }
+    int dx = int(x) - lastPosX;
+    int dy = int(y) - lastPosY;
+    // カメラは移動量を溜めるだけで、姿勢への反映はフレームごとの UpdateCamera で行う.
+    pApp->OnMouseMove(dx, dy);
+    lastPosX = int(x);
+    lastPosY = int(y);
+  }
+  void MouseInputCallback(GLFWwindow* window, int button, int action, int mods)
+  {
+    auto pApp = book_util::GetApplication<VulkanAppBase>(window);
+    if (pApp == nullptr)
+    {
+      return;
+    }
+    if (action == GLFW_PRESS)
+    {
+      pApp->OnMouseButtonDown(button);
+    }
+    if (action == GLFW_RELEASE)
+    {
+      pApp->OnMouseButtonUp(button);
+    }
+  }
+  void WindowResizeCallback(GLFWwindow* window, int width, int height)
+  {
+    auto pApp = book_util::GetApplication<VulkanAppBase>(window);
+    if (pApp == nullptr)
+    {
+      return;
+    }
+    pApp->OnSizeChanged(width, height);
+  }
+
+  bool IsAbsolutePath(const std::string& path)
+  {
+    if (path.empty())
+    {
+      return false;
+    }
+    if (path[0] == '/' || path[0] == '\\')
+    {
+      return true;
+    }
+    return path.size() > 1 && path[1] == ':';
+  }
+
+  // 作業ディレクトリを移動する前の位置を基準にしたパスへ変換する.
+  std::string ResolvePath(const std::string& base, const std::string& path)
+  {
+    if (path.empty() || IsAbsolutePath(path))
+    {
+      return path;
+    }
+    return base + "/" + path;
+  }
+
+  std::string GetCurrentDir()
+  {
+    char buf[1024];
+    if (getcwd(buf, sizeof(buf)) == nullptr)
+    {
+      return ".";
+    }
+    return buf;
+  }
+}
+
+bool SampleRunner::ParseOptions(int argc, char* argv[], Options& opt) const
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    auto hasValue = (i + 1 < argc);
+    if (arg == "--list")
+    {
+      opt.isList = true;
+    }
+    else if (arg == "--headless")
+    {
+      opt.isHeadless = true;
+    }
+    else if (arg == "--async-textures")
+    {
+      opt.isAsyncTextures = true;
+    }
+    else if (!hasValue)
+    {
+      std::cerr << "missing value: " << arg << std::endl;
+      return false;
+    }
+    else if (arg == "--sample")
+    {
+      opt.sample = argv[++i];
+    }
+    else if (arg == "--width")
+    {
+      opt.width = atoi(argv[++i]);
+    }
+    else if (arg == "--height")
+    {
+      opt.height = atoi(argv[++i]);
+    }
+    else if (arg == "--frames")
+    {
+      opt.frames = uint32_t(strtoul(argv[++i], nullptr, 10));
+    }
+    else if (arg == "--warmup")
+    {
+      opt.warmup = uint32_t(strtoul(argv[++i], nullptr, 10));
+    }
+    else if (arg == "--present")
+    {
+      opt.presentModeName = argv[++i];
+      if (opt.presentModeName == "fifo")
+      {
+        opt.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+      }
+      else if (opt.presentModeName == "fifo_relaxed")
+      {
+        opt.presentMode = VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+      }
+      else if (opt.presentModeName == "mailbox")
+      {
+        opt.presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+      }
+      else if (opt.presentModeName == "immediate")
+      {
+        opt.presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+      }
+      else
+      {
+        std::cerr << "unknown present mode: " << opt.presentModeName << std::endl;
+        return false;
+      }
+    }
+    else if (arg == "--summary")
+    {
+      opt.summaryPath = argv[++i];
+    }
+    else if (arg == "--capture")
+    {
+      opt.captureDir = argv[++i];
+    }
+    else if (arg == "--capture-format")
+    {
+      std::string format = argv[++i];
+      if (format == "png")
+      {
+        opt.captureFormat = FrameCapture::Format::PNG;
+      }
+      else if (format == "raw")
+      {
+        opt.captureFormat = FrameCapture::Format::Raw;
+      }
+      else
+      {
+        std::cerr << "unknown capture format: " << format << std::endl;
+        return false;
+      }
+    }
+    else if (arg == "--data-root")
+    {
+      opt.dataRoot = argv[++i];
+    }
+    else if (arg == "--camera-path")
+    {
+      opt.cameraPath = argv[++i];
+    }
+    else if (arg == "--record-camera")
+    {
+      opt.recordCameraPath = argv[++i];
+    }
+    else if (arg == "--texture-cache")
+    {
+      opt.textureCache = argv[++i];
+    }
+    else if (arg == "--mipmaps")
+    {
+      opt.mipmapsName = argv[++i];
+      if (opt.mipmapsName != "default" && opt.mipmapsName != "none" && opt.mipmapsName != "gpu" &&
+        opt.mipmapsName != "box" && opt.mipmapsName != "kaiser")
+      {
+        std::cerr << "unknown mipmap mode: " << opt.mipmapsName << std::endl;
+        return false;
+      }
+    }
+    else if (arg == "--depth")
+    {
+      opt.depthName = argv[++i];
+      if (opt.depthName != "default" && opt.depthName != "standard" && opt.depthName != "reverse-z")
+      {
+        std::cerr << "unknown depth mode: " << opt.depthName << std::endl;
+        return false;
+      }
+    }
+    else if (arg == "--mesh-optimize")
+    {
+      std::string value = argv[++i];
+      if (value != "on" && value != "off")
+      {
+        std::cerr << "unknown mesh-optimize value: " << value << std::endl;
+        return false;
+      }
+      opt.isMeshOptimized = (value == "on");
+    }
+    else if (arg == "--compact-vertex")
+    {
+      std::string value = argv[++i];
+      if (value != "on" && value != "off")
+      {
+        std::cerr << "unknown compact-vertex value: " << value << std::endl;
+        return false;
+      }
+      opt.isCompactVertex = (value == "on");
+    }
+    else if (arg == "--cluster-culling")
+    {
+      std::string value = argv[++i];
+      if (value != "on" && value != "off")
+      {
+        std::cerr << "unknown cluster-culling value: " << value << std::endl;
+        return false;
+      }
+      opt.isClusterCulling = (value == "on");
+    }
+    else if (arg == "--lod")
+    {
+      std::string value = argv[++i];
+      if (value != "on" && value != "off")
+      {
+        std::cerr << "unknown lod value: " << value << std::endl;
+        return false;
+      }
+      opt.isLodSelection = (value == "on");
+    }
+    else
+    {
+      std::cerr << "unknown option: " << arg << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+void SampleRunner::PrintUsage() const
+{
+  std::cerr <<
+    "usage: [--sample name] [--list] [--width w] [--height h]\n"
+    "       [--frames n] [--warmup n] [--present fifo|fifo_relaxed|mailbox|immediate]\n"
+    "       [--headless] [--summary file.json] [--capture dir] [--capture-format png|raw]\n"
+    "       [--data-root dir] [--camera-path file|default] [--record-camera file]\n"
+    "       [--texture-cache dir|off] [--mipmaps default|none|gpu|box|kaiser]\n"
+    "       [--async-textures] [--depth default|standard|reverse-z]\n"
+    "       [--mesh-optimize on|off] [--compact-vertex on|off] [--cluster-culling on|off]\n"
+    "       [--lod on|off]\n"
+    "--headless creates no surface and renders into offscreen images. GLFW and ImGui still\n"
+    "need a hidden window, so a display is still required.\n";
+}
+
+const SampleRunner::SampleInfo* SampleRunner::FindSample(const std::string& name) const
+{
+  if (name.empty() && m_samples.size() == 1)
+  {
+    return &m_samples[0];
+  }
+  for (const auto& s : m_samples)
+  {
+    if (s.name == name)
+    {
+      return &s;
+    }
+  }
+  return nullptr;
+}
+
+int SampleRunner::Run(int argc, char* argv[])
+{
+  Options opt;
+  if (!ParseOptions(argc, argv, opt))
+  {
+    PrintUsage();
+    return 1;
+  }
+  if (opt.isList)
+  {
+    for (const auto& s : m_samples)
+    {
+      std::cout << s.name << "\t" << s.title << "\t" << s.width << "x" << s.height << std::endl;
+    }
+    return 0;
+  }
+  auto sample = FindSample(opt.sample);
+  if (sample == nullptr)
+  {
+    std::cerr << "sample not found: " << opt.sample << std::endl;
+    PrintUsage();
+    return 1;
+  }
+  int width = opt.width > 0 ? opt.width : sample->width;
+  int height = opt.height > 0 ? opt.height : sample->height;
+
+  // 出力先は起動時の位置を基準とし、その後サンプルのディレクトリへ移動する.
+  auto launchDir = GetCurrentDir();
+  auto summaryPath = ResolvePath(launchDir, opt.summaryPath);
+  auto captureDir = ResolvePath(launchDir, opt.captureDir);
+  auto recordCameraPath = ResolvePath(launchDir, opt.recordCameraPath);
+  auto textureCacheDir = opt.textureCache == "off" ? opt.textureCache : ResolvePath(launchDir, opt.textureCache);
+  CameraPath cameraPath;
+  if (!opt.cameraPath.empty() && opt.cameraPath != "default")
+  {
+    auto fileName = ResolvePath(launchDir, opt.cameraPath);
+    if (!cameraPath.Load(fileName))
+    {
+      std::cerr << "cannot load camera path: " << fileName << std::endl;
+      return 1;
+    }
+  }
+  if (!sample->directory.empty())
+  {
+    auto dir = ResolvePath(opt.dataRoot, sample->directory);
+    if (chdir(dir.c_str()) != 0)
+    {
+      std::cerr << "cannot change directory: " << dir << std::endl;
+      return 1;
+    }
+  }
+
+  if (!glfwInit())
+  {
+    std::cerr << "cannot initialize GLFW (--headless also requires a display)." << std::endl;
+    return 1;
+  }
+  glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+  glfwWindowHint(GLFW_RESIZABLE, opt.isHeadless ? GLFW_FALSE : GLFW_TRUE);
+  if (opt.isHeadless)
+  {
+    // ImGui の入力処理のためにウィンドウ自体は必要なので、非表示で作成する.
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  }
+  auto window = glfwCreateWindow(width, height, sample->title.c_str(), nullptr, nullptr);
+  if (window == nullptr)
+  {
+    std::cerr << "cannot create window (--headless also requires a display)." << std::endl;
+    glfwTerminate();
+    return 1;
+  }
+
+  // 各種コールバック登録.
+  glfwSetKeyCallback(window, KeyboardInputCallback);
+  glfwSetMouseButtonCallback(window, MouseInputCallback);
+  glfwSetCursorPosCallback(window, MouseMoveCallback);
+  glfwSetWindowSizeCallback(window, WindowResizeCallback);
+
+  auto app = sample->create();
+  glfwSetWindowUserPointer(window, app.get());
+  app->SetHeadless(opt.isHeadless);
+  app->SetPresentMode(opt.presentMode);
+  if (textureCacheDir == "off")
+  {
+    app->GetTextureCache().SetDirectory(std::string());
+  }
+  else if (!textureCacheDir.empty())
+  {
+    app->GetTextureCache().SetDirectory(textureCacheDir);
+  }
+  if (opt.mipmapsName != "default")
+  {
+    // サンプルごとの指定を上書きして、作成方法ごとの読み込み時間を比較できるようにする.
+    using Mipmap = VulkanAppBase::MipmapGeneration;
+    auto mode = Mipmap::None;
+    if (opt.mipmapsName == "gpu")
+    {
+      mode = Mipmap::Gpu;
+    }
+    else if (opt.mipmapsName == "box")
+    {
+      mode = Mipmap::CpuBox;
+    }
+    else if (opt.mipmapsName == "kaiser")
+    {
+      mode = Mipmap::CpuKaiser;
+    }
+    app->SetMipmapGenerationOverride(mode);
+  }
+  if (opt.depthName != "default")
+  {
+    // 通常の深度と反転深度で、早期深度テストによる棄却の効率を比較できるようにする.
+    using Depth = VulkanAppBase::DepthMode;
+    app->SetDepthMode(opt.depthName == "reverse-z" ? Depth::ReverseZ : Depth::Standard);
+  }
+  app->SetMeshOptimization(opt.isMeshOptimized);
+  app->SetCompactVertex(opt.isCompactVertex);
+  app->SetClusterCulling(opt.isClusterCulling);
+  app->SetLodSelection(opt.isLodSelection);
+
+  using Clock = std::chrono::high_resolution_clock;
+  RunResult result;
+  int exitCode = 0;
+  try
+  {
+    VkFormat surfaceFormat = VK_FORMAT_B8G8R8A8_UNORM;
+    app->Initialize(window, surfaceFormat, false);
+    result.startupTimes = app->GetStartupTimes();
+    result.meshOptimizationResults = app->GetMeshOptimizationResults();
+    if (!opt.isAsyncTextures)
+    {
+      // 既定では読み込みの完了を待ってから描画を始め、差し替え前のフレームを計測に含めない.
+      auto waitStart = Clock::now();
+      app->WaitForAsyncTextures();
+      result.startupTimes.emplace_back("textureWait", std::chrono::duration<double, std::milli>(Clock::now() - waitStart).count());
+    }
+    if (!captureDir.empty())
+    {
+      app->StartFrameCapture(captureDir, opt.captureFormat);
+    }
+    if (opt.cameraPath == "default")
+    {
+      cameraPath = app->CreateDefaultCameraPath();
+    }
+    if (!cameraPath.IsEmpty())
+    {
+      app->StartCameraPlayback(cameraPath);
+    }
+    else if (!recordCameraPath.empty())
+    {
+      app->StartCameraRecording();
+    }
+
+    uint32_t frameCount = 0;
+    result.frameTimes.reserve(opt.frames);
+    auto lastFrameStart = Clock::now();
+    while (glfwWindowShouldClose(window) == GLFW_FALSE)
+    {
+      if (opt.frames > 0 && frameCount >= opt.warmup + opt.frames)
+      {
+        break;
+      }
+      if (frameCount == opt.warmup)
+      {
+        // ウォームアップ中の GPU 計測値は捨てる.
+        app->GetGpuProfiler().ResetPassTimes();
+        app->ResetClusterCullingStatistics();
+      }
+      auto frameStart = Clock::now();
+      glfwPollEvents();
+      app->UpdateCamera(std::chrono::duration<float>(frameStart - lastFrameStart).count());
+      lastFrameStart = frameStart;
+      app->UpdateCameraTrack();
+      app->Render();
+      auto frameEnd = Clock::now();
+      if (frameCount >= opt.warmup)
+      {
+        result.frameTimes.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+      }
+      ++frameCount;
+    }
+    if (!recordCameraPath.empty() && !app->StopCameraRecording(recordCameraPath))
+    {
+      std::cerr << "cannot save camera path: " << recordCameraPath << std::endl;
+    }
+    if (app->GetFrameCapture())
+    {
+      app->StopFrameCapture();
+      result.capturedCount = app->GetFrameCapture()->GetCapturedCount();
+      result.droppedCount = app->GetFrameCapture()->GetDroppedCount();
+    }
+    // 非同期の読み込みはフレームの途中で完了するため、終了の直前に取得する.
+    result.textureCacheHits = app->GetTextureCache().GetHitCount();
+    result.textureCacheMisses = app->GetTextureCache().GetMissCount();
+    result.textureLoadTimes = app->GetTextureLoadTimes();
+    result.clusterCulling = app->GetClusterCullingStatistics();
+    app->Terminate();
+    result.gpuPassTimes = app->GetGpuProfiler().GetPassTimes();
+  }
+  catch (std::exception& e)
+  {
+    book_util::OutputLog(std::string(e.what()) + "\n");
+    exitCode = 1;
+  }
+  glfwSetWindowUserPointer(window, nullptr);
+  app.reset();
+  glfwTerminate();
+
+  if (exitCode == 0 && (opt.frames > 0 || !summaryPath.empty()))
+  {
+    if (summaryPath.empty())
+    {
+      WriteSummary(std::cout, *sample, opt, width, height, result);
+    }
+    else
+    {
+      std::ofstream outfile(summaryPath);
+      if (!outfile)
+      {
+        std::cerr << "cannot write summary: " << summaryPath << std::endl;
+        return 1;
+      }
+      WriteSummary(outfile, *sample, opt, width, height, result);
+    }
+  }
+  return exitCode;
+}
+
+void SampleRunner::WriteSummary(std::ostream& os, const SampleInfo& sample, const Options& opt, int width, int height, const RunResult& result) const
+{
+  os << std::fixed << std::setprecision(4);
+  os << "{\n";
+  os << "  \"sample\": \"" << book_util::EscapeJson(sample.name) << "\",\n";
+  os << "  \"width\": " << width << ",\n";
+  os << "  \"height\": " << height << ",\n";
+  os << "  \"present\": \"" << opt.presentModeName << "\",\n";
+  os << "  \"headless\": " << (opt.isHeadless ? "true" : "false") << ",\n";
+  os << "  \"cameraPath\": \"" << book_util::EscapeJson(opt.cameraPath) << "\",\n";
+  os << "  \"mipmaps\": \"" << opt.mipmapsName << "\",\n";
+  os << "  \"depth\": \"" << opt.depthName << "\",\n";
+  os << "  \"asyncTextures\": " << (opt.isAsyncTextures ? "true" : "false") << ",\n";
+  os << "  \"meshOptimize\": " << (opt.isMeshOptimized ? "true" : "false") << ",\n";
+  os << "  \"compactVertex\": " << (opt.isCompactVertex ? "true" : "false") << ",\n";
+  os << "  \"clusterCulling\": " << (opt.isClusterCulling ? "true" : "false") << ",\n";
+  os << "  \"lod\": " << (opt.isLodSelection ? "true" : "false") << ",\n";
+  os << "  \"warmupFrames\": " << opt.warmup << ",\n";
+  os << "  \"frames\": " << result.frameTimes.size() << ",\n";
+
+  os << "  \"frameTimeMs\": ";
+  book_util::WriteJsonStatistics(os, result.frameTimes, "  ", true);
+  os << ",\n";
+
+  os << "  \"gpuPassMs\": {";
+  bool isFirst = true;
+  for (const auto& pass : result.gpuPassTimes)
+  {
+    os << (isFirst ? "\n" : ",\n") << "    \"" << book_util::EscapeJson(pass.first) << "\": ";
+    book_util::WriteJsonStatistics(os, pass.second, "    ", true);
+    isFirst = false;
+  }
+  os << (isFirst ? "},\n" : "\n  },\n");
+
+  os << "  \"startupMs\": {\n";
+  double total = 0.0;
+  for (const auto& phase : result.startupTimes)
+  {
+    os << "    \"" << book_util::EscapeJson(phase.first) << "\": " << phase.second << ",\n";
+    total += phase.second;
+  }
+  os << "    \"total\": " << total << "\n";
+  os << "  },\n";
+
+  os << "  \"textureLoadMs\": {";
+  isFirst = true;
+  for (const auto& texture : result.textureLoadTimes)
+  {
+    os << (isFirst ? "\n" : ",\n") << "    \"" << book_util::EscapeJson(texture.first) << "\": " << texture.second;
+    isFirst = false;
+  }
+  os << (isFirst ? "},\n" : "\n  },\n");
+
+  // 頂点キャッシュは 16 エントリの FIFO として求めた値.
+  os << "  \"vertexCache\": [";
+  isFirst = true;
+  for (const auto& mesh : result.meshOptimizationResults)
+  {
+    os << (isFirst ? "\n" : ",\n") << "    { \"triangles\": " << mesh.triangleCount << ", \"vertices\": " << mesh.vertexCount
+      << ", \"acmrBefore\": " << mesh.before.acmr << ", \"acmrAfter\": " << mesh.after.acmr
+      << ", \"atvrBefore\": " << mesh.before.atvr << ", \"atvrAfter\": " << mesh.after.atvr << " }";
+    isFirst = false;
+  }
+  os << (isFirst ? "],\n" : "\n  ],\n");
+
+  // ビューごとの平均. メッシュレット単位のカリングに対応しないサンプルでは views が 0 となる.
+  const auto& culling = result.clusterCulling;
+  double views = double((std::max)(culling.views, uint64_t(1)));
+  os << "  \"clusterCullingTriangles\": { \"views\": " << culling.views
+    << ", \"trianglesPerView\": " << culling.triangles / views
+    << ", \"monolithicTrianglesPerView\": " << culling.monolithicTriangles / views << " },\n";
+
+  os << "  \"textureCache\": { \"hits\": " << result.textureCacheHits << ", \"misses\": " << result.textureCacheMisses << " },\n";
+  os << "  \"capture\": { \"captured\": " << result.capturedCount << ", \"dropped\": " << result.droppedCount << " }\n";
+  os << "}\n";
+}
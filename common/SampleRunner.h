@@ -0,0 +1,106 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <iosfwd>
+#include <functional>
+
+#include "VulkanAppBase.h"
+
+// サンプルの起動処理をまとめたもの.
+// 登録したサンプルをコマンドライン引数で選んで実行し、計測結果を JSON で出力する.
+//
+//  --list                       登録されているサンプルの一覧
+//  --sample <name>              実行するサンプル(登録が 1 つの場合は省略可)
+//  --width <w> --height <h>     解像度
+//  --frames <n>                 計測するフレーム数(0 ならウィンドウを閉じるまで)
+//  --warmup <n>                 計測前に捨てるフレーム数
+//  --present <mode>             fifo / fifo_relaxed / mailbox / immediate
+//  --headless                   サーフェスとスワップチェインを作らずオフスクリーンのイメージへ描画
+//                               GLFW の初期化と ImGui の入力処理のため非表示のウィンドウは作成するので、ディスプレイは必要
+//  --summary <file>             計測結果の出力先(省略時は標準出力)
+//  --capture <dir>              描画結果を連番画像で書き出す
+//  --capture-format <png|raw>
+//  --data-root <dir>            サンプルのディレクトリを探す基準位置
+//  --camera-path <file|default> 記録したカメラ経路を再生(default はサンプル既定の経路)
+//  --record-camera <file>       カメラ操作を記録して終了時に保存
+//  --texture-cache <dir|off>    デコード済みテクスチャのキャッシュの保存先(既定はサンプルの texture_cache)
+//  --mipmaps <mode>             ミップマップの作成方法 default / none / gpu / box / kaiser
+//  --async-textures             テクスチャの読み込みを待たずに描画を始める
+//  --depth <mode>               深度の使い方 default / standard / reverse-z
+//  --mesh-optimize <on|off>     三角形リストのモデルを頂点キャッシュ向けに並べ替えるか(既定は on)
+//  --compact-vertex <on|off>    CreateCompactModel で頂点とインデックスを圧縮するか(既定は on)
+//  --cluster-culling <on|off>   メッシュレット単位のカリングを行うか(既定は on. 対応するサンプルのみ)
+//  --lod <on|off>               画面上の大きさに応じて詳細度を選ぶか(既定は on. 対応するサンプルのみ)
+class SampleRunner
+{
+public:
+  using CreateFunc = std::function<std::unique_ptr<VulkanAppBase>()>;
+  struct SampleInfo
+  {
+    std::string name;
+    std::string title;
+    std::string directory;  // シェーダー等を読み込む作業ディレクトリ. 空ならそのまま.
+    int width, height;
+    CreateFunc create;
+  };
+
+  template<class T>
+  void Register(const std::string& name, const std::string& title, int width, int height, const std::string& directory = std::string())
+  {
+    m_samples.push_back(SampleInfo{
+      name, title, directory, width, height,
+      []() { return std::unique_ptr<VulkanAppBase>(new T()); }
+    });
+  }
+
+  int Run(int argc, char* argv[]);
+
+private:
+  struct Options
+  {
+    std::string sample;
+    int width = 0, height = 0;
+    uint32_t frames = 0;
+    uint32_t warmup = 0;
+    VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
+    std::string presentModeName = "fifo";
+    bool isHeadless = false;
+    bool isList = false;
+    std::string summaryPath;
+    std::string captureDir;
+    FrameCapture::Format captureFormat = FrameCapture::Format::PNG;
+    std::string dataRoot = "..";
+    std::string cameraPath;
+    std::string recordCameraPath;
+    std::string textureCache;
+    std::string mipmapsName = "default";
+    bool isAsyncTextures = false;  // テクスチャの読み込みを待たずに描画を始める.
+    std::string depthName = "default";  // default はサンプルの指定に従う.
+    bool isMeshOptimized = true;
+    bool isCompactVertex = true;
+    bool isClusterCulling = true;
+    bool isLodSelection = true;
+  };
+  struct RunResult
+  {
+    std::vector<double> frameTimes;
+    VulkanAppBase::StartupTimes startupTimes;
+    std::map<std::string, std::vector<double>> gpuPassTimes;
+    uint32_t capturedCount = 0;
+    uint32_t droppedCount = 0;
+    uint32_t textureCacheHits = 0;
+    uint32_t textureCacheMisses = 0;
+    VulkanAppBase::TextureLoadTimes textureLoadTimes;
+    VulkanAppBase::MeshOptimizationResults meshOptimizationResults;
+    VulkanAppBase::ClusterCullingStatistics clusterCulling{};
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& opt) const;
+  void PrintUsage() const;
+  const SampleInfo* FindSample(const std::string& name) const;
+  void WriteSummary(std::ostream& os, const SampleInfo& sample, const Options& opt, int width, int height, const RunResult& result) const;
+
+  std::vector<SampleInfo> m_samples;
+};
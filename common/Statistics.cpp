@@ -0,0 +1,73 @@
+#include "Statistics.h"
+#include <ostream>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace book_util
+{
+  double Percentile(const std::vector<double>& sorted, double p)
+  {
+    if (sorted.empty())
+    {
+      return 0.0;
+    }
+    auto rank = size_t(std::ceil(p / 100.0 * double(sorted.size())));
+    rank = (std::max)(rank, size_t(1));
+    return sorted[(std::min)(rank, sorted.size()) - 1];
+  }
+
+  void WriteJsonStatistics(std::ostream& os, const std::vector<double>& values, const char* indent, bool withSamples)
+  {
+    auto sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    double mean = 0.0, stddev = 0.0;
+    if (!sorted.empty())
+    {
+      mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / double(sorted.size());
+    }
+    if (sorted.size() > 1)
+    {
+      double sum = 0.0;
+      for (auto v : sorted)
+      {
+        sum += (v - mean) * (v - mean);
+      }
+      stddev = std::sqrt(sum / double(sorted.size() - 1));
+    }
+    os << "{\n";
+    os << indent << "  \"count\": " << sorted.size() << ",\n";
+    os << indent << "  \"mean\": " << mean << ",\n";
+    os << indent << "  \"stddev\": " << stddev << ",\n";
+    os << indent << "  \"p50\": " << Percentile(sorted, 50.0) << ",\n";
+    os << indent << "  \"p95\": " << Percentile(sorted, 95.0) << ",\n";
+    os << indent << "  \"p99\": " << Percentile(sorted, 99.0) << ",\n";
+    os << indent << "  \"min\": " << (sorted.empty() ? 0.0 : sorted.front()) << ",\n";
+    os << indent << "  \"max\": " << (sorted.empty() ? 0.0 : sorted.back());
+    if (withSamples)
+    {
+      // 後段の比較処理で分布を扱えるよう、計測順の値もそのまま出力する.
+      os << ",\n" << indent << "  \"samples\": [";
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        os << (i == 0 ? "" : ", ") << values[i];
+      }
+      os << "]";
+    }
+    os << "\n" << indent << "}";
+  }
+
+  std::string EscapeJson(const std::string& str)
+  {
+    std::string ret;
+    for (auto c : str)
+    {
+      if (c == '"' || c == '\\')
+      {
+        ret += '\\';
+      }
+      ret += c;
+    }
+    return ret;
+  }
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+namespace book_util
+{
+  // 昇順に並んだ値から最近傍順位法でパーセンタイルを求める.
+  double Percentile(const std::vector<double>& sorted, double p);
+
+  // 件数/平均/標準偏差/パーセンタイル/最小/最大 を JSON のオブジェクトとして出力する.
+  // withSamples が true なら計測順の値もそのまま出力する.
+  void WriteJsonStatistics(std::ostream& os, const std::vector<double>& values, const char* indent, bool withSamples);
+
+  std::string EscapeJson(const std::string& str);
+}
@@ -1,159 +1,353 @@
-#include "Swapchain.h"
-#include "VulkanBookUtil.h"
-#include <algorithm>
-
-Swapchain::Swapchain(VkInstance instance, VkDevice device, VkSurfaceKHR surface)
-  : m_swapchain(VK_NULL_HANDLE), m_surface(surface), m_vkInstance(instance), m_device(device), m_presentMode(VK_PRESENT_MODE_FIFO_KHR)
-{
-}
-
-Swapchain::~Swapchain()
-{
-}
-
-
-// Xbv`FC̐.
-void Swapchain::Prepare(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat)
-{
-  VkResult result;
-  result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physDev, m_surface, &m_surfaceCaps);
-  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR Failed.");
-
-  uint32_t count = 0;
-  vkGetPhysicalDeviceSurfaceFormatsKHR(physDev, m_surface, &count, nullptr);
-  m_surfaceFormats.resize(count);
-  result = vkGetPhysicalDeviceSurfaceFormatsKHR(physDev, m_surface, &count, m_surfaceFormats.data());
-  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceFormatsKHR Failed.");
-
-  m_selectFormat = VkSurfaceFormatKHR{
-    VK_FORMAT_B8G8R8A8_UNORM,VK_COLOR_SPACE_SRGB_NONLINEAR_KHR
-  };
-  for (const auto& f : m_surfaceFormats)
-  {
-    if (f.format == desireFormat)
-    {
-      m_selectFormat = f;
-      break;
-    }
-  }
-
-  // T[tF[X\͒l̊mF.
-  VkBool32 isSupport;
-  result = vkGetPhysicalDeviceSurfaceSupportKHR(physDev, graphicsQueueIndex, m_surface, &isSupport);
-  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceSupportKHR Failed.");
-  if (isSupport == VK_FALSE)
-  {
-    throw book_util::VulkanException("vkGetPhysicalDeviceSurfaceSupportKHR: isSupport = false.");
-  }
-
-  auto imageCount = (std::max)(2u, m_surfaceCaps.minImageCount);
-  auto extent = m_surfaceCaps.currentExtent;
-  if (extent.width == ~0u)
-  {
-    // l̂߃EBhETCYgp.
-    extent.width = width;
-    extent.height = height;
-  }
-  m_surfaceExtent = extent;
-  
-  VkSwapchainKHR oldSwapchain = m_swapchain;
-  uint32_t queueFamilyIndices[] = { graphicsQueueIndex };
-  VkSwapchainCreateInfoKHR swapchainCI{
-    VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
-    nullptr, 0,
-    m_surface,
-    imageCount,
-    m_selectFormat.format,
-    m_selectFormat.colorSpace,
-    m_surfaceExtent,
-    1,
-    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
-    VK_SHARING_MODE_EXCLUSIVE,
-    _countof(queueFamilyIndices), queueFamilyIndices,
-    m_surfaceCaps.currentTransform,
-    VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
-    m_presentMode,
-    VK_TRUE,
-    oldSwapchain
-  };
-
-  result = vkCreateSwapchainKHR(m_device, &swapchainCI, nullptr, &m_swapchain);
-  ThrowIfFailed(result, "vkCreateSwapchainKHR Failed.");
-
-  // Â\[X.
-  if (oldSwapchain != VK_NULL_HANDLE)
-  {
-    for (auto& view : m_imageViews)
-    {
-      vkDestroyImageView(m_device, view, nullptr);
-    }
-    vkDestroySwapchainKHR(m_device, oldSwapchain, nullptr);
-    m_imageViews.clear();
-    m_images.clear();
-  }
-
-  vkGetSwapchainImagesKHR(m_device, m_swapchain, &imageCount, nullptr);
-  m_images.resize(imageCount);
-  m_imageViews.resize(imageCount);
-  vkGetSwapchainImagesKHR(m_device, m_swapchain, &imageCount, m_images.data());
-  for (uint32_t i=0;i<imageCount;++i)
-  {
-    VkImageViewCreateInfo viewCI{
-      VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-      nullptr, 0,
-      m_images[i],
-      VK_IMAGE_VIEW_TYPE_2D,
-      m_selectFormat.format,
-      book_util::DefaultComponentMapping(),
-      { // VkImageSubresourceRange
-        VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1
-      }
-    };
-    result = vkCreateImageView(m_device, &viewCI, nullptr, &m_imageViews[i]);
-    ThrowIfFailed(result, "vkCreateImageView Failed.");
-  }
-}
-
-void Swapchain::Cleanup()
-{
-  if (m_device != VK_NULL_HANDLE)
-  {
-    for (auto view : m_imageViews)
-    {
-      vkDestroyImageView(m_device, view, nullptr);
-    }
-    if (m_swapchain != VK_NULL_HANDLE)
-    {
-      vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
-    }
-    m_swapchain = VK_NULL_HANDLE;
-  }
-
-  if (m_vkInstance != VK_NULL_HANDLE)
-  {
-    vkDestroySurfaceKHR(m_vkInstance, m_surface, nullptr);
-    m_surface = VK_NULL_HANDLE;
-  }
-
-  m_images.clear();
-  m_imageViews.clear();
-}
-
-VkResult Swapchain::AcquireNextImage(uint32_t* pImageIndex, VkSemaphore semaphore, uint64_t timeout)
-{
-  auto result = vkAcquireNextImageKHR(m_device, m_swapchain, timeout, semaphore, VK_NULL_HANDLE, pImageIndex);
-  return result;
-}
-
-void Swapchain::QueuePresent(VkQueue queue, uint32_t imageIndex, VkSemaphore waitRenderComplete)
-{
-  VkPresentInfoKHR presentInfo{
-    VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-    nullptr,
-    1, &waitRenderComplete,
-    1, &m_swapchain,
-    &imageIndex
-  };
-  vkQueuePresentKHR(queue, &presentInfo);
-}
-
+#include "Swapchain.h"
+#include "VulkanBookUtil.h"
+#include <algorithm>
+
+Swapchain::Swapchain(VkInstance instance, VkDevice device, VkSurfaceKHR surface)
+  : m_swapchain(VK_NULL_HANDLE), m_surface(surface), m_vkInstance(instance), m_device(device), m_presentMode(VK_PRESENT_MODE_FIFO_KHR),
+  m_desiredPresentMode(VK_PRESENT_MODE_FIFO_KHR), m_imageUsage(0), m_offscreenQueue(VK_NULL_HANDLE), m_offscreenIndex(0)
+{
+}
+
+Swapchain::~Swapchain()
+{
+}
+
+
+// スワップチェインの生成.
+void Swapchain::Prepare(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat)
+{
+  if (IsHeadless())
+  {
+    PrepareOffscreen(physDev, graphicsQueueIndex, width, height, desireFormat);
+    return;
+  }
+  VkResult result;
+  result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physDev, m_surface, &m_surfaceCaps);
+  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR Failed.");
+
+  uint32_t count = 0;
+  vkGetPhysicalDeviceSurfaceFormatsKHR(physDev, m_surface, &count, nullptr);
+  m_surfaceFormats.resize(count);
+  result = vkGetPhysicalDeviceSurfaceFormatsKHR(physDev, m_surface, &count, m_surfaceFormats.data());
+  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceFormatsKHR Failed.");
+
+  m_selectFormat = VkSurfaceFormatKHR{
+    VK_FORMAT_B8G8R8A8_UNORM,VK_COLOR_SPACE_SRGB_NONLINEAR_KHR
+  };
+  for (const auto& f : m_surfaceFormats)
+  {
+    if (f.format == desireFormat)
+    {
+      m_selectFormat = f;
+      break;
+    }
+  }
+
+  // サーフェース能力値の確認.
+  VkBool32 isSupport;
+  result = vkGetPhysicalDeviceSurfaceSupportKHR(physDev, graphicsQueueIndex, m_surface, &isSupport);
+  ThrowIfFailed(result, "vkGetPhysicalDeviceSurfaceSupportKHR Failed.");
+  if (isSupport == VK_FALSE)
+  {
+    throw book_util::VulkanException("vkGetPhysicalDeviceSurfaceSupportKHR: isSupport = false.");
+  }
+
+  auto imageCount = (std::max)(2u, m_surfaceCaps.minImageCount);
+  auto extent = m_surfaceCaps.currentExtent;
+  if (extent.width == ~0u)
+  {
+    // 値が無効のためウィンドウサイズを使用する.
+    extent.width = width;
+    extent.height = height;
+  }
+  m_surfaceExtent = extent;
+
+  // キャプチャ用に読み出しが可能であれば転送元としても使えるようにしておく.
+  m_imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  if (m_surfaceCaps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT)
+  {
+    m_imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+
+  m_presentMode = SelectPresentMode(physDev);
+
+  VkSwapchainKHR oldSwapchain = m_swapchain;
+  uint32_t queueFamilyIndices[] = { graphicsQueueIndex };
+  VkSwapchainCreateInfoKHR swapchainCI{
+    VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+    nullptr, 0,
+    m_surface,
+    imageCount,
+    m_selectFormat.format,
+    m_selectFormat.colorSpace,
+    m_surfaceExtent,
+    1,
+    m_imageUsage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    _countof(queueFamilyIndices), queueFamilyIndices,
+    m_surfaceCaps.currentTransform,
+    VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+    m_presentMode,
+    VK_TRUE,
+    oldSwapchain
+  };
+
+  result = vkCreateSwapchainKHR(m_device, &swapchainCI, nullptr, &m_swapchain);
+  ThrowIfFailed(result, "vkCreateSwapchainKHR Failed.");
+
+  // 古いリソースを解放.
+  // 使用中のフレームが残っている可能性があるため、破棄関数が設定されていれば GPU の完了後まで遅延させる.
+  if (oldSwapchain != VK_NULL_HANDLE)
+  {
+    auto device = m_device;
+    auto oldViews = m_imageViews;
+    auto disposer = [device, oldSwapchain, oldViews]() {
+      for (auto& view : oldViews)
+      {
+        vkDestroyImageView(device, view, nullptr);
+      }
+      vkDestroySwapchainKHR(device, oldSwapchain, nullptr);
+    };
+    if (m_deferredDestroy)
+    {
+      m_deferredDestroy(disposer);
+    }
+    else
+    {
+      disposer();
+    }
+    m_imageViews.clear();
+    m_images.clear();
+  }
+
+  vkGetSwapchainImagesKHR(m_device, m_swapchain, &imageCount, nullptr);
+  m_images.resize(imageCount);
+  m_imageViews.resize(imageCount);
+  vkGetSwapchainImagesKHR(m_device, m_swapchain, &imageCount, m_images.data());
+  for (uint32_t i=0;i<imageCount;++i)
+  {
+    VkImageViewCreateInfo viewCI{
+      VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+      nullptr, 0,
+      m_images[i],
+      VK_IMAGE_VIEW_TYPE_2D,
+      m_selectFormat.format,
+      book_util::DefaultComponentMapping(),
+      { // VkImageSubresourceRange
+        VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1
+      }
+    };
+    result = vkCreateImageView(m_device, &viewCI, nullptr, &m_imageViews[i]);
+    ThrowIfFailed(result, "vkCreateImageView Failed.");
+  }
+}
+
+void Swapchain::Cleanup()
+{
+  if (IsHeadless())
+  {
+    DestroyOffscreen();
+    return;
+  }
+  if (m_device != VK_NULL_HANDLE)
+  {
+    for (auto view : m_imageViews)
+    {
+      vkDestroyImageView(m_device, view, nullptr);
+    }
+    if (m_swapchain != VK_NULL_HANDLE)
+    {
+      vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
+    }
+    m_swapchain = VK_NULL_HANDLE;
+  }
+
+  if (m_vkInstance != VK_NULL_HANDLE)
+  {
+    vkDestroySurfaceKHR(m_vkInstance, m_surface, nullptr);
+    m_surface = VK_NULL_HANDLE;
+  }
+
+  m_images.clear();
+  m_imageViews.clear();
+}
+
+VkResult Swapchain::AcquireNextImage(uint32_t* pImageIndex, VkSemaphore semaphore, uint64_t timeout)
+{
+  if (IsHeadless())
+  {
+    // 表示先が無いため順番に使い回す. 待機側のために空の送信でセマフォをシグナルしておく.
+    *pImageIndex = m_offscreenIndex;
+    m_offscreenIndex = (m_offscreenIndex + 1) % GetImageCount();
+    VkSubmitInfo submitInfo{
+      VK_STRUCTURE_TYPE_SUBMIT_INFO, nullptr,
+      0, nullptr, nullptr,
+      0, nullptr,
+      1, &semaphore,
+    };
+    return vkQueueSubmit(m_offscreenQueue, 1, &submitInfo, VK_NULL_HANDLE);
+  }
+  auto result = vkAcquireNextImageKHR(m_device, m_swapchain, timeout, semaphore, VK_NULL_HANDLE, pImageIndex);
+  return result;
+}
+
+VkResult Swapchain::QueuePresent(VkQueue queue, uint32_t imageIndex, VkSemaphore waitRenderComplete)
+{
+  if (IsHeadless())
+  {
+    // 描画完了のセマフォを消費するだけの送信を行う.
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    VkSubmitInfo submitInfo{
+      VK_STRUCTURE_TYPE_SUBMIT_INFO, nullptr,
+      1, &waitRenderComplete, &waitStage,
+      0, nullptr,
+      0, nullptr,
+    };
+    return vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+  }
+  VkPresentInfoKHR presentInfo{
+    VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+    nullptr,
+    1, &waitRenderComplete,
+    1, &m_swapchain,
+    &imageIndex
+  };
+  return vkQueuePresentKHR(queue, &presentInfo);
+}
+
+VkPresentModeKHR Swapchain::SelectPresentMode(VkPhysicalDevice physDev) const
+{
+  if (m_desiredPresentMode == VK_PRESENT_MODE_FIFO_KHR)
+  {
+    return VK_PRESENT_MODE_FIFO_KHR;
+  }
+  uint32_t count = 0;
+  vkGetPhysicalDeviceSurfacePresentModesKHR(physDev, m_surface, &count, nullptr);
+  std::vector<VkPresentModeKHR> modes(count);
+  vkGetPhysicalDeviceSurfacePresentModesKHR(physDev, m_surface, &count, modes.data());
+  for (auto mode : modes)
+  {
+    if (mode == m_desiredPresentMode)
+    {
+      return mode;
+    }
+  }
+  // FIFO は必ずサポートされている.
+  return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+void Swapchain::PrepareOffscreen(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat)
+{
+  vkGetDeviceQueue(m_device, graphicsQueueIndex, 0, &m_offscreenQueue);
+
+  m_selectFormat = VkSurfaceFormatKHR{
+    desireFormat, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR
+  };
+  if (desireFormat == VK_FORMAT_UNDEFINED)
+  {
+    m_selectFormat.format = VK_FORMAT_B8G8R8A8_UNORM;
+  }
+  m_surfaceExtent = VkExtent2D{ width, height };
+  m_presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+  m_imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+  // 作り直しの場合は古いイメージを遅延破棄に回す.
+  if (!m_images.empty())
+  {
+    auto device = m_device;
+    auto oldImages = m_images;
+    auto oldViews = m_imageViews;
+    auto oldMemory = m_offscreenMemory;
+    auto disposer = [device, oldImages, oldViews, oldMemory]() {
+      for (size_t i = 0; i < oldImages.size(); ++i)
+      {
+        vkDestroyImageView(device, oldViews[i], nullptr);
+        vkDestroyImage(device, oldImages[i], nullptr);
+        vkFreeMemory(device, oldMemory[i], nullptr);
+      }
+    };
+    if (m_deferredDestroy)
+    {
+      m_deferredDestroy(disposer);
+    }
+    else
+    {
+      disposer();
+    }
+    m_images.clear();
+    m_imageViews.clear();
+    m_offscreenMemory.clear();
+  }
+
+  VkPhysicalDeviceMemoryProperties memProps;
+  vkGetPhysicalDeviceMemoryProperties(physDev, &memProps);
+
+  const uint32_t imageCount = 3;
+  m_images.resize(imageCount);
+  m_imageViews.resize(imageCount);
+  m_offscreenMemory.resize(imageCount);
+  m_offscreenIndex = 0;
+  for (uint32_t i = 0; i < imageCount; ++i)
+  {
+    VkImageCreateInfo imageCI{
+      VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+      nullptr, 0,
+      VK_IMAGE_TYPE_2D,
+      m_selectFormat.format, { width, height, 1 },
+      1, 1, VK_SAMPLE_COUNT_1_BIT,
+      VK_IMAGE_TILING_OPTIMAL,
+      m_imageUsage,
+      VK_SHARING_MODE_EXCLUSIVE,
+      0, nullptr,
+      VK_IMAGE_LAYOUT_UNDEFINED
+    };
+    auto result = vkCreateImage(m_device, &imageCI, nullptr, &m_images[i]);
+    ThrowIfFailed(result, "vkCreateImage Failed.");
+
+    VkMemoryRequirements reqs;
+    vkGetImageMemoryRequirements(m_device, m_images[i], &reqs);
+    uint32_t memoryTypeIndex = ~0u;
+    for (uint32_t j = 0; j < memProps.memoryTypeCount; ++j)
+    {
+      if ((reqs.memoryTypeBits & (1u << j)) &&
+        (memProps.memoryTypes[j].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))
+      {
+        memoryTypeIndex = j;
+        break;
+      }
+    }
+    VkMemoryAllocateInfo info{
+      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+      nullptr,
+      reqs.size, memoryTypeIndex
+    };
+    result = vkAllocateMemory(m_device, &info, nullptr, &m_offscreenMemory[i]);
+    ThrowIfFailed(result, "vkAllocateMemory Failed.");
+    vkBindImageMemory(m_device, m_images[i], m_offscreenMemory[i], 0);
+
+    VkImageViewCreateInfo viewCI{
+      VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+      nullptr, 0,
+      m_images[i],
+      VK_IMAGE_VIEW_TYPE_2D,
+      m_selectFormat.format,
+      book_util::DefaultComponentMapping(),
+      { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 }
+    };
+    result = vkCreateImageView(m_device, &viewCI, nullptr, &m_imageViews[i]);
+    ThrowIfFailed(result, "vkCreateImageView Failed.");
+  }
+}
+
+void Swapchain::DestroyOffscreen()
+{
+  for (size_t i = 0; i < m_images.size(); ++i)
+  {
+    vkDestroyImageView(m_device, m_imageViews[i], nullptr);
+    vkDestroyImage(m_device, m_images[i], nullptr);
+    vkFreeMemory(m_device, m_offscreenMemory[i], nullptr);
+  }
+  m_images.clear();
+  m_imageViews.clear();
+  m_offscreenMemory.clear();
+}
@@ -1,42 +1,70 @@
-#pragma once
-#define GLFW_INCLUDE_VULKAN
-#include <GLFW/glfw3.h>
-#include <vector>
-
-class Swapchain
-{
-public:
-  Swapchain(VkInstance instance, VkDevice device, VkSurfaceKHR surface);
-  ~Swapchain();
-
-  void Prepare(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat);
-  void Cleanup();
-
-  VkResult AcquireNextImage(uint32_t* pImageIndex, VkSemaphore semaphore, uint64_t timeout = UINT64_MAX);
-
-
-  void QueuePresent(VkQueue queue, uint32_t imageIndex, VkSemaphore waitRenderComplete);
-
-  VkSurfaceFormatKHR GetSurfaceFormat() const { return m_selectFormat; }
-
-  VkExtent2D GetSurfaceExtent() const { return m_surfaceExtent; }
-  uint32_t GetImageCount() const { return uint32_t(m_images.size()); }
-  VkImageView GetImageView(int index) { return m_imageViews[index]; }
-  VkImage GetImage(int index) { return m_images[index]; };
-
-  VkSurfaceKHR GetSurface() const { return m_surface; }
-private:
-  VkSwapchainKHR m_swapchain;
-  VkSurfaceKHR m_surface;
-  VkInstance m_vkInstance;
-  VkDevice m_device;
-  VkSurfaceCapabilitiesKHR m_surfaceCaps;
-  
-  std::vector<VkSurfaceFormatKHR> m_surfaceFormats;
-  VkSurfaceFormatKHR m_selectFormat;
-  VkExtent2D m_surfaceExtent;
-  VkPresentModeKHR  m_presentMode;
-
-  std::vector<VkImage> m_images;
-  std::vector<VkImageView> m_imageViews;
+#pragma once
+#define GLFW_INCLUDE_VULKAN
+#include <GLFW/glfw3.h>
+#include <vector>
+#include <functional>
+
+// surface に VK_NULL_HANDLE を指定した場合は、表示を行わないオフスクリーンのイメージを
+// スワップチェインの代わりに使用する(ヘッドレス実行用).
+class Swapchain
+{
+public:
+  Swapchain(VkInstance instance, VkDevice device, VkSurfaceKHR surface);
+  ~Swapchain();
+
+  void Prepare(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat);
+  void Cleanup();
+
+  VkResult AcquireNextImage(uint32_t* pImageIndex, VkSemaphore semaphore, uint64_t timeout = UINT64_MAX);
+
+
+  VkResult QueuePresent(VkQueue queue, uint32_t imageIndex, VkSemaphore waitRenderComplete);
+
+  // 作り直しで不要になった古いスワップチェインの破棄方法を設定する.
+  // 未設定の場合は Prepare 内で即座に破棄する.
+  using DeferredDestroyFunc = std::function<void(std::function<void()>)>;
+  void SetDeferredDestroyFunc(DeferredDestroyFunc func) { m_deferredDestroy = func; }
+
+  // 希望する表示モードを設定する. 対応していない場合は FIFO を使用する.
+  // 次の Prepare から有効となる.
+  void SetPresentMode(VkPresentModeKHR mode) { m_desiredPresentMode = mode; }
+  VkPresentModeKHR GetPresentMode() const { return m_presentMode; }
+  bool IsHeadless() const { return m_surface == VK_NULL_HANDLE; }
+
+  VkSurfaceFormatKHR GetSurfaceFormat() const { return m_selectFormat; }
+
+  VkExtent2D GetSurfaceExtent() const { return m_surfaceExtent; }
+  uint32_t GetImageCount() const { return uint32_t(m_images.size()); }
+  VkImageView GetImageView(int index) { return m_imageViews[index]; }
+  VkImage GetImage(int index) { return m_images[index]; };
+
+  VkSurfaceKHR GetSurface() const { return m_surface; }
+  VkImageUsageFlags GetImageUsage() const { return m_imageUsage; }
+private:
+  void PrepareOffscreen(VkPhysicalDevice physDev, uint32_t graphicsQueueIndex, uint32_t width, uint32_t height, VkFormat desireFormat);
+  void DestroyOffscreen();
+  VkPresentModeKHR SelectPresentMode(VkPhysicalDevice physDev) const;
+
+  VkSwapchainKHR m_swapchain;
+  VkSurfaceKHR m_surface;
+  VkInstance m_vkInstance;
+  VkDevice m_device;
+  VkSurfaceCapabilitiesKHR m_surfaceCaps;
+  
+  std::vector<VkSurfaceFormatKHR> m_surfaceFormats;
+  VkSurfaceFormatKHR m_selectFormat;
+  VkExtent2D m_surfaceExtent;
+  VkPresentModeKHR  m_presentMode;
+  VkPresentModeKHR  m_desiredPresentMode;
+  VkImageUsageFlags m_imageUsage;
+
+  std::vector<VkImage> m_images;
+  std::vector<VkImageView> m_imageViews;
+
+  // オフスクリーン時の情報.
+  std::vector<VkDeviceMemory> m_offscreenMemory;
+  VkQueue m_offscreenQueue;
+  uint32_t m_offscreenIndex;
+
+  DeferredDestroyFunc m_deferredDestroy;
 };
\ No newline at end of file
@@ -1,1235 +1,1235 @@
-﻿#pragma once
-
-#include <glm/glm.hpp>
-
-namespace TeapotModel
-{
-    using glm::vec3;
-    struct Vertex {
-        vec3 Position;
-        vec3 Normal;
-
-        Vertex(float px, float py, float pz, float nx, float ny, float nz) : Position(px, py, pz), Normal(nx, ny, nz) { }
-    };
-
-    Vertex TeapotVerticesPN[] = {
-        Vertex(0.6788729f, 0.330678f, 0.0f, -0.9457507f, -0.3222559f, -0.04130899f),
-        Vertex(0.669556f, 0.358022f, 0.0f, -0.992771f, -0.120019f, -0.001089f),
-        Vertex(0.6710029f, 0.374428f, 0.0f, -0.8427508f, 0.5381688f, 0.012052f),
-        Vertex(0.6804349f, 0.379897f, 0.0f, -0.08358802f, 0.9962882f, 0.02056001f),
-        Vertex(0.6950769f, 0.374428f, 0.0f, 0.5321701f, 0.8466032f, 0.007614002f),
-        Vertex(0.712148f, 0.358022f, 0.0f, 0.7793002f, 0.6266412f, 0.003491001f),
-        Vertex(0.728873f, 0.330678f, 0.0f, 0.879896f, 0.475165f, 0.001103f),
-        Vertex(0.6542429f, 0.330678f, 0.187963f,-0.9024127f, -0.3227829f, -0.2854159f),
-        Vertex(0.645254f, 0.358022f, 0.185461f,-0.9585577f, -0.120097f, -0.2583479f),
-        Vertex(0.64665f, 0.374428f, 0.18585f, -0.8168749f, 0.5385789f, -0.206514f),
-        Vertex(0.6557509f, 0.379897f, 0.188383f,-0.08619004f, 0.9962775f, -0.001604001f),
-        Vertex(0.6698769f, 0.374428f, 0.192314f,0.5114839f, 0.8469418f, 0.145167f),
-        Vertex(0.686348f, 0.358022f, 0.196898f,0.7513633f, 0.6271642f, 0.2052271f),
-        Vertex(0.702484f, 0.330678f, 0.201389f,0.8492812f, 0.4756821f, 0.2290151f),
-        Vertex(0.5845019f, 0.330678f, 0.355704f,-0.7974489f, -0.323303f, -0.5094609f),
-        Vertex(0.5764409f, 0.358022f, 0.350969f,-0.8586246f, -0.1203279f, -0.4982818f),
-        Vertex(0.5776929f, 0.374428f, 0.351704f,-0.7350169f, 0.5389569f, -0.411431f),
-        Vertex(0.5858539f, 0.379897f, 0.356498f,-0.08258003f, 0.9962944f, -0.02404301f),
-        Vertex(0.5985219f, 0.374428f, 0.363938f,0.4557349f, 0.8473518f, 0.272581f),
-        Vertex(0.6132919f, 0.358022f, 0.372613f,0.6718558f, 0.6278678f, 0.3929269f),
-        Vertex(0.627762f, 0.330678f, 0.381111f,0.7603989f, 0.476384f, 0.44142f),
-        Vertex(0.475873f, 0.330678f, 0.497f, -0.6393409f, -0.323439f, -0.6975889f),
-        Vertex(0.469258f, 0.358022f, 0.490385f,-0.7011832f, -0.120461f, -0.7027312f),
-        Vertex(0.470285f, 0.374428f, 0.491412f,-0.60404f, 0.539064f, -0.58698f),
-        Vertex(0.476982f, 0.379897f, 0.498109f,-0.07339898f, 0.9963088f, -0.04451099f),
-        Vertex(0.487377f, 0.374428f, 0.5085049f,0.3699249f, 0.8474988f, 0.3806589f),
-        Vertex(0.499498f, 0.358022f, 0.5206259f,0.5477221f, 0.6281432f, 0.5526631f),
-        Vertex(0.5113729f, 0.330678f, 0.5325f,0.6208259f, 0.4766599f, 0.6223909f),
-        Vertex(0.334576f, 0.330678f, 0.6056299f,-0.437782f, -0.323142f, -0.839003f),
-        Vertex(0.329842f, 0.358022f, 0.5975689f,-0.4963727f, -0.1204369f, -0.8597144f),
-        Vertex(0.330577f, 0.374428f, 0.5988199f,-0.4324432f, 0.5388762f, -0.7229143f),
-        Vertex(0.33537f, 0.379897f, 0.6069819f,-0.059523f, 0.996312f, -0.061801f),
-        Vertex(0.34281f, 0.374428f, 0.6196489f,0.259388f, 0.8473261f, 0.4634181f),
-        Vertex(0.351485f, 0.358022f, 0.634419f,0.3868439f, 0.6278797f, 0.6753657f),
-        Vertex(0.359984f, 0.330678f, 0.6488889f,0.439492f, 0.4763981f, 0.7615061f),
-        Vertex(0.166836f, 0.330678f, 0.6753699f,-0.2046809f, -0.3225468f, -0.9241586f),
-        Vertex(0.164334f, 0.358022f, 0.6663809f,-0.2562089f, -0.1202569f, -0.9591116f),
-        Vertex(0.164722f, 0.374428f, 0.6677769f,-0.230122f, 0.538458f, -0.8106211f),
-        Vertex(0.167255f, 0.379897f, 0.6768779f,-0.04166798f, 0.9963036f, -0.07511897f),
-        Vertex(0.171187f, 0.374428f, 0.6910039f,0.1303f, 0.8469041f, 0.515534f),
-        Vertex(0.175771f, 0.358022f, 0.7074749f,0.1983909f, 0.6271816f, 0.7531826f),
-        Vertex(0.180262f, 0.330678f, 0.7236109f,0.226852f, 0.4757029f, 0.8498498f),
-        Vertex(-0.021127f, 0.330678f, 0.6999999f,0.03594102f, -0.3302142f, -0.9432215f),
-        Vertex(-0.021127f, 0.358022f, 0.6906829f,-0.001376f, -0.125569f, -0.9920838f),
-        Vertex(-0.021127f, 0.374428f, 0.69213f,-0.012701f, 0.5357922f, -0.8442543f),
-        Vertex(-0.021127f, 0.379897f, 0.7015629f,-0.02067201f, 0.9963434f, -0.08290103f),
-        Vertex(-0.021127f, 0.374428f, 0.7162039f,-0.007570999f, 0.8464268f, 0.5324509f),
-        Vertex(-0.021127f, 0.358022f, 0.7332759f,-0.003481999f, 0.6266079f, 0.7793269f),
-        Vertex(-0.021127f, 0.330678f, 0.7499999f,-0.001103f, 0.475165f, 0.879896f),
-        Vertex(-0.224715f, 0.330678f, 0.6753699f,0.269574f, -0.3869541f, -0.8818142f),
-        Vertex(-0.215631f, 0.358022f, 0.6663809f,0.249993f, -0.181783f, -0.9510301f),
-        Vertex(-0.211606f, 0.374428f, 0.6677769f,0.211872f, 0.499984f, -0.8397179f),
-        Vertex(-0.211463f, 0.379897f, 0.6768779f,0.002768f, 0.9957681f, -0.09185901f),
-        Vertex(-0.21402f, 0.374428f, 0.6910039f,-0.1464459f, 0.8441496f, 0.5157177f),
-        Vertex(-0.218098f, 0.358022f, 0.7074749f,-0.2054971f, 0.6259093f, 0.7523354f),
-        Vertex(-0.222516f, 0.330678f, 0.7236109f,-0.229034f, 0.4755359f, 0.8493578f),
-        Vertex(-0.396831f, 0.330678f, 0.6056299f,0.4828537f, -0.4459237f, -0.7536605f),
-        Vertex(-0.383671f, 0.358022f, 0.5975689f,0.4838833f, -0.2615992f, -0.8351185f),
-        Vertex(-0.378758f, 0.374428f, 0.5988199f,0.4423379f, 0.4340159f, -0.7848359f),
-        Vertex(-0.380125f, 0.379897f, 0.6069819f,0.03667998f, 0.9935015f, -0.1077459f),
-        Vertex(-0.385806f, 0.374428f, 0.6196489f,-0.2785098f, 0.8399482f, 0.4657456f),
-        Vertex(-0.393832f, 0.358022f, 0.634419f,-0.39439f, 0.6241421f, 0.6744651f),
-        Vertex(-0.402238f, 0.330678f, 0.6488889f,-0.4415409f, 0.4759128f, 0.7606238f),
-        Vertex(-0.5350019f, 0.330678f, 0.497f,0.669165f, -0.453044f, -0.5890409f),
-        Vertex(-0.521278f, 0.358022f, 0.490385f,0.6864011f, -0.28753f, -0.6679671f),
-        Vertex(-0.517539f, 0.374428f, 0.491412f,0.643212f, 0.404496f, -0.650124f),
-        Vertex(-0.5213459f, 0.379897f, 0.498109f,0.07460403f, 0.9914605f, -0.1069591f),
-        Vertex(-0.5302569f, 0.374428f, 0.5085049f, -0.391289f, 0.8379869f, 0.380356f),
-        Vertex(-0.541831f, 0.358022f, 0.5206259f,-0.5554837f, 0.6231316f, 0.5505857f),
-        Vertex(-0.553627f, 0.330678f, 0.5325f,-0.6226361f, 0.4760081f, 0.6210801f),
-        Vertex(-0.636757f, 0.330678f, 0.355704f,0.8217878f, -0.4077159f, -0.3980359f),
-        Vertex(-0.6244829f, 0.358022f, 0.350969f,0.8498941f, -0.24443f, -0.4668341f),
-        Vertex(-0.62291f, 0.374428f, 0.351704f,0.7780953f, 0.4358042f, -0.4523742f),
-        Vertex(-0.6293589f, 0.379897f, 0.356498f,0.09545795f, 0.9921145f, -0.08121795f),
-        Vertex(-0.6411459f, 0.374428f, 0.363938f,-0.4736589f, 0.8398708f, 0.2650739f),
-        Vertex(-0.6555929f, 0.358022f, 0.372613f,-0.6782652f, 0.6237241f, 0.3884901f),
-        Vertex(-0.6700159f, 0.330678f, 0.381111f,-0.7617679f, 0.4758419f, 0.4396409f),
-        Vertex(-0.6996229f, 0.330678f, 0.187963f,0.9191499f, -0.348512f, -0.183583f),
-        Vertex(-0.6893169f, 0.358022f, 0.185461f,0.9562184f, -0.1711391f, -0.2373981f),
-        Vertex(-0.6898299f, 0.374428f, 0.18585f,0.8388228f, 0.4938979f, -0.229f),
-        Vertex(-0.698396f, 0.379897f, 0.188382f,0.09432202f, 0.9944041f, -0.04757801f),
-        Vertex(-0.712247f, 0.374428f, 0.192314f,-0.52064f, 0.843596f, 0.131452f),
-        Vertex(-0.728617f, 0.358022f, 0.196898f,-0.7547529f, 0.6251799f, 0.198741f),
-        Vertex(-0.7447379f, 0.330678f, 0.201389f,-0.8499968f, 0.4754259f, 0.226882f),
-        Vertex(-0.7211269f, 0.330678f, 0.0f,   0.9455373f, -0.3221831f, 0.04644601f),
-        Vertex(-0.7118099f, 0.358022f, 0.0f,   0.9918807f, -0.126966f, 0.007215998f),
-        Vertex(-0.713257f, 0.374428f, 0.0f,   0.8475716f, 0.5306047f, -0.008995995f),
-        Vertex(-0.7226899f, 0.379897f, 0.0f,   0.08787897f, 0.9959177f, -0.02061499f),
-        Vertex(-0.7373309f, 0.374428f, 0.0f,   -0.5330627f, 0.8460405f, -0.007710996f),
-        Vertex(-0.7544029f, 0.358022f, 0.0f,   -0.7796119f, 0.6262529f, -0.003531999f),
-        Vertex(-0.7711269f, 0.330678f, 0.0f,   -0.8799261f, 0.4751091f, -0.001109f),
-        Vertex(-0.6964979f, 0.330678f, -0.187963f,   0.9024127f, -0.3227829f, 0.2854159f),
-        Vertex(-0.6875079f, 0.358022f, -0.185461f,   0.9585577f, -0.120097f, 0.2583479f),
-        Vertex(-0.6889039f, 0.374428f, -0.18585f,0.8168749f, 0.5385789f, 0.206514f),
-        Vertex(-0.698005f, 0.379897f, -0.188383f,0.08619004f, 0.9962775f, 0.001604001f),
-        Vertex(-0.712131f, 0.374428f, -0.192314f,-0.5114839f, 0.8469418f, -0.145167f),
-        Vertex(-0.7286019f, 0.358022f, -0.196898f,   -0.7513633f, 0.6271642f, -0.2052271f),
-        Vertex(-0.7447379f, 0.330678f, -0.201389f,   -0.8492812f, 0.4756821f, -0.2290151f),
-        Vertex(-0.626757f, 0.330678f, -0.355704f,0.7974489f, -0.323303f, 0.5094609f),
-        Vertex(-0.6186959f, 0.358022f, -0.350969f,   0.8586246f, -0.1203279f, 0.4982818f),
-        Vertex(-0.619948f, 0.374428f, -0.351704f,0.7350169f, 0.5389569f, 0.411431f),
-        Vertex(-0.6281089f, 0.379897f, -0.356498f,   0.08258003f, 0.9962944f, 0.02404301f),
-        Vertex(-0.6407759f, 0.374428f, -0.363938f,   -0.4557349f, 0.8473518f, -0.272581f),
-        Vertex(-0.6555459f, 0.358022f, -0.372613f,   -0.6718558f, 0.6278678f, -0.3929269f),
-        Vertex(-0.6700159f, 0.330678f, -0.381111f,   -0.7603989f, 0.476384f, -0.44142f),
-        Vertex(-0.518127f, 0.330678f, -0.497f,0.6393409f, -0.323439f, 0.6975889f),
-        Vertex(-0.5115119f, 0.358022f, -0.490385f,   0.7011832f, -0.120461f, 0.7027312f),
-        Vertex(-0.512539f, 0.374428f, -0.491412f,0.60404f, 0.539064f, 0.58698f),
-        Vertex(-0.5192369f, 0.379897f, -0.498109f,   0.07339898f, 0.9963088f, 0.04451099f),
-        Vertex(-0.5296319f, 0.374428f, -0.5085049f,   -0.3699249f, 0.8474988f, -0.3806589f),
-        Vertex(-0.5417529f, 0.358022f, -0.5206259f,   -0.5477221f, 0.6281432f, -0.5526631f),
-        Vertex(-0.553627f, 0.330678f, -0.5325f,-0.6208259f, 0.4766599f, -0.6223909f),
-        Vertex(-0.376831f, 0.330678f, -0.6056299f,   0.437782f, -0.323142f, 0.839003f),
-        Vertex(-0.372096f, 0.358022f, -0.5975689f,   0.4963727f, -0.1204369f, 0.8597144f),
-        Vertex(-0.372832f, 0.374428f, -0.5988199f,   0.4324432f, 0.5388762f, 0.7229143f),
-        Vertex(-0.377625f, 0.379897f, -0.6069819f,   0.059523f, 0.996312f, 0.061801f),
-        Vertex(-0.385065f, 0.374428f, -0.6196489f,   -0.259388f, 0.8473261f, -0.4634181f),
-        Vertex(-0.39374f, 0.358022f, -0.634419f,-0.3868439f, 0.6278797f, -0.6753657f),
-        Vertex(-0.402238f, 0.330678f, -0.6488889f,   -0.439492f, 0.4763981f, -0.7615061f),
-        Vertex(-0.20909f, 0.330678f, -0.6753699f,0.2046809f, -0.3225468f, 0.9241586f),
-        Vertex(-0.206588f, 0.358022f, -0.6663809f,   0.2562089f, -0.1202569f, 0.9591116f),
-        Vertex(-0.206977f, 0.374428f, -0.6677769f,   0.230122f, 0.538458f, 0.8106211f),
-        Vertex(-0.20951f, 0.379897f, -0.6768779f,0.04166798f, 0.9963036f, 0.07511897f),
-        Vertex(-0.213441f, 0.374428f, -0.6910039f,   -0.1303f, 0.8469041f, -0.515534f),
-        Vertex(-0.218025f, 0.358022f, -0.7074749f,   -0.1983909f, 0.6271816f, -0.7531826f),
-        Vertex(-0.222516f, 0.330678f, -0.7236109f,   -0.226852f, 0.4757029f, -0.8498498f),
-        Vertex(-0.021127f, 0.330678f, -0.6999999f,   -0.04130899f, -0.3222559f, 0.9457507f),
-        Vertex(-0.021127f, 0.358022f, -0.6906829f,   -0.001089f, -0.120019f, 0.9927709f),
-        Vertex(-0.021127f, 0.374428f, -0.69213f,0.012052f, 0.5381688f, 0.8427508f),
-        Vertex(-0.021127f, 0.379897f, -0.7015629f,   0.02056001f, 0.9962882f, 0.08358802f),
-        Vertex(-0.021127f, 0.374428f, -0.7162039f,   0.007614002f, 0.8466032f, -0.5321701f),
-        Vertex(-0.021127f, 0.358022f, -0.7332759f,   0.003491001f, 0.6266412f, -0.7793002f),
-        Vertex(-0.021127f, 0.330678f, -0.7499999f,   0.001103f, 0.475165f, -0.879896f),
-        Vertex(0.166836f, 0.330678f, -0.6753699f,-0.2854159f, -0.3227829f, 0.9024127f),
-        Vertex(0.164334f, 0.358022f, -0.6663809f,-0.2583479f, -0.120097f, 0.9585577f),
-        Vertex(0.164722f, 0.374428f, -0.6677769f,-0.206514f, 0.5385789f, 0.8168749f),
-        Vertex(0.167255f, 0.379897f, -0.6768779f,-0.001604001f, 0.9962775f, 0.08619004f),
-        Vertex(0.171187f, 0.374428f, -0.6910039f,0.145167f, 0.8469418f, -0.5114839f),
-        Vertex(0.175771f, 0.358022f, -0.7074749f,0.2052271f, 0.6271642f, -0.7513633f),
-        Vertex(0.180262f, 0.330678f, -0.7236109f,0.2290151f, 0.4756821f, -0.8492812f),
-        Vertex(0.334576f, 0.330678f, -0.6056299f,-0.5094609f, -0.323303f, 0.7974489f),
-        Vertex(0.329842f, 0.358022f, -0.5975689f,-0.4982818f, -0.1203279f, 0.8586246f),
-        Vertex(0.330577f, 0.374428f, -0.5988199f,-0.411431f, 0.5389569f, 0.7350169f),
-        Vertex(0.33537f, 0.379897f, -0.6069819f,-0.02404301f, 0.9962944f, 0.08258003f),
-        Vertex(0.34281f, 0.374428f, -0.6196489f,0.272581f, 0.8473518f, -0.4557349f),
-        Vertex(0.351485f, 0.358022f, -0.634419f,0.3929269f, 0.6278678f, -0.6718558f),
-        Vertex(0.359984f, 0.330678f, -0.6488889f,0.44142f, 0.476384f, -0.760399f),
-        Vertex(0.475873f, 0.330678f, -0.497f,   -0.6975889f, -0.323439f, 0.6393409f),
-        Vertex(0.469258f, 0.358022f, -0.490385f,-0.7027313f, -0.120461f, 0.7011833f),
-        Vertex(0.470285f, 0.374428f, -0.491412f,-0.58698f, 0.539064f, 0.60404f),
-        Vertex(0.476982f, 0.379897f, -0.498109f,-0.04451099f, 0.9963088f, 0.07339898f),
-        Vertex(0.487377f, 0.374428f, -0.5085049f,0.3806589f, 0.8474988f, -0.3699249f),
-        Vertex(0.499498f, 0.358022f, -0.5206259f,0.5526631f, 0.6281432f, -0.5477221f),
-        Vertex(0.5113729f, 0.330678f, -0.5325f,0.6223909f, 0.4766599f, -0.6208259f),
-        Vertex(0.5845019f, 0.330678f, -0.355704f,-0.839003f, -0.323142f, 0.437782f),
-        Vertex(0.5764409f, 0.358022f, -0.350969f,-0.8597144f, -0.1204369f, 0.4963727f),
-        Vertex(0.5776929f, 0.374428f, -0.351704f,-0.7229143f, 0.5388762f, 0.4324432f),
-        Vertex(0.5858539f, 0.379897f, -0.356498f,-0.061801f, 0.996312f, 0.059523f),
-        Vertex(0.5985219f, 0.374428f, -0.363938f,0.4634181f, 0.8473261f, -0.259388f),
-        Vertex(0.6132919f, 0.358022f, -0.372613f,0.6753657f, 0.6278797f, -0.3868439f),
-        Vertex(0.627762f, 0.330678f, -0.381111f,0.7615061f, 0.4763981f, -0.439492f),
-        Vertex(0.6542429f, 0.330678f, -0.187963f,-0.9241586f, -0.3225468f, 0.2046809f),
-        Vertex(0.645254f, 0.358022f, -0.185461f,-0.9591116f, -0.1202569f, 0.2562089f),
-        Vertex(0.64665f, 0.374428f, -0.18585f,-0.8106211f, 0.538458f, 0.230122f),
-        Vertex(0.6557509f, 0.379897f, -0.188382f,-0.07511897f, 0.9963036f, 0.04166798f),
-        Vertex(0.6698769f, 0.374428f, -0.192314f,0.515534f, 0.8469041f, -0.1303f),
-        Vertex(0.686348f, 0.358022f, -0.196898f,0.7531826f, 0.6271816f, -0.1983909f),
-        Vertex(0.702484f, 0.330678f, -0.201389f,0.8498498f, 0.4757029f, -0.226852f),
-        Vertex(0.790794f, 0.199602f, 0.0f,   0.9081803f, 0.4185792f, 0.0001700001f),
-        Vertex(0.8492429f, 0.06956699f, 0.0f,   0.9200605f, 0.3917758f, 0.0003349998f),
-        Vertex(0.900748f, -0.058384f, 0.0f,   0.9392541f, 0.343222f, 0.0004780001f),
-        Vertex(0.9418359f, -0.183211f, 0.0f,   0.9638073f, 0.2665991f, 0.0005520002f),
-        Vertex(0.969035f, -0.30387f, 0.0f,   0.9882613f, 0.1527721f, 0.0004490002f),
-        Vertex(0.978873f, -0.419322f, 0.0f,   0.9989327f, -0.04618698f, -0.0002619999f),
-        Vertex(0.7622269f, 0.199602f, 0.218016f,0.8768925f, 0.4190732f, 0.2354511f),
-        Vertex(0.818619f, 0.06956699f, 0.233711f,0.8883488f, 0.3922469f, 0.238702f),
-        Vertex(0.8683119f, -0.058384f, 0.247541f,0.9068913f, 0.3436481f, 0.2438321f),
-        Vertex(0.9079539f, -0.183211f, 0.258573f,0.9306441f, 0.266938f, 0.250291f),
-        Vertex(0.9341959f, -0.30387f, 0.265877f,0.9543506f, 0.1529589f, 0.2565509f),
-        Vertex(0.9436879f, -0.419322f, 0.268519f,0.9648667f, -0.04630398f, 0.2586269f),
-        Vertex(0.6813349f, 0.199602f, 0.412576f,0.785456f, 0.419734f, 0.454843f),
-        Vertex(0.7319039f, 0.06956699f, 0.442277f,   0.7957066f, 0.3928828f, 0.4609708f),
-        Vertex(0.7764649f, -0.058384f, 0.468449f,0.8123339f, 0.3442279f, 0.4707659f),
-        Vertex(0.8120139f, -0.183211f, 0.489328f,0.833667f, 0.267414f, 0.483207f),
-        Vertex(0.835546f, -0.30387f, 0.5031489f,0.8550121f, 0.15325f, 0.4954481f),
-        Vertex(0.8440579f, -0.419322f, 0.508148f,0.8646632f, -0.04637201f, 0.5002071f),
-        Vertex(0.555337f, 0.199602f, 0.5764639f,0.6415988f, 0.4199898f, 0.6418408f),
-        Vertex(0.5968359f, 0.06956699f, 0.617963f,   0.649935f, 0.39313f, 0.65041f),
-        Vertex(0.633404f, -0.058384f, 0.6545309f,0.6634937f, 0.3444569f, 0.6641727f),
-        Vertex(0.6625769f, -0.183211f, 0.683704f,0.6809247f, 0.2676069f, 0.6817096f),
-        Vertex(0.6818879f, -0.30387f, 0.703015f,0.698421f, 0.153377f, 0.699059f),
-        Vertex(0.6888729f, -0.419322f, 0.7099999f,   0.7065322f, -0.04636901f, 0.7061602f),
-        Vertex(0.391449f, 0.199602f, 0.702462f,0.4545449f, 0.4197369f, 0.7856269f),
-        Vertex(0.42115f, 0.06956699f, 0.753032f,0.4603839f, 0.3928899f, 0.7960427f),
-        Vertex(0.447322f, -0.058384f, 0.7975929f,0.4699289f, 0.3442409f, 0.8128129f),
-        Vertex(0.468201f, -0.183211f, 0.833141f,0.4822391f, 0.2674361f, 0.8342202f),
-        Vertex(0.482022f, -0.30387f, 0.856674f,0.4946598f, 0.153286f, 0.8554618f),
-        Vertex(0.487021f, -0.419322f, 0.865185f,0.5006657f, -0.04629998f, 0.8644015f),
-        Vertex(0.196889f, 0.199602f, 0.7833539f,0.235117f, 0.4190779f, 0.8769798f),
-        Vertex(0.212583f, 0.06956699f, 0.8397459f,   0.2380439f, 0.3922578f, 0.8885205f),
-        Vertex(0.226413f, -0.058384f, 0.8894389f,0.2428939f, 0.3436669f, 0.9071358f),
-        Vertex(0.237446f, -0.183211f, 0.929081f,0.249206f, 0.26697f, 0.930926f),
-        Vertex(0.24475f, -0.30387f, 0.9553229f,0.255668f, 0.153012f, 0.954579f),
-        Vertex(0.247391f, -0.419322f, 0.964815f,0.2591419f, -0.04619798f, 0.9647336f),
-        Vertex(-0.021127f, 0.199602f, 0.8119209f,-0.0001699999f, 0.4185787f, 0.9081804f),
-        Vertex(-0.021127f, 0.06956699f, 0.8703699f,   -0.0003349998f, 0.3917758f, 0.9200605f),
-        Vertex(-0.021127f, -0.058384f, 0.9218749f,   -0.0004780001f, 0.3432221f, 0.9392542f),
-        Vertex(-0.021127f, -0.183211f, 0.9629629f,   -0.0005520002f, 0.2665991f, 0.9638073f),
-        Vertex(-0.021127f, -0.30387f, 0.990162f,-0.0004490002f, 0.1527721f, 0.9882613f),
-        Vertex(-0.021127f, -0.419322f, 0.9999999f,   0.0002619999f, -0.04618698f, 0.9989327f),
-        Vertex(-0.239143f, 0.199602f, 0.7833539f,-0.2354511f, 0.4190732f, 0.8768924f),
-        Vertex(-0.254838f, 0.06956699f, 0.8397459f,   -0.238702f, 0.3922469f, 0.8883488f),
-        Vertex(-0.268668f, -0.058384f, 0.8894389f,   -0.2438321f, 0.3436481f, 0.9068913f),
-        Vertex(-0.279701f, -0.183211f, 0.929081f,-0.250291f, 0.266938f, 0.9306441f),
-        Vertex(-0.287004f, -0.30387f, 0.9553229f,-0.2565509f, 0.1529589f, 0.9543506f),
-        Vertex(-0.289646f, -0.419322f, 0.964815f,-0.2586269f, -0.04630398f, 0.9648667f),
-        Vertex(-0.433704f, 0.199602f, 0.702462f,-0.454843f, 0.419734f, 0.785456f),
-        Vertex(-0.463404f, 0.06956699f, 0.753032f,   -0.4609708f, 0.3928828f, 0.7957066f),
-        Vertex(-0.489576f, -0.058384f, 0.7975929f,   -0.4707659f, 0.3442279f, 0.8123339f),
-        Vertex(-0.510455f, -0.183211f, 0.833141f,-0.483207f, 0.267414f, 0.833667f),
-        Vertex(-0.524276f, -0.30387f, 0.856674f,-0.4954481f, 0.15325f, 0.8550121f),
-        Vertex(-0.5292749f, -0.419322f, 0.865185f,   -0.5002071f, -0.04637201f, 0.8646632f),
-        Vertex(-0.5975909f, 0.199602f, 0.5764639f,   -0.6418408f, 0.4199898f, 0.6415988f),
-        Vertex(-0.6390899f, 0.06956699f, 0.617963f,   -0.65041f, 0.39313f, 0.649935f),
-        Vertex(-0.6756579f, -0.058384f, 0.6545309f,   -0.6641727f, 0.3444569f, 0.6634937f),
-        Vertex(-0.7048309f, -0.183211f, 0.683704f,   -0.6817096f, 0.2676069f, 0.6809247f),
-        Vertex(-0.724142f, -0.30387f, 0.703015f,-0.699059f, 0.153377f, 0.698421f),
-        Vertex(-0.731127f, -0.419322f, 0.7099999f,   -0.7061602f, -0.04636901f, 0.7065322f),
-        Vertex(-0.7235889f, 0.199602f, 0.412576f,-0.7856269f, 0.4197369f, 0.4545449f),
-        Vertex(-0.774159f, 0.06956699f, 0.442277f,   -0.7960427f, 0.3928899f, 0.4603839f),
-        Vertex(-0.8187199f, -0.058384f, 0.468449f,   -0.8128129f, 0.3442409f, 0.4699289f),
-        Vertex(-0.854269f, -0.183211f, 0.489328f,-0.8342202f, 0.2674361f, 0.4822391f),
-        Vertex(-0.8778009f, -0.30387f, 0.5031489f,   -0.8554618f, 0.153286f, 0.4946598f),
-        Vertex(-0.8863119f, -0.419322f, 0.508148f,   -0.8644015f, -0.04629998f, 0.5006657f),
-        Vertex(-0.804481f, 0.199602f, 0.218016f,-0.8769798f, 0.4190779f, 0.235117f),
-        Vertex(-0.8608729f, 0.06956699f, 0.233711f,   -0.8885205f, 0.3922578f, 0.2380439f),
-        Vertex(-0.9105659f, -0.058384f, 0.24754f,-0.9071358f, 0.3436669f, 0.2428939f),
-        Vertex(-0.9502079f, -0.183211f, 0.258573f,   -0.930926f, 0.26697f, 0.249206f),
-        Vertex(-0.97645f, -0.30387f, 0.265877f,-0.954579f, 0.153012f, 0.255668f),
-        Vertex(-0.9859419f, -0.419322f, 0.268518f,   -0.9647336f, -0.04619798f, 0.2591419f),
-        Vertex(-0.8330489f, 0.199602f, 0.0f,   -0.9081804f, 0.4185787f, -0.0001699999f),
-        Vertex(-0.891498f, 0.06956699f, 0.0f,   -0.9200605f, 0.3917758f, -0.0003349998f),
-        Vertex(-0.9430019f, -0.058384f, 0.0f,   -0.9392541f, 0.343222f, -0.0004780001f),
-        Vertex(-0.9840899f, -0.183211f, 0.0f,   -0.9638073f, 0.2665991f, -0.0005520002f),
-        Vertex(-1.011289f, -0.30387f, 0.0f,   -0.9882613f, 0.1527721f, -0.0004490002f),
-        Vertex(-1.021127f, -0.419322f, 0.0f,   -0.9989327f, -0.04618698f, 0.0002619999f),
-        Vertex(-0.804481f, 0.199602f, -0.218016f,-0.8768925f, 0.4190732f, -0.2354511f),
-        Vertex(-0.8608729f, 0.06956699f, -0.233711f,   -0.8883488f, 0.3922469f, -0.238702f),
-        Vertex(-0.9105659f, -0.058384f, -0.247541f,   -0.9068913f, 0.3436481f, -0.2438321f),
-        Vertex(-0.9502079f, -0.183211f, -0.258573f,   -0.9306441f, 0.266938f, -0.250291f),
-        Vertex(-0.97645f, -0.30387f, -0.265877f,-0.9543506f, 0.1529589f, -0.2565509f),
-        Vertex(-0.9859419f, -0.419322f, -0.268519f,   -0.9648667f, -0.04630398f, -0.2586269f),
-        Vertex(-0.7235889f, 0.199602f, -0.412576f,   -0.785456f, 0.419734f, -0.454843f),
-        Vertex(-0.774159f, 0.06956699f, -0.442277f,   -0.7957066f, 0.3928828f, -0.4609708f),
-        Vertex(-0.8187199f, -0.058384f, -0.468449f,   -0.8123339f, 0.3442279f, -0.4707659f),
-        Vertex(-0.854269f, -0.183211f, -0.489328f,   -0.833667f, 0.267414f, -0.483207f),
-        Vertex(-0.8778009f, -0.30387f, -0.5031489f,   -0.8550121f, 0.15325f, -0.4954481f),
-        Vertex(-0.8863119f, -0.419322f, -0.508148f,   -0.8646632f, -0.04637201f, -0.5002071f),
-        Vertex(-0.5975909f, 0.199602f, -0.5764639f,   -0.6415988f, 0.4199898f, -0.6418408f),
-        Vertex(-0.6390899f, 0.06956699f, -0.617963f,   -0.649935f, 0.39313f, -0.65041f),
-        Vertex(-0.6756579f, -0.058384f, -0.6545309f,   -0.6634937f, 0.3444569f, -0.6641727f),
-        Vertex(-0.7048309f, -0.183211f, -0.683704f,   -0.6809247f, 0.2676069f, -0.6817096f),
-        Vertex(-0.724142f, -0.30387f, -0.703015f,-0.698421f, 0.153377f, -0.699059f),
-        Vertex(-0.731127f, -0.419322f, -0.7099999f,   -0.7065322f, -0.04636901f, -0.7061602f),
-        Vertex(-0.433704f, 0.199602f, -0.702462f,-0.4545449f, 0.4197369f, -0.7856269f),
-        Vertex(-0.463404f, 0.06956699f, -0.753032f,   -0.4603839f, 0.3928899f, -0.7960427f),
-        Vertex(-0.489576f, -0.058384f, -0.7975929f,   -0.4699289f, 0.3442409f, -0.8128129f),
-        Vertex(-0.510455f, -0.183211f, -0.833141f,   -0.4822391f, 0.2674361f, -0.8342202f),
-        Vertex(-0.524276f, -0.30387f, -0.856674f,-0.4946598f, 0.153286f, -0.8554618f),
-        Vertex(-0.5292749f, -0.419322f, -0.865185f,   -0.5006657f, -0.04629998f, -0.8644015f),
-        Vertex(-0.239143f, 0.199602f, -0.7833539f,   -0.235117f, 0.4190779f, -0.8769798f),
-        Vertex(-0.254838f, 0.06956699f, -0.8397459f,   -0.2380439f, 0.3922578f, -0.8885205f),
-        Vertex(-0.268668f, -0.058384f, -0.8894389f,   -0.2428939f, 0.3436669f, -0.9071358f),
-        Vertex(-0.279701f, -0.183211f, -0.929081f,   -0.249206f, 0.26697f, -0.930926f),
-        Vertex(-0.287004f, -0.30387f, -0.9553229f,   -0.255668f, 0.153012f, -0.954579f),
-        Vertex(-0.289646f, -0.419322f, -0.964815f,   -0.2591419f, -0.04619798f, -0.9647336f),
-        Vertex(-0.021127f, 0.199602f, -0.8119209f,   0.0001699999f, 0.4185787f, -0.9081804f),
-        Vertex(-0.021127f, 0.06956699f, -0.8703699f,   0.0003349998f, 0.3917758f, -0.9200605f),
-        Vertex(-0.021127f, -0.058384f, -0.9218749f,   0.0004780001f, 0.3432221f, -0.9392542f),
-        Vertex(-0.021127f, -0.183211f, -0.9629629f,   0.0005520002f, 0.2665991f, -0.9638073f),
-        Vertex(-0.021127f, -0.30387f, -0.990162f,0.0004490002f, 0.1527721f, -0.9882613f),
-        Vertex(-0.021127f, -0.419322f, -0.9999999f,   -0.0002619999f, -0.04618698f, -0.9989327f),
-        Vertex(0.196889f, 0.199602f, -0.7833539f,0.2354511f, 0.4190732f, -0.8768924f),
-        Vertex(0.212583f, 0.06956699f, -0.8397459f,   0.238702f, 0.3922469f, -0.8883488f),
-        Vertex(0.226413f, -0.058384f, -0.8894389f,   0.2438321f, 0.3436481f, -0.9068913f),
-        Vertex(0.237446f, -0.183211f, -0.929081f,0.250291f, 0.266938f, -0.9306441f),
-        Vertex(0.24475f, -0.30387f, -0.9553229f,0.2565509f, 0.1529589f, -0.9543506f),
-        Vertex(0.247391f, -0.419322f, -0.964815f,0.2586269f, -0.04630398f, -0.9648667f),
-        Vertex(0.391449f, 0.199602f, -0.702462f,0.454843f, 0.419734f, -0.785456f),
-        Vertex(0.42115f, 0.06956699f, -0.753032f,0.4609708f, 0.3928828f, -0.7957066f),
-        Vertex(0.447322f, -0.058384f, -0.7975929f,   0.4707659f, 0.3442279f, -0.8123339f),
-        Vertex(0.468201f, -0.183211f, -0.833141f,0.483207f, 0.267414f, -0.833667f),
-        Vertex(0.482022f, -0.30387f, -0.856674f,0.4954481f, 0.15325f, -0.8550121f),
-        Vertex(0.487021f, -0.419322f, -0.865185f,0.5002071f, -0.04637201f, -0.8646632f),
-        Vertex(0.555337f, 0.199602f, -0.5764639f,0.6418408f, 0.4199898f, -0.6415988f),
-        Vertex(0.5968359f, 0.06956699f, -0.617963f,   0.65041f, 0.39313f, -0.649935f),
-        Vertex(0.633404f, -0.058384f, -0.6545309f,   0.6641727f, 0.3444569f, -0.6634937f),
-        Vertex(0.6625769f, -0.183211f, -0.683704f,   0.6817096f, 0.2676069f, -0.6809247f),
-        Vertex(0.6818879f, -0.30387f, -0.703015f,0.699059f, 0.153377f, -0.698421f),
-        Vertex(0.6888729f, -0.419322f, -0.7099999f,   0.7061602f, -0.04636901f, -0.7065322f),
-        Vertex(0.6813349f, 0.199602f, -0.412576f,0.7856269f, 0.4197369f, -0.4545449f),
-        Vertex(0.7319039f, 0.06956699f, -0.442277f,   0.7960427f, 0.3928899f, -0.4603839f),
-        Vertex(0.7764649f, -0.058384f, -0.468449f,   0.8128129f, 0.3442409f, -0.4699289f),
-        Vertex(0.8120139f, -0.183211f, -0.489328f,   0.8342202f, 0.2674361f, -0.4822391f),
-        Vertex(0.835546f, -0.30387f, -0.5031489f,0.8554618f, 0.153286f, -0.4946598f),
-        Vertex(0.8440579f, -0.419322f, -0.508148f,   0.8644015f, -0.04629998f, -0.5006657f),
-        Vertex(0.7622269f, 0.199602f, -0.218016f,0.8769798f, 0.4190779f, -0.235117f),
-        Vertex(0.818619f, 0.06956699f, -0.233711f,   0.8885205f, 0.3922578f, -0.2380439f),
-        Vertex(0.8683119f, -0.058384f, -0.24754f,0.9071358f, 0.3436669f, -0.2428939f),
-        Vertex(0.9079539f, -0.183211f, -0.258573f,   0.930926f, 0.26697f, -0.249206f),
-        Vertex(0.9341959f, -0.30387f, -0.265877f,0.954579f, 0.153012f, -0.255668f),
-        Vertex(0.9436879f, -0.419322f, -0.268518f,   0.9647336f, -0.04619798f, -0.2591419f),
-        Vertex(0.9603539f, -0.52262f, 0.0f,   0.9438334f, -0.3304141f, -0.002283001f),
-        Vertex(0.914058f, -0.6082109f, 0.0f,   0.8214033f, -0.5703412f, -0.002745001f),
-        Vertex(0.853873f, -0.6771339f, 0.0f,   0.7095412f, -0.7046612f, -0.001958f),
-        Vertex(0.7936879f, -0.7304329f, 0.0f,   0.6523046f, -0.7579566f, -0.0004659997f),
-        Vertex(0.7473909f, -0.7691479f, 0.0f,   0.7286693f, -0.6848563f, 0.003576002f),
-        Vertex(0.728873f, -0.794322f, 0.0f,   0.8891237f, -0.4576558f, 0.003163999f),
-        Vertex(0.9258209f, -0.52262f, 0.263546f,0.9120367f, -0.3308679f, 0.2423129f),
-        Vertex(0.8811529f, -0.6082109f, 0.251115f,   0.7936971f, -0.570897f, 0.210051f),
-        Vertex(0.823086f, -0.6771339f, 0.234954f,0.6853402f, -0.7051682f, 0.1817871f),
-        Vertex(0.7650179f, -0.7304329f, 0.218793f,   0.629635f, -0.75842f, 0.168401f),
-        Vertex(0.7203509f, -0.7691479f, 0.206361f,   0.702387f, -0.6853641f, 0.192168f),
-        Vertex(0.702484f, -0.794322f, 0.201389f,0.8576901f, -0.458122f, 0.233435f),
-        Vertex(0.828036f, -0.52262f, 0.498738f,0.8177159f, -0.331385f, 0.470664f),
-        Vertex(0.7879809f, -0.6082109f, 0.475213f,   0.7115282f, -0.5716082f, 0.4086461f),
-        Vertex(0.7359099f, -0.6771339f, 0.44463f,0.6140711f, -0.705839f, 0.35314f),
-        Vertex(0.683839f, -0.7304329f, 0.414047f,0.5637133f, -0.7590343f, 0.3257211f),
-        Vertex(0.6437839f, -0.7691479f, 0.390521f,   0.6278906f, -0.6860366f, 0.3675688f),
-        Vertex(0.627762f, -0.794322f, 0.381111f,0.7674107f, -0.4587868f, 0.4478788f),
-        Vertex(0.6757249f, -0.52262f, 0.696852f,0.6687284f, -0.3315572f, 0.6654864f),
-        Vertex(0.6428539f, -0.6082109f, 0.663981f,   0.5820097f, -0.5718738f, 0.5781218f),
-        Vertex(0.6001229f, -0.6771339f, 0.6212499f,   0.5020957f, -0.7060966f, 0.4993267f),
-        Vertex(0.5573909f, -0.7304329f, 0.5785189f,   0.460496f, -0.759271f, 0.459838f),
-        Vertex(0.5245209f, -0.7691479f, 0.5456479f,   0.5117598f, -0.6862967f, 0.5168158f),
-        Vertex(0.5113729f, -0.794322f, 0.5325f,0.6259499f, -0.4590599f, 0.6304369f),
-        Vertex(0.477611f, -0.52262f, 0.8491629f,0.4746599f, -0.3313209f, 0.8154289f),
-        Vertex(0.454085f, -0.6082109f, 0.809108f,0.4134342f, -0.5715903f, 0.7087713f),
-        Vertex(0.423502f, -0.6771339f, 0.7570369f,   0.3565468f, -0.7058386f, 0.6120996f),
-        Vertex(0.392919f, -0.7304329f, 0.7049659f,   0.32653f, -0.7590351f, 0.563244f),
-        Vertex(0.369394f, -0.7691479f, 0.6649109f,   0.3613459f, -0.6860399f, 0.6314889f),
-        Vertex(0.359984f, -0.794322f, 0.6488889f,0.4423488f, -0.4588318f, 0.7705847f),
-        Vertex(0.242419f, -0.52262f, 0.9469479f,0.2467939f, -0.3307729f, 0.9108687f),
-        Vertex(0.229987f, -0.6082109f, 0.9022809f,   0.2154289f, -0.5708699f, 0.7922739f),
-        Vertex(0.213826f, -0.6771339f, 0.8442129f,   0.1856189f, -0.7051677f, 0.6843127f),
-        Vertex(0.197666f, -0.7304329f, 0.7861449f,   0.169311f, -0.7584208f, 0.6293898f),
-        Vertex(0.185234f, -0.7691479f, 0.741478f,0.18517f, -0.6853682f, 0.7042602f),
-        Vertex(0.180262f, -0.794322f, 0.7236109f,0.2272311f, -0.4581881f, 0.8593193f),
-        Vertex(-0.021127f, -0.52262f, 0.981482f,0.002283001f, -0.3304141f, 0.9438334f),
-        Vertex(-0.021127f, -0.6082109f, 0.935185f,   0.002745001f, -0.5703412f, 0.8214033f),
-        Vertex(-0.021127f, -0.6771339f, 0.8749999f,   0.001958f, -0.7046612f, 0.7095412f),
-        Vertex(-0.021127f, -0.7304329f, 0.8148149f,   0.0004659997f, -0.7579566f, 0.6523046f),
-        Vertex(-0.021127f, -0.7691479f, 0.7685189f,   -0.003576002f, -0.6848563f, 0.7286693f),
-        Vertex(-0.021127f, -0.794322f, 0.7499999f,   -0.003163999f, -0.4576558f, 0.8891237f),
-        Vertex(-0.284673f, -0.52262f, 0.9469479f,-0.2423129f, -0.3308679f, 0.9120367f),
-        Vertex(-0.272242f, -0.6082109f, 0.9022809f,   -0.210051f, -0.570897f, 0.7936971f),
-        Vertex(-0.256081f, -0.6771339f, 0.8442129f,   -0.1817871f, -0.7051682f, 0.6853402f),
-        Vertex(-0.23992f, -0.7304329f, 0.7861449f,   -0.168401f, -0.75842f, 0.629635f),
-        Vertex(-0.227489f, -0.7691479f, 0.741478f,   -0.192168f, -0.6853641f, 0.702387f),
-        Vertex(-0.222516f, -0.794322f, 0.7236109f,   -0.233435f, -0.458122f, 0.8576901f),
-        Vertex(-0.5198649f, -0.52262f, 0.8491629f,   -0.470664f, -0.331385f, 0.8177159f),
-        Vertex(-0.49634f, -0.6082109f, 0.809108f,-0.4086461f, -0.5716082f, 0.7115282f),
-        Vertex(-0.465757f, -0.6771339f, 0.7570369f,   -0.35314f, -0.705839f, 0.6140711f),
-        Vertex(-0.435174f, -0.7304329f, 0.7049659f,   -0.3257211f, -0.7590343f, 0.5637132f),
-        Vertex(-0.411649f, -0.7691479f, 0.6649109f,   -0.3675688f, -0.6860366f, 0.6278906f),
-        Vertex(-0.402238f, -0.794322f, 0.6488889f,   -0.4478788f, -0.4587868f, 0.7674107f),
-        Vertex(-0.717979f, -0.52262f, 0.696852f,-0.6654864f, -0.3315572f, 0.6687284f),
-        Vertex(-0.685109f, -0.6082109f, 0.663981f,   -0.5781218f, -0.5718738f, 0.5820097f),
-        Vertex(-0.642377f, -0.6771339f, 0.6212499f,   -0.4993267f, -0.7060966f, 0.5020957f),
-        Vertex(-0.5996459f, -0.7304329f, 0.5785189f,   -0.459838f, -0.759271f, 0.460496f),
-        Vertex(-0.566775f, -0.7691479f, 0.5456479f,   -0.5168158f, -0.6862967f, 0.5117598f),
-        Vertex(-0.553627f, -0.794322f, 0.5325f,-0.6304368f, -0.4590599f, 0.6259498f),
-        Vertex(-0.8702899f, -0.52262f, 0.498738f,-0.8154289f, -0.3313209f, 0.4746599f),
-        Vertex(-0.830236f, -0.6082109f, 0.475213f,   -0.7087713f, -0.5715903f, 0.4134342f),
-        Vertex(-0.778164f, -0.6771339f, 0.44463f,-0.6120996f, -0.7058386f, 0.3565468f),
-        Vertex(-0.7260929f, -0.7304329f, 0.414047f,   -0.563244f, -0.7590351f, 0.32653f),
-        Vertex(-0.686038f, -0.7691479f, 0.390521f,   -0.6314889f, -0.6860399f, 0.3613459f),
-        Vertex(-0.6700159f, -0.794322f, 0.381111f,   -0.7705847f, -0.4588318f, 0.4423488f),
-        Vertex(-0.9680749f, -0.52262f, 0.263546f,-0.9108687f, -0.3307729f, 0.2467939f),
-        Vertex(-0.9234079f, -0.6082109f, 0.251115f,   -0.7922739f, -0.5708699f, 0.2154289f),
-        Vertex(-0.8653399f, -0.6771339f, 0.234954f,   -0.6843127f, -0.7051677f, 0.1856189f),
-        Vertex(-0.8072729f, -0.7304329f, 0.218793f,   -0.6293898f, -0.7584208f, 0.169311f),
-        Vertex(-0.762605f, -0.7691479f, 0.206361f,   -0.7042602f, -0.6853682f, 0.18517f),
-        Vertex(-0.7447379f, -0.794322f, 0.201389f,   -0.8593193f, -0.4581881f, 0.2272311f),
-        Vertex(-1.002609f, -0.52262f, 0.0f,   -0.9438334f, -0.3304141f, 0.002283001f),
-        Vertex(-0.9563119f, -0.6082109f, 0.0f,-0.8214033f, -0.5703412f, 0.002745001f),
-        Vertex(-0.8961269f, -0.6771339f, 0.0f,-0.7095412f, -0.7046612f, 0.001958f),
-        Vertex(-0.8359419f, -0.7304329f, 0.0f,-0.6523046f, -0.7579566f, 0.0004659997f),
-        Vertex(-0.789646f, -0.7691479f, 0.0f,   -0.7286693f, -0.6848563f, -0.003576002f),
-        Vertex(-0.7711269f, -0.794322f, 0.0f,   -0.8891237f, -0.4576558f, -0.003163999f),
-        Vertex(-0.9680749f, -0.52262f, -0.263546f,   -0.9120367f, -0.3308679f, -0.2423129f),
-        Vertex(-0.9234079f, -0.6082109f, -0.251115f,   -0.7936971f, -0.570897f, -0.210051f),
-        Vertex(-0.8653399f, -0.6771339f, -0.234954f,   -0.6853402f, -0.7051682f, -0.1817871f),
-        Vertex(-0.8072729f, -0.7304329f, -0.218793f,   -0.629635f, -0.75842f, -0.168401f),
-        Vertex(-0.762605f, -0.7691479f, -0.206361f,   -0.702387f, -0.6853641f, -0.192168f),
-        Vertex(-0.7447379f, -0.794322f, -0.201389f,   -0.8576901f, -0.458122f, -0.233435f),
-        Vertex(-0.8702899f, -0.52262f, -0.498738f,   -0.8177159f, -0.331385f, -0.470664f),
-        Vertex(-0.830236f, -0.6082109f, -0.475213f,   -0.7115282f, -0.5716082f, -0.4086461f),
-        Vertex(-0.778164f, -0.6771339f, -0.44463f,   -0.6140711f, -0.705839f, -0.35314f),
-        Vertex(-0.7260929f, -0.7304329f, -0.414047f,   -0.5637133f, -0.7590343f, -0.3257211f),
-        Vertex(-0.686038f, -0.7691479f, -0.390521f,   -0.6278906f, -0.6860366f, -0.3675688f),
-        Vertex(-0.6700159f, -0.794322f, -0.381111f,   -0.7674107f, -0.4587868f, -0.4478788f),
-        Vertex(-0.717979f, -0.52262f, -0.696852f,-0.6687284f, -0.3315572f, -0.6654864f),
-        Vertex(-0.685109f, -0.6082109f, -0.663981f,   -0.5820097f, -0.5718738f, -0.5781218f),
-        Vertex(-0.642377f, -0.6771339f, -0.6212499f,   -0.5020957f, -0.7060966f, -0.4993267f),
-        Vertex(-0.5996459f, -0.7304329f, -0.5785189f,   -0.460496f, -0.759271f, -0.459838f),
-        Vertex(-0.566775f, -0.7691479f, -0.5456479f,   -0.5117598f, -0.6862967f, -0.5168158f),
-        Vertex(-0.553627f, -0.794322f, -0.5325f,-0.6259499f, -0.4590599f, -0.6304369f),
-        Vertex(-0.5198649f, -0.52262f, -0.8491629f,   -0.4746599f, -0.3313209f, -0.8154289f),
-        Vertex(-0.49634f, -0.6082109f, -0.809108f,   -0.4134342f, -0.5715903f, -0.7087713f),
-        Vertex(-0.465757f, -0.6771339f, -0.7570369f,   -0.3565468f, -0.7058386f, -0.6120996f),
-        Vertex(-0.435174f, -0.7304329f, -0.7049659f,   -0.32653f, -0.7590351f, -0.563244f),
-        Vertex(-0.411648f, -0.7691479f, -0.6649109f,   -0.3613459f, -0.6860399f, -0.6314889f),
-        Vertex(-0.402238f, -0.794322f, -0.6488889f,   -0.4423488f, -0.4588318f, -0.7705847f),
-        Vertex(-0.284673f, -0.52262f, -0.9469479f,   -0.2467939f, -0.3307729f, -0.9108687f),
-        Vertex(-0.272242f, -0.6082109f, -0.9022809f,   -0.2154289f, -0.5708699f, -0.7922739f),
-        Vertex(-0.256081f, -0.6771339f, -0.8442129f,   -0.1856189f, -0.7051677f, -0.6843127f),
-        Vertex(-0.23992f, -0.7304329f, -0.7861449f,   -0.169311f, -0.7584208f, -0.6293898f),
-        Vertex(-0.227489f, -0.7691479f, -0.741478f,   -0.18517f, -0.6853682f, -0.7042602f),
-        Vertex(-0.222516f, -0.794322f, -0.7236109f,   -0.2272311f, -0.4581881f, -0.8593193f),
-        Vertex(-0.021127f, -0.52262f, -0.981482f,-0.002283001f, -0.3304141f, -0.9438334f),
-        Vertex(-0.021127f, -0.6082109f, -0.935185f,   -0.002745001f, -0.5703412f, -0.8214033f),
-        Vertex(-0.021127f, -0.6771339f, -0.8749999f,   -0.001958f, -0.7046612f, -0.7095412f),
-        Vertex(-0.021127f, -0.7304329f, -0.8148149f,   -0.0004659997f, -0.7579566f, -0.6523046f),
-        Vertex(-0.021127f, -0.7691479f, -0.7685189f,   0.003576002f, -0.6848563f, -0.7286693f),
-        Vertex(-0.021127f, -0.794322f, -0.7499999f,   0.003163999f, -0.4576558f, -0.8891237f),
-        Vertex(0.242419f, -0.52262f, -0.9469479f,0.2423129f, -0.3308679f, -0.9120367f),
-        Vertex(0.229987f, -0.6082109f, -0.9022809f,   0.210051f, -0.570897f, -0.7936971f),
-        Vertex(0.213827f, -0.6771339f, -0.8442129f,   0.1817871f, -0.7051682f, -0.6853402f),
-        Vertex(0.197666f, -0.7304329f, -0.7861449f,   0.168401f, -0.75842f, -0.629635f),
-        Vertex(0.185234f, -0.7691479f, -0.741478f,   0.192168f, -0.6853641f, -0.702387f),
-        Vertex(0.180262f, -0.794322f, -0.7236109f,   0.233435f, -0.458122f, -0.8576901f),
-        Vertex(0.477611f, -0.52262f, -0.8491629f,0.470664f, -0.331385f, -0.8177159f),
-        Vertex(0.454085f, -0.6082109f, -0.809108f,   0.4086461f, -0.5716082f, -0.7115282f),
-        Vertex(0.423502f, -0.6771339f, -0.7570369f,   0.35314f, -0.705839f, -0.6140711f),
-        Vertex(0.392919f, -0.7304329f, -0.7049659f,   0.3257211f, -0.7590343f, -0.5637132f),
-        Vertex(0.369394f, -0.7691479f, -0.6649109f,   0.3675688f, -0.6860366f, -0.6278906f),
-        Vertex(0.359984f, -0.794322f, -0.6488889f,   0.4478788f, -0.4587868f, -0.7674107f),
-        Vertex(0.6757249f, -0.52262f, -0.696852f,0.6654864f, -0.3315572f, -0.6687284f),
-        Vertex(0.6428539f, -0.6082109f, -0.663981f,   0.5781218f, -0.5718738f, -0.5820097f),
-        Vertex(0.6001229f, -0.6771339f, -0.6212499f,   0.4993267f, -0.7060966f, -0.5020957f),
-        Vertex(0.5573909f, -0.7304329f, -0.5785189f,   0.459838f, -0.759271f, -0.460496f),
-        Vertex(0.5245209f, -0.7691479f, -0.5456479f,   0.5168158f, -0.6862967f, -0.5117598f),
-        Vertex(0.5113729f, -0.794322f, -0.5325f,0.6304368f, -0.4590599f, -0.6259498f),
-        Vertex(0.828036f, -0.52262f, -0.498738f,0.8154289f, -0.3313209f, -0.4746599f),
-        Vertex(0.7879809f, -0.6082109f, -0.475213f,   0.7087713f, -0.5715903f, -0.4134342f),
-        Vertex(0.7359099f, -0.6771339f, -0.44463f,   0.6120996f, -0.7058386f, -0.3565468f),
-        Vertex(0.683839f, -0.7304329f, -0.414047f,   0.563244f, -0.7590351f, -0.32653f),
-        Vertex(0.6437839f, -0.7691479f, -0.390521f,   0.6314889f, -0.6860399f, -0.3613459f),
-        Vertex(0.627762f, -0.794322f, -0.381111f,0.7705847f, -0.4588318f, -0.4423488f),
-        Vertex(0.9258209f, -0.52262f, -0.263546f,0.9108687f, -0.3307729f, -0.2467939f),
-        Vertex(0.8811529f, -0.6082109f, -0.251115f,   0.7922739f, -0.5708699f, -0.2154289f),
-        Vertex(0.823086f, -0.6771339f, -0.234954f,   0.6843127f, -0.7051677f, -0.1856189f),
-        Vertex(0.7650179f, -0.7304329f, -0.218793f,   0.6293898f, -0.7584208f, -0.169311f),
-        Vertex(0.7203509f, -0.7691479f, -0.206361f,   0.7042602f, -0.6853682f, -0.18517f),
-        Vertex(0.702484f, -0.794322f, -0.201389f,0.8593193f, -0.4581881f, -0.2272311f),
-        Vertex(0.722796f, -0.8128979f, 0.0f,   0.7773448f, -0.6289898f, -0.010332f),
-        Vertex(0.692762f, -0.830433f, 0.0f,   0.361793f, -0.9322358f, -0.006476999f),
-        Vertex(0.62106f, -0.845884f, 0.0f,   0.152402f, -0.9883152f, -0.002559001f),
-        Vertex(0.489984f, -0.8582109f, 0.0f,   0.06642199f, -0.9977908f, -0.00119f),
-        Vertex(0.281824f, -0.86637f, 0.0f,   0.027401f, -0.999624f, -0.001027f),
-        Vertex(-0.021127f, -0.8693219f, 0.0f,   0.0f, -0.9999999f, 0.0f),
-        Vertex(0.6966209f, -0.8128979f, 0.199757f,   0.7531539f, -0.6294399f, 0.191218f),
-        Vertex(0.667643f, -0.830433f, 0.191692f,0.3507659f, -0.9323858f, 0.08729099f),
-        Vertex(0.598465f, -0.845884f, 0.172439f,0.1476881f, -0.9883445f, 0.03692602f),
-        Vertex(0.472f, -0.8582109f, 0.137243f,0.06438603f, -0.9977965f, 0.01602101f),
-        Vertex(0.271165f, -0.86637f, 0.08134799f,0.02670599f, -0.9996247f, 0.006086998f),
-        Vertex(0.6225049f, -0.8128979f, 0.378023f,   0.6772966f, -0.6299617f, 0.3800228f),
-        Vertex(0.5965189f, -0.830433f, 0.362761f,0.3155428f, -0.9326115f, 0.1751239f),
-        Vertex(0.534484f, -0.845884f, 0.326326f,0.132774f, -0.9883888f, 0.07388099f),
-        Vertex(0.421079f, -0.8582109f, 0.25972f,0.05790001f, -0.9978051f, 0.03213301f),
-        Vertex(0.240982f, -0.86637f, 0.153944f,0.02415701f, -0.9996263f, 0.012794f),
-        Vertex(0.5070589f, -0.8128979f, 0.528186f,   0.5563101f, -0.6301472f, 0.5416951f),
-        Vertex(0.485734f, -0.830433f, 0.5068609f,0.2595231f, -0.9327074f, 0.2504091f),
-        Vertex(0.434826f, -0.845884f, 0.455953f,0.109137f, -0.988408f, 0.10554f),
-        Vertex(0.341762f, -0.8582109f, 0.362889f,0.04761298f, -0.9978087f, 0.04594098f),
-        Vertex(0.193968f, -0.86637f, 0.215095f,0.020018f, -0.999627f, 0.018575f),
-        Vertex(0.356896f, -0.8128979f, 0.6436319f,   0.3980141f, -0.629932f, 0.6669111f),
-        Vertex(0.341634f, -0.830433f, 0.6176459f,0.1863179f, -0.9326347f, 0.3089949f),
-        Vertex(0.305199f, -0.845884f, 0.555611f,0.07829598f, -0.9883937f, 0.130182f),
-        Vertex(0.238593f, -0.8582109f, 0.442206f,0.034185f, -0.997806f, 0.056696f),
-        Vertex(0.132817f, -0.86637f, 0.262109f,0.01456399f, -0.9996266f, 0.02311699f),
-        Vertex(0.17863f, -0.8128979f, 0.7177489f,0.211443f, -0.6293949f, 0.7477659f),
-        Vertex(0.170565f, -0.830433f, 0.6887709f,0.09992103f, -0.9324203f, 0.3472871f),
-        Vertex(0.151312f, -0.845884f, 0.619592f,0.04191198f, -0.9883515f, 0.1463029f),
-        Vertex(0.116116f, -0.8582109f, 0.493128f,0.018338f, -0.9977978f, 0.06374098f),
-        Vertex(0.060221f, -0.86637f, 0.292292f,0.008087002f, -0.9996253f, 0.02615f),
-        Vertex(-0.021127f, -0.8128979f, 0.743924f,   0.010332f, -0.6289898f, 0.7773448f),
-        Vertex(-0.021127f, -0.830433f, 0.7138889f,   0.006476999f, -0.9322358f, 0.361793f),
-        Vertex(-0.021127f, -0.845884f, 0.642188f,0.002559001f, -0.9883152f, 0.152402f),
-        Vertex(-0.021127f, -0.8582109f, 0.511111f,   0.00119f, -0.9977908f, 0.06642199f),
-        Vertex(-0.021127f, -0.86637f, 0.302951f,0.001027f, -0.999624f, 0.027401f),
-        Vertex(-0.220884f, -0.8128979f, 0.7177489f,   -0.191218f, -0.62944f, 0.753154f),
-        Vertex(-0.21282f, -0.830433f, 0.6887709f,-0.08729099f, -0.9323858f, 0.3507659f),
-        Vertex(-0.193566f, -0.845884f, 0.619592f,-0.03692602f, -0.9883445f, 0.1476881f),
-        Vertex(-0.15837f, -0.8582109f, 0.493128f,-0.01602101f, -0.9977965f, 0.06438603f),
-        Vertex(-0.102475f, -0.86637f, 0.292292f,-0.006086998f, -0.9996247f, 0.02670599f),
-        Vertex(-0.399151f, -0.8128979f, 0.6436319f,   -0.3800228f, -0.6299617f, 0.6772966f),
-        Vertex(-0.383889f, -0.830433f, 0.6176459f,   -0.1751239f, -0.9326115f, 0.3155428f),
-        Vertex(-0.347454f, -0.845884f, 0.555611f,-0.07388099f, -0.9883888f, 0.132774f),
-        Vertex(-0.280847f, -0.8582109f, 0.442206f,   -0.03213301f, -0.9978051f, 0.05790001f),
-        Vertex(-0.175071f, -0.86637f, 0.262109f,-0.012794f, -0.9996263f, 0.02415701f),
-        Vertex(-0.5493129f, -0.8128979f, 0.528186f,   -0.5416951f, -0.6301472f, 0.5563101f),
-        Vertex(-0.527988f, -0.830433f, 0.5068609f,   -0.2504091f, -0.9327074f, 0.2595231f),
-        Vertex(-0.47708f, -0.845884f, 0.455953f,-0.10554f, -0.988408f, 0.109137f),
-        Vertex(-0.384016f, -0.8582109f, 0.362889f,   -0.04594098f, -0.9978087f, 0.04761298f),
-        Vertex(-0.236223f, -0.86637f, 0.215095f,-0.018575f, -0.999627f, 0.020018f),
-        Vertex(-0.6647589f, -0.8128979f, 0.378023f,   -0.6669111f, -0.629932f, 0.3980141f),
-        Vertex(-0.638773f, -0.830433f, 0.362761f,-0.3089949f, -0.9326347f, 0.1863179f),
-        Vertex(-0.5767379f, -0.845884f, 0.326326f,   -0.130182f, -0.9883937f, 0.07829598f),
-        Vertex(-0.463333f, -0.8582109f, 0.25972f,-0.056696f, -0.997806f, 0.034185f),
-        Vertex(-0.283236f, -0.86637f, 0.153944f,-0.02311699f, -0.9996266f, 0.01456399f),
-        Vertex(-0.7388759f, -0.8128979f, 0.199757f,   -0.7477659f, -0.6293949f, 0.211443f),
-        Vertex(-0.7098979f, -0.830433f, 0.191692f,   -0.3472871f, -0.9324203f, 0.09992103f),
-        Vertex(-0.6407189f, -0.845884f, 0.172439f,   -0.1463029f, -0.9883515f, 0.04191198f),
-        Vertex(-0.5142549f, -0.8582109f, 0.137243f,   -0.06374099f, -0.997798f, 0.018338f),
-        Vertex(-0.313419f, -0.86637f, 0.08134799f,   -0.02615f, -0.9996253f, 0.008087002f),
-        Vertex(-0.7650509f, -0.8128979f, 0.0f,-0.7773448f, -0.6289898f, 0.010332f),
-        Vertex(-0.7350159f, -0.830433f, 0.0f,   -0.361793f, -0.9322358f, 0.006476999f),
-        Vertex(-0.6633149f, -0.845884f, 0.0f,   -0.152402f, -0.9883152f, 0.002559001f),
-        Vertex(-0.5322379f, -0.8582109f, 0.0f,-0.06642199f, -0.9977908f, 0.00119f),
-        Vertex(-0.324079f, -0.86637f, 0.0f,   -0.027401f, -0.999624f, 0.001027f),
-        Vertex(-0.7388759f, -0.8128979f, -0.199757f,   -0.7531539f, -0.6294399f, -0.191218f),
-        Vertex(-0.7098979f, -0.830433f, -0.191692f,   -0.3507659f, -0.9323858f, -0.08729099f),
-        Vertex(-0.6407189f, -0.845884f, -0.172439f,   -0.1476881f, -0.9883445f, -0.03692602f),
-        Vertex(-0.5142549f, -0.8582109f, -0.137243f,   -0.06438603f, -0.9977965f, -0.01602101f),
-        Vertex(-0.313419f, -0.86637f, -0.08134799f,   -0.02670599f, -0.9996247f, -0.006086998f),
-        Vertex(-0.6647589f, -0.8128979f, -0.378023f,   -0.6772966f, -0.6299617f, -0.3800228f),
-        Vertex(-0.638773f, -0.830433f, -0.362761f,   -0.3155428f, -0.9326115f, -0.1751239f),
-        Vertex(-0.5767379f, -0.845884f, -0.326326f,   -0.132774f, -0.9883888f, -0.07388099f),
-        Vertex(-0.463333f, -0.8582109f, -0.25972f,   -0.05790001f, -0.9978051f, -0.03213301f),
-        Vertex(-0.283236f, -0.86637f, -0.153944f,-0.02415701f, -0.9996263f, -0.012794f),
-        Vertex(-0.5493129f, -0.8128979f, -0.528186f,   -0.5563101f, -0.6301472f, -0.5416951f),
-        Vertex(-0.527988f, -0.830433f, -0.5068609f,   -0.2595231f, -0.9327074f, -0.2504091f),
-        Vertex(-0.47708f, -0.845884f, -0.455953f,-0.109137f, -0.988408f, -0.10554f),
-        Vertex(-0.384016f, -0.8582109f, -0.362889f,   -0.04761298f, -0.9978087f, -0.04594098f),
-        Vertex(-0.236223f, -0.86637f, -0.215095f,-0.020018f, -0.999627f, -0.018575f),
-        Vertex(-0.399151f, -0.8128979f, -0.6436319f,   -0.3980141f, -0.629932f, -0.6669111f),
-        Vertex(-0.383889f, -0.830433f, -0.6176459f,   -0.1863179f, -0.9326347f, -0.3089949f),
-        Vertex(-0.347454f, -0.845884f, -0.555611f,   -0.07829598f, -0.9883937f, -0.130182f),
-        Vertex(-0.280847f, -0.8582109f, -0.442206f,   -0.034185f, -0.997806f, -0.056696f),
-        Vertex(-0.175071f, -0.86637f, -0.262109f,-0.01456399f, -0.9996266f, -0.02311699f),
-        Vertex(-0.220884f, -0.8128979f, -0.7177489f,   -0.211443f, -0.6293949f, -0.7477659f),
-        Vertex(-0.21282f, -0.830433f, -0.6887709f,   -0.09992103f, -0.9324203f, -0.3472871f),
-        Vertex(-0.193566f, -0.845884f, -0.619592f,   -0.04191198f, -0.9883515f, -0.1463029f),
-        Vertex(-0.15837f, -0.8582109f, -0.493128f,   -0.018338f, -0.9977978f, -0.06374098f),
-        Vertex(-0.102475f, -0.86637f, -0.292292f,-0.008087002f, -0.9996253f, -0.02615f),
-        Vertex(-0.021127f, -0.8128979f, -0.743924f,   -0.010332f, -0.6289898f, -0.7773448f),
-        Vertex(-0.021127f, -0.830433f, -0.7138889f,   -0.006476999f, -0.9322358f, -0.361793f),
-        Vertex(-0.021127f, -0.845884f, -0.642188f,   -0.002559001f, -0.9883152f, -0.152402f),
-        Vertex(-0.021127f, -0.8582109f, -0.511111f,   -0.00119f, -0.9977908f, -0.06642199f),
-        Vertex(-0.021127f, -0.86637f, -0.302951f,-0.001027f, -0.999624f, -0.027401f),
-        Vertex(0.17863f, -0.8128979f, -0.7177489f,   0.191218f, -0.62944f, -0.753154f),
-        Vertex(0.170565f, -0.830433f, -0.6887709f,   0.08729099f, -0.9323858f, -0.3507659f),
-        Vertex(0.151312f, -0.845884f, -0.619592f,0.03692602f, -0.9883445f, -0.1476881f),
-        Vertex(0.116116f, -0.8582109f, -0.493128f,   0.01602101f, -0.9977965f, -0.06438603f),
-        Vertex(0.060221f, -0.86637f, -0.292292f,0.006086998f, -0.9996247f, -0.02670599f),
-        Vertex(0.356896f, -0.8128979f, -0.6436319f,   0.3800228f, -0.6299617f, -0.6772966f),
-        Vertex(0.341634f, -0.830433f, -0.6176459f,   0.1751239f, -0.9326115f, -0.3155428f),
-        Vertex(0.305199f, -0.845884f, -0.555611f,0.07388099f, -0.9883888f, -0.132774f),
-        Vertex(0.238593f, -0.8582109f, -0.442206f,   0.03213301f, -0.9978051f, -0.05790001f),
-        Vertex(0.132817f, -0.86637f, -0.262109f,0.012794f, -0.9996263f, -0.02415701f),
-        Vertex(0.5070589f, -0.8128979f, -0.528186f,   0.5416951f, -0.6301472f, -0.5563101f),
-        Vertex(0.485734f, -0.830433f, -0.5068609f,   0.2504091f, -0.9327074f, -0.2595231f),
-        Vertex(0.434826f, -0.845884f, -0.455953f,0.10554f, -0.988408f, -0.109137f),
-        Vertex(0.341762f, -0.8582109f, -0.362889f,   0.04594098f, -0.9978087f, -0.04761298f),
-        Vertex(0.193968f, -0.86637f, -0.215095f,0.018575f, -0.999627f, -0.020018f),
-        Vertex(0.6225049f, -0.8128979f, -0.378023f,   0.6669111f, -0.629932f, -0.3980141f),
-        Vertex(0.5965189f, -0.830433f, -0.362761f,   0.3089949f, -0.9326347f, -0.1863179f),
-        Vertex(0.534484f, -0.845884f, -0.326326f,0.130182f, -0.9883937f, -0.07829598f),
-        Vertex(0.421079f, -0.8582109f, -0.25972f,0.056696f, -0.997806f, -0.034185f),
-        Vertex(0.240982f, -0.86637f, -0.153944f,0.02311699f, -0.9996266f, -0.01456399f),
-        Vertex(0.6966209f, -0.8128979f, -0.199757f,   0.7477659f, -0.6293949f, -0.211443f),
-        Vertex(0.667643f, -0.830433f, -0.191692f,0.3472871f, -0.9324203f, -0.09992103f),
-        Vertex(0.598465f, -0.845884f, -0.172439f,0.1463029f, -0.9883515f, -0.04191198f),
-        Vertex(0.472f, -0.8582109f, -0.137243f,0.06374099f, -0.997798f, -0.018338f),
-        Vertex(0.271165f, -0.86637f, -0.08134799f,   0.02615f, -0.9996253f, -0.008087002f),
-        Vertex(-0.8211269f, 0.143178f, 0.0f,   0.003251999f, -0.9990167f, 0.04421499f),
-        Vertex(-0.9833959f, 0.142657f, 0.0f,   0.01523999f, -0.9998837f, -0.0004259999f),
-        Vertex(-1.119275f, 0.139012f, 0.0f,   0.05992801f, -0.9982023f, -0.0008760002f),
-        Vertex(-1.227377f, 0.129116f, 0.0f,   0.1671339f, -0.9859335f, -0.001082999f),
-        Vertex(-1.306313f, 0.109845f, 0.0f,   0.4038382f, -0.9148303f, -0.0002030001f),
-        Vertex(-1.354692f, 0.07807399f, 0.0f,   0.7924452f, -0.6099431f, 0.0002420001f),
-        Vertex(-1.371127f, 0.030678f, 0.0f,   0.9951607f, -0.09825397f, -0.001013f),
-        Vertex(-0.8174239f, 0.151512f, 0.0625f,0.003195001f, -0.9279082f, 0.3727951f),
-        Vertex(-0.9846479f, 0.150952f, 0.0625f,0.015041f, -0.9497637f, 0.3126059f),
-        Vertex(-1.124351f, 0.147036f, 0.0625f,0.05922698f, -0.9482657f, 0.3119039f),
-        Vertex(-1.235248f, 0.136407f, 0.0625f,0.164453f, -0.9335488f, 0.3184989f),
-        Vertex(-1.316052f, 0.115709f, 0.0625f,0.388162f, -0.8542191f, 0.34589f),
-        Vertex(-1.365477f, 0.08158499f, 0.0625f,0.7293938f, -0.5619048f, 0.3901889f),
-        Vertex(-1.382239f, 0.030678f, 0.0625f,0.9123507f, -0.09533196f, 0.3981558f),
-        Vertex(-0.8081639f, 0.172345f, 0.09999999f,   0.002232001f, -0.5976803f, 0.8017315f),
-        Vertex(-0.9877769f, 0.171689f, 0.09999999f,   0.01083f, -0.6814968f, 0.7317408f),
-        Vertex(-1.13704f, 0.167098f, 0.09999999f,0.04361301f, -0.6796141f, 0.7322721f),
-        Vertex(-1.254924f, 0.154637f, 0.09999999f,   0.120047f, -0.6603202f, 0.7413272f),
-        Vertex(-1.3404f, 0.13037f, 0.09999999f,0.2679299f, -0.5804407f, 0.7689616f),
-        Vertex(-1.392441f, 0.09036199f, 0.09999999f,   0.4672849f, -0.3671069f, 0.8042868f),
-        Vertex(-1.410016f, 0.030678f, 0.09999999f,   0.5840061f, -0.06760601f, 0.8089291f),
-        Vertex(-0.796127f, 0.199428f, 0.1125f,-0.0006530003f, 0.1526351f, 0.9882824f),
-        Vertex(-0.991845f, 0.198647f, 0.1125f,-0.002559001f, 0.0009050003f, 0.9999962f),
-        Vertex(-1.153535f, 0.193178f, 0.1125f,-0.007405004f, 0.0003840002f, 0.9999725f),
-        Vertex(-1.280502f, 0.178335f, 0.1125f,-0.01609001f, -0.004746002f, 0.9998593f),
-        Vertex(-1.372053f, 0.149428f, 0.1125f,-0.025703f, -0.01962f, 0.999477f),
-        Vertex(-1.427493f, 0.101772f, 0.1125f,-0.020936f, -0.035053f, 0.9991661f),
-        Vertex(-1.446127f, 0.030678f, 0.1125f,-0.002824001f, -0.02389901f, 0.9997104f),
-        Vertex(-0.7840899f, 0.226511f, 0.09999999f,   -0.003295999f, 0.7562547f, 0.6542688f),
-        Vertex(-0.995913f, 0.225605f, 0.09999999f,   -0.01540501f, 0.6812514f, 0.7318874f),
-        Vertex(-1.17003f, 0.219258f, 0.09999999f,-0.05921699f, 0.6762829f, 0.7342579f),
-        Vertex(-1.306081f, 0.202032f, 0.09999999f,   -0.1584379f, 0.6437916f, 0.7486185f),
-        Vertex(-1.403706f, 0.168487f, 0.09999999f,   -0.33417f, 0.526967f, 0.7814321f),
-        Vertex(-1.462545f, 0.113182f, 0.09999999f,   -0.518177f, 0.278028f, 0.808822f),
-        Vertex(-1.482238f, 0.030678f, 0.09999999f,   -0.5889288f, 0.01639099f, 0.8080186f),
-        Vertex(-0.7748309f, 0.247345f, 0.0625f,-0.004351998f, 0.9673496f, 0.2534079f),
-        Vertex(-0.9990419f, 0.246342f, 0.0625f,-0.020677f, 0.9492998f, 0.3136909f),
-        Vertex(-1.182719f, 0.23932f, 0.0625f,   -0.08184396f, 0.9451165f, 0.3163168f),
-        Vertex(-1.325757f, 0.220261f, 0.0625f,-0.226175f, 0.9160968f, 0.3310759f),
-        Vertex(-1.428054f, 0.183147f, 0.0625f,-0.5004998f, 0.7842887f, 0.3665938f),
-        Vertex(-1.489509f, 0.121959f, 0.0625f,-0.8043737f, 0.4396349f, 0.3996299f),
-        Vertex(-1.510016f, 0.030678f, 0.0625f,-0.9164599f, 0.037237f, 0.39839f),
-        Vertex(-0.7711269f, 0.255678f, 0.0f,   -0.004517001f, 0.9990112f, -0.04422801f),
-        Vertex(-1.000294f, 0.254636f, 0.0f,   -0.021584f, 0.9997669f, 0.000265f),
-        Vertex(-1.187794f, 0.247345f, 0.0f,   -0.08624499f, 0.9962738f, 0.000157f),
-        Vertex(-1.333627f, 0.227553f, 0.0f,   -0.240673f, 0.970606f, -0.000608f),
-        Vertex(-1.437794f, 0.189011f, 0.0f,   -0.5402799f, 0.8414838f, -0.001597f),
-        Vertex(-1.500294f, 0.12547f, 0.0f,   -0.8778105f, 0.4790077f, 0.0003899998f),
-        Vertex(-1.521127f, 0.030678f, 0.0f,   -0.9990739f, 0.043021f, 0.0006859999f),
-        Vertex(-0.7748309f, 0.247345f, -0.0625f,-0.004094f, 0.9279191f, -0.372759f),
-        Vertex(-0.9990419f, 0.246342f, -0.0625f,-0.01968701f, 0.9495184f, -0.3130931f),
-        Vertex(-1.182719f, 0.23932f, -0.0625f,-0.07902303f, 0.9455454f, -0.3157521f),
-        Vertex(-1.325757f, 0.220261f, -0.0625f,-0.2195999f, 0.9174576f, -0.3317339f),
-        Vertex(-1.428054f, 0.183147f, -0.0625f,-0.4887151f, 0.7905341f, -0.369071f),
-        Vertex(-1.489509f, 0.121959f, -0.0625f,-0.7976729f, 0.4520359f, -0.399226f),
-        Vertex(-1.510016f, 0.030678f, -0.0625f,-0.9165545f, 0.04567497f, -0.3972928f),
-        Vertex(-0.7840899f, 0.226511f, -0.09999999f,   -0.002516001f, 0.5976993f, -0.8017164f),
-        Vertex(-0.995913f, 0.225605f, -0.09999999f,   -0.012433f, 0.6812719f, -0.7319249f),
-        Vertex(-1.17003f, 0.219258f, -0.09999999f,   -0.05095002f, 0.6771832f, -0.7340482f),
-        Vertex(-1.306081f, 0.202032f, -0.09999999f,   -0.1402979f, 0.6488978f, -0.7478288f),
-        Vertex(-1.403706f, 0.168487f, -0.09999999f,   -0.3035011f, 0.5469342f, -0.7802243f),
-        Vertex(-1.462545f, 0.113182f, -0.09999999f,   -0.4955412f, 0.3157941f, -0.8091434f),
-        Vertex(-1.482238f, 0.030678f, -0.09999999f,   -0.5868877f, 0.04354398f, -0.8084966f),
-        Vertex(-0.796127f, 0.199428f, -0.1125f,0.000557f, -0.152599f, -0.988288f),
-        Vertex(-0.991845f, 0.198647f, -0.1125f,0.002074001f, -0.0009690003f, -0.9999974f),
-        Vertex(-1.153535f, 0.193178f, -0.1125f,0.005498999f, -0.00141f, -0.9999838f),
-        Vertex(-1.280502f, 0.178335f, -0.1125f,0.011569f, 0.0005459999f, -0.9999328f),
-        Vertex(-1.372053f, 0.149428f, -0.1125f,0.01933099f, 0.010342f, -0.9997596f),
-        Vertex(-1.427493f, 0.101772f, -0.1125f,0.017294f, 0.025347f, -0.9995291f),
-        Vertex(-1.446127f, 0.030678f, -0.1125f,0.002732999f, 0.02071f, -0.9997817f),
-        Vertex(-0.8081639f, 0.172345f, -0.09999999f,   0.002668002f, -0.7561955f, -0.6543404f),
-        Vertex(-0.9877769f, 0.171689f, -0.09999999f,   0.012416f, -0.6815858f, -0.7316328f),
-        Vertex(-1.13704f, 0.167098f, -0.09999999f,   0.04794599f, -0.6798449f, -0.7317869f),
-        Vertex(-1.254924f, 0.154637f, -0.09999999f,   0.130533f, -0.6595942f, -0.7402002f),
-        Vertex(-1.3404f, 0.13037f, -0.09999999f,0.293034f, -0.569168f, -0.768231f),
-        Vertex(-1.392441f, 0.09036199f, -0.09999999f,   0.500213f, -0.318883f, -0.8050469f),
-        Vertex(-1.410016f, 0.030678f, -0.09999999f,   0.587808f, -0.026599f, -0.808563f),
-        Vertex(-0.8174239f, 0.151512f, -0.0625f,0.003190999f, -0.9673316f, -0.2534939f),
-        Vertex(-0.9846479f, 0.150952f, -0.0625f,0.014981f, -0.9494818f, -0.3134639f),
-        Vertex(-1.124351f, 0.147036f, -0.0625f,0.05895399f, -0.9477838f, -0.3134169f),
-        Vertex(-1.235248f, 0.136407f, -0.0625f,0.164056f, -0.9331872f, -0.3197611f),
-        Vertex(-1.316052f, 0.115709f, -0.0625f,0.3912121f, -0.8532173f, -0.3449251f),
-        Vertex(-1.365477f, 0.08158499f, -0.0625f,0.7436751f, -0.5428411f, -0.3902191f),
-        Vertex(-1.382239f, 0.030678f, -0.0625f,0.9136017f, -0.07395598f, -0.3998279f),
-        Vertex(-1.362563f, -0.033905f, 0.0f,   0.9729245f, 0.2311209f, -0.0009179995f),
-        Vertex(-1.335942f, -0.110988f, 0.0f,   0.9123298f, 0.409438f, -0.003848999f),
-        Vertex(-1.289877f, -0.194322f, 0.0f,   0.8280289f, 0.5606489f, -0.006407999f),
-        Vertex(-1.222979f, -0.277655f, 0.0f,   0.7168072f, 0.6972392f, -0.006712001f),
-        Vertex(-1.133859f, -0.354739f, 0.0f,   0.5759888f, 0.8174508f, -0.003301999f),
-        Vertex(-1.021127f, -0.419322f, 0.0f,   0.4951329f, 0.8676327f, -0.04534999f),
-        Vertex(-1.373219f, -0.03733199f, 0.0625f,0.8939853f, 0.2131421f, 0.3941582f),
-        Vertex(-1.34527f, -0.116647f, 0.0625f,0.8406055f, 0.3838952f, 0.3821082f),
-        Vertex(-1.297053f, -0.20144f, 0.0625f,0.76886f, 0.531454f, 0.355543f),
-        Vertex(-1.227232f, -0.285886f, 0.0625f,0.6725095f, 0.6656775f, 0.3234262f),
-        Vertex(-1.134467f, -0.364159f, 0.0625f,0.5456098f, 0.7796327f, 0.3073799f),
-        Vertex(-1.017424f, -0.430433f, 0.0625f,0.4793028f, 0.8430496f, 0.2439999f),
-        Vertex(-1.399861f, -0.04589999f, 0.09999999f,   0.5763878f, 0.133958f, 0.8061218f),
-        Vertex(-1.36859f, -0.130793f, 0.09999999f,   0.5444701f, 0.253746f, 0.7994781f),
-        Vertex(-1.314993f, -0.219235f, 0.09999999f,   0.508754f, 0.364144f, 0.780108f),
-        Vertex(-1.237862f, -0.306462f, 0.09999999f,   0.4611798f, 0.4717798f, 0.7514897f),
-        Vertex(-1.135989f, -0.387709f, 0.09999999f,   0.3872811f, 0.5611662f, 0.7315092f),
-        Vertex(-1.008164f, -0.458211f, 0.09999999f,   0.371347f, 0.666129f, 0.646818f),
-        Vertex(-1.434495f, -0.057039f, 0.1125f,0.002409999f, -0.014515f, 0.9998917f),
-        Vertex(-1.398905f, -0.149183f, 0.1125f,0.001300999f, -0.01641099f, 0.9998645f),
-        Vertex(-1.338315f, -0.242369f, 0.1125f,0.0007199997f, -0.02020099f, 0.9997956f),
-        Vertex(-1.251683f, -0.333211f, 0.1125f,0.003255998f, -0.02135899f, 0.9997665f),
-        Vertex(-1.137967f, -0.418324f, 0.1125f,0.008875996f, -0.01333699f, 0.9998716f),
-        Vertex(-0.9961269f, -0.494322f, 0.1125f,0.07275897f, 0.1317089f, 0.9886146f),
-        Vertex(-1.46913f, -0.06817699f, 0.09999999f,   -0.5690878f, -0.161451f, 0.8062708f),
-        Vertex(-1.429221f, -0.167573f, 0.09999999f,   -0.5243167f, -0.2948408f, 0.7988496f),
-        Vertex(-1.361637f, -0.265502f, 0.09999999f,   -0.4726348f, -0.4106098f, 0.7797537f),
-        Vertex(-1.265503f, -0.35996f, 0.09999999f,   -0.4157828f, -0.5086058f, 0.7539527f),
-        Vertex(-1.139946f, -0.448939f, 0.09999999f,   -0.3496738f, -0.5796757f, 0.7360056f),
-        Vertex(-0.9840899f, -0.5304329f, 0.09999999f,   -0.2792079f, -0.5306978f, 0.8002517f),
-        Vertex(-1.495772f, -0.076745f, 0.0625f,-0.885693f, -0.241406f, 0.396574f),
-        Vertex(-1.45254f, -0.181719f, 0.0625f,-0.8032036f, -0.4499958f, 0.3903429f),
-        Vertex(-1.379576f, -0.283298f, 0.0625f,-0.6975129f, -0.6134439f, 0.370354f),
-        Vertex(-1.276134f, -0.380536f, 0.0625f,-0.5884621f, -0.7322772f, 0.3427571f),
-        Vertex(-1.141468f, -0.472489f, 0.0625f,-0.4852058f, -0.8130077f, 0.3218598f),
-        Vertex(-0.9748309f, -0.558211f, 0.0625f,-0.4258789f, -0.8235339f, 0.374725f),
-        Vertex(-1.506428f, -0.08017299f, 0.0f,-0.9657872f, -0.2593351f, 0.0005920001f),
-        Vertex(-1.461868f, -0.187377f, 0.0f,   -0.8726112f, -0.4884061f, 0.003010001f),
-        Vertex(-1.386752f, -0.290416f, 0.0f,   -0.7486511f, -0.662945f, 0.005037f),
-        Vertex(-1.280387f, -0.388766f, 0.0f,   -0.6224434f, -0.7826485f, 0.005056003f),
-        Vertex(-1.142076f, -0.481909f, 0.0f,   -0.5091117f, -0.8606965f, 0.002550999f),
-        Vertex(-0.9711269f, -0.5693219f, 0.0f,-0.4555148f, -0.8890377f, 0.04602298f),
-        Vertex(-1.495772f, -0.076745f, -0.0625f,-0.8886051f, -0.232245f, -0.3955291f),
-        Vertex(-1.45254f, -0.181719f, -0.0625f,-0.8093778f, -0.4434449f, -0.3850509f),
-        Vertex(-1.379576f, -0.283298f, -0.0625f,-0.7040522f, -0.6115981f, -0.3609131f),
-        Vertex(-1.276134f, -0.380536f, -0.0625f,-0.5927131f, -0.7335282f, -0.3326071f),
-        Vertex(-1.141468f, -0.472489f, -0.0625f,-0.4863342f, -0.8142933f, -0.3168681f),
-        Vertex(-0.9748309f, -0.558211f, -0.0625f,-0.44189f, -0.860789f, -0.252538f),
-        Vertex(-1.46913f, -0.06817699f, -0.09999999f,   -0.5744768f, -0.139332f, -0.8065748f),
-        Vertex(-1.429221f, -0.167573f, -0.09999999f,   -0.5322352f, -0.2756611f, -0.8004603f),
-        Vertex(-1.361637f, -0.265502f, -0.09999999f,   -0.4808437f, -0.3961708f, -0.7822006f),
-        Vertex(-1.265503f, -0.35996f, -0.09999999f,   -0.4231719f, -0.4993229f, -0.7560437f),
-        Vertex(-1.139946f, -0.448939f, -0.09999999f,   -0.355443f, -0.5741869f, -0.7375429f),
-        Vertex(-0.9840899f, -0.5304329f, -0.09999999f,   -0.348424f, -0.6707451f, -0.6547531f),
-        Vertex(-1.434495f, -0.057039f, -0.1125f,-0.001890999f, 0.01293699f, -0.9999145f),
-        Vertex(-1.398905f, -0.149183f, -0.1125f,0.001397f, 0.011921f, -0.9999279f),
-        Vertex(-1.338315f, -0.242369f, -0.1125f,0.005088997f, 0.01417799f, -0.9998865f),
-        Vertex(-1.251683f, -0.333211f, -0.1125f,0.004896001f, 0.016722f, -0.9998482f),
-        Vertex(-1.137967f, -0.418324f, -0.1125f,-0.002003001f, 0.01228501f, -0.9999226f),
-        Vertex(-0.9961269f, -0.494322f, -0.1125f,-0.06818298f, -0.130578f, -0.9890907f),
-        Vertex(-1.399861f, -0.04589999f, -0.09999999f,   0.5733869f, 0.149188f, -0.8055869f),
-        Vertex(-1.36859f, -0.130793f, -0.09999999f,   0.5412272f, 0.2667141f, -0.7974563f),
-        Vertex(-1.314993f, -0.219235f, -0.09999999f,   0.503525f, 0.37727f, -0.7772579f),
-        Vertex(-1.237862f, -0.306462f, -0.09999999f,   0.4514521f, 0.4841441f, -0.7495302f),
-        Vertex(-1.135989f, -0.387709f, -0.09999999f,   0.3723861f, 0.5710221f, -0.7316162f),
-        Vertex(-1.008164f, -0.458211f, -0.09999999f,   0.2897071f, 0.5290532f, -0.7976043f),
-        Vertex(-1.373219f, -0.03733199f, -0.0625f,   0.8926538f, 0.2161309f, -0.3955459f),
-        Vertex(-1.34527f, -0.116647f, -0.0625f,0.8372342f, 0.3848361f, -0.3885101f),
-        Vertex(-1.297053f, -0.20144f, -0.0625f,0.763231f, 0.53164f, -0.367202f),
-        Vertex(-1.227232f, -0.285886f, -0.0625f,0.6654689f, 0.6661019f, -0.336837f),
-        Vertex(-1.134467f, -0.364159f, -0.0625f,0.5379951f, 0.7819742f, -0.3147661f),
-        Vertex(-1.017424f, -0.430433f, -0.0625f,0.4553238f, 0.8109198f, -0.3675449f),
-        Vertex(0.8288729f, -0.156822f, 0.0f,   -0.145927f, 0.9870438f, 0.06670499f),
-        Vertex(1.008271f, -0.131127f, 0.0f,   -0.3502529f, 0.9366408f, -0.005156999f),
-        Vertex(1.114058f, -0.063766f, 0.0f,   -0.7109947f, 0.7031907f, -0.003046999f),
-        Vertex(1.172623f, 0.030678f, 0.0f,   -0.8994002f, 0.4371011f, 0.004678001f),
-        Vertex(1.210354f, 0.137623f, 0.0f,   -0.9302377f, 0.3665789f, 0.01665599f),
-        Vertex(1.253641f, 0.242484f, 0.0f,   -0.8458401f, 0.53304f, 0.020564f),
-        Vertex(1.328873f, 0.330678f, 0.0f,   -0.6463717f, 0.7630176f, 0.002775999f),
-        Vertex(0.8288729f, -0.187377f, 0.1375f,-0.128906f, 0.8415668f, 0.5245459f),
-        Vertex(1.015061f, -0.156719f, 0.131173f,-0.2920189f, 0.8520818f, 0.4343749f),
-        Vertex(1.123935f, -0.08331399f, 0.115355f,   -0.6153548f, 0.6751188f, 0.4068819f),
-        Vertex(1.183734f, 0.017484f, 0.09479199f,-0.799678f, 0.453205f, 0.393853f),
-        Vertex(1.2227f, 0.130318f, 0.074228f,   -0.8141301f, 0.3843811f, 0.4352511f),
-        Vertex(1.269073f, 0.239835f, 0.05841099f,-0.7117425f, 0.4966544f, 0.4967464f),
-        Vertex(1.351095f, 0.330678f, 0.052083f,-0.5387179f, 0.6839559f, 0.4919219f),
-        Vertex(0.8288729f, -0.263766f, 0.22f,   -0.05432799f, 0.4454299f, 0.8936668f),
-        Vertex(1.032036f, -0.220698f, 0.209877f,-0.120328f, 0.5357402f, 0.8357653f),
-        Vertex(1.148626f, -0.132182f, 0.184568f,-0.285367f, 0.495269f, 0.8205329f),
-        Vertex(1.211512f, -0.015502f, 0.151667f,-0.427214f, 0.405516f, 0.808112f),
-        Vertex(1.253564f, 0.112057f, 0.118765f,-0.4552616f, 0.3541817f, 0.8168793f),
-        Vertex(1.307654f, 0.233212f, 0.09345699f,-0.3865179f, 0.3751629f, 0.8425298f),
-        Vertex(1.406651f, 0.330678f, 0.08333299f,-0.28915f, 0.468105f, 0.8350269f),
-        Vertex(0.8288729f, -0.363072f, 0.2475f,0.075157f, -0.092491f, 0.992873f),
-        Vertex(1.054104f, -0.30387f, 0.236111f,0.130249f, 0.04017899f, 0.9906668f),
-        Vertex(1.180725f, -0.195711f, 0.207639f,0.2053039f, 0.124938f, 0.9706907f),
-        Vertex(1.247623f, -0.058384f, 0.170625f,0.176764f, 0.184322f, 0.9668401f),
-        Vertex(1.293688f, 0.08831699f, 0.133611f,0.08219303f, 0.1824831f, 0.9797674f),
-        Vertex(1.357808f, 0.224602f, 0.105139f,0.009841997f, 0.124532f, 0.9921667f),
-        Vertex(1.478873f, 0.330678f, 0.09374999f,-0.004171001f, 0.105296f, 0.9944322f),
-        Vertex(0.8288729f, -0.462377f, 0.22f,   0.2138491f, -0.5877553f, 0.7802643f),
-        Vertex(1.076172f, -0.387043f, 0.209877f,0.3617279f, -0.4470689f, 0.8180968f),
-        Vertex(1.212823f, -0.25924f, 0.184568f,0.6016351f, -0.258541f, 0.7557722f),
-        Vertex(1.283734f, -0.101266f, 0.151667f,0.6722209f, -0.09906299f, 0.7336929f),
-        Vertex(1.333811f, 0.06457699f, 0.118765f,0.5832469f, -0.08487f, 0.8078489f),
-        Vertex(1.407962f, 0.215992f, 0.09345699f,0.4092508f, -0.2357079f, 0.8814507f),
-        Vertex(1.551095f, 0.330678f, 0.08333299f,0.2842839f, -0.3856539f, 0.8777548f),
-        Vertex(0.8288729f, -0.538766f, 0.1375f,0.3026371f, -0.8807622f, 0.3642371f),
-        Vertex(1.093148f, -0.451022f, 0.131173f,0.4964279f, -0.7561049f, 0.4264559f),
-        Vertex(1.237515f, -0.308108f, 0.115355f,0.7904503f, -0.4871102f, 0.3713651f),
-        Vertex(1.311512f, -0.134252f, 0.09479199f,   0.8958597f, -0.2773599f, 0.3471408f),
-        Vertex(1.364675f, 0.046316f, 0.074228f,0.8652622f, -0.2959071f, 0.4046731f),
-        Vertex(1.446543f, 0.209369f, 0.05841f,0.6902718f, -0.5426428f, 0.4786058f),
-        Vertex(1.606651f, 0.330678f, 0.052083f,0.4677468f, -0.7535786f, 0.4618787f),
-        Vertex(0.8288729f, -0.5693219f, 0.0f,   0.3215629f, -0.9445047f, -0.06714097f),
-        Vertex(1.099938f, -0.476614f, 0.0f,   0.5315658f, -0.8470018f, 0.005045998f),
-        Vertex(1.247391f, -0.327655f, 0.0f,   0.8335048f, -0.5525079f, 0.002162999f),
-        Vertex(1.322623f, -0.147447f, 0.0f,   0.9441853f, -0.3293431f, -0.006880002f),
-        Vertex(1.377021f, 0.039012f, 0.0f,   0.9323182f, -0.3612451f, -0.016874f),
-        Vertex(1.461975f, 0.20672f, 0.0f,   0.7686391f, -0.6396011f, -0.010215f),
-        Vertex(1.628873f, 0.330678f, 0.0f,   0.5130019f, -0.8583868f, 0.0009639998f),
-        Vertex(0.8288729f, -0.538766f, -0.1375f,0.2783309f, -0.8095946f, -0.5168058f),
-        Vertex(1.093148f, -0.451022f, -0.131173f,0.491568f, -0.7636359f, -0.418594f),
-        Vertex(1.237515f, -0.308108f, -0.115355f,0.7884782f, -0.4931071f, -0.3676241f),
-        Vertex(1.311512f, -0.134252f, -0.09479199f,   0.8910884f, -0.2752708f, -0.3608148f),
-        Vertex(1.364675f, 0.046316f, -0.074228f,0.8564791f, -0.282922f, -0.4317391f),
-        Vertex(1.446543f, 0.209369f, -0.05841f,0.6922176f, -0.5273307f, -0.4927037f),
-        Vertex(1.606651f, 0.330678f, -0.052083f,0.4734868f, -0.7492617f, -0.4630518f),
-        Vertex(0.8288729f, -0.462377f, -0.22f,0.166654f, -0.429938f, -0.8873441f),
-        Vertex(1.076172f, -0.387043f, -0.209877f,0.339768f, -0.4583481f, -0.8212641f),
-        Vertex(1.212823f, -0.25924f, -0.184568f,0.59016f, -0.27624f, -0.758553f),
-        Vertex(1.283734f, -0.101266f, -0.151667f,0.668115f, -0.103914f, -0.736766f),
-        Vertex(1.333811f, 0.06457699f, -0.118765f,   0.5900092f, -0.07674003f, -0.8037413f),
-        Vertex(1.407962f, 0.215992f, -0.09345699f,   0.4332869f, -0.219357f, -0.8741538f),
-        Vertex(1.551095f, 0.330678f, -0.08333299f,   0.299036f, -0.368898f, -0.8800521f),
-        Vertex(0.8288729f, -0.363072f, -0.2475f,0.02786899f, 0.102187f, -0.9943747f),
-        Vertex(1.054104f, -0.30387f, -0.236111f,0.08815198f, 0.03181499f, -0.9955988f),
-        Vertex(1.180725f, -0.195711f, -0.207639f,0.174456f, 0.09618498f, -0.9799558f),
-        Vertex(1.247623f, -0.058384f, -0.170625f,0.1887081f, 0.161291f, -0.9686972f),
-        Vertex(1.293688f, 0.08831699f, -0.133611f,   0.1276859f, 0.1757739f, -0.9761146f),
-        Vertex(1.357808f, 0.224602f, -0.105139f,0.05450897f, 0.1309859f, -0.9898844f),
-        Vertex(1.478873f, 0.330678f, -0.09374999f,   0.01587699f, 0.11673f, -0.9930367f),
-        Vertex(0.8288729f, -0.263766f, -0.22f,-0.08107201f, 0.607187f, -0.7904121f),
-        Vertex(1.032036f, -0.220698f, -0.209877f,-0.164116f, 0.522469f, -0.836715f),
-        Vertex(1.148626f, -0.132182f, -0.184568f,-0.3196262f, 0.4634052f, -0.8264954f),
-        Vertex(1.211512f, -0.015502f, -0.151667f,-0.4229708f, 0.3834499f, -0.8210126f),
-        Vertex(1.253564f, 0.112057f, -0.118765f,-0.4245339f, 0.3535969f, -0.8335108f),
-        Vertex(1.307654f, 0.233212f, -0.09345699f,   -0.3516121f, 0.3881061f, -0.8519053f),
-        Vertex(1.406651f, 0.330678f, -0.08333299f,   -0.270475f, 0.475063f, -0.837352f),
-        Vertex(0.8288729f, -0.187377f, -0.1375f,-0.133739f, 0.917541f, -0.374476f),
-        Vertex(1.015061f, -0.156719f, -0.131173f,-0.3160429f, 0.8394898f, -0.4420109f),
-        Vertex(1.123935f, -0.08331399f, -0.115355f,   -0.6311809f, 0.6566489f, -0.4128229f),
-        Vertex(1.183734f, 0.017484f, -0.09479199f,   -0.8074049f, 0.4430169f, -0.3896579f),
-        Vertex(1.2227f, 0.130318f, -0.074228f,-0.8216587f, 0.3862289f, -0.4191708f),
-        Vertex(1.269073f, 0.239835f, -0.05841f,-0.7077482f, 0.5173932f, -0.4810372f),
-        Vertex(1.351095f, 0.330678f, -0.052083f,-0.5268137f, 0.6937897f, -0.4910428f),
-        Vertex(1.35341f, 0.346303f, 0.0f,   -0.4610171f, 0.8873711f, -0.005987001f),
-        Vertex(1.375169f, 0.355678f, 0.0f,   -0.2906751f, 0.9567103f, -0.01460101f),
-        Vertex(1.391373f, 0.358803f, 0.0f,   0.08551796f, 0.9950855f, -0.04991297f),
-        Vertex(1.399243f, 0.355678f, 0.0f,   0.8877124f, 0.4561657f, -0.06228496f),
-        Vertex(1.396003f, 0.346303f, 0.0f,   0.8229922f, -0.5672631f, 0.02993701f),
-        Vertex(1.378873f, 0.330678f, 0.0f,   0.6598783f, -0.7431583f, 0.1107981f),
-        Vertex(1.377077f, 0.346641f, 0.05054f,-0.391094f, 0.83136f, 0.394824f),
-        Vertex(1.398763f, 0.356295f, 0.046682f,-0.2533101f, 0.9368253f, 0.2412311f),
-        Vertex(1.413711f, 0.359584f, 0.041667f,0.01536599f, 0.9950096f, -0.09858795f),
-        Vertex(1.419477f, 0.35645f, 0.036651f,0.5201849f, 0.5498809f, -0.6534819f),
-        Vertex(1.413617f, 0.346834f, 0.032793f,0.6288559f, -0.3823759f, -0.6769999f),
-        Vertex(1.393688f, 0.330678f, 0.03125f,0.5789478f, -0.6460917f, -0.4973778f),
-        Vertex(1.436244f, 0.347485f, 0.08086399f,-0.2234219f, 0.6609277f, 0.7164196f),
-        Vertex(1.457748f, 0.357839f, 0.07469099f,-0.156131f, 0.8749861f, 0.4582821f),
-        Vertex(1.469556f, 0.361538f, 0.06666699f,-0.03646698f, 0.9982635f, -0.04626098f),
-        Vertex(1.47006f, 0.358379f, 0.058642f,0.1566369f, 0.6824906f, -0.7139127f),
-        Vertex(1.457652f, 0.34816f, 0.052469f,0.2636321f, 0.005571001f, -0.9646072f),
-        Vertex(1.430725f, 0.330678f, 0.05f,   0.3124089f, -0.3247778f, -0.8927037f),
-        Vertex(1.513161f, 0.348582f, 0.09097199f,-0.001750999f, 0.3393829f, 0.9406466f),
-        Vertex(1.534428f, 0.359845f, 0.08402799f,-0.02111899f, 0.7599017f, 0.6496947f),
-        Vertex(1.542154f, 0.364077f, 0.075f,   -0.044404f, 0.9981211f, 0.04221901f),
-        Vertex(1.535817f, 0.360886f, 0.06597199f,-0.03252899f, 0.8028619f, -0.5952769f),
-        Vertex(1.514897f, 0.349884f, 0.059028f,-0.008745001f, 0.371564f, -0.9283661f),
-        Vertex(1.478873f, 0.330678f, 0.05624999f,0.04252898f, 0.07791297f, -0.9960526f),
-        Vertex(1.590078f, 0.349679f, 0.08086399f,0.2800199f, -0.238192f, 0.9299748f),
-        Vertex(1.611109f, 0.361851f, 0.07469099f,0.2273049f, 0.4914857f, 0.8406985f),
-        Vertex(1.614753f, 0.366616f, 0.06666699f,-0.003104998f, 0.9874066f, 0.1581719f),
-        Vertex(1.601575f, 0.363394f, 0.058642f,-0.143918f, 0.8958663f, -0.4203702f),
-        Vertex(1.572143f, 0.351608f, 0.052469f,-0.200177f, 0.683872f, -0.701604f),
-        Vertex(1.527021f, 0.330678f, 0.05f,   -0.1871879f, 0.5001976f, -0.8454365f),
-        Vertex(1.649245f, 0.350523f, 0.05054f,0.4536729f, -0.7468348f, 0.4862289f),
-        Vertex(1.670094f, 0.363394f, 0.046682f,0.6921583f, -0.08006204f, 0.7172914f),
-        Vertex(1.670597f, 0.368569f, 0.041667f,0.185758f, 0.9425361f, 0.277704f),
-        Vertex(1.652158f, 0.365323f, 0.036651f,-0.211188f, 0.9552742f, -0.207004f),
-        Vertex(1.616178f, 0.352934f, 0.032793f,-0.3129609f, 0.8810608f, -0.3546649f),
-        Vertex(1.564058f, 0.330678f, 0.03125f,-0.336331f, 0.8113451f, -0.4781221f),
-        Vertex(1.672912f, 0.35086f, 0.0f,   0.4824449f, -0.8758158f, -0.013906f),
-        Vertex(1.693688f, 0.364011f, 0.0f,   0.9130126f, -0.4055718f, -0.04381098f),
-        Vertex(1.692935f, 0.36935f, 0.0f,   0.5069092f, 0.8539203f, 0.117742f),
-        Vertex(1.672391f, 0.366095f, 0.0f,   -0.2340329f, 0.9721234f, 0.01429499f),
-        Vertex(1.633792f, 0.353465f, 0.0f,   -0.3480328f, 0.9374674f, 0.005276997f),
-        Vertex(1.578873f, 0.330678f, 0.0f,   -0.3840639f, 0.9210727f, -0.06418498f),
-        Vertex(1.649245f, 0.350523f, -0.05054f,0.457762f, -0.7176679f, -0.524792f),
-        Vertex(1.670094f, 0.363394f, -0.046682f,0.6833472f, -0.06301402f, -0.7273692f),
-        Vertex(1.670597f, 0.368569f, -0.041667f,0.3573609f, 0.8981858f, -0.2560379f),
-        Vertex(1.652158f, 0.365323f, -0.036651f,-0.2070099f, 0.9478627f, 0.2422869f),
-        Vertex(1.616178f, 0.352934f, -0.032793f,-0.3143869f, 0.8723568f, 0.3743719f),
-        Vertex(1.564058f, 0.330678f, -0.03125f,-0.36104f, 0.8728191f, 0.328385f),
-        Vertex(1.590078f, 0.349679f, -0.08086399f,   0.280225f, -0.218552f, -0.934724f),
-        Vertex(1.611109f, 0.361851f, -0.07469099f,   0.261124f, 0.434074f, -0.8622029f),
-        Vertex(1.614753f, 0.366616f, -0.06666699f,   0.060553f, 0.978577f, -0.196775f),
-        Vertex(1.601575f, 0.363394f, -0.058642f,-0.1318089f, 0.8810936f, 0.4542028f),
-        Vertex(1.572143f, 0.351608f, -0.052469f,-0.195016f, 0.6588579f, 0.7265499f),
-        Vertex(1.527021f, 0.330678f, -0.05f,   -0.247824f, 0.6303589f, 0.7356839f),
-        Vertex(1.513161f, 0.348582f, -0.09097199f,   0.008860001f, 0.321862f, -0.9467451f),
-        Vertex(1.534428f, 0.359845f, -0.08402799f,   0.001382001f, 0.7331892f, -0.6800233f),
-        Vertex(1.542154f, 0.364077f, -0.075f,   -0.01272f, 0.9979491f, -0.06273401f),
-        Vertex(1.535817f, 0.360886f, -0.06597199f,   -0.011656f, 0.7852209f, 0.6191059f),
-        Vertex(1.514897f, 0.349884f, -0.059028f,0.000967f, 0.344022f, 0.938961f),
-        Vertex(1.478873f, 0.330678f, -0.05624999f,   -0.03735999f, 0.214324f, 0.9760478f),
-        Vertex(1.436244f, 0.347485f, -0.08086399f,   -0.2133601f, 0.6488383f, -0.7304014f),
-        Vertex(1.457748f, 0.357839f, -0.07469099f,   -0.140052f, 0.8658911f, -0.4802271f),
-        Vertex(1.469556f, 0.361538f, -0.06666699f,   -0.0008089999f, 0.9994998f, 0.03161099f),
-        Vertex(1.47006f, 0.358379f, -0.058642f,0.194529f, 0.6590812f, 0.7264782f),
-        Vertex(1.457652f, 0.34816f, -0.052469f,0.2668319f, -0.005233998f, 0.9637287f),
-        Vertex(1.430725f, 0.330678f, -0.05f,   0.2193799f, -0.2172469f, 0.9511446f),
-        Vertex(1.377077f, 0.346641f, -0.05054f,-0.384886f, 0.827121f, -0.409553f),
-        Vertex(1.398763f, 0.356295f, -0.046682f,-0.2409149f, 0.9326416f, -0.2685879f),
-        Vertex(1.413711f, 0.359584f, -0.041667f,0.06582997f, 0.9967856f, 0.04565798f),
-        Vertex(1.419477f, 0.35645f, -0.036651f,0.5970108f, 0.5077028f, 0.6211408f),
-        Vertex(1.413617f, 0.346834f, -0.032793f,0.6130043f, -0.3694181f, 0.6983953f),
-        Vertex(1.393688f, 0.330678f, -0.03125f,0.4868732f, -0.5667872f, 0.6646103f),
-        Vertex(-0.021127f, 0.7056779f, 0.0f,   0.0f, 0.9999999f, 0.0f),
-        Vertex(0.118225f, 0.6942199f, 0.0f,   0.3957909f, 0.9182068f, 0.015676f),
-        Vertex(0.160354f, 0.6640109f, 0.0f,   0.9645441f, 0.263762f, 0.009177001f),
-        Vertex(0.141373f, 0.621303f, 0.0f,   0.8390408f, -0.5440559f, -0.003653999f),
-        Vertex(0.09739099f, 0.572345f, 0.0f,   0.7889689f, -0.6144299f, 0.001943f),
-        Vertex(0.06452099f, 0.5233859f, 0.0f,   0.9910246f, -0.1336469f, 0.002952999f),
-        Vertex(0.07887299f, 0.480678f, 0.0f,   0.7325307f, 0.6806057f, -0.01320599f),
-        Vertex(0.113346f, 0.6942199f, 0.037539f,0.3776689f, 0.9184907f, 0.117221f),
-        Vertex(0.154f, 0.6640109f, 0.048885f,   0.9295568f, 0.263662f, 0.2576939f),
-        Vertex(0.135681f, 0.621303f, 0.043764f,0.8111578f, -0.5448008f, 0.2126379f),
-        Vertex(0.09323699f, 0.572345f, 0.031902f,0.7611559f, -0.6151949f, 0.20537f),
-        Vertex(0.061512f, 0.5233859f, 0.023022f,0.9565148f, -0.133833f, 0.2591679f),
-        Vertex(0.07535399f, 0.480678f, 0.026852f,0.7106892f, 0.6809552f, 0.1766941f),
-        Vertex(0.09951499f, 0.6942199f, 0.07096599f,   0.3336961f, 0.9187912f, 0.210878f),
-        Vertex(0.135987f, 0.6640109f, 0.09241699f,   0.8307129f, 0.2637839f, 0.4902389f),
-        Vertex(0.119549f, 0.621303f, 0.08274099f,0.727549f, -0.545809f, 0.41565f),
-        Vertex(0.08146299f, 0.572345f, 0.06032399f,   0.681011f, -0.6162879f, 0.395491f),
-        Vertex(0.05299f, 0.5233859f, 0.04355299f,0.8564128f, -0.134443f, 0.4984798f),
-        Vertex(0.06539099f, 0.480678f, 0.050815f,0.6401761f, 0.6812711f, 0.355027f),
-        Vertex(0.07794299f, 0.6942199f, 0.09906999f,   0.267591f, 0.918878f, 0.289928f),
-        Vertex(0.107891f, 0.6640109f, 0.129019f,0.6754159f, 0.263955f, 0.688579f),
-        Vertex(0.09438799f, 0.621303f, 0.115516f,0.5949699f, -0.546203f, 0.5896379f),
-        Vertex(0.063104f, 0.572345f, 0.08423099f,0.5553297f, -0.6167296f, 0.5579007f),
-        Vertex(0.039709f, 0.5233859f, 0.06083599f,   0.6986937f, -0.1348039f, 0.7026057f),
-        Vertex(0.04987299f, 0.480678f, 0.07099999f,   0.5268981f, 0.681345f, 0.508082f),
-        Vertex(0.049838f, 0.6942199f, 0.120642f,0.183499f, 0.9187108f, 0.349712f),
-        Vertex(0.07128999f, 0.6640109f, 0.157114f,   0.4740307f, 0.2640978f, 0.8399685f),
-        Vertex(0.061614f, 0.621303f, 0.140676f,0.4221941f, -0.5457681f, 0.723802f),
-        Vertex(0.039197f, 0.572345f, 0.10259f,0.392296f, -0.6162761f, 0.6828671f),
-        Vertex(0.022426f, 0.5233859f, 0.07411699f,   0.4935979f, -0.134679f, 0.8591987f),
-        Vertex(0.029688f, 0.480678f, 0.086519f,0.3781838f, 0.6811966f, 0.6268557f),
-        Vertex(0.016412f, 0.6942199f, 0.134473f,0.08649794f, 0.9183774f, 0.3861358f),
-        Vertex(0.027758f, 0.6640109f, 0.175127f,0.2396049f, 0.2640958f, 0.9342605f),
-        Vertex(0.022637f, 0.621303f, 0.156808f,0.219887f, -0.5447429f, 0.8092619f),
-        Vertex(0.010774f, 0.572345f, 0.114364f,0.201667f, -0.615183f, 0.762155f),
-        Vertex(0.001895f, 0.5233859f, 0.08263899f,   0.2535291f, -0.1341731f, 0.9579774f),
-        Vertex(0.005725f, 0.480678f, 0.09648199f,0.2026309f, 0.6808658f, 0.7038198f),
-        Vertex(-0.021127f, 0.6942199f, 0.139352f,-0.01567599f, 0.9182067f, 0.3957909f),
-        Vertex(-0.021127f, 0.6640109f, 0.181482f,-0.009177001f, 0.263762f, 0.9645441f),
-        Vertex(-0.021127f, 0.621303f, 0.1625f,0.003653998f, -0.5440567f, 0.8390405f),
-        Vertex(-0.021127f, 0.572345f, 0.118519f,-0.001943f, -0.61443f, 0.7889689f),
-        Vertex(-0.021127f, 0.5233859f, 0.08564799f,   -0.002952999f, -0.1336469f, 0.9910246f),
-        Vertex(-0.021127f, 0.480678f, 0.09999999f,   0.01320599f, 0.6806057f, 0.7325307f),
-        Vertex(-0.05866599f, 0.6942199f, 0.134473f,   -0.117221f, 0.9184907f, 0.3776689f),
-        Vertex(-0.07001299f, 0.6640109f, 0.175127f,   -0.2576939f, 0.263662f, 0.9295568f),
-        Vertex(-0.06489199f, 0.621303f, 0.156808f,   -0.2126379f, -0.5448008f, 0.8111578f),
-        Vertex(-0.053029f, 0.572345f, 0.114364f,-0.20537f, -0.6151949f, 0.7611559f),
-        Vertex(-0.044149f, 0.5233859f, 0.08263899f,   -0.2591679f, -0.133833f, 0.9565147f),
-        Vertex(-0.047979f, 0.480678f, 0.096481f,-0.1766941f, 0.6809552f, 0.7106892f),
-        Vertex(-0.09209299f, 0.6942199f, 0.120642f,   -0.210878f, 0.9187912f, 0.3336961f),
-        Vertex(-0.113544f, 0.6640109f, 0.157114f,-0.4902389f, 0.2637839f, 0.8307129f),
-        Vertex(-0.103868f, 0.621303f, 0.140676f,-0.41565f, -0.545809f, 0.727549f),
-        Vertex(-0.08145099f, 0.572345f, 0.10259f,-0.395491f, -0.6162879f, 0.681011f),
-        Vertex(-0.06468f, 0.5233859f, 0.07411699f,   -0.4984798f, -0.134443f, 0.8564128f),
-        Vertex(-0.07194199f, 0.480678f, 0.086519f,   -0.355027f, 0.6812711f, 0.6401761f),
-        Vertex(-0.120197f, 0.6942199f, 0.09906999f,   -0.289928f, 0.918878f, 0.267591f),
-        Vertex(-0.150146f, 0.6640109f, 0.129019f,-0.688579f, 0.263955f, 0.6754159f),
-        Vertex(-0.136643f, 0.621303f, 0.115516f,-0.5896379f, -0.546203f, 0.5949699f),
-        Vertex(-0.105359f, 0.572345f, 0.08423099f,   -0.5579008f, -0.6167297f, 0.5553297f),
-        Vertex(-0.081963f, 0.5233859f, 0.06083599f,   -0.7026057f, -0.1348039f, 0.6986937f),
-        Vertex(-0.092127f, 0.480678f, 0.07099999f,   -0.508082f, 0.681345f, 0.5268981f),
-        Vertex(-0.14177f, 0.6942199f, 0.07096599f,   -0.349712f, 0.9187108f, 0.183499f),
-        Vertex(-0.178241f, 0.6640109f, 0.09241699f,   -0.8399685f, 0.2640978f, 0.4740307f),
-        Vertex(-0.161803f, 0.621303f, 0.08274099f,   -0.723802f, -0.545768f, 0.422194f),
-        Vertex(-0.123717f, 0.572345f, 0.06032399f,   -0.6828672f, -0.6162761f, 0.3922961f),
-        Vertex(-0.09524399f, 0.5233859f, 0.04355299f,   -0.8591988f, -0.134679f, 0.4935979f),
-        Vertex(-0.107646f, 0.480678f, 0.050815f,-0.6268557f, 0.6811966f, 0.3781838f),
-        Vertex(-0.1556f, 0.6942199f, 0.037539f,-0.3861358f, 0.9183774f, 0.08649794f),
-        Vertex(-0.196254f, 0.6640109f, 0.048885f,-0.9342605f, 0.2640958f, 0.2396049f),
-        Vertex(-0.177936f, 0.621303f, 0.043764f,-0.8092619f, -0.5447429f, 0.219887f),
-        Vertex(-0.135491f, 0.572345f, 0.031902f,-0.762155f, -0.615183f, 0.201667f),
-        Vertex(-0.103767f, 0.5233859f, 0.023022f,-0.9579774f, -0.1341731f, 0.2535291f),
-        Vertex(-0.117609f, 0.480678f, 0.026852f,-0.7038198f, 0.6808658f, 0.2026309f),
-        Vertex(-0.160479f, 0.6942199f, 0.0f,   -0.3957909f, 0.9182068f, -0.015676f),
-        Vertex(-0.202609f, 0.6640109f, 0.0f,   -0.9645441f, 0.263762f, -0.009177001f),
-        Vertex(-0.183627f, 0.621303f, 0.0f,   -0.8390405f, -0.5440567f, 0.003653998f),
-        Vertex(-0.139646f, 0.572345f, 0.0f,   -0.7889689f, -0.6144299f, -0.001943f),
-        Vertex(-0.106775f, 0.5233859f, 0.0f,   -0.9910246f, -0.1336469f, -0.002952999f),
-        Vertex(-0.121127f, 0.480678f, 0.0f,   -0.7325307f, 0.6806057f, 0.01320599f),
-        Vertex(-0.1556f, 0.6942199f, -0.037539f,-0.3776689f, 0.9184907f, -0.117221f),
-        Vertex(-0.196254f, 0.6640109f, -0.048885f,   -0.9295568f, 0.263662f, -0.2576939f),
-        Vertex(-0.177936f, 0.621303f, -0.043764f,-0.8111578f, -0.5448008f, -0.2126379f),
-        Vertex(-0.135491f, 0.572345f, -0.031902f,-0.7611559f, -0.6151949f, -0.20537f),
-        Vertex(-0.103767f, 0.5233859f, -0.023022f,   -0.9565148f, -0.133833f, -0.2591679f),
-        Vertex(-0.117609f, 0.480678f, -0.026852f,-0.7106892f, 0.6809552f, -0.1766941f),
-        Vertex(-0.14177f, 0.6942199f, -0.07096599f,   -0.3336961f, 0.9187912f, -0.210878f),
-        Vertex(-0.178241f, 0.6640109f, -0.09241699f,   -0.8307129f, 0.2637839f, -0.4902389f),
-        Vertex(-0.161803f, 0.621303f, -0.08274099f,   -0.727549f, -0.545809f, -0.41565f),
-        Vertex(-0.123717f, 0.572345f, -0.06032399f,   -0.681011f, -0.6162879f, -0.395491f),
-        Vertex(-0.09524399f, 0.5233859f, -0.04355299f,   -0.8564128f, -0.134443f, -0.4984798f),
-        Vertex(-0.107646f, 0.480678f, -0.050815f,-0.6401761f, 0.6812711f, -0.355027f),
-        Vertex(-0.120197f, 0.6942199f, -0.09906999f,   -0.267591f, 0.918878f, -0.289928f),
-        Vertex(-0.150146f, 0.6640109f, -0.129019f,   -0.6754159f, 0.263955f, -0.688579f),
-        Vertex(-0.136643f, 0.621303f, -0.115516f,-0.5949699f, -0.546203f, -0.5896379f),
-        Vertex(-0.105359f, 0.572345f, -0.08423099f,   -0.5553297f, -0.6167296f, -0.5579007f),
-        Vertex(-0.081963f, 0.5233859f, -0.06083599f,   -0.6986937f, -0.1348039f, -0.7026057f),
-        Vertex(-0.092127f, 0.480678f, -0.07099999f,   -0.5268981f, 0.681345f, -0.508082f),
-        Vertex(-0.09209299f, 0.6942199f, -0.120642f,   -0.183499f, 0.9187108f, -0.349712f),
-        Vertex(-0.113544f, 0.6640109f, -0.157114f,   -0.4740307f, 0.2640978f, -0.8399685f),
-        Vertex(-0.103868f, 0.621303f, -0.140676f,-0.4221941f, -0.5457681f, -0.723802f),
-        Vertex(-0.08145099f, 0.572345f, -0.10259f,   -0.392296f, -0.6162761f, -0.6828671f),
-        Vertex(-0.06468f, 0.5233859f, -0.07411699f,   -0.4935979f, -0.134679f, -0.8591987f),
-        Vertex(-0.07194199f, 0.480678f, -0.086519f,   -0.3781838f, 0.6811966f, -0.6268557f),
-        Vertex(-0.05866599f, 0.6942199f, -0.134473f,   -0.08649794f, 0.9183774f, -0.3861358f),
-        Vertex(-0.07001299f, 0.6640109f, -0.175127f,   -0.2396049f, 0.2640958f, -0.9342605f),
-        Vertex(-0.06489199f, 0.621303f, -0.156808f,   -0.219887f, -0.5447429f, -0.8092619f),
-        Vertex(-0.053029f, 0.572345f, -0.114364f,-0.201667f, -0.615183f, -0.762155f),
-        Vertex(-0.044149f, 0.5233859f, -0.08263899f,   -0.2535291f, -0.1341731f, -0.9579774f),
-        Vertex(-0.047979f, 0.480678f, -0.09648199f,   -0.2026309f, 0.6808658f, -0.7038198f),
-        Vertex(-0.021127f, 0.6942199f, -0.139352f,   0.01567599f, 0.9182067f, -0.3957909f),
-        Vertex(-0.021127f, 0.6640109f, -0.181482f,   0.009177001f, 0.263762f, -0.9645441f),
-        Vertex(-0.021127f, 0.621303f, -0.1625f,-0.003653998f, -0.5440567f, -0.8390405f),
-        Vertex(-0.021127f, 0.572345f, -0.118519f,0.001943f, -0.61443f, -0.7889689f),
-        Vertex(-0.021127f, 0.5233859f, -0.08564799f,   0.002952999f, -0.1336469f, -0.9910246f),
-        Vertex(-0.021127f, 0.480678f, -0.09999999f,   -0.01320599f, 0.6806057f, -0.7325307f),
-        Vertex(0.016412f, 0.6942199f, -0.134473f,0.117221f, 0.9184907f, -0.3776689f),
-        Vertex(0.027758f, 0.6640109f, -0.175127f,0.2576939f, 0.263662f, -0.9295568f),
-        Vertex(0.022637f, 0.621303f, -0.156808f,0.2126379f, -0.5448008f, -0.8111578f),
-        Vertex(0.010774f, 0.572345f, -0.114364f,0.20537f, -0.6151949f, -0.7611559f),
-        Vertex(0.001895f, 0.5233859f, -0.08263899f,   0.2591679f, -0.133833f, -0.9565147f),
-        Vertex(0.005725f, 0.480678f, -0.096481f,0.1766941f, 0.6809552f, -0.7106892f),
-        Vertex(0.049838f, 0.6942199f, -0.120642f,0.210878f, 0.9187912f, -0.3336961f),
-        Vertex(0.07128999f, 0.6640109f, -0.157114f,   0.4902389f, 0.2637839f, -0.8307129f),
-        Vertex(0.061614f, 0.621303f, -0.140676f,0.41565f, -0.545809f, -0.727549f),
-        Vertex(0.039197f, 0.572345f, -0.10259f,0.395491f, -0.6162879f, -0.681011f),
-        Vertex(0.022426f, 0.5233859f, -0.07411699f,   0.4984798f, -0.134443f, -0.8564128f),
-        Vertex(0.029688f, 0.480678f, -0.086519f,0.355027f, 0.6812711f, -0.6401761f),
-        Vertex(0.07794299f, 0.6942199f, -0.09906999f,   0.289928f, 0.918878f, -0.267591f),
-        Vertex(0.107891f, 0.6640109f, -0.129019f,0.688579f, 0.263955f, -0.6754159f),
-        Vertex(0.09438799f, 0.621303f, -0.115516f,   0.5896379f, -0.546203f, -0.5949699f),
-        Vertex(0.063104f, 0.572345f, -0.08423099f,   0.5579008f, -0.6167297f, -0.5553297f),
-        Vertex(0.039709f, 0.5233859f, -0.06083599f,   0.7026057f, -0.1348039f, -0.6986937f),
-        Vertex(0.04987299f, 0.480678f, -0.07099999f,   0.508082f, 0.681345f, -0.5268981f),
-        Vertex(0.09951499f, 0.6942199f, -0.07096599f,   0.349712f, 0.9187108f, -0.183499f),
-        Vertex(0.135987f, 0.6640109f, -0.09241699f,   0.8399685f, 0.2640978f, -0.4740307f),
-        Vertex(0.119549f, 0.621303f, -0.08274099f,   0.723802f, -0.545768f, -0.422194f),
-        Vertex(0.08146299f, 0.572345f, -0.06032399f,   0.6828672f, -0.6162761f, -0.3922961f),
-        Vertex(0.05299f, 0.5233859f, -0.04355299f,   0.8591988f, -0.134679f, -0.4935979f),
-        Vertex(0.06539099f, 0.480678f, -0.050815f,   0.6268557f, 0.6811966f, -0.3781838f),
-        Vertex(0.113346f, 0.6942199f, -0.037539f,0.3861358f, 0.9183774f, -0.08649794f),
-        Vertex(0.154f, 0.6640109f, -0.048885f,0.9342605f, 0.2640958f, -0.2396049f),
-        Vertex(0.135681f, 0.621303f, -0.043764f,0.8092619f, -0.5447429f, -0.219887f),
-        Vertex(0.09323699f, 0.572345f, -0.031902f,   0.762155f, -0.615183f, -0.201667f),
-        Vertex(0.061512f, 0.5233859f, -0.023022f,0.9579774f, -0.1341731f, -0.2535291f),
-        Vertex(0.07535399f, 0.480678f, -0.026852f,   0.7038198f, 0.6808658f, -0.2026309f),
-        Vertex(0.154336f, 0.448734f, 0.0f,   0.2997631f, 0.9540052f, -0.004004001f),
-        Vertex(0.26591f, 0.425123f, 0.0f,   0.180158f, 0.983637f, -0.001176f),
-        Vertex(0.391373f, 0.405678f, 0.0f,   0.158462f, 0.987365f, 0.000232f),
-        Vertex(0.5085019f, 0.386234f, 0.0f,   0.213709f, 0.9768949f, 0.002171f),
-        Vertex(0.5950769f, 0.362623f, 0.0f,   0.4893011f, 0.8720632f, 0.009504002f),
-        Vertex(0.6288729f, 0.330678f, 0.0f,   0.6866069f, 0.7264099f, -0.02999f),
-        Vertex(0.148162f, 0.448734f, 0.047115f,0.2902378f, 0.9541165f, 0.07364396f),
-        Vertex(0.25581f, 0.425123f, 0.07707499f,0.174086f, 0.9836808f, 0.04545199f),
-        Vertex(0.376859f, 0.405678f, 0.110764f,0.152777f, 0.9874009f, 0.041212f),
-        Vertex(0.489867f, 0.386234f, 0.142215f,0.205547f, 0.9769628f, 0.05739299f),
-        Vertex(0.573395f, 0.362623f, 0.165462f,0.4695978f, 0.8723565f, 0.1359109f),
-        Vertex(0.6060019f, 0.330678f, 0.174537f,0.6706556f, 0.7267535f, 0.1484929f),
-        Vertex(0.130681f, 0.448734f, 0.08916099f,0.2606979f, 0.9542797f, 0.1462419f),
-        Vertex(0.227213f, 0.425123f, 0.145857f,0.156021f, 0.9837421f, 0.08893201f),
-        Vertex(0.335762f, 0.405678f, 0.209611f,0.136587f, 0.987448f, 0.079312f),
-        Vertex(0.437101f, 0.386234f, 0.26913f,0.183282f, 0.9770458f, 0.108577f),
-        Vertex(0.5120029f, 0.362623f, 0.313123f,0.417739f, 0.872696f, 0.252776f),
-        Vertex(0.541243f, 0.330678f, 0.330296f,0.6083308f, 0.7274598f, 0.3173889f),
-        Vertex(0.103451f, 0.448734f, 0.124579f,0.2140079f, 0.9543476f, 0.2083769f),
-        Vertex(0.182669f, 0.425123f, 0.203796f,0.1277159f, 0.9837666f, 0.1260629f),
-        Vertex(0.271748f, 0.405678f, 0.292875f,0.111442f, 0.9874658f, 0.111767f),
-        Vertex(0.35491f, 0.386234f, 0.376037f,0.1490049f, 0.9770753f, 0.1520559f),
-        Vertex(0.416377f, 0.362623f, 0.437505f,0.3383471f, 0.8728124f, 0.3517382f),
-        Vertex(0.440373f, 0.330678f, 0.4615f,   0.5055652f, 0.7278113f, 0.4633512f),
-        Vertex(0.06803399f, 0.448734f, 0.151808f,0.153158f, 0.9542928f, 0.2566469f),
-        Vertex(0.12473f, 0.425123f, 0.24834f,   0.09096196f, 0.9837446f, 0.1548299f),
-        Vertex(0.188484f, 0.405678f, 0.356889f,0.07891296f, 0.9874474f, 0.1368219f),
-        Vertex(0.248003f, 0.386234f, 0.458228f,0.104831f, 0.9770404f, 0.1854791f),
-        Vertex(0.291995f, 0.362623f, 0.5331299f,0.2363189f, 0.8726625f, 0.4273328f),
-        Vertex(0.309169f, 0.330678f, 0.5623699f,0.3692721f, 0.7276512f, 0.5780672f),
-        Vertex(0.025988f, 0.448734f, 0.169289f,0.08144902f, 0.9541363f, 0.2880801f),
-        Vertex(0.055948f, 0.425123f, 0.276938f,0.04774398f, 0.9836846f, 0.1734499f),
-        Vertex(0.08963699f, 0.405678f, 0.397986f,0.04076001f, 0.9874002f, 0.152903f),
-        Vertex(0.121088f, 0.386234f, 0.5109949f,0.05316397f, 0.9769543f, 0.2067209f),
-        Vertex(0.144335f, 0.362623f, 0.594523f,0.11736f, 0.8723071f, 0.474665f),
-        Vertex(0.15341f, 0.330678f, 0.6271299f,0.2070079f, 0.7270377f, 0.6546477f),
-        Vertex(-0.021127f, 0.448734f, 0.175463f,0.004004001f, 0.9540052f, 0.2997631f),
-        Vertex(-0.021127f, 0.425123f, 0.287037f,0.001176f, 0.9836369f, 0.180158f),
-        Vertex(-0.021127f, 0.405678f, 0.4125f,-0.000232f, 0.987365f, 0.158462f),
-        Vertex(-0.021127f, 0.386234f, 0.5296299f,-0.002171f, 0.9768949f, 0.213709f),
-        Vertex(-0.021127f, 0.362623f, 0.616204f,-0.009504002f, 0.8720632f, 0.4893011f),
-        Vertex(-0.021127f, 0.330678f, 0.6499999f,0.02999f, 0.7264099f, 0.6866069f),
-        Vertex(-0.06824199f, 0.448734f, 0.169289f,   -0.07364397f, 0.9541166f, 0.2902379f),
-        Vertex(-0.09820199f, 0.425123f, 0.276938f,   -0.04545199f, 0.9836808f, 0.174086f),
-        Vertex(-0.131891f, 0.405678f, 0.397986f,-0.041212f, 0.9874009f, 0.152777f),
-        Vertex(-0.163343f, 0.386234f, 0.5109949f,-0.05739299f, 0.9769628f, 0.205547f),
-        Vertex(-0.186589f, 0.362623f, 0.594523f,-0.1359109f, 0.8723565f, 0.4695978f),
-        Vertex(-0.195664f, 0.330678f, 0.6271299f,-0.1484929f, 0.7267535f, 0.6706556f),
-        Vertex(-0.110288f, 0.448734f, 0.151808f,-0.1462419f, 0.9542796f, 0.2606979f),
-        Vertex(-0.166985f, 0.425123f, 0.24834f,-0.08893201f, 0.9837421f, 0.156021f),
-        Vertex(-0.230738f, 0.405678f, 0.356889f,-0.079312f, 0.987448f, 0.136587f),
-        Vertex(-0.290258f, 0.386234f, 0.458228f,-0.108577f, 0.9770458f, 0.183282f),
-        Vertex(-0.33425f, 0.362623f, 0.5331299f,-0.252776f, 0.872696f, 0.417739f),
-        Vertex(-0.351424f, 0.330678f, 0.5623699f,-0.3173889f, 0.7274598f, 0.6083308f),
-        Vertex(-0.145706f, 0.448734f, 0.124579f,-0.2083769f, 0.9543477f, 0.2140079f),
-        Vertex(-0.224924f, 0.425123f, 0.203796f,-0.1260629f, 0.9837666f, 0.1277159f),
-        Vertex(-0.314002f, 0.405678f, 0.292875f,-0.111767f, 0.9874658f, 0.111442f),
-        Vertex(-0.397164f, 0.386234f, 0.376037f,-0.1520559f, 0.9770755f, 0.1490049f),
-        Vertex(-0.458632f, 0.362623f, 0.437505f,-0.3517382f, 0.8728124f, 0.3383471f),
-        Vertex(-0.482627f, 0.330678f, 0.4615f,-0.4633512f, 0.7278113f, 0.5055652f),
-        Vertex(-0.172935f, 0.448734f, 0.08916099f,   -0.2566469f, 0.9542928f, 0.153158f),
-        Vertex(-0.269467f, 0.425123f, 0.145857f,-0.1548299f, 0.9837446f, 0.09096196f),
-        Vertex(-0.378016f, 0.405678f, 0.209611f,-0.1368219f, 0.9874473f, 0.07891295f),
-        Vertex(-0.479355f, 0.386234f, 0.26913f,-0.1854791f, 0.9770404f, 0.104831f),
-        Vertex(-0.5542579f, 0.362623f, 0.313123f,-0.4273328f, 0.8726625f, 0.2363189f),
-        Vertex(-0.5834979f, 0.330678f, 0.330296f,-0.5780672f, 0.7276512f, 0.3692721f),
-        Vertex(-0.190416f, 0.448734f, 0.047115f,-0.2880801f, 0.9541363f, 0.08144902f),
-        Vertex(-0.298065f, 0.425123f, 0.07707499f,   -0.1734499f, 0.9836846f, 0.04774398f),
-        Vertex(-0.419113f, 0.405678f, 0.110764f,-0.152903f, 0.9874002f, 0.04076001f),
-        Vertex(-0.532122f, 0.386234f, 0.142215f,-0.2067209f, 0.9769543f, 0.05316397f),
-        Vertex(-0.6156499f, 0.362623f, 0.165462f,-0.474665f, 0.8723071f, 0.11736f),
-        Vertex(-0.648257f, 0.330678f, 0.174537f,-0.6546477f, 0.7270377f, 0.2070079f),
-        Vertex(-0.19659f, 0.448734f, 0.0f,   -0.2997631f, 0.9540052f, 0.004004001f),
-        Vertex(-0.308164f, 0.425123f, 0.0f,   -0.180158f, 0.983637f, 0.001176f),
-        Vertex(-0.433627f, 0.405678f, 0.0f,   -0.158462f, 0.987365f, -0.000232f),
-        Vertex(-0.5507569f, 0.386234f, 0.0f,   -0.213709f, 0.9768949f, -0.002171f),
-        Vertex(-0.6373309f, 0.362623f, 0.0f,   -0.4893011f, 0.8720632f, -0.009504002f),
-        Vertex(-0.671127f, 0.330678f, 0.0f,   -0.6866069f, 0.7264099f, 0.02999f),
-        Vertex(-0.190416f, 0.448734f, -0.047115f,-0.2902378f, 0.9541165f, -0.07364396f),
-        Vertex(-0.298065f, 0.425123f, -0.07707499f,   -0.174086f, 0.9836808f, -0.04545199f),
-        Vertex(-0.419113f, 0.405678f, -0.110764f,-0.152777f, 0.9874009f, -0.041212f),
-        Vertex(-0.532122f, 0.386234f, -0.142215f,-0.205547f, 0.9769628f, -0.05739299f),
-        Vertex(-0.6156499f, 0.362623f, -0.165462f,   -0.4695978f, 0.8723565f, -0.1359109f),
-        Vertex(-0.648257f, 0.330678f, -0.174537f,-0.6706556f, 0.7267535f, -0.1484929f),
-        Vertex(-0.172935f, 0.448734f, -0.08916099f,   -0.2606979f, 0.9542797f, -0.1462419f),
-        Vertex(-0.269467f, 0.425123f, -0.145857f,-0.156021f, 0.9837421f, -0.08893201f),
-        Vertex(-0.378016f, 0.405678f, -0.209611f,-0.136587f, 0.987448f, -0.079312f),
-        Vertex(-0.479355f, 0.386234f, -0.26913f,-0.183282f, 0.9770458f, -0.108577f),
-        Vertex(-0.5542579f, 0.362623f, -0.313123f,   -0.417739f, 0.872696f, -0.252776f),
-        Vertex(-0.5834979f, 0.330678f, -0.330296f,   -0.6083308f, 0.7274598f, -0.3173889f),
-        Vertex(-0.145706f, 0.448734f, -0.124579f,-0.2140079f, 0.9543476f, -0.2083769f),
-        Vertex(-0.224924f, 0.425123f, -0.203796f,-0.1277159f, 0.9837666f, -0.1260629f),
-        Vertex(-0.314002f, 0.405678f, -0.292875f,-0.111442f, 0.9874658f, -0.111767f),
-        Vertex(-0.397164f, 0.386234f, -0.376037f,-0.1490049f, 0.9770753f, -0.1520559f),
-        Vertex(-0.458632f, 0.362623f, -0.437505f,-0.3383471f, 0.8728124f, -0.3517382f),
-        Vertex(-0.482627f, 0.330678f, -0.4615f,-0.5055652f, 0.7278113f, -0.4633512f),
-        Vertex(-0.110288f, 0.448734f, -0.151808f,-0.153158f, 0.9542928f, -0.2566469f),
-        Vertex(-0.166985f, 0.425123f, -0.24834f,-0.09096196f, 0.9837446f, -0.1548299f),
-        Vertex(-0.230738f, 0.405678f, -0.356889f,-0.07891296f, 0.9874474f, -0.1368219f),
-        Vertex(-0.290258f, 0.386234f, -0.458228f,-0.104831f, 0.9770404f, -0.1854791f),
-        Vertex(-0.33425f, 0.362623f, -0.5331299f,-0.2363189f, 0.8726625f, -0.4273328f),
-        Vertex(-0.351424f, 0.330678f, -0.5623699f,   -0.3692721f, 0.7276512f, -0.5780672f),
-        Vertex(-0.06824199f, 0.448734f, -0.169289f,   -0.08144902f, 0.9541363f, -0.2880801f),
-        Vertex(-0.09820199f, 0.425123f, -0.276938f,   -0.04774398f, 0.9836846f, -0.1734499f),
-        Vertex(-0.131891f, 0.405678f, -0.397986f,-0.04076001f, 0.9874002f, -0.152903f),
-        Vertex(-0.163343f, 0.386234f, -0.5109949f,   -0.05316397f, 0.9769543f, -0.2067209f),
-        Vertex(-0.186589f, 0.362623f, -0.594523f,-0.11736f, 0.8723071f, -0.474665f),
-        Vertex(-0.195664f, 0.330678f, -0.6271299f,   -0.2070079f, 0.7270377f, -0.6546477f),
-        Vertex(-0.021127f, 0.448734f, -0.175463f,-0.004004001f, 0.9540052f, -0.2997631f),
-        Vertex(-0.021127f, 0.425123f, -0.287037f,-0.001176f, 0.9836369f, -0.180158f),
-        Vertex(-0.021127f, 0.405678f, -0.4125f,0.000232f, 0.987365f, -0.158462f),
-        Vertex(-0.021127f, 0.386234f, -0.5296299f,   0.002171f, 0.9768949f, -0.213709f),
-        Vertex(-0.021127f, 0.362623f, -0.616204f,0.009504002f, 0.8720632f, -0.4893011f),
-        Vertex(-0.021127f, 0.330678f, -0.6499999f,   -0.02999f, 0.7264099f, -0.6866069f),
-        Vertex(0.025988f, 0.448734f, -0.169289f,0.07364397f, 0.9541166f, -0.2902379f),
-        Vertex(0.055948f, 0.425123f, -0.276938f,0.04545199f, 0.9836808f, -0.174086f),
-        Vertex(0.08963699f, 0.405678f, -0.397986f,   0.041212f, 0.9874009f, -0.152777f),
-        Vertex(0.121088f, 0.386234f, -0.5109949f,0.05739299f, 0.9769628f, -0.205547f),
-        Vertex(0.144335f, 0.362623f, -0.594523f,0.1359109f, 0.8723565f, -0.4695978f),
-        Vertex(0.15341f, 0.330678f, -0.6271299f,0.1484929f, 0.7267535f, -0.6706556f),
-        Vertex(0.06803399f, 0.448734f, -0.151808f,   0.1462419f, 0.9542796f, -0.2606979f),
-        Vertex(0.12473f, 0.425123f, -0.24834f,0.08893201f, 0.9837421f, -0.156021f),
-        Vertex(0.188484f, 0.405678f, -0.356889f,0.079312f, 0.987448f, -0.136587f),
-        Vertex(0.248003f, 0.386234f, -0.458228f,0.108577f, 0.9770458f, -0.183282f),
-        Vertex(0.291996f, 0.362623f, -0.5331299f,0.252776f, 0.872696f, -0.417739f),
-        Vertex(0.309169f, 0.330678f, -0.5623699f,0.3173889f, 0.7274598f, -0.6083308f),
-        Vertex(0.103451f, 0.448734f, -0.124579f,0.2083769f, 0.9543477f, -0.2140079f),
-        Vertex(0.182669f, 0.425123f, -0.203796f,0.1260629f, 0.9837666f, -0.1277159f),
-        Vertex(0.271748f, 0.405678f, -0.292875f,0.111767f, 0.9874658f, -0.111442f),
-        Vertex(0.35491f, 0.386234f, -0.376037f,0.1520559f, 0.9770755f, -0.1490049f),
-        Vertex(0.416377f, 0.362623f, -0.437505f,0.3517382f, 0.8728124f, -0.3383471f),
-        Vertex(0.440373f, 0.330678f, -0.4615f,0.4633512f, 0.7278113f, -0.5055652f),
-        Vertex(0.130681f, 0.448734f, -0.08916099f,   0.2566469f, 0.9542928f, -0.153158f),
-        Vertex(0.227213f, 0.425123f, -0.145857f,0.1548299f, 0.9837446f, -0.09096196f),
-        Vertex(0.335762f, 0.405678f, -0.209611f,0.1368219f, 0.9874473f, -0.07891295f),
-        Vertex(0.437101f, 0.386234f, -0.26913f,0.1854791f, 0.9770404f, -0.104831f),
-        Vertex(0.5120029f, 0.362623f, -0.313123f,0.4273328f, 0.8726625f, -0.2363189f),
-        Vertex(0.541243f, 0.330678f, -0.330296f,0.5780672f, 0.7276512f, -0.3692721f),
-        Vertex(0.148162f, 0.448734f, -0.047115f,0.2880801f, 0.9541363f, -0.08144902f),
-        Vertex(0.25581f, 0.425123f, -0.07707499f,0.1734499f, 0.9836846f, -0.04774398f),
-        Vertex(0.376859f, 0.405678f, -0.110764f,0.152903f, 0.9874002f, -0.04076001f),
-        Vertex(0.489867f, 0.386234f, -0.142215f,0.2067209f, 0.9769543f, -0.05316397f),
-        Vertex(0.573395f, 0.362623f, -0.165462f,0.474665f, 0.8723071f, -0.11736f),
-        Vertex(0.6060019f, 0.330678f, -0.174537f,  0.6546477f, 0.7270377f, -0.2070079f),
-    };
-
-    uint32_t TeapotIndices[] = 
-    {
-        0, 7, 8, 8, 1, 0, 1, 8, 9, 9, 2, 1, 2, 9, 10, 10, 3, 2, 3, 10, 11, 11, 4, 3, 4, 11, 12, 12, 5, 4, 5, 12, 13, 13,
-        6, 5, 7, 14, 15, 15, 8, 7, 8, 15, 16, 16, 9, 8, 9, 16, 17, 17, 10, 9, 10, 17, 18, 18, 11, 10, 11, 18, 19, 19, 12,
-        11, 12, 19, 20, 20, 13, 12, 14, 21, 22, 22, 15, 14, 15, 22, 23, 23, 16, 15, 16, 23, 24, 24, 17, 16, 17, 24, 25, 25,
-        18, 17, 18, 25, 26, 26, 19, 18, 19, 26, 27, 27, 20, 19, 21, 28, 29, 29, 22, 21, 22, 29, 30, 30, 23, 22, 23, 30, 31,
-        31, 24, 23, 24, 31, 32, 32, 25, 24, 25, 32, 33, 33, 26, 25, 26, 33, 34, 34, 27, 26, 28, 35, 36, 36, 29, 28, 29, 36,
-        37, 37, 30, 29, 30, 37, 38, 38, 31, 30, 31, 38, 39, 39, 32, 31, 32, 39, 40, 40, 33, 32, 33, 40, 41, 41, 34, 33, 35,
-        42, 43, 43, 36, 35, 36, 43, 44, 44, 37, 36, 37, 44, 45, 45, 38, 37, 38, 45, 46, 46, 39, 38, 39, 46, 47, 47, 40, 39,
-        40, 47, 48, 48, 41, 40, 42, 49, 50, 50, 43, 42, 43, 50, 51, 51, 44, 43, 44, 51, 52, 52, 45, 44, 45, 52, 53, 53, 46,
-        45, 46, 53, 54, 54, 47, 46, 47, 54, 55, 55, 48, 47, 49, 56, 57, 57, 50, 49, 50, 57, 58, 58, 51, 50, 51, 58, 59, 59,
-        52, 51, 52, 59, 60, 60, 53, 52, 53, 60, 61, 61, 54, 53, 54, 61, 62, 62, 55, 54, 56, 63, 64, 64, 57, 56, 57, 64, 65,
-        65, 58, 57, 58, 65, 66, 66, 59, 58, 59, 66, 67, 67, 60, 59, 60, 67, 68, 68, 61, 60, 61, 68, 69, 69, 62, 61, 63, 70,
-        71, 71, 64, 63, 64, 71, 72, 72, 65, 64, 65, 72, 73, 73, 66, 65, 66, 73, 74, 74, 67, 66, 67, 74, 75, 75, 68, 67, 68,
-        75, 76, 76, 69, 68, 70, 77, 78, 78, 71, 70, 71, 78, 79, 79, 72, 71, 72, 79, 80, 80, 73, 72, 73, 80, 81, 81, 74, 73,
-        74, 81, 82, 82, 75, 74, 75, 82, 83, 83, 76, 75, 77, 84, 85, 85, 78, 77, 78, 85, 86, 86, 79, 78, 79, 86, 87, 87, 80,
-        79, 80, 87, 88, 88, 81, 80, 81, 88, 89, 89, 82, 81, 82, 89, 90, 90, 83, 82, 84, 91, 92, 92, 85, 84, 85, 92, 93, 93,
-        86, 85, 86, 93, 94, 94, 87, 86, 87, 94, 95, 95, 88, 87, 88, 95, 96, 96, 89, 88, 89, 96, 97, 97, 90, 89, 91, 98, 99, 99, 92, 91, 92, 99, 100, 100, 93, 92, 93, 100, 101, 101, 94, 93, 94, 101, 102, 102, 95, 94, 95, 102, 103, 103, 96, 95, 96, 103, 104, 104, 97, 96, 98, 105, 106, 106, 99, 98, 99, 106, 107, 107, 100, 99, 100, 107, 108, 108, 101, 100, 101, 108, 109, 109, 102, 101, 102, 109, 110, 110, 103, 102, 103, 110, 111, 111, 104, 103, 105, 112, 113, 113, 106, 105, 106, 113, 114, 114, 107, 106, 107, 114, 115, 115, 108, 107, 108, 115, 116, 116, 109, 108, 109, 116, 117, 117, 110,
-        109, 110, 117, 118, 118, 111, 110, 112, 119, 120, 120, 113, 112, 113, 120, 121, 121, 114, 113, 114, 121, 122, 122, 115, 114, 115, 122, 123, 123, 116, 115, 116, 123, 124, 124, 117, 116, 117, 124, 125, 125, 118, 117, 119, 126, 127, 127, 120, 119, 120, 127, 128, 128, 121, 120, 121, 128, 129, 129, 122, 121, 122, 129, 130, 130, 123, 122, 123, 130, 131, 131, 124, 123, 124, 131, 132, 132, 125, 124, 126, 133, 134, 134, 127, 126, 127, 134, 135, 135, 128, 127, 128, 135, 136, 136, 129, 128, 129, 136, 137, 137, 130, 129, 130, 137, 138, 138, 131, 130, 131, 138, 139, 139, 132, 131, 133, 140, 141, 141, 134, 133, 134, 141, 142, 142, 135, 134, 135, 142, 143, 143, 136, 135, 136, 143, 144, 144, 137, 136, 137, 144, 145, 145, 138, 137, 138, 145, 146, 146, 139, 138, 140, 147, 148, 148, 141, 140, 141, 148, 149, 149, 142, 141, 142, 149, 150, 150, 143, 142, 143, 150, 151, 151, 144, 143, 144, 151, 152, 152, 145, 144, 145, 152, 153, 153, 146, 145, 147, 154, 155, 155, 148, 147, 148, 155, 156, 156, 149, 148, 149, 156, 157, 157, 150, 149, 150, 157, 158, 158, 151, 150, 151, 158, 159, 159, 152, 151, 152, 159, 160, 160, 153, 152, 154, 161, 162, 162, 155, 154, 155, 162, 163, 163, 156, 155, 156, 163, 164, 164, 157, 156, 157, 164, 165, 165, 158, 157, 158, 165, 166, 166, 159, 158, 159, 166, 167, 167, 160, 159, 161, 0, 1, 1, 162, 161, 162, 1, 2, 2, 163, 162, 163, 2, 3, 3, 164, 163, 164, 3, 4, 4, 165, 164, 165, 4, 5, 5, 166, 165, 166, 5, 6, 6, 167, 166, 6, 13, 174, 174, 168, 6, 168, 174, 175, 175, 169, 168, 169, 175, 176, 176, 170, 169, 170, 176, 177, 177, 171, 170, 171, 177, 178, 178, 172, 171, 172, 178, 179, 179, 173, 172, 13, 20, 180, 180, 174, 13, 174, 180, 181, 181, 175, 174, 175, 181, 182, 182, 176, 175, 176, 182, 183, 183, 177, 176, 177, 183, 184, 184, 178, 177, 178, 184, 185, 185, 179, 178, 20, 27, 186, 186, 180, 20, 180, 186, 187, 187, 181, 180, 181, 187, 188, 188, 182, 181, 182, 188, 189, 189, 183, 182, 183, 189, 190, 190, 184, 183, 184, 190, 191, 191, 185, 184, 27, 34, 192, 192, 186, 27, 186, 192, 193, 193, 187, 186, 187, 193, 194, 194, 188, 187, 188, 194, 195, 195, 189, 188, 189, 195, 196, 196, 190, 189, 190, 196, 197, 197, 191, 190, 34, 41, 198, 198, 192, 34, 192, 198, 199, 199, 193, 192, 193, 199, 200, 200, 194, 193, 194, 200, 201, 201, 195, 194, 195, 201, 202, 202, 196, 195, 196, 202, 203, 203, 197, 196, 41, 48, 204, 204, 198, 41, 198, 204, 205, 205, 199, 198, 199, 205, 206, 206, 200, 199, 200, 206, 207, 207, 201, 200, 201, 207, 208, 208, 202, 201, 202, 208, 209, 209, 203, 202, 48, 55, 210, 210, 204, 48, 204, 210, 211, 211, 205, 204, 205, 211, 212, 212, 206, 205, 206, 212, 213, 213, 207, 206, 207, 213, 214, 214, 208, 207, 208, 214, 215, 215, 209, 208, 55, 62, 216, 216, 210, 55, 210, 216, 217, 217, 211, 210, 211, 217, 218, 218, 212, 211, 212, 218, 219, 219, 213, 212, 213, 219, 220, 220, 214, 213, 214, 220, 221, 221, 215, 214,
-        62, 69, 222, 222, 216, 62, 216, 222, 223, 223, 217, 216, 217, 223, 224, 224, 218, 217, 218, 224, 225, 225, 219, 218, 219, 225, 226, 226, 220, 219, 220, 226, 227, 227, 221, 220, 69, 76, 228, 228, 222, 69, 222, 228, 229, 229, 223, 222, 223, 229, 230, 230, 224, 223, 224, 230, 231, 231, 225, 224, 225, 231, 232, 232, 226, 225, 226, 232, 233, 233, 227, 226, 76, 83, 234, 234, 228, 76, 228, 234, 235, 235, 229, 228, 229, 235, 236, 236, 230, 229, 230, 236, 237, 237, 231, 230, 231, 237, 238, 238, 232, 231, 232, 238, 239, 239, 233, 232, 83, 90, 240, 240, 234, 83, 234, 240, 241, 241, 235,
-        234, 235, 241, 242, 242, 236, 235, 236, 242, 243, 243, 237, 236, 237, 243, 244, 244, 238, 237, 238, 244, 245, 245, 239, 238, 90, 97, 246, 246, 240, 90, 240, 246, 247, 247, 241, 240, 241, 247, 248, 248, 242, 241, 242, 248, 249, 249, 243, 242, 243, 249, 250, 250, 244, 243, 244, 250, 251, 251, 245, 244, 97, 104, 252, 252, 246, 97, 246, 252, 253, 253, 247, 246, 247, 253, 254, 254, 248, 247, 248, 254, 255, 255, 249, 248, 249, 255, 256, 256, 250, 249, 250, 256, 257, 257, 251, 250, 104, 111, 258, 258, 252, 104, 252, 258, 259, 259, 253, 252, 253, 259, 260, 260, 254, 253, 254, 260, 261, 261, 255, 254, 255, 261, 262, 262, 256, 255, 256, 262, 263, 263, 257, 256, 111, 118, 264, 264, 258, 111, 258, 264, 265, 265, 259, 258, 259, 265, 266, 266, 260, 259, 260, 266, 267, 267, 261, 260, 261, 267, 268, 268, 262, 261, 262, 268, 269, 269, 263, 262, 118, 125, 270, 270, 264, 118, 264, 270, 271, 271, 265, 264, 265, 271, 272, 272, 266, 265, 266, 272, 273, 273, 267, 266, 267, 273, 274, 274, 268, 267, 268, 274, 275, 275, 269, 268, 125, 132, 276, 276, 270, 125, 270, 276, 277, 277, 271, 270, 271, 277, 278, 278, 272, 271, 272, 278, 279, 279, 273, 272, 273, 279, 280, 280, 274, 273, 274, 280, 281, 281, 275, 274, 132, 139, 282, 282, 276, 132, 276, 282, 283, 283, 277, 276, 277, 283, 284, 284, 278, 277, 278, 284, 285, 285, 279, 278, 279, 285, 286, 286, 280, 279, 280, 286, 287, 287, 281, 280, 139, 146, 288, 288, 282, 139, 282, 288, 289, 289, 283, 282, 283, 289, 290, 290, 284, 283, 284, 290, 291, 291, 285, 284, 285, 291, 292, 292, 286, 285, 286, 292, 293, 293, 287, 286, 146, 153, 294, 294, 288, 146, 288, 294, 295, 295, 289, 288, 289, 295, 296, 296, 290, 289, 290, 296, 297, 297, 291, 290, 291, 297, 298, 298, 292, 291, 292, 298, 299, 299, 293, 292, 153, 160, 300, 300, 294, 153, 294, 300, 301, 301, 295, 294, 295, 301, 302, 302, 296, 295, 296, 302, 303, 303, 297, 296, 297, 303, 304, 304, 298, 297, 298, 304, 305, 305, 299, 298, 160, 167, 306, 306, 300, 160, 300, 306, 307, 307, 301, 300, 301, 307, 308, 308, 302, 301, 302, 308, 309, 309, 303, 302, 303, 309, 310, 310, 304, 303, 304, 310, 311, 311, 305, 304, 167, 6, 168, 168, 306, 167, 306, 168, 169, 169, 307, 306, 307, 169, 170, 170, 308, 307, 308, 170, 171, 171, 309, 308, 309, 171, 172, 172, 310, 309, 310, 172, 173, 173, 311, 310, 173, 179, 318, 318, 312, 173, 312, 318, 319, 319, 313, 312, 313, 319, 320, 320, 314, 313, 314, 320, 321, 321, 315, 314, 315, 321, 322, 322, 316, 315, 316, 322, 323, 323, 317, 316, 179, 185, 324, 324, 318, 179, 318, 324, 325, 325, 319, 318, 319, 325, 326, 326, 320, 319, 320, 326, 327, 327, 321, 320, 321, 327, 328, 328, 322, 321, 322, 328, 329, 329, 323, 322, 185, 191, 330, 330, 324, 185, 324, 330, 331, 331, 325, 324, 325, 331, 332, 332, 326, 325, 326, 332, 333, 333, 327, 326, 327, 333, 334, 334, 328, 327, 328, 334, 335, 335, 329, 328, 191, 197, 336, 336, 330, 191, 330,
-        336, 337, 337, 331, 330, 331, 337, 338, 338, 332, 331, 332, 338, 339, 339, 333, 332, 333, 339, 340, 340, 334, 333, 334, 340, 341, 341, 335, 334, 197, 203, 342, 342, 336, 197, 336, 342, 343, 343, 337, 336, 337, 343, 344, 344, 338, 337, 338, 344, 345, 345, 339, 338, 339, 345, 346, 346, 340, 339, 340, 346, 347, 347, 341, 340, 203, 209, 348, 348, 342, 203, 342, 348, 349, 349, 343, 342, 343, 349, 350, 350, 344, 343, 344, 350, 351, 351, 345, 344, 345, 351, 352, 352, 346, 345, 346, 352, 353, 353, 347, 346, 209, 215, 354, 354, 348, 209, 348, 354, 355, 355, 349, 348, 349, 355, 356,
-        356, 350, 349, 350, 356, 357, 357, 351, 350, 351, 357, 358, 358, 352, 351, 352, 358, 359, 359, 353, 352, 215, 221, 360, 360, 354, 215, 354, 360, 361, 361, 355, 354, 355, 361, 362, 362, 356, 355, 356, 362, 363, 363, 357, 356, 357, 363, 364, 364, 358, 357, 358, 364, 365, 365, 359, 358, 221, 227, 366, 366, 360, 221, 360, 366, 367, 367, 361, 360, 361, 367, 368, 368, 362, 361, 362, 368, 369, 369, 363, 362, 363, 369, 370, 370, 364, 363, 364, 370, 371, 371, 365, 364, 227, 233, 372, 372, 366, 227, 366, 372, 373, 373, 367, 366, 367, 373, 374, 374, 368, 367, 368, 374, 375, 375, 369, 368, 369, 375, 376, 376, 370, 369, 370, 376, 377, 377, 371, 370, 233, 239, 378, 378, 372, 233, 372, 378, 379, 379, 373, 372, 373, 379, 380, 380, 374, 373, 374, 380, 381, 381, 375, 374, 375, 381, 382, 382, 376, 375, 376, 382, 383, 383, 377, 376, 239, 245, 384, 384, 378, 239, 378, 384, 385, 385, 379, 378, 379, 385, 386, 386, 380, 379, 380, 386, 387, 387, 381, 380, 381, 387, 388, 388, 382, 381, 382, 388, 389, 389, 383, 382, 245, 251, 390, 390, 384, 245, 384, 390, 391, 391, 385, 384, 385, 391, 392, 392, 386, 385, 386, 392, 393, 393, 387, 386, 387, 393, 394, 394, 388, 387, 388, 394, 395, 395, 389, 388, 251, 257, 396, 396, 390, 251, 390, 396, 397, 397, 391, 390, 391, 397, 398, 398, 392, 391, 392, 398, 399, 399, 393, 392, 393, 399, 400, 400, 394, 393, 394, 400, 401, 401, 395, 394, 257, 263, 402, 402, 396, 257, 396, 402, 403, 403, 397, 396, 397, 403, 404, 404, 398, 397, 398, 404, 405, 405, 399, 398, 399, 405, 406, 406, 400, 399, 400, 406, 407, 407, 401, 400, 263, 269, 408, 408, 402, 263, 402,
-        408, 409, 409, 403, 402, 403, 409, 410, 410, 404, 403, 404, 410, 411, 411, 405, 404, 405, 411, 412, 412, 406, 405, 406, 412, 413, 413, 407, 406, 269, 275, 414, 414, 408, 269, 408, 414, 415, 415, 409, 408, 409, 415, 416, 416, 410, 409, 410, 416, 417, 417, 411, 410, 411, 417, 418, 418, 412, 411, 412, 418, 419, 419, 413, 412, 275, 281, 420, 420, 414, 275, 414, 420, 421, 421, 415, 414, 415, 421, 422, 422, 416, 415, 416, 422, 423, 423, 417, 416, 417, 423, 424, 424, 418, 417, 418, 424, 425, 425, 419, 418, 281, 287, 426, 426, 420, 281, 420, 426, 427, 427, 421, 420, 421, 427, 428, 428, 422, 421, 422, 428, 429, 429, 423, 422, 423, 429, 430, 430, 424, 423, 424, 430, 431, 431, 425, 424, 287, 293, 432, 432, 426, 287, 426, 432, 433, 433, 427, 426, 427, 433, 434, 434, 428, 427, 428, 434, 435, 435, 429, 428, 429, 435, 436, 436, 430, 429, 430, 436, 437, 437, 431, 430, 293, 299, 438, 438, 432, 293, 432, 438, 439, 439, 433, 432, 433, 439, 440, 440, 434, 433, 434, 440, 441, 441, 435, 434, 435, 441, 442, 442, 436, 435, 436, 442, 443, 443, 437, 436, 299, 305, 444, 444, 438, 299, 438, 444, 445, 445, 439, 438, 439, 445, 446, 446, 440, 439, 440, 446, 447, 447, 441, 440, 441, 447, 448, 448, 442, 441, 442, 448, 449, 449, 443, 442, 305, 311, 450, 450, 444, 305, 444, 450, 451, 451, 445, 444, 445, 451, 452, 452, 446, 445, 446, 452, 453, 453, 447, 446, 447, 453, 454, 454, 448, 447, 448, 454, 455, 455, 449, 448, 311, 173, 312, 312, 450, 311, 450, 312, 313, 313, 451, 450, 451, 313, 314, 314, 452, 451, 452, 314, 315, 315, 453, 452, 453, 315, 316, 316, 454, 453, 454, 316, 317, 317, 455, 454, 317, 323, 462, 462, 456, 317, 456, 462, 463, 463, 457, 456, 457, 463, 464, 464, 458, 457, 458, 464, 465, 465, 459, 458, 459, 465, 466, 466, 460, 459, 460, 466, 461, 323, 329, 467, 467, 462, 323, 462, 467, 468, 468, 463, 462, 463, 468, 469, 469, 464, 463, 464, 469, 470, 470, 465, 464, 465, 470, 471, 471, 466, 465, 466, 471, 461, 329, 335, 472, 472, 467, 329, 467, 472, 473, 473, 468, 467, 468, 473, 474, 474, 469, 468, 469, 474, 475, 475, 470, 469, 470, 475, 476, 476, 471, 470, 471, 476, 461, 335, 341, 477, 477, 472, 335, 472, 477, 478, 478, 473, 472, 473, 478, 479, 479, 474, 473, 474, 479, 480, 480, 475, 474, 475, 480, 481, 481, 476, 475, 476, 481, 461, 341, 347, 482, 482, 477, 341, 477, 482, 483, 483, 478, 477, 478, 483, 484, 484, 479, 478, 479, 484, 485, 485, 480, 479, 480, 485, 486, 486, 481, 480, 481, 486, 461, 347, 353, 487, 487, 482, 347, 482, 487, 488, 488, 483, 482, 483, 488, 489, 489, 484, 483, 484, 489, 490, 490, 485, 484, 485, 490, 491, 491, 486, 485, 486, 491, 461, 353, 359, 492, 492, 487, 353, 487, 492, 493, 493, 488, 487, 488, 493, 494, 494, 489, 488, 489, 494, 495, 495, 490, 489, 490, 495, 496, 496, 491, 490, 491, 496, 461, 359, 365, 497, 497, 492, 359, 492, 497, 498, 498, 493, 492, 493, 498, 499, 499, 494, 493, 494, 499, 500, 500,
-        495, 494, 495, 500, 501, 501, 496, 495, 496, 501, 461, 365, 371, 502, 502, 497, 365, 497, 502, 503, 503, 498, 497, 498, 503, 504, 504, 499, 498, 499, 504, 505, 505, 500, 499, 500, 505, 506, 506, 501, 500, 501, 506, 461, 371, 377, 507, 507, 502, 371, 502, 507, 508, 508, 503, 502, 503, 508, 509, 509, 504, 503, 504, 509, 510, 510, 505, 504, 505, 510, 511, 511, 506, 505, 506, 511, 461, 377, 383, 512, 512, 507, 377, 507, 512, 513, 513, 508, 507, 508, 513, 514, 514, 509, 508, 509, 514, 515, 515, 510, 509, 510, 515, 516, 516, 511, 510, 511, 516, 461, 383, 389, 517, 517, 512, 383, 512, 517, 518, 518, 513, 512, 513, 518, 519, 519, 514, 513, 514, 519, 520, 520, 515, 514, 515, 520, 521, 521, 516, 515, 516, 521, 461, 389, 395, 522, 522, 517, 389, 517, 522, 523, 523, 518, 517, 518, 523, 524, 524, 519, 518, 519, 524, 525, 525, 520, 519, 520, 525, 526, 526, 521, 520, 521, 526, 461, 395, 401, 527, 527, 522, 395, 522, 527, 528, 528, 523, 522, 523, 528, 529, 529, 524, 523, 524, 529, 530, 530, 525, 524, 525, 530, 531, 531, 526, 525, 526, 531, 461, 401, 407, 532, 532, 527, 401, 527, 532, 533, 533, 528, 527, 528, 533, 534, 534, 529, 528, 529, 534, 535, 535, 530, 529, 530, 535, 536, 536, 531, 530, 531, 536, 461, 407, 413, 537, 537, 532, 407, 532, 537, 538, 538, 533, 532, 533, 538, 539, 539, 534, 533, 534, 539, 540, 540, 535, 534, 535, 540, 541, 541, 536, 535, 536, 541, 461, 413, 419, 542, 542, 537, 413, 537, 542, 543, 543, 538, 537, 538, 543, 544, 544, 539, 538, 539, 544, 545, 545, 540, 539, 540, 545, 546, 546, 541, 540, 541, 546, 461, 419, 425, 547, 547, 542, 419, 542, 547, 548, 548, 543, 542, 543, 548, 549, 549, 544, 543, 544, 549, 550, 550, 545, 544, 545, 550, 551, 551, 546, 545, 546, 551, 461, 425, 431, 552, 552, 547, 425, 547, 552, 553, 553, 548, 547, 548, 553, 554, 554, 549, 548, 549, 554, 555, 555, 550, 549, 550, 555, 556, 556, 551, 550, 551, 556, 461, 431, 437, 557, 557, 552, 431, 552, 557, 558, 558, 553, 552, 553, 558, 559, 559, 554, 553, 554, 559, 560, 560, 555, 554, 555, 560, 561, 561, 556, 555, 556, 561, 461, 437, 443, 562, 562, 557, 437, 557, 562, 563, 563, 558, 557, 558, 563, 564, 564, 559, 558, 559, 564, 565, 565, 560, 559, 560, 565, 566, 566, 561, 560, 561, 566, 461, 443, 449, 567, 567, 562, 443, 562, 567, 568, 568, 563, 562, 563, 568, 569, 569, 564, 563, 564, 569, 570, 570, 565, 564, 565, 570, 571, 571, 566, 565, 566, 571, 461, 449, 455, 572, 572, 567, 449, 567, 572, 573, 573, 568, 567, 568, 573, 574, 574, 569, 568, 569, 574, 575, 575, 570, 569, 570, 575, 576, 576, 571, 570, 571, 576, 461, 455, 317, 456, 456, 572, 455, 572, 456, 457, 457, 573, 572, 573, 457, 458, 458, 574, 573, 574, 458, 459, 459, 575, 574, 575, 459, 460, 460, 576, 575, 576, 460, 461, 577, 584, 585, 585, 578, 577, 578, 585, 586, 586, 579, 578, 579, 586, 587, 587, 580, 579, 580, 587, 588, 588, 581, 580, 581, 588, 589, 589, 582, 581, 582,
-        589, 590, 590, 583, 582, 584, 591, 592, 592, 585, 584, 585, 592, 593, 593, 586, 585, 586, 593, 594, 594, 587, 586, 587, 594, 595, 595, 588, 587, 588, 595, 596, 596, 589, 588, 589, 596, 597, 597, 590, 589, 591, 598, 599, 599, 592, 591, 592, 599, 600, 600, 593, 592, 593, 600, 601, 601, 594, 593, 594, 601, 602, 602, 595, 594, 595, 602, 603, 603, 596, 595, 596, 603, 604, 604, 597, 596, 598, 605, 606, 606, 599, 598, 599, 606, 607, 607, 600, 599, 600, 607, 608, 608, 601, 600, 601, 608, 609, 609, 602, 601, 602, 609, 610, 610, 603, 602, 603, 610, 611, 611, 604, 603, 605, 612, 613, 613, 606, 605, 606, 613, 614, 614, 607, 606, 607, 614, 615, 615, 608, 607, 608, 615, 616, 616, 609, 608, 609, 616, 617, 617, 610, 609, 610, 617, 618, 618, 611, 610, 612, 619, 620, 620, 613, 612, 613, 620, 621, 621, 614, 613, 614, 621, 622, 622, 615, 614, 615, 622, 623, 623, 616, 615, 616, 623, 624, 624, 617, 616, 617, 624, 625, 625, 618, 617, 619, 626, 627, 627, 620, 619, 620, 627, 628, 628, 621, 620, 621, 628, 629, 629, 622, 621, 622, 629, 630, 630, 623, 622, 623, 630, 631, 631, 624, 623, 624, 631, 632, 632, 625, 624, 626, 633, 634, 634, 627, 626, 627, 634, 635, 635, 628, 627, 628, 635, 636, 636, 629, 628, 629, 636, 637, 637, 630, 629, 630, 637, 638, 638, 631, 630, 631, 638, 639, 639,
-        632, 631, 633, 640, 641, 641, 634, 633, 634, 641, 642, 642, 635, 634, 635, 642, 643, 643, 636, 635, 636, 643, 644, 644, 637, 636, 637, 644, 645, 645, 638, 637, 638, 645, 646, 646, 639, 638, 640, 647, 648, 648, 641, 640, 641, 648, 649, 649, 642, 641, 642, 649, 650, 650, 643, 642, 643, 650, 651, 651, 644, 643, 644, 651, 652, 652, 645, 644, 645, 652, 653, 653, 646, 645, 647, 654, 655, 655, 648, 647, 648, 655, 656, 656, 649, 648, 649, 656, 657, 657, 650, 649, 650, 657, 658, 658, 651, 650, 651, 658, 659, 659, 652, 651, 652, 659, 660, 660, 653, 652, 654, 577, 578, 578, 655, 654, 655, 578, 579, 579, 656, 655, 656, 579, 580, 580, 657, 656, 657, 580, 581, 581, 658, 657, 658, 581, 582, 582, 659, 658, 659, 582, 583, 583, 660, 659, 583, 590, 667, 667, 661, 583, 661, 667, 668, 668, 662, 661, 662, 668, 669, 669, 663, 662, 663, 669, 670, 670, 664, 663, 664, 670, 671, 671, 665, 664, 665, 671, 672, 672, 666, 665, 590, 597, 673, 673, 667, 590, 667, 673, 674, 674, 668, 667, 668, 674, 675, 675, 669, 668, 669, 675, 676, 676, 670, 669, 670, 676, 677, 677, 671, 670, 671, 677, 678, 678, 672, 671, 597, 604, 679, 679, 673, 597, 673, 679, 680, 680, 674, 673, 674, 680, 681, 681, 675, 674, 675, 681, 682, 682, 676, 675, 676, 682, 683, 683, 677, 676, 677, 683, 684, 684, 678, 677, 604, 611, 685, 685, 679, 604, 679, 685, 686, 686, 680, 679, 680, 686, 687, 687, 681, 680, 681, 687, 688, 688, 682, 681, 682, 688, 689, 689, 683, 682, 683, 689, 690, 690, 684, 683, 611, 618, 691, 691, 685, 611, 685, 691, 692, 692, 686, 685, 686, 692, 693, 693, 687, 686, 687, 693, 694, 694, 688, 687, 688, 694, 695, 695, 689, 688, 689, 695, 696, 696, 690, 689, 618, 625, 697, 697, 691, 618, 691, 697, 698, 698, 692, 691, 692, 698, 699, 699, 693, 692, 693, 699, 700, 700, 694, 693, 694, 700, 701, 701, 695, 694, 695, 701, 702, 702, 696, 695, 625, 632, 703, 703, 697, 625, 697, 703, 704, 704, 698, 697, 698, 704, 705, 705, 699, 698, 699, 705, 706, 706, 700, 699, 700, 706, 707, 707, 701, 700, 701, 707, 708, 708, 702, 701, 632, 639, 709, 709, 703, 632, 703, 709, 710, 710, 704, 703, 704, 710, 711, 711, 705, 704, 705, 711, 712, 712, 706, 705, 706, 712, 713, 713, 707, 706, 707, 713, 714, 714, 708, 707, 639, 646, 715, 715, 709, 639, 709, 715, 716, 716, 710, 709, 710, 716, 717, 717, 711, 710, 711, 717, 718, 718, 712, 711, 712, 718, 719, 719, 713, 712, 713, 719, 720, 720, 714, 713, 646, 653, 721, 721, 715, 646, 715, 721, 722, 722, 716, 715, 716, 722, 723, 723, 717, 716, 717, 723, 724, 724, 718, 717, 718, 724, 725, 725, 719, 718, 719, 725, 726, 726, 720, 719, 653, 660, 727, 727, 721, 653, 721, 727, 728, 728, 722, 721, 722, 728, 729, 729, 723, 722, 723, 729, 730, 730, 724, 723, 724, 730, 731, 731, 725, 724, 725, 731, 732, 732, 726, 725, 660, 583, 661, 661, 727, 660, 727, 661, 662, 662, 728, 727, 728, 662, 663, 663, 729, 728, 729, 663, 664, 664, 730, 729, 730, 664, 665, 665,
-        731, 730, 731, 665, 666, 666, 732, 731, 733, 740, 741, 741, 734, 733, 734, 741, 742, 742, 735, 734, 735, 742, 743, 743, 736, 735, 736, 743, 744, 744, 737, 736, 737, 744, 745, 745, 738, 737, 738, 745, 746, 746, 739, 738, 740, 747, 748, 748, 741, 740, 741, 748, 749, 749, 742, 741, 742, 749, 750, 750, 743, 742, 743, 750, 751, 751, 744, 743, 744, 751, 752, 752, 745, 744, 745, 752, 753, 753, 746, 745, 747, 754, 755, 755, 748, 747, 748, 755, 756, 756, 749, 748, 749, 756, 757, 757, 750, 749, 750, 757, 758, 758, 751, 750, 751, 758, 759, 759, 752, 751, 752, 759, 760, 760, 753, 752, 754, 761, 762, 762, 755, 754, 755, 762, 763, 763, 756, 755, 756, 763, 764, 764, 757, 756, 757, 764, 765, 765, 758, 757, 758, 765, 766, 766, 759, 758, 759, 766, 767, 767, 760, 759, 761, 768, 769, 769, 762, 761, 762, 769, 770, 770, 763, 762, 763, 770, 771, 771, 764, 763, 764, 771, 772, 772, 765, 764, 765, 772, 773, 773, 766, 765, 766, 773, 774, 774, 767, 766, 768, 775, 776, 776, 769, 768, 769, 776, 777, 777, 770, 769, 770, 777, 778, 778, 771, 770, 771, 778, 779, 779, 772, 771, 772, 779, 780, 780, 773, 772, 773, 780, 781, 781, 774, 773, 775, 782, 783, 783, 776, 775, 776, 783, 784, 784, 777, 776, 777, 784, 785, 785, 778, 777, 778, 785, 786, 786, 779, 778, 779, 786, 787, 787, 780, 779, 780, 787, 788, 788, 781, 780, 782, 789, 790, 790, 783, 782, 783, 790, 791, 791, 784, 783, 784, 791, 792, 792, 785, 784, 785, 792, 793, 793, 786, 785, 786, 793, 794, 794, 787, 786, 787, 794, 795, 795, 788, 787, 789, 796, 797, 797, 790, 789, 790, 797, 798, 798, 791, 790, 791, 798, 799, 799, 792, 791, 792, 799, 800, 800, 793, 792, 793, 800, 801, 801, 794, 793, 794, 801, 802, 802, 795, 794, 796, 803, 804, 804, 797, 796, 797, 804, 805, 805, 798, 797, 798, 805, 806, 806, 799, 798, 799, 806, 807, 807, 800, 799, 800, 807, 808, 808, 801, 800, 801, 808, 809, 809, 802, 801, 803, 810, 811, 811, 804, 803, 804, 811, 812, 812, 805, 804, 805, 812, 813, 813, 806, 805, 806, 813, 814, 814, 807, 806, 807, 814, 815, 815, 808, 807, 808, 815, 816, 816, 809, 808, 810, 733, 734, 734, 811, 810, 811, 734, 735, 735, 812, 811, 812, 735, 736, 736, 813, 812, 813, 736, 737, 737, 814, 813, 814, 737, 738, 738, 815, 814, 815, 738, 739, 739, 816, 815, 739, 746, 823, 823, 817, 739, 817, 823, 824, 824, 818, 817, 818, 824, 825, 825, 819, 818, 819, 825, 826, 826, 820, 819, 820, 826, 827, 827, 821, 820, 821, 827, 828, 828, 822, 821, 746, 753, 829, 829, 823, 746, 823, 829, 830, 830, 824, 823, 824, 830, 831, 831, 825, 824, 825, 831, 832, 832, 826, 825, 826, 832, 833, 833, 827, 826, 827, 833, 834, 834, 828, 827, 753, 760, 835, 835, 829, 753, 829, 835, 836, 836, 830, 829, 830, 836, 837, 837, 831, 830, 831, 837, 838, 838, 832, 831, 832, 838, 839, 839, 833, 832, 833, 839, 840, 840, 834, 833, 760, 767, 841, 841, 835, 760, 835, 841, 842, 842, 836, 835, 836, 842, 843, 843, 837, 836, 837, 843, 844, 844,
-        838, 837, 838, 844, 845, 845, 839, 838, 839, 845, 846, 846, 840, 839, 767, 774, 847, 847, 841, 767, 841, 847, 848, 848, 842, 841, 842, 848, 849, 849, 843, 842, 843, 849, 850, 850, 844, 843, 844, 850, 851, 851, 845, 844, 845, 851, 852, 852, 846, 845, 774, 781, 853, 853, 847, 774, 847, 853, 854, 854, 848, 847, 848, 854, 855, 855, 849, 848, 849, 855, 856, 856, 850, 849, 850, 856, 857, 857, 851, 850, 851, 857, 858, 858, 852, 851, 781, 788, 859, 859, 853, 781, 853, 859, 860, 860, 854, 853, 854, 860, 861, 861, 855, 854, 855, 861, 862, 862, 856, 855, 856, 862, 863, 863, 857, 856, 857, 863, 864, 864, 858, 857, 788, 795, 865, 865, 859, 788, 859, 865, 866, 866, 860, 859, 860, 866, 867, 867, 861, 860, 861, 867, 868, 868, 862, 861, 862, 868, 869, 869, 863, 862, 863, 869, 870, 870, 864, 863, 795, 802, 871, 871, 865, 795, 865, 871, 872, 872, 866, 865, 866, 872, 873, 873, 867, 866, 867, 873, 874, 874, 868, 867, 868, 874, 875, 875, 869, 868, 869, 875, 876, 876, 870, 869, 802, 809, 877, 877, 871, 802, 871, 877, 878, 878, 872, 871, 872, 878, 879, 879, 873, 872, 873, 879, 880, 880, 874, 873, 874, 880, 881, 881, 875, 874, 875, 881, 882, 882, 876, 875, 809, 816, 883, 883, 877, 809, 877, 883, 884, 884, 878, 877, 878, 884, 885, 885, 879, 878, 879, 885, 886, 886, 880, 879, 880, 886, 887, 887, 881, 880, 881, 887, 888, 888, 882, 881, 816, 739, 817, 817, 883, 816, 883, 817, 818, 818, 884, 883, 884, 818, 819, 819, 885, 884, 885, 819, 820, 820, 886, 885, 886, 820, 821, 821, 887, 886, 887, 821, 822, 822, 888, 887, 896, 890, 889, 890, 896, 897, 897, 891, 890, 891, 897, 898, 898, 892, 891, 892, 898, 899, 899, 893, 892, 893, 899, 900, 900, 894, 893, 894, 900, 901, 901, 895, 894, 902, 896, 889, 896, 902, 903, 903, 897, 896, 897, 903, 904, 904, 898, 897,
-        898, 904, 905, 905, 899, 898, 899, 905, 906, 906, 900, 899, 900, 906, 907, 907, 901, 900, 908, 902, 889, 902, 908, 909, 909, 903, 902, 903, 909, 910, 910, 904, 903, 904, 910, 911, 911, 905, 904, 905, 911, 912, 912, 906, 905, 906, 912, 913, 913, 907, 906, 914, 908, 889, 908, 914, 915, 915, 909, 908, 909, 915, 916, 916, 910, 909, 910, 916, 917, 917, 911, 910, 911, 917, 918, 918, 912, 911, 912, 918, 919, 919, 913, 912, 920, 914, 889, 914, 920, 921, 921, 915, 914, 915, 921, 922, 922, 916, 915, 916, 922, 923, 923, 917, 916, 917, 923, 924, 924, 918, 917, 918, 924, 925, 925, 919, 918, 926, 920, 889, 920, 926, 927, 927, 921, 920, 921, 927, 928, 928, 922, 921, 922, 928, 929, 929, 923, 922, 923, 929, 930, 930, 924, 923, 924, 930, 931, 931, 925, 924, 932, 926, 889, 926, 932, 933, 933, 927, 926, 927, 933, 934, 934, 928, 927, 928, 934, 935, 935, 929, 928, 929, 935, 936, 936, 930, 929, 930, 936, 937, 937, 931, 930, 938, 932, 889, 932, 938, 939, 939, 933, 932, 933, 939, 940, 940, 934, 933, 934, 940, 941, 941, 935, 934, 935, 941, 942, 942, 936, 935, 936, 942, 943, 943, 937, 936, 944, 938, 889, 938, 944, 945, 945, 939, 938, 939, 945, 946, 946, 940, 939, 940, 946, 947, 947, 941, 940, 941, 947, 948, 948, 942, 941, 942, 948, 949, 949, 943, 942, 950, 944, 889, 944, 950, 951, 951, 945, 944, 945, 951, 952, 952, 946, 945, 946, 952, 953, 953, 947, 946, 947, 953, 954, 954, 948, 947, 948, 954, 955, 955, 949, 948, 956, 950, 889, 950, 956, 957, 957, 951, 950, 951, 957, 958, 958, 952, 951, 952, 958, 959, 959, 953, 952, 953, 959, 960, 960, 954, 953, 954, 960, 961, 961, 955, 954, 962,
-        956, 889, 956, 962, 963, 963, 957, 956, 957, 963, 964, 964, 958, 957, 958, 964, 965, 965, 959, 958, 959, 965, 966, 966, 960, 959, 960, 966, 967, 967, 961, 960, 968, 962, 889, 962, 968, 969, 969, 963, 962, 963, 969, 970, 970, 964, 963, 964, 970, 971, 971, 965, 964, 965, 971, 972, 972, 966, 965, 966, 972, 973, 973, 967, 966, 974, 968, 889, 968, 974, 975, 975, 969, 968, 969, 975, 976, 976, 970, 969, 970, 976, 977, 977, 971, 970, 971, 977, 978, 978, 972, 971, 972, 978, 979, 979, 973, 972, 980, 974, 889, 974, 980, 981, 981, 975, 974, 975, 981, 982, 982, 976, 975, 976, 982, 983, 983, 977, 976, 977, 983, 984, 984, 978, 977, 978, 984, 985, 985, 979, 978, 986, 980, 889, 980, 986, 987, 987, 981, 980, 981, 987, 988, 988, 982, 981, 982, 988, 989, 989, 983, 982, 983, 989, 990, 990, 984, 983, 984, 990, 991, 991, 985, 984, 992, 986, 889, 986, 992, 993, 993, 987, 986, 987, 993, 994, 994, 988, 987, 988, 994, 995, 995, 989, 988, 989, 995, 996, 996, 990, 989, 990, 996, 997, 997, 991, 990, 998, 992, 889, 992, 998, 999, 999, 993, 992, 993, 999, 1000, 1000, 994, 993, 994, 1000, 1001, 1001, 995, 994, 995, 1001, 1002, 1002, 996, 995, 996, 1002, 1003, 1003, 997, 996, 1004, 998, 889, 998, 1004, 1005, 1005, 999, 998, 999, 1005, 1006, 1006, 1000, 999, 1000, 1006, 1007, 1007, 1001, 1000, 1001, 1007, 1008, 1008, 1002, 1001, 1002, 1008, 1009, 1009, 1003, 1002, 1010, 1004, 889, 1004, 1010, 1011, 1011, 1005, 1004, 1005, 1011, 1012, 1012, 1006, 1005, 1006, 1012, 1013, 1013, 1007, 1006, 1007, 1013, 1014, 1014, 1008, 1007, 1008, 1014, 1015, 1015, 1009, 1008, 1016, 1010, 889, 1010, 1016, 1017, 1017, 1011, 1010, 1011, 1017, 1018, 1018, 1012, 1011, 1012, 1018, 1019, 1019, 1013, 1012, 1013, 1019, 1020, 1020, 1014, 1013, 1014, 1020, 1021, 1021, 1015, 1014, 1022,
-        1016, 889, 1016, 1022, 1023, 1023, 1017, 1016, 1017, 1023, 1024, 1024, 1018, 1017, 1018, 1024, 1025, 1025, 1019, 1018, 1019, 1025, 1026, 1026, 1020, 1019, 1020, 1026, 1027, 1027, 1021, 1020, 1028, 1022, 889, 1022, 1028, 1029, 1029, 1023, 1022, 1023, 1029, 1030, 1030, 1024, 1023, 1024, 1030, 1031, 1031, 1025, 1024, 1025, 1031, 1032, 1032, 1026, 1025, 1026, 1032, 1033, 1033, 1027, 1026, 890, 1028, 889, 1028, 890, 891, 891, 1029, 1028, 1029, 891, 892, 892, 1030, 1029, 1030, 892, 893, 893, 1031, 1030, 1031, 893, 894, 894, 1032, 1031, 1032, 894, 895, 895, 1033, 1032, 895, 901, 1040, 1040, 1034, 895, 1034, 1040, 1041, 1041, 1035, 1034, 1035, 1041, 1042, 1042, 1036, 1035, 1036, 1042, 1043, 1043, 1037, 1036, 1037, 1043, 1044, 1044, 1038, 1037, 1038, 1044, 1045, 1045, 1039, 1038, 901, 907, 1046, 1046, 1040, 901, 1040, 1046, 1047, 1047, 1041, 1040, 1041, 1047, 1048, 1048, 1042, 1041, 1042, 1048, 1049, 1049, 1043, 1042, 1043, 1049, 1050, 1050, 1044, 1043, 1044, 1050, 1051, 1051, 1045, 1044, 907, 913, 1052, 1052, 1046, 907, 1046, 1052, 1053, 1053, 1047, 1046, 1047, 1053, 1054, 1054, 1048, 1047, 1048,
-        1054, 1055, 1055, 1049, 1048, 1049, 1055, 1056, 1056, 1050, 1049, 1050, 1056, 1057, 1057, 1051, 1050, 913, 919, 1058, 1058, 1052, 913, 1052, 1058, 1059, 1059, 1053, 1052, 1053, 1059, 1060, 1060, 1054, 1053, 1054, 1060, 1061, 1061, 1055, 1054, 1055, 1061, 1062, 1062, 1056, 1055, 1056, 1062, 1063, 1063, 1057, 1056, 919, 925, 1064, 1064, 1058, 919, 1058, 1064, 1065, 1065, 1059, 1058, 1059, 1065, 1066, 1066, 1060, 1059, 1060, 1066, 1067, 1067, 1061, 1060, 1061, 1067, 1068, 1068, 1062, 1061, 1062, 1068, 1069, 1069, 1063, 1062, 925, 931, 1070, 1070, 1064, 925, 1064, 1070, 1071, 1071, 1065, 1064, 1065, 1071, 1072, 1072, 1066, 1065, 1066, 1072, 1073, 1073, 1067, 1066, 1067, 1073, 1074, 1074, 1068, 1067, 1068, 1074, 1075, 1075, 1069, 1068, 931, 937, 1076, 1076, 1070, 931, 1070, 1076, 1077, 1077, 1071, 1070, 1071, 1077, 1078, 1078, 1072, 1071, 1072, 1078, 1079, 1079, 1073, 1072, 1073, 1079, 1080, 1080, 1074, 1073, 1074, 1080, 1081, 1081, 1075, 1074, 937, 943, 1082, 1082, 1076, 937, 1076, 1082, 1083, 1083, 1077, 1076, 1077, 1083, 1084, 1084, 1078, 1077, 1078, 1084, 1085, 1085, 1079, 1078, 1079, 1085,
-        1086, 1086, 1080, 1079, 1080, 1086, 1087, 1087, 1081, 1080, 943, 949, 1088, 1088, 1082, 943, 1082, 1088, 1089, 1089, 1083, 1082, 1083, 1089, 1090, 1090, 1084, 1083, 1084, 1090, 1091, 1091, 1085, 1084, 1085, 1091, 1092, 1092, 1086, 1085, 1086, 1092, 1093, 1093, 1087, 1086, 949, 955, 1094, 1094, 1088, 949, 1088, 1094, 1095, 1095, 1089, 1088, 1089, 1095, 1096, 1096, 1090, 1089, 1090, 1096, 1097, 1097, 1091, 1090, 1091, 1097, 1098, 1098, 1092, 1091, 1092, 1098, 1099, 1099, 1093, 1092, 955, 961, 1100, 1100, 1094, 955, 1094, 1100, 1101, 1101, 1095, 1094, 1095, 1101, 1102, 1102, 1096, 1095, 1096, 1102, 1103, 1103, 1097, 1096, 1097, 1103, 1104, 1104, 1098, 1097, 1098, 1104, 1105, 1105, 1099, 1098, 961, 967, 1106, 1106, 1100, 961, 1100, 1106, 1107, 1107, 1101, 1100, 1101, 1107, 1108, 1108, 1102, 1101, 1102, 1108, 1109, 1109, 1103, 1102, 1103, 1109, 1110, 1110, 1104, 1103, 1104, 1110, 1111, 1111, 1105, 1104, 967, 973, 1112, 1112, 1106, 967, 1106, 1112, 1113, 1113, 1107, 1106, 1107, 1113, 1114, 1114, 1108, 1107, 1108, 1114, 1115, 1115, 1109, 1108, 1109, 1115, 1116, 1116, 1110, 1109, 1110, 1116, 1117,
-        1117, 1111, 1110, 973, 979, 1118, 1118, 1112, 973, 1112, 1118, 1119, 1119, 1113, 1112, 1113, 1119, 1120, 1120, 1114, 1113, 1114, 1120, 1121, 1121, 1115, 1114, 1115, 1121, 1122, 1122, 1116, 1115, 1116, 1122, 1123, 1123, 1117, 1116, 979, 985, 1124, 1124, 1118, 979, 1118, 1124, 1125, 1125, 1119, 1118, 1119, 1125, 1126, 1126, 1120, 1119, 1120, 1126, 1127, 1127, 1121, 1120, 1121, 1127, 1128, 1128, 1122, 1121, 1122, 1128, 1129, 1129, 1123, 1122, 985, 991, 1130, 1130, 1124, 985, 1124, 1130, 1131, 1131, 1125, 1124, 1125, 1131, 1132, 1132, 1126, 1125, 1126, 1132, 1133, 1133, 1127, 1126, 1127, 1133, 1134, 1134, 1128, 1127, 1128, 1134, 1135, 1135, 1129, 1128, 991, 997, 1136, 1136, 1130, 991, 1130, 1136, 1137, 1137, 1131, 1130, 1131, 1137, 1138, 1138, 1132, 1131, 1132, 1138, 1139, 1139, 1133, 1132, 1133, 1139, 1140, 1140, 1134, 1133, 1134, 1140, 1141, 1141, 1135, 1134, 997, 1003, 1142, 1142, 1136, 997, 1136, 1142, 1143, 1143, 1137, 1136, 1137, 1143, 1144, 1144, 1138, 1137, 1138, 1144, 1145, 1145, 1139, 1138, 1139, 1145, 1146, 1146, 1140, 1139, 1140, 1146, 1147, 1147, 1141, 1140, 1003, 1009, 1148, 1148,
-        1142, 1003, 1142, 1148, 1149, 1149, 1143, 1142, 1143, 1149, 1150, 1150, 1144, 1143, 1144, 1150, 1151, 1151, 1145, 1144, 1145, 1151, 1152, 1152, 1146, 1145, 1146, 1152, 1153, 1153, 1147, 1146, 1009, 1015, 1154, 1154, 1148, 1009, 1148, 1154, 1155, 1155, 1149, 1148, 1149, 1155, 1156, 1156, 1150, 1149, 1150, 1156, 1157, 1157, 1151, 1150, 1151, 1157, 1158, 1158, 1152, 1151, 1152, 1158, 1159, 1159, 1153, 1152, 1015, 1021, 1160, 1160, 1154, 1015, 1154, 1160, 1161, 1161, 1155, 1154, 1155, 1161, 1162, 1162, 1156, 1155, 1156, 1162, 1163, 1163, 1157, 1156, 1157, 1163, 1164, 1164, 1158, 1157, 1158, 1164, 1165, 1165, 1159, 1158, 1021, 1027, 1166, 1166, 1160, 1021, 1160, 1166, 1167, 1167, 1161, 1160, 1161, 1167, 1168, 1168, 1162, 1161, 1162, 1168, 1169, 1169, 1163, 1162, 1163, 1169, 1170, 1170, 1164, 1163, 1164, 1170, 1171, 1171, 1165, 1164, 1027, 1033, 1172, 1172, 1166, 1027, 1166, 1172, 1173, 1173, 1167, 1166, 1167, 1173, 1174, 1174, 1168, 1167, 1168, 1174, 1175, 1175, 1169, 1168, 1169, 1175, 1176, 1176, 1170, 1169, 1170, 1176, 1177, 1177, 1171, 1170, 1033, 895, 1034, 1034, 1172, 1033, 1172, 1034, 1035,
-        1035, 1173, 1172, 1173, 1035, 1036, 1036, 1174, 1173, 1174, 1036, 1037, 1037, 1175, 1174, 1175, 1037, 1038, 1038, 1176, 1175, 1176, 1038, 1039, 1039, 1177, 1176
-    };
-
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace TeapotModel
+{
+    using glm::vec3;
+    struct Vertex {
+        vec3 Position;
+        vec3 Normal;
+
+        Vertex(float px, float py, float pz, float nx, float ny, float nz) : Position(px, py, pz), Normal(nx, ny, nz) { }
+    };
+
+    static Vertex TeapotVerticesPN[] = {
+        Vertex(0.6788729f, 0.330678f, 0.0f, -0.9457507f, -0.3222559f, -0.04130899f),
+        Vertex(0.669556f, 0.358022f, 0.0f, -0.992771f, -0.120019f, -0.001089f),
+        Vertex(0.6710029f, 0.374428f, 0.0f, -0.8427508f, 0.5381688f, 0.012052f),
+        Vertex(0.6804349f, 0.379897f, 0.0f, -0.08358802f, 0.9962882f, 0.02056001f),
+        Vertex(0.6950769f, 0.374428f, 0.0f, 0.5321701f, 0.8466032f, 0.007614002f),
+        Vertex(0.712148f, 0.358022f, 0.0f, 0.7793002f, 0.6266412f, 0.003491001f),
+        Vertex(0.728873f, 0.330678f, 0.0f, 0.879896f, 0.475165f, 0.001103f),
+        Vertex(0.6542429f, 0.330678f, 0.187963f,-0.9024127f, -0.3227829f, -0.2854159f),
+        Vertex(0.645254f, 0.358022f, 0.185461f,-0.9585577f, -0.120097f, -0.2583479f),
+        Vertex(0.64665f, 0.374428f, 0.18585f, -0.8168749f, 0.5385789f, -0.206514f),
+        Vertex(0.6557509f, 0.379897f, 0.188383f,-0.08619004f, 0.9962775f, -0.001604001f),
+        Vertex(0.6698769f, 0.374428f, 0.192314f,0.5114839f, 0.8469418f, 0.145167f),
+        Vertex(0.686348f, 0.358022f, 0.196898f,0.7513633f, 0.6271642f, 0.2052271f),
+        Vertex(0.702484f, 0.330678f, 0.201389f,0.8492812f, 0.4756821f, 0.2290151f),
+        Vertex(0.5845019f, 0.330678f, 0.355704f,-0.7974489f, -0.323303f, -0.5094609f),
+        Vertex(0.5764409f, 0.358022f, 0.350969f,-0.8586246f, -0.1203279f, -0.4982818f),
+        Vertex(0.5776929f, 0.374428f, 0.351704f,-0.7350169f, 0.5389569f, -0.411431f),
+        Vertex(0.5858539f, 0.379897f, 0.356498f,-0.08258003f, 0.9962944f, -0.02404301f),
+        Vertex(0.5985219f, 0.374428f, 0.363938f,0.4557349f, 0.8473518f, 0.272581f),
+        Vertex(0.6132919f, 0.358022f, 0.372613f,0.6718558f, 0.6278678f, 0.3929269f),
+        Vertex(0.627762f, 0.330678f, 0.381111f,0.7603989f, 0.476384f, 0.44142f),
+        Vertex(0.475873f, 0.330678f, 0.497f, -0.6393409f, -0.323439f, -0.6975889f),
+        Vertex(0.469258f, 0.358022f, 0.490385f,-0.7011832f, -0.120461f, -0.7027312f),
+        Vertex(0.470285f, 0.374428f, 0.491412f,-0.60404f, 0.539064f, -0.58698f),
+        Vertex(0.476982f, 0.379897f, 0.498109f,-0.07339898f, 0.9963088f, -0.04451099f),
+        Vertex(0.487377f, 0.374428f, 0.5085049f,0.3699249f, 0.8474988f, 0.3806589f),
+        Vertex(0.499498f, 0.358022f, 0.5206259f,0.5477221f, 0.6281432f, 0.5526631f),
+        Vertex(0.5113729f, 0.330678f, 0.5325f,0.6208259f, 0.4766599f, 0.6223909f),
+        Vertex(0.334576f, 0.330678f, 0.6056299f,-0.437782f, -0.323142f, -0.839003f),
+        Vertex(0.329842f, 0.358022f, 0.5975689f,-0.4963727f, -0.1204369f, -0.8597144f),
+        Vertex(0.330577f, 0.374428f, 0.5988199f,-0.4324432f, 0.5388762f, -0.7229143f),
+        Vertex(0.33537f, 0.379897f, 0.6069819f,-0.059523f, 0.996312f, -0.061801f),
+        Vertex(0.34281f, 0.374428f, 0.6196489f,0.259388f, 0.8473261f, 0.4634181f),
+        Vertex(0.351485f, 0.358022f, 0.634419f,0.3868439f, 0.6278797f, 0.6753657f),
+        Vertex(0.359984f, 0.330678f, 0.6488889f,0.439492f, 0.4763981f, 0.7615061f),
+        Vertex(0.166836f, 0.330678f, 0.6753699f,-0.2046809f, -0.3225468f, -0.9241586f),
+        Vertex(0.164334f, 0.358022f, 0.6663809f,-0.2562089f, -0.1202569f, -0.9591116f),
+        Vertex(0.164722f, 0.374428f, 0.6677769f,-0.230122f, 0.538458f, -0.8106211f),
+        Vertex(0.167255f, 0.379897f, 0.6768779f,-0.04166798f, 0.9963036f, -0.07511897f),
+        Vertex(0.171187f, 0.374428f, 0.6910039f,0.1303f, 0.8469041f, 0.515534f),
+        Vertex(0.175771f, 0.358022f, 0.7074749f,0.1983909f, 0.6271816f, 0.7531826f),
+        Vertex(0.180262f, 0.330678f, 0.7236109f,0.226852f, 0.4757029f, 0.8498498f),
+        Vertex(-0.021127f, 0.330678f, 0.6999999f,0.03594102f, -0.3302142f, -0.9432215f),
+        Vertex(-0.021127f, 0.358022f, 0.6906829f,-0.001376f, -0.125569f, -0.9920838f),
+        Vertex(-0.021127f, 0.374428f, 0.69213f,-0.012701f, 0.5357922f, -0.8442543f),
+        Vertex(-0.021127f, 0.379897f, 0.7015629f,-0.02067201f, 0.9963434f, -0.08290103f),
+        Vertex(-0.021127f, 0.374428f, 0.7162039f,-0.007570999f, 0.8464268f, 0.5324509f),
+        Vertex(-0.021127f, 0.358022f, 0.7332759f,-0.003481999f, 0.6266079f, 0.7793269f),
+        Vertex(-0.021127f, 0.330678f, 0.7499999f,-0.001103f, 0.475165f, 0.879896f),
+        Vertex(-0.224715f, 0.330678f, 0.6753699f,0.269574f, -0.3869541f, -0.8818142f),
+        Vertex(-0.215631f, 0.358022f, 0.6663809f,0.249993f, -0.181783f, -0.9510301f),
+        Vertex(-0.211606f, 0.374428f, 0.6677769f,0.211872f, 0.499984f, -0.8397179f),
+        Vertex(-0.211463f, 0.379897f, 0.6768779f,0.002768f, 0.9957681f, -0.09185901f),
+        Vertex(-0.21402f, 0.374428f, 0.6910039f,-0.1464459f, 0.8441496f, 0.5157177f),
+        Vertex(-0.218098f, 0.358022f, 0.7074749f,-0.2054971f, 0.6259093f, 0.7523354f),
+        Vertex(-0.222516f, 0.330678f, 0.7236109f,-0.229034f, 0.4755359f, 0.8493578f),
+        Vertex(-0.396831f, 0.330678f, 0.6056299f,0.4828537f, -0.4459237f, -0.7536605f),
+        Vertex(-0.383671f, 0.358022f, 0.5975689f,0.4838833f, -0.2615992f, -0.8351185f),
+        Vertex(-0.378758f, 0.374428f, 0.5988199f,0.4423379f, 0.4340159f, -0.7848359f),
+        Vertex(-0.380125f, 0.379897f, 0.6069819f,0.03667998f, 0.9935015f, -0.1077459f),
+        Vertex(-0.385806f, 0.374428f, 0.6196489f,-0.2785098f, 0.8399482f, 0.4657456f),
+        Vertex(-0.393832f, 0.358022f, 0.634419f,-0.39439f, 0.6241421f, 0.6744651f),
+        Vertex(-0.402238f, 0.330678f, 0.6488889f,-0.4415409f, 0.4759128f, 0.7606238f),
+        Vertex(-0.5350019f, 0.330678f, 0.497f,0.669165f, -0.453044f, -0.5890409f),
+        Vertex(-0.521278f, 0.358022f, 0.490385f,0.6864011f, -0.28753f, -0.6679671f),
+        Vertex(-0.517539f, 0.374428f, 0.491412f,0.643212f, 0.404496f, -0.650124f),
+        Vertex(-0.5213459f, 0.379897f, 0.498109f,0.07460403f, 0.9914605f, -0.1069591f),
+        Vertex(-0.5302569f, 0.374428f, 0.5085049f, -0.391289f, 0.8379869f, 0.380356f),
+        Vertex(-0.541831f, 0.358022f, 0.5206259f,-0.5554837f, 0.6231316f, 0.5505857f),
+        Vertex(-0.553627f, 0.330678f, 0.5325f,-0.6226361f, 0.4760081f, 0.6210801f),
+        Vertex(-0.636757f, 0.330678f, 0.355704f,0.8217878f, -0.4077159f, -0.3980359f),
+        Vertex(-0.6244829f, 0.358022f, 0.350969f,0.8498941f, -0.24443f, -0.4668341f),
+        Vertex(-0.62291f, 0.374428f, 0.351704f,0.7780953f, 0.4358042f, -0.4523742f),
+        Vertex(-0.6293589f, 0.379897f, 0.356498f,0.09545795f, 0.9921145f, -0.08121795f),
+        Vertex(-0.6411459f, 0.374428f, 0.363938f,-0.4736589f, 0.8398708f, 0.2650739f),
+        Vertex(-0.6555929f, 0.358022f, 0.372613f,-0.6782652f, 0.6237241f, 0.3884901f),
+        Vertex(-0.6700159f, 0.330678f, 0.381111f,-0.7617679f, 0.4758419f, 0.4396409f),
+        Vertex(-0.6996229f, 0.330678f, 0.187963f,0.9191499f, -0.348512f, -0.183583f),
+        Vertex(-0.6893169f, 0.358022f, 0.185461f,0.9562184f, -0.1711391f, -0.2373981f),
+        Vertex(-0.6898299f, 0.374428f, 0.18585f,0.8388228f, 0.4938979f, -0.229f),
+        Vertex(-0.698396f, 0.379897f, 0.188382f,0.09432202f, 0.9944041f, -0.04757801f),
+        Vertex(-0.712247f, 0.374428f, 0.192314f,-0.52064f, 0.843596f, 0.131452f),
+        Vertex(-0.728617f, 0.358022f, 0.196898f,-0.7547529f, 0.6251799f, 0.198741f),
+        Vertex(-0.7447379f, 0.330678f, 0.201389f,-0.8499968f, 0.4754259f, 0.226882f),
+        Vertex(-0.7211269f, 0.330678f, 0.0f,   0.9455373f, -0.3221831f, 0.04644601f),
+        Vertex(-0.7118099f, 0.358022f, 0.0f,   0.9918807f, -0.126966f, 0.007215998f),
+        Vertex(-0.713257f, 0.374428f, 0.0f,   0.8475716f, 0.5306047f, -0.008995995f),
+        Vertex(-0.7226899f, 0.379897f, 0.0f,   0.08787897f, 0.9959177f, -0.02061499f),
+        Vertex(-0.7373309f, 0.374428f, 0.0f,   -0.5330627f, 0.8460405f, -0.007710996f),
+        Vertex(-0.7544029f, 0.358022f, 0.0f,   -0.7796119f, 0.6262529f, -0.003531999f),
+        Vertex(-0.7711269f, 0.330678f, 0.0f,   -0.8799261f, 0.4751091f, -0.001109f),
+        Vertex(-0.6964979f, 0.330678f, -0.187963f,   0.9024127f, -0.3227829f, 0.2854159f),
+        Vertex(-0.6875079f, 0.358022f, -0.185461f,   0.9585577f, -0.120097f, 0.2583479f),
+        Vertex(-0.6889039f, 0.374428f, -0.18585f,0.8168749f, 0.5385789f, 0.206514f),
+        Vertex(-0.698005f, 0.379897f, -0.188383f,0.08619004f, 0.9962775f, 0.001604001f),
+        Vertex(-0.712131f, 0.374428f, -0.192314f,-0.5114839f, 0.8469418f, -0.145167f),
+        Vertex(-0.7286019f, 0.358022f, -0.196898f,   -0.7513633f, 0.6271642f, -0.2052271f),
+        Vertex(-0.7447379f, 0.330678f, -0.201389f,   -0.8492812f, 0.4756821f, -0.2290151f),
+        Vertex(-0.626757f, 0.330678f, -0.355704f,0.7974489f, -0.323303f, 0.5094609f),
+        Vertex(-0.6186959f, 0.358022f, -0.350969f,   0.8586246f, -0.1203279f, 0.4982818f),
+        Vertex(-0.619948f, 0.374428f, -0.351704f,0.7350169f, 0.5389569f, 0.411431f),
+        Vertex(-0.6281089f, 0.379897f, -0.356498f,   0.08258003f, 0.9962944f, 0.02404301f),
+        Vertex(-0.6407759f, 0.374428f, -0.363938f,   -0.4557349f, 0.8473518f, -0.272581f),
+        Vertex(-0.6555459f, 0.358022f, -0.372613f,   -0.6718558f, 0.6278678f, -0.3929269f),
+        Vertex(-0.6700159f, 0.330678f, -0.381111f,   -0.7603989f, 0.476384f, -0.44142f),
+        Vertex(-0.518127f, 0.330678f, -0.497f,0.6393409f, -0.323439f, 0.6975889f),
+        Vertex(-0.5115119f, 0.358022f, -0.490385f,   0.7011832f, -0.120461f, 0.7027312f),
+        Vertex(-0.512539f, 0.374428f, -0.491412f,0.60404f, 0.539064f, 0.58698f),
+        Vertex(-0.5192369f, 0.379897f, -0.498109f,   0.07339898f, 0.9963088f, 0.04451099f),
+        Vertex(-0.5296319f, 0.374428f, -0.5085049f,   -0.3699249f, 0.8474988f, -0.3806589f),
+        Vertex(-0.5417529f, 0.358022f, -0.5206259f,   -0.5477221f, 0.6281432f, -0.5526631f),
+        Vertex(-0.553627f, 0.330678f, -0.5325f,-0.6208259f, 0.4766599f, -0.6223909f),
+        Vertex(-0.376831f, 0.330678f, -0.6056299f,   0.437782f, -0.323142f, 0.839003f),
+        Vertex(-0.372096f, 0.358022f, -0.5975689f,   0.4963727f, -0.1204369f, 0.8597144f),
+        Vertex(-0.372832f, 0.374428f, -0.5988199f,   0.4324432f, 0.5388762f, 0.7229143f),
+        Vertex(-0.377625f, 0.379897f, -0.6069819f,   0.059523f, 0.996312f, 0.061801f),
+        Vertex(-0.385065f, 0.374428f, -0.6196489f,   -0.259388f, 0.8473261f, -0.4634181f),
+        Vertex(-0.39374f, 0.358022f, -0.634419f,-0.3868439f, 0.6278797f, -0.6753657f),
+        Vertex(-0.402238f, 0.330678f, -0.6488889f,   -0.439492f, 0.4763981f, -0.7615061f),
+        Vertex(-0.20909f, 0.330678f, -0.6753699f,0.2046809f, -0.3225468f, 0.9241586f),
+        Vertex(-0.206588f, 0.358022f, -0.6663809f,   0.2562089f, -0.1202569f, 0.9591116f),
+        Vertex(-0.206977f, 0.374428f, -0.6677769f,   0.230122f, 0.538458f, 0.8106211f),
+        Vertex(-0.20951f, 0.379897f, -0.6768779f,0.04166798f, 0.9963036f, 0.07511897f),
+        Vertex(-0.213441f, 0.374428f, -0.6910039f,   -0.1303f, 0.8469041f, -0.515534f),
+        Vertex(-0.218025f, 0.358022f, -0.7074749f,   -0.1983909f, 0.6271816f, -0.7531826f),
+        Vertex(-0.222516f, 0.330678f, -0.7236109f,   -0.226852f, 0.4757029f, -0.8498498f),
+        Vertex(-0.021127f, 0.330678f, -0.6999999f,   -0.04130899f, -0.3222559f, 0.9457507f),
+        Vertex(-0.021127f, 0.358022f, -0.6906829f,   -0.001089f, -0.120019f, 0.9927709f),
+        Vertex(-0.021127f, 0.374428f, -0.69213f,0.012052f, 0.5381688f, 0.8427508f),
+        Vertex(-0.021127f, 0.379897f, -0.7015629f,   0.02056001f, 0.9962882f, 0.08358802f),
+        Vertex(-0.021127f, 0.374428f, -0.7162039f,   0.007614002f, 0.8466032f, -0.5321701f),
+        Vertex(-0.021127f, 0.358022f, -0.7332759f,   0.003491001f, 0.6266412f, -0.7793002f),
+        Vertex(-0.021127f, 0.330678f, -0.7499999f,   0.001103f, 0.475165f, -0.879896f),
+        Vertex(0.166836f, 0.330678f, -0.6753699f,-0.2854159f, -0.3227829f, 0.9024127f),
+        Vertex(0.164334f, 0.358022f, -0.6663809f,-0.2583479f, -0.120097f, 0.9585577f),
+        Vertex(0.164722f, 0.374428f, -0.6677769f,-0.206514f, 0.5385789f, 0.8168749f),
+        Vertex(0.167255f, 0.379897f, -0.6768779f,-0.001604001f, 0.9962775f, 0.08619004f),
+        Vertex(0.171187f, 0.374428f, -0.6910039f,0.145167f, 0.8469418f, -0.5114839f),
+        Vertex(0.175771f, 0.358022f, -0.7074749f,0.2052271f, 0.6271642f, -0.7513633f),
+        Vertex(0.180262f, 0.330678f, -0.7236109f,0.2290151f, 0.4756821f, -0.8492812f),
+        Vertex(0.334576f, 0.330678f, -0.6056299f,-0.5094609f, -0.323303f, 0.7974489f),
+        Vertex(0.329842f, 0.358022f, -0.5975689f,-0.4982818f, -0.1203279f, 0.8586246f),
+        Vertex(0.330577f, 0.374428f, -0.5988199f,-0.411431f, 0.5389569f, 0.7350169f),
+        Vertex(0.33537f, 0.379897f, -0.6069819f,-0.02404301f, 0.9962944f, 0.08258003f),
+        Vertex(0.34281f, 0.374428f, -0.6196489f,0.272581f, 0.8473518f, -0.4557349f),
+        Vertex(0.351485f, 0.358022f, -0.634419f,0.3929269f, 0.6278678f, -0.6718558f),
+        Vertex(0.359984f, 0.330678f, -0.6488889f,0.44142f, 0.476384f, -0.760399f),
+        Vertex(0.475873f, 0.330678f, -0.497f,   -0.6975889f, -0.323439f, 0.6393409f),
+        Vertex(0.469258f, 0.358022f, -0.490385f,-0.7027313f, -0.120461f, 0.7011833f),
+        Vertex(0.470285f, 0.374428f, -0.491412f,-0.58698f, 0.539064f, 0.60404f),
+        Vertex(0.476982f, 0.379897f, -0.498109f,-0.04451099f, 0.9963088f, 0.07339898f),
+        Vertex(0.487377f, 0.374428f, -0.5085049f,0.3806589f, 0.8474988f, -0.3699249f),
+        Vertex(0.499498f, 0.358022f, -0.5206259f,0.5526631f, 0.6281432f, -0.5477221f),
+        Vertex(0.5113729f, 0.330678f, -0.5325f,0.6223909f, 0.4766599f, -0.6208259f),
+        Vertex(0.5845019f, 0.330678f, -0.355704f,-0.839003f, -0.323142f, 0.437782f),
+        Vertex(0.5764409f, 0.358022f, -0.350969f,-0.8597144f, -0.1204369f, 0.4963727f),
+        Vertex(0.5776929f, 0.374428f, -0.351704f,-0.7229143f, 0.5388762f, 0.4324432f),
+        Vertex(0.5858539f, 0.379897f, -0.356498f,-0.061801f, 0.996312f, 0.059523f),
+        Vertex(0.5985219f, 0.374428f, -0.363938f,0.4634181f, 0.8473261f, -0.259388f),
+        Vertex(0.6132919f, 0.358022f, -0.372613f,0.6753657f, 0.6278797f, -0.3868439f),
+        Vertex(0.627762f, 0.330678f, -0.381111f,0.7615061f, 0.4763981f, -0.439492f),
+        Vertex(0.6542429f, 0.330678f, -0.187963f,-0.9241586f, -0.3225468f, 0.2046809f),
+        Vertex(0.645254f, 0.358022f, -0.185461f,-0.9591116f, -0.1202569f, 0.2562089f),
+        Vertex(0.64665f, 0.374428f, -0.18585f,-0.8106211f, 0.538458f, 0.230122f),
+        Vertex(0.6557509f, 0.379897f, -0.188382f,-0.07511897f, 0.9963036f, 0.04166798f),
+        Vertex(0.6698769f, 0.374428f, -0.192314f,0.515534f, 0.8469041f, -0.1303f),
+        Vertex(0.686348f, 0.358022f, -0.196898f,0.7531826f, 0.6271816f, -0.1983909f),
+        Vertex(0.702484f, 0.330678f, -0.201389f,0.8498498f, 0.4757029f, -0.226852f),
+        Vertex(0.790794f, 0.199602f, 0.0f,   0.9081803f, 0.4185792f, 0.0001700001f),
+        Vertex(0.8492429f, 0.06956699f, 0.0f,   0.9200605f, 0.3917758f, 0.0003349998f),
+        Vertex(0.900748f, -0.058384f, 0.0f,   0.9392541f, 0.343222f, 0.0004780001f),
+        Vertex(0.9418359f, -0.183211f, 0.0f,   0.9638073f, 0.2665991f, 0.0005520002f),
+        Vertex(0.969035f, -0.30387f, 0.0f,   0.9882613f, 0.1527721f, 0.0004490002f),
+        Vertex(0.978873f, -0.419322f, 0.0f,   0.9989327f, -0.04618698f, -0.0002619999f),
+        Vertex(0.7622269f, 0.199602f, 0.218016f,0.8768925f, 0.4190732f, 0.2354511f),
+        Vertex(0.818619f, 0.06956699f, 0.233711f,0.8883488f, 0.3922469f, 0.238702f),
+        Vertex(0.8683119f, -0.058384f, 0.247541f,0.9068913f, 0.3436481f, 0.2438321f),
+        Vertex(0.9079539f, -0.183211f, 0.258573f,0.9306441f, 0.266938f, 0.250291f),
+        Vertex(0.9341959f, -0.30387f, 0.265877f,0.9543506f, 0.1529589f, 0.2565509f),
+        Vertex(0.9436879f, -0.419322f, 0.268519f,0.9648667f, -0.04630398f, 0.2586269f),
+        Vertex(0.6813349f, 0.199602f, 0.412576f,0.785456f, 0.419734f, 0.454843f),
+        Vertex(0.7319039f, 0.06956699f, 0.442277f,   0.7957066f, 0.3928828f, 0.4609708f),
+        Vertex(0.7764649f, -0.058384f, 0.468449f,0.8123339f, 0.3442279f, 0.4707659f),
+        Vertex(0.8120139f, -0.183211f, 0.489328f,0.833667f, 0.267414f, 0.483207f),
+        Vertex(0.835546f, -0.30387f, 0.5031489f,0.8550121f, 0.15325f, 0.4954481f),
+        Vertex(0.8440579f, -0.419322f, 0.508148f,0.8646632f, -0.04637201f, 0.5002071f),
+        Vertex(0.555337f, 0.199602f, 0.5764639f,0.6415988f, 0.4199898f, 0.6418408f),
+        Vertex(0.5968359f, 0.06956699f, 0.617963f,   0.649935f, 0.39313f, 0.65041f),
+        Vertex(0.633404f, -0.058384f, 0.6545309f,0.6634937f, 0.3444569f, 0.6641727f),
+        Vertex(0.6625769f, -0.183211f, 0.683704f,0.6809247f, 0.2676069f, 0.6817096f),
+        Vertex(0.6818879f, -0.30387f, 0.703015f,0.698421f, 0.153377f, 0.699059f),
+        Vertex(0.6888729f, -0.419322f, 0.7099999f,   0.7065322f, -0.04636901f, 0.7061602f),
+        Vertex(0.391449f, 0.199602f, 0.702462f,0.4545449f, 0.4197369f, 0.7856269f),
+        Vertex(0.42115f, 0.06956699f, 0.753032f,0.4603839f, 0.3928899f, 0.7960427f),
+        Vertex(0.447322f, -0.058384f, 0.7975929f,0.4699289f, 0.3442409f, 0.8128129f),
+        Vertex(0.468201f, -0.183211f, 0.833141f,0.4822391f, 0.2674361f, 0.8342202f),
+        Vertex(0.482022f, -0.30387f, 0.856674f,0.4946598f, 0.153286f, 0.8554618f),
+        Vertex(0.487021f, -0.419322f, 0.865185f,0.5006657f, -0.04629998f, 0.8644015f),
+        Vertex(0.196889f, 0.199602f, 0.7833539f,0.235117f, 0.4190779f, 0.8769798f),
+        Vertex(0.212583f, 0.06956699f, 0.8397459f,   0.2380439f, 0.3922578f, 0.8885205f),
+        Vertex(0.226413f, -0.058384f, 0.8894389f,0.2428939f, 0.3436669f, 0.9071358f),
+        Vertex(0.237446f, -0.183211f, 0.929081f,0.249206f, 0.26697f, 0.930926f),
+        Vertex(0.24475f, -0.30387f, 0.9553229f,0.255668f, 0.153012f, 0.954579f),
+        Vertex(0.247391f, -0.419322f, 0.964815f,0.2591419f, -0.04619798f, 0.9647336f),
+        Vertex(-0.021127f, 0.199602f, 0.8119209f,-0.0001699999f, 0.4185787f, 0.9081804f),
+        Vertex(-0.021127f, 0.06956699f, 0.8703699f,   -0.0003349998f, 0.3917758f, 0.9200605f),
+        Vertex(-0.021127f, -0.058384f, 0.9218749f,   -0.0004780001f, 0.3432221f, 0.9392542f),
+        Vertex(-0.021127f, -0.183211f, 0.9629629f,   -0.0005520002f, 0.2665991f, 0.9638073f),
+        Vertex(-0.021127f, -0.30387f, 0.990162f,-0.0004490002f, 0.1527721f, 0.9882613f),
+        Vertex(-0.021127f, -0.419322f, 0.9999999f,   0.0002619999f, -0.04618698f, 0.9989327f),
+        Vertex(-0.239143f, 0.199602f, 0.7833539f,-0.2354511f, 0.4190732f, 0.8768924f),
+        Vertex(-0.254838f, 0.06956699f, 0.8397459f,   -0.238702f, 0.3922469f, 0.8883488f),
+        Vertex(-0.268668f, -0.058384f, 0.8894389f,   -0.2438321f, 0.3436481f, 0.9068913f),
+        Vertex(-0.279701f, -0.183211f, 0.929081f,-0.250291f, 0.266938f, 0.9306441f),
+        Vertex(-0.287004f, -0.30387f, 0.9553229f,-0.2565509f, 0.1529589f, 0.9543506f),
+        Vertex(-0.289646f, -0.419322f, 0.964815f,-0.2586269f, -0.04630398f, 0.9648667f),
+        Vertex(-0.433704f, 0.199602f, 0.702462f,-0.454843f, 0.419734f, 0.785456f),
+        Vertex(-0.463404f, 0.06956699f, 0.753032f,   -0.4609708f, 0.3928828f, 0.7957066f),
+        Vertex(-0.489576f, -0.058384f, 0.7975929f,   -0.4707659f, 0.3442279f, 0.8123339f),
+        Vertex(-0.510455f, -0.183211f, 0.833141f,-0.483207f, 0.267414f, 0.833667f),
+        Vertex(-0.524276f, -0.30387f, 0.856674f,-0.4954481f, 0.15325f, 0.8550121f),
+        Vertex(-0.5292749f, -0.419322f, 0.865185f,   -0.5002071f, -0.04637201f, 0.8646632f),
+        Vertex(-0.5975909f, 0.199602f, 0.5764639f,   -0.6418408f, 0.4199898f, 0.6415988f),
+        Vertex(-0.6390899f, 0.06956699f, 0.617963f,   -0.65041f, 0.39313f, 0.649935f),
+        Vertex(-0.6756579f, -0.058384f, 0.6545309f,   -0.6641727f, 0.3444569f, 0.6634937f),
+        Vertex(-0.7048309f, -0.183211f, 0.683704f,   -0.6817096f, 0.2676069f, 0.6809247f),
+        Vertex(-0.724142f, -0.30387f, 0.703015f,-0.699059f, 0.153377f, 0.698421f),
+        Vertex(-0.731127f, -0.419322f, 0.7099999f,   -0.7061602f, -0.04636901f, 0.7065322f),
+        Vertex(-0.7235889f, 0.199602f, 0.412576f,-0.7856269f, 0.4197369f, 0.4545449f),
+        Vertex(-0.774159f, 0.06956699f, 0.442277f,   -0.7960427f, 0.3928899f, 0.4603839f),
+        Vertex(-0.8187199f, -0.058384f, 0.468449f,   -0.8128129f, 0.3442409f, 0.4699289f),
+        Vertex(-0.854269f, -0.183211f, 0.489328f,-0.8342202f, 0.2674361f, 0.4822391f),
+        Vertex(-0.8778009f, -0.30387f, 0.5031489f,   -0.8554618f, 0.153286f, 0.4946598f),
+        Vertex(-0.8863119f, -0.419322f, 0.508148f,   -0.8644015f, -0.04629998f, 0.5006657f),
+        Vertex(-0.804481f, 0.199602f, 0.218016f,-0.8769798f, 0.4190779f, 0.235117f),
+        Vertex(-0.8608729f, 0.06956699f, 0.233711f,   -0.8885205f, 0.3922578f, 0.2380439f),
+        Vertex(-0.9105659f, -0.058384f, 0.24754f,-0.9071358f, 0.3436669f, 0.2428939f),
+        Vertex(-0.9502079f, -0.183211f, 0.258573f,   -0.930926f, 0.26697f, 0.249206f),
+        Vertex(-0.97645f, -0.30387f, 0.265877f,-0.954579f, 0.153012f, 0.255668f),
+        Vertex(-0.9859419f, -0.419322f, 0.268518f,   -0.9647336f, -0.04619798f, 0.2591419f),
+        Vertex(-0.8330489f, 0.199602f, 0.0f,   -0.9081804f, 0.4185787f, -0.0001699999f),
+        Vertex(-0.891498f, 0.06956699f, 0.0f,   -0.9200605f, 0.3917758f, -0.0003349998f),
+        Vertex(-0.9430019f, -0.058384f, 0.0f,   -0.9392541f, 0.343222f, -0.0004780001f),
+        Vertex(-0.9840899f, -0.183211f, 0.0f,   -0.9638073f, 0.2665991f, -0.0005520002f),
+        Vertex(-1.011289f, -0.30387f, 0.0f,   -0.9882613f, 0.1527721f, -0.0004490002f),
+        Vertex(-1.021127f, -0.419322f, 0.0f,   -0.9989327f, -0.04618698f, 0.0002619999f),
+        Vertex(-0.804481f, 0.199602f, -0.218016f,-0.8768925f, 0.4190732f, -0.2354511f),
+        Vertex(-0.8608729f, 0.06956699f, -0.233711f,   -0.8883488f, 0.3922469f, -0.238702f),
+        Vertex(-0.9105659f, -0.058384f, -0.247541f,   -0.9068913f, 0.3436481f, -0.2438321f),
+        Vertex(-0.9502079f, -0.183211f, -0.258573f,   -0.9306441f, 0.266938f, -0.250291f),
+        Vertex(-0.97645f, -0.30387f, -0.265877f,-0.9543506f, 0.1529589f, -0.2565509f),
+        Vertex(-0.9859419f, -0.419322f, -0.268519f,   -0.9648667f, -0.04630398f, -0.2586269f),
+        Vertex(-0.7235889f, 0.199602f, -0.412576f,   -0.785456f, 0.419734f, -0.454843f),
+        Vertex(-0.774159f, 0.06956699f, -0.442277f,   -0.7957066f, 0.3928828f, -0.4609708f),
+        Vertex(-0.8187199f, -0.058384f, -0.468449f,   -0.8123339f, 0.3442279f, -0.4707659f),
+        Vertex(-0.854269f, -0.183211f, -0.489328f,   -0.833667f, 0.267414f, -0.483207f),
+        Vertex(-0.8778009f, -0.30387f, -0.5031489f,   -0.8550121f, 0.15325f, -0.4954481f),
+        Vertex(-0.8863119f, -0.419322f, -0.508148f,   -0.8646632f, -0.04637201f, -0.5002071f),
+        Vertex(-0.5975909f, 0.199602f, -0.5764639f,   -0.6415988f, 0.4199898f, -0.6418408f),
+        Vertex(-0.6390899f, 0.06956699f, -0.617963f,   -0.649935f, 0.39313f, -0.65041f),
+        Vertex(-0.6756579f, -0.058384f, -0.6545309f,   -0.6634937f, 0.3444569f, -0.6641727f),
+        Vertex(-0.7048309f, -0.183211f, -0.683704f,   -0.6809247f, 0.2676069f, -0.6817096f),
+        Vertex(-0.724142f, -0.30387f, -0.703015f,-0.698421f, 0.153377f, -0.699059f),
+        Vertex(-0.731127f, -0.419322f, -0.7099999f,   -0.7065322f, -0.04636901f, -0.7061602f),
+        Vertex(-0.433704f, 0.199602f, -0.702462f,-0.4545449f, 0.4197369f, -0.7856269f),
+        Vertex(-0.463404f, 0.06956699f, -0.753032f,   -0.4603839f, 0.3928899f, -0.7960427f),
+        Vertex(-0.489576f, -0.058384f, -0.7975929f,   -0.4699289f, 0.3442409f, -0.8128129f),
+        Vertex(-0.510455f, -0.183211f, -0.833141f,   -0.4822391f, 0.2674361f, -0.8342202f),
+        Vertex(-0.524276f, -0.30387f, -0.856674f,-0.4946598f, 0.153286f, -0.8554618f),
+        Vertex(-0.5292749f, -0.419322f, -0.865185f,   -0.5006657f, -0.04629998f, -0.8644015f),
+        Vertex(-0.239143f, 0.199602f, -0.7833539f,   -0.235117f, 0.4190779f, -0.8769798f),
+        Vertex(-0.254838f, 0.06956699f, -0.8397459f,   -0.2380439f, 0.3922578f, -0.8885205f),
+        Vertex(-0.268668f, -0.058384f, -0.8894389f,   -0.2428939f, 0.3436669f, -0.9071358f),
+        Vertex(-0.279701f, -0.183211f, -0.929081f,   -0.249206f, 0.26697f, -0.930926f),
+        Vertex(-0.287004f, -0.30387f, -0.9553229f,   -0.255668f, 0.153012f, -0.954579f),
+        Vertex(-0.289646f, -0.419322f, -0.964815f,   -0.2591419f, -0.04619798f, -0.9647336f),
+        Vertex(-0.021127f, 0.199602f, -0.8119209f,   0.0001699999f, 0.4185787f, -0.9081804f),
+        Vertex(-0.021127f, 0.06956699f, -0.8703699f,   0.0003349998f, 0.3917758f, -0.9200605f),
+        Vertex(-0.021127f, -0.058384f, -0.9218749f,   0.0004780001f, 0.3432221f, -0.9392542f),
+        Vertex(-0.021127f, -0.183211f, -0.9629629f,   0.0005520002f, 0.2665991f, -0.9638073f),
+        Vertex(-0.021127f, -0.30387f, -0.990162f,0.0004490002f, 0.1527721f, -0.9882613f),
+        Vertex(-0.021127f, -0.419322f, -0.9999999f,   -0.0002619999f, -0.04618698f, -0.9989327f),
+        Vertex(0.196889f, 0.199602f, -0.7833539f,0.2354511f, 0.4190732f, -0.8768924f),
+        Vertex(0.212583f, 0.06956699f, -0.8397459f,   0.238702f, 0.3922469f, -0.8883488f),
+        Vertex(0.226413f, -0.058384f, -0.8894389f,   0.2438321f, 0.3436481f, -0.9068913f),
+        Vertex(0.237446f, -0.183211f, -0.929081f,0.250291f, 0.266938f, -0.9306441f),
+        Vertex(0.24475f, -0.30387f, -0.9553229f,0.2565509f, 0.1529589f, -0.9543506f),
+        Vertex(0.247391f, -0.419322f, -0.964815f,0.2586269f, -0.04630398f, -0.9648667f),
+        Vertex(0.391449f, 0.199602f, -0.702462f,0.454843f, 0.419734f, -0.785456f),
+        Vertex(0.42115f, 0.06956699f, -0.753032f,0.4609708f, 0.3928828f, -0.7957066f),
+        Vertex(0.447322f, -0.058384f, -0.7975929f,   0.4707659f, 0.3442279f, -0.8123339f),
+        Vertex(0.468201f, -0.183211f, -0.833141f,0.483207f, 0.267414f, -0.833667f),
+        Vertex(0.482022f, -0.30387f, -0.856674f,0.4954481f, 0.15325f, -0.8550121f),
+        Vertex(0.487021f, -0.419322f, -0.865185f,0.5002071f, -0.04637201f, -0.8646632f),
+        Vertex(0.555337f, 0.199602f, -0.5764639f,0.6418408f, 0.4199898f, -0.6415988f),
+        Vertex(0.5968359f, 0.06956699f, -0.617963f,   0.65041f, 0.39313f, -0.649935f),
+        Vertex(0.633404f, -0.058384f, -0.6545309f,   0.6641727f, 0.3444569f, -0.6634937f),
+        Vertex(0.6625769f, -0.183211f, -0.683704f,   0.6817096f, 0.2676069f, -0.6809247f),
+        Vertex(0.6818879f, -0.30387f, -0.703015f,0.699059f, 0.153377f, -0.698421f),
+        Vertex(0.6888729f, -0.419322f, -0.7099999f,   0.7061602f, -0.04636901f, -0.7065322f),
+        Vertex(0.6813349f, 0.199602f, -0.412576f,0.7856269f, 0.4197369f, -0.4545449f),
+        Vertex(0.7319039f, 0.06956699f, -0.442277f,   0.7960427f, 0.3928899f, -0.4603839f),
+        Vertex(0.7764649f, -0.058384f, -0.468449f,   0.8128129f, 0.3442409f, -0.4699289f),
+        Vertex(0.8120139f, -0.183211f, -0.489328f,   0.8342202f, 0.2674361f, -0.4822391f),
+        Vertex(0.835546f, -0.30387f, -0.5031489f,0.8554618f, 0.153286f, -0.4946598f),
+        Vertex(0.8440579f, -0.419322f, -0.508148f,   0.8644015f, -0.04629998f, -0.5006657f),
+        Vertex(0.7622269f, 0.199602f, -0.218016f,0.8769798f, 0.4190779f, -0.235117f),
+        Vertex(0.818619f, 0.06956699f, -0.233711f,   0.8885205f, 0.3922578f, -0.2380439f),
+        Vertex(0.8683119f, -0.058384f, -0.24754f,0.9071358f, 0.3436669f, -0.2428939f),
+        Vertex(0.9079539f, -0.183211f, -0.258573f,   0.930926f, 0.26697f, -0.249206f),
+        Vertex(0.9341959f, -0.30387f, -0.265877f,0.954579f, 0.153012f, -0.255668f),
+        Vertex(0.9436879f, -0.419322f, -0.268518f,   0.9647336f, -0.04619798f, -0.2591419f),
+        Vertex(0.9603539f, -0.52262f, 0.0f,   0.9438334f, -0.3304141f, -0.002283001f),
+        Vertex(0.914058f, -0.6082109f, 0.0f,   0.8214033f, -0.5703412f, -0.002745001f),
+        Vertex(0.853873f, -0.6771339f, 0.0f,   0.7095412f, -0.7046612f, -0.001958f),
+        Vertex(0.7936879f, -0.7304329f, 0.0f,   0.6523046f, -0.7579566f, -0.0004659997f),
+        Vertex(0.7473909f, -0.7691479f, 0.0f,   0.7286693f, -0.6848563f, 0.003576002f),
+        Vertex(0.728873f, -0.794322f, 0.0f,   0.8891237f, -0.4576558f, 0.003163999f),
+        Vertex(0.9258209f, -0.52262f, 0.263546f,0.9120367f, -0.3308679f, 0.2423129f),
+        Vertex(0.8811529f, -0.6082109f, 0.251115f,   0.7936971f, -0.570897f, 0.210051f),
+        Vertex(0.823086f, -0.6771339f, 0.234954f,0.6853402f, -0.7051682f, 0.1817871f),
+        Vertex(0.7650179f, -0.7304329f, 0.218793f,   0.629635f, -0.75842f, 0.168401f),
+        Vertex(0.7203509f, -0.7691479f, 0.206361f,   0.702387f, -0.6853641f, 0.192168f),
+        Vertex(0.702484f, -0.794322f, 0.201389f,0.8576901f, -0.458122f, 0.233435f),
+        Vertex(0.828036f, -0.52262f, 0.498738f,0.8177159f, -0.331385f, 0.470664f),
+        Vertex(0.7879809f, -0.6082109f, 0.475213f,   0.7115282f, -0.5716082f, 0.4086461f),
+        Vertex(0.7359099f, -0.6771339f, 0.44463f,0.6140711f, -0.705839f, 0.35314f),
+        Vertex(0.683839f, -0.7304329f, 0.414047f,0.5637133f, -0.7590343f, 0.3257211f),
+        Vertex(0.6437839f, -0.7691479f, 0.390521f,   0.6278906f, -0.6860366f, 0.3675688f),
+        Vertex(0.627762f, -0.794322f, 0.381111f,0.7674107f, -0.4587868f, 0.4478788f),
+        Vertex(0.6757249f, -0.52262f, 0.696852f,0.6687284f, -0.3315572f, 0.6654864f),
+        Vertex(0.6428539f, -0.6082109f, 0.663981f,   0.5820097f, -0.5718738f, 0.5781218f),
+        Vertex(0.6001229f, -0.6771339f, 0.6212499f,   0.5020957f, -0.7060966f, 0.4993267f),
+        Vertex(0.5573909f, -0.7304329f, 0.5785189f,   0.460496f, -0.759271f, 0.459838f),
+        Vertex(0.5245209f, -0.7691479f, 0.5456479f,   0.5117598f, -0.6862967f, 0.5168158f),
+        Vertex(0.5113729f, -0.794322f, 0.5325f,0.6259499f, -0.4590599f, 0.6304369f),
+        Vertex(0.477611f, -0.52262f, 0.8491629f,0.4746599f, -0.3313209f, 0.8154289f),
+        Vertex(0.454085f, -0.6082109f, 0.809108f,0.4134342f, -0.5715903f, 0.7087713f),
+        Vertex(0.423502f, -0.6771339f, 0.7570369f,   0.3565468f, -0.7058386f, 0.6120996f),
+        Vertex(0.392919f, -0.7304329f, 0.7049659f,   0.32653f, -0.7590351f, 0.563244f),
+        Vertex(0.369394f, -0.7691479f, 0.6649109f,   0.3613459f, -0.6860399f, 0.6314889f),
+        Vertex(0.359984f, -0.794322f, 0.6488889f,0.4423488f, -0.4588318f, 0.7705847f),
+        Vertex(0.242419f, -0.52262f, 0.9469479f,0.2467939f, -0.3307729f, 0.9108687f),
+        Vertex(0.229987f, -0.6082109f, 0.9022809f,   0.2154289f, -0.5708699f, 0.7922739f),
+        Vertex(0.213826f, -0.6771339f, 0.8442129f,   0.1856189f, -0.7051677f, 0.6843127f),
+        Vertex(0.197666f, -0.7304329f, 0.7861449f,   0.169311f, -0.7584208f, 0.6293898f),
+        Vertex(0.185234f, -0.7691479f, 0.741478f,0.18517f, -0.6853682f, 0.7042602f),
+        Vertex(0.180262f, -0.794322f, 0.7236109f,0.2272311f, -0.4581881f, 0.8593193f),
+        Vertex(-0.021127f, -0.52262f, 0.981482f,0.002283001f, -0.3304141f, 0.9438334f),
+        Vertex(-0.021127f, -0.6082109f, 0.935185f,   0.002745001f, -0.5703412f, 0.8214033f),
+        Vertex(-0.021127f, -0.6771339f, 0.8749999f,   0.001958f, -0.7046612f, 0.7095412f),
+        Vertex(-0.021127f, -0.7304329f, 0.8148149f,   0.0004659997f, -0.7579566f, 0.6523046f),
+        Vertex(-0.021127f, -0.7691479f, 0.7685189f,   -0.003576002f, -0.6848563f, 0.7286693f),
+        Vertex(-0.021127f, -0.794322f, 0.7499999f,   -0.003163999f, -0.4576558f, 0.8891237f),
+        Vertex(-0.284673f, -0.52262f, 0.9469479f,-0.2423129f, -0.3308679f, 0.9120367f),
+        Vertex(-0.272242f, -0.6082109f, 0.9022809f,   -0.210051f, -0.570897f, 0.7936971f),
+        Vertex(-0.256081f, -0.6771339f, 0.8442129f,   -0.1817871f, -0.7051682f, 0.6853402f),
+        Vertex(-0.23992f, -0.7304329f, 0.7861449f,   -0.168401f, -0.75842f, 0.629635f),
+        Vertex(-0.227489f, -0.7691479f, 0.741478f,   -0.192168f, -0.6853641f, 0.702387f),
+        Vertex(-0.222516f, -0.794322f, 0.7236109f,   -0.233435f, -0.458122f, 0.8576901f),
+        Vertex(-0.5198649f, -0.52262f, 0.8491629f,   -0.470664f, -0.331385f, 0.8177159f),
+        Vertex(-0.49634f, -0.6082109f, 0.809108f,-0.4086461f, -0.5716082f, 0.7115282f),
+        Vertex(-0.465757f, -0.6771339f, 0.7570369f,   -0.35314f, -0.705839f, 0.6140711f),
+        Vertex(-0.435174f, -0.7304329f, 0.7049659f,   -0.3257211f, -0.7590343f, 0.5637132f),
+        Vertex(-0.411649f, -0.7691479f, 0.6649109f,   -0.3675688f, -0.6860366f, 0.6278906f),
+        Vertex(-0.402238f, -0.794322f, 0.6488889f,   -0.4478788f, -0.4587868f, 0.7674107f),
+        Vertex(-0.717979f, -0.52262f, 0.696852f,-0.6654864f, -0.3315572f, 0.6687284f),
+        Vertex(-0.685109f, -0.6082109f, 0.663981f,   -0.5781218f, -0.5718738f, 0.5820097f),
+        Vertex(-0.642377f, -0.6771339f, 0.6212499f,   -0.4993267f, -0.7060966f, 0.5020957f),
+        Vertex(-0.5996459f, -0.7304329f, 0.5785189f,   -0.459838f, -0.759271f, 0.460496f),
+        Vertex(-0.566775f, -0.7691479f, 0.5456479f,   -0.5168158f, -0.6862967f, 0.5117598f),
+        Vertex(-0.553627f, -0.794322f, 0.5325f,-0.6304368f, -0.4590599f, 0.6259498f),
+        Vertex(-0.8702899f, -0.52262f, 0.498738f,-0.8154289f, -0.3313209f, 0.4746599f),
+        Vertex(-0.830236f, -0.6082109f, 0.475213f,   -0.7087713f, -0.5715903f, 0.4134342f),
+        Vertex(-0.778164f, -0.6771339f, 0.44463f,-0.6120996f, -0.7058386f, 0.3565468f),
+        Vertex(-0.7260929f, -0.7304329f, 0.414047f,   -0.563244f, -0.7590351f, 0.32653f),
+        Vertex(-0.686038f, -0.7691479f, 0.390521f,   -0.6314889f, -0.6860399f, 0.3613459f),
+        Vertex(-0.6700159f, -0.794322f, 0.381111f,   -0.7705847f, -0.4588318f, 0.4423488f),
+        Vertex(-0.9680749f, -0.52262f, 0.263546f,-0.9108687f, -0.3307729f, 0.2467939f),
+        Vertex(-0.9234079f, -0.6082109f, 0.251115f,   -0.7922739f, -0.5708699f, 0.2154289f),
+        Vertex(-0.8653399f, -0.6771339f, 0.234954f,   -0.6843127f, -0.7051677f, 0.1856189f),
+        Vertex(-0.8072729f, -0.7304329f, 0.218793f,   -0.6293898f, -0.7584208f, 0.169311f),
+        Vertex(-0.762605f, -0.7691479f, 0.206361f,   -0.7042602f, -0.6853682f, 0.18517f),
+        Vertex(-0.7447379f, -0.794322f, 0.201389f,   -0.8593193f, -0.4581881f, 0.2272311f),
+        Vertex(-1.002609f, -0.52262f, 0.0f,   -0.9438334f, -0.3304141f, 0.002283001f),
+        Vertex(-0.9563119f, -0.6082109f, 0.0f,-0.8214033f, -0.5703412f, 0.002745001f),
+        Vertex(-0.8961269f, -0.6771339f, 0.0f,-0.7095412f, -0.7046612f, 0.001958f),
+        Vertex(-0.8359419f, -0.7304329f, 0.0f,-0.6523046f, -0.7579566f, 0.0004659997f),
+        Vertex(-0.789646f, -0.7691479f, 0.0f,   -0.7286693f, -0.6848563f, -0.003576002f),
+        Vertex(-0.7711269f, -0.794322f, 0.0f,   -0.8891237f, -0.4576558f, -0.003163999f),
+        Vertex(-0.9680749f, -0.52262f, -0.263546f,   -0.9120367f, -0.3308679f, -0.2423129f),
+        Vertex(-0.9234079f, -0.6082109f, -0.251115f,   -0.7936971f, -0.570897f, -0.210051f),
+        Vertex(-0.8653399f, -0.6771339f, -0.234954f,   -0.6853402f, -0.7051682f, -0.1817871f),
+        Vertex(-0.8072729f, -0.7304329f, -0.218793f,   -0.629635f, -0.75842f, -0.168401f),
+        Vertex(-0.762605f, -0.7691479f, -0.206361f,   -0.702387f, -0.6853641f, -0.192168f),
+        Vertex(-0.7447379f, -0.794322f, -0.201389f,   -0.8576901f, -0.458122f, -0.233435f),
+        Vertex(-0.8702899f, -0.52262f, -0.498738f,   -0.8177159f, -0.331385f, -0.470664f),
+        Vertex(-0.830236f, -0.6082109f, -0.475213f,   -0.7115282f, -0.5716082f, -0.4086461f),
+        Vertex(-0.778164f, -0.6771339f, -0.44463f,   -0.6140711f, -0.705839f, -0.35314f),
+        Vertex(-0.7260929f, -0.7304329f, -0.414047f,   -0.5637133f, -0.7590343f, -0.3257211f),
+        Vertex(-0.686038f, -0.7691479f, -0.390521f,   -0.6278906f, -0.6860366f, -0.3675688f),
+        Vertex(-0.6700159f, -0.794322f, -0.381111f,   -0.7674107f, -0.4587868f, -0.4478788f),
+        Vertex(-0.717979f, -0.52262f, -0.696852f,-0.6687284f, -0.3315572f, -0.6654864f),
+        Vertex(-0.685109f, -0.6082109f, -0.663981f,   -0.5820097f, -0.5718738f, -0.5781218f),
+        Vertex(-0.642377f, -0.6771339f, -0.6212499f,   -0.5020957f, -0.7060966f, -0.4993267f),
+        Vertex(-0.5996459f, -0.7304329f, -0.5785189f,   -0.460496f, -0.759271f, -0.459838f),
+        Vertex(-0.566775f, -0.7691479f, -0.5456479f,   -0.5117598f, -0.6862967f, -0.5168158f),
+        Vertex(-0.553627f, -0.794322f, -0.5325f,-0.6259499f, -0.4590599f, -0.6304369f),
+        Vertex(-0.5198649f, -0.52262f, -0.8491629f,   -0.4746599f, -0.3313209f, -0.8154289f),
+        Vertex(-0.49634f, -0.6082109f, -0.809108f,   -0.4134342f, -0.5715903f, -0.7087713f),
+        Vertex(-0.465757f, -0.6771339f, -0.7570369f,   -0.3565468f, -0.7058386f, -0.6120996f),
+        Vertex(-0.435174f, -0.7304329f, -0.7049659f,   -0.32653f, -0.7590351f, -0.563244f),
+        Vertex(-0.411648f, -0.7691479f, -0.6649109f,   -0.3613459f, -0.6860399f, -0.6314889f),
+        Vertex(-0.402238f, -0.794322f, -0.6488889f,   -0.4423488f, -0.4588318f, -0.7705847f),
+        Vertex(-0.284673f, -0.52262f, -0.9469479f,   -0.2467939f, -0.3307729f, -0.9108687f),
+        Vertex(-0.272242f, -0.6082109f, -0.9022809f,   -0.2154289f, -0.5708699f, -0.7922739f),
+        Vertex(-0.256081f, -0.6771339f, -0.8442129f,   -0.1856189f, -0.7051677f, -0.6843127f),
+        Vertex(-0.23992f, -0.7304329f, -0.7861449f,   -0.169311f, -0.7584208f, -0.6293898f),
+        Vertex(-0.227489f, -0.7691479f, -0.741478f,   -0.18517f, -0.6853682f, -0.7042602f),
+        Vertex(-0.222516f, -0.794322f, -0.7236109f,   -0.2272311f, -0.4581881f, -0.8593193f),
+        Vertex(-0.021127f, -0.52262f, -0.981482f,-0.002283001f, -0.3304141f, -0.9438334f),
+        Vertex(-0.021127f, -0.6082109f, -0.935185f,   -0.002745001f, -0.5703412f, -0.8214033f),
+        Vertex(-0.021127f, -0.6771339f, -0.8749999f,   -0.001958f, -0.7046612f, -0.7095412f),
+        Vertex(-0.021127f, -0.7304329f, -0.8148149f,   -0.0004659997f, -0.7579566f, -0.6523046f),
+        Vertex(-0.021127f, -0.7691479f, -0.7685189f,   0.003576002f, -0.6848563f, -0.7286693f),
+        Vertex(-0.021127f, -0.794322f, -0.7499999f,   0.003163999f, -0.4576558f, -0.8891237f),
+        Vertex(0.242419f, -0.52262f, -0.9469479f,0.2423129f, -0.3308679f, -0.9120367f),
+        Vertex(0.229987f, -0.6082109f, -0.9022809f,   0.210051f, -0.570897f, -0.7936971f),
+        Vertex(0.213827f, -0.6771339f, -0.8442129f,   0.1817871f, -0.7051682f, -0.6853402f),
+        Vertex(0.197666f, -0.7304329f, -0.7861449f,   0.168401f, -0.75842f, -0.629635f),
+        Vertex(0.185234f, -0.7691479f, -0.741478f,   0.192168f, -0.6853641f, -0.702387f),
+        Vertex(0.180262f, -0.794322f, -0.7236109f,   0.233435f, -0.458122f, -0.8576901f),
+        Vertex(0.477611f, -0.52262f, -0.8491629f,0.470664f, -0.331385f, -0.8177159f),
+        Vertex(0.454085f, -0.6082109f, -0.809108f,   0.4086461f, -0.5716082f, -0.7115282f),
+        Vertex(0.423502f, -0.6771339f, -0.7570369f,   0.35314f, -0.705839f, -0.6140711f),
+        Vertex(0.392919f, -0.7304329f, -0.7049659f,   0.3257211f, -0.7590343f, -0.5637132f),
+        Vertex(0.369394f, -0.7691479f, -0.6649109f,   0.3675688f, -0.6860366f, -0.6278906f),
+        Vertex(0.359984f, -0.794322f, -0.6488889f,   0.4478788f, -0.4587868f, -0.7674107f),
+        Vertex(0.6757249f, -0.52262f, -0.696852f,0.6654864f, -0.3315572f, -0.6687284f),
+        Vertex(0.6428539f, -0.6082109f, -0.663981f,   0.5781218f, -0.5718738f, -0.5820097f),
+        Vertex(0.6001229f, -0.6771339f, -0.6212499f,   0.4993267f, -0.7060966f, -0.5020957f),
+        Vertex(0.5573909f, -0.7304329f, -0.5785189f,   0.459838f, -0.759271f, -0.460496f),
+        Vertex(0.5245209f, -0.7691479f, -0.5456479f,   0.5168158f, -0.6862967f, -0.5117598f),
+        Vertex(0.5113729f, -0.794322f, -0.5325f,0.6304368f, -0.4590599f, -0.6259498f),
+        Vertex(0.828036f, -0.52262f, -0.498738f,0.8154289f, -0.3313209f, -0.4746599f),
+        Vertex(0.7879809f, -0.6082109f, -0.475213f,   0.7087713f, -0.5715903f, -0.4134342f),
+        Vertex(0.7359099f, -0.6771339f, -0.44463f,   0.6120996f, -0.7058386f, -0.3565468f),
+        Vertex(0.683839f, -0.7304329f, -0.414047f,   0.563244f, -0.7590351f, -0.32653f),
+        Vertex(0.6437839f, -0.7691479f, -0.390521f,   0.6314889f, -0.6860399f, -0.3613459f),
+        Vertex(0.627762f, -0.794322f, -0.381111f,0.7705847f, -0.4588318f, -0.4423488f),
+        Vertex(0.9258209f, -0.52262f, -0.263546f,0.9108687f, -0.3307729f, -0.2467939f),
+        Vertex(0.8811529f, -0.6082109f, -0.251115f,   0.7922739f, -0.5708699f, -0.2154289f),
+        Vertex(0.823086f, -0.6771339f, -0.234954f,   0.6843127f, -0.7051677f, -0.1856189f),
+        Vertex(0.7650179f, -0.7304329f, -0.218793f,   0.6293898f, -0.7584208f, -0.169311f),
+        Vertex(0.7203509f, -0.7691479f, -0.206361f,   0.7042602f, -0.6853682f, -0.18517f),
+        Vertex(0.702484f, -0.794322f, -0.201389f,0.8593193f, -0.4581881f, -0.2272311f),
+        Vertex(0.722796f, -0.8128979f, 0.0f,   0.7773448f, -0.6289898f, -0.010332f),
+        Vertex(0.692762f, -0.830433f, 0.0f,   0.361793f, -0.9322358f, -0.006476999f),
+        Vertex(0.62106f, -0.845884f, 0.0f,   0.152402f, -0.9883152f, -0.002559001f),
+        Vertex(0.489984f, -0.8582109f, 0.0f,   0.06642199f, -0.9977908f, -0.00119f),
+        Vertex(0.281824f, -0.86637f, 0.0f,   0.027401f, -0.999624f, -0.001027f),
+        Vertex(-0.021127f, -0.8693219f, 0.0f,   0.0f, -0.9999999f, 0.0f),
+        Vertex(0.6966209f, -0.8128979f, 0.199757f,   0.7531539f, -0.6294399f, 0.191218f),
+        Vertex(0.667643f, -0.830433f, 0.191692f,0.3507659f, -0.9323858f, 0.08729099f),
+        Vertex(0.598465f, -0.845884f, 0.172439f,0.1476881f, -0.9883445f, 0.03692602f),
+        Vertex(0.472f, -0.8582109f, 0.137243f,0.06438603f, -0.9977965f, 0.01602101f),
+        Vertex(0.271165f, -0.86637f, 0.08134799f,0.02670599f, -0.9996247f, 0.006086998f),
+        Vertex(0.6225049f, -0.8128979f, 0.378023f,   0.6772966f, -0.6299617f, 0.3800228f),
+        Vertex(0.5965189f, -0.830433f, 0.362761f,0.3155428f, -0.9326115f, 0.1751239f),
+        Vertex(0.534484f, -0.845884f, 0.326326f,0.132774f, -0.9883888f, 0.07388099f),
+        Vertex(0.421079f, -0.8582109f, 0.25972f,0.05790001f, -0.9978051f, 0.03213301f),
+        Vertex(0.240982f, -0.86637f, 0.153944f,0.02415701f, -0.9996263f, 0.012794f),
+        Vertex(0.5070589f, -0.8128979f, 0.528186f,   0.5563101f, -0.6301472f, 0.5416951f),
+        Vertex(0.485734f, -0.830433f, 0.5068609f,0.2595231f, -0.9327074f, 0.2504091f),
+        Vertex(0.434826f, -0.845884f, 0.455953f,0.109137f, -0.988408f, 0.10554f),
+        Vertex(0.341762f, -0.8582109f, 0.362889f,0.04761298f, -0.9978087f, 0.04594098f),
+        Vertex(0.193968f, -0.86637f, 0.215095f,0.020018f, -0.999627f, 0.018575f),
+        Vertex(0.356896f, -0.8128979f, 0.6436319f,   0.3980141f, -0.629932f, 0.6669111f),
+        Vertex(0.341634f, -0.830433f, 0.6176459f,0.1863179f, -0.9326347f, 0.3089949f),
+        Vertex(0.305199f, -0.845884f, 0.555611f,0.07829598f, -0.9883937f, 0.130182f),
+        Vertex(0.238593f, -0.8582109f, 0.442206f,0.034185f, -0.997806f, 0.056696f),
+        Vertex(0.132817f, -0.86637f, 0.262109f,0.01456399f, -0.9996266f, 0.02311699f),
+        Vertex(0.17863f, -0.8128979f, 0.7177489f,0.211443f, -0.6293949f, 0.7477659f),
+        Vertex(0.170565f, -0.830433f, 0.6887709f,0.09992103f, -0.9324203f, 0.3472871f),
+        Vertex(0.151312f, -0.845884f, 0.619592f,0.04191198f, -0.9883515f, 0.1463029f),
+        Vertex(0.116116f, -0.8582109f, 0.493128f,0.018338f, -0.9977978f, 0.06374098f),
+        Vertex(0.060221f, -0.86637f, 0.292292f,0.008087002f, -0.9996253f, 0.02615f),
+        Vertex(-0.021127f, -0.8128979f, 0.743924f,   0.010332f, -0.6289898f, 0.7773448f),
+        Vertex(-0.021127f, -0.830433f, 0.7138889f,   0.006476999f, -0.9322358f, 0.361793f),
+        Vertex(-0.021127f, -0.845884f, 0.642188f,0.002559001f, -0.9883152f, 0.152402f),
+        Vertex(-0.021127f, -0.8582109f, 0.511111f,   0.00119f, -0.9977908f, 0.06642199f),
+        Vertex(-0.021127f, -0.86637f, 0.302951f,0.001027f, -0.999624f, 0.027401f),
+        Vertex(-0.220884f, -0.8128979f, 0.7177489f,   -0.191218f, -0.62944f, 0.753154f),
+        Vertex(-0.21282f, -0.830433f, 0.6887709f,-0.08729099f, -0.9323858f, 0.3507659f),
+        Vertex(-0.193566f, -0.845884f, 0.619592f,-0.03692602f, -0.9883445f, 0.1476881f),
+        Vertex(-0.15837f, -0.8582109f, 0.493128f,-0.01602101f, -0.9977965f, 0.06438603f),
+        Vertex(-0.102475f, -0.86637f, 0.292292f,-0.006086998f, -0.9996247f, 0.02670599f),
+        Vertex(-0.399151f, -0.8128979f, 0.6436319f,   -0.3800228f, -0.6299617f, 0.6772966f),
+        Vertex(-0.383889f, -0.830433f, 0.6176459f,   -0.1751239f, -0.9326115f, 0.3155428f),
+        Vertex(-0.347454f, -0.845884f, 0.555611f,-0.07388099f, -0.9883888f, 0.132774f),
+        Vertex(-0.280847f, -0.8582109f, 0.442206f,   -0.03213301f, -0.9978051f, 0.05790001f),
+        Vertex(-0.175071f, -0.86637f, 0.262109f,-0.012794f, -0.9996263f, 0.02415701f),
+        Vertex(-0.5493129f, -0.8128979f, 0.528186f,   -0.5416951f, -0.6301472f, 0.5563101f),
+        Vertex(-0.527988f, -0.830433f, 0.5068609f,   -0.2504091f, -0.9327074f, 0.2595231f),
+        Vertex(-0.47708f, -0.845884f, 0.455953f,-0.10554f, -0.988408f, 0.109137f),
+        Vertex(-0.384016f, -0.8582109f, 0.362889f,   -0.04594098f, -0.9978087f, 0.04761298f),
+        Vertex(-0.236223f, -0.86637f, 0.215095f,-0.018575f, -0.999627f, 0.020018f),
+        Vertex(-0.6647589f, -0.8128979f, 0.378023f,   -0.6669111f, -0.629932f, 0.3980141f),
+        Vertex(-0.638773f, -0.830433f, 0.362761f,-0.3089949f, -0.9326347f, 0.1863179f),
+        Vertex(-0.5767379f, -0.845884f, 0.326326f,   -0.130182f, -0.9883937f, 0.07829598f),
+        Vertex(-0.463333f, -0.8582109f, 0.25972f,-0.056696f, -0.997806f, 0.034185f),
+        Vertex(-0.283236f, -0.86637f, 0.153944f,-0.02311699f, -0.9996266f, 0.01456399f),
+        Vertex(-0.7388759f, -0.8128979f, 0.199757f,   -0.7477659f, -0.6293949f, 0.211443f),
+        Vertex(-0.7098979f, -0.830433f, 0.191692f,   -0.3472871f, -0.9324203f, 0.09992103f),
+        Vertex(-0.6407189f, -0.845884f, 0.172439f,   -0.1463029f, -0.9883515f, 0.04191198f),
+        Vertex(-0.5142549f, -0.8582109f, 0.137243f,   -0.06374099f, -0.997798f, 0.018338f),
+        Vertex(-0.313419f, -0.86637f, 0.08134799f,   -0.02615f, -0.9996253f, 0.008087002f),
+        Vertex(-0.7650509f, -0.8128979f, 0.0f,-0.7773448f, -0.6289898f, 0.010332f),
+        Vertex(-0.7350159f, -0.830433f, 0.0f,   -0.361793f, -0.9322358f, 0.006476999f),
+        Vertex(-0.6633149f, -0.845884f, 0.0f,   -0.152402f, -0.9883152f, 0.002559001f),
+        Vertex(-0.5322379f, -0.8582109f, 0.0f,-0.06642199f, -0.9977908f, 0.00119f),
+        Vertex(-0.324079f, -0.86637f, 0.0f,   -0.027401f, -0.999624f, 0.001027f),
+        Vertex(-0.7388759f, -0.8128979f, -0.199757f,   -0.7531539f, -0.6294399f, -0.191218f),
+        Vertex(-0.7098979f, -0.830433f, -0.191692f,   -0.3507659f, -0.9323858f, -0.08729099f),
+        Vertex(-0.6407189f, -0.845884f, -0.172439f,   -0.1476881f, -0.9883445f, -0.03692602f),
+        Vertex(-0.5142549f, -0.8582109f, -0.137243f,   -0.06438603f, -0.9977965f, -0.01602101f),
+        Vertex(-0.313419f, -0.86637f, -0.08134799f,   -0.02670599f, -0.9996247f, -0.006086998f),
+        Vertex(-0.6647589f, -0.8128979f, -0.378023f,   -0.6772966f, -0.6299617f, -0.3800228f),
+        Vertex(-0.638773f, -0.830433f, -0.362761f,   -0.3155428f, -0.9326115f, -0.1751239f),
+        Vertex(-0.5767379f, -0.845884f, -0.326326f,   -0.132774f, -0.9883888f, -0.07388099f),
+        Vertex(-0.463333f, -0.8582109f, -0.25972f,   -0.05790001f, -0.9978051f, -0.03213301f),
+        Vertex(-0.283236f, -0.86637f, -0.153944f,-0.02415701f, -0.9996263f, -0.012794f),
+        Vertex(-0.5493129f, -0.8128979f, -0.528186f,   -0.5563101f, -0.6301472f, -0.5416951f),
+        Vertex(-0.527988f, -0.830433f, -0.5068609f,   -0.2595231f, -0.9327074f, -0.2504091f),
+        Vertex(-0.47708f, -0.845884f, -0.455953f,-0.109137f, -0.988408f, -0.10554f),
+        Vertex(-0.384016f, -0.8582109f, -0.362889f,   -0.04761298f, -0.9978087f, -0.04594098f),
+        Vertex(-0.236223f, -0.86637f, -0.215095f,-0.020018f, -0.999627f, -0.018575f),
+        Vertex(-0.399151f, -0.8128979f, -0.6436319f,   -0.3980141f, -0.629932f, -0.6669111f),
+        Vertex(-0.383889f, -0.830433f, -0.6176459f,   -0.1863179f, -0.9326347f, -0.3089949f),
+        Vertex(-0.347454f, -0.845884f, -0.555611f,   -0.07829598f, -0.9883937f, -0.130182f),
+        Vertex(-0.280847f, -0.8582109f, -0.442206f,   -0.034185f, -0.997806f, -0.056696f),
+        Vertex(-0.175071f, -0.86637f, -0.262109f,-0.01456399f, -0.9996266f, -0.02311699f),
+        Vertex(-0.220884f, -0.8128979f, -0.7177489f,   -0.211443f, -0.6293949f, -0.7477659f),
+        Vertex(-0.21282f, -0.830433f, -0.6887709f,   -0.09992103f, -0.9324203f, -0.3472871f),
+        Vertex(-0.193566f, -0.845884f, -0.619592f,   -0.04191198f, -0.9883515f, -0.1463029f),
+        Vertex(-0.15837f, -0.8582109f, -0.493128f,   -0.018338f, -0.9977978f, -0.06374098f),
+        Vertex(-0.102475f, -0.86637f, -0.292292f,-0.008087002f, -0.9996253f, -0.02615f),
+        Vertex(-0.021127f, -0.8128979f, -0.743924f,   -0.010332f, -0.6289898f, -0.7773448f),
+        Vertex(-0.021127f, -0.830433f, -0.7138889f,   -0.006476999f, -0.9322358f, -0.361793f),
+        Vertex(-0.021127f, -0.845884f, -0.642188f,   -0.002559001f, -0.9883152f, -0.152402f),
+        Vertex(-0.021127f, -0.8582109f, -0.511111f,   -0.00119f, -0.9977908f, -0.06642199f),
+        Vertex(-0.021127f, -0.86637f, -0.302951f,-0.001027f, -0.999624f, -0.027401f),
+        Vertex(0.17863f, -0.8128979f, -0.7177489f,   0.191218f, -0.62944f, -0.753154f),
+        Vertex(0.170565f, -0.830433f, -0.6887709f,   0.08729099f, -0.9323858f, -0.3507659f),
+        Vertex(0.151312f, -0.845884f, -0.619592f,0.03692602f, -0.9883445f, -0.1476881f),
+        Vertex(0.116116f, -0.8582109f, -0.493128f,   0.01602101f, -0.9977965f, -0.06438603f),
+        Vertex(0.060221f, -0.86637f, -0.292292f,0.006086998f, -0.9996247f, -0.02670599f),
+        Vertex(0.356896f, -0.8128979f, -0.6436319f,   0.3800228f, -0.6299617f, -0.6772966f),
+        Vertex(0.341634f, -0.830433f, -0.6176459f,   0.1751239f, -0.9326115f, -0.3155428f),
+        Vertex(0.305199f, -0.845884f, -0.555611f,0.07388099f, -0.9883888f, -0.132774f),
+        Vertex(0.238593f, -0.8582109f, -0.442206f,   0.03213301f, -0.9978051f, -0.05790001f),
+        Vertex(0.132817f, -0.86637f, -0.262109f,0.012794f, -0.9996263f, -0.02415701f),
+        Vertex(0.5070589f, -0.8128979f, -0.528186f,   0.5416951f, -0.6301472f, -0.5563101f),
+        Vertex(0.485734f, -0.830433f, -0.5068609f,   0.2504091f, -0.9327074f, -0.2595231f),
+        Vertex(0.434826f, -0.845884f, -0.455953f,0.10554f, -0.988408f, -0.109137f),
+        Vertex(0.341762f, -0.8582109f, -0.362889f,   0.04594098f, -0.9978087f, -0.04761298f),
+        Vertex(0.193968f, -0.86637f, -0.215095f,0.018575f, -0.999627f, -0.020018f),
+        Vertex(0.6225049f, -0.8128979f, -0.378023f,   0.6669111f, -0.629932f, -0.3980141f),
+        Vertex(0.5965189f, -0.830433f, -0.362761f,   0.3089949f, -0.9326347f, -0.1863179f),
+        Vertex(0.534484f, -0.845884f, -0.326326f,0.130182f, -0.9883937f, -0.07829598f),
+        Vertex(0.421079f, -0.8582109f, -0.25972f,0.056696f, -0.997806f, -0.034185f),
+        Vertex(0.240982f, -0.86637f, -0.153944f,0.02311699f, -0.9996266f, -0.01456399f),
+        Vertex(0.6966209f, -0.8128979f, -0.199757f,   0.7477659f, -0.6293949f, -0.211443f),
+        Vertex(0.667643f, -0.830433f, -0.191692f,0.3472871f, -0.9324203f, -0.09992103f),
+        Vertex(0.598465f, -0.845884f, -0.172439f,0.1463029f, -0.9883515f, -0.04191198f),
+        Vertex(0.472f, -0.8582109f, -0.137243f,0.06374099f, -0.997798f, -0.018338f),
+        Vertex(0.271165f, -0.86637f, -0.08134799f,   0.02615f, -0.9996253f, -0.008087002f),
+        Vertex(-0.8211269f, 0.143178f, 0.0f,   0.003251999f, -0.9990167f, 0.04421499f),
+        Vertex(-0.9833959f, 0.142657f, 0.0f,   0.01523999f, -0.9998837f, -0.0004259999f),
+        Vertex(-1.119275f, 0.139012f, 0.0f,   0.05992801f, -0.9982023f, -0.0008760002f),
+        Vertex(-1.227377f, 0.129116f, 0.0f,   0.1671339f, -0.9859335f, -0.001082999f),
+        Vertex(-1.306313f, 0.109845f, 0.0f,   0.4038382f, -0.9148303f, -0.0002030001f),
+        Vertex(-1.354692f, 0.07807399f, 0.0f,   0.7924452f, -0.6099431f, 0.0002420001f),
+        Vertex(-1.371127f, 0.030678f, 0.0f,   0.9951607f, -0.09825397f, -0.001013f),
+        Vertex(-0.8174239f, 0.151512f, 0.0625f,0.003195001f, -0.9279082f, 0.3727951f),
+        Vertex(-0.9846479f, 0.150952f, 0.0625f,0.015041f, -0.9497637f, 0.3126059f),
+        Vertex(-1.124351f, 0.147036f, 0.0625f,0.05922698f, -0.9482657f, 0.3119039f),
+        Vertex(-1.235248f, 0.136407f, 0.0625f,0.164453f, -0.9335488f, 0.3184989f),
+        Vertex(-1.316052f, 0.115709f, 0.0625f,0.388162f, -0.8542191f, 0.34589f),
+        Vertex(-1.365477f, 0.08158499f, 0.0625f,0.7293938f, -0.5619048f, 0.3901889f),
+        Vertex(-1.382239f, 0.030678f, 0.0625f,0.9123507f, -0.09533196f, 0.3981558f),
+        Vertex(-0.8081639f, 0.172345f, 0.09999999f,   0.002232001f, -0.5976803f, 0.8017315f),
+        Vertex(-0.9877769f, 0.171689f, 0.09999999f,   0.01083f, -0.6814968f, 0.7317408f),
+        Vertex(-1.13704f, 0.167098f, 0.09999999f,0.04361301f, -0.6796141f, 0.7322721f),
+        Vertex(-1.254924f, 0.154637f, 0.09999999f,   0.120047f, -0.6603202f, 0.7413272f),
+        Vertex(-1.3404f, 0.13037f, 0.09999999f,0.2679299f, -0.5804407f, 0.7689616f),
+        Vertex(-1.392441f, 0.09036199f, 0.09999999f,   0.4672849f, -0.3671069f, 0.8042868f),
+        Vertex(-1.410016f, 0.030678f, 0.09999999f,   0.5840061f, -0.06760601f, 0.8089291f),
+        Vertex(-0.796127f, 0.199428f, 0.1125f,-0.0006530003f, 0.1526351f, 0.9882824f),
+        Vertex(-0.991845f, 0.198647f, 0.1125f,-0.002559001f, 0.0009050003f, 0.9999962f),
+        Vertex(-1.153535f, 0.193178f, 0.1125f,-0.007405004f, 0.0003840002f, 0.9999725f),
+        Vertex(-1.280502f, 0.178335f, 0.1125f,-0.01609001f, -0.004746002f, 0.9998593f),
+        Vertex(-1.372053f, 0.149428f, 0.1125f,-0.025703f, -0.01962f, 0.999477f),
+        Vertex(-1.427493f, 0.101772f, 0.1125f,-0.020936f, -0.035053f, 0.9991661f),
+        Vertex(-1.446127f, 0.030678f, 0.1125f,-0.002824001f, -0.02389901f, 0.9997104f),
+        Vertex(-0.7840899f, 0.226511f, 0.09999999f,   -0.003295999f, 0.7562547f, 0.6542688f),
+        Vertex(-0.995913f, 0.225605f, 0.09999999f,   -0.01540501f, 0.6812514f, 0.7318874f),
+        Vertex(-1.17003f, 0.219258f, 0.09999999f,-0.05921699f, 0.6762829f, 0.7342579f),
+        Vertex(-1.306081f, 0.202032f, 0.09999999f,   -0.1584379f, 0.6437916f, 0.7486185f),
+        Vertex(-1.403706f, 0.168487f, 0.09999999f,   -0.33417f, 0.526967f, 0.7814321f),
+        Vertex(-1.462545f, 0.113182f, 0.09999999f,   -0.518177f, 0.278028f, 0.808822f),
+        Vertex(-1.482238f, 0.030678f, 0.09999999f,   -0.5889288f, 0.01639099f, 0.8080186f),
+        Vertex(-0.7748309f, 0.247345f, 0.0625f,-0.004351998f, 0.9673496f, 0.2534079f),
+        Vertex(-0.9990419f, 0.246342f, 0.0625f,-0.020677f, 0.9492998f, 0.3136909f),
+        Vertex(-1.182719f, 0.23932f, 0.0625f,   -0.08184396f, 0.9451165f, 0.3163168f),
+        Vertex(-1.325757f, 0.220261f, 0.0625f,-0.226175f, 0.9160968f, 0.3310759f),
+        Vertex(-1.428054f, 0.183147f, 0.0625f,-0.5004998f, 0.7842887f, 0.3665938f),
+        Vertex(-1.489509f, 0.121959f, 0.0625f,-0.8043737f, 0.4396349f, 0.3996299f),
+        Vertex(-1.510016f, 0.030678f, 0.0625f,-0.9164599f, 0.037237f, 0.39839f),
+        Vertex(-0.7711269f, 0.255678f, 0.0f,   -0.004517001f, 0.9990112f, -0.04422801f),
+        Vertex(-1.000294f, 0.254636f, 0.0f,   -0.021584f, 0.9997669f, 0.000265f),
+        Vertex(-1.187794f, 0.247345f, 0.0f,   -0.08624499f, 0.9962738f, 0.000157f),
+        Vertex(-1.333627f, 0.227553f, 0.0f,   -0.240673f, 0.970606f, -0.000608f),
+        Vertex(-1.437794f, 0.189011f, 0.0f,   -0.5402799f, 0.8414838f, -0.001597f),
+        Vertex(-1.500294f, 0.12547f, 0.0f,   -0.8778105f, 0.4790077f, 0.0003899998f),
+        Vertex(-1.521127f, 0.030678f, 0.0f,   -0.9990739f, 0.043021f, 0.0006859999f),
+        Vertex(-0.7748309f, 0.247345f, -0.0625f,-0.004094f, 0.9279191f, -0.372759f),
+        Vertex(-0.9990419f, 0.246342f, -0.0625f,-0.01968701f, 0.9495184f, -0.3130931f),
+        Vertex(-1.182719f, 0.23932f, -0.0625f,-0.07902303f, 0.9455454f, -0.3157521f),
+        Vertex(-1.325757f, 0.220261f, -0.0625f,-0.2195999f, 0.9174576f, -0.3317339f),
+        Vertex(-1.428054f, 0.183147f, -0.0625f,-0.4887151f, 0.7905341f, -0.369071f),
+        Vertex(-1.489509f, 0.121959f, -0.0625f,-0.7976729f, 0.4520359f, -0.399226f),
+        Vertex(-1.510016f, 0.030678f, -0.0625f,-0.9165545f, 0.04567497f, -0.3972928f),
+        Vertex(-0.7840899f, 0.226511f, -0.09999999f,   -0.002516001f, 0.5976993f, -0.8017164f),
+        Vertex(-0.995913f, 0.225605f, -0.09999999f,   -0.012433f, 0.6812719f, -0.7319249f),
+        Vertex(-1.17003f, 0.219258f, -0.09999999f,   -0.05095002f, 0.6771832f, -0.7340482f),
+        Vertex(-1.306081f, 0.202032f, -0.09999999f,   -0.1402979f, 0.6488978f, -0.7478288f),
+        Vertex(-1.403706f, 0.168487f, -0.09999999f,   -0.3035011f, 0.5469342f, -0.7802243f),
+        Vertex(-1.462545f, 0.113182f, -0.09999999f,   -0.4955412f, 0.3157941f, -0.8091434f),
+        Vertex(-1.482238f, 0.030678f, -0.09999999f,   -0.5868877f, 0.04354398f, -0.8084966f),
+        Vertex(-0.796127f, 0.199428f, -0.1125f,0.000557f, -0.152599f, -0.988288f),
+        Vertex(-0.991845f, 0.198647f, -0.1125f,0.002074001f, -0.0009690003f, -0.9999974f),
+        Vertex(-1.153535f, 0.193178f, -0.1125f,0.005498999f, -0.00141f, -0.9999838f),
+        Vertex(-1.280502f, 0.178335f, -0.1125f,0.011569f, 0.0005459999f, -0.9999328f),
+        Vertex(-1.372053f, 0.149428f, -0.1125f,0.01933099f, 0.010342f, -0.9997596f),
+        Vertex(-1.427493f, 0.101772f, -0.1125f,0.017294f, 0.025347f, -0.9995291f),
+        Vertex(-1.446127f, 0.030678f, -0.1125f,0.002732999f, 0.02071f, -0.9997817f),
+        Vertex(-0.8081639f, 0.172345f, -0.09999999f,   0.002668002f, -0.7561955f, -0.6543404f),
+        Vertex(-0.9877769f, 0.171689f, -0.09999999f,   0.012416f, -0.6815858f, -0.7316328f),
+        Vertex(-1.13704f, 0.167098f, -0.09999999f,   0.04794599f, -0.6798449f, -0.7317869f),
+        Vertex(-1.254924f, 0.154637f, -0.09999999f,   0.130533f, -0.6595942f, -0.7402002f),
+        Vertex(-1.3404f, 0.13037f, -0.09999999f,0.293034f, -0.569168f, -0.768231f),
+        Vertex(-1.392441f, 0.09036199f, -0.09999999f,   0.500213f, -0.318883f, -0.8050469f),
+        Vertex(-1.410016f, 0.030678f, -0.09999999f,   0.587808f, -0.026599f, -0.808563f),
+        Vertex(-0.8174239f, 0.151512f, -0.0625f,0.003190999f, -0.9673316f, -0.2534939f),
+        Vertex(-0.9846479f, 0.150952f, -0.0625f,0.014981f, -0.9494818f, -0.3134639f),
+        Vertex(-1.124351f, 0.147036f, -0.0625f,0.05895399f, -0.9477838f, -0.3134169f),
+        Vertex(-1.235248f, 0.136407f, -0.0625f,0.164056f, -0.9331872f, -0.3197611f),
+        Vertex(-1.316052f, 0.115709f, -0.0625f,0.3912121f, -0.8532173f, -0.3449251f),
+        Vertex(-1.365477f, 0.08158499f, -0.0625f,0.7436751f, -0.5428411f, -0.3902191f),
+        Vertex(-1.382239f, 0.030678f, -0.0625f,0.9136017f, -0.07395598f, -0.3998279f),
+        Vertex(-1.362563f, -0.033905f, 0.0f,   0.9729245f, 0.2311209f, -0.0009179995f),
+        Vertex(-1.335942f, -0.110988f, 0.0f,   0.9123298f, 0.409438f, -0.003848999f),
+        Vertex(-1.289877f, -0.194322f, 0.0f,   0.8280289f, 0.5606489f, -0.006407999f),
+        Vertex(-1.222979f, -0.277655f, 0.0f,   0.7168072f, 0.6972392f, -0.006712001f),
+        Vertex(-1.133859f, -0.354739f, 0.0f,   0.5759888f, 0.8174508f, -0.003301999f),
+        Vertex(-1.021127f, -0.419322f, 0.0f,   0.4951329f, 0.8676327f, -0.04534999f),
+        Vertex(-1.373219f, -0.03733199f, 0.0625f,0.8939853f, 0.2131421f, 0.3941582f),
+        Vertex(-1.34527f, -0.116647f, 0.0625f,0.8406055f, 0.3838952f, 0.3821082f),
+        Vertex(-1.297053f, -0.20144f, 0.0625f,0.76886f, 0.531454f, 0.355543f),
+        Vertex(-1.227232f, -0.285886f, 0.0625f,0.6725095f, 0.6656775f, 0.3234262f),
+        Vertex(-1.134467f, -0.364159f, 0.0625f,0.5456098f, 0.7796327f, 0.3073799f),
+        Vertex(-1.017424f, -0.430433f, 0.0625f,0.4793028f, 0.8430496f, 0.2439999f),
+        Vertex(-1.399861f, -0.04589999f, 0.09999999f,   0.5763878f, 0.133958f, 0.8061218f),
+        Vertex(-1.36859f, -0.130793f, 0.09999999f,   0.5444701f, 0.253746f, 0.7994781f),
+        Vertex(-1.314993f, -0.219235f, 0.09999999f,   0.508754f, 0.364144f, 0.780108f),
+        Vertex(-1.237862f, -0.306462f, 0.09999999f,   0.4611798f, 0.4717798f, 0.7514897f),
+        Vertex(-1.135989f, -0.387709f, 0.09999999f,   0.3872811f, 0.5611662f, 0.7315092f),
+        Vertex(-1.008164f, -0.458211f, 0.09999999f,   0.371347f, 0.666129f, 0.646818f),
+        Vertex(-1.434495f, -0.057039f, 0.1125f,0.002409999f, -0.014515f, 0.9998917f),
+        Vertex(-1.398905f, -0.149183f, 0.1125f,0.001300999f, -0.01641099f, 0.9998645f),
+        Vertex(-1.338315f, -0.242369f, 0.1125f,0.0007199997f, -0.02020099f, 0.9997956f),
+        Vertex(-1.251683f, -0.333211f, 0.1125f,0.003255998f, -0.02135899f, 0.9997665f),
+        Vertex(-1.137967f, -0.418324f, 0.1125f,0.008875996f, -0.01333699f, 0.9998716f),
+        Vertex(-0.9961269f, -0.494322f, 0.1125f,0.07275897f, 0.1317089f, 0.9886146f),
+        Vertex(-1.46913f, -0.06817699f, 0.09999999f,   -0.5690878f, -0.161451f, 0.8062708f),
+        Vertex(-1.429221f, -0.167573f, 0.09999999f,   -0.5243167f, -0.2948408f, 0.7988496f),
+        Vertex(-1.361637f, -0.265502f, 0.09999999f,   -0.4726348f, -0.4106098f, 0.7797537f),
+        Vertex(-1.265503f, -0.35996f, 0.09999999f,   -0.4157828f, -0.5086058f, 0.7539527f),
+        Vertex(-1.139946f, -0.448939f, 0.09999999f,   -0.3496738f, -0.5796757f, 0.7360056f),
+        Vertex(-0.9840899f, -0.5304329f, 0.09999999f,   -0.2792079f, -0.5306978f, 0.8002517f),
+        Vertex(-1.495772f, -0.076745f, 0.0625f,-0.885693f, -0.241406f, 0.396574f),
+        Vertex(-1.45254f, -0.181719f, 0.0625f,-0.8032036f, -0.4499958f, 0.3903429f),
+        Vertex(-1.379576f, -0.283298f, 0.0625f,-0.6975129f, -0.6134439f, 0.370354f),
+        Vertex(-1.276134f, -0.380536f, 0.0625f,-0.5884621f, -0.7322772f, 0.3427571f),
+        Vertex(-1.141468f, -0.472489f, 0.0625f,-0.4852058f, -0.8130077f, 0.3218598f),
+        Vertex(-0.9748309f, -0.558211f, 0.0625f,-0.4258789f, -0.8235339f, 0.374725f),
+        Vertex(-1.506428f, -0.08017299f, 0.0f,-0.9657872f, -0.2593351f, 0.0005920001f),
+        Vertex(-1.461868f, -0.187377f, 0.0f,   -0.8726112f, -0.4884061f, 0.003010001f),
+        Vertex(-1.386752f, -0.290416f, 0.0f,   -0.7486511f, -0.662945f, 0.005037f),
+        Vertex(-1.280387f, -0.388766f, 0.0f,   -0.6224434f, -0.7826485f, 0.005056003f),
+        Vertex(-1.142076f, -0.481909f, 0.0f,   -0.5091117f, -0.8606965f, 0.002550999f),
+        Vertex(-0.9711269f, -0.5693219f, 0.0f,-0.4555148f, -0.8890377f, 0.04602298f),
+        Vertex(-1.495772f, -0.076745f, -0.0625f,-0.8886051f, -0.232245f, -0.3955291f),
+        Vertex(-1.45254f, -0.181719f, -0.0625f,-0.8093778f, -0.4434449f, -0.3850509f),
+        Vertex(-1.379576f, -0.283298f, -0.0625f,-0.7040522f, -0.6115981f, -0.3609131f),
+        Vertex(-1.276134f, -0.380536f, -0.0625f,-0.5927131f, -0.7335282f, -0.3326071f),
+        Vertex(-1.141468f, -0.472489f, -0.0625f,-0.4863342f, -0.8142933f, -0.3168681f),
+        Vertex(-0.9748309f, -0.558211f, -0.0625f,-0.44189f, -0.860789f, -0.252538f),
+        Vertex(-1.46913f, -0.06817699f, -0.09999999f,   -0.5744768f, -0.139332f, -0.8065748f),
+        Vertex(-1.429221f, -0.167573f, -0.09999999f,   -0.5322352f, -0.2756611f, -0.8004603f),
+        Vertex(-1.361637f, -0.265502f, -0.09999999f,   -0.4808437f, -0.3961708f, -0.7822006f),
+        Vertex(-1.265503f, -0.35996f, -0.09999999f,   -0.4231719f, -0.4993229f, -0.7560437f),
+        Vertex(-1.139946f, -0.448939f, -0.09999999f,   -0.355443f, -0.5741869f, -0.7375429f),
+        Vertex(-0.9840899f, -0.5304329f, -0.09999999f,   -0.348424f, -0.6707451f, -0.6547531f),
+        Vertex(-1.434495f, -0.057039f, -0.1125f,-0.001890999f, 0.01293699f, -0.9999145f),
+        Vertex(-1.398905f, -0.149183f, -0.1125f,0.001397f, 0.011921f, -0.9999279f),
+        Vertex(-1.338315f, -0.242369f, -0.1125f,0.005088997f, 0.01417799f, -0.9998865f),
+        Vertex(-1.251683f, -0.333211f, -0.1125f,0.004896001f, 0.016722f, -0.9998482f),
+        Vertex(-1.137967f, -0.418324f, -0.1125f,-0.002003001f, 0.01228501f, -0.9999226f),
+        Vertex(-0.9961269f, -0.494322f, -0.1125f,-0.06818298f, -0.130578f, -0.9890907f),
+        Vertex(-1.399861f, -0.04589999f, -0.09999999f,   0.5733869f, 0.149188f, -0.8055869f),
+        Vertex(-1.36859f, -0.130793f, -0.09999999f,   0.5412272f, 0.2667141f, -0.7974563f),
+        Vertex(-1.314993f, -0.219235f, -0.09999999f,   0.503525f, 0.37727f, -0.7772579f),
+        Vertex(-1.237862f, -0.306462f, -0.09999999f,   0.4514521f, 0.4841441f, -0.7495302f),
+        Vertex(-1.135989f, -0.387709f, -0.09999999f,   0.3723861f, 0.5710221f, -0.7316162f),
+        Vertex(-1.008164f, -0.458211f, -0.09999999f,   0.2897071f, 0.5290532f, -0.7976043f),
+        Vertex(-1.373219f, -0.03733199f, -0.0625f,   0.8926538f, 0.2161309f, -0.3955459f),
+        Vertex(-1.34527f, -0.116647f, -0.0625f,0.8372342f, 0.3848361f, -0.3885101f),
+        Vertex(-1.297053f, -0.20144f, -0.0625f,0.763231f, 0.53164f, -0.367202f),
+        Vertex(-1.227232f, -0.285886f, -0.0625f,0.6654689f, 0.6661019f, -0.336837f),
+        Vertex(-1.134467f, -0.364159f, -0.0625f,0.5379951f, 0.7819742f, -0.3147661f),
+        Vertex(-1.017424f, -0.430433f, -0.0625f,0.4553238f, 0.8109198f, -0.3675449f),
+        Vertex(0.8288729f, -0.156822f, 0.0f,   -0.145927f, 0.9870438f, 0.06670499f),
+        Vertex(1.008271f, -0.131127f, 0.0f,   -0.3502529f, 0.9366408f, -0.005156999f),
+        Vertex(1.114058f, -0.063766f, 0.0f,   -0.7109947f, 0.7031907f, -0.003046999f),
+        Vertex(1.172623f, 0.030678f, 0.0f,   -0.8994002f, 0.4371011f, 0.004678001f),
+        Vertex(1.210354f, 0.137623f, 0.0f,   -0.9302377f, 0.3665789f, 0.01665599f),
+        Vertex(1.253641f, 0.242484f, 0.0f,   -0.8458401f, 0.53304f, 0.020564f),
+        Vertex(1.328873f, 0.330678f, 0.0f,   -0.6463717f, 0.7630176f, 0.002775999f),
+        Vertex(0.8288729f, -0.187377f, 0.1375f,-0.128906f, 0.8415668f, 0.5245459f),
+        Vertex(1.015061f, -0.156719f, 0.131173f,-0.2920189f, 0.8520818f, 0.4343749f),
+        Vertex(1.123935f, -0.08331399f, 0.115355f,   -0.6153548f, 0.6751188f, 0.4068819f),
+        Vertex(1.183734f, 0.017484f, 0.09479199f,-0.799678f, 0.453205f, 0.393853f),
+        Vertex(1.2227f, 0.130318f, 0.074228f,   -0.8141301f, 0.3843811f, 0.4352511f),
+        Vertex(1.269073f, 0.239835f, 0.05841099f,-0.7117425f, 0.4966544f, 0.4967464f),
+        Vertex(1.351095f, 0.330678f, 0.052083f,-0.5387179f, 0.6839559f, 0.4919219f),
+        Vertex(0.8288729f, -0.263766f, 0.22f,   -0.05432799f, 0.4454299f, 0.8936668f),
+        Vertex(1.032036f, -0.220698f, 0.209877f,-0.120328f, 0.5357402f, 0.8357653f),
+        Vertex(1.148626f, -0.132182f, 0.184568f,-0.285367f, 0.495269f, 0.8205329f),
+        Vertex(1.211512f, -0.015502f, 0.151667f,-0.427214f, 0.405516f, 0.808112f),
+        Vertex(1.253564f, 0.112057f, 0.118765f,-0.4552616f, 0.3541817f, 0.8168793f),
+        Vertex(1.307654f, 0.233212f, 0.09345699f,-0.3865179f, 0.3751629f, 0.8425298f),
+        Vertex(1.406651f, 0.330678f, 0.08333299f,-0.28915f, 0.468105f, 0.8350269f),
+        Vertex(0.8288729f, -0.363072f, 0.2475f,0.075157f, -0.092491f, 0.992873f),
+        Vertex(1.054104f, -0.30387f, 0.236111f,0.130249f, 0.04017899f, 0.9906668f),
+        Vertex(1.180725f, -0.195711f, 0.207639f,0.2053039f, 0.124938f, 0.9706907f),
+        Vertex(1.247623f, -0.058384f, 0.170625f,0.176764f, 0.184322f, 0.9668401f),
+        Vertex(1.293688f, 0.08831699f, 0.133611f,0.08219303f, 0.1824831f, 0.9797674f),
+        Vertex(1.357808f, 0.224602f, 0.105139f,0.009841997f, 0.124532f, 0.9921667f),
+        Vertex(1.478873f, 0.330678f, 0.09374999f,-0.004171001f, 0.105296f, 0.9944322f),
+        Vertex(0.8288729f, -0.462377f, 0.22f,   0.2138491f, -0.5877553f, 0.7802643f),
+        Vertex(1.076172f, -0.387043f, 0.209877f,0.3617279f, -0.4470689f, 0.8180968f),
+        Vertex(1.212823f, -0.25924f, 0.184568f,0.6016351f, -0.258541f, 0.7557722f),
+        Vertex(1.283734f, -0.101266f, 0.151667f,0.6722209f, -0.09906299f, 0.7336929f),
+        Vertex(1.333811f, 0.06457699f, 0.118765f,0.5832469f, -0.08487f, 0.8078489f),
+        Vertex(1.407962f, 0.215992f, 0.09345699f,0.4092508f, -0.2357079f, 0.8814507f),
+        Vertex(1.551095f, 0.330678f, 0.08333299f,0.2842839f, -0.3856539f, 0.8777548f),
+        Vertex(0.8288729f, -0.538766f, 0.1375f,0.3026371f, -0.8807622f, 0.3642371f),
+        Vertex(1.093148f, -0.451022f, 0.131173f,0.4964279f, -0.7561049f, 0.4264559f),
+        Vertex(1.237515f, -0.308108f, 0.115355f,0.7904503f, -0.4871102f, 0.3713651f),
+        Vertex(1.311512f, -0.134252f, 0.09479199f,   0.8958597f, -0.2773599f, 0.3471408f),
+        Vertex(1.364675f, 0.046316f, 0.074228f,0.8652622f, -0.2959071f, 0.4046731f),
+        Vertex(1.446543f, 0.209369f, 0.05841f,0.6902718f, -0.5426428f, 0.4786058f),
+        Vertex(1.606651f, 0.330678f, 0.052083f,0.4677468f, -0.7535786f, 0.4618787f),
+        Vertex(0.8288729f, -0.5693219f, 0.0f,   0.3215629f, -0.9445047f, -0.06714097f),
+        Vertex(1.099938f, -0.476614f, 0.0f,   0.5315658f, -0.8470018f, 0.005045998f),
+        Vertex(1.247391f, -0.327655f, 0.0f,   0.8335048f, -0.5525079f, 0.002162999f),
+        Vertex(1.322623f, -0.147447f, 0.0f,   0.9441853f, -0.3293431f, -0.006880002f),
+        Vertex(1.377021f, 0.039012f, 0.0f,   0.9323182f, -0.3612451f, -0.016874f),
+        Vertex(1.461975f, 0.20672f, 0.0f,   0.7686391f, -0.6396011f, -0.010215f),
+        Vertex(1.628873f, 0.330678f, 0.0f,   0.5130019f, -0.8583868f, 0.0009639998f),
+        Vertex(0.8288729f, -0.538766f, -0.1375f,0.2783309f, -0.8095946f, -0.5168058f),
+        Vertex(1.093148f, -0.451022f, -0.131173f,0.491568f, -0.7636359f, -0.418594f),
+        Vertex(1.237515f, -0.308108f, -0.115355f,0.7884782f, -0.4931071f, -0.3676241f),
+        Vertex(1.311512f, -0.134252f, -0.09479199f,   0.8910884f, -0.2752708f, -0.3608148f),
+        Vertex(1.364675f, 0.046316f, -0.074228f,0.8564791f, -0.282922f, -0.4317391f),
+        Vertex(1.446543f, 0.209369f, -0.05841f,0.6922176f, -0.5273307f, -0.4927037f),
+        Vertex(1.606651f, 0.330678f, -0.052083f,0.4734868f, -0.7492617f, -0.4630518f),
+        Vertex(0.8288729f, -0.462377f, -0.22f,0.166654f, -0.429938f, -0.8873441f),
+        Vertex(1.076172f, -0.387043f, -0.209877f,0.339768f, -0.4583481f, -0.8212641f),
+        Vertex(1.212823f, -0.25924f, -0.184568f,0.59016f, -0.27624f, -0.758553f),
+        Vertex(1.283734f, -0.101266f, -0.151667f,0.668115f, -0.103914f, -0.736766f),
+        Vertex(1.333811f, 0.06457699f, -0.118765f,   0.5900092f, -0.07674003f, -0.8037413f),
+        Vertex(1.407962f, 0.215992f, -0.09345699f,   0.4332869f, -0.219357f, -0.8741538f),
+        Vertex(1.551095f, 0.330678f, -0.08333299f,   0.299036f, -0.368898f, -0.8800521f),
+        Vertex(0.8288729f, -0.363072f, -0.2475f,0.02786899f, 0.102187f, -0.9943747f),
+        Vertex(1.054104f, -0.30387f, -0.236111f,0.08815198f, 0.03181499f, -0.9955988f),
+        Vertex(1.180725f, -0.195711f, -0.207639f,0.174456f, 0.09618498f, -0.9799558f),
+        Vertex(1.247623f, -0.058384f, -0.170625f,0.1887081f, 0.161291f, -0.9686972f),
+        Vertex(1.293688f, 0.08831699f, -0.133611f,   0.1276859f, 0.1757739f, -0.9761146f),
+        Vertex(1.357808f, 0.224602f, -0.105139f,0.05450897f, 0.1309859f, -0.9898844f),
+        Vertex(1.478873f, 0.330678f, -0.09374999f,   0.01587699f, 0.11673f, -0.9930367f),
+        Vertex(0.8288729f, -0.263766f, -0.22f,-0.08107201f, 0.607187f, -0.7904121f),
+        Vertex(1.032036f, -0.220698f, -0.209877f,-0.164116f, 0.522469f, -0.836715f),
+        Vertex(1.148626f, -0.132182f, -0.184568f,-0.3196262f, 0.4634052f, -0.8264954f),
+        Vertex(1.211512f, -0.015502f, -0.151667f,-0.4229708f, 0.3834499f, -0.8210126f),
+        Vertex(1.253564f, 0.112057f, -0.118765f,-0.4245339f, 0.3535969f, -0.8335108f),
+        Vertex(1.307654f, 0.233212f, -0.09345699f,   -0.3516121f, 0.3881061f, -0.8519053f),
+        Vertex(1.406651f, 0.330678f, -0.08333299f,   -0.270475f, 0.475063f, -0.837352f),
+        Vertex(0.8288729f, -0.187377f, -0.1375f,-0.133739f, 0.917541f, -0.374476f),
+        Vertex(1.015061f, -0.156719f, -0.131173f,-0.3160429f, 0.8394898f, -0.4420109f),
+        Vertex(1.123935f, -0.08331399f, -0.115355f,   -0.6311809f, 0.6566489f, -0.4128229f),
+        Vertex(1.183734f, 0.017484f, -0.09479199f,   -0.8074049f, 0.4430169f, -0.3896579f),
+        Vertex(1.2227f, 0.130318f, -0.074228f,-0.8216587f, 0.3862289f, -0.4191708f),
+        Vertex(1.269073f, 0.239835f, -0.05841f,-0.7077482f, 0.5173932f, -0.4810372f),
+        Vertex(1.351095f, 0.330678f, -0.052083f,-0.5268137f, 0.6937897f, -0.4910428f),
+        Vertex(1.35341f, 0.346303f, 0.0f,   -0.4610171f, 0.8873711f, -0.005987001f),
+        Vertex(1.375169f, 0.355678f, 0.0f,   -0.2906751f, 0.9567103f, -0.01460101f),
+        Vertex(1.391373f, 0.358803f, 0.0f,   0.08551796f, 0.9950855f, -0.04991297f),
+        Vertex(1.399243f, 0.355678f, 0.0f,   0.8877124f, 0.4561657f, -0.06228496f),
+        Vertex(1.396003f, 0.346303f, 0.0f,   0.8229922f, -0.5672631f, 0.02993701f),
+        Vertex(1.378873f, 0.330678f, 0.0f,   0.6598783f, -0.7431583f, 0.1107981f),
+        Vertex(1.377077f, 0.346641f, 0.05054f,-0.391094f, 0.83136f, 0.394824f),
+        Vertex(1.398763f, 0.356295f, 0.046682f,-0.2533101f, 0.9368253f, 0.2412311f),
+        Vertex(1.413711f, 0.359584f, 0.041667f,0.01536599f, 0.9950096f, -0.09858795f),
+        Vertex(1.419477f, 0.35645f, 0.036651f,0.5201849f, 0.5498809f, -0.6534819f),
+        Vertex(1.413617f, 0.346834f, 0.032793f,0.6288559f, -0.3823759f, -0.6769999f),
+        Vertex(1.393688f, 0.330678f, 0.03125f,0.5789478f, -0.6460917f, -0.4973778f),
+        Vertex(1.436244f, 0.347485f, 0.08086399f,-0.2234219f, 0.6609277f, 0.7164196f),
+        Vertex(1.457748f, 0.357839f, 0.07469099f,-0.156131f, 0.8749861f, 0.4582821f),
+        Vertex(1.469556f, 0.361538f, 0.06666699f,-0.03646698f, 0.9982635f, -0.04626098f),
+        Vertex(1.47006f, 0.358379f, 0.058642f,0.1566369f, 0.6824906f, -0.7139127f),
+        Vertex(1.457652f, 0.34816f, 0.052469f,0.2636321f, 0.005571001f, -0.9646072f),
+        Vertex(1.430725f, 0.330678f, 0.05f,   0.3124089f, -0.3247778f, -0.8927037f),
+        Vertex(1.513161f, 0.348582f, 0.09097199f,-0.001750999f, 0.3393829f, 0.9406466f),
+        Vertex(1.534428f, 0.359845f, 0.08402799f,-0.02111899f, 0.7599017f, 0.6496947f),
+        Vertex(1.542154f, 0.364077f, 0.075f,   -0.044404f, 0.9981211f, 0.04221901f),
+        Vertex(1.535817f, 0.360886f, 0.06597199f,-0.03252899f, 0.8028619f, -0.5952769f),
+        Vertex(1.514897f, 0.349884f, 0.059028f,-0.008745001f, 0.371564f, -0.9283661f),
+        Vertex(1.478873f, 0.330678f, 0.05624999f,0.04252898f, 0.07791297f, -0.9960526f),
+        Vertex(1.590078f, 0.349679f, 0.08086399f,0.2800199f, -0.238192f, 0.9299748f),
+        Vertex(1.611109f, 0.361851f, 0.07469099f,0.2273049f, 0.4914857f, 0.8406985f),
+        Vertex(1.614753f, 0.366616f, 0.06666699f,-0.003104998f, 0.9874066f, 0.1581719f),
+        Vertex(1.601575f, 0.363394f, 0.058642f,-0.143918f, 0.8958663f, -0.4203702f),
+        Vertex(1.572143f, 0.351608f, 0.052469f,-0.200177f, 0.683872f, -0.701604f),
+        Vertex(1.527021f, 0.330678f, 0.05f,   -0.1871879f, 0.5001976f, -0.8454365f),
+        Vertex(1.649245f, 0.350523f, 0.05054f,0.4536729f, -0.7468348f, 0.4862289f),
+        Vertex(1.670094f, 0.363394f, 0.046682f,0.6921583f, -0.08006204f, 0.7172914f),
+        Vertex(1.670597f, 0.368569f, 0.041667f,0.185758f, 0.9425361f, 0.277704f),
+        Vertex(1.652158f, 0.365323f, 0.036651f,-0.211188f, 0.9552742f, -0.207004f),
+        Vertex(1.616178f, 0.352934f, 0.032793f,-0.3129609f, 0.8810608f, -0.3546649f),
+        Vertex(1.564058f, 0.330678f, 0.03125f,-0.336331f, 0.8113451f, -0.4781221f),
+        Vertex(1.672912f, 0.35086f, 0.0f,   0.4824449f, -0.8758158f, -0.013906f),
+        Vertex(1.693688f, 0.364011f, 0.0f,   0.9130126f, -0.4055718f, -0.04381098f),
+        Vertex(1.692935f, 0.36935f, 0.0f,   0.5069092f, 0.8539203f, 0.117742f),
+        Vertex(1.672391f, 0.366095f, 0.0f,   -0.2340329f, 0.9721234f, 0.01429499f),
+        Vertex(1.633792f, 0.353465f, 0.0f,   -0.3480328f, 0.9374674f, 0.005276997f),
+        Vertex(1.578873f, 0.330678f, 0.0f,   -0.3840639f, 0.9210727f, -0.06418498f),
+        Vertex(1.649245f, 0.350523f, -0.05054f,0.457762f, -0.7176679f, -0.524792f),
+        Vertex(1.670094f, 0.363394f, -0.046682f,0.6833472f, -0.06301402f, -0.7273692f),
+        Vertex(1.670597f, 0.368569f, -0.041667f,0.3573609f, 0.8981858f, -0.2560379f),
+        Vertex(1.652158f, 0.365323f, -0.036651f,-0.2070099f, 0.9478627f, 0.2422869f),
+        Vertex(1.616178f, 0.352934f, -0.032793f,-0.3143869f, 0.8723568f, 0.3743719f),
+        Vertex(1.564058f, 0.330678f, -0.03125f,-0.36104f, 0.8728191f, 0.328385f),
+        Vertex(1.590078f, 0.349679f, -0.08086399f,   0.280225f, -0.218552f, -0.934724f),
+        Vertex(1.611109f, 0.361851f, -0.07469099f,   0.261124f, 0.434074f, -0.8622029f),
+        Vertex(1.614753f, 0.366616f, -0.06666699f,   0.060553f, 0.978577f, -0.196775f),
+        Vertex(1.601575f, 0.363394f, -0.058642f,-0.1318089f, 0.8810936f, 0.4542028f),
+        Vertex(1.572143f, 0.351608f, -0.052469f,-0.195016f, 0.6588579f, 0.7265499f),
+        Vertex(1.527021f, 0.330678f, -0.05f,   -0.247824f, 0.6303589f, 0.7356839f),
+        Vertex(1.513161f, 0.348582f, -0.09097199f,   0.008860001f, 0.321862f, -0.9467451f),
+        Vertex(1.534428f, 0.359845f, -0.08402799f,   0.001382001f, 0.7331892f, -0.6800233f),
+        Vertex(1.542154f, 0.364077f, -0.075f,   -0.01272f, 0.9979491f, -0.06273401f),
+        Vertex(1.535817f, 0.360886f, -0.06597199f,   -0.011656f, 0.7852209f, 0.6191059f),
+        Vertex(1.514897f, 0.349884f, -0.059028f,0.000967f, 0.344022f, 0.938961f),
+        Vertex(1.478873f, 0.330678f, -0.05624999f,   -0.03735999f, 0.214324f, 0.9760478f),
+        Vertex(1.436244f, 0.347485f, -0.08086399f,   -0.2133601f, 0.6488383f, -0.7304014f),
+        Vertex(1.457748f, 0.357839f, -0.07469099f,   -0.140052f, 0.8658911f, -0.4802271f),
+        Vertex(1.469556f, 0.361538f, -0.06666699f,   -0.0008089999f, 0.9994998f, 0.03161099f),
+        Vertex(1.47006f, 0.358379f, -0.058642f,0.194529f, 0.6590812f, 0.7264782f),
+        Vertex(1.457652f, 0.34816f, -0.052469f,0.2668319f, -0.005233998f, 0.9637287f),
+        Vertex(1.430725f, 0.330678f, -0.05f,   0.2193799f, -0.2172469f, 0.9511446f),
+        Vertex(1.377077f, 0.346641f, -0.05054f,-0.384886f, 0.827121f, -0.409553f),
+        Vertex(1.398763f, 0.356295f, -0.046682f,-0.2409149f, 0.9326416f, -0.2685879f),
+        Vertex(1.413711f, 0.359584f, -0.041667f,0.06582997f, 0.9967856f, 0.04565798f),
+        Vertex(1.419477f, 0.35645f, -0.036651f,0.5970108f, 0.5077028f, 0.6211408f),
+        Vertex(1.413617f, 0.346834f, -0.032793f,0.6130043f, -0.3694181f, 0.6983953f),
+        Vertex(1.393688f, 0.330678f, -0.03125f,0.4868732f, -0.5667872f, 0.6646103f),
+        Vertex(-0.021127f, 0.7056779f, 0.0f,   0.0f, 0.9999999f, 0.0f),
+        Vertex(0.118225f, 0.6942199f, 0.0f,   0.3957909f, 0.9182068f, 0.015676f),
+        Vertex(0.160354f, 0.6640109f, 0.0f,   0.9645441f, 0.263762f, 0.009177001f),
+        Vertex(0.141373f, 0.621303f, 0.0f,   0.8390408f, -0.5440559f, -0.003653999f),
+        Vertex(0.09739099f, 0.572345f, 0.0f,   0.7889689f, -0.6144299f, 0.001943f),
+        Vertex(0.06452099f, 0.5233859f, 0.0f,   0.9910246f, -0.1336469f, 0.002952999f),
+        Vertex(0.07887299f, 0.480678f, 0.0f,   0.7325307f, 0.6806057f, -0.01320599f),
+        Vertex(0.113346f, 0.6942199f, 0.037539f,0.3776689f, 0.9184907f, 0.117221f),
+        Vertex(0.154f, 0.6640109f, 0.048885f,   0.9295568f, 0.263662f, 0.2576939f),
+        Vertex(0.135681f, 0.621303f, 0.043764f,0.8111578f, -0.5448008f, 0.2126379f),
+        Vertex(0.09323699f, 0.572345f, 0.031902f,0.7611559f, -0.6151949f, 0.20537f),
+        Vertex(0.061512f, 0.5233859f, 0.023022f,0.9565148f, -0.133833f, 0.2591679f),
+        Vertex(0.07535399f, 0.480678f, 0.026852f,0.7106892f, 0.6809552f, 0.1766941f),
+        Vertex(0.09951499f, 0.6942199f, 0.07096599f,   0.3336961f, 0.9187912f, 0.210878f),
+        Vertex(0.135987f, 0.6640109f, 0.09241699f,   0.8307129f, 0.2637839f, 0.4902389f),
+        Vertex(0.119549f, 0.621303f, 0.08274099f,0.727549f, -0.545809f, 0.41565f),
+        Vertex(0.08146299f, 0.572345f, 0.06032399f,   0.681011f, -0.6162879f, 0.395491f),
+        Vertex(0.05299f, 0.5233859f, 0.04355299f,0.8564128f, -0.134443f, 0.4984798f),
+        Vertex(0.06539099f, 0.480678f, 0.050815f,0.6401761f, 0.6812711f, 0.355027f),
+        Vertex(0.07794299f, 0.6942199f, 0.09906999f,   0.267591f, 0.918878f, 0.289928f),
+        Vertex(0.107891f, 0.6640109f, 0.129019f,0.6754159f, 0.263955f, 0.688579f),
+        Vertex(0.09438799f, 0.621303f, 0.115516f,0.5949699f, -0.546203f, 0.5896379f),
+        Vertex(0.063104f, 0.572345f, 0.08423099f,0.5553297f, -0.6167296f, 0.5579007f),
+        Vertex(0.039709f, 0.5233859f, 0.06083599f,   0.6986937f, -0.1348039f, 0.7026057f),
+        Vertex(0.04987299f, 0.480678f, 0.07099999f,   0.5268981f, 0.681345f, 0.508082f),
+        Vertex(0.049838f, 0.6942199f, 0.120642f,0.183499f, 0.9187108f, 0.349712f),
+        Vertex(0.07128999f, 0.6640109f, 0.157114f,   0.4740307f, 0.2640978f, 0.8399685f),
+        Vertex(0.061614f, 0.621303f, 0.140676f,0.4221941f, -0.5457681f, 0.723802f),
+        Vertex(0.039197f, 0.572345f, 0.10259f,0.392296f, -0.6162761f, 0.6828671f),
+        Vertex(0.022426f, 0.5233859f, 0.07411699f,   0.4935979f, -0.134679f, 0.8591987f),
+        Vertex(0.029688f, 0.480678f, 0.086519f,0.3781838f, 0.6811966f, 0.6268557f),
+        Vertex(0.016412f, 0.6942199f, 0.134473f,0.08649794f, 0.9183774f, 0.3861358f),
+        Vertex(0.027758f, 0.6640109f, 0.175127f,0.2396049f, 0.2640958f, 0.9342605f),
+        Vertex(0.022637f, 0.621303f, 0.156808f,0.219887f, -0.5447429f, 0.8092619f),
+        Vertex(0.010774f, 0.572345f, 0.114364f,0.201667f, -0.615183f, 0.762155f),
+        Vertex(0.001895f, 0.5233859f, 0.08263899f,   0.2535291f, -0.1341731f, 0.9579774f),
+        Vertex(0.005725f, 0.480678f, 0.09648199f,0.2026309f, 0.6808658f, 0.7038198f),
+        Vertex(-0.021127f, 0.6942199f, 0.139352f,-0.01567599f, 0.9182067f, 0.3957909f),
+        Vertex(-0.021127f, 0.6640109f, 0.181482f,-0.009177001f, 0.263762f, 0.9645441f),
+        Vertex(-0.021127f, 0.621303f, 0.1625f,0.003653998f, -0.5440567f, 0.8390405f),
+        Vertex(-0.021127f, 0.572345f, 0.118519f,-0.001943f, -0.61443f, 0.7889689f),
+        Vertex(-0.021127f, 0.5233859f, 0.08564799f,   -0.002952999f, -0.1336469f, 0.9910246f),
+        Vertex(-0.021127f, 0.480678f, 0.09999999f,   0.01320599f, 0.6806057f, 0.7325307f),
+        Vertex(-0.05866599f, 0.6942199f, 0.134473f,   -0.117221f, 0.9184907f, 0.3776689f),
+        Vertex(-0.07001299f, 0.6640109f, 0.175127f,   -0.2576939f, 0.263662f, 0.9295568f),
+        Vertex(-0.06489199f, 0.621303f, 0.156808f,   -0.2126379f, -0.5448008f, 0.8111578f),
+        Vertex(-0.053029f, 0.572345f, 0.114364f,-0.20537f, -0.6151949f, 0.7611559f),
+        Vertex(-0.044149f, 0.5233859f, 0.08263899f,   -0.2591679f, -0.133833f, 0.9565147f),
+        Vertex(-0.047979f, 0.480678f, 0.096481f,-0.1766941f, 0.6809552f, 0.7106892f),
+        Vertex(-0.09209299f, 0.6942199f, 0.120642f,   -0.210878f, 0.9187912f, 0.3336961f),
+        Vertex(-0.113544f, 0.6640109f, 0.157114f,-0.4902389f, 0.2637839f, 0.8307129f),
+        Vertex(-0.103868f, 0.621303f, 0.140676f,-0.41565f, -0.545809f, 0.727549f),
+        Vertex(-0.08145099f, 0.572345f, 0.10259f,-0.395491f, -0.6162879f, 0.681011f),
+        Vertex(-0.06468f, 0.5233859f, 0.07411699f,   -0.4984798f, -0.134443f, 0.8564128f),
+        Vertex(-0.07194199f, 0.480678f, 0.086519f,   -0.355027f, 0.6812711f, 0.6401761f),
+        Vertex(-0.120197f, 0.6942199f, 0.09906999f,   -0.289928f, 0.918878f, 0.267591f),
+        Vertex(-0.150146f, 0.6640109f, 0.129019f,-0.688579f, 0.263955f, 0.6754159f),
+        Vertex(-0.136643f, 0.621303f, 0.115516f,-0.5896379f, -0.546203f, 0.5949699f),
+        Vertex(-0.105359f, 0.572345f, 0.08423099f,   -0.5579008f, -0.6167297f, 0.5553297f),
+        Vertex(-0.081963f, 0.5233859f, 0.06083599f,   -0.7026057f, -0.1348039f, 0.6986937f),
+        Vertex(-0.092127f, 0.480678f, 0.07099999f,   -0.508082f, 0.681345f, 0.5268981f),
+        Vertex(-0.14177f, 0.6942199f, 0.07096599f,   -0.349712f, 0.9187108f, 0.183499f),
+        Vertex(-0.178241f, 0.6640109f, 0.09241699f,   -0.8399685f, 0.2640978f, 0.4740307f),
+        Vertex(-0.161803f, 0.621303f, 0.08274099f,   -0.723802f, -0.545768f, 0.422194f),
+        Vertex(-0.123717f, 0.572345f, 0.06032399f,   -0.6828672f, -0.6162761f, 0.3922961f),
+        Vertex(-0.09524399f, 0.5233859f, 0.04355299f,   -0.8591988f, -0.134679f, 0.4935979f),
+        Vertex(-0.107646f, 0.480678f, 0.050815f,-0.6268557f, 0.6811966f, 0.3781838f),
+        Vertex(-0.1556f, 0.6942199f, 0.037539f,-0.3861358f, 0.9183774f, 0.08649794f),
+        Vertex(-0.196254f, 0.6640109f, 0.048885f,-0.9342605f, 0.2640958f, 0.2396049f),
+        Vertex(-0.177936f, 0.621303f, 0.043764f,-0.8092619f, -0.5447429f, 0.219887f),
+        Vertex(-0.135491f, 0.572345f, 0.031902f,-0.762155f, -0.615183f, 0.201667f),
+        Vertex(-0.103767f, 0.5233859f, 0.023022f,-0.9579774f, -0.1341731f, 0.2535291f),
+        Vertex(-0.117609f, 0.480678f, 0.026852f,-0.7038198f, 0.6808658f, 0.2026309f),
+        Vertex(-0.160479f, 0.6942199f, 0.0f,   -0.3957909f, 0.9182068f, -0.015676f),
+        Vertex(-0.202609f, 0.6640109f, 0.0f,   -0.9645441f, 0.263762f, -0.009177001f),
+        Vertex(-0.183627f, 0.621303f, 0.0f,   -0.8390405f, -0.5440567f, 0.003653998f),
+        Vertex(-0.139646f, 0.572345f, 0.0f,   -0.7889689f, -0.6144299f, -0.001943f),
+        Vertex(-0.106775f, 0.5233859f, 0.0f,   -0.9910246f, -0.1336469f, -0.002952999f),
+        Vertex(-0.121127f, 0.480678f, 0.0f,   -0.7325307f, 0.6806057f, 0.01320599f),
+        Vertex(-0.1556f, 0.6942199f, -0.037539f,-0.3776689f, 0.9184907f, -0.117221f),
+        Vertex(-0.196254f, 0.6640109f, -0.048885f,   -0.9295568f, 0.263662f, -0.2576939f),
+        Vertex(-0.177936f, 0.621303f, -0.043764f,-0.8111578f, -0.5448008f, -0.2126379f),
+        Vertex(-0.135491f, 0.572345f, -0.031902f,-0.7611559f, -0.6151949f, -0.20537f),
+        Vertex(-0.103767f, 0.5233859f, -0.023022f,   -0.9565148f, -0.133833f, -0.2591679f),
+        Vertex(-0.117609f, 0.480678f, -0.026852f,-0.7106892f, 0.6809552f, -0.1766941f),
+        Vertex(-0.14177f, 0.6942199f, -0.07096599f,   -0.3336961f, 0.9187912f, -0.210878f),
+        Vertex(-0.178241f, 0.6640109f, -0.09241699f,   -0.8307129f, 0.2637839f, -0.4902389f),
+        Vertex(-0.161803f, 0.621303f, -0.08274099f,   -0.727549f, -0.545809f, -0.41565f),
+        Vertex(-0.123717f, 0.572345f, -0.06032399f,   -0.681011f, -0.6162879f, -0.395491f),
+        Vertex(-0.09524399f, 0.5233859f, -0.04355299f,   -0.8564128f, -0.134443f, -0.4984798f),
+        Vertex(-0.107646f, 0.480678f, -0.050815f,-0.6401761f, 0.6812711f, -0.355027f),
+        Vertex(-0.120197f, 0.6942199f, -0.09906999f,   -0.267591f, 0.918878f, -0.289928f),
+        Vertex(-0.150146f, 0.6640109f, -0.129019f,   -0.6754159f, 0.263955f, -0.688579f),
+        Vertex(-0.136643f, 0.621303f, -0.115516f,-0.5949699f, -0.546203f, -0.5896379f),
+        Vertex(-0.105359f, 0.572345f, -0.08423099f,   -0.5553297f, -0.6167296f, -0.5579007f),
+        Vertex(-0.081963f, 0.5233859f, -0.06083599f,   -0.6986937f, -0.1348039f, -0.7026057f),
+        Vertex(-0.092127f, 0.480678f, -0.07099999f,   -0.5268981f, 0.681345f, -0.508082f),
+        Vertex(-0.09209299f, 0.6942199f, -0.120642f,   -0.183499f, 0.9187108f, -0.349712f),
+        Vertex(-0.113544f, 0.6640109f, -0.157114f,   -0.4740307f, 0.2640978f, -0.8399685f),
+        Vertex(-0.103868f, 0.621303f, -0.140676f,-0.4221941f, -0.5457681f, -0.723802f),
+        Vertex(-0.08145099f, 0.572345f, -0.10259f,   -0.392296f, -0.6162761f, -0.6828671f),
+        Vertex(-0.06468f, 0.5233859f, -0.07411699f,   -0.4935979f, -0.134679f, -0.8591987f),
+        Vertex(-0.07194199f, 0.480678f, -0.086519f,   -0.3781838f, 0.6811966f, -0.6268557f),
+        Vertex(-0.05866599f, 0.6942199f, -0.134473f,   -0.08649794f, 0.9183774f, -0.3861358f),
+        Vertex(-0.07001299f, 0.6640109f, -0.175127f,   -0.2396049f, 0.2640958f, -0.9342605f),
+        Vertex(-0.06489199f, 0.621303f, -0.156808f,   -0.219887f, -0.5447429f, -0.8092619f),
+        Vertex(-0.053029f, 0.572345f, -0.114364f,-0.201667f, -0.615183f, -0.762155f),
+        Vertex(-0.044149f, 0.5233859f, -0.08263899f,   -0.2535291f, -0.1341731f, -0.9579774f),
+        Vertex(-0.047979f, 0.480678f, -0.09648199f,   -0.2026309f, 0.6808658f, -0.7038198f),
+        Vertex(-0.021127f, 0.6942199f, -0.139352f,   0.01567599f, 0.9182067f, -0.3957909f),
+        Vertex(-0.021127f, 0.6640109f, -0.181482f,   0.009177001f, 0.263762f, -0.9645441f),
+        Vertex(-0.021127f, 0.621303f, -0.1625f,-0.003653998f, -0.5440567f, -0.8390405f),
+        Vertex(-0.021127f, 0.572345f, -0.118519f,0.001943f, -0.61443f, -0.7889689f),
+        Vertex(-0.021127f, 0.5233859f, -0.08564799f,   0.002952999f, -0.1336469f, -0.9910246f),
+        Vertex(-0.021127f, 0.480678f, -0.09999999f,   -0.01320599f, 0.6806057f, -0.7325307f),
+        Vertex(0.016412f, 0.6942199f, -0.134473f,0.117221f, 0.9184907f, -0.3776689f),
+        Vertex(0.027758f, 0.6640109f, -0.175127f,0.2576939f, 0.263662f, -0.9295568f),
+        Vertex(0.022637f, 0.621303f, -0.156808f,0.2126379f, -0.5448008f, -0.8111578f),
+        Vertex(0.010774f, 0.572345f, -0.114364f,0.20537f, -0.6151949f, -0.7611559f),
+        Vertex(0.001895f, 0.5233859f, -0.08263899f,   0.2591679f, -0.133833f, -0.9565147f),
+        Vertex(0.005725f, 0.480678f, -0.096481f,0.1766941f, 0.6809552f, -0.7106892f),
+        Vertex(0.049838f, 0.6942199f, -0.120642f,0.210878f, 0.9187912f, -0.3336961f),
+        Vertex(0.07128999f, 0.6640109f, -0.157114f,   0.4902389f, 0.2637839f, -0.8307129f),
+        Vertex(0.061614f, 0.621303f, -0.140676f,0.41565f, -0.545809f, -0.727549f),
+        Vertex(0.039197f, 0.572345f, -0.10259f,0.395491f, -0.6162879f, -0.681011f),
+        Vertex(0.022426f, 0.5233859f, -0.07411699f,   0.4984798f, -0.134443f, -0.8564128f),
+        Vertex(0.029688f, 0.480678f, -0.086519f,0.355027f, 0.6812711f, -0.6401761f),
+        Vertex(0.07794299f, 0.6942199f, -0.09906999f,   0.289928f, 0.918878f, -0.267591f),
+        Vertex(0.107891f, 0.6640109f, -0.129019f,0.688579f, 0.263955f, -0.6754159f),
+        Vertex(0.09438799f, 0.621303f, -0.115516f,   0.5896379f, -0.546203f, -0.5949699f),
+        Vertex(0.063104f, 0.572345f, -0.08423099f,   0.5579008f, -0.6167297f, -0.5553297f),
+        Vertex(0.039709f, 0.5233859f, -0.06083599f,   0.7026057f, -0.1348039f, -0.6986937f),
+        Vertex(0.04987299f, 0.480678f, -0.07099999f,   0.508082f, 0.681345f, -0.5268981f),
+        Vertex(0.09951499f, 0.6942199f, -0.07096599f,   0.349712f, 0.9187108f, -0.183499f),
+        Vertex(0.135987f, 0.6640109f, -0.09241699f,   0.8399685f, 0.2640978f, -0.4740307f),
+        Vertex(0.119549f, 0.621303f, -0.08274099f,   0.723802f, -0.545768f, -0.422194f),
+        Vertex(0.08146299f, 0.572345f, -0.06032399f,   0.6828672f, -0.6162761f, -0.3922961f),
+        Vertex(0.05299f, 0.5233859f, -0.04355299f,   0.8591988f, -0.134679f, -0.4935979f),
+        Vertex(0.06539099f, 0.480678f, -0.050815f,   0.6268557f, 0.6811966f, -0.3781838f),
+        Vertex(0.113346f, 0.6942199f, -0.037539f,0.3861358f, 0.9183774f, -0.08649794f),
+        Vertex(0.154f, 0.6640109f, -0.048885f,0.9342605f, 0.2640958f, -0.2396049f),
+        Vertex(0.135681f, 0.621303f, -0.043764f,0.8092619f, -0.5447429f, -0.219887f),
+        Vertex(0.09323699f, 0.572345f, -0.031902f,   0.762155f, -0.615183f, -0.201667f),
+        Vertex(0.061512f, 0.5233859f, -0.023022f,0.9579774f, -0.1341731f, -0.2535291f),
+        Vertex(0.07535399f, 0.480678f, -0.026852f,   0.7038198f, 0.6808658f, -0.2026309f),
+        Vertex(0.154336f, 0.448734f, 0.0f,   0.2997631f, 0.9540052f, -0.004004001f),
+        Vertex(0.26591f, 0.425123f, 0.0f,   0.180158f, 0.983637f, -0.001176f),
+        Vertex(0.391373f, 0.405678f, 0.0f,   0.158462f, 0.987365f, 0.000232f),
+        Vertex(0.5085019f, 0.386234f, 0.0f,   0.213709f, 0.9768949f, 0.002171f),
+        Vertex(0.5950769f, 0.362623f, 0.0f,   0.4893011f, 0.8720632f, 0.009504002f),
+        Vertex(0.6288729f, 0.330678f, 0.0f,   0.6866069f, 0.7264099f, -0.02999f),
+        Vertex(0.148162f, 0.448734f, 0.047115f,0.2902378f, 0.9541165f, 0.07364396f),
+        Vertex(0.25581f, 0.425123f, 0.07707499f,0.174086f, 0.9836808f, 0.04545199f),
+        Vertex(0.376859f, 0.405678f, 0.110764f,0.152777f, 0.9874009f, 0.041212f),
+        Vertex(0.489867f, 0.386234f, 0.142215f,0.205547f, 0.9769628f, 0.05739299f),
+        Vertex(0.573395f, 0.362623f, 0.165462f,0.4695978f, 0.8723565f, 0.1359109f),
+        Vertex(0.6060019f, 0.330678f, 0.174537f,0.6706556f, 0.7267535f, 0.1484929f),
+        Vertex(0.130681f, 0.448734f, 0.08916099f,0.2606979f, 0.9542797f, 0.1462419f),
+        Vertex(0.227213f, 0.425123f, 0.145857f,0.156021f, 0.9837421f, 0.08893201f),
+        Vertex(0.335762f, 0.405678f, 0.209611f,0.136587f, 0.987448f, 0.079312f),
+        Vertex(0.437101f, 0.386234f, 0.26913f,0.183282f, 0.9770458f, 0.108577f),
+        Vertex(0.5120029f, 0.362623f, 0.313123f,0.417739f, 0.872696f, 0.252776f),
+        Vertex(0.541243f, 0.330678f, 0.330296f,0.6083308f, 0.7274598f, 0.3173889f),
+        Vertex(0.103451f, 0.448734f, 0.124579f,0.2140079f, 0.9543476f, 0.2083769f),
+        Vertex(0.182669f, 0.425123f, 0.203796f,0.1277159f, 0.9837666f, 0.1260629f),
+        Vertex(0.271748f, 0.405678f, 0.292875f,0.111442f, 0.9874658f, 0.111767f),
+        Vertex(0.35491f, 0.386234f, 0.376037f,0.1490049f, 0.9770753f, 0.1520559f),
+        Vertex(0.416377f, 0.362623f, 0.437505f,0.3383471f, 0.8728124f, 0.3517382f),
+        Vertex(0.440373f, 0.330678f, 0.4615f,   0.5055652f, 0.7278113f, 0.4633512f),
+        Vertex(0.06803399f, 0.448734f, 0.151808f,0.153158f, 0.9542928f, 0.2566469f),
+        Vertex(0.12473f, 0.425123f, 0.24834f,   0.09096196f, 0.9837446f, 0.1548299f),
+        Vertex(0.188484f, 0.405678f, 0.356889f,0.07891296f, 0.9874474f, 0.1368219f),
+        Vertex(0.248003f, 0.386234f, 0.458228f,0.104831f, 0.9770404f, 0.1854791f),
+        Vertex(0.291995f, 0.362623f, 0.5331299f,0.2363189f, 0.8726625f, 0.4273328f),
+        Vertex(0.309169f, 0.330678f, 0.5623699f,0.3692721f, 0.7276512f, 0.5780672f),
+        Vertex(0.025988f, 0.448734f, 0.169289f,0.08144902f, 0.9541363f, 0.2880801f),
+        Vertex(0.055948f, 0.425123f, 0.276938f,0.04774398f, 0.9836846f, 0.1734499f),
+        Vertex(0.08963699f, 0.405678f, 0.397986f,0.04076001f, 0.9874002f, 0.152903f),
+        Vertex(0.121088f, 0.386234f, 0.5109949f,0.05316397f, 0.9769543f, 0.2067209f),
+        Vertex(0.144335f, 0.362623f, 0.594523f,0.11736f, 0.8723071f, 0.474665f),
+        Vertex(0.15341f, 0.330678f, 0.6271299f,0.2070079f, 0.7270377f, 0.6546477f),
+        Vertex(-0.021127f, 0.448734f, 0.175463f,0.004004001f, 0.9540052f, 0.2997631f),
+        Vertex(-0.021127f, 0.425123f, 0.287037f,0.001176f, 0.9836369f, 0.180158f),
+        Vertex(-0.021127f, 0.405678f, 0.4125f,-0.000232f, 0.987365f, 0.158462f),
+        Vertex(-0.021127f, 0.386234f, 0.5296299f,-0.002171f, 0.9768949f, 0.213709f),
+        Vertex(-0.021127f, 0.362623f, 0.616204f,-0.009504002f, 0.8720632f, 0.4893011f),
+        Vertex(-0.021127f, 0.330678f, 0.6499999f,0.02999f, 0.7264099f, 0.6866069f),
+        Vertex(-0.06824199f, 0.448734f, 0.169289f,   -0.07364397f, 0.9541166f, 0.2902379f),
+        Vertex(-0.09820199f, 0.425123f, 0.276938f,   -0.04545199f, 0.9836808f, 0.174086f),
+        Vertex(-0.131891f, 0.405678f, 0.397986f,-0.041212f, 0.9874009f, 0.152777f),
+        Vertex(-0.163343f, 0.386234f, 0.5109949f,-0.05739299f, 0.9769628f, 0.205547f),
+        Vertex(-0.186589f, 0.362623f, 0.594523f,-0.1359109f, 0.8723565f, 0.4695978f),
+        Vertex(-0.195664f, 0.330678f, 0.6271299f,-0.1484929f, 0.7267535f, 0.6706556f),
+        Vertex(-0.110288f, 0.448734f, 0.151808f,-0.1462419f, 0.9542796f, 0.2606979f),
+        Vertex(-0.166985f, 0.425123f, 0.24834f,-0.08893201f, 0.9837421f, 0.156021f),
+        Vertex(-0.230738f, 0.405678f, 0.356889f,-0.079312f, 0.987448f, 0.136587f),
+        Vertex(-0.290258f, 0.386234f, 0.458228f,-0.108577f, 0.9770458f, 0.183282f),
+        Vertex(-0.33425f, 0.362623f, 0.5331299f,-0.252776f, 0.872696f, 0.417739f),
+        Vertex(-0.351424f, 0.330678f, 0.5623699f,-0.3173889f, 0.7274598f, 0.6083308f),
+        Vertex(-0.145706f, 0.448734f, 0.124579f,-0.2083769f, 0.9543477f, 0.2140079f),
+        Vertex(-0.224924f, 0.425123f, 0.203796f,-0.1260629f, 0.9837666f, 0.1277159f),
+        Vertex(-0.314002f, 0.405678f, 0.292875f,-0.111767f, 0.9874658f, 0.111442f),
+        Vertex(-0.397164f, 0.386234f, 0.376037f,-0.1520559f, 0.9770755f, 0.1490049f),
+        Vertex(-0.458632f, 0.362623f, 0.437505f,-0.3517382f, 0.8728124f, 0.3383471f),
+        Vertex(-0.482627f, 0.330678f, 0.4615f,-0.4633512f, 0.7278113f, 0.5055652f),
+        Vertex(-0.172935f, 0.448734f, 0.08916099f,   -0.2566469f, 0.9542928f, 0.153158f),
+        Vertex(-0.269467f, 0.425123f, 0.145857f,-0.1548299f, 0.9837446f, 0.09096196f),
+        Vertex(-0.378016f, 0.405678f, 0.209611f,-0.1368219f, 0.9874473f, 0.07891295f),
+        Vertex(-0.479355f, 0.386234f, 0.26913f,-0.1854791f, 0.9770404f, 0.104831f),
+        Vertex(-0.5542579f, 0.362623f, 0.313123f,-0.4273328f, 0.8726625f, 0.2363189f),
+        Vertex(-0.5834979f, 0.330678f, 0.330296f,-0.5780672f, 0.7276512f, 0.3692721f),
+        Vertex(-0.190416f, 0.448734f, 0.047115f,-0.2880801f, 0.9541363f, 0.08144902f),
+        Vertex(-0.298065f, 0.425123f, 0.07707499f,   -0.1734499f, 0.9836846f, 0.04774398f),
+        Vertex(-0.419113f, 0.405678f, 0.110764f,-0.152903f, 0.9874002f, 0.04076001f),
+        Vertex(-0.532122f, 0.386234f, 0.142215f,-0.2067209f, 0.9769543f, 0.05316397f),
+        Vertex(-0.6156499f, 0.362623f, 0.165462f,-0.474665f, 0.8723071f, 0.11736f),
+        Vertex(-0.648257f, 0.330678f, 0.174537f,-0.6546477f, 0.7270377f, 0.2070079f),
+        Vertex(-0.19659f, 0.448734f, 0.0f,   -0.2997631f, 0.9540052f, 0.004004001f),
+        Vertex(-0.308164f, 0.425123f, 0.0f,   -0.180158f, 0.983637f, 0.001176f),
+        Vertex(-0.433627f, 0.405678f, 0.0f,   -0.158462f, 0.987365f, -0.000232f),
+        Vertex(-0.5507569f, 0.386234f, 0.0f,   -0.213709f, 0.9768949f, -0.002171f),
+        Vertex(-0.6373309f, 0.362623f, 0.0f,   -0.4893011f, 0.8720632f, -0.009504002f),
+        Vertex(-0.671127f, 0.330678f, 0.0f,   -0.6866069f, 0.7264099f, 0.02999f),
+        Vertex(-0.190416f, 0.448734f, -0.047115f,-0.2902378f, 0.9541165f, -0.07364396f),
+        Vertex(-0.298065f, 0.425123f, -0.07707499f,   -0.174086f, 0.9836808f, -0.04545199f),
+        Vertex(-0.419113f, 0.405678f, -0.110764f,-0.152777f, 0.9874009f, -0.041212f),
+        Vertex(-0.532122f, 0.386234f, -0.142215f,-0.205547f, 0.9769628f, -0.05739299f),
+        Vertex(-0.6156499f, 0.362623f, -0.165462f,   -0.4695978f, 0.8723565f, -0.1359109f),
+        Vertex(-0.648257f, 0.330678f, -0.174537f,-0.6706556f, 0.7267535f, -0.1484929f),
+        Vertex(-0.172935f, 0.448734f, -0.08916099f,   -0.2606979f, 0.9542797f, -0.1462419f),
+        Vertex(-0.269467f, 0.425123f, -0.145857f,-0.156021f, 0.9837421f, -0.08893201f),
+        Vertex(-0.378016f, 0.405678f, -0.209611f,-0.136587f, 0.987448f, -0.079312f),
+        Vertex(-0.479355f, 0.386234f, -0.26913f,-0.183282f, 0.9770458f, -0.108577f),
+        Vertex(-0.5542579f, 0.362623f, -0.313123f,   -0.417739f, 0.872696f, -0.252776f),
+        Vertex(-0.5834979f, 0.330678f, -0.330296f,   -0.6083308f, 0.7274598f, -0.3173889f),
+        Vertex(-0.145706f, 0.448734f, -0.124579f,-0.2140079f, 0.9543476f, -0.2083769f),
+        Vertex(-0.224924f, 0.425123f, -0.203796f,-0.1277159f, 0.9837666f, -0.1260629f),
+        Vertex(-0.314002f, 0.405678f, -0.292875f,-0.111442f, 0.9874658f, -0.111767f),
+        Vertex(-0.397164f, 0.386234f, -0.376037f,-0.1490049f, 0.9770753f, -0.1520559f),
+        Vertex(-0.458632f, 0.362623f, -0.437505f,-0.3383471f, 0.8728124f, -0.3517382f),
+        Vertex(-0.482627f, 0.330678f, -0.4615f,-0.5055652f, 0.7278113f, -0.4633512f),
+        Vertex(-0.110288f, 0.448734f, -0.151808f,-0.153158f, 0.9542928f, -0.2566469f),
+        Vertex(-0.166985f, 0.425123f, -0.24834f,-0.09096196f, 0.9837446f, -0.1548299f),
+        Vertex(-0.230738f, 0.405678f, -0.356889f,-0.07891296f, 0.9874474f, -0.1368219f),
+        Vertex(-0.290258f, 0.386234f, -0.458228f,-0.104831f, 0.9770404f, -0.1854791f),
+        Vertex(-0.33425f, 0.362623f, -0.5331299f,-0.2363189f, 0.8726625f, -0.4273328f),
+        Vertex(-0.351424f, 0.330678f, -0.5623699f,   -0.3692721f, 0.7276512f, -0.5780672f),
+        Vertex(-0.06824199f, 0.448734f, -0.169289f,   -0.08144902f, 0.9541363f, -0.2880801f),
+        Vertex(-0.09820199f, 0.425123f, -0.276938f,   -0.04774398f, 0.9836846f, -0.1734499f),
+        Vertex(-0.131891f, 0.405678f, -0.397986f,-0.04076001f, 0.9874002f, -0.152903f),
+        Vertex(-0.163343f, 0.386234f, -0.5109949f,   -0.05316397f, 0.9769543f, -0.2067209f),
+        Vertex(-0.186589f, 0.362623f, -0.594523f,-0.11736f, 0.8723071f, -0.474665f),
+        Vertex(-0.195664f, 0.330678f, -0.6271299f,   -0.2070079f, 0.7270377f, -0.6546477f),
+        Vertex(-0.021127f, 0.448734f, -0.175463f,-0.004004001f, 0.9540052f, -0.2997631f),
+        Vertex(-0.021127f, 0.425123f, -0.287037f,-0.001176f, 0.9836369f, -0.180158f),
+        Vertex(-0.021127f, 0.405678f, -0.4125f,0.000232f, 0.987365f, -0.158462f),
+        Vertex(-0.021127f, 0.386234f, -0.5296299f,   0.002171f, 0.9768949f, -0.213709f),
+        Vertex(-0.021127f, 0.362623f, -0.616204f,0.009504002f, 0.8720632f, -0.4893011f),
+        Vertex(-0.021127f, 0.330678f, -0.6499999f,   -0.02999f, 0.7264099f, -0.6866069f),
+        Vertex(0.025988f, 0.448734f, -0.169289f,0.07364397f, 0.9541166f, -0.2902379f),
+        Vertex(0.055948f, 0.425123f, -0.276938f,0.04545199f, 0.9836808f, -0.174086f),
+        Vertex(0.08963699f, 0.405678f, -0.397986f,   0.041212f, 0.9874009f, -0.152777f),
+        Vertex(0.121088f, 0.386234f, -0.5109949f,0.05739299f, 0.9769628f, -0.205547f),
+        Vertex(0.144335f, 0.362623f, -0.594523f,0.1359109f, 0.8723565f, -0.4695978f),
+        Vertex(0.15341f, 0.330678f, -0.6271299f,0.1484929f, 0.7267535f, -0.6706556f),
+        Vertex(0.06803399f, 0.448734f, -0.151808f,   0.1462419f, 0.9542796f, -0.2606979f),
+        Vertex(0.12473f, 0.425123f, -0.24834f,0.08893201f, 0.9837421f, -0.156021f),
+        Vertex(0.188484f, 0.405678f, -0.356889f,0.079312f, 0.987448f, -0.136587f),
+        Vertex(0.248003f, 0.386234f, -0.458228f,0.108577f, 0.9770458f, -0.183282f),
+        Vertex(0.291996f, 0.362623f, -0.5331299f,0.252776f, 0.872696f, -0.417739f),
+        Vertex(0.309169f, 0.330678f, -0.5623699f,0.3173889f, 0.7274598f, -0.6083308f),
+        Vertex(0.103451f, 0.448734f, -0.124579f,0.2083769f, 0.9543477f, -0.2140079f),
+        Vertex(0.182669f, 0.425123f, -0.203796f,0.1260629f, 0.9837666f, -0.1277159f),
+        Vertex(0.271748f, 0.405678f, -0.292875f,0.111767f, 0.9874658f, -0.111442f),
+        Vertex(0.35491f, 0.386234f, -0.376037f,0.1520559f, 0.9770755f, -0.1490049f),
+        Vertex(0.416377f, 0.362623f, -0.437505f,0.3517382f, 0.8728124f, -0.3383471f),
+        Vertex(0.440373f, 0.330678f, -0.4615f,0.4633512f, 0.7278113f, -0.5055652f),
+        Vertex(0.130681f, 0.448734f, -0.08916099f,   0.2566469f, 0.9542928f, -0.153158f),
+        Vertex(0.227213f, 0.425123f, -0.145857f,0.1548299f, 0.9837446f, -0.09096196f),
+        Vertex(0.335762f, 0.405678f, -0.209611f,0.1368219f, 0.9874473f, -0.07891295f),
+        Vertex(0.437101f, 0.386234f, -0.26913f,0.1854791f, 0.9770404f, -0.104831f),
+        Vertex(0.5120029f, 0.362623f, -0.313123f,0.4273328f, 0.8726625f, -0.2363189f),
+        Vertex(0.541243f, 0.330678f, -0.330296f,0.5780672f, 0.7276512f, -0.3692721f),
+        Vertex(0.148162f, 0.448734f, -0.047115f,0.2880801f, 0.9541363f, -0.08144902f),
+        Vertex(0.25581f, 0.425123f, -0.07707499f,0.1734499f, 0.9836846f, -0.04774398f),
+        Vertex(0.376859f, 0.405678f, -0.110764f,0.152903f, 0.9874002f, -0.04076001f),
+        Vertex(0.489867f, 0.386234f, -0.142215f,0.2067209f, 0.9769543f, -0.05316397f),
+        Vertex(0.573395f, 0.362623f, -0.165462f,0.474665f, 0.8723071f, -0.11736f),
+        Vertex(0.6060019f, 0.330678f, -0.174537f,  0.6546477f, 0.7270377f, -0.2070079f),
+    };
+
+    static uint32_t TeapotIndices[] = 
+    {
+        0, 7, 8, 8, 1, 0, 1, 8, 9, 9, 2, 1, 2, 9, 10, 10, 3, 2, 3, 10, 11, 11, 4, 3, 4, 11, 12, 12, 5, 4, 5, 12, 13, 13,
+        6, 5, 7, 14, 15, 15, 8, 7, 8, 15, 16, 16, 9, 8, 9, 16, 17, 17, 10, 9, 10, 17, 18, 18, 11, 10, 11, 18, 19, 19, 12,
+        11, 12, 19, 20, 20, 13, 12, 14, 21, 22, 22, 15, 14, 15, 22, 23, 23, 16, 15, 16, 23, 24, 24, 17, 16, 17, 24, 25, 25,
+        18, 17, 18, 25, 26, 26, 19, 18, 19, 26, 27, 27, 20, 19, 21, 28, 29, 29, 22, 21, 22, 29, 30, 30, 23, 22, 23, 30, 31,
+        31, 24, 23, 24, 31, 32, 32, 25, 24, 25, 32, 33, 33, 26, 25, 26, 33, 34, 34, 27, 26, 28, 35, 36, 36, 29, 28, 29, 36,
+        37, 37, 30, 29, 30, 37, 38, 38, 31, 30, 31, 38, 39, 39, 32, 31, 32, 39, 40, 40, 33, 32, 33, 40, 41, 41, 34, 33, 35,
+        42, 43, 43, 36, 35, 36, 43, 44, 44, 37, 36, 37, 44, 45, 45, 38, 37, 38, 45, 46, 46, 39, 38, 39, 46, 47, 47, 40, 39,
+        40, 47, 48, 48, 41, 40, 42, 49, 50, 50, 43, 42, 43, 50, 51, 51, 44, 43, 44, 51, 52, 52, 45, 44, 45, 52, 53, 53, 46,
+        45, 46, 53, 54, 54, 47, 46, 47, 54, 55, 55, 48, 47, 49, 56, 57, 57, 50, 49, 50, 57, 58, 58, 51, 50, 51, 58, 59, 59,
+        52, 51, 52, 59, 60, 60, 53, 52, 53, 60, 61, 61, 54, 53, 54, 61, 62, 62, 55, 54, 56, 63, 64, 64, 57, 56, 57, 64, 65,
+        65, 58, 57, 58, 65, 66, 66, 59, 58, 59, 66, 67, 67, 60, 59, 60, 67, 68, 68, 61, 60, 61, 68, 69, 69, 62, 61, 63, 70,
+        71, 71, 64, 63, 64, 71, 72, 72, 65, 64, 65, 72, 73, 73, 66, 65, 66, 73, 74, 74, 67, 66, 67, 74, 75, 75, 68, 67, 68,
+        75, 76, 76, 69, 68, 70, 77, 78, 78, 71, 70, 71, 78, 79, 79, 72, 71, 72, 79, 80, 80, 73, 72, 73, 80, 81, 81, 74, 73,
+        74, 81, 82, 82, 75, 74, 75, 82, 83, 83, 76, 75, 77, 84, 85, 85, 78, 77, 78, 85, 86, 86, 79, 78, 79, 86, 87, 87, 80,
+        79, 80, 87, 88, 88, 81, 80, 81, 88, 89, 89, 82, 81, 82, 89, 90, 90, 83, 82, 84, 91, 92, 92, 85, 84, 85, 92, 93, 93,
+        86, 85, 86, 93, 94, 94, 87, 86, 87, 94, 95, 95, 88, 87, 88, 95, 96, 96, 89, 88, 89, 96, 97, 97, 90, 89, 91, 98, 99, 99, 92, 91, 92, 99, 100, 100, 93, 92, 93, 100, 101, 101, 94, 93, 94, 101, 102, 102, 95, 94, 95, 102, 103, 103, 96, 95, 96, 103, 104, 104, 97, 96, 98, 105, 106, 106, 99, 98, 99, 106, 107, 107, 100, 99, 100, 107, 108, 108, 101, 100, 101, 108, 109, 109, 102, 101, 102, 109, 110, 110, 103, 102, 103, 110, 111, 111, 104, 103, 105, 112, 113, 113, 106, 105, 106, 113, 114, 114, 107, 106, 107, 114, 115, 115, 108, 107, 108, 115, 116, 116, 109, 108, 109, 116, 117, 117, 110,
+        109, 110, 117, 118, 118, 111, 110, 112, 119, 120, 120, 113, 112, 113, 120, 121, 121, 114, 113, 114, 121, 122, 122, 115, 114, 115, 122, 123, 123, 116, 115, 116, 123, 124, 124, 117, 116, 117, 124, 125, 125, 118, 117, 119, 126, 127, 127, 120, 119, 120, 127, 128, 128, 121, 120, 121, 128, 129, 129, 122, 121, 122, 129, 130, 130, 123, 122, 123, 130, 131, 131, 124, 123, 124, 131, 132, 132, 125, 124, 126, 133, 134, 134, 127, 126, 127, 134, 135, 135, 128, 127, 128, 135, 136, 136, 129, 128, 129, 136, 137, 137, 130, 129, 130, 137, 138, 138, 131, 130, 131, 138, 139, 139, 132, 131, 133, 140, 141, 141, 134, 133, 134, 141, 142, 142, 135, 134, 135, 142, 143, 143, 136, 135, 136, 143, 144, 144, 137, 136, 137, 144, 145, 145, 138, 137, 138, 145, 146, 146, 139, 138, 140, 147, 148, 148, 141, 140, 141, 148, 149, 149, 142, 141, 142, 149, 150, 150, 143, 142, 143, 150, 151, 151, 144, 143, 144, 151, 152, 152, 145, 144, 145, 152, 153, 153, 146, 145, 147, 154, 155, 155, 148, 147, 148, 155, 156, 156, 149, 148, 149, 156, 157, 157, 150, 149, 150, 157, 158, 158, 151, 150, 151, 158, 159, 159, 152, 151, 152, 159, 160, 160, 153, 152, 154, 161, 162, 162, 155, 154, 155, 162, 163, 163, 156, 155, 156, 163, 164, 164, 157, 156, 157, 164, 165, 165, 158, 157, 158, 165, 166, 166, 159, 158, 159, 166, 167, 167, 160, 159, 161, 0, 1, 1, 162, 161, 162, 1, 2, 2, 163, 162, 163, 2, 3, 3, 164, 163, 164, 3, 4, 4, 165, 164, 165, 4, 5, 5, 166, 165, 166, 5, 6, 6, 167, 166, 6, 13, 174, 174, 168, 6, 168, 174, 175, 175, 169, 168, 169, 175, 176, 176, 170, 169, 170, 176, 177, 177, 171, 170, 171, 177, 178, 178, 172, 171, 172, 178, 179, 179, 173, 172, 13, 20, 180, 180, 174, 13, 174, 180, 181, 181, 175, 174, 175, 181, 182, 182, 176, 175, 176, 182, 183, 183, 177, 176, 177, 183, 184, 184, 178, 177, 178, 184, 185, 185, 179, 178, 20, 27, 186, 186, 180, 20, 180, 186, 187, 187, 181, 180, 181, 187, 188, 188, 182, 181, 182, 188, 189, 189, 183, 182, 183, 189, 190, 190, 184, 183, 184, 190, 191, 191, 185, 184, 27, 34, 192, 192, 186, 27, 186, 192, 193, 193, 187, 186, 187, 193, 194, 194, 188, 187, 188, 194, 195, 195, 189, 188, 189, 195, 196, 196, 190, 189, 190, 196, 197, 197, 191, 190, 34, 41, 198, 198, 192, 34, 192, 198, 199, 199, 193, 192, 193, 199, 200, 200, 194, 193, 194, 200, 201, 201, 195, 194, 195, 201, 202, 202, 196, 195, 196, 202, 203, 203, 197, 196, 41, 48, 204, 204, 198, 41, 198, 204, 205, 205, 199, 198, 199, 205, 206, 206, 200, 199, 200, 206, 207, 207, 201, 200, 201, 207, 208, 208, 202, 201, 202, 208, 209, 209, 203, 202, 48, 55, 210, 210, 204, 48, 204, 210, 211, 211, 205, 204, 205, 211, 212, 212, 206, 205, 206, 212, 213, 213, 207, 206, 207, 213, 214, 214, 208, 207, 208, 214, 215, 215, 209, 208, 55, 62, 216, 216, 210, 55, 210, 216, 217, 217, 211, 210, 211, 217, 218, 218, 212, 211, 212, 218, 219, 219, 213, 212, 213, 219, 220, 220, 214, 213, 214, 220, 221, 221, 215, 214,
+        62, 69, 222, 222, 216, 62, 216, 222, 223, 223, 217, 216, 217, 223, 224, 224, 218, 217, 218, 224, 225, 225, 219, 218, 219, 225, 226, 226, 220, 219, 220, 226, 227, 227, 221, 220, 69, 76, 228, 228, 222, 69, 222, 228, 229, 229, 223, 222, 223, 229, 230, 230, 224, 223, 224, 230, 231, 231, 225, 224, 225, 231, 232, 232, 226, 225, 226, 232, 233, 233, 227, 226, 76, 83, 234, 234, 228, 76, 228, 234, 235, 235, 229, 228, 229, 235, 236, 236, 230, 229, 230, 236, 237, 237, 231, 230, 231, 237, 238, 238, 232, 231, 232, 238, 239, 239, 233, 232, 83, 90, 240, 240, 234, 83, 234, 240, 241, 241, 235,
+        234, 235, 241, 242, 242, 236, 235, 236, 242, 243, 243, 237, 236, 237, 243, 244, 244, 238, 237, 238, 244, 245, 245, 239, 238, 90, 97, 246, 246, 240, 90, 240, 246, 247, 247, 241, 240, 241, 247, 248, 248, 242, 241, 242, 248, 249, 249, 243, 242, 243, 249, 250, 250, 244, 243, 244, 250, 251, 251, 245, 244, 97, 104, 252, 252, 246, 97, 246, 252, 253, 253, 247, 246, 247, 253, 254, 254, 248, 247, 248, 254, 255, 255, 249, 248, 249, 255, 256, 256, 250, 249, 250, 256, 257, 257, 251, 250, 104, 111, 258, 258, 252, 104, 252, 258, 259, 259, 253, 252, 253, 259, 260, 260, 254, 253, 254, 260, 261, 261, 255, 254, 255, 261, 262, 262, 256, 255, 256, 262, 263, 263, 257, 256, 111, 118, 264, 264, 258, 111, 258, 264, 265, 265, 259, 258, 259, 265, 266, 266, 260, 259, 260, 266, 267, 267, 261, 260, 261, 267, 268, 268, 262, 261, 262, 268, 269, 269, 263, 262, 118, 125, 270, 270, 264, 118, 264, 270, 271, 271, 265, 264, 265, 271, 272, 272, 266, 265, 266, 272, 273, 273, 267, 266, 267, 273, 274, 274, 268, 267, 268, 274, 275, 275, 269, 268, 125, 132, 276, 276, 270, 125, 270, 276, 277, 277, 271, 270, 271, 277, 278, 278, 272, 271, 272, 278, 279, 279, 273, 272, 273, 279, 280, 280, 274, 273, 274, 280, 281, 281, 275, 274, 132, 139, 282, 282, 276, 132, 276, 282, 283, 283, 277, 276, 277, 283, 284, 284, 278, 277, 278, 284, 285, 285, 279, 278, 279, 285, 286, 286, 280, 279, 280, 286, 287, 287, 281, 280, 139, 146, 288, 288, 282, 139, 282, 288, 289, 289, 283, 282, 283, 289, 290, 290, 284, 283, 284, 290, 291, 291, 285, 284, 285, 291, 292, 292, 286, 285, 286, 292, 293, 293, 287, 286, 146, 153, 294, 294, 288, 146, 288, 294, 295, 295, 289, 288, 289, 295, 296, 296, 290, 289, 290, 296, 297, 297, 291, 290, 291, 297, 298, 298, 292, 291, 292, 298, 299, 299, 293, 292, 153, 160, 300, 300, 294, 153, 294, 300, 301, 301, 295, 294, 295, 301, 302, 302, 296, 295, 296, 302, 303, 303, 297, 296, 297, 303, 304, 304, 298, 297, 298, 304, 305, 305, 299, 298, 160, 167, 306, 306, 300, 160, 300, 306, 307, 307, 301, 300, 301, 307, 308, 308, 302, 301, 302, 308, 309, 309, 303, 302, 303, 309, 310, 310, 304, 303, 304, 310, 311, 311, 305, 304, 167, 6, 168, 168, 306, 167, 306, 168, 169, 169, 307, 306, 307, 169, 170, 170, 308, 307, 308, 170, 171, 171, 309, 308, 309, 171, 172, 172, 310, 309, 310, 172, 173, 173, 311, 310, 173, 179, 318, 318, 312, 173, 312, 318, 319, 319, 313, 312, 313, 319, 320, 320, 314, 313, 314, 320, 321, 321, 315, 314, 315, 321, 322, 322, 316, 315, 316, 322, 323, 323, 317, 316, 179, 185, 324, 324, 318, 179, 318, 324, 325, 325, 319, 318, 319, 325, 326, 326, 320, 319, 320, 326, 327, 327, 321, 320, 321, 327, 328, 328, 322, 321, 322, 328, 329, 329, 323, 322, 185, 191, 330, 330, 324, 185, 324, 330, 331, 331, 325, 324, 325, 331, 332, 332, 326, 325, 326, 332, 333, 333, 327, 326, 327, 333, 334, 334, 328, 327, 328, 334, 335, 335, 329, 328, 191, 197, 336, 336, 330, 191, 330,
+        336, 337, 337, 331, 330, 331, 337, 338, 338, 332, 331, 332, 338, 339, 339, 333, 332, 333, 339, 340, 340, 334, 333, 334, 340, 341, 341, 335, 334, 197, 203, 342, 342, 336, 197, 336, 342, 343, 343, 337, 336, 337, 343, 344, 344, 338, 337, 338, 344, 345, 345, 339, 338, 339, 345, 346, 346, 340, 339, 340, 346, 347, 347, 341, 340, 203, 209, 348, 348, 342, 203, 342, 348, 349, 349, 343, 342, 343, 349, 350, 350, 344, 343, 344, 350, 351, 351, 345, 344, 345, 351, 352, 352, 346, 345, 346, 352, 353, 353, 347, 346, 209, 215, 354, 354, 348, 209, 348, 354, 355, 355, 349, 348, 349, 355, 356,
+        356, 350, 349, 350, 356, 357, 357, 351, 350, 351, 357, 358, 358, 352, 351, 352, 358, 359, 359, 353, 352, 215, 221, 360, 360, 354, 215, 354, 360, 361, 361, 355, 354, 355, 361, 362, 362, 356, 355, 356, 362, 363, 363, 357, 356, 357, 363, 364, 364, 358, 357, 358, 364, 365, 365, 359, 358, 221, 227, 366, 366, 360, 221, 360, 366, 367, 367, 361, 360, 361, 367, 368, 368, 362, 361, 362, 368, 369, 369, 363, 362, 363, 369, 370, 370, 364, 363, 364, 370, 371, 371, 365, 364, 227, 233, 372, 372, 366, 227, 366, 372, 373, 373, 367, 366, 367, 373, 374, 374, 368, 367, 368, 374, 375, 375, 369, 368, 369, 375, 376, 376, 370, 369, 370, 376, 377, 377, 371, 370, 233, 239, 378, 378, 372, 233, 372, 378, 379, 379, 373, 372, 373, 379, 380, 380, 374, 373, 374, 380, 381, 381, 375, 374, 375, 381, 382, 382, 376, 375, 376, 382, 383, 383, 377, 376, 239, 245, 384, 384, 378, 239, 378, 384, 385, 385, 379, 378, 379, 385, 386, 386, 380, 379, 380, 386, 387, 387, 381, 380, 381, 387, 388, 388, 382, 381, 382, 388, 389, 389, 383, 382, 245, 251, 390, 390, 384, 245, 384, 390, 391, 391, 385, 384, 385, 391, 392, 392, 386, 385, 386, 392, 393, 393, 387, 386, 387, 393, 394, 394, 388, 387, 388, 394, 395, 395, 389, 388, 251, 257, 396, 396, 390, 251, 390, 396, 397, 397, 391, 390, 391, 397, 398, 398, 392, 391, 392, 398, 399, 399, 393, 392, 393, 399, 400, 400, 394, 393, 394, 400, 401, 401, 395, 394, 257, 263, 402, 402, 396, 257, 396, 402, 403, 403, 397, 396, 397, 403, 404, 404, 398, 397, 398, 404, 405, 405, 399, 398, 399, 405, 406, 406, 400, 399, 400, 406, 407, 407, 401, 400, 263, 269, 408, 408, 402, 263, 402,
+        408, 409, 409, 403, 402, 403, 409, 410, 410, 404, 403, 404, 410, 411, 411, 405, 404, 405, 411, 412, 412, 406, 405, 406, 412, 413, 413, 407, 406, 269, 275, 414, 414, 408, 269, 408, 414, 415, 415, 409, 408, 409, 415, 416, 416, 410, 409, 410, 416, 417, 417, 411, 410, 411, 417, 418, 418, 412, 411, 412, 418, 419, 419, 413, 412, 275, 281, 420, 420, 414, 275, 414, 420, 421, 421, 415, 414, 415, 421, 422, 422, 416, 415, 416, 422, 423, 423, 417, 416, 417, 423, 424, 424, 418, 417, 418, 424, 425, 425, 419, 418, 281, 287, 426, 426, 420, 281, 420, 426, 427, 427, 421, 420, 421, 427, 428, 428, 422, 421, 422, 428, 429, 429, 423, 422, 423, 429, 430, 430, 424, 423, 424, 430, 431, 431, 425, 424, 287, 293, 432, 432, 426, 287, 426, 432, 433, 433, 427, 426, 427, 433, 434, 434, 428, 427, 428, 434, 435, 435, 429, 428, 429, 435, 436, 436, 430, 429, 430, 436, 437, 437, 431, 430, 293, 299, 438, 438, 432, 293, 432, 438, 439, 439, 433, 432, 433, 439, 440, 440, 434, 433, 434, 440, 441, 441, 435, 434, 435, 441, 442, 442, 436, 435, 436, 442, 443, 443, 437, 436, 299, 305, 444, 444, 438, 299, 438, 444, 445, 445, 439, 438, 439, 445, 446, 446, 440, 439, 440, 446, 447, 447, 441, 440, 441, 447, 448, 448, 442, 441, 442, 448, 449, 449, 443, 442, 305, 311, 450, 450, 444, 305, 444, 450, 451, 451, 445, 444, 445, 451, 452, 452, 446, 445, 446, 452, 453, 453, 447, 446, 447, 453, 454, 454, 448, 447, 448, 454, 455, 455, 449, 448, 311, 173, 312, 312, 450, 311, 450, 312, 313, 313, 451, 450, 451, 313, 314, 314, 452, 451, 452, 314, 315, 315, 453, 452, 453, 315, 316, 316, 454, 453, 454, 316, 317, 317, 455, 454, 317, 323, 462, 462, 456, 317, 456, 462, 463, 463, 457, 456, 457, 463, 464, 464, 458, 457, 458, 464, 465, 465, 459, 458, 459, 465, 466, 466, 460, 459, 460, 466, 461, 323, 329, 467, 467, 462, 323, 462, 467, 468, 468, 463, 462, 463, 468, 469, 469, 464, 463, 464, 469, 470, 470, 465, 464, 465, 470, 471, 471, 466, 465, 466, 471, 461, 329, 335, 472, 472, 467, 329, 467, 472, 473, 473, 468, 467, 468, 473, 474, 474, 469, 468, 469, 474, 475, 475, 470, 469, 470, 475, 476, 476, 471, 470, 471, 476, 461, 335, 341, 477, 477, 472, 335, 472, 477, 478, 478, 473, 472, 473, 478, 479, 479, 474, 473, 474, 479, 480, 480, 475, 474, 475, 480, 481, 481, 476, 475, 476, 481, 461, 341, 347, 482, 482, 477, 341, 477, 482, 483, 483, 478, 477, 478, 483, 484, 484, 479, 478, 479, 484, 485, 485, 480, 479, 480, 485, 486, 486, 481, 480, 481, 486, 461, 347, 353, 487, 487, 482, 347, 482, 487, 488, 488, 483, 482, 483, 488, 489, 489, 484, 483, 484, 489, 490, 490, 485, 484, 485, 490, 491, 491, 486, 485, 486, 491, 461, 353, 359, 492, 492, 487, 353, 487, 492, 493, 493, 488, 487, 488, 493, 494, 494, 489, 488, 489, 494, 495, 495, 490, 489, 490, 495, 496, 496, 491, 490, 491, 496, 461, 359, 365, 497, 497, 492, 359, 492, 497, 498, 498, 493, 492, 493, 498, 499, 499, 494, 493, 494, 499, 500, 500,
+        495, 494, 495, 500, 501, 501, 496, 495, 496, 501, 461, 365, 371, 502, 502, 497, 365, 497, 502, 503, 503, 498, 497, 498, 503, 504, 504, 499, 498, 499, 504, 505, 505, 500, 499, 500, 505, 506, 506, 501, 500, 501, 506, 461, 371, 377, 507, 507, 502, 371, 502, 507, 508, 508, 503, 502, 503, 508, 509, 509, 504, 503, 504, 509, 510, 510, 505, 504, 505, 510, 511, 511, 506, 505, 506, 511, 461, 377, 383, 512, 512, 507, 377, 507, 512, 513, 513, 508, 507, 508, 513, 514, 514, 509, 508, 509, 514, 515, 515, 510, 509, 510, 515, 516, 516, 511, 510, 511, 516, 461, 383, 389, 517, 517, 512, 383, 512, 517, 518, 518, 513, 512, 513, 518, 519, 519, 514, 513, 514, 519, 520, 520, 515, 514, 515, 520, 521, 521, 516, 515, 516, 521, 461, 389, 395, 522, 522, 517, 389, 517, 522, 523, 523, 518, 517, 518, 523, 524, 524, 519, 518, 519, 524, 525, 525, 520, 519, 520, 525, 526, 526, 521, 520, 521, 526, 461, 395, 401, 527, 527, 522, 395, 522, 527, 528, 528, 523, 522, 523, 528, 529, 529, 524, 523, 524, 529, 530, 530, 525, 524, 525, 530, 531, 531, 526, 525, 526, 531, 461, 401, 407, 532, 532, 527, 401, 527, 532, 533, 533, 528, 527, 528, 533, 534, 534, 529, 528, 529, 534, 535, 535, 530, 529, 530, 535, 536, 536, 531, 530, 531, 536, 461, 407, 413, 537, 537, 532, 407, 532, 537, 538, 538, 533, 532, 533, 538, 539, 539, 534, 533, 534, 539, 540, 540, 535, 534, 535, 540, 541, 541, 536, 535, 536, 541, 461, 413, 419, 542, 542, 537, 413, 537, 542, 543, 543, 538, 537, 538, 543, 544, 544, 539, 538, 539, 544, 545, 545, 540, 539, 540, 545, 546, 546, 541, 540, 541, 546, 461, 419, 425, 547, 547, 542, 419, 542, 547, 548, 548, 543, 542, 543, 548, 549, 549, 544, 543, 544, 549, 550, 550, 545, 544, 545, 550, 551, 551, 546, 545, 546, 551, 461, 425, 431, 552, 552, 547, 425, 547, 552, 553, 553, 548, 547, 548, 553, 554, 554, 549, 548, 549, 554, 555, 555, 550, 549, 550, 555, 556, 556, 551, 550, 551, 556, 461, 431, 437, 557, 557, 552, 431, 552, 557, 558, 558, 553, 552, 553, 558, 559, 559, 554, 553, 554, 559, 560, 560, 555, 554, 555, 560, 561, 561, 556, 555, 556, 561, 461, 437, 443, 562, 562, 557, 437, 557, 562, 563, 563, 558, 557, 558, 563, 564, 564, 559, 558, 559, 564, 565, 565, 560, 559, 560, 565, 566, 566, 561, 560, 561, 566, 461, 443, 449, 567, 567, 562, 443, 562, 567, 568, 568, 563, 562, 563, 568, 569, 569, 564, 563, 564, 569, 570, 570, 565, 564, 565, 570, 571, 571, 566, 565, 566, 571, 461, 449, 455, 572, 572, 567, 449, 567, 572, 573, 573, 568, 567, 568, 573, 574, 574, 569, 568, 569, 574, 575, 575, 570, 569, 570, 575, 576, 576, 571, 570, 571, 576, 461, 455, 317, 456, 456, 572, 455, 572, 456, 457, 457, 573, 572, 573, 457, 458, 458, 574, 573, 574, 458, 459, 459, 575, 574, 575, 459, 460, 460, 576, 575, 576, 460, 461, 577, 584, 585, 585, 578, 577, 578, 585, 586, 586, 579, 578, 579, 586, 587, 587, 580, 579, 580, 587, 588, 588, 581, 580, 581, 588, 589, 589, 582, 581, 582,
+        589, 590, 590, 583, 582, 584, 591, 592, 592, 585, 584, 585, 592, 593, 593, 586, 585, 586, 593, 594, 594, 587, 586, 587, 594, 595, 595, 588, 587, 588, 595, 596, 596, 589, 588, 589, 596, 597, 597, 590, 589, 591, 598, 599, 599, 592, 591, 592, 599, 600, 600, 593, 592, 593, 600, 601, 601, 594, 593, 594, 601, 602, 602, 595, 594, 595, 602, 603, 603, 596, 595, 596, 603, 604, 604, 597, 596, 598, 605, 606, 606, 599, 598, 599, 606, 607, 607, 600, 599, 600, 607, 608, 608, 601, 600, 601, 608, 609, 609, 602, 601, 602, 609, 610, 610, 603, 602, 603, 610, 611, 611, 604, 603, 605, 612, 613, 613, 606, 605, 606, 613, 614, 614, 607, 606, 607, 614, 615, 615, 608, 607, 608, 615, 616, 616, 609, 608, 609, 616, 617, 617, 610, 609, 610, 617, 618, 618, 611, 610, 612, 619, 620, 620, 613, 612, 613, 620, 621, 621, 614, 613, 614, 621, 622, 622, 615, 614, 615, 622, 623, 623, 616, 615, 616, 623, 624, 624, 617, 616, 617, 624, 625, 625, 618, 617, 619, 626, 627, 627, 620, 619, 620, 627, 628, 628, 621, 620, 621, 628, 629, 629, 622, 621, 622, 629, 630, 630, 623, 622, 623, 630, 631, 631, 624, 623, 624, 631, 632, 632, 625, 624, 626, 633, 634, 634, 627, 626, 627, 634, 635, 635, 628, 627, 628, 635, 636, 636, 629, 628, 629, 636, 637, 637, 630, 629, 630, 637, 638, 638, 631, 630, 631, 638, 639, 639,
+        632, 631, 633, 640, 641, 641, 634, 633, 634, 641, 642, 642, 635, 634, 635, 642, 643, 643, 636, 635, 636, 643, 644, 644, 637, 636, 637, 644, 645, 645, 638, 637, 638, 645, 646, 646, 639, 638, 640, 647, 648, 648, 641, 640, 641, 648, 649, 649, 642, 641, 642, 649, 650, 650, 643, 642, 643, 650, 651, 651, 644, 643, 644, 651, 652, 652, 645, 644, 645, 652, 653, 653, 646, 645, 647, 654, 655, 655, 648, 647, 648, 655, 656, 656, 649, 648, 649, 656, 657, 657, 650, 649, 650, 657, 658, 658, 651, 650, 651, 658, 659, 659, 652, 651, 652, 659, 660, 660, 653, 652, 654, 577, 578, 578, 655, 654, 655, 578, 579, 579, 656, 655, 656, 579, 580, 580, 657, 656, 657, 580, 581, 581, 658, 657, 658, 581, 582, 582, 659, 658, 659, 582, 583, 583, 660, 659, 583, 590, 667, 667, 661, 583, 661, 667, 668, 668, 662, 661, 662, 668, 669, 669, 663, 662, 663, 669, 670, 670, 664, 663, 664, 670, 671, 671, 665, 664, 665, 671, 672, 672, 666, 665, 590, 597, 673, 673, 667, 590, 667, 673, 674, 674, 668, 667, 668, 674, 675, 675, 669, 668, 669, 675, 676, 676, 670, 669, 670, 676, 677, 677, 671, 670, 671, 677, 678, 678, 672, 671, 597, 604, 679, 679, 673, 597, 673, 679, 680, 680, 674, 673, 674, 680, 681, 681, 675, 674, 675, 681, 682, 682, 676, 675, 676, 682, 683, 683, 677, 676, 677, 683, 684, 684, 678, 677, 604, 611, 685, 685, 679, 604, 679, 685, 686, 686, 680, 679, 680, 686, 687, 687, 681, 680, 681, 687, 688, 688, 682, 681, 682, 688, 689, 689, 683, 682, 683, 689, 690, 690, 684, 683, 611, 618, 691, 691, 685, 611, 685, 691, 692, 692, 686, 685, 686, 692, 693, 693, 687, 686, 687, 693, 694, 694, 688, 687, 688, 694, 695, 695, 689, 688, 689, 695, 696, 696, 690, 689, 618, 625, 697, 697, 691, 618, 691, 697, 698, 698, 692, 691, 692, 698, 699, 699, 693, 692, 693, 699, 700, 700, 694, 693, 694, 700, 701, 701, 695, 694, 695, 701, 702, 702, 696, 695, 625, 632, 703, 703, 697, 625, 697, 703, 704, 704, 698, 697, 698, 704, 705, 705, 699, 698, 699, 705, 706, 706, 700, 699, 700, 706, 707, 707, 701, 700, 701, 707, 708, 708, 702, 701, 632, 639, 709, 709, 703, 632, 703, 709, 710, 710, 704, 703, 704, 710, 711, 711, 705, 704, 705, 711, 712, 712, 706, 705, 706, 712, 713, 713, 707, 706, 707, 713, 714, 714, 708, 707, 639, 646, 715, 715, 709, 639, 709, 715, 716, 716, 710, 709, 710, 716, 717, 717, 711, 710, 711, 717, 718, 718, 712, 711, 712, 718, 719, 719, 713, 712, 713, 719, 720, 720, 714, 713, 646, 653, 721, 721, 715, 646, 715, 721, 722, 722, 716, 715, 716, 722, 723, 723, 717, 716, 717, 723, 724, 724, 718, 717, 718, 724, 725, 725, 719, 718, 719, 725, 726, 726, 720, 719, 653, 660, 727, 727, 721, 653, 721, 727, 728, 728, 722, 721, 722, 728, 729, 729, 723, 722, 723, 729, 730, 730, 724, 723, 724, 730, 731, 731, 725, 724, 725, 731, 732, 732, 726, 725, 660, 583, 661, 661, 727, 660, 727, 661, 662, 662, 728, 727, 728, 662, 663, 663, 729, 728, 729, 663, 664, 664, 730, 729, 730, 664, 665, 665,
+        731, 730, 731, 665, 666, 666, 732, 731, 733, 740, 741, 741, 734, 733, 734, 741, 742, 742, 735, 734, 735, 742, 743, 743, 736, 735, 736, 743, 744, 744, 737, 736, 737, 744, 745, 745, 738, 737, 738, 745, 746, 746, 739, 738, 740, 747, 748, 748, 741, 740, 741, 748, 749, 749, 742, 741, 742, 749, 750, 750, 743, 742, 743, 750, 751, 751, 744, 743, 744, 751, 752, 752, 745, 744, 745, 752, 753, 753, 746, 745, 747, 754, 755, 755, 748, 747, 748, 755, 756, 756, 749, 748, 749, 756, 757, 757, 750, 749, 750, 757, 758, 758, 751, 750, 751, 758, 759, 759, 752, 751, 752, 759, 760, 760, 753, 752, 754, 761, 762, 762, 755, 754, 755, 762, 763, 763, 756, 755, 756, 763, 764, 764, 757, 756, 757, 764, 765, 765, 758, 757, 758, 765, 766, 766, 759, 758, 759, 766, 767, 767, 760, 759, 761, 768, 769, 769, 762, 761, 762, 769, 770, 770, 763, 762, 763, 770, 771, 771, 764, 763, 764, 771, 772, 772, 765, 764, 765, 772, 773, 773, 766, 765, 766, 773, 774, 774, 767, 766, 768, 775, 776, 776, 769, 768, 769, 776, 777, 777, 770, 769, 770, 777, 778, 778, 771, 770, 771, 778, 779, 779, 772, 771, 772, 779, 780, 780, 773, 772, 773, 780, 781, 781, 774, 773, 775, 782, 783, 783, 776, 775, 776, 783, 784, 784, 777, 776, 777, 784, 785, 785, 778, 777, 778, 785, 786, 786, 779, 778, 779, 786, 787, 787, 780, 779, 780, 787, 788, 788, 781, 780, 782, 789, 790, 790, 783, 782, 783, 790, 791, 791, 784, 783, 784, 791, 792, 792, 785, 784, 785, 792, 793, 793, 786, 785, 786, 793, 794, 794, 787, 786, 787, 794, 795, 795, 788, 787, 789, 796, 797, 797, 790, 789, 790, 797, 798, 798, 791, 790, 791, 798, 799, 799, 792, 791, 792, 799, 800, 800, 793, 792, 793, 800, 801, 801, 794, 793, 794, 801, 802, 802, 795, 794, 796, 803, 804, 804, 797, 796, 797, 804, 805, 805, 798, 797, 798, 805, 806, 806, 799, 798, 799, 806, 807, 807, 800, 799, 800, 807, 808, 808, 801, 800, 801, 808, 809, 809, 802, 801, 803, 810, 811, 811, 804, 803, 804, 811, 812, 812, 805, 804, 805, 812, 813, 813, 806, 805, 806, 813, 814, 814, 807, 806, 807, 814, 815, 815, 808, 807, 808, 815, 816, 816, 809, 808, 810, 733, 734, 734, 811, 810, 811, 734, 735, 735, 812, 811, 812, 735, 736, 736, 813, 812, 813, 736, 737, 737, 814, 813, 814, 737, 738, 738, 815, 814, 815, 738, 739, 739, 816, 815, 739, 746, 823, 823, 817, 739, 817, 823, 824, 824, 818, 817, 818, 824, 825, 825, 819, 818, 819, 825, 826, 826, 820, 819, 820, 826, 827, 827, 821, 820, 821, 827, 828, 828, 822, 821, 746, 753, 829, 829, 823, 746, 823, 829, 830, 830, 824, 823, 824, 830, 831, 831, 825, 824, 825, 831, 832, 832, 826, 825, 826, 832, 833, 833, 827, 826, 827, 833, 834, 834, 828, 827, 753, 760, 835, 835, 829, 753, 829, 835, 836, 836, 830, 829, 830, 836, 837, 837, 831, 830, 831, 837, 838, 838, 832, 831, 832, 838, 839, 839, 833, 832, 833, 839, 840, 840, 834, 833, 760, 767, 841, 841, 835, 760, 835, 841, 842, 842, 836, 835, 836, 842, 843, 843, 837, 836, 837, 843, 844, 844,
+        838, 837, 838, 844, 845, 845, 839, 838, 839, 845, 846, 846, 840, 839, 767, 774, 847, 847, 841, 767, 841, 847, 848, 848, 842, 841, 842, 848, 849, 849, 843, 842, 843, 849, 850, 850, 844, 843, 844, 850, 851, 851, 845, 844, 845, 851, 852, 852, 846, 845, 774, 781, 853, 853, 847, 774, 847, 853, 854, 854, 848, 847, 848, 854, 855, 855, 849, 848, 849, 855, 856, 856, 850, 849, 850, 856, 857, 857, 851, 850, 851, 857, 858, 858, 852, 851, 781, 788, 859, 859, 853, 781, 853, 859, 860, 860, 854, 853, 854, 860, 861, 861, 855, 854, 855, 861, 862, 862, 856, 855, 856, 862, 863, 863, 857, 856, 857, 863, 864, 864, 858, 857, 788, 795, 865, 865, 859, 788, 859, 865, 866, 866, 860, 859, 860, 866, 867, 867, 861, 860, 861, 867, 868, 868, 862, 861, 862, 868, 869, 869, 863, 862, 863, 869, 870, 870, 864, 863, 795, 802, 871, 871, 865, 795, 865, 871, 872, 872, 866, 865, 866, 872, 873, 873, 867, 866, 867, 873, 874, 874, 868, 867, 868, 874, 875, 875, 869, 868, 869, 875, 876, 876, 870, 869, 802, 809, 877, 877, 871, 802, 871, 877, 878, 878, 872, 871, 872, 878, 879, 879, 873, 872, 873, 879, 880, 880, 874, 873, 874, 880, 881, 881, 875, 874, 875, 881, 882, 882, 876, 875, 809, 816, 883, 883, 877, 809, 877, 883, 884, 884, 878, 877, 878, 884, 885, 885, 879, 878, 879, 885, 886, 886, 880, 879, 880, 886, 887, 887, 881, 880, 881, 887, 888, 888, 882, 881, 816, 739, 817, 817, 883, 816, 883, 817, 818, 818, 884, 883, 884, 818, 819, 819, 885, 884, 885, 819, 820, 820, 886, 885, 886, 820, 821, 821, 887, 886, 887, 821, 822, 822, 888, 887, 896, 890, 889, 890, 896, 897, 897, 891, 890, 891, 897, 898, 898, 892, 891, 892, 898, 899, 899, 893, 892, 893, 899, 900, 900, 894, 893, 894, 900, 901, 901, 895, 894, 902, 896, 889, 896, 902, 903, 903, 897, 896, 897, 903, 904, 904, 898, 897,
+        898, 904, 905, 905, 899, 898, 899, 905, 906, 906, 900, 899, 900, 906, 907, 907, 901, 900, 908, 902, 889, 902, 908, 909, 909, 903, 902, 903, 909, 910, 910, 904, 903, 904, 910, 911, 911, 905, 904, 905, 911, 912, 912, 906, 905, 906, 912, 913, 913, 907, 906, 914, 908, 889, 908, 914, 915, 915, 909, 908, 909, 915, 916, 916, 910, 909, 910, 916, 917, 917, 911, 910, 911, 917, 918, 918, 912, 911, 912, 918, 919, 919, 913, 912, 920, 914, 889, 914, 920, 921, 921, 915, 914, 915, 921, 922, 922, 916, 915, 916, 922, 923, 923, 917, 916, 917, 923, 924, 924, 918, 917, 918, 924, 925, 925, 919, 918, 926, 920, 889, 920, 926, 927, 927, 921, 920, 921, 927, 928, 928, 922, 921, 922, 928, 929, 929, 923, 922, 923, 929, 930, 930, 924, 923, 924, 930, 931, 931, 925, 924, 932, 926, 889, 926, 932, 933, 933, 927, 926, 927, 933, 934, 934, 928, 927, 928, 934, 935, 935, 929, 928, 929, 935, 936, 936, 930, 929, 930, 936, 937, 937, 931, 930, 938, 932, 889, 932, 938, 939, 939, 933, 932, 933, 939, 940, 940, 934, 933, 934, 940, 941, 941, 935, 934, 935, 941, 942, 942, 936, 935, 936, 942, 943, 943, 937, 936, 944, 938, 889, 938, 944, 945, 945, 939, 938, 939, 945, 946, 946, 940, 939, 940, 946, 947, 947, 941, 940, 941, 947, 948, 948, 942, 941, 942, 948, 949, 949, 943, 942, 950, 944, 889, 944, 950, 951, 951, 945, 944, 945, 951, 952, 952, 946, 945, 946, 952, 953, 953, 947, 946, 947, 953, 954, 954, 948, 947, 948, 954, 955, 955, 949, 948, 956, 950, 889, 950, 956, 957, 957, 951, 950, 951, 957, 958, 958, 952, 951, 952, 958, 959, 959, 953, 952, 953, 959, 960, 960, 954, 953, 954, 960, 961, 961, 955, 954, 962,
+        956, 889, 956, 962, 963, 963, 957, 956, 957, 963, 964, 964, 958, 957, 958, 964, 965, 965, 959, 958, 959, 965, 966, 966, 960, 959, 960, 966, 967, 967, 961, 960, 968, 962, 889, 962, 968, 969, 969, 963, 962, 963, 969, 970, 970, 964, 963, 964, 970, 971, 971, 965, 964, 965, 971, 972, 972, 966, 965, 966, 972, 973, 973, 967, 966, 974, 968, 889, 968, 974, 975, 975, 969, 968, 969, 975, 976, 976, 970, 969, 970, 976, 977, 977, 971, 970, 971, 977, 978, 978, 972, 971, 972, 978, 979, 979, 973, 972, 980, 974, 889, 974, 980, 981, 981, 975, 974, 975, 981, 982, 982, 976, 975, 976, 982, 983, 983, 977, 976, 977, 983, 984, 984, 978, 977, 978, 984, 985, 985, 979, 978, 986, 980, 889, 980, 986, 987, 987, 981, 980, 981, 987, 988, 988, 982, 981, 982, 988, 989, 989, 983, 982, 983, 989, 990, 990, 984, 983, 984, 990, 991, 991, 985, 984, 992, 986, 889, 986, 992, 993, 993, 987, 986, 987, 993, 994, 994, 988, 987, 988, 994, 995, 995, 989, 988, 989, 995, 996, 996, 990, 989, 990, 996, 997, 997, 991, 990, 998, 992, 889, 992, 998, 999, 999, 993, 992, 993, 999, 1000, 1000, 994, 993, 994, 1000, 1001, 1001, 995, 994, 995, 1001, 1002, 1002, 996, 995, 996, 1002, 1003, 1003, 997, 996, 1004, 998, 889, 998, 1004, 1005, 1005, 999, 998, 999, 1005, 1006, 1006, 1000, 999, 1000, 1006, 1007, 1007, 1001, 1000, 1001, 1007, 1008, 1008, 1002, 1001, 1002, 1008, 1009, 1009, 1003, 1002, 1010, 1004, 889, 1004, 1010, 1011, 1011, 1005, 1004, 1005, 1011, 1012, 1012, 1006, 1005, 1006, 1012, 1013, 1013, 1007, 1006, 1007, 1013, 1014, 1014, 1008, 1007, 1008, 1014, 1015, 1015, 1009, 1008, 1016, 1010, 889, 1010, 1016, 1017, 1017, 1011, 1010, 1011, 1017, 1018, 1018, 1012, 1011, 1012, 1018, 1019, 1019, 1013, 1012, 1013, 1019, 1020, 1020, 1014, 1013, 1014, 1020, 1021, 1021, 1015, 1014, 1022,
+        1016, 889, 1016, 1022, 1023, 1023, 1017, 1016, 1017, 1023, 1024, 1024, 1018, 1017, 1018, 1024, 1025, 1025, 1019, 1018, 1019, 1025, 1026, 1026, 1020, 1019, 1020, 1026, 1027, 1027, 1021, 1020, 1028, 1022, 889, 1022, 1028, 1029, 1029, 1023, 1022, 1023, 1029, 1030, 1030, 1024, 1023, 1024, 1030, 1031, 1031, 1025, 1024, 1025, 1031, 1032, 1032, 1026, 1025, 1026, 1032, 1033, 1033, 1027, 1026, 890, 1028, 889, 1028, 890, 891, 891, 1029, 1028, 1029, 891, 892, 892, 1030, 1029, 1030, 892, 893, 893, 1031, 1030, 1031, 893, 894, 894, 1032, 1031, 1032, 894, 895, 895, 1033, 1032, 895, 901, 1040, 1040, 1034, 895, 1034, 1040, 1041, 1041, 1035, 1034, 1035, 1041, 1042, 1042, 1036, 1035, 1036, 1042, 1043, 1043, 1037, 1036, 1037, 1043, 1044, 1044, 1038, 1037, 1038, 1044, 1045, 1045, 1039, 1038, 901, 907, 1046, 1046, 1040, 901, 1040, 1046, 1047, 1047, 1041, 1040, 1041, 1047, 1048, 1048, 1042, 1041, 1042, 1048, 1049, 1049, 1043, 1042, 1043, 1049, 1050, 1050, 1044, 1043, 1044, 1050, 1051, 1051, 1045, 1044, 907, 913, 1052, 1052, 1046, 907, 1046, 1052, 1053, 1053, 1047, 1046, 1047, 1053, 1054, 1054, 1048, 1047, 1048,
+        1054, 1055, 1055, 1049, 1048, 1049, 1055, 1056, 1056, 1050, 1049, 1050, 1056, 1057, 1057, 1051, 1050, 913, 919, 1058, 1058, 1052, 913, 1052, 1058, 1059, 1059, 1053, 1052, 1053, 1059, 1060, 1060, 1054, 1053, 1054, 1060, 1061, 1061, 1055, 1054, 1055, 1061, 1062, 1062, 1056, 1055, 1056, 1062, 1063, 1063, 1057, 1056, 919, 925, 1064, 1064, 1058, 919, 1058, 1064, 1065, 1065, 1059, 1058, 1059, 1065, 1066, 1066, 1060, 1059, 1060, 1066, 1067, 1067, 1061, 1060, 1061, 1067, 1068, 1068, 1062, 1061, 1062, 1068, 1069, 1069, 1063, 1062, 925, 931, 1070, 1070, 1064, 925, 1064, 1070, 1071, 1071, 1065, 1064, 1065, 1071, 1072, 1072, 1066, 1065, 1066, 1072, 1073, 1073, 1067, 1066, 1067, 1073, 1074, 1074, 1068, 1067, 1068, 1074, 1075, 1075, 1069, 1068, 931, 937, 1076, 1076, 1070, 931, 1070, 1076, 1077, 1077, 1071, 1070, 1071, 1077, 1078, 1078, 1072, 1071, 1072, 1078, 1079, 1079, 1073, 1072, 1073, 1079, 1080, 1080, 1074, 1073, 1074, 1080, 1081, 1081, 1075, 1074, 937, 943, 1082, 1082, 1076, 937, 1076, 1082, 1083, 1083, 1077, 1076, 1077, 1083, 1084, 1084, 1078, 1077, 1078, 1084, 1085, 1085, 1079, 1078, 1079, 1085,
+        1086, 1086, 1080, 1079, 1080, 1086, 1087, 1087, 1081, 1080, 943, 949, 1088, 1088, 1082, 943, 1082, 1088, 1089, 1089, 1083, 1082, 1083, 1089, 1090, 1090, 1084, 1083, 1084, 1090, 1091, 1091, 1085, 1084, 1085, 1091, 1092, 1092, 1086, 1085, 1086, 1092, 1093, 1093, 1087, 1086, 949, 955, 1094, 1094, 1088, 949, 1088, 1094, 1095, 1095, 1089, 1088, 1089, 1095, 1096, 1096, 1090, 1089, 1090, 1096, 1097, 1097, 1091, 1090, 1091, 1097, 1098, 1098, 1092, 1091, 1092, 1098, 1099, 1099, 1093, 1092, 955, 961, 1100, 1100, 1094, 955, 1094, 1100, 1101, 1101, 1095, 1094, 1095, 1101, 1102, 1102, 1096, 1095, 1096, 1102, 1103, 1103, 1097, 1096, 1097, 1103, 1104, 1104, 1098, 1097, 1098, 1104, 1105, 1105, 1099, 1098, 961, 967, 1106, 1106, 1100, 961, 1100, 1106, 1107, 1107, 1101, 1100, 1101, 1107, 1108, 1108, 1102, 1101, 1102, 1108, 1109, 1109, 1103, 1102, 1103, 1109, 1110, 1110, 1104, 1103, 1104, 1110, 1111, 1111, 1105, 1104, 967, 973, 1112, 1112, 1106, 967, 1106, 1112, 1113, 1113, 1107, 1106, 1107, 1113, 1114, 1114, 1108, 1107, 1108, 1114, 1115, 1115, 1109, 1108, 1109, 1115, 1116, 1116, 1110, 1109, 1110, 1116, 1117,
+        1117, 1111, 1110, 973, 979, 1118, 1118, 1112, 973, 1112, 1118, 1119, 1119, 1113, 1112, 1113, 1119, 1120, 1120, 1114, 1113, 1114, 1120, 1121, 1121, 1115, 1114, 1115, 1121, 1122, 1122, 1116, 1115, 1116, 1122, 1123, 1123, 1117, 1116, 979, 985, 1124, 1124, 1118, 979, 1118, 1124, 1125, 1125, 1119, 1118, 1119, 1125, 1126, 1126, 1120, 1119, 1120, 1126, 1127, 1127, 1121, 1120, 1121, 1127, 1128, 1128, 1122, 1121, 1122, 1128, 1129, 1129, 1123, 1122, 985, 991, 1130, 1130, 1124, 985, 1124, 1130, 1131, 1131, 1125, 1124, 1125, 1131, 1132, 1132, 1126, 1125, 1126, 1132, 1133, 1133, 1127, 1126, 1127, 1133, 1134, 1134, 1128, 1127, 1128, 1134, 1135, 1135, 1129, 1128, 991, 997, 1136, 1136, 1130, 991, 1130, 1136, 1137, 1137, 1131, 1130, 1131, 1137, 1138, 1138, 1132, 1131, 1132, 1138, 1139, 1139, 1133, 1132, 1133, 1139, 1140, 1140, 1134, 1133, 1134, 1140, 1141, 1141, 1135, 1134, 997, 1003, 1142, 1142, 1136, 997, 1136, 1142, 1143, 1143, 1137, 1136, 1137, 1143, 1144, 1144, 1138, 1137, 1138, 1144, 1145, 1145, 1139, 1138, 1139, 1145, 1146, 1146, 1140, 1139, 1140, 1146, 1147, 1147, 1141, 1140, 1003, 1009, 1148, 1148,
+        1142, 1003, 1142, 1148, 1149, 1149, 1143, 1142, 1143, 1149, 1150, 1150, 1144, 1143, 1144, 1150, 1151, 1151, 1145, 1144, 1145, 1151, 1152, 1152, 1146, 1145, 1146, 1152, 1153, 1153, 1147, 1146, 1009, 1015, 1154, 1154, 1148, 1009, 1148, 1154, 1155, 1155, 1149, 1148, 1149, 1155, 1156, 1156, 1150, 1149, 1150, 1156, 1157, 1157, 1151, 1150, 1151, 1157, 1158, 1158, 1152, 1151, 1152, 1158, 1159, 1159, 1153, 1152, 1015, 1021, 1160, 1160, 1154, 1015, 1154, 1160, 1161, 1161, 1155, 1154, 1155, 1161, 1162, 1162, 1156, 1155, 1156, 1162, 1163, 1163, 1157, 1156, 1157, 1163, 1164, 1164, 1158, 1157, 1158, 1164, 1165, 1165, 1159, 1158, 1021, 1027, 1166, 1166, 1160, 1021, 1160, 1166, 1167, 1167, 1161, 1160, 1161, 1167, 1168, 1168, 1162, 1161, 1162, 1168, 1169, 1169, 1163, 1162, 1163, 1169, 1170, 1170, 1164, 1163, 1164, 1170, 1171, 1171, 1165, 1164, 1027, 1033, 1172, 1172, 1166, 1027, 1166, 1172, 1173, 1173, 1167, 1166, 1167, 1173, 1174, 1174, 1168, 1167, 1168, 1174, 1175, 1175, 1169, 1168, 1169, 1175, 1176, 1176, 1170, 1169, 1170, 1176, 1177, 1177, 1171, 1170, 1033, 895, 1034, 1034, 1172, 1033, 1172, 1034, 1035,
+        1035, 1173, 1172, 1173, 1035, 1036, 1036, 1174, 1173, 1174, 1036, 1037, 1037, 1175, 1174, 1175, 1037, 1038, 1038, 1176, 1175, 1176, 1038, 1039, 1039, 1177, 1176
+    };
+
 }
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "TextureCache.h"
+#include "MipmapGenerator.h"
+#include "PixelConvert.h"
+#include "stb_image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#include <stdlib.h>
+#else
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  struct CacheHeader
+  {
+    char magic[4];        // "TXCH"
+    uint32_t version;
+    int64_t sourceTime;
+    uint64_t sourceSize;
+    uint32_t components;
+    uint32_t levelCount;
+    uint32_t pathLength;
+    uint32_t dataOffset;  // 画素データの位置. マップ後のコピーを考えて 64 バイト境界とする.
+  };
+  const uint32_t CacheVersion = 1;
+  const uint32_t DataAlignment = 64;
+
+  // 同じキャッシュファイルを別のスレッド、プロセスが同時に書き込んでも重ならない一時ファイル名.
+  std::string MakeTempFileName(const std::string& cacheFile)
+  {
+    static std::atomic<uint32_t> counter(0);
+#ifdef _WIN32
+    auto pid = static_cast<unsigned long>(_getpid());
+#else
+    auto pid = static_cast<unsigned long>(getpid());
+#endif
+    char suffix[64];
+    snprintf(suffix, sizeof(suffix), ".%lu.%u.tmp", pid, counter++);
+    return cacheFile + suffix;
+  }
+
+  void MakeDirectory(const std::string& directory)
+  {
+#ifdef _WIN32
+    _mkdir(directory.c_str());
+#else
+    mkdir(directory.c_str(), 0755);
+#endif
+  }
+
+  bool GetFileStamp(const std::string& fileName, int64_t& time, uint64_t& size)
+  {
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(fileName.c_str(), &st) != 0)
+    {
+      return false;
+    }
+#else
+    struct stat st;
+    if (stat(fileName.c_str(), &st) != 0)
+    {
+      return false;
+    }
+#endif
+    time = int64_t(st.st_mtime);
+    size = uint64_t(st.st_size);
+    return true;
+  }
+
+  // 作業ディレクトリの異なるサンプル間で同じ名前の画像を区別するため、絶対パスで識別する.
+  std::string GetFullPath(const std::string& fileName)
+  {
+#ifdef _WIN32
+    char buf[_MAX_PATH];
+    if (_fullpath(buf, fileName.c_str(), _MAX_PATH) != nullptr)
+    {
+      return buf;
+    }
+#else
+    char buf[PATH_MAX];
+    if (realpath(fileName.c_str(), buf) != nullptr)
+    {
+      return buf;
+    }
+#endif
+    return fileName;
+  }
+
+  uint64_t HashFNV1a(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+  {
+    auto p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash = (hash ^ p[i]) * 0x100000001b3ull;
+    }
+    return hash;
+  }
+}
+
+uint64_t TextureCache::Image::GetDataSize() const
+{
+  if (m_levels.empty())
+  {
+    return 0;
+  }
+  return m_levels.back().offset + m_levels.back().size;
+}
+
+TextureCache::TextureCache() : m_directory("texture_cache"), m_hitCount(0), m_missCount(0)
+{
+}
+
+bool TextureCache::Load(const std::string& fileName, uint32_t components, Image& image, bool withMipmaps, book_util::MipmapFilter filter)
+{
+  image = Image();
+  int64_t sourceTime = 0;
+  uint64_t sourceSize = 0;
+  if (!IsEnabled() || !GetFileStamp(fileName, sourceTime, sourceSize))
+  {
+    return Decode(fileName, components, withMipmaps, filter, image);
+  }
+
+  auto cacheFile = GetCacheFileName(fileName, components, GetMipmapKind(withMipmaps, filter));
+  if (LoadFromCache(cacheFile, fileName, sourceTime, sourceSize, components, withMipmaps, image))
+  {
+    ++m_hitCount;
+    return true;
+  }
+  ++m_missCount;
+  if (!Decode(fileName, components, withMipmaps, filter, image))
+  {
+    return false;
+  }
+  Store(cacheFile, fileName, sourceTime, sourceSize, image);
+  return true;
+}
+
+uint32_t TextureCache::GetMipmapKind(bool withMipmaps, book_util::MipmapFilter filter)
+{
+  // キャッシュファイル名の一部となるため、既存の値(0: なし、1: 2x2 の平均)は変えないこと.
+  if (!withMipmaps)
+  {
+    return 0;
+  }
+  return filter == book_util::MipmapFilter::Box ? 1 : 2;
+}
+
+std::string TextureCache::GetCacheFileName(const std::string& fileName, uint32_t components, uint32_t mipmapKind) const
+{
+  auto fullPath = GetFullPath(fileName);
+  uint32_t format[2] = { components, mipmapKind };
+  auto hash = HashFNV1a(fullPath.data(), fullPath.size());
+  hash = HashFNV1a(format, sizeof(format), hash);
+
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.texcache", static_cast<unsigned long long>(hash));
+  return m_directory + "/" + name;
+}
+
+bool TextureCache::LoadFromCache(const std::string& cacheFile, const std::string& fileName,
+  int64_t sourceTime, uint64_t sourceSize, uint32_t components, bool withMipmaps, Image& image)
+{
+  MappedFile mapped;
+  if (!mapped.Open(cacheFile) || mapped.GetSize() < sizeof(CacheHeader))
+  {
+    return false;
+  }
+  CacheHeader header;
+  memcpy(&header, mapped.GetData(), sizeof(header));
+  if (memcmp(header.magic, "TXCH", 4) != 0 || header.version != CacheVersion ||
+    header.sourceTime != sourceTime || header.sourceSize != sourceSize ||
+    header.components != components || header.levelCount == 0 ||
+    (!withMipmaps && header.levelCount != 1))
+  {
+    return false;
+  }
+  auto levelsOffset = sizeof(CacheHeader) + header.pathLength;
+  if (header.dataOffset < levelsOffset + sizeof(Level) * header.levelCount || header.dataOffset > mapped.GetSize())
+  {
+    return false;
+  }
+
+  // ハッシュの衝突に備えて元ファイルのパスも照合する.
+  auto fullPath = GetFullPath(fileName);
+  if (header.pathLength != fullPath.size() ||
+    memcmp(mapped.GetData() + sizeof(CacheHeader), fullPath.data(), fullPath.size()) != 0)
+  {
+    return false;
+  }
+
+  std::vector<Level> levels(header.levelCount);
+  memcpy(levels.data(), mapped.GetData() + levelsOffset, sizeof(Level) * levels.size());
+  // 各レベルの範囲がファイルに収まり、大きさが幅、高さと合っていること.
+  const uint64_t dataSize = mapped.GetSize() - header.dataOffset;
+  for (const auto& level : levels)
+  {
+    if (level.offset > dataSize || level.size > dataSize - level.offset ||
+      level.size != uint64_t(level.width) * level.height * components)
+    {
+      return false;
+    }
+  }
+
+  image.m_data = mapped.GetData() + header.dataOffset;
+  image.m_mapped = std::move(mapped);
+  image.m_components = components;
+  image.m_levels = std::move(levels);
+  return true;
+}
+
+bool TextureCache::Decode(const std::string& fileName, uint32_t components, bool withMipmaps, book_util::MipmapFilter filter, Image& image)
+{
+  // チャンネルを増やす場合は stb_image にはファイル本来のチャンネル数で展開させ、
+  // 要求したチャンネル数への変換は格納先へ直接書き込みながら行う.
+  // 減らす場合は stb_image に任せる(JPEG の輝度は色変換をせずに取り出せる).
+  int width, height, sourceComponents = 0;
+  if (!stbi_info(fileName.c_str(), &width, &height, &sourceComponents) || sourceComponents > int(components))
+  {
+    sourceComponents = int(components);
+  }
+  const int requestComponents = sourceComponents == int(components) ? sourceComponents : 0;
+  auto pImage = stbi_load(fileName.c_str(), &width, &height, nullptr, requestComponents);
+  if (pImage == nullptr)
+  {
+    return false;
+  }
+
+  std::vector<Level> levels;
+  uint32_t w = uint32_t(width), h = uint32_t(height);
+  uint64_t offset = 0;
+  while (true)
+  {
+    auto size = uint64_t(w) * h * components;
+    levels.push_back(Level{ w, h, offset, size });
+    offset += size;
+    if (!withMipmaps || (w == 1 && h == 1))
+    {
+      break;
+    }
+    w = (std::max)(w / 2, 1u);
+    h = (std::max)(h / 2, 1u);
+  }
+
+  image.m_pixels.resize(size_t(offset));
+  book_util::ConvertChannels(pImage, uint32_t(sourceComponents), image.m_pixels.data(), components,
+    uint32_t(width), uint32_t(height));
+  stbi_image_free(pImage);
+  for (size_t i = 1; i < levels.size(); ++i)
+  {
+    const auto& src = levels[i - 1];
+    const auto& dst = levels[i];
+    book_util::DownsampleImage(image.m_pixels.data() + src.offset, src.width, src.height, components,
+      image.m_pixels.data() + dst.offset, filter);
+  }
+  image.m_data = image.m_pixels.data();
+  image.m_components = components;
+  image.m_levels = std::move(levels);
+  return true;
+}
+
+void TextureCache::Store(const std::string& cacheFile, const std::string& fileName,
+  int64_t sourceTime, uint64_t sourceSize, const Image& image)
+{
+  MakeDirectory(m_directory);
+
+  auto fullPath = GetFullPath(fileName);
+  CacheHeader header{};
+  memcpy(header.magic, "TXCH", 4);
+  header.version = CacheVersion;
+  header.sourceTime = sourceTime;
+  header.sourceSize = sourceSize;
+  header.components = image.m_components;
+  header.levelCount = uint32_t(image.m_levels.size());
+  header.pathLength = uint32_t(fullPath.size());
+  auto levelsEnd = uint32_t(sizeof(CacheHeader) + fullPath.size() + sizeof(Level) * image.m_levels.size());
+  header.dataOffset = (levelsEnd + DataAlignment - 1) & ~(DataAlignment - 1);
+
+  // 書き込み途中のファイルを読まないよう、一時ファイルへ書いてから置き換える.
+  // 同じ画像を同時に保存する場合に備え、一時ファイルは書き込むごとに別の名前とする.
+  auto tempFile = MakeTempFileName(cacheFile);
+  {
+    std::ofstream outfile(tempFile, std::ios::binary);
+    if (!outfile)
+    {
+      return;
+    }
+    std::vector<char> padding(header.dataOffset - levelsEnd, 0);
+    outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outfile.write(fullPath.data(), fullPath.size());
+    outfile.write(reinterpret_cast<const char*>(image.m_levels.data()), sizeof(Level) * image.m_levels.size());
+    outfile.write(padding.data(), padding.size());
+    outfile.write(reinterpret_cast<const char*>(image.m_data), std::streamsize(image.GetDataSize()));
+    if (!outfile)
+    {
+      outfile.close();
+      std::remove(tempFile.c_str());
+      return;
+    }
+  }
+  std::remove(cacheFile.c_str());
+  if (std::rename(tempFile.c_str(), cacheFile.c_str()) != 0)
+  {
+    std::remove(tempFile.c_str());
+  }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "MappedFile.h"
+#include "MipmapGenerator.h"
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+// デコード済みの画像をファイルへ保存しておき、次回以降の読み込みでデコードを省略する.
+// キャッシュは元ファイルのパス、更新時刻、サイズ、要求したチャンネル数とミップマップの作り方で識別し、
+// 元ファイルが更新されていれば作り直す.
+// キャッシュファイルは無圧縮で、読み込み時はマップしたメモリをそのまま参照する.
+class TextureCache
+{
+public:
+  struct Level
+  {
+    uint32_t width, height;
+    uint64_t offset;  // 画素データ先頭からの位置.
+    uint64_t size;
+  };
+
+  // 読み込んだ画像. キャッシュから読んだ場合はファイルをマップしたまま参照する.
+  class Image
+  {
+  public:
+    Image() : m_data(nullptr), m_components(0) { }
+
+    uint32_t GetWidth() const { return m_levels.empty() ? 0 : m_levels[0].width; }
+    uint32_t GetHeight() const { return m_levels.empty() ? 0 : m_levels[0].height; }
+    uint32_t GetComponents() const { return m_components; }
+    uint32_t GetLevelCount() const { return uint32_t(m_levels.size()); }
+    const Level& GetLevel(uint32_t level) const { return m_levels[level]; }
+    const uint8_t* GetPixels(uint32_t level = 0) const { return m_data + m_levels[level].offset; }
+    // 全レベルの画素データは連続して並んでいる.
+    uint64_t GetDataSize() const;
+    bool IsFromCache() const { return m_mapped.IsOpen(); }
+
+  private:
+    friend class TextureCache;
+    MappedFile m_mapped;
+    std::vector<uint8_t> m_pixels;
+    const uint8_t* m_data;
+    uint32_t m_components;
+    std::vector<Level> m_levels;
+  };
+
+  TextureCache();
+
+  // キャッシュファイルの保存先. 空にするとキャッシュを使わず毎回デコードする.
+  void SetDirectory(const std::string& directory) { m_directory = directory; }
+  const std::string& GetDirectory() const { return m_directory; }
+  bool IsEnabled() const { return !m_directory.empty(); }
+
+  // fileName の画像を components チャンネル(1～4)の 8bit 画素として読み込む.
+  // withMipmaps が true の場合は 1x1 までの縮小画像を filter で作成して含める.
+  // 異なるファイルであれば複数のスレッドから同時に呼び出してよい.
+  bool Load(const std::string& fileName, uint32_t components, Image& image, bool withMipmaps = false,
+    book_util::MipmapFilter filter = book_util::MipmapFilter::Box);
+
+  uint32_t GetHitCount() const { return m_hitCount; }
+  uint32_t GetMissCount() const { return m_missCount; }
+
+private:
+  // ミップマップの作り方. 0 はミップマップなし.
+  static uint32_t GetMipmapKind(bool withMipmaps, book_util::MipmapFilter filter);
+  std::string GetCacheFileName(const std::string& fileName, uint32_t components, uint32_t mipmapKind) const;
+  bool LoadFromCache(const std::string& cacheFile, const std::string& fileName,
+    int64_t sourceTime, uint64_t sourceSize, uint32_t components, bool withMipmaps, Image& image);
+  bool Decode(const std::string& fileName, uint32_t components, bool withMipmaps, book_util::MipmapFilter filter, Image& image);
+  void Store(const std::string& cacheFile, const std::string& fileName,
+    int64_t sourceTime, uint64_t sourceSize, const Image& image);
+
+  std::string m_directory;
+  std::atomic<uint32_t> m_hitCount;
+  std::atomic<uint32_t> m_missCount;
+};
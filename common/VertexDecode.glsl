@@ -0,0 +1,31 @@
+// 頂点シェーダー共通の頂点の展開. 各シェーダーから #include する(glslangValidator に -I で common を指定する).
+// 特殊化定数の番号と意味は book_util::VertexDecodeConstants(VertexQuantize.h)と一致させること.
+
+// 頂点の展開方法(book_util::VertexDecodeConstants).
+// 圧縮形式では位置がバウンディングボックスに対する SNORM、法線が八面体の 2 成分となる.
+layout(constant_id=0) const bool CompactVertex = false;
+layout(constant_id=1) const float PositionScaleX = 1.0;
+layout(constant_id=2) const float PositionScaleY = 1.0;
+layout(constant_id=3) const float PositionScaleZ = 1.0;
+layout(constant_id=4) const float PositionOffsetX = 0.0;
+layout(constant_id=5) const float PositionOffsetY = 0.0;
+layout(constant_id=6) const float PositionOffsetZ = 0.0;
+
+vec4 DecodePosition(vec4 p)
+{
+  vec3 scale = vec3(PositionScaleX, PositionScaleY, PositionScaleZ);
+  vec3 offset = vec3(PositionOffsetX, PositionOffsetY, PositionOffsetZ);
+  return vec4(p.xyz * scale + offset, 1.0);
+}
+vec3 DecodeNormal(vec3 n)
+{
+  if (!CompactVertex)
+  {
+    return n;
+  }
+  vec3 v = vec3(n.xy, 1.0 - abs(n.x) - abs(n.y));
+  float t = max(-v.z, 0.0);
+  v.x += v.x >= 0.0 ? -t : t;
+  v.y += v.y >= 0.0 ? -t : t;
+  return normalize(v);
+}
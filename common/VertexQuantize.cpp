@@ -0,0 +1,160 @@
+#include "VertexQuantize.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace book_util
+{
+  PositionQuantization ComputePositionQuantization(const Aabb& box)
+  {
+    PositionQuantization quantization;
+    quantization.offset = (box.min + box.max) * 0.5f;
+    quantization.scale = (box.max - box.min) * 0.5f;
+    return quantization;
+  }
+
+  int16_t QuantizeSnorm16(float v)
+  {
+    v = std::min(std::max(v, -1.0f), 1.0f);
+    return int16_t(std::lround(v * 32767.0f));
+  }
+
+  glm::vec2 EncodeOctahedral(const glm::vec3& n)
+  {
+    float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (sum <= 0.0f)
+    {
+      return glm::vec2(0.0f, 0.0f);
+    }
+    glm::vec2 e(n.x / sum, n.y / sum);
+    if (n.z < 0.0f)
+    {
+      // 下半分は対角線で折り返す.
+      float x = (1.0f - std::abs(e.y)) * (e.x >= 0.0f ? 1.0f : -1.0f);
+      float y = (1.0f - std::abs(e.x)) * (e.y >= 0.0f ? 1.0f : -1.0f);
+      e = glm::vec2(x, y);
+    }
+    return e;
+  }
+
+  glm::vec3 DecodeOctahedral(const glm::vec2& e)
+  {
+    glm::vec3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+    float t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return glm::normalize(n);
+  }
+
+  void QuantizeVertices(CompactVertex* dst, const void* vertices, uint32_t count, uint32_t stride,
+    uint32_t normalOffset, const PositionQuantization& quantization)
+  {
+    // 大きさのない軸は 0 とする.
+    glm::vec3 invScale(
+      quantization.scale.x > 0.0f ? 1.0f / quantization.scale.x : 0.0f,
+      quantization.scale.y > 0.0f ? 1.0f / quantization.scale.y : 0.0f,
+      quantization.scale.z > 0.0f ? 1.0f / quantization.scale.z : 0.0f);
+    auto src = static_cast<const uint8_t*>(vertices);
+    for (uint32_t i = 0; i < count; ++i, src += stride)
+    {
+      glm::vec3 position, normal;
+      memcpy(&position, src, sizeof(position));
+      memcpy(&normal, src + normalOffset, sizeof(normal));
+
+      auto q = (position - quantization.offset) * invScale;
+      auto& v = dst[i];
+      v.position[0] = QuantizeSnorm16(q.x);
+      v.position[1] = QuantizeSnorm16(q.y);
+      v.position[2] = QuantizeSnorm16(q.z);
+      v.position[3] = 32767;
+      auto e = EncodeOctahedral(normal);
+      v.normal[0] = QuantizeSnorm16(e.x);
+      v.normal[1] = QuantizeSnorm16(e.y);
+    }
+  }
+
+  void PackIndices16(uint16_t* dst, const uint32_t* indices, size_t count)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      dst[i] = uint16_t(indices[i]);
+    }
+  }
+
+  VkPipelineVertexInputStateCreateInfo VertexInputLayout::GetCreateInfo() const
+  {
+    VkPipelineVertexInputStateCreateInfo ci{
+      VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+      nullptr, 0,
+      1, &binding,
+      uint32_t(attributes.size()), attributes.data()
+    };
+    return ci;
+  }
+
+  VertexInputLayout GetCompactVertexInputLayout()
+  {
+    VertexInputLayout layout;
+    layout.binding = { 0, uint32_t(sizeof(CompactVertex)), VK_VERTEX_INPUT_RATE_VERTEX };
+    layout.attributes = {
+      { 0, 0, VK_FORMAT_R16G16B16A16_SNORM, uint32_t(offsetof(CompactVertex, position)) },
+      { 1, 0, VK_FORMAT_R16G16_SNORM, uint32_t(offsetof(CompactVertex, normal)) },
+    };
+    return layout;
+  }
+
+  VertexInputLayout GetFloatVertexInputLayout(uint32_t stride, uint32_t normalOffset)
+  {
+    VertexInputLayout layout;
+    layout.binding = { 0, stride, VK_VERTEX_INPUT_RATE_VERTEX };
+    layout.attributes = {
+      { 0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0 },
+      { 1, 0, VK_FORMAT_R32G32B32_SFLOAT, normalOffset },
+    };
+    return layout;
+  }
+
+  VertexDecodeConstants::VertexDecodeConstants()
+    : VertexDecodeConstants(false, PositionQuantization{ glm::vec3(1.0f), glm::vec3(0.0f) })
+  {
+  }
+
+  VertexDecodeConstants::VertexDecodeConstants(bool isCompact, const PositionQuantization& quantization)
+  {
+    m_data.isCompact = isCompact ? VK_TRUE : VK_FALSE;
+    for (int i = 0; i < 3; ++i)
+    {
+      m_data.scale[i] = isCompact ? quantization.scale[i] : 1.0f;
+      m_data.offset[i] = isCompact ? quantization.offset[i] : 0.0f;
+    }
+    SetupInfo();
+  }
+
+  VertexDecodeConstants::VertexDecodeConstants(const VertexDecodeConstants& other)
+    : m_data(other.m_data)
+  {
+    SetupInfo();
+  }
+
+  VertexDecodeConstants& VertexDecodeConstants::operator=(const VertexDecodeConstants& other)
+  {
+    m_data = other.m_data;
+    SetupInfo();
+    return *this;
+  }
+
+  void VertexDecodeConstants::SetupInfo()
+  {
+    // m_info は自身のメンバーを指すため、コピー時にも作り直す.
+    m_entries[0] = { 0, uint32_t(offsetof(Data, isCompact)), sizeof(VkBool32) };
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+      m_entries[1 + i] = { 1 + i, uint32_t(offsetof(Data, scale) + sizeof(float) * i), sizeof(float) };
+      m_entries[4 + i] = { 4 + i, uint32_t(offsetof(Data, offset) + sizeof(float) * i), sizeof(float) };
+    }
+    m_info.mapEntryCount = 7;
+    m_info.pMapEntries = m_entries;
+    m_info.dataSize = sizeof(m_data);
+    m_info.pData = &m_data;
+  }
+}
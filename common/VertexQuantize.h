@@ -0,0 +1,82 @@
+#pragma once
+#ifndef GLM_FORCE_DEPTH_ZERO_TO_ONE
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#endif
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Frustum.h"
+
+namespace book_util
+{
+  // 圧縮した頂点(12 バイト).
+  // 位置はバウンディングボックスに対する 16bit SNORM(w は 1)、法線は八面体で 2 成分へ写した 16bit SNORM.
+  struct CompactVertex
+  {
+    int16_t position[4];
+    int16_t normal[2];
+  };
+  static_assert(sizeof(CompactVertex) == 12, "CompactVertex must be 12 bytes.");
+
+  // 圧縮した位置 q(-1～1) から元の位置を q * scale + offset で求める.
+  struct PositionQuantization
+  {
+    glm::vec3 scale;
+    glm::vec3 offset;
+  };
+  PositionQuantization ComputePositionQuantization(const Aabb& box);
+
+  int16_t QuantizeSnorm16(float v);
+  // 単位ベクトルを八面体に写して 2 成分(-1～1)にする.
+  glm::vec2 EncodeOctahedral(const glm::vec3& n);
+  glm::vec3 DecodeOctahedral(const glm::vec2& e);
+
+  // 位置(float × 3)が各頂点の先頭、法線(float × 3)が normalOffset にある頂点を圧縮する.
+  void QuantizeVertices(CompactVertex* dst, const void* vertices, uint32_t count, uint32_t stride,
+    uint32_t normalOffset, const PositionQuantization& quantization);
+
+  // 頂点数が 16bit に収まれば(0xFFFF はプリミティブリスタートと紛らわしいため除く) 16bit インデックスを使う.
+  inline bool CanUse16BitIndices(uint32_t vertexCount) { return vertexCount < 0xFFFFu; }
+  void PackIndices16(uint16_t* dst, const uint32_t* indices, size_t count);
+
+  // 頂点の形式に合わせて生成した頂点入力の記述.
+  struct VertexInputLayout
+  {
+    VkVertexInputBindingDescription binding;
+    std::vector<VkVertexInputAttributeDescription> attributes;
+
+    // 戻り値はこの VertexInputLayout を指すため、パイプラインの作成が終わるまで保持すること.
+    VkPipelineVertexInputStateCreateInfo GetCreateInfo() const;
+  };
+  // location 0 に位置、1 に法線を割り当てる.
+  VertexInputLayout GetCompactVertexInputLayout();
+  VertexInputLayout GetFloatVertexInputLayout(uint32_t stride, uint32_t normalOffset);
+
+  // 頂点シェーダーでの展開方法を特殊化定数で渡す.
+  // constant_id 0: 圧縮形式か(bool)、1～3: 位置の倍率、4～6: 位置のオフセット.
+  // 非圧縮の形式では倍率 1、オフセット 0 となり、入力をそのまま使う.
+  // シェーダー側の定義と展開関数は VertexDecode.glsl.
+  class VertexDecodeConstants
+  {
+  public:
+    VertexDecodeConstants();
+    VertexDecodeConstants(bool isCompact, const PositionQuantization& quantization);
+    VertexDecodeConstants(const VertexDecodeConstants& other);
+    VertexDecodeConstants& operator=(const VertexDecodeConstants& other);
+
+    const VkSpecializationInfo* GetInfo() const { return &m_info; }
+  private:
+    void SetupInfo();
+    struct Data
+    {
+      VkBool32 isCompact;
+      float scale[3];
+      float offset[3];
+    };
+    Data m_data;
+    VkSpecializationMapEntry m_entries[7];
+    VkSpecializationInfo m_info;
+  };
+}
@@ -0,0 +1,495 @@
+#include "VirtualTexture.h"
+
+#include <cstring>
+#include <atomic>
+
+namespace
+{
+  struct VirtualTextureHeader
+  {
+    char magic[4];        // "VTEX"
+    uint32_t version;
+    uint32_t format;
+    uint32_t width, height;
+    uint32_t tileSize;
+    uint32_t border;
+    uint32_t levelCount;
+    uint64_t dataOffset;  // 最初のタイルの位置.
+  };
+  const uint32_t VirtualTextureVersion = 1;
+
+  bool IsPowerOfTwo(uint32_t v)
+  {
+    return v != 0 && (v & (v - 1)) == 0;
+  }
+
+  uint32_t CalcLevelCount(uint32_t pageCount)
+  {
+    uint32_t count = 1;
+    while ((pageCount >> (count - 1)) > 1)
+    {
+      ++count;
+    }
+    return count;
+  }
+}
+
+uint32_t VirtualTextureFile::GetTexelBytes(VkFormat format)
+{
+  switch (format)
+  {
+  case VK_FORMAT_R8_UNORM: return 1;
+  case VK_FORMAT_R16_UNORM: return 2;
+  default: return 0;
+  }
+}
+
+bool VirtualTextureFile::Open(const std::string& fileName)
+{
+  Close();
+  m_file.open(fileName, std::ios::binary);
+  if (!m_file)
+  {
+    return false;
+  }
+  VirtualTextureHeader header;
+  m_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!m_file || memcmp(header.magic, "VTEX", 4) != 0 || header.version != VirtualTextureVersion ||
+    GetTexelBytes(VkFormat(header.format)) == 0 || header.tileSize == 0 ||
+    header.width != header.height || header.width % header.tileSize != 0 ||
+    !IsPowerOfTwo(header.width / header.tileSize) ||
+    header.width / header.tileSize > MaxPageCount || header.levelCount > MaxLevelCount)
+  {
+    Close();
+    return false;
+  }
+  m_desc.format = VkFormat(header.format);
+  m_desc.width = header.width;
+  m_desc.height = header.height;
+  m_desc.tileSize = header.tileSize;
+  m_desc.border = header.border;
+  m_levelCount = header.levelCount;
+  m_dataOffset = header.dataOffset;
+  if (m_levelCount != CalcLevelCount(header.width / header.tileSize))
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void VirtualTextureFile::Close()
+{
+  if (m_file.is_open())
+  {
+    m_file.close();
+  }
+  m_file.clear();
+  m_desc = Desc{};
+  m_levelCount = 0;
+  m_dataOffset = 0;
+}
+
+uint32_t VirtualTextureFile::GetTileBytes() const
+{
+  return GetTileExtent() * GetTileExtent() * GetTexelBytes(m_desc.format);
+}
+
+uint64_t VirtualTextureFile::GetTotalBytes() const
+{
+  uint64_t pages = 0;
+  for (uint32_t level = 0; level < m_levelCount; ++level)
+  {
+    pages += uint64_t(GetPageCountX(level)) * GetPageCountY(level);
+  }
+  return pages * GetTileBytes();
+}
+
+uint64_t VirtualTextureFile::GetTileOffset(uint32_t level, uint32_t x, uint32_t y) const
+{
+  uint64_t index = 0;
+  for (uint32_t i = 0; i < level; ++i)
+  {
+    index += uint64_t(GetPageCountX(i)) * GetPageCountY(i);
+  }
+  index += uint64_t(y) * GetPageCountX(level) + x;
+  return m_dataOffset + index * GetTileBytes();
+}
+
+bool VirtualTextureFile::ReadTile(uint32_t level, uint32_t x, uint32_t y, void* dst)
+{
+  if (level >= m_levelCount || x >= GetPageCountX(level) || y >= GetPageCountY(level))
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(m_fileMutex);
+  m_file.seekg(std::streamoff(GetTileOffset(level, x, y)));
+  m_file.read(reinterpret_cast<char*>(dst), GetTileBytes());
+  if (!m_file)
+  {
+    m_file.clear();
+    return false;
+  }
+  return true;
+}
+
+bool VirtualTextureFile::Write(const std::string& fileName, const Desc& desc,
+  std::function<void(uint32_t, uint32_t, uint32_t, void*)> generate, uint32_t threadCount)
+{
+  if (GetTexelBytes(desc.format) == 0 || desc.tileSize == 0 || desc.width != desc.height ||
+    desc.width % desc.tileSize != 0 || !IsPowerOfTwo(desc.width / desc.tileSize))
+  {
+    return false;
+  }
+  std::ofstream outfile(fileName, std::ios::binary);
+  if (!outfile)
+  {
+    return false;
+  }
+  VirtualTextureHeader header{};
+  memcpy(header.magic, "VTEX", 4);
+  header.version = VirtualTextureVersion;
+  header.format = uint32_t(desc.format);
+  header.width = desc.width;
+  header.height = desc.height;
+  header.tileSize = desc.tileSize;
+  header.border = desc.border;
+  header.levelCount = CalcLevelCount(desc.width / desc.tileSize);
+  header.dataOffset = sizeof(header);
+  outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  if (threadCount == 0)
+  {
+    threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+  }
+  const uint32_t extent = desc.tileSize + desc.border * 2;
+  const size_t tileBytes = size_t(extent) * extent * GetTexelBytes(desc.format);
+
+  // ページの 1 行ずつ、タイルを複数のスレッドで作成してから書き出す.
+  std::vector<uint8_t> row;
+  for (uint32_t level = 0; level < header.levelCount; ++level)
+  {
+    const uint32_t pageCount = (std::max)((desc.width / desc.tileSize) >> level, 1u);
+    row.resize(tileBytes * pageCount);
+    for (uint32_t y = 0; y < pageCount; ++y)
+    {
+      std::atomic<uint32_t> next(0);
+      auto worker = [&]()
+      {
+        for (uint32_t x = next++; x < pageCount; x = next++)
+        {
+          generate(level, x, y, row.data() + tileBytes * x);
+        }
+      };
+      std::vector<std::thread> threads;
+      for (uint32_t i = 1; i < (std::min)(threadCount, pageCount); ++i)
+      {
+        threads.emplace_back(worker);
+      }
+      worker();
+      for (auto& t : threads)
+      {
+        t.join();
+      }
+      outfile.write(reinterpret_cast<const char*>(row.data()), row.size());
+    }
+  }
+  return bool(outfile);
+}
+
+const uint32_t VirtualTextureCache::InvalidKey;
+
+VirtualTextureCache::VirtualTextureCache()
+  : m_slotsPerSide(0), m_framesInFlight(0), m_frame(0), m_residentCount(0), m_requestedCount(0),
+  m_isPageTableDirty(false), m_isPageTableBuilt(false), m_isExiting(false)
+{
+}
+
+VirtualTextureCache::~VirtualTextureCache()
+{
+  Close();
+}
+
+bool VirtualTextureCache::Open(const std::string& fileName, uint32_t slotsPerSide, uint32_t framesInFlight)
+{
+  Close();
+  // ページテーブルのエントリは 8 ビットでスロットの位置を持つ.
+  if (slotsPerSide == 0 || slotsPerSide > 256 || !m_file.Open(fileName))
+  {
+    return false;
+  }
+  m_slotsPerSide = slotsPerSide;
+  m_framesInFlight = framesInFlight;
+  m_frame = 0;
+  m_slots.assign(GetSlotCount(), Slot{ InvalidKey, 0 });
+
+  const auto levelCount = m_file.GetLevelCount();
+  m_residentSlots.resize(levelCount);
+  m_pageTableOffsets.resize(levelCount);
+  uint32_t entryCount = 0;
+  for (uint32_t level = 0; level < levelCount; ++level)
+  {
+    auto pageCount = m_file.GetPageCountX(level) * m_file.GetPageCountY(level);
+    m_residentSlots[level].assign(pageCount, InvalidKey);
+    m_pageTableOffsets[level] = entryCount;
+    entryCount += pageCount;
+  }
+  m_pageTable.assign(entryCount, PageEntry{});
+
+  // 最も粗いページは常に常駐させ、他のページが無い場合の参照先とする.
+  LoadedTile top;
+  top.slot = 0;
+  top.level = levelCount - 1;
+  top.x = top.y = 0;
+  top.data.resize(m_file.GetTileBytes());
+  if (!m_file.ReadTile(top.level, 0, 0, top.data.data()))
+  {
+    Close();
+    return false;
+  }
+  m_slots[0] = Slot{ MakeKey(top.level, 0, 0), UINT64_MAX };
+  ResidentSlot(top.level, 0, 0) = 0;
+  m_residentCount = 1;
+  m_loaded.push_back(std::move(top));
+  m_isPageTableDirty = true;
+  m_isPageTableBuilt = false;
+
+  m_isExiting = false;
+  m_worker = std::thread([this]() { WorkerThread(); });
+  return true;
+}
+
+void VirtualTextureCache::Close()
+{
+  if (m_worker.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isExiting = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+  }
+  m_file.Close();
+  m_queue.clear();
+  m_loading.clear();
+  m_loaded.clear();
+  m_slots.clear();
+  m_residentSlots.clear();
+  m_missing.clear();
+  m_missingSet.clear();
+  m_pageTable.clear();
+  m_pageTableOffsets.clear();
+  m_residentCount = 0;
+  m_requestedCount = 0;
+}
+
+uint32_t VirtualTextureCache::GetPendingCount()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return uint32_t(m_queue.size() + m_loading.size() + m_loaded.size());
+}
+
+uint32_t& VirtualTextureCache::ResidentSlot(uint32_t level, uint32_t x, uint32_t y)
+{
+  return m_residentSlots[level][y * m_file.GetPageCountX(level) + x];
+}
+
+void VirtualTextureCache::BeginFrame()
+{
+  ++m_frame;
+  m_missing.clear();
+  m_missingSet.clear();
+  m_requestedCount = 0;
+}
+
+void VirtualTextureCache::Request(uint32_t level, uint32_t x, uint32_t y)
+{
+  if (level >= m_file.GetLevelCount() || x >= m_file.GetPageCountX(level) || y >= m_file.GetPageCountY(level))
+  {
+    return;
+  }
+  // スロット数を超える要求は、後から(優先度の低いものから)捨てる.
+  if (m_requestedCount >= GetSlotCount())
+  {
+    return;
+  }
+  ++m_requestedCount;
+  auto slot = ResidentSlot(level, x, y);
+  if (slot != InvalidKey)
+  {
+    if (m_slots[slot].lastUsed != UINT64_MAX)
+    {
+      m_slots[slot].lastUsed = m_frame;
+    }
+    return;
+  }
+  auto key = MakeKey(level, x, y);
+  if (m_missingSet.insert(key).second)
+  {
+    m_missing.push_back(key);
+  }
+}
+
+void VirtualTextureCache::EndFrame()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+    for (auto key : m_missing)
+    {
+      if (std::find(m_loading.begin(), m_loading.end(), key) != m_loading.end())
+      {
+        continue;
+      }
+      auto it = std::find_if(m_loaded.begin(), m_loaded.end(),
+        [&](const LoadedTile& t) { return MakeKey(t.level, t.x, t.y) == key; });
+      if (it == m_loaded.end())
+      {
+        m_queue.push_back(key);
+      }
+    }
+  }
+  m_cv.notify_one();
+}
+
+uint32_t VirtualTextureCache::AllocateSlot()
+{
+  // 空きスロットが無ければ、GPU が参照し終えたスロットから最も長く使われていないものを選ぶ.
+  uint32_t found = InvalidKey;
+  uint64_t oldest = UINT64_MAX;
+  for (uint32_t i = 0; i < uint32_t(m_slots.size()); ++i)
+  {
+    const auto& slot = m_slots[i];
+    if (slot.key == InvalidKey)
+    {
+      return i;
+    }
+    if (slot.lastUsed == UINT64_MAX)
+    {
+      continue;  // 最も粗いページ.
+    }
+    if (slot.lastUsed + m_framesInFlight < m_frame && slot.lastUsed < oldest)
+    {
+      oldest = slot.lastUsed;
+      found = i;
+    }
+  }
+  return found;
+}
+
+uint32_t VirtualTextureCache::FetchLoadedTiles(std::vector<LoadedTile>& tiles, uint32_t maxCount)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  uint32_t count = 0;
+  auto it = m_loaded.begin();
+  while (it != m_loaded.end() && count < maxCount)
+  {
+    auto& tile = *it;
+    auto key = MakeKey(tile.level, tile.x, tile.y);
+    auto& resident = ResidentSlot(tile.level, tile.x, tile.y);
+    if (resident != InvalidKey && m_slots[resident].key == key && tile.slot == resident)
+    {
+      // Open で読み込んだ最も粗いページ.
+    }
+    else if (resident != InvalidKey || m_missingSet.count(key) == 0)
+    {
+      // 既に常駐しているか、もう必要ないページ.
+      it = m_loaded.erase(it);
+      continue;
+    }
+    else
+    {
+      auto slot = AllocateSlot();
+      if (slot == InvalidKey)
+      {
+        break;
+      }
+      auto& dst = m_slots[slot];
+      if (dst.key != InvalidKey)
+      {
+        ResidentSlot(dst.key >> 28, dst.key & 0x3FFF, (dst.key >> 14) & 0x3FFF) = InvalidKey;
+        --m_residentCount;
+      }
+      dst.key = key;
+      dst.lastUsed = m_frame;
+      resident = slot;
+      tile.slot = slot;
+      ++m_residentCount;
+    }
+    tiles.push_back(std::move(tile));
+    it = m_loaded.erase(it);
+    ++count;
+    m_isPageTableDirty = true;
+    m_isPageTableBuilt = false;
+  }
+  return count;
+}
+
+const std::vector<VirtualTextureCache::PageEntry>& VirtualTextureCache::GetPageTable()
+{
+  if (m_isPageTableBuilt)
+  {
+    return m_pageTable;
+  }
+  // 粗いレベルから順に、常駐していないページには親のエントリを引き継ぐ.
+  const auto levelCount = m_file.GetLevelCount();
+  for (uint32_t level = levelCount; level-- > 0;)
+  {
+    const auto pagesX = m_file.GetPageCountX(level), pagesY = m_file.GetPageCountY(level);
+    for (uint32_t y = 0; y < pagesY; ++y)
+    {
+      for (uint32_t x = 0; x < pagesX; ++x)
+      {
+        auto& entry = m_pageTable[m_pageTableOffsets[level] + y * pagesX + x];
+        auto slot = ResidentSlot(level, x, y);
+        if (slot != InvalidKey)
+        {
+          entry.x = uint8_t(slot % m_slotsPerSide);
+          entry.y = uint8_t(slot / m_slotsPerSide);
+          entry.level = uint8_t(level);
+          entry.reserved = 0;
+        }
+        else
+        {
+          const auto parentPagesX = m_file.GetPageCountX(level + 1);
+          entry = m_pageTable[m_pageTableOffsets[level + 1] + (y / 2) * parentPagesX + (x / 2)];
+        }
+      }
+    }
+  }
+  m_isPageTableBuilt = true;
+  return m_pageTable;
+}
+
+void VirtualTextureCache::WorkerThread()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (;;)
+  {
+    m_cv.wait(lock, [this]() { return m_isExiting || !m_queue.empty(); });
+    if (m_isExiting)
+    {
+      break;
+    }
+    auto key = m_queue.front();
+    m_queue.pop_front();
+    m_loading.push_back(key);
+    lock.unlock();
+
+    LoadedTile tile;
+    tile.slot = InvalidKey;
+    tile.level = key >> 28;
+    tile.x = key & 0x3FFF;
+    tile.y = (key >> 14) & 0x3FFF;
+    tile.data.resize(m_file.GetTileBytes());
+    bool isLoaded = m_file.ReadTile(tile.level, tile.x, tile.y, tile.data.data());
+
+    lock.lock();
+    m_loading.erase(std::find(m_loading.begin(), m_loading.end(), key));
+    if (isLoaded)
+    {
+      m_loaded.push_back(std::move(tile));
+    }
+  }
+}
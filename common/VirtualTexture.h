@@ -0,0 +1,158 @@
+#pragma once
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_set>
+#include <algorithm>
+#include <cstdint>
+
+// 仮想テクスチャのタイルファイル(.vtex).
+// 各レベルを tileSize 四方のページに分け、周囲に border テクセルの隣接データを加えたタイルとして格納する.
+// 正方形で一辺は tileSize の 2 の累乗倍とし、最も粗いレベルは 1 ページとなる.
+// タイルは全て同じサイズのため、位置はレベルとページ番号から計算できる.
+class VirtualTextureFile
+{
+public:
+  struct Desc
+  {
+    VkFormat format;   // VK_FORMAT_R8_UNORM または VK_FORMAT_R16_UNORM.
+    uint32_t width, height;
+    uint32_t tileSize;
+    uint32_t border;
+  };
+
+  bool Open(const std::string& fileName);
+  void Close();
+  bool IsOpen() const { return m_file.is_open(); }
+
+  const Desc& GetDesc() const { return m_desc; }
+  uint32_t GetLevelCount() const { return m_levelCount; }
+  uint32_t GetPageCountX(uint32_t level) const { return (std::max)((m_desc.width / m_desc.tileSize) >> level, 1u); }
+  uint32_t GetPageCountY(uint32_t level) const { return (std::max)((m_desc.height / m_desc.tileSize) >> level, 1u); }
+  // 境界を含めたタイルの一辺のテクセル数とバイト数.
+  uint32_t GetTileExtent() const { return m_desc.tileSize + m_desc.border * 2; }
+  uint32_t GetTileBytes() const;
+  // 全レベルのテクセルのバイト数(ファイル内のタイルの合計).
+  uint64_t GetTotalBytes() const;
+
+  // 1 タイルを dst (GetTileBytes() バイト)へ読み込む. 複数のスレッドから呼び出してよい.
+  bool ReadTile(uint32_t level, uint32_t x, uint32_t y, void* dst);
+
+  static uint32_t GetTexelBytes(VkFormat format);
+
+  // 一辺のページ数とレベル数の上限. VirtualTextureCache のキーへ 14 ビット、4 ビットで格納するため.
+  static const uint32_t MaxPageCount = 1u << 14;
+  static const uint32_t MaxLevelCount = 1u << 4;
+
+  // 書き出し. generate は (レベル, ページ X, ページ Y, 出力先) を受け取り、境界を含めたタイルを作成する.
+  // 異なるタイルについて複数のスレッドから同時に呼び出される.
+  static bool Write(const std::string& fileName, const Desc& desc,
+    std::function<void(uint32_t, uint32_t, uint32_t, void*)> generate, uint32_t threadCount = 0);
+
+private:
+  uint64_t GetTileOffset(uint32_t level, uint32_t x, uint32_t y) const;
+
+  std::ifstream m_file;
+  std::mutex m_fileMutex;
+  Desc m_desc = {};
+  uint32_t m_levelCount = 0;
+  uint64_t m_dataOffset = 0;
+};
+
+// 仮想テクスチャのタイルを固定数のスロット(物理テクスチャ)へ読み込んで管理する.
+// 毎フレーム必要なページを登録すると、常駐していないページを別スレッドでファイルから読み込み、
+// 空きがなければ最も長く使われていないスロットを再利用する.
+// ページテーブルは各レベルのページごとに、常駐しているページかその祖先のスロットとレベルを持つ.
+class VirtualTextureCache
+{
+public:
+  // ページテーブルの 1 エントリ(RGBA8_UINT). x, y はスロットの位置、level は常駐しているページのレベル.
+  struct PageEntry
+  {
+    uint8_t x, y, level, reserved;
+  };
+  struct LoadedTile
+  {
+    uint32_t slot;
+    uint32_t level, x, y;
+    std::vector<uint8_t> data;
+  };
+
+  VirtualTextureCache();
+  ~VirtualTextureCache();
+
+  // slotsPerSide 四方のスロットを持つキャッシュを作成する. 最も粗いページはここで読み込み、常駐させる.
+  // framesInFlight フレーム以内に使ったスロットは、GPU が参照している可能性があるため再利用しない.
+  bool Open(const std::string& fileName, uint32_t slotsPerSide, uint32_t framesInFlight);
+  void Close();
+  bool IsOpen() const { return m_file.IsOpen(); }
+
+  const VirtualTextureFile& GetFile() const { return m_file; }
+  uint32_t GetSlotsPerSide() const { return m_slotsPerSide; }
+  uint32_t GetSlotCount() const { return m_slotsPerSide * m_slotsPerSide; }
+  uint32_t GetResidentCount() const { return m_residentCount; }
+  uint32_t GetRequestedCount() const { return m_requestedCount; }
+  uint32_t GetPendingCount();
+
+  // フレームで必要なページを登録する. 優先度の高い(粗い)ページから順に登録すること.
+  void BeginFrame();
+  void Request(uint32_t level, uint32_t x, uint32_t y);
+  // 常駐していないページを読み込みキューへ積む. 前のフレームの未処理の要求は破棄する.
+  void EndFrame();
+
+  // 読み込みの完了したタイルにスロットを割り当てて tiles へ移す(最大 maxCount 個).
+  // スロットの中身は呼び出し側で転送し、ページテーブルを更新すること.
+  uint32_t FetchLoadedTiles(std::vector<LoadedTile>& tiles, uint32_t maxCount);
+
+  // 常駐状態が変わったか. ClearPageTableDirty まで true を返す.
+  bool IsPageTableDirty() const { return m_isPageTableDirty; }
+  void ClearPageTableDirty() { m_isPageTableDirty = false; }
+  // 全レベルのページテーブルを連続して並べたもの. GetPageTableOffset がレベルの先頭位置.
+  const std::vector<PageEntry>& GetPageTable();
+  uint32_t GetPageTableOffset(uint32_t level) const { return m_pageTableOffsets[level]; }
+
+private:
+  struct Slot
+  {
+    uint32_t key;       // 常駐しているページ. InvalidKey なら空き.
+    uint64_t lastUsed;  // 最後に必要とされたフレーム.
+  };
+  static const uint32_t InvalidKey = ~0u;
+  // ページ番号、レベルは VirtualTextureFile::MaxPageCount、MaxLevelCount 未満であること(Open で確認する).
+  static uint32_t MakeKey(uint32_t level, uint32_t x, uint32_t y) { return (level << 28) | (y << 14) | x; }
+  uint32_t& ResidentSlot(uint32_t level, uint32_t x, uint32_t y);
+  uint32_t AllocateSlot();
+  void WorkerThread();
+
+  VirtualTextureFile m_file;
+  uint32_t m_slotsPerSide;
+  uint32_t m_framesInFlight;
+  uint64_t m_frame;
+  std::vector<Slot> m_slots;
+  // レベルごとのページに割り当てたスロット(InvalidKey なら常駐していない).
+  std::vector<std::vector<uint32_t>> m_residentSlots;
+  std::vector<uint32_t> m_missing;
+  std::unordered_set<uint32_t> m_missingSet;
+  uint32_t m_residentCount;
+  uint32_t m_requestedCount;
+
+  std::vector<PageEntry> m_pageTable;
+  std::vector<uint32_t> m_pageTableOffsets;
+  bool m_isPageTableDirty;
+  bool m_isPageTableBuilt;
+
+  // 読み込みスレッドとの受け渡し.
+  std::thread m_worker;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<uint32_t> m_queue;
+  std::vector<uint32_t> m_loading;
+  std::vector<LoadedTile> m_loaded;
+  bool m_isExiting;
+};
@@ -1,829 +1,2046 @@
-#include "VulkanAppBase.h"
-#include "VulkanBookUtil.h"
-
-#include "imgui.h"
-#include "examples/imgui_impl_vulkan.h"
-#include "examples/imgui_impl_glfw.h"
-
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
-
-
-#include <vector>
-#include <sstream>
-
-
-static VkBool32 VKAPI_CALL DebugReportCallback(
-  VkDebugReportFlagsEXT flags,
-  VkDebugReportObjectTypeEXT objactTypes,
-  uint64_t object,
-  size_t	location,
-  int32_t messageCode,
-  const char* pLayerPrefix,
-  const char* pMessage,
-  void* pUserData)
-{
-  VkBool32 ret = VK_FALSE;
-  if (flags & VK_DEBUG_REPORT_INFORMATION_BIT_EXT ||
-    flags & VK_DEBUG_REPORT_DEBUG_BIT_EXT)
-  {
-    ret = VK_TRUE;
-  }
-  std::stringstream ss;
-  if (pLayerPrefix)
-  {
-    ss << "[" << pLayerPrefix << "] ";
-  }
-  ss << pMessage << std::endl;
-
-  OutputDebugStringA(ss.str().c_str());
-
-  return ret;
-}
-
-
-bool VulkanAppBase::OnSizeChanged(uint32_t width, uint32_t height)
-{
-  m_isMinimizedWindow = (width == 0 || height == 0);
-  if (m_isMinimizedWindow)
-  {
-    return false;
-  }
-  vkDeviceWaitIdle(m_device);
-
-  auto format = m_swapchain->GetSurfaceFormat().format;
-  // Xbv`FC蒼.
-  m_swapchain->Prepare(m_physicalDevice, m_gfxQueueIndex, width, height, format);
-  return true;
-}
-
-bool VulkanAppBase::OnMouseButtonDown(int button)
-{
-  return ImGui::GetIO().WantCaptureMouse;
-}
-
-bool VulkanAppBase::OnMouseButtonUp(int button)
-{
-  return ImGui::GetIO().WantCaptureMouse;
-}
-
-bool VulkanAppBase::OnMouseMove(int dx, int dy)
-{
-  return ImGui::GetIO().WantCaptureMouse;
-}
-
-
-uint32_t VulkanAppBase::GetMemoryTypeIndex(uint32_t requestBits, VkMemoryPropertyFlags requestProps) const
-{
-  uint32_t result = ~0u;
-  for (uint32_t i = 0; i < m_physicalMemProps.memoryTypeCount; ++i)
-  {
-    if (requestBits & 1)
-    {
-      const auto& types = m_physicalMemProps.memoryTypes[i];
-      if ((types.propertyFlags & requestProps) == requestProps)
-      {
-        result = i;
-        break;
-      }
-    }
-    requestBits >>= 1;
-  }
-  return result;
-}
-
-void VulkanAppBase::SwitchFullscreen(GLFWwindow* window)
-{
-  static int lastWindowPosX, lastWindowPosY;
-  static int lastWindowSizeW, lastWindowSizeH;
-
-  auto monitor = glfwGetPrimaryMonitor();
-  const auto mode = glfwGetVideoMode(monitor);
-
-#if 1 // ݂̃j^[ɍ킹TCY֕ύX.
-  if (!m_isFullscreen)
-  {
-    // to fullscreen
-    glfwGetWindowPos(window, &lastWindowPosX, &lastWindowPosY);
-    glfwGetWindowSize(window, &lastWindowSizeW, &lastWindowSizeH);
-    glfwSetWindowMonitor(window, monitor, 0, 0, mode->width, mode->height, mode->refreshRate);
-  }
-  else
-  {
-    // to windowmode
-    glfwSetWindowMonitor(window, nullptr, lastWindowPosX, lastWindowPosY, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
-  }
-#else
-  // w肳ꂽ𑜓xփj^[ύX.
-  if (!m_isFullscreen)
-  {
-    // to fullscreen
-    glfwGetWindowPos(window, &lastWindowPosX, &lastWindowPosY);
-    glfwGetWindowSize(window, &lastWindowSizeW, &lastWindowSizeH);
-    glfwSetWindowMonitor(window, monitor, 0, 0, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
-  }
-  else
-  {
-    // to windowmode
-    glfwSetWindowMonitor(window, nullptr, lastWindowPosX, lastWindowPosY, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
-  }
-#endif
-  m_isFullscreen = !m_isFullscreen;
-}
-
-void VulkanAppBase::Initialize(GLFWwindow* window, VkFormat format, bool isFullscreen)
-{
-  m_window = window;
-  CreateInstance();
-
-  // foCX̑I.
-  uint32_t count;
-  vkEnumeratePhysicalDevices(m_vkInstance, &count, nullptr);
-  std::vector<VkPhysicalDevice> physicalDevices(count);
-  vkEnumeratePhysicalDevices(m_vkInstance, &count, physicalDevices.data());
-  // ŏ̃foCXgp.
-  m_physicalDevice = physicalDevices[0];
-  vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_physicalMemProps);
-
-  // OtBbNX̃L[CfbNX擾.
-  SelectGraphicsQueue();
-
-#ifdef _DEBUG
-  EnableDebugReport();
-#endif
-  // _foCX̐.
-  CreateDevice();
-
-  // R}hv[̐.
-  CreateCommandPool();
-
-  VkSurfaceKHR surface;
-  auto result = glfwCreateWindowSurface(m_vkInstance, window, nullptr, &surface);
-  ThrowIfFailed(result, "glfwCreateWindowSurface Failed.");
-
-  // Xbv`FC̐.
-  m_swapchain = std::make_unique<Swapchain>(m_vkInstance, m_device, surface);
-
-  int width, height;
-  glfwGetWindowSize(window, &width, &height);
-  m_swapchain->Prepare(
-    m_physicalDevice, m_gfxQueueIndex,
-    uint32_t(width), uint32_t(height),
-    format
-  );
-  auto imageCount = m_swapchain->GetImageCount();
-  auto extent = m_swapchain->GetSurfaceExtent();
-
-  VkSemaphoreCreateInfo semCI{
-    VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-    nullptr, 0,
-  };
-
-  vkCreateSemaphore(m_device, &semCI, nullptr, &m_renderCompletedSem);
-  vkCreateSemaphore(m_device, &semCI, nullptr, &m_presentCompletedSem);
-
-  // fBXNv^v[̐.
-  CreateDescriptorPool();
-
-  m_renderPassStore = std::make_unique<RenderPassRegistry>([&](VkRenderPass renderPass) { vkDestroyRenderPass(m_device, renderPass, nullptr); });
-  m_descriptorSetLayoutStore = std::make_unique<DescriptorSetLayoutManager>([&](VkDescriptorSetLayout layout) { vkDestroyDescriptorSetLayout(m_device, layout, nullptr); });
-  m_pipelineLayoutStore = std::make_unique<PipelineLayoutManager>([&](VkPipelineLayout layout) { vkDestroyPipelineLayout(m_device, layout, nullptr); });
-
-  Prepare();
-
-  PrepareImGui();
-}
-
-void VulkanAppBase::Terminate()
-{
-  if (m_device != VK_NULL_HANDLE)
-  {
-    vkDeviceWaitIdle(m_device);
-  }
-  Cleanup();
-
-  CleanupImGui();
-
-  if (m_swapchain)
-  {
-    m_swapchain->Cleanup();
-  }
-#ifdef _DEBUG
-  DisableDebugReport();
-#endif
-
-  m_renderPassStore->Cleanup();
-  m_descriptorSetLayoutStore->Cleanup();
-  m_pipelineLayoutStore->Cleanup();
-
-  vkDestroySemaphore(m_device, m_renderCompletedSem, nullptr);
-  vkDestroySemaphore(m_device, m_presentCompletedSem, nullptr);
-
-  vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
-  vkDestroyCommandPool(m_device, m_commandPool, nullptr);
-  vkDestroyDevice(m_device, nullptr);
-  vkDestroyInstance(m_vkInstance, nullptr);
-  m_commandPool = VK_NULL_HANDLE;
-  m_device = VK_NULL_HANDLE;
-  m_vkInstance = VK_NULL_HANDLE;
-}
-
-VulkanAppBase::BufferObject VulkanAppBase::CreateBuffer(uint32_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props)
-{
-  BufferObject obj;
-  VkBufferCreateInfo bufferCI{
-    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-    nullptr, 0,
-    size, usage,
-    VK_SHARING_MODE_EXCLUSIVE,
-    0, nullptr
-  };
-  auto result = vkCreateBuffer(m_device, &bufferCI, nullptr, &obj.buffer);
-  ThrowIfFailed(result, "vkCreateBuffer Failed.");
-
-  // ʂ̎Zo.
-  VkMemoryRequirements reqs;
-  vkGetBufferMemoryRequirements(m_device, obj.buffer, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-    nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, props)
-  };
-  vkAllocateMemory(m_device, &info, nullptr, &obj.memory);
-  vkBindBufferMemory(m_device, obj.buffer, obj.memory, 0);
-  return obj;
-}
-
-VulkanAppBase::ImageObject VulkanAppBase::CreateTexture(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage)
-{
-  ImageObject obj;
-  VkImageCreateInfo imageCI{
-    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-    nullptr, 0,
-    VK_IMAGE_TYPE_2D,
-    format, { width, height, 1 },
-    1, 1, VK_SAMPLE_COUNT_1_BIT,
-    VK_IMAGE_TILING_OPTIMAL,
-    usage,
-    VK_SHARING_MODE_EXCLUSIVE,
-    0, nullptr,
-    VK_IMAGE_LAYOUT_UNDEFINED
-  };
-  auto result = vkCreateImage(m_device, &imageCI, nullptr, &obj.image);
-  ThrowIfFailed(result, "vkCreateImage Failed.");
-
-  // ʂ̎Zo.
-  VkMemoryRequirements reqs;
-  vkGetImageMemoryRequirements(m_device, obj.image, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-    nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-  };
-  result = vkAllocateMemory(m_device, &info, nullptr, &obj.memory);
-  ThrowIfFailed(result, "vkAllocateMemory Failed.");
-  vkBindImageMemory(m_device, obj.image, obj.memory, 0);
-
-  VkImageAspectFlags imageAspect = VK_IMAGE_ASPECT_COLOR_BIT;
-  if (usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)
-  {
-    imageAspect = VK_IMAGE_ASPECT_DEPTH_BIT;
-  }
-
-  VkImageViewCreateInfo viewCI{
-    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-    nullptr, 0,
-    obj.image,
-    VK_IMAGE_VIEW_TYPE_2D,
-    imageCI.format,
-    book_util::DefaultComponentMapping(),
-    { imageAspect, 0, 1, 0, 1}
-  };
-  result = vkCreateImageView(m_device, &viewCI, nullptr, &obj.view);
-  ThrowIfFailed(result, "vkCreateImageView Failed.");
-  return obj;
-}
-
-void VulkanAppBase::DestroyBuffer(BufferObject bufferObj)
-{
-  vkDestroyBuffer(m_device, bufferObj.buffer, nullptr);
-  vkFreeMemory(m_device, bufferObj.memory, nullptr);
-}
-
-void VulkanAppBase::DestroyImage(ImageObject imageObj)
-{
-  vkDestroyImage(m_device, imageObj.image, nullptr);
-  vkFreeMemory(m_device, imageObj.memory, nullptr);
-  if (imageObj.view != VK_NULL_HANDLE)
-  {
-    vkDestroyImageView(m_device, imageObj.view, nullptr);
-  }
-}
-
-VkFramebuffer VulkanAppBase::CreateFramebuffer(
-  VkRenderPass renderPass, uint32_t width, uint32_t height, uint32_t viewCount, VkImageView* views)
-{
-  VkFramebufferCreateInfo fbCI{
-    VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
-    nullptr, 0,
-    renderPass,
-    viewCount, views,
-    width, height,
-    1,
-  };
-  VkFramebuffer framebuffer;
-  auto result = vkCreateFramebuffer(m_device, &fbCI, nullptr, &framebuffer);
-  ThrowIfFailed(result, "vkCreateFramebuffer Failed.");
-  return framebuffer;
-}
-void VulkanAppBase::DestroyFramebuffers(uint32_t count, VkFramebuffer* framebuffers)
-{
-  for (uint32_t i = 0; i < count; ++i)
-  {
-    vkDestroyFramebuffer(m_device, framebuffers[i], nullptr);
-  }
-}
-VkFence VulkanAppBase::CreateFence()
-{
-  VkFenceCreateInfo fenceCI{
-    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-    nullptr,
-    VK_FENCE_CREATE_SIGNALED_BIT
-  };
-  VkFence fence;
-  auto result = vkCreateFence(m_device, &fenceCI, nullptr, &fence);
-  ThrowIfFailed(result, "vkCreateFence Failed.");
-  return fence;
-}
-void VulkanAppBase::DestroyFence(VkFence fence)
-{
-  vkDestroyFence(m_device, fence, nullptr);
-}
-
-VkDescriptorSet VulkanAppBase::AllocateDescriptorSet(VkDescriptorSetLayout dsLayout)
-{
-  VkDescriptorSetAllocateInfo descriptorSetAI{
-    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-    nullptr, m_descriptorPool,
-    1, &dsLayout
-  };
-
-  VkDescriptorSet ds;
-  auto result = vkAllocateDescriptorSets(m_device, &descriptorSetAI, &ds);
-  ThrowIfFailed(result, "vkAllocateDescriptorSets Failed.");
-  return ds;
-}
-void VulkanAppBase::DeallocateDescriptorSet(VkDescriptorSet descriptorSet)
-{
-  vkFreeDescriptorSets(m_device, m_descriptorPool, 1, &descriptorSet);
-}
-
-
-VkCommandBuffer VulkanAppBase::CreateCommandBuffer(bool bBegin)
-{
-  VkCommandBufferAllocateInfo commandAI{
-     VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-    nullptr, m_commandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-    1
-  };
-  VkCommandBufferBeginInfo beginInfo{
-    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-  };
-
-  VkCommandBuffer command;
-  vkAllocateCommandBuffers(m_device, &commandAI, &command);
-  if (bBegin)
-  {
-    vkBeginCommandBuffer(command, &beginInfo);
-  }
-  return command;
-}
-
-void VulkanAppBase::FinishCommandBuffer(VkCommandBuffer command)
-{
-  auto result = vkEndCommandBuffer(command);
-  ThrowIfFailed(result, "vkEndCommandBuffer Failed.");
-  VkFence fence;
-  VkFenceCreateInfo fenceCI{
-    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-    nullptr, 0
-  };
-  result = vkCreateFence(m_device, &fenceCI, nullptr, &fence);
-
-  VkSubmitInfo submitInfo{
-    VK_STRUCTURE_TYPE_SUBMIT_INFO,
-    nullptr,
-    0, nullptr,
-    nullptr,
-    1, &command,
-    0, nullptr,
-  };
-  vkQueueSubmit(m_deviceQueue, 1, &submitInfo, fence);
-  vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
-  vkDestroyFence(m_device, fence, nullptr);
-}
-
-void VulkanAppBase::DestroyCommandBuffer(VkCommandBuffer command)
-{
-  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
-}
-
-VkRect2D VulkanAppBase::GetSwapchainRenderArea() const
-{
-  return VkRect2D{
-    VkOffset2D{0,0},
-    m_swapchain->GetSurfaceExtent()
-  };
-}
-
-std::vector<VulkanAppBase::BufferObject> VulkanAppBase::CreateUniformBuffers(uint32_t bufferSize, uint32_t imageCount)
-{
-  std::vector<BufferObject> buffers(imageCount);
-  for (auto& b : buffers)
-  {
-    VkMemoryPropertyFlags props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    b = CreateBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, props);
-  }
-  return buffers;
-}
-
-void VulkanAppBase::WriteToHostVisibleMemory(VkDeviceMemory memory, uint32_t size, const void* pData)
-{
-  void* p;
-  vkMapMemory(m_device, memory, 0, VK_WHOLE_SIZE, 0, &p);
-  memcpy(p, pData, size);
-  vkUnmapMemory(m_device, memory);
-}
-
-void VulkanAppBase::AllocateCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands)
-{
-  VkCommandBufferAllocateInfo commandAI{
-    VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-    nullptr, m_commandPool,
-    VK_COMMAND_BUFFER_LEVEL_SECONDARY, count
-  };
-  auto result = vkAllocateCommandBuffers(m_device, &commandAI, pCommands);
-  ThrowIfFailed(result, "vkAllocateCommandBuffers Faield.");
-}
-
-void VulkanAppBase::FreeCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands)
-{
-  vkFreeCommandBuffers(m_device, m_commandPool, count, pCommands);
-}
-
-void VulkanAppBase::TransferStageBufferToImage(
-  const BufferObject& srcBuffer, const ImageObject& dstImage, const VkBufferImageCopy* region)
-{ 
-  VkImageMemoryBarrier imb{
-    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
-    0, VK_ACCESS_TRANSFER_WRITE_BIT,
-    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
-    dstImage.image,
-    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 }
-  };
-
-  // Staging ].
-  auto command = CreateCommandBuffer();
-  vkCmdPipelineBarrier(command,
-    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-    0, 0, nullptr,
-    0, nullptr, 1, &imb);
-
-  vkCmdCopyBufferToImage(
-    command, 
-    srcBuffer.buffer, dstImage.image,
-    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, region);
-  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-  imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-  vkCmdPipelineBarrier(command,
-    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-    0, 0, nullptr,
-    0, nullptr,
-    1, &imb);
-  FinishCommandBuffer(command);
-  DestroyCommandBuffer(command);
-}
-
-
-VkRenderPass VulkanAppBase::CreateRenderPass(VkFormat colorFormat, VkFormat depthFormat, VkImageLayout layoutColor)
-{
-  VkRenderPass renderPass;
-
-  std::vector<VkAttachmentDescription> attachments;
-
-  if (colorFormat == VK_FORMAT_UNDEFINED)
-  {
-    colorFormat = m_swapchain->GetSurfaceFormat().format;
-  }
-
-  VkAttachmentDescription colorTarget, depthTarget;
-  colorTarget = VkAttachmentDescription{
-    0,  // Flags
-    colorFormat,
-    VK_SAMPLE_COUNT_1_BIT,
-    VK_ATTACHMENT_LOAD_OP_CLEAR,
-    VK_ATTACHMENT_STORE_OP_STORE,
-    VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-    VK_ATTACHMENT_STORE_OP_DONT_CARE,
-    VK_IMAGE_LAYOUT_UNDEFINED,
-    layoutColor
-  };
-  depthTarget = VkAttachmentDescription{
-    0,
-    depthFormat,
-    VK_SAMPLE_COUNT_1_BIT,
-    VK_ATTACHMENT_LOAD_OP_CLEAR,
-    VK_ATTACHMENT_STORE_OP_STORE,
-    VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-    VK_ATTACHMENT_STORE_OP_DONT_CARE,
-    VK_IMAGE_LAYOUT_UNDEFINED,
-    VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-  };
-
-  VkAttachmentReference colorRef{
-    0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-  };
-  VkAttachmentReference depthRef{
-    1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-  };
-
-  VkSubpassDescription subpassDesc{
-    0, // Flags
-    VK_PIPELINE_BIND_POINT_GRAPHICS,
-    0, nullptr, // InputAttachments
-    1, &colorRef, // ColorAttachments
-    nullptr,    // ResolveAttachments
-    nullptr,    // DepthStencilAttachments
-    0, nullptr, // PreserveAttachments
-  };
-
-  attachments.push_back(colorTarget);
-  if (depthFormat != VK_FORMAT_UNDEFINED)
-  {
-    attachments.push_back(depthTarget);
-    subpassDesc.pDepthStencilAttachment = &depthRef;
-  }
-
-  VkRenderPassCreateInfo rpCI{
-    VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
-    nullptr, 0,
-    uint32_t(attachments.size()), attachments.data(),
-    1, &subpassDesc,
-    0, nullptr, // Dependency
-  };
-  auto result = vkCreateRenderPass(m_device, &rpCI, nullptr, &renderPass);
-  ThrowIfFailed(result, "vkCreateRenderPass Failed.");
-  return renderPass;
-}
-
-
-void VulkanAppBase::PrepareImGui()
-{
-  // ImGui
-  IMGUI_CHECKVERSION();
-  ImGui::CreateContext();
-  ImGui_ImplGlfw_InitForVulkan(m_window, true);
-
-  ImGui_ImplVulkan_InitInfo info{};
-  info.Instance = m_vkInstance;
-  info.PhysicalDevice = m_physicalDevice;
-  info.Device = m_device;
-  info.QueueFamily = m_gfxQueueIndex;
-  info.Queue = m_deviceQueue;
-  info.DescriptorPool = m_descriptorPool;
-  info.MinImageCount = m_swapchain->GetImageCount();
-  info.ImageCount = m_swapchain->GetImageCount();
-  ImGui_ImplVulkan_Init(&info, GetRenderPass("default"));
-
-  // tHgeNX`].
-  VkCommandBufferAllocateInfo commandAI{
-   VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-    nullptr, m_commandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1
-  };
-  VkCommandBufferBeginInfo beginInfo{
-    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-  };
-
-  VkCommandBuffer command;
-  vkAllocateCommandBuffers(m_device, &commandAI, &command);
-  vkBeginCommandBuffer(command, &beginInfo);
-  ImGui_ImplVulkan_CreateFontsTexture(command);
-  vkEndCommandBuffer(command);
-
-  VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO, nullptr };
-  submitInfo.pCommandBuffers = &command;
-  submitInfo.commandBufferCount = 1;
-  vkQueueSubmit(m_deviceQueue, 1, &submitInfo, VK_NULL_HANDLE);
-
-  // tHgeNX`]̊҂.
-  vkDeviceWaitIdle(m_device);
-  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
-}
-
-void VulkanAppBase::CleanupImGui()
-{
-  ImGui_ImplVulkan_Shutdown();
-  ImGui_ImplGlfw_Shutdown();
-  ImGui::DestroyContext();
-}
-
-
-void VulkanAppBase::CreateInstance()
-{
-  VkApplicationInfo appinfo{};
-  appinfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-  appinfo.pApplicationName = "VulkanBook2";
-  appinfo.pEngineName = "VulkanBook2";
-  appinfo.apiVersion = VK_API_VERSION_1_1;
-  appinfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-
-  // g̎擾.
-  uint32_t count;
-  vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr);
-  std::vector<VkExtensionProperties> props(count);
-  vkEnumerateInstanceExtensionProperties(nullptr, &count, props.data());
-  std::vector<const char*> extensions;
-  extensions.reserve(count);
-  for (const auto& v : props)
-  {
-    extensions.push_back(v.extensionName);
-  }
-
-  VkInstanceCreateInfo instanceCI{};
-  instanceCI.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-  instanceCI.enabledExtensionCount = count;
-  instanceCI.ppEnabledExtensionNames = extensions.data();
-  instanceCI.pApplicationInfo = &appinfo;
-#ifdef _DEBUG
-  // fobOrhɂ͌؃C[L
-  const char* layers[] = { "VK_LAYER_KHRONOS_validation" };
-  if (VK_HEADER_VERSION_COMPLETE < VK_MAKE_VERSION(1, 1, 106)) {
-	  // "VK_LAYER_LUNARG_standard_validation" ͔p~ɂȂĂ邪̂ Vulkan SDK ł͓̂őΏĂ.
-	  layers[0] = "VK_LAYER_LUNARG_standard_validation";
-  }
-  instanceCI.enabledLayerCount = 1;
-  instanceCI.ppEnabledLayerNames = layers;
-#endif
-  auto result = vkCreateInstance(&instanceCI, nullptr, &m_vkInstance);
-  ThrowIfFailed(result, "vkCreateInstance Failed.");
-}
-
-void VulkanAppBase::SelectGraphicsQueue()
-{
-  // OtBbNXL[̃CfbNXl擾.
-  uint32_t queuePropCount;
-  vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queuePropCount, nullptr);
-  std::vector<VkQueueFamilyProperties> queueFamilyProps(queuePropCount);
-  vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queuePropCount, queueFamilyProps.data());
-  uint32_t graphicsQueue = ~0u;
-  for (uint32_t i = 0; i < queuePropCount; ++i)
-  {
-    if (queueFamilyProps[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)
-    {
-      graphicsQueue = i; break;
-    }
-  }
-  m_gfxQueueIndex = graphicsQueue;
-}
-
-void VulkanAppBase::CreateDevice()
-{
-  const float defaultQueuePriority(1.0f);
-  VkDeviceQueueCreateInfo devQueueCI{
-    VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
-    nullptr, 0,
-    m_gfxQueueIndex,
-    1, &defaultQueuePriority
-  };
-  uint32_t count;
-  vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &count, nullptr);
-  std::vector<VkExtensionProperties> deviceExtensions(count);
-  vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &count, deviceExtensions.data());
-
-  std::vector<const char*> extensions;
-  extensions.reserve(count);
-  for (const auto& v : deviceExtensions)
-  {
-    extensions.push_back(v.extensionName);
-  }
-
-  VkPhysicalDeviceFeatures features{};
-  vkGetPhysicalDeviceFeatures(m_physicalDevice, &features);
-
-  VkDeviceCreateInfo deviceCI{
-    VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-    nullptr, 0,
-    1, &devQueueCI,
-    0, nullptr,
-    count, extensions.data(),
-    &features
-  };
-  auto result = vkCreateDevice(m_physicalDevice, &deviceCI, nullptr, &m_device);
-  ThrowIfFailed(result, "vkCreateDevice Failed.");
-
-  vkGetDeviceQueue(m_device, m_gfxQueueIndex, 0, &m_deviceQueue);
-}
-
-void VulkanAppBase::CreateCommandPool()
-{
-  VkCommandPoolCreateInfo cmdPoolCI{
-    VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-    nullptr,
-    VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-    m_gfxQueueIndex
-  };
-  auto result = vkCreateCommandPool(m_device, &cmdPoolCI, nullptr, &m_commandPool);
-  ThrowIfFailed(result, "vkCreateCommandPool Failed.");
-}
-
-void VulkanAppBase::CreateDescriptorPool()
-{
-  VkResult result;
-  VkDescriptorPoolSize poolSize[] = {
-    { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000 },
-    { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1000 },
-  };
-  VkDescriptorPoolCreateInfo descPoolCI{
-    VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-    nullptr,  VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
-    1000 * _countof(poolSize), // maxSets
-    _countof(poolSize), poolSize,
-  };
-  result = vkCreateDescriptorPool(m_device, &descPoolCI, nullptr, &m_descriptorPool);
-  ThrowIfFailed(result, "vkCreateDescriptorPool Failed.");
-}
-
-VkDeviceMemory VulkanAppBase::AllocateMemory(VkBuffer buffer, VkMemoryPropertyFlags memProps)
-{
-  VkDeviceMemory memory;
-  VkMemoryRequirements reqs;
-  vkGetBufferMemoryRequirements(m_device, buffer, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-    nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-  };
-  auto result = vkAllocateMemory(m_device, &info, nullptr, &memory);
-  ThrowIfFailed(result, "vkAllocateMemory Failed.");
-  return memory;
-}
-
-VkDeviceMemory VulkanAppBase::AllocateMemory(VkImage image, VkMemoryPropertyFlags memProps)
-{
-  VkDeviceMemory memory;
-  VkMemoryRequirements reqs;
-  vkGetImageMemoryRequirements(m_device, image, &reqs);
-  VkMemoryAllocateInfo info{
-    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-    nullptr,
-    reqs.size,
-    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-  };
-  auto result = vkAllocateMemory(m_device, &info, nullptr, &memory);
-  ThrowIfFailed(result, "vkAllocateMemory Failed.");
-  return memory;
-}
-
-
-#define GetInstanceProcAddr(FuncName) \
-  m_##FuncName = reinterpret_cast<PFN_##FuncName>(vkGetInstanceProcAddr(m_vkInstance, #FuncName))
-
-void VulkanAppBase::EnableDebugReport()
-{
-  GetInstanceProcAddr(vkCreateDebugReportCallbackEXT);
-  GetInstanceProcAddr(vkDebugReportMessageEXT);
-  GetInstanceProcAddr(vkDestroyDebugReportCallbackEXT);
-
-  VkDebugReportFlagsEXT flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
-
-  VkDebugReportCallbackCreateInfoEXT drcCI{};
-  drcCI.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
-  drcCI.flags = flags;
-  drcCI.pfnCallback = &DebugReportCallback;
-  auto result = m_vkCreateDebugReportCallbackEXT(m_vkInstance, &drcCI, nullptr, &m_debugReport);
-  ThrowIfFailed(result, "vkCreateDebugReportCallback Failed.");
-}
-
-void VulkanAppBase::DisableDebugReport()
-{
-  if (m_vkDestroyDebugReportCallbackEXT)
-  {
-    m_vkDestroyDebugReportCallbackEXT(m_vkInstance, m_debugReport, nullptr);
-  }
-}
-
-void VulkanAppBase::MsgLoopMinimizedWindow()
-{
-  int width, height;
-  do
-  {
-    glfwGetWindowSize(m_window, &width, &height);
-    glfwWaitEvents();
-  } while (width == 0 || height == 0);
-}
+#include "VulkanAppBase.h"
+#include "VulkanBookUtil.h"
+#include "Camera.h"
+#include "MatrixMath.h"
+#include "KtxTexture.h"
+#include "MipmapGenerator.h"
+
+#include "imgui.h"
+#include "examples/imgui_impl_vulkan.h"
+#include "examples/imgui_impl_glfw.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+
+#include <vector>
+#include <sstream>
+#include <chrono>
+#include <future>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+static VkBool32 VKAPI_CALL DebugReportCallback(
+  VkDebugReportFlagsEXT flags,
+  VkDebugReportObjectTypeEXT objactTypes,
+  uint64_t object,
+  size_t	location,
+  int32_t messageCode,
+  const char* pLayerPrefix,
+  const char* pMessage,
+  void* pUserData)
+{
+  VkBool32 ret = VK_FALSE;
+  if (flags & VK_DEBUG_REPORT_INFORMATION_BIT_EXT ||
+    flags & VK_DEBUG_REPORT_DEBUG_BIT_EXT)
+  {
+    ret = VK_TRUE;
+  }
+  std::stringstream ss;
+  if (pLayerPrefix)
+  {
+    ss << "[" << pLayerPrefix << "] ";
+  }
+  ss << pMessage << std::endl;
+
+  book_util::OutputLog(ss.str());
+
+  return ret;
+}
+
+
+// 例外で抜けた場合も含め、Dismiss されなければスコープの終わりで後始末を行う.
+class ScopeGuard
+{
+public:
+  explicit ScopeGuard(std::function<void()> cleanup) : m_cleanup(cleanup) { }
+  ~ScopeGuard()
+  {
+    if (m_cleanup)
+    {
+      m_cleanup();
+    }
+  }
+  void Dismiss() { m_cleanup = nullptr; }
+private:
+  ScopeGuard(const ScopeGuard&) = delete;
+  ScopeGuard& operator=(const ScopeGuard&) = delete;
+  std::function<void()> m_cleanup;
+};
+
+// KTX2 ファイルの内容に合わせたビューの種類.
+static VkImageViewType GetKtxViewType(const KtxTexture& ktx)
+{
+  if (ktx.IsCubemap())
+  {
+    return ktx.IsArray() ? VK_IMAGE_VIEW_TYPE_CUBE_ARRAY : VK_IMAGE_VIEW_TYPE_CUBE;
+  }
+  return ktx.IsArray() ? VK_IMAGE_VIEW_TYPE_2D_ARRAY : VK_IMAGE_VIEW_TYPE_2D;
+}
+
+bool VulkanAppBase::OnSizeChanged(uint32_t width, uint32_t height)
+{
+  m_isMinimizedWindow = (width == 0 || height == 0);
+  if (m_isMinimizedWindow)
+  {
+    return false;
+  }
+  // GPU の完了は待たずに、次のフレーム開始時にスワップチェインを作り直す.
+  m_isSwapchainDirty = true;
+  return true;
+}
+
+const float VulkanAppBase::CameraTrackTimeStep = 1.0f / 60.0f;
+
+bool VulkanAppBase::OnMouseButtonDown(int button)
+{
+  if (IsCameraPlaying())
+  {
+    return true;
+  }
+  return ImGui::GetIO().WantCaptureMouse;
+}
+
+bool VulkanAppBase::OnMouseButtonUp(int button)
+{
+  if (IsCameraPlaying())
+  {
+    return true;
+  }
+  return ImGui::GetIO().WantCaptureMouse;
+}
+
+bool VulkanAppBase::OnMouseMove(int dx, int dy)
+{
+  if (IsCameraPlaying())
+  {
+    return true;
+  }
+  return ImGui::GetIO().WantCaptureMouse;
+}
+
+
+uint32_t VulkanAppBase::GetMemoryTypeIndex(uint32_t requestBits, VkMemoryPropertyFlags requestProps) const
+{
+  uint32_t result = ~0u;
+  for (uint32_t i = 0; i < m_physicalMemProps.memoryTypeCount; ++i)
+  {
+    if (requestBits & 1)
+    {
+      const auto& types = m_physicalMemProps.memoryTypes[i];
+      if ((types.propertyFlags & requestProps) == requestProps)
+      {
+        result = i;
+        break;
+      }
+    }
+    requestBits >>= 1;
+  }
+  return result;
+}
+
+void VulkanAppBase::SwitchFullscreen(GLFWwindow* window)
+{
+  static int lastWindowPosX, lastWindowPosY;
+  static int lastWindowSizeW, lastWindowSizeH;
+
+  auto monitor = glfwGetPrimaryMonitor();
+  const auto mode = glfwGetVideoMode(monitor);
+
+#if 1 // 現在のモニターに合わせたサイズへ変更.
+  if (!m_isFullscreen)
+  {
+    // to fullscreen
+    glfwGetWindowPos(window, &lastWindowPosX, &lastWindowPosY);
+    glfwGetWindowSize(window, &lastWindowSizeW, &lastWindowSizeH);
+    glfwSetWindowMonitor(window, monitor, 0, 0, mode->width, mode->height, mode->refreshRate);
+  }
+  else
+  {
+    // to windowmode
+    glfwSetWindowMonitor(window, nullptr, lastWindowPosX, lastWindowPosY, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
+  }
+#else
+  // 指定された解像度へモニターを変更.
+  if (!m_isFullscreen)
+  {
+    // to fullscreen
+    glfwGetWindowPos(window, &lastWindowPosX, &lastWindowPosY);
+    glfwGetWindowSize(window, &lastWindowSizeW, &lastWindowSizeH);
+    glfwSetWindowMonitor(window, monitor, 0, 0, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
+  }
+  else
+  {
+    // to windowmode
+    glfwSetWindowMonitor(window, nullptr, lastWindowPosX, lastWindowPosY, lastWindowSizeW, lastWindowSizeH, mode->refreshRate);
+  }
+#endif
+  m_isFullscreen = !m_isFullscreen;
+}
+
+void VulkanAppBase::Initialize(GLFWwindow* window, VkFormat format, bool isFullscreen)
+{
+  using Clock = std::chrono::high_resolution_clock;
+  auto lastTime = Clock::now();
+  auto recordTime = [&](const char* name) {
+    auto now = Clock::now();
+    m_startupTimes.emplace_back(name, std::chrono::duration<double, std::milli>(now - lastTime).count());
+    lastTime = now;
+  };
+  m_startupTimes.clear();
+  m_textureLoadTimes.clear();
+
+  m_window = window;
+  CreateInstance();
+  recordTime("instance");
+
+  // 物理デバイスの選択.
+  uint32_t count;
+  vkEnumeratePhysicalDevices(m_vkInstance, &count, nullptr);
+  std::vector<VkPhysicalDevice> physicalDevices(count);
+  vkEnumeratePhysicalDevices(m_vkInstance, &count, physicalDevices.data());
+  // 最初のデバイスを使用する.
+  m_physicalDevice = physicalDevices[0];
+  vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_physicalMemProps);
+
+  // グラフィックスのキューインデックス取得.
+  SelectGraphicsQueue();
+
+#ifdef _DEBUG
+  EnableDebugReport();
+#endif
+  // 論理デバイスの生成.
+  CreateDevice();
+
+  // コマンドプールの生成.
+  CreateCommandPool();
+  recordTime("device");
+
+  VkSurfaceKHR surface = VK_NULL_HANDLE;
+  if (!m_isHeadless)
+  {
+    auto result = glfwCreateWindowSurface(m_vkInstance, window, nullptr, &surface);
+    ThrowIfFailed(result, "glfwCreateWindowSurface Failed.");
+  }
+
+  // スワップチェインの生成.
+  m_swapchain = std::make_unique<Swapchain>(m_vkInstance, m_device, surface);
+  m_swapchain->SetDeferredDestroyFunc([&](std::function<void()> disposer) { DeferredDestroy(disposer); });
+  m_swapchain->SetPresentMode(m_presentMode);
+
+  int width, height;
+  glfwGetWindowSize(window, &width, &height);
+  m_swapchain->Prepare(
+    m_physicalDevice, m_gfxQueueIndex,
+    uint32_t(width), uint32_t(height),
+    format
+  );
+  auto imageCount = m_swapchain->GetImageCount();
+  auto extent = m_swapchain->GetSurfaceExtent();
+
+  VkSemaphoreCreateInfo semCI{
+    VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+    nullptr, 0,
+  };
+
+  vkCreateSemaphore(m_device, &semCI, nullptr, &m_renderCompletedSem);
+  vkCreateSemaphore(m_device, &semCI, nullptr, &m_presentCompletedSem);
+
+  // ディスクリプタプールの生成.
+  CreateDescriptorPool();
+
+  m_renderPassStore = std::make_unique<RenderPassRegistry>([&](VkRenderPass renderPass) { vkDestroyRenderPass(m_device, renderPass, nullptr); });
+  m_descriptorSetLayoutStore = std::make_unique<DescriptorSetLayoutManager>([&](VkDescriptorSetLayout layout) { vkDestroyDescriptorSetLayout(m_device, layout, nullptr); });
+  m_pipelineLayoutStore = std::make_unique<PipelineLayoutManager>([&](VkPipelineLayout layout) { vkDestroyPipelineLayout(m_device, layout, nullptr); });
+
+  m_frameCapture = std::make_unique<FrameCapture>(this);
+  m_gpuProfiler.Initialize(m_device, m_physicalDevice, m_gfxQueueIndex, imageCount);
+  recordTime("swapchain");
+
+  Prepare();
+  recordTime("prepare");
+
+  PrepareImGui();
+  recordTime("imgui");
+}
+
+void VulkanAppBase::Terminate()
+{
+  if (m_device != VK_NULL_HANDLE)
+  {
+    vkDeviceWaitIdle(m_device);
+  }
+  // 読み込み途中のテクスチャを破棄する. 仮テクスチャは各サンプルの Cleanup で破棄される.
+  for (auto& request : m_asyncTextures)
+  {
+    if (request.isSubmitted)
+    {
+      // 読み込みに失敗したものは image が仮テクスチャのため破棄しない.
+      if (!request.isFailed)
+      {
+        DestroyImage(request.image);
+      }
+      continue;
+    }
+    try
+    {
+      auto upload = request.upload.get();
+      DestroyBuffer(upload.staging);
+      DestroyImage(upload.image);
+    }
+    catch (const std::exception&)
+    {
+    }
+  }
+  m_asyncTextures.clear();
+  ProcessDeferredDestroy();
+  if (m_frameCapture)
+  {
+    m_frameCapture->Cleanup();
+  }
+  m_gpuProfiler.Cleanup();
+  Cleanup();
+
+  CleanupImGui();
+
+  if (m_swapchain)
+  {
+    m_swapchain->Cleanup();
+  }
+#ifdef _DEBUG
+  DisableDebugReport();
+#endif
+
+  m_renderPassStore->Cleanup();
+  m_descriptorSetLayoutStore->Cleanup();
+  m_pipelineLayoutStore->Cleanup();
+
+  vkDestroySemaphore(m_device, m_renderCompletedSem, nullptr);
+  vkDestroySemaphore(m_device, m_presentCompletedSem, nullptr);
+
+  vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+  vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+  vkDestroyDevice(m_device, nullptr);
+  vkDestroyInstance(m_vkInstance, nullptr);
+  m_commandPool = VK_NULL_HANDLE;
+  m_device = VK_NULL_HANDLE;
+  m_vkInstance = VK_NULL_HANDLE;
+}
+
+VulkanAppBase::BufferObject VulkanAppBase::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props)
+{
+  BufferObject obj;
+  VkBufferCreateInfo bufferCI{
+    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+    nullptr, 0,
+    size, usage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr
+  };
+  auto result = vkCreateBuffer(m_device, &bufferCI, nullptr, &obj.buffer);
+  ThrowIfFailed(result, "vkCreateBuffer Failed.");
+
+  // メモリ量の算出.
+  VkMemoryRequirements reqs;
+  vkGetBufferMemoryRequirements(m_device, obj.buffer, &reqs);
+  VkMemoryAllocateInfo info{
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+    nullptr,
+    reqs.size,
+    GetMemoryTypeIndex(reqs.memoryTypeBits, props)
+  };
+  vkAllocateMemory(m_device, &info, nullptr, &obj.memory);
+  vkBindBufferMemory(m_device, obj.buffer, obj.memory, 0);
+  return obj;
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::CreateTexture(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage)
+{
+  ImageObject obj;
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+    nullptr, 0,
+    VK_IMAGE_TYPE_2D,
+    format, { width, height, 1 },
+    1, 1, VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  auto result = vkCreateImage(m_device, &imageCI, nullptr, &obj.image);
+  ThrowIfFailed(result, "vkCreateImage Failed.");
+
+  // メモリ量の算出.
+  VkMemoryRequirements reqs;
+  vkGetImageMemoryRequirements(m_device, obj.image, &reqs);
+  VkMemoryAllocateInfo info{
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+    nullptr,
+    reqs.size,
+    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+  };
+  result = vkAllocateMemory(m_device, &info, nullptr, &obj.memory);
+  ThrowIfFailed(result, "vkAllocateMemory Failed.");
+  vkBindImageMemory(m_device, obj.image, obj.memory, 0);
+
+  VkImageAspectFlags imageAspect = VK_IMAGE_ASPECT_COLOR_BIT;
+  if (usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)
+  {
+    imageAspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+  }
+
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    obj.image,
+    VK_IMAGE_VIEW_TYPE_2D,
+    imageCI.format,
+    book_util::DefaultComponentMapping(),
+    { imageAspect, 0, 1, 0, 1}
+  };
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &obj.view);
+  ThrowIfFailed(result, "vkCreateImageView Failed.");
+  return obj;
+}
+
+void VulkanAppBase::DestroyBuffer(BufferObject bufferObj)
+{
+  vkDestroyBuffer(m_device, bufferObj.buffer, nullptr);
+  vkFreeMemory(m_device, bufferObj.memory, nullptr);
+}
+
+void VulkanAppBase::DestroyImage(ImageObject imageObj)
+{
+  vkDestroyImage(m_device, imageObj.image, nullptr);
+  vkFreeMemory(m_device, imageObj.memory, nullptr);
+  if (imageObj.view != VK_NULL_HANDLE)
+  {
+    vkDestroyImageView(m_device, imageObj.view, nullptr);
+  }
+}
+
+VkFramebuffer VulkanAppBase::CreateFramebuffer(
+  VkRenderPass renderPass, uint32_t width, uint32_t height, uint32_t viewCount, VkImageView* views)
+{
+  VkFramebufferCreateInfo fbCI{
+    VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+    nullptr, 0,
+    renderPass,
+    viewCount, views,
+    width, height,
+    1,
+  };
+  VkFramebuffer framebuffer;
+  auto result = vkCreateFramebuffer(m_device, &fbCI, nullptr, &framebuffer);
+  ThrowIfFailed(result, "vkCreateFramebuffer Failed.");
+  return framebuffer;
+}
+void VulkanAppBase::DestroyFramebuffers(uint32_t count, VkFramebuffer* framebuffers)
+{
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    vkDestroyFramebuffer(m_device, framebuffers[i], nullptr);
+  }
+}
+VkFence VulkanAppBase::CreateFence()
+{
+  VkFenceCreateInfo fenceCI{
+    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    nullptr,
+    VK_FENCE_CREATE_SIGNALED_BIT
+  };
+  VkFence fence;
+  auto result = vkCreateFence(m_device, &fenceCI, nullptr, &fence);
+  ThrowIfFailed(result, "vkCreateFence Failed.");
+  return fence;
+}
+void VulkanAppBase::DestroyFence(VkFence fence)
+{
+  vkDestroyFence(m_device, fence, nullptr);
+}
+
+VkDescriptorSet VulkanAppBase::AllocateDescriptorSet(VkDescriptorSetLayout dsLayout)
+{
+  VkDescriptorSetAllocateInfo descriptorSetAI{
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+    nullptr, m_descriptorPool,
+    1, &dsLayout
+  };
+
+  VkDescriptorSet ds;
+  auto result = vkAllocateDescriptorSets(m_device, &descriptorSetAI, &ds);
+  ThrowIfFailed(result, "vkAllocateDescriptorSets Failed.");
+  return ds;
+}
+void VulkanAppBase::DeallocateDescriptorSet(VkDescriptorSet descriptorSet)
+{
+  vkFreeDescriptorSets(m_device, m_descriptorPool, 1, &descriptorSet);
+}
+
+
+VkCommandBuffer VulkanAppBase::CreateCommandBuffer(bool bBegin)
+{
+  VkCommandBufferAllocateInfo commandAI{
+     VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+    nullptr, m_commandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+    1
+  };
+  VkCommandBufferBeginInfo beginInfo{
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+  };
+
+  VkCommandBuffer command;
+  vkAllocateCommandBuffers(m_device, &commandAI, &command);
+  if (bBegin)
+  {
+    vkBeginCommandBuffer(command, &beginInfo);
+  }
+  return command;
+}
+
+void VulkanAppBase::FinishCommandBuffer(VkCommandBuffer command)
+{
+  auto result = vkEndCommandBuffer(command);
+  ThrowIfFailed(result, "vkEndCommandBuffer Failed.");
+  VkFence fence;
+  VkFenceCreateInfo fenceCI{
+    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    nullptr, 0
+  };
+  result = vkCreateFence(m_device, &fenceCI, nullptr, &fence);
+
+  VkSubmitInfo submitInfo{
+    VK_STRUCTURE_TYPE_SUBMIT_INFO,
+    nullptr,
+    0, nullptr,
+    nullptr,
+    1, &command,
+    0, nullptr,
+  };
+  vkQueueSubmit(m_deviceQueue, 1, &submitInfo, fence);
+  vkWaitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
+  vkDestroyFence(m_device, fence, nullptr);
+}
+
+void VulkanAppBase::DestroyCommandBuffer(VkCommandBuffer command)
+{
+  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
+}
+
+VkRect2D VulkanAppBase::GetSwapchainRenderArea() const
+{
+  return VkRect2D{
+    VkOffset2D{0,0},
+    m_swapchain->GetSurfaceExtent()
+  };
+}
+
+bool VulkanAppBase::AcquireNextImage(uint32_t* pImageIndex)
+{
+  ProcessDeferredDestroy();
+  ProcessAsyncTextures();
+  if (m_frameCapture)
+  {
+    m_frameCapture->Update(m_completedSerial);
+  }
+  RecreateSwapchain();
+
+  auto result = m_swapchain->AcquireNextImage(pImageIndex, m_presentCompletedSem);
+  if (result == VK_ERROR_OUT_OF_DATE_KHR)
+  {
+    // サイズ変更通知より先に検出された場合. 作り直して再取得する.
+    m_isSwapchainDirty = true;
+    RecreateSwapchain();
+    result = m_swapchain->AcquireNextImage(pImageIndex, m_presentCompletedSem);
+  }
+  m_currentImageIndex = *pImageIndex;
+  if (result == VK_SUBOPTIMAL_KHR)
+  {
+    // イメージは取得できているためこのフレームは表示し、次のフレームで作り直す.
+    m_isSwapchainDirty = true;
+    return true;
+  }
+  return result == VK_SUCCESS;
+}
+
+void VulkanAppBase::SubmitFrame(VkCommandBuffer command, VkFence fence, uint32_t imageIndex)
+{
+  VkCommandBuffer commands[2] = { command, VK_NULL_HANDLE };
+  uint32_t commandCount = 1;
+  if (IsFrameCapturing())
+  {
+    // 描画結果の読み戻しは同じ送信の後ろに追加する.
+    auto captureCommand = m_frameCapture->RecordCopy(
+      m_swapchain->GetImage(imageIndex),
+      m_swapchain->GetSurfaceExtent(),
+      m_swapchain->GetSurfaceFormat().format,
+      m_submitSerial + 1);
+    if (captureCommand != VK_NULL_HANDLE)
+    {
+      commands[commandCount++] = captureCommand;
+    }
+  }
+
+  VkPipelineStageFlags waitStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  VkSubmitInfo submitInfo{
+    VK_STRUCTURE_TYPE_SUBMIT_INFO,
+    nullptr,
+    1, &m_presentCompletedSem, // WaitSemaphore
+    &waitStageMask, // DstStageMask
+    commandCount, commands, // CommandBuffer
+    1, &m_renderCompletedSem, // SignalSemaphore
+  };
+  vkResetFences(m_device, 1, &fence);
+  auto result = vkQueueSubmit(m_deviceQueue, 1, &submitInfo, fence);
+  ThrowIfFailed(result, "vkQueueSubmit Failed.");
+
+  // 呼び出し側はフェンスを待ってから再利用しているので、以前の番号の送信は完了済みとなる.
+  ++m_submitSerial;
+  m_fenceSerials[fence] = m_submitSerial;
+  m_inflightSubmits.push_back(SubmitRecord{ m_submitSerial, fence });
+
+  result = m_swapchain->QueuePresent(m_deviceQueue, imageIndex, m_renderCompletedSem);
+  if (result == VK_SUBOPTIMAL_KHR || result == VK_ERROR_OUT_OF_DATE_KHR)
+  {
+    m_isSwapchainDirty = true;
+  }
+}
+
+void VulkanAppBase::DeferredDestroy(std::function<void()> disposer)
+{
+  m_deferredObjects.push_back(DeferredObject{ m_submitSerial, disposer });
+}
+
+void VulkanAppBase::StartFrameCapture(const std::string& directory, FrameCapture::Format format, uint32_t maxFrames)
+{
+  if ((m_swapchain->GetImageUsage() & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) == 0)
+  {
+    // スワップチェインイメージから読み出せない環境.
+    return;
+  }
+  // 描画中のフレーム数より多くのバッファを用意して、読み戻しで待たないようにする.
+  auto ringSize = m_swapchain->GetImageCount() + 2;
+  m_frameCapture->Start(directory, format, ringSize, maxFrames);
+}
+
+void VulkanAppBase::StopFrameCapture()
+{
+  m_frameCapture->Stop();
+}
+
+void VulkanAppBase::BeginGpuPass(VkCommandBuffer command, const char* name)
+{
+  // 次に送信する番号でフレームの切り替わりを判定する.
+  if (m_profiledSerial != m_submitSerial + 1)
+  {
+    m_profiledSerial = m_submitSerial + 1;
+    m_gpuProfiler.BeginFrame(command, m_currentImageIndex);
+  }
+  m_gpuProfiler.BeginPass(command, name);
+}
+
+void VulkanAppBase::EndGpuPass(VkCommandBuffer command)
+{
+  m_gpuProfiler.EndPass(command);
+}
+
+void VulkanAppBase::StartCameraPlayback(const CameraPath& path)
+{
+  if (GetCamera() == nullptr || path.IsEmpty())
+  {
+    return;
+  }
+  m_cameraPath = path;
+  m_cameraTrackMode = CameraTrackMode::Playback;
+  m_cameraTrackFrame = 0;
+}
+
+void VulkanAppBase::StopCameraPlayback()
+{
+  if (m_cameraTrackMode == CameraTrackMode::Playback)
+  {
+    m_cameraTrackMode = CameraTrackMode::None;
+  }
+}
+
+void VulkanAppBase::StartCameraRecording()
+{
+  if (GetCamera() == nullptr)
+  {
+    return;
+  }
+  m_cameraPath.Clear();
+  m_cameraTrackMode = CameraTrackMode::Recording;
+  m_cameraTrackFrame = 0;
+}
+
+bool VulkanAppBase::StopCameraRecording(const std::string& fileName)
+{
+  if (m_cameraTrackMode != CameraTrackMode::Recording)
+  {
+    return false;
+  }
+  m_cameraTrackMode = CameraTrackMode::None;
+  if (fileName.empty())
+  {
+    return true;
+  }
+  return m_cameraPath.Save(fileName);
+}
+
+glm::mat4 VulkanAppBase::CreatePerspective(float fovy, float aspect, float zNear, float zFar) const
+{
+  if (m_depthMode == DepthMode::ReverseZ)
+  {
+    return book_util::PerspectiveInfiniteReverseZ(fovy, aspect, zNear);
+  }
+  return glm::perspectiveRH(fovy, aspect, zNear, zFar);
+}
+
+void VulkanAppBase::UpdateCamera(float elapsedSeconds)
+{
+  auto camera = GetCamera();
+  if (camera == nullptr || IsCameraPlaying())
+  {
+    return;
+  }
+  if (m_cameraTrackMode == CameraTrackMode::Recording)
+  {
+    // 経路の時刻はフレーム数から求めるため、カメラの動きも同じ刻みで進めて実行ごとの差をなくす.
+    elapsedSeconds = CameraTrackTimeStep;
+  }
+  camera->Update(elapsedSeconds);
+}
+
+void VulkanAppBase::UpdateCameraTrack()
+{
+  auto camera = GetCamera();
+  if (camera == nullptr || m_cameraTrackMode == CameraTrackMode::None)
+  {
+    return;
+  }
+  float time = float(m_cameraTrackFrame) * CameraTrackTimeStep;
+  if (m_cameraTrackMode == CameraTrackMode::Playback)
+  {
+    camera->SetViewMatrix(m_cameraPath.Evaluate(time));
+  }
+  else
+  {
+    m_cameraPath.Record(time, camera->GetViewMatrix());
+  }
+  ++m_cameraTrackFrame;
+}
+
+void VulkanAppBase::RecreateSwapchain()
+{
+  if (!m_isSwapchainDirty || m_isMinimizedWindow)
+  {
+    return;
+  }
+  m_isSwapchainDirty = false;
+
+  int width, height;
+  glfwGetWindowSize(m_window, &width, &height);
+  auto format = m_swapchain->GetSurfaceFormat().format;
+  // 古いスワップチェインは遅延破棄に回るため、ここではデバイスの待機を行わない.
+  m_swapchain->Prepare(m_physicalDevice, m_gfxQueueIndex, uint32_t(width), uint32_t(height), format);
+
+  OnSwapchainRecreated();
+}
+
+void VulkanAppBase::ProcessDeferredDestroy()
+{
+  // 完了した送信を取り除く.
+  auto it = m_inflightSubmits.begin();
+  while (it != m_inflightSubmits.end())
+  {
+    bool isReused = m_fenceSerials[it->fence] != it->serial;
+    if (isReused || vkGetFenceStatus(m_device, it->fence) == VK_SUCCESS)
+    {
+      it = m_inflightSubmits.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  m_completedSerial = m_inflightSubmits.empty() ? m_submitSerial : m_inflightSubmits.front().serial - 1;
+
+  while (!m_deferredObjects.empty() && m_deferredObjects.front().serial <= m_completedSerial)
+  {
+    m_deferredObjects.front().disposer();
+    m_deferredObjects.pop_front();
+  }
+}
+
+std::vector<VulkanAppBase::BufferObject> VulkanAppBase::CreateUniformBuffers(uint32_t bufferSize, uint32_t imageCount)
+{
+  std::vector<BufferObject> buffers(imageCount);
+  for (auto& b : buffers)
+  {
+    VkMemoryPropertyFlags props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    b = CreateBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, props);
+  }
+  return buffers;
+}
+
+void VulkanAppBase::WriteToHostVisibleMemory(VkDeviceMemory memory, VkDeviceSize size, const void* pData)
+{
+  void* p;
+  vkMapMemory(m_device, memory, 0, VK_WHOLE_SIZE, 0, &p);
+  memcpy(p, pData, size_t(size));
+  vkUnmapMemory(m_device, memory);
+}
+
+VulkanAppBase::ModelData VulkanAppBase::UploadModel(const void* vertices, uint32_t vertexStride, uint32_t vertexCount,
+  const void* indices, uint32_t indexCount, VkIndexType indexType)
+{
+  ModelData model;
+  VkMemoryPropertyFlags srcMemoryProps = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  VkMemoryPropertyFlags dstMemoryProps = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  VkBufferUsageFlags usageVB = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  VkBufferUsageFlags usageIB = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  VkBufferCopy copyVB{}, copyIB{};
+
+  auto bufferSize = vertexStride * vertexCount;
+  auto uploadVB = CreateBuffer(bufferSize, usageVB, srcMemoryProps);
+  model.resVertexBuffer = CreateBuffer(bufferSize, usageVB, dstMemoryProps);
+  WriteToHostVisibleMemory(uploadVB.memory, bufferSize, vertices);
+  model.vertexCount = vertexCount;
+  copyVB.size = bufferSize;
+
+  bufferSize = (indexType == VK_INDEX_TYPE_UINT16 ? 2 : 4) * indexCount;
+  auto uploadIB = CreateBuffer(bufferSize, usageIB, srcMemoryProps);
+  model.resIndexBuffer = CreateBuffer(bufferSize, usageIB, dstMemoryProps);
+  WriteToHostVisibleMemory(uploadIB.memory, bufferSize, indices);
+  model.indexCount = indexCount;
+  model.indexType = indexType;
+  copyIB.size = bufferSize;
+
+  auto command = CreateCommandBuffer();
+  vkCmdCopyBuffer(command, uploadVB.buffer, model.resVertexBuffer.buffer, 1, &copyVB);
+  vkCmdCopyBuffer(command, uploadIB.buffer, model.resIndexBuffer.buffer, 1, &copyIB);
+  FinishCommandBuffer(command);
+
+  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
+  DestroyBuffer(uploadVB);
+  DestroyBuffer(uploadIB);
+
+  return model;
+}
+
+VulkanAppBase::ModelData VulkanAppBase::UploadCompactModel(const void* vertices, uint32_t vertexStride, uint32_t vertexCount, uint32_t normalOffset,
+  const uint32_t* indices, uint32_t indexCount, uint32_t flags)
+{
+  // メッシュレット、詳細度は指定された場合のみ量子化前の位置で求める. インデックスバッファには全詳細度を続けて格納する.
+  book_util::MeshletMesh meshlets;
+  if (flags & ModelFlag_Meshlets)
+  {
+    book_util::BuildMeshlets(meshlets, indices, indexCount, vertices, vertexCount, vertexStride);
+  }
+  std::vector<book_util::MeshLod> lods;
+  std::vector<uint32_t> lodIndices;
+  if (flags & ModelFlag_Lods)
+  {
+    book_util::BuildLodChain(lods, lodIndices, indices, indexCount, vertices, vertexCount, vertexStride, normalOffset);
+  }
+  else
+  {
+    lodIndices.assign(indices, indices + indexCount);
+  }
+  auto totalIndexCount = uint32_t(lodIndices.size());
+
+  if (!m_isCompactVertexEnabled)
+  {
+    auto model = UploadModel(vertices, vertexStride, vertexCount, lodIndices.data(), totalIndexCount);
+    model.indexCount = indexCount;
+    model.vertexLayout = book_util::GetFloatVertexInputLayout(vertexStride, normalOffset);
+    model.meshlets = std::move(meshlets.meshlets);
+    model.lods = std::move(lods);
+    UploadMeshlets(model);
+    return model;
+  }
+
+  auto quantization = book_util::ComputePositionQuantization(book_util::ComputeAabb(vertices, vertexCount, vertexStride));
+  std::vector<book_util::CompactVertex> compactVertices(vertexCount);
+  book_util::QuantizeVertices(compactVertices.data(), vertices, vertexCount, vertexStride, normalOffset, quantization);
+
+  ModelData model;
+  if (book_util::CanUse16BitIndices(vertexCount))
+  {
+    std::vector<uint16_t> indices16(totalIndexCount);
+    book_util::PackIndices16(indices16.data(), lodIndices.data(), totalIndexCount);
+    model = UploadModel(compactVertices.data(), uint32_t(sizeof(book_util::CompactVertex)), vertexCount,
+      indices16.data(), totalIndexCount, VK_INDEX_TYPE_UINT16);
+  }
+  else
+  {
+    model = UploadModel(compactVertices.data(), uint32_t(sizeof(book_util::CompactVertex)), vertexCount,
+      lodIndices.data(), totalIndexCount);
+  }
+  model.indexCount = indexCount;
+  model.vertexLayout = book_util::GetCompactVertexInputLayout();
+  model.decodeConstants = book_util::VertexDecodeConstants(true, quantization);
+  model.meshlets = std::move(meshlets.meshlets);
+  model.lods = std::move(lods);
+  UploadMeshlets(model);
+  return model;
+}
+
+bool VulkanAppBase::CanLoadModelFromMeshFile(const std::string& fileName)
+{
+  MeshFile mesh;
+  if (!mesh.Open(fileName) || mesh.IsCompact() != m_isCompactVertexEnabled || mesh.IsOptimized() != m_isMeshOptimizationEnabled)
+  {
+    return false;
+  }
+  for (const auto& attribute : mesh.GetAttributes())
+  {
+    VkFormatProperties props;
+    vkGetPhysicalDeviceFormatProperties(m_physicalDevice, attribute.format, &props);
+    if ((props.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+VulkanAppBase::ModelData VulkanAppBase::LoadModelFromMeshFile(const std::string& fileName, uint32_t flags)
+{
+  MeshFile mesh;
+  if (!mesh.Open(fileName))
+  {
+    throw book_util::VulkanException("cannot load " + fileName);
+  }
+  // 詳細度を使わない場合は LOD 0 の終わりまでを転送する(メッシュレットの三角形の位置はそのまま使える).
+  auto indexCount = mesh.GetIndexCount();
+  if (!(flags & ModelFlag_Lods) && mesh.GetLodCount() > 0)
+  {
+    indexCount = mesh.GetLods()[0].indexOffset + mesh.GetLods()[0].indexCount;
+  }
+  auto model = UploadModel(mesh.GetVertexData(), mesh.GetVertexStride(), mesh.GetVertexCount(),
+    mesh.GetIndexData(), indexCount, mesh.GetIndexType());
+
+  model.vertexLayout.binding = { 0, mesh.GetVertexStride(), VK_VERTEX_INPUT_RATE_VERTEX };
+  for (const auto& attribute : mesh.GetAttributes())
+  {
+    model.vertexLayout.attributes.push_back({ attribute.location, 0, attribute.format, attribute.offset });
+  }
+  model.decodeConstants = book_util::VertexDecodeConstants(mesh.IsCompact(), mesh.GetQuantization());
+  if (flags & ModelFlag_Meshlets)
+  {
+    model.meshlets.assign(mesh.GetMeshlets(), mesh.GetMeshlets() + mesh.GetMeshletCount());
+  }
+  if (flags & ModelFlag_Lods)
+  {
+    model.lods.assign(mesh.GetLods(), mesh.GetLods() + mesh.GetLodCount());
+  }
+  if (mesh.GetLodCount() > 0)
+  {
+    model.indexCount = mesh.GetLods()[0].indexCount;
+  }
+  UploadMeshlets(model);
+  return model;
+}
+
+void VulkanAppBase::UploadMeshlets(ModelData& model)
+{
+  if (model.meshlets.empty())
+  {
+    return;
+  }
+  VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  auto bufferSize = uint32_t(sizeof(book_util::Meshlet) * model.meshlets.size());
+  auto upload = CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  model.resMeshletBuffer = CreateBuffer(bufferSize, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  WriteToHostVisibleMemory(upload.memory, bufferSize, model.meshlets.data());
+
+  VkBufferCopy copy{ 0, 0, bufferSize };
+  auto command = CreateCommandBuffer();
+  vkCmdCopyBuffer(command, upload.buffer, model.resMeshletBuffer.buffer, 1, &copy);
+  FinishCommandBuffer(command);
+
+  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
+  DestroyBuffer(upload);
+}
+
+void VulkanAppBase::AllocateCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands)
+{
+  VkCommandBufferAllocateInfo commandAI{
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+    nullptr, m_commandPool,
+    VK_COMMAND_BUFFER_LEVEL_SECONDARY, count
+  };
+  auto result = vkAllocateCommandBuffers(m_device, &commandAI, pCommands);
+  ThrowIfFailed(result, "vkAllocateCommandBuffers Faield.");
+}
+
+void VulkanAppBase::FreeCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands)
+{
+  vkFreeCommandBuffers(m_device, m_commandPool, count, pCommands);
+}
+
+void VulkanAppBase::TransferStageBufferToImage(
+  const BufferObject& srcBuffer, const ImageObject& dstImage, const VkBufferImageCopy* region)
+{ 
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    0, VK_ACCESS_TRANSFER_WRITE_BIT,
+    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    dstImage.image,
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 }
+  };
+
+  // Staging から転送.
+  auto command = CreateCommandBuffer();
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr,
+    0, nullptr, 1, &imb);
+
+  vkCmdCopyBufferToImage(
+    command, 
+    srcBuffer.buffer, dstImage.image,
+    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, region);
+  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+  FinishCommandBuffer(command);
+  DestroyCommandBuffer(command);
+}
+
+
+VulkanAppBase::ImageObject VulkanAppBase::LoadCubeTextureFromFile(const char* faceFiles[6], MipmapGeneration mipmaps)
+{
+  return FinishTextureUpload(PrepareCubeTextureUpload(std::vector<std::string>(faceFiles, faceFiles + 6), mipmaps));
+}
+
+VulkanAppBase::TextureUpload VulkanAppBase::PrepareCubeTextureUpload(const std::vector<std::string>& faceFiles, MipmapGeneration mipmaps)
+{
+  TextureUpload upload{};
+  upload.name = faceFiles[0];
+  upload.startTime = std::chrono::high_resolution_clock::now();
+  mipmaps = ResolveMipmapGeneration(mipmaps);
+
+  // ヘッダのみ読んでサイズを確定し、全面分のステージングバッファを先に用意する.
+  int width = 0, height = 0;
+  for (int i = 0; i < 6; ++i)
+  {
+    int w, h, comp;
+    if (!stbi_info(faceFiles[i].c_str(), &w, &h, &comp))
+    {
+      throw book_util::VulkanException("cannot load " + faceFiles[i]);
+    }
+    if (i > 0 && (w != width || h != height))
+    {
+      throw book_util::VulkanException("cubemap face size mismatch: " + faceFiles[i]);
+    }
+    width = w;
+    height = h;
+  }
+  const bool isCpuMipmap = (mipmaps == MipmapGeneration::CpuBox || mipmaps == MipmapGeneration::CpuKaiser);
+  const auto levelCount = mipmaps == MipmapGeneration::None ? 1u : book_util::GetMipmapLevelCount(width, height);
+  // CPU でミップマップを作る場合は全レベル、それ以外はレベル 0 のみを転送する.
+  // バッファ内ではレベルごとに 6 面を連続して並べる.
+  const auto uploadLevels = isCpuMipmap ? levelCount : 1u;
+  auto& regions = upload.regions;
+  regions.resize(uploadLevels);
+  std::vector<uint32_t> faceSizes(uploadLevels);
+  uint32_t bufferSize = 0;
+  for (uint32_t level = 0; level < uploadLevels; ++level)
+  {
+    auto w = (std::max)(uint32_t(width) >> level, 1u);
+    auto h = (std::max)(uint32_t(height) >> level, 1u);
+    faceSizes[level] = w * h * uint32_t(sizeof(uint32_t));
+    regions[level] = VkBufferImageCopy{};
+    regions[level].bufferOffset = bufferSize;
+    regions[level].imageExtent = { w, h, 1 };
+    regions[level].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 6 };
+    bufferSize += faceSizes[level] * 6;
+  }
+  upload.staging = CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  uint8_t* mapped = nullptr;
+  // 途中で失敗した場合(デコードでの例外を含む)はステージングバッファとイメージを破棄する.
+  // デコード中のスレッドは decodes の破棄で待たれるため、後始末はその後に行われる.
+  ScopeGuard cleanup([&]() {
+    if (mapped)
+    {
+      vkUnmapMemory(m_device, upload.staging.memory);
+    }
+    DestroyBuffer(upload.staging);
+    DestroyImage(upload.image);
+  });
+  auto result = vkMapMemory(m_device, upload.staging.memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&mapped));
+  ThrowIfFailed(result, "vkMapMemory Failed.");
+
+  // 各面を並列にデコード(キャッシュがあればマップ)して、バッファの対応する位置へ書き込む.
+  auto filter = mipmaps == MipmapGeneration::CpuKaiser ? book_util::MipmapFilter::Kaiser : book_util::MipmapFilter::Box;
+  std::future<bool> decodes[6];
+  for (int i = 0; i < 6; ++i)
+  {
+    std::string fileName = faceFiles[i];
+    decodes[i] = std::async(std::launch::async, [=, &regions, &faceSizes]()
+    {
+      TextureCache::Image face;
+      if (!m_textureCache.Load(fileName, 4, face, isCpuMipmap, filter) ||
+        face.GetWidth() != uint32_t(width) || face.GetHeight() != uint32_t(height))
+      {
+        return false;
+      }
+      for (uint32_t level = 0; level < uploadLevels; ++level)
+      {
+        memcpy(mapped + regions[level].bufferOffset + faceSizes[level] * i, face.GetPixels(level), faceSizes[level]);
+      }
+      return true;
+    });
+  }
+
+  // デコードの間にイメージを作成しておく.
+  VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  if (mipmaps == MipmapGeneration::Gpu)
+  {
+    usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
+    VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT, // Cubemap として使うため.
+    VK_IMAGE_TYPE_2D,
+    VK_FORMAT_R8G8B8A8_UNORM, { uint32_t(width), uint32_t(height), 1u },
+    levelCount,
+    6,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  ImageObject& cubemap = upload.image;
+  result = vkCreateImage(m_device, &imageCI, nullptr, &cubemap.image);
+  ThrowIfFailed(result, "vkCreateImage Failed.");
+  cubemap.memory = AllocateMemory(cubemap.image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  vkBindImageMemory(m_device, cubemap.image, cubemap.memory, 0);
+
+  VkImageSubresourceRange subresource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 6 };
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    cubemap.image,
+    VK_IMAGE_VIEW_TYPE_CUBE, imageCI.format,
+    book_util::DefaultComponentMapping(),
+    subresource
+  };
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &cubemap.view);
+  ThrowIfFailed(result, "vkCreateImageView Failed.");
+
+  bool isDecoded = true;
+  for (auto& f : decodes)
+  {
+    isDecoded &= f.get();
+  }
+  vkUnmapMemory(m_device, upload.staging.memory);
+  mapped = nullptr;
+  if (!isDecoded)
+  {
+    throw book_util::VulkanException("cubemap decode failed.");
+  }
+  cleanup.Dismiss();
+
+  // 面はバッファ内に連続して並んでいるため、各レベルの全レイヤーを 1 つの領域でコピーできる.
+  upload.format = imageCI.format;
+  upload.width = uint32_t(width);
+  upload.height = uint32_t(height);
+  upload.levelCount = levelCount;
+  upload.layerCount = 6;
+  upload.isGpuMipmap = mipmaps == MipmapGeneration::Gpu;
+  upload.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  return upload;
+}
+
+bool VulkanAppBase::CanLoadTextureFromKtx(const std::string& fileName, VkImageUsageFlags usage)
+{
+  KtxTexture ktx;
+  if (!ktx.Open(fileName))
+  {
+    return false;
+  }
+  VkFormatFeatureFlags required = 0;
+  if (usage & VK_IMAGE_USAGE_SAMPLED_BIT)
+  {
+    required |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+  }
+  if (usage & VK_IMAGE_USAGE_STORAGE_BIT)
+  {
+    required |= VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+  }
+  VkFormatProperties props;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, ktx.GetFormat(), &props);
+  return (props.optimalTilingFeatures & required) == required;
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::LoadTextureFromKtx(const std::string& fileName, VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps)
+{
+  return FinishTextureUpload(PrepareKtxTextureUpload(fileName, usage, layout, mipmaps));
+}
+
+VulkanAppBase::TextureUpload VulkanAppBase::PrepareKtxTextureUpload(const std::string& fileName, VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps)
+{
+  TextureUpload upload{};
+  upload.name = fileName;
+  upload.startTime = std::chrono::high_resolution_clock::now();
+  KtxTexture ktx;
+  if (!ktx.Open(fileName))
+  {
+    throw book_util::VulkanException("cannot load " + fileName);
+  }
+  if (ktx.GetDepth() > 1)
+  {
+    throw book_util::VulkanException("3D texture is not supported: " + fileName);
+  }
+
+  // 全レベルのデータはファイル内で連続しているため、マップした範囲をそのまま書き込む.
+  // 4GB を超える場合もあるため、大きさは VkDeviceSize のまま扱う.
+  auto dataSize = VkDeviceSize(ktx.GetDataRangeSize());
+  upload.staging = CreateBuffer(dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  // 途中で失敗した場合はステージングバッファとイメージを破棄する.
+  ScopeGuard cleanup([&]() {
+    DestroyBuffer(upload.staging);
+    DestroyImage(upload.image);
+  });
+  WriteToHostVisibleMemory(upload.staging.memory, dataSize, ktx.GetDataRange());
+
+  // ミップマップを含まないファイルは、指定があれば GPU で作成する.
+  // 圧縮形式と、縮小コピーや線形補間に対応していない形式は対象外とし、ミップマップなしで読み込む.
+  auto levelCount = ktx.GetLevelCount();
+  auto layerCount = ktx.GetLayerCount() * ktx.GetFaceCount();
+  KtxTexture::FormatInfo formatInfo;
+  KtxTexture::GetFormatInfo(ktx.GetFormat(), formatInfo);
+  const bool isGpuMipmap = levelCount == 1 && formatInfo.blockWidth == 1 &&
+    ResolveMipmapGeneration(mipmaps) != MipmapGeneration::None && CanGenerateMipmapsOnGpu(ktx.GetFormat());
+  if (isGpuMipmap)
+  {
+    levelCount = book_util::GetMipmapLevelCount(ktx.GetWidth(), ktx.GetHeight());
+    usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
+    ktx.IsCubemap() ? VkImageCreateFlags(VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT) : 0,
+    VK_IMAGE_TYPE_2D,
+    ktx.GetFormat(), { ktx.GetWidth(), ktx.GetHeight(), 1u },
+    levelCount,
+    layerCount,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  ImageObject& texture = upload.image;
+  auto result = vkCreateImage(m_device, &imageCI, nullptr, &texture.image);
+  ThrowIfFailed(result, "vkCreateImage Failed.");
+  texture.memory = AllocateMemory(texture.image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  vkBindImageMemory(m_device, texture.image, texture.memory, 0);
+
+  VkImageSubresourceRange subresource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, layerCount };
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    texture.image,
+    GetKtxViewType(ktx), imageCI.format,
+    ktx.GetComponentMapping(),
+    subresource
+  };
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &texture.view);
+  ThrowIfFailed(result, "vkCreateImageView Failed.");
+
+  // 各レベルの全レイヤーを 1 つの領域として転送する.
+  upload.regions = ktx.GetCopyRegions();
+  upload.format = imageCI.format;
+  upload.width = ktx.GetWidth();
+  upload.height = ktx.GetHeight();
+  upload.levelCount = levelCount;
+  upload.layerCount = layerCount;
+  upload.isGpuMipmap = isGpuMipmap;
+  upload.layout = layout;
+  cleanup.Dismiss();
+  return upload;
+}
+
+VulkanAppBase::TextureUpload VulkanAppBase::Prepare2DTextureUpload(const std::string& fileName, VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps)
+{
+  TextureUpload upload{};
+  upload.name = fileName;
+  upload.startTime = std::chrono::high_resolution_clock::now();
+  mipmaps = ResolveMipmapGeneration(mipmaps);
+
+  // CPU で作成する場合はキャッシュに保存された全レベルを読み込む.
+  const bool isCpuMipmap = (mipmaps == MipmapGeneration::CpuBox || mipmaps == MipmapGeneration::CpuKaiser);
+  auto filter = mipmaps == MipmapGeneration::CpuKaiser ? book_util::MipmapFilter::Kaiser : book_util::MipmapFilter::Box;
+  TextureCache::Image texData;
+  if (!m_textureCache.Load(fileName, 4, texData, isCpuMipmap, filter))
+  {
+    throw book_util::VulkanException("cannot load " + fileName);
+  }
+  auto width = texData.GetWidth(), height = texData.GetHeight();
+  auto levelCount = mipmaps == MipmapGeneration::None ? 1u : book_util::GetMipmapLevelCount(width, height);
+
+  // 全レベルの画素は連続して並んでいる.
+  auto dataSize = uint32_t(texData.GetDataSize());
+  upload.staging = CreateBuffer(dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  // 途中で失敗した場合はステージングバッファとイメージを破棄する.
+  ScopeGuard cleanup([&]() {
+    DestroyBuffer(upload.staging);
+    DestroyImage(upload.image);
+  });
+  WriteToHostVisibleMemory(upload.staging.memory, dataSize, texData.GetPixels());
+  upload.regions.resize(texData.GetLevelCount());
+  for (uint32_t level = 0; level < texData.GetLevelCount(); ++level)
+  {
+    const auto& src = texData.GetLevel(level);
+    auto& region = upload.regions[level];
+    region = VkBufferImageCopy{};
+    region.bufferOffset = src.offset;
+    region.imageExtent = { src.width, src.height, 1 };
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+  }
+
+  usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  if (mipmaps == MipmapGeneration::Gpu)
+  {
+    usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
+    0,
+    VK_IMAGE_TYPE_2D,
+    VK_FORMAT_R8G8B8A8_UNORM, { width, height, 1u },
+    levelCount, 1,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  ImageObject& texture = upload.image;
+  auto result = vkCreateImage(m_device, &imageCI, nullptr, &texture.image);
+  ThrowIfFailed(result, "vkCreateImage Failed.");
+  texture.memory = AllocateMemory(texture.image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  vkBindImageMemory(m_device, texture.image, texture.memory, 0);
+
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    texture.image,
+    VK_IMAGE_VIEW_TYPE_2D, imageCI.format,
+    book_util::DefaultComponentMapping(),
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 1 }
+  };
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &texture.view);
+  ThrowIfFailed(result, "vkCreateImageView Failed.");
+
+  upload.format = imageCI.format;
+  upload.width = width;
+  upload.height = height;
+  upload.levelCount = levelCount;
+  upload.layerCount = 1;
+  upload.isGpuMipmap = mipmaps == MipmapGeneration::Gpu;
+  upload.layout = layout;
+  cleanup.Dismiss();
+  return upload;
+}
+
+void VulkanAppBase::RecordTextureUpload(VkCommandBuffer command, const TextureUpload& upload)
+{
+  VkImageSubresourceRange subresource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, upload.levelCount, 0, upload.layerCount };
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    0, VK_ACCESS_TRANSFER_WRITE_BIT,
+    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    upload.image.image,
+    subresource
+  };
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+  vkCmdCopyBufferToImage(
+    command,
+    upload.staging.buffer, upload.image.image,
+    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, uint32_t(upload.regions.size()), upload.regions.data());
+
+  if (upload.isGpuMipmap)
+  {
+    GenerateMipmapsOnGpu(command, upload.image.image, upload.format, upload.width, upload.height,
+      upload.levelCount, upload.layerCount, upload.layout);
+  }
+  else
+  {
+    imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    imb.newLayout = upload.layout;
+    vkCmdPipelineBarrier(
+      command,
+      VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+      0, 0, nullptr,
+      0, nullptr,
+      1, &imb);
+  }
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::FinishTextureUpload(const TextureUpload& upload)
+{
+  auto command = CreateCommandBuffer();
+  RecordTextureUpload(command, upload);
+  FinishCommandBuffer(command);
+  DestroyCommandBuffer(command);
+  DestroyBuffer(upload.staging);
+  RecordTextureLoadTime(upload.name, upload.startTime);
+  return upload.image;
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::LoadCubeTextureFromFileAsync(const char* faceFiles[6], MipmapGeneration mipmaps, TextureReadyCallback onReady)
+{
+  std::vector<std::string> files(faceFiles, faceFiles + 6);
+  return StartAsyncTexture(VK_IMAGE_VIEW_TYPE_CUBE, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, files[0],
+    [=]() { return PrepareCubeTextureUpload(files, mipmaps); }, onReady);
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::LoadTextureFromKtxAsync(const std::string& fileName,
+  VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps, TextureReadyCallback onReady)
+{
+  // 仮テクスチャのビューの種類を合わせるため、ヘッダのみここで確認する.
+  KtxTexture ktx;
+  if (!ktx.Open(fileName))
+  {
+    throw book_util::VulkanException("cannot load " + fileName);
+  }
+  return StartAsyncTexture(GetKtxViewType(ktx), usage, layout, fileName,
+    [=]() { return PrepareKtxTextureUpload(fileName, usage, layout, mipmaps); }, onReady);
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::Load2DTextureFromFileAsync(const std::string& fileName,
+  VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps, TextureReadyCallback onReady)
+{
+  return StartAsyncTexture(VK_IMAGE_VIEW_TYPE_2D, usage, layout, fileName,
+    [=]() { return Prepare2DTextureUpload(fileName, usage, layout, mipmaps); }, onReady);
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::StartAsyncTexture(VkImageViewType viewType, VkImageUsageFlags usage, VkImageLayout layout,
+  const std::string& name, std::function<TextureUpload()> prepare, TextureReadyCallback onReady)
+{
+  AsyncTexture request;
+  request.startTime = std::chrono::high_resolution_clock::now();
+  request.placeholder = CreatePlaceholderTexture(viewType, usage, layout);
+  request.image = ImageObject{};
+  request.onReady = onReady;
+  request.name = name;
+  request.isSubmitted = false;
+  request.isFailed = false;
+  request.isUploaded = false;
+  request.uploadSerial = 0;
+  request.frameSerial = 0;
+  request.upload = std::async(std::launch::async, prepare);
+  m_asyncTextures.push_back(std::move(request));
+  return m_asyncTextures.back().placeholder;
+}
+
+VulkanAppBase::ImageObject VulkanAppBase::CreatePlaceholderTexture(VkImageViewType viewType, VkImageUsageFlags usage, VkImageLayout layout)
+{
+  const bool isCube = viewType == VK_IMAGE_VIEW_TYPE_CUBE || viewType == VK_IMAGE_VIEW_TYPE_CUBE_ARRAY;
+  const uint32_t layerCount = isCube ? 6 : 1;
+  VkImageCreateInfo imageCI{
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, nullptr,
+    isCube ? VkImageCreateFlags(VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT) : 0,
+    VK_IMAGE_TYPE_2D,
+    VK_FORMAT_R8G8B8A8_UNORM, { 1u, 1u, 1u },
+    1, layerCount,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_IMAGE_TILING_OPTIMAL,
+    usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+    VK_SHARING_MODE_EXCLUSIVE,
+    0, nullptr,
+    VK_IMAGE_LAYOUT_UNDEFINED
+  };
+  ImageObject texture;
+  auto result = vkCreateImage(m_device, &imageCI, nullptr, &texture.image);
+  ThrowIfFailed(result, "vkCreateImage Failed.");
+  texture.memory = AllocateMemory(texture.image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  vkBindImageMemory(m_device, texture.image, texture.memory, 0);
+
+  VkImageSubresourceRange subresource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, layerCount };
+  VkImageViewCreateInfo viewCI{
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+    nullptr, 0,
+    texture.image,
+    viewType, imageCI.format,
+    book_util::DefaultComponentMapping(),
+    subresource
+  };
+  result = vkCreateImageView(m_device, &viewCI, nullptr, &texture.view);
+  ThrowIfFailed(result, "vkCreateImageView Failed.");
+
+  // 法線マップとして読まれても極端な見た目にならないよう中間の灰色で塗る.
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    0, VK_ACCESS_TRANSFER_WRITE_BIT,
+    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    texture.image,
+    subresource
+  };
+  auto command = CreateCommandBuffer();
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+  VkClearColorValue gray{};
+  gray.float32[0] = gray.float32[1] = gray.float32[2] = 0.5f;
+  gray.float32[3] = 1.0f;
+  vkCmdClearColorImage(command, texture.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &gray, 1, &subresource);
+  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  imb.newLayout = layout;
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+  FinishCommandBuffer(command);
+  DestroyCommandBuffer(command);
+  return texture;
+}
+
+void VulkanAppBase::ProcessAsyncTextures()
+{
+  // 準備の終わったものをまとめて 1 つのコマンドバッファで転送する.
+  // 読み込みに失敗したものはフレームの途中で例外を伝えず、仮テクスチャを最終的なテクスチャとして渡す.
+  VkCommandBuffer command = VK_NULL_HANDLE;
+  std::vector<BufferObject> stagings;
+  std::vector<AsyncTexture*> submitted;
+  for (auto& request : m_asyncTextures)
+  {
+    if (request.isSubmitted ||
+      request.upload.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+      continue;
+    }
+    TextureUpload upload;
+    try
+    {
+      upload = request.upload.get();
+    }
+    catch (const std::exception& e)
+    {
+      book_util::OutputLog("cannot load texture: " + request.name + " (" + e.what() + ")\n");
+      request.image = request.placeholder;
+      request.placeholder = ImageObject{};
+      request.isSubmitted = true;
+      request.isFailed = true;
+      continue;
+    }
+    if (command == VK_NULL_HANDLE)
+    {
+      command = CreateCommandBuffer();
+    }
+    RecordTextureUpload(command, upload);
+    stagings.push_back(upload.staging);
+    request.image = upload.image;
+    request.isSubmitted = true;
+    submitted.push_back(&request);
+  }
+  if (command != VK_NULL_HANDLE)
+  {
+    auto result = vkEndCommandBuffer(command);
+    ThrowIfFailed(result, "vkEndCommandBuffer Failed.");
+    auto fence = CreateFence();
+    vkResetFences(m_device, 1, &fence);
+    VkSubmitInfo submitInfo{
+      VK_STRUCTURE_TYPE_SUBMIT_INFO,
+      nullptr,
+      0, nullptr,
+      nullptr,
+      1, &command,
+      0, nullptr,
+    };
+    result = vkQueueSubmit(m_deviceQueue, 1, &submitInfo, fence);
+    ThrowIfFailed(result, "vkQueueSubmit Failed.");
+
+    // フレームと同じく送信番号で完了を追跡し、完了後にステージングバッファ等を破棄する.
+    ++m_submitSerial;
+    m_fenceSerials[fence] = m_submitSerial;
+    m_inflightSubmits.push_back(SubmitRecord{ m_submitSerial, fence });
+    for (auto request : submitted)
+    {
+      request->uploadSerial = m_submitSerial;
+    }
+    DeferredDestroy([=]() {
+      for (auto& staging : stagings)
+      {
+        DestroyBuffer(staging);
+      }
+      DestroyCommandBuffer(command);
+      m_fenceSerials.erase(fence);
+      DestroyFence(fence);
+    });
+  }
+
+  // 転送の完了したものを差し替える.
+  // 記述子セットは送信済みのフレームから参照されている可能性があるため、キューは待たずに
+  // 転送の完了を確認した時点までに送信されたフレームが完了してから onReady を呼ぶ.
+  auto it = m_asyncTextures.begin();
+  while (it != m_asyncTextures.end())
+  {
+    if (!it->isSubmitted || it->uploadSerial > m_completedSerial)
+    {
+      ++it;
+      continue;
+    }
+    if (!it->isUploaded)
+    {
+      it->isUploaded = true;
+      it->frameSerial = m_submitSerial;
+    }
+    if (it->frameSerial > m_completedSerial)
+    {
+      ++it;
+      continue;
+    }
+    it->onReady(it->image);
+    if (!it->isFailed)
+    {
+      RecordTextureLoadTime(it->name, it->startTime);
+      // 仮テクスチャはこれまでに送信したフレームの完了後に破棄する.
+      auto placeholder = it->placeholder;
+      DeferredDestroy([=]() { DestroyImage(placeholder); });
+    }
+    it = m_asyncTextures.erase(it);
+  }
+}
+
+void VulkanAppBase::WaitForAsyncTextures()
+{
+  while (!m_asyncTextures.empty())
+  {
+    for (auto& request : m_asyncTextures)
+    {
+      if (!request.isSubmitted)
+      {
+        request.upload.wait();
+      }
+    }
+    ProcessAsyncTextures();
+    vkQueueWaitIdle(m_deviceQueue);
+    ProcessDeferredDestroy();
+    ProcessAsyncTextures();
+  }
+}
+
+bool VulkanAppBase::CanGenerateMipmapsOnGpu(VkFormat format)
+{
+  const VkFormatFeatureFlags required = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+    VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+  VkFormatProperties props;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, format, &props);
+  return (props.optimalTilingFeatures & required) == required;
+}
+
+void VulkanAppBase::GenerateMipmapsOnGpu(VkCommandBuffer command, VkImage image, VkFormat format,
+  uint32_t width, uint32_t height, uint32_t levelCount, uint32_t layerCount, VkImageLayout newLayout)
+{
+  VkFormatProperties props;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, format, &props);
+  const VkFormatFeatureFlags blitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+  if ((props.optimalTilingFeatures & blitFeatures) != blitFeatures)
+  {
+    throw book_util::VulkanException("format does not support vkCmdBlitImage.");
+  }
+  // 線形補間できない形式では最近傍で縮小する.
+  auto filter = (props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+
+  VkImageMemoryBarrier imb{
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+    VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+    VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+    image,
+    { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, layerCount }
+  };
+  for (uint32_t level = 0; level < levelCount; ++level)
+  {
+    // 書き込みの終わったレベルを転送元にする. 最後のレベルもレイアウトを揃えておく.
+    imb.subresourceRange.baseMipLevel = level;
+    vkCmdPipelineBarrier(command,
+      VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+      0, 0, nullptr,
+      0, nullptr,
+      1, &imb);
+    if (level + 1 == levelCount)
+    {
+      break;
+    }
+
+    VkImageBlit blit{};
+    blit.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, layerCount };
+    blit.srcOffsets[1] = { int32_t((std::max)(width >> level, 1u)), int32_t((std::max)(height >> level, 1u)), 1 };
+    blit.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level + 1, 0, layerCount };
+    blit.dstOffsets[1] = { int32_t((std::max)(width >> (level + 1), 1u)), int32_t((std::max)(height >> (level + 1), 1u)), 1 };
+    vkCmdBlitImage(command,
+      image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+      image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+      1, &blit, filter);
+  }
+
+  imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+  imb.newLayout = newLayout;
+  imb.subresourceRange.baseMipLevel = 0;
+  imb.subresourceRange.levelCount = levelCount;
+  vkCmdPipelineBarrier(command,
+    VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+    0, 0, nullptr,
+    0, nullptr,
+    1, &imb);
+}
+
+void VulkanAppBase::RecordTextureLoadTime(const std::string& name, std::chrono::high_resolution_clock::time_point startTime)
+{
+  auto elapsed = std::chrono::high_resolution_clock::now() - startTime;
+  m_textureLoadTimes.emplace_back(name, std::chrono::duration<double, std::milli>(elapsed).count());
+}
+
+VkRenderPass VulkanAppBase::CreateRenderPass(VkFormat colorFormat, VkFormat depthFormat, VkImageLayout layoutColor)
+{
+  VkRenderPass renderPass;
+
+  std::vector<VkAttachmentDescription> attachments;
+
+  if (colorFormat == VK_FORMAT_UNDEFINED)
+  {
+    colorFormat = m_swapchain->GetSurfaceFormat().format;
+  }
+
+  VkAttachmentDescription colorTarget, depthTarget;
+  colorTarget = VkAttachmentDescription{
+    0,  // Flags
+    colorFormat,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_ATTACHMENT_LOAD_OP_CLEAR,
+    VK_ATTACHMENT_STORE_OP_STORE,
+    VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+    VK_ATTACHMENT_STORE_OP_DONT_CARE,
+    VK_IMAGE_LAYOUT_UNDEFINED,
+    layoutColor
+  };
+  depthTarget = VkAttachmentDescription{
+    0,
+    depthFormat,
+    VK_SAMPLE_COUNT_1_BIT,
+    VK_ATTACHMENT_LOAD_OP_CLEAR,
+    VK_ATTACHMENT_STORE_OP_STORE,
+    VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+    VK_ATTACHMENT_STORE_OP_DONT_CARE,
+    VK_IMAGE_LAYOUT_UNDEFINED,
+    VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+  };
+
+  VkAttachmentReference colorRef{
+    0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+  };
+  VkAttachmentReference depthRef{
+    1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+  };
+
+  VkSubpassDescription subpassDesc{
+    0, // Flags
+    VK_PIPELINE_BIND_POINT_GRAPHICS,
+    0, nullptr, // InputAttachments
+    1, &colorRef, // ColorAttachments
+    nullptr,    // ResolveAttachments
+    nullptr,    // DepthStencilAttachments
+    0, nullptr, // PreserveAttachments
+  };
+
+  attachments.push_back(colorTarget);
+  if (depthFormat != VK_FORMAT_UNDEFINED)
+  {
+    attachments.push_back(depthTarget);
+    subpassDesc.pDepthStencilAttachment = &depthRef;
+  }
+
+  VkRenderPassCreateInfo rpCI{
+    VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+    nullptr, 0,
+    uint32_t(attachments.size()), attachments.data(),
+    1, &subpassDesc,
+    0, nullptr, // Dependency
+  };
+  auto result = vkCreateRenderPass(m_device, &rpCI, nullptr, &renderPass);
+  ThrowIfFailed(result, "vkCreateRenderPass Failed.");
+  return renderPass;
+}
+
+
+void VulkanAppBase::PrepareImGui()
+{
+  // ImGui
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGui_ImplGlfw_InitForVulkan(m_window, true);
+
+  ImGui_ImplVulkan_InitInfo info{};
+  info.Instance = m_vkInstance;
+  info.PhysicalDevice = m_physicalDevice;
+  info.Device = m_device;
+  info.QueueFamily = m_gfxQueueIndex;
+  info.Queue = m_deviceQueue;
+  info.DescriptorPool = m_descriptorPool;
+  info.MinImageCount = m_swapchain->GetImageCount();
+  info.ImageCount = m_swapchain->GetImageCount();
+  ImGui_ImplVulkan_Init(&info, GetRenderPass("default"));
+
+  // フォントテクスチャを転送する.
+  VkCommandBufferAllocateInfo commandAI{
+   VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+    nullptr, m_commandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1
+  };
+  VkCommandBufferBeginInfo beginInfo{
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+  };
+
+  VkCommandBuffer command;
+  vkAllocateCommandBuffers(m_device, &commandAI, &command);
+  vkBeginCommandBuffer(command, &beginInfo);
+  ImGui_ImplVulkan_CreateFontsTexture(command);
+  vkEndCommandBuffer(command);
+
+  VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO, nullptr };
+  submitInfo.pCommandBuffers = &command;
+  submitInfo.commandBufferCount = 1;
+  vkQueueSubmit(m_deviceQueue, 1, &submitInfo, VK_NULL_HANDLE);
+
+  // フォントテクスチャ転送の完了を待つ.
+  vkDeviceWaitIdle(m_device);
+  vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
+}
+
+void VulkanAppBase::CleanupImGui()
+{
+  ImGui_ImplVulkan_Shutdown();
+  ImGui_ImplGlfw_Shutdown();
+  ImGui::DestroyContext();
+}
+
+
+void VulkanAppBase::CreateInstance()
+{
+  VkApplicationInfo appinfo{};
+  appinfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+  appinfo.pApplicationName = "VulkanBook2";
+  appinfo.pEngineName = "VulkanBook2";
+  appinfo.apiVersion = VK_API_VERSION_1_1;
+  appinfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+
+  // 拡張情報の取得.
+  uint32_t count;
+  vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr);
+  std::vector<VkExtensionProperties> props(count);
+  vkEnumerateInstanceExtensionProperties(nullptr, &count, props.data());
+  std::vector<const char*> extensions;
+  extensions.reserve(count);
+  for (const auto& v : props)
+  {
+    extensions.push_back(v.extensionName);
+  }
+
+  VkInstanceCreateInfo instanceCI{};
+  instanceCI.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+  instanceCI.enabledExtensionCount = count;
+  instanceCI.ppEnabledExtensionNames = extensions.data();
+  instanceCI.pApplicationInfo = &appinfo;
+#ifdef _DEBUG
+  // デバッグビルド時には検証レイヤーを有効化
+  const char* layers[] = { "VK_LAYER_KHRONOS_validation" };
+  if (VK_HEADER_VERSION_COMPLETE < VK_MAKE_VERSION(1, 1, 106)) {
+	  // "VK_LAYER_LUNARG_standard_validation" は廃止になっているが昔の Vulkan SDK では動くので対処しておく.
+	  layers[0] = "VK_LAYER_LUNARG_standard_validation";
+  }
+  instanceCI.enabledLayerCount = 1;
+  instanceCI.ppEnabledLayerNames = layers;
+#endif
+  auto result = vkCreateInstance(&instanceCI, nullptr, &m_vkInstance);
+  ThrowIfFailed(result, "vkCreateInstance Failed.");
+}
+
+void VulkanAppBase::SelectGraphicsQueue()
+{
+  // グラフィックスキューのインデックス値を取得.
+  uint32_t queuePropCount;
+  vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queuePropCount, nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilyProps(queuePropCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queuePropCount, queueFamilyProps.data());
+  uint32_t graphicsQueue = ~0u;
+  for (uint32_t i = 0; i < queuePropCount; ++i)
+  {
+    if (queueFamilyProps[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)
+    {
+      graphicsQueue = i; break;
+    }
+  }
+  m_gfxQueueIndex = graphicsQueue;
+}
+
+void VulkanAppBase::CreateDevice()
+{
+  const float defaultQueuePriority(1.0f);
+  VkDeviceQueueCreateInfo devQueueCI{
+    VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+    nullptr, 0,
+    m_gfxQueueIndex,
+    1, &defaultQueuePriority
+  };
+  uint32_t count;
+  vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &count, nullptr);
+  std::vector<VkExtensionProperties> deviceExtensions(count);
+  vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &count, deviceExtensions.data());
+
+  std::vector<const char*> extensions;
+  extensions.reserve(count);
+  for (const auto& v : deviceExtensions)
+  {
+    extensions.push_back(v.extensionName);
+  }
+
+  VkPhysicalDeviceFeatures features{};
+  vkGetPhysicalDeviceFeatures(m_physicalDevice, &features);
+
+  VkDeviceCreateInfo deviceCI{
+    VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+    nullptr, 0,
+    1, &devQueueCI,
+    0, nullptr,
+    count, extensions.data(),
+    &features
+  };
+  auto result = vkCreateDevice(m_physicalDevice, &deviceCI, nullptr, &m_device);
+  ThrowIfFailed(result, "vkCreateDevice Failed.");
+
+  vkGetDeviceQueue(m_device, m_gfxQueueIndex, 0, &m_deviceQueue);
+}
+
+void VulkanAppBase::CreateCommandPool()
+{
+  VkCommandPoolCreateInfo cmdPoolCI{
+    VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+    nullptr,
+    VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+    m_gfxQueueIndex
+  };
+  auto result = vkCreateCommandPool(m_device, &cmdPoolCI, nullptr, &m_commandPool);
+  ThrowIfFailed(result, "vkCreateCommandPool Failed.");
+}
+
+void VulkanAppBase::CreateDescriptorPool()
+{
+  VkResult result;
+  VkDescriptorPoolSize poolSize[] = {
+    { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000 },
+    { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1000 },
+    { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1000 },
+  };
+  VkDescriptorPoolCreateInfo descPoolCI{
+    VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+    nullptr,  VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+    1000 * _countof(poolSize), // maxSets
+    _countof(poolSize), poolSize,
+  };
+  result = vkCreateDescriptorPool(m_device, &descPoolCI, nullptr, &m_descriptorPool);
+  ThrowIfFailed(result, "vkCreateDescriptorPool Failed.");
+}
+
+VkDeviceMemory VulkanAppBase::AllocateMemory(VkBuffer buffer, VkMemoryPropertyFlags memProps)
+{
+  VkDeviceMemory memory;
+  VkMemoryRequirements reqs;
+  vkGetBufferMemoryRequirements(m_device, buffer, &reqs);
+  VkMemoryAllocateInfo info{
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+    nullptr,
+    reqs.size,
+    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+  };
+  auto result = vkAllocateMemory(m_device, &info, nullptr, &memory);
+  ThrowIfFailed(result, "vkAllocateMemory Failed.");
+  return memory;
+}
+
+VkDeviceMemory VulkanAppBase::AllocateMemory(VkImage image, VkMemoryPropertyFlags memProps)
+{
+  VkDeviceMemory memory;
+  VkMemoryRequirements reqs;
+  vkGetImageMemoryRequirements(m_device, image, &reqs);
+  VkMemoryAllocateInfo info{
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+    nullptr,
+    reqs.size,
+    GetMemoryTypeIndex(reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+  };
+  auto result = vkAllocateMemory(m_device, &info, nullptr, &memory);
+  ThrowIfFailed(result, "vkAllocateMemory Failed.");
+  return memory;
+}
+
+
+#define GetInstanceProcAddr(FuncName) \
+  m_##FuncName = reinterpret_cast<PFN_##FuncName>(vkGetInstanceProcAddr(m_vkInstance, #FuncName))
+
+void VulkanAppBase::EnableDebugReport()
+{
+  GetInstanceProcAddr(vkCreateDebugReportCallbackEXT);
+  GetInstanceProcAddr(vkDebugReportMessageEXT);
+  GetInstanceProcAddr(vkDestroyDebugReportCallbackEXT);
+
+  VkDebugReportFlagsEXT flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+
+  VkDebugReportCallbackCreateInfoEXT drcCI{};
+  drcCI.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+  drcCI.flags = flags;
+  drcCI.pfnCallback = &DebugReportCallback;
+  auto result = m_vkCreateDebugReportCallbackEXT(m_vkInstance, &drcCI, nullptr, &m_debugReport);
+  ThrowIfFailed(result, "vkCreateDebugReportCallback Failed.");
+}
+
+void VulkanAppBase::DisableDebugReport()
+{
+  if (m_vkDestroyDebugReportCallbackEXT)
+  {
+    m_vkDestroyDebugReportCallbackEXT(m_vkInstance, m_debugReport, nullptr);
+  }
+}
+
+void VulkanAppBase::MsgLoopMinimizedWindow()
+{
+  int width, height;
+  do
+  {
+    glfwGetWindowSize(m_window, &width, &height);
+    glfwWaitEvents();
+  } while (width == 0 || height == 0);
+}
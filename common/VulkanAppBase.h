@@ -1,220 +1,536 @@
-#pragma once
-#define WIN32_LEAN_AND_MEAN
-#define NOMINMAX
-#include <windows.h>
-
-#include <string>
-#include <vector>
-#include <memory>
-#include <unordered_map>
-#include <functional>
-
-#define VK_USE_PLATFORM_WIN32_KHR
-#define GLFW_INCLUDE_VULKAN
-#define GLFW_EXPOSE_NATIVE_WIN32
-#include <GLFW/glfw3.h>
-#include <GLFW/glfw3native.h>
-#include <vulkan/vk_layer.h>
-#include <vulkan/vulkan_win32.h>
-
-#include "Swapchain.h"
-
-template<class T>
-class VulkanObjectStore
-{
-public:
-  VulkanObjectStore(std::function<void(T)> disposer) : m_disposeFunc(disposer) { }
-  void Cleanup() {
-    std::for_each(m_storeMap.begin(), m_storeMap.end(), [&](auto v) { m_disposeFunc(v.second); });
-  }
-
-  void Register(const std::string& name, T data)
-  {
-    m_storeMap[name] = data;
-  }
-  T Get(const std::string& name) const
-  {
-    auto it = m_storeMap.find(name);
-    if (it == m_storeMap.end())
-    {
-      return VK_NULL_HANDLE;
-    }
-    return it->second;
-  }
-private:
-  std::unordered_map<std::string, T> m_storeMap;
-  std::function<void(T)> m_disposeFunc;
-};
-
-class VulkanAppBase {
-public:
-  VulkanAppBase() :m_isMinimizedWindow(false), m_isFullscreen(false) { }
-  virtual ~VulkanAppBase() { }
-
-  virtual bool OnSizeChanged(uint32_t width, uint32_t height);
-  virtual bool OnMouseButtonDown(int button);
-  virtual bool OnMouseButtonUp(int button);
-  virtual bool OnMouseMove(int dx, int dy);
-
-  uint32_t GetMemoryTypeIndex(uint32_t requestBits, VkMemoryPropertyFlags requestProps) const;
-  void SwitchFullscreen(GLFWwindow* window);
-
-  void Initialize(GLFWwindow* window, VkFormat format, bool isFullscreen);
-  void Terminate();
-
-  virtual void Render() = 0;
-  virtual void Prepare() = 0;
-  virtual void Cleanup() = 0;
-
-  VkDescriptorPool GetDescriptorPool() const { return m_descriptorPool; }
-  VkDevice GetDevice() { return m_device; }
-  const Swapchain* GetSwapchain() const { return m_swapchain.get(); }
-
-  VkPipelineLayout GetPipelineLayout(const std::string& name) { return m_pipelineLayoutStore->Get(name); }
-  VkDescriptorSetLayout GetDescriptorSetLayout(const std::string& name) { return m_descriptorSetLayoutStore->Get(name); }
-  VkRenderPass GetRenderPass(const std::string& name) { return m_renderPassStore->Get(name); }
-
-  void RegisterLayout(const std::string& name, VkPipelineLayout layout) { m_pipelineLayoutStore->Register(name, layout); }
-  void RegisterLayout(const std::string& name, VkDescriptorSetLayout layout) { m_descriptorSetLayoutStore->Register(name, layout); }
-  void RegisterRenderPass(const std::string& name, VkRenderPass renderPass) { m_renderPassStore->Register(name, renderPass); }
-  struct BufferObject
-  {
-    VkBuffer buffer;
-    VkDeviceMemory memory;
-  };
-  struct ImageObject
-  {
-    VkImage image;
-    VkDeviceMemory memory;
-    VkImageView view;
-  };
-
-  BufferObject CreateBuffer(uint32_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props);
-  ImageObject CreateTexture(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage);
-  VkFramebuffer CreateFramebuffer(VkRenderPass renderPass, uint32_t width, uint32_t height, uint32_t viewCount, VkImageView* views);
-  VkFence CreateFence();
-  VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout dsLayout);
-
-  void DestroyBuffer(BufferObject bufferObj);
-  void DestroyImage(ImageObject imageObj);
-  void DestroyFramebuffers(uint32_t count, VkFramebuffer* framebuffers);
-  void DestroyFence(VkFence fence);
-  void DeallocateDescriptorSet(VkDescriptorSet dsLayout);
-
-  VkCommandBuffer CreateCommandBuffer(bool bBegin = true);
-  void FinishCommandBuffer(VkCommandBuffer command);
-  void DestroyCommandBuffer(VkCommandBuffer command);
-
-  VkRect2D GetSwapchainRenderArea() const;
-
-  std::vector<BufferObject> CreateUniformBuffers(uint32_t size, uint32_t imageCount);
-
-  // zXg猩郁̈Ƀf[^.ȉobt@ΏۂɎgp.
-  // - Xe[WOobt@
-  // - jtH[obt@
-  void WriteToHostVisibleMemory(VkDeviceMemory memory, uint32_t size, const void* pData);
-
-  void AllocateCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands);
-  void FreeCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands);
-
-  void TransferStageBufferToImage(const BufferObject& srcBuffer, const ImageObject& dstImage, const VkBufferImageCopy* region);
-
-
-  // _[pX̐.
-  VkRenderPass CreateRenderPass(VkFormat colorFormat, VkFormat depthFormat = VK_FORMAT_UNDEFINED, VkImageLayout layoutColor = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
-
-  struct ModelData
-  {
-    uint32_t indexCount;
-    uint32_t vertexCount;
-    BufferObject resVertexBuffer;
-    BufferObject resIndexBuffer;
-  };
-
-  // Pf̃f[^GPU֓].
-  template<class T>
-  ModelData CreateSimpleModel(const std::vector<T>& vertices, const std::vector<uint32_t>& indices)
-  {
-    ModelData model;
-    VkMemoryPropertyFlags srcMemoryProps = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    VkMemoryPropertyFlags dstMemoryProps = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    VkBufferUsageFlags usageVB = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-    VkBufferUsageFlags usageIB = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-    VkBufferCopy copyVB{}, copyIB{};
-
-    auto bufferSize = uint32_t(sizeof(T) * vertices.size());
-    auto uploadVB = CreateBuffer(bufferSize, usageVB, srcMemoryProps);
-    model.resVertexBuffer = CreateBuffer(bufferSize, usageVB, dstMemoryProps);
-    WriteToHostVisibleMemory(uploadVB.memory, bufferSize, vertices.data());
-    model.vertexCount = uint32_t(vertices.size());
-    copyVB.size = bufferSize;
-
-    bufferSize = uint32_t(sizeof(uint32_t) * indices.size());
-    auto uploadIB = CreateBuffer(bufferSize, usageIB, srcMemoryProps);
-    model.resIndexBuffer = CreateBuffer(bufferSize, usageIB, dstMemoryProps);
-    WriteToHostVisibleMemory(uploadIB.memory, bufferSize, indices.data());
-    model.indexCount = uint32_t(indices.size());
-    copyIB.size = bufferSize;
-
-    auto command = CreateCommandBuffer();
-    vkCmdCopyBuffer(command, uploadVB.buffer, model.resVertexBuffer.buffer, 1, &copyVB);
-    vkCmdCopyBuffer(command, uploadIB.buffer, model.resIndexBuffer.buffer, 1, &copyIB);
-    FinishCommandBuffer(command);
-
-    vkFreeCommandBuffers(m_device, m_commandPool, 1, &command);
-    DestroyBuffer(uploadVB);
-    DestroyBuffer(uploadIB);
-
-    return model;
-  }
-
- private:
-  void CreateInstance();
-  void SelectGraphicsQueue();
-  void CreateDevice();
-  void CreateCommandPool();
-
-  // fobO|[gL.
-  void EnableDebugReport();
-  void DisableDebugReport();
-  PFN_vkCreateDebugReportCallbackEXT	m_vkCreateDebugReportCallbackEXT;
-  PFN_vkDebugReportMessageEXT	m_vkDebugReportMessageEXT;
-  PFN_vkDestroyDebugReportCallbackEXT m_vkDestroyDebugReportCallbackEXT;
-  VkDebugReportCallbackEXT  m_debugReport;
-
-  void CreateDescriptorPool();
-
-  // ImGui
-  void PrepareImGui();
-  void CleanupImGui();
-protected:
-  VkDeviceMemory AllocateMemory(VkBuffer image, VkMemoryPropertyFlags memProps);
-  VkDeviceMemory AllocateMemory(VkImage image, VkMemoryPropertyFlags memProps);
-  // ŏbZ[W[v.
-  void MsgLoopMinimizedWindow();
-
-  VkDevice  m_device;
-  VkPhysicalDevice m_physicalDevice;
-  VkInstance m_vkInstance;
-
-  VkPhysicalDeviceMemoryProperties m_physicalMemProps;
-  VkQueue m_deviceQueue;
-  uint32_t  m_gfxQueueIndex;
-  VkCommandPool m_commandPool;
-
-  VkSemaphore m_renderCompletedSem, m_presentCompletedSem;
-
-  VkDescriptorPool m_descriptorPool;
-
-  bool m_isMinimizedWindow;
-  bool m_isFullscreen;
-  std::unique_ptr<Swapchain> m_swapchain;
-  GLFWwindow* m_window;
-
-  using RenderPassRegistry = VulkanObjectStore<VkRenderPass>;
-  using PipelineLayoutManager = VulkanObjectStore<VkPipelineLayout>;
-  using DescriptorSetLayoutManager = VulkanObjectStore<VkDescriptorSetLayout>;
-  std::unique_ptr<RenderPassRegistry> m_renderPassStore;
-  std::unique_ptr<PipelineLayoutManager> m_pipelineLayoutStore;
-  std::unique_ptr<DescriptorSetLayoutManager> m_descriptorSetLayoutStore;
+#pragma once
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <functional>
+#include <deque>
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <list>
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#define GLFW_EXPOSE_NATIVE_WIN32
+#endif
+#define GLFW_INCLUDE_VULKAN
+#include <GLFW/glfw3.h>
+#ifdef _WIN32
+#include <GLFW/glfw3native.h>
+#include <vulkan/vulkan_win32.h>
+#endif
+#include <vulkan/vk_layer.h>
+
+#include "Swapchain.h"
+#include "FrameCapture.h"
+#include "GpuProfiler.h"
+#include "CameraPath.h"
+#include "TextureCache.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantize.h"
+#include "MeshFile.h"
+#include "Meshlet.h"
+#include "MeshSimplifier.h"
+
+class Camera;
+
+template<class T>
+class VulkanObjectStore
+{
+public:
+  VulkanObjectStore(std::function<void(T)> disposer) : m_disposeFunc(disposer) { }
+  void Cleanup() {
+    std::for_each(m_storeMap.begin(), m_storeMap.end(), [&](auto v) { m_disposeFunc(v.second); });
+  }
+
+  void Register(const std::string& name, T data)
+  {
+    m_storeMap[name] = data;
+  }
+  T Get(const std::string& name) const
+  {
+    auto it = m_storeMap.find(name);
+    if (it == m_storeMap.end())
+    {
+      return VK_NULL_HANDLE;
+    }
+    return it->second;
+  }
+private:
+  std::unordered_map<std::string, T> m_storeMap;
+  std::function<void(T)> m_disposeFunc;
+};
+
+class VulkanAppBase {
+public:
+  VulkanAppBase() :m_isMinimizedWindow(false), m_isFullscreen(false), m_isSwapchainDirty(false),
+    m_isHeadless(false), m_presentMode(VK_PRESENT_MODE_FIFO_KHR), m_currentImageIndex(0), m_profiledSerial(~0ull),
+    m_mipmapOverride(MipmapGeneration::None), m_isMipmapOverridden(false), m_depthMode(DepthMode::Standard),
+    m_isMeshOptimizationEnabled(true), m_isCompactVertexEnabled(true), m_isClusterCullingEnabled(true), m_isLodSelectionEnabled(true),
+    m_clusterCullingStatistics(),
+    m_cameraTrackMode(CameraTrackMode::None), m_cameraTrackFrame(0),
+    m_submitSerial(0), m_completedSerial(0) { }
+  virtual ~VulkanAppBase() { }
+
+  virtual bool OnSizeChanged(uint32_t width, uint32_t height);
+  virtual bool OnMouseButtonDown(int button);
+  virtual bool OnMouseButtonUp(int button);
+  virtual bool OnMouseMove(int dx, int dy);
+
+  uint32_t GetMemoryTypeIndex(uint32_t requestBits, VkMemoryPropertyFlags requestProps) const;
+  void SwitchFullscreen(GLFWwindow* window);
+
+  // 以下は Initialize の前に設定する.
+  // ヘッドレスの場合はサーフェースを作らずオフスクリーンのイメージへ描画する.
+  void SetHeadless(bool isHeadless) { m_isHeadless = isHeadless; }
+  void SetPresentMode(VkPresentModeKHR mode) { m_presentMode = mode; }
+  bool IsHeadless() const { return m_isHeadless; }
+
+  // テクスチャ読み込み時のミップマップの作成方法. テクスチャごとに読み込み関数で指定する.
+  enum class MipmapGeneration
+  {
+    None,       // 基本レベルのみ.
+    Gpu,        // vkCmdBlitImage で前のレベルから順に縮小する.
+    CpuBox,     // CPU で 2x2 の平均. 結果はテクスチャキャッシュに保存される.
+    CpuKaiser,  // CPU で Kaiser 窓の sinc フィルタ. 結果はテクスチャキャッシュに保存される.
+  };
+  // 各サンプルの指定にかかわらず mode で作成する. 方法ごとの比較に使う.
+  void SetMipmapGenerationOverride(MipmapGeneration mode) { m_mipmapOverride = mode; m_isMipmapOverridden = true; }
+
+  // 深度バッファの使い方. パイプラインの作成に影響するため Initialize の前に設定する.
+  enum class DepthMode
+  {
+    Standard,  // クリア 1、LESS_OR_EQUAL で比較する通常の透視投影.
+    ReverseZ,  // クリア 0、GREATER_OR_EQUAL で比較し、遠クリップ面を無限遠とした反転深度の透視投影.
+  };
+  void SetDepthMode(DepthMode mode) { m_depthMode = mode; }
+  DepthMode GetDepthMode() const { return m_depthMode; }
+
+  // CreateSimpleModel で三角形リストの頂点とインデックスを頂点キャッシュ、オーバードロー、頂点の読み込み順に
+  // 合わせて並べ替えるか(既定は有効). 並べ替えの前後の効率は GetMeshOptimizationResults で得られる.
+  void SetMeshOptimization(bool isEnabled) { m_isMeshOptimizationEnabled = isEnabled; }
+  using MeshOptimizationResults = std::vector<book_util::MeshOptimizationResult>;
+  const MeshOptimizationResults& GetMeshOptimizationResults() const { return m_meshOptimizationResults; }
+  // CreateCompactModel で頂点とインデックスを圧縮するか(既定は有効). 無効の場合は float のまま転送する.
+  void SetCompactVertex(bool isEnabled) { m_isCompactVertexEnabled = isEnabled; }
+  // メッシュレット単位のカリング(視錐台と面の向き)を行うか(既定は有効). 対応するサンプルのみが参照する.
+  void SetClusterCulling(bool isEnabled) { m_isClusterCullingEnabled = isEnabled; }
+  bool IsClusterCullingEnabled() const { return m_isClusterCullingEnabled; }
+  // 描画したビューの数と、各ビューへ送った三角形の数の合計. monolithicTriangles はモデル全体を描画した場合の数.
+  struct ClusterCullingStatistics
+  {
+    uint64_t views;
+    uint64_t triangles;
+    uint64_t monolithicTriangles;
+  };
+  const ClusterCullingStatistics& GetClusterCullingStatistics() const { return m_clusterCullingStatistics; }
+  void ResetClusterCullingStatistics() { m_clusterCullingStatistics = ClusterCullingStatistics(); }
+  // 画面上の大きさに応じて詳細度(ModelData::lods)を選ぶか(既定は有効). 対応するサンプルのみが参照する.
+  void SetLodSelection(bool isEnabled) { m_isLodSelectionEnabled = isEnabled; }
+  bool IsLodSelectionEnabled() const { return m_isLodSelectionEnabled; }
+
+  void Initialize(GLFWwindow* window, VkFormat format, bool isFullscreen);
+  void Terminate();
+
+  // 初期化の各段階に掛かった時間(ミリ秒).
+  using StartupTimes = std::vector<std::pair<std::string, double>>;
+  const StartupTimes& GetStartupTimes() const { return m_startupTimes; }
+  // テクスチャごとの読み込み時間(ミリ秒). GPU での転送、ミップマップ作成の完了までを含む.
+  using TextureLoadTimes = std::vector<std::pair<std::string, double>>;
+  const TextureLoadTimes& GetTextureLoadTimes() const { return m_textureLoadTimes; }
+
+  virtual void Render() = 0;
+  virtual void Prepare() = 0;
+  virtual void Cleanup() = 0;
+
+  VkDescriptorPool GetDescriptorPool() const { return m_descriptorPool; }
+  VkDevice GetDevice() { return m_device; }
+  const Swapchain* GetSwapchain() const { return m_swapchain.get(); }
+
+  VkPipelineLayout GetPipelineLayout(const std::string& name) { return m_pipelineLayoutStore->Get(name); }
+  VkDescriptorSetLayout GetDescriptorSetLayout(const std::string& name) { return m_descriptorSetLayoutStore->Get(name); }
+  VkRenderPass GetRenderPass(const std::string& name) { return m_renderPassStore->Get(name); }
+
+  void RegisterLayout(const std::string& name, VkPipelineLayout layout) { m_pipelineLayoutStore->Register(name, layout); }
+  void RegisterLayout(const std::string& name, VkDescriptorSetLayout layout) { m_descriptorSetLayoutStore->Register(name, layout); }
+  void RegisterRenderPass(const std::string& name, VkRenderPass renderPass) { m_renderPassStore->Register(name, renderPass); }
+  struct BufferObject
+  {
+    VkBuffer buffer;
+    VkDeviceMemory memory;
+  };
+  struct ImageObject
+  {
+    VkImage image;
+    VkDeviceMemory memory;
+    VkImageView view;
+  };
+
+  BufferObject CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props);
+  ImageObject CreateTexture(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage);
+  // 6 面(+X,-X,+Y,-Y,+Z,-Z の順)の画像ファイルから Cubemap を作成する.
+  // 各面のデコードは並列に行い、1 つのステージングバッファから 1 回のコピーで転送する.
+  ImageObject LoadCubeTextureFromFile(const char* faceFiles[6], MipmapGeneration mipmaps = MipmapGeneration::None);
+  // KTX2 ファイルからテクスチャを作成する. ミップマップ、配列、Cubemap をファイルの内容通りに作成する.
+  // マップしたファイルのレベルデータを 1 回のコピーでステージングバッファへ書き込んで転送する.
+  // ファイルにミップマップが含まれず mipmaps が None 以外の場合は GPU で作成する.
+  ImageObject LoadTextureFromKtx(const std::string& fileName,
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT,
+    VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+    MipmapGeneration mipmaps = MipmapGeneration::None);
+  // 読み込みを別スレッドで行い、すぐに 1x1 の灰色の仮テクスチャを返す.
+  // 転送が完了すると AcquireNextImage 内で onReady が呼ばれるので、記述子セットを差し替えること.
+  // 仮テクスチャは onReady の後に破棄される. それまでに終了した場合は呼び出し側で破棄する.
+  // 読み込みに失敗した場合はエラーを出力し、仮テクスチャそのものを onReady に渡す(以降は呼び出し側で破棄する).
+  // onReady は転送の完了を確認した時点までに送信されたフレームが GPU で完了してから呼ばれる(キューの完了は待たない).
+  using TextureReadyCallback = std::function<void(const ImageObject&)>;
+  ImageObject LoadCubeTextureFromFileAsync(const char* faceFiles[6], MipmapGeneration mipmaps, TextureReadyCallback onReady);
+  ImageObject LoadTextureFromKtxAsync(const std::string& fileName,
+    VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps, TextureReadyCallback onReady);
+  // 画像ファイルから RGBA8 の 2D テクスチャを作成する.
+  ImageObject Load2DTextureFromFileAsync(const std::string& fileName,
+    VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps, TextureReadyCallback onReady);
+  // 読み込み中(onReady の呼び出し前)のテクスチャ数.
+  uint32_t GetLoadingTextureCount() const { return uint32_t(m_asyncTextures.size()); }
+  // 読み込み中のテクスチャをすべて完了させる. 計測を同じ条件で行う場合に使う.
+  void WaitForAsyncTextures();
+  // KTX2 ファイルが存在し、その形式(BC 圧縮形式など)を usage の用途でデバイスが扱えるか.
+  // 扱えない場合は元の画像ファイルから読み込む.
+  bool CanLoadTextureFromKtx(const std::string& fileName, VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT);
+  // レベル 0 から順に縮小コピーして残りのレベルを作成する.
+  // 呼び出し時には全レベルが TRANSFER_DST_OPTIMAL で、レベル 0 への転送コマンドが記録済みであること.
+  // 終了後は全レベルが newLayout となる. イメージには TRANSFER_SRC の用途が必要.
+  void GenerateMipmapsOnGpu(VkCommandBuffer command, VkImage image, VkFormat format,
+    uint32_t width, uint32_t height, uint32_t levelCount, uint32_t layerCount, VkImageLayout newLayout);
+  // format で縮小コピー(線形補間)によるミップマップの作成ができるか.
+  bool CanGenerateMipmapsOnGpu(VkFormat format);
+  VkFramebuffer CreateFramebuffer(VkRenderPass renderPass, uint32_t width, uint32_t height, uint32_t viewCount, VkImageView* views);
+  VkFence CreateFence();
+  VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout dsLayout);
+
+  void DestroyBuffer(BufferObject bufferObj);
+  void DestroyImage(ImageObject imageObj);
+  void DestroyFramebuffers(uint32_t count, VkFramebuffer* framebuffers);
+  void DestroyFence(VkFence fence);
+  void DeallocateDescriptorSet(VkDescriptorSet dsLayout);
+
+  VkCommandBuffer CreateCommandBuffer(bool bBegin = true);
+  void FinishCommandBuffer(VkCommandBuffer command);
+  void DestroyCommandBuffer(VkCommandBuffer command);
+
+  VkRect2D GetSwapchainRenderArea() const;
+
+  // 描画先のスワップチェインイメージを取得する.
+  // スワップチェインの作り直しが必要な場合はここで行い、取得できなければ false を返す.
+  bool AcquireNextImage(uint32_t* pImageIndex);
+  // フレームのコマンドを送信して表示する.
+  void SubmitFrame(VkCommandBuffer command, VkFence fence, uint32_t imageIndex);
+
+  // 現在までに送信したコマンドの完了後に破棄を行うよう登録する.
+  void DeferredDestroy(std::function<void()> disposer);
+
+  // 表示するフレームを directory 以下へ連番で書き出す.
+  void StartFrameCapture(const std::string& directory, FrameCapture::Format format = FrameCapture::Format::PNG, uint32_t maxFrames = 0);
+  void StopFrameCapture();
+  bool IsFrameCapturing() const { return m_frameCapture && m_frameCapture->IsCapturing(); }
+  FrameCapture* GetFrameCapture() { return m_frameCapture.get(); }
+
+  // GPU 上でのパスの処理時間を計測する.
+  // フレーム内で最初の BeginGpuPass はレンダーパスの外で呼ぶこと.
+  void BeginGpuPass(VkCommandBuffer command, const char* name);
+  void EndGpuPass(VkCommandBuffer command);
+  GpuProfiler& GetGpuProfiler() { return m_gpuProfiler; }
+
+  // カメラ操作の記録と再生.
+  // 時刻は経過時間ではなくフレーム数と固定の刻み幅から求めるため、実行ごとに同じ視点列となる.
+  // 再生中はマウスによるカメラ操作を受け付けない.
+  void StartCameraPlayback(const CameraPath& path);
+  void StartCameraRecording();
+  // 記録を終了してファイルへ保存する. fileName が空なら保存しない.
+  bool StopCameraRecording(const std::string& fileName);
+  void StopCameraPlayback();
+  bool IsCameraPlaying() const { return m_cameraTrackMode == CameraTrackMode::Playback; }
+  // フレームの描画前に UpdateCameraTrack より先に呼び、溜まったマウス入力をカメラへ反映する.
+  // elapsedSeconds は前のフレームからの経過時間. 記録中は CameraTrackTimeStep で進める.
+  void UpdateCamera(float elapsedSeconds);
+  // フレームの描画前に呼び、カメラの記録または再生を 1 フレーム進める.
+  void UpdateCameraTrack();
+  // サンプルごとの既定のカメラ経路. カメラを持たないサンプルでは空.
+  virtual CameraPath CreateDefaultCameraPath() { return CameraPath(); }
+
+  static const float CameraTrackTimeStep;
+
+  // デコード済みテクスチャのキャッシュ. 保存先を空にすると無効になる.
+  TextureCache& GetTextureCache() { return m_textureCache; }
+
+  std::vector<BufferObject> CreateUniformBuffers(uint32_t size, uint32_t imageCount);
+
+  // ホストから見えるメモリ領域にデータを書き込む.以下バッファを対象に使用.
+  // - ステージングバッファ
+  // - ユニフォームバッファ
+  void WriteToHostVisibleMemory(VkDeviceMemory memory, VkDeviceSize size, const void* pData);
+
+  void AllocateCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands);
+  void FreeCommandBufferSecondary(uint32_t count, VkCommandBuffer* pCommands);
+
+  void TransferStageBufferToImage(const BufferObject& srcBuffer, const ImageObject& dstImage, const VkBufferImageCopy* region);
+
+
+  // レンダーパスの生成.
+  VkRenderPass CreateRenderPass(VkFormat colorFormat, VkFormat depthFormat = VK_FORMAT_UNDEFINED, VkImageLayout layoutColor = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+
+  struct ModelData
+  {
+    uint32_t indexCount;
+    uint32_t vertexCount;
+    BufferObject resVertexBuffer;
+    BufferObject resIndexBuffer;
+    VkIndexType indexType;
+    // 以下は CreateCompactModel、LoadModelFromMeshFile で作成した場合のみ設定される.
+    book_util::VertexInputLayout vertexLayout;
+    book_util::VertexDecodeConstants decodeConstants;
+    // メッシュレット(ModelFlag_Meshlets を指定した場合). 三角形はインデックスバッファの triangleOffset * 3 からの範囲と一致する.
+    // resMeshletBuffer は meshlets をコンピュートシェーダーから参照するためのストレージバッファ.
+    std::vector<book_util::Meshlet> meshlets;
+    BufferObject resMeshletBuffer{ VK_NULL_HANDLE, VK_NULL_HANDLE };
+    // 詳細度(ModelFlag_Lods を指定した場合). インデックスバッファにはすべての段が続けて入っており、indexCount は LOD 0 の数となる.
+    // メッシュレットは LOD 0 のみから作成する.
+    std::vector<book_util::MeshLod> lods;
+  };
+  // CreateCompactModel、LoadModelFromMeshFile で追加で用意するもの. 使うサンプルのみが指定する.
+  enum ModelFlags : uint32_t
+  {
+    ModelFlag_Meshlets = 1 << 0,  // メッシュレット(meshlets、resMeshletBuffer).
+    ModelFlag_Lods = 1 << 1,      // 簡略化した詳細度(lods).
+  };
+
+  // 単純モデルのデータをGPUへ転送.
+  // topology が三角形リストであれば、SetMeshOptimization の指定に従って並べ替えてから転送する.
+  // パッチリスト等、インデックスの並びに意味がある場合はその topology を指定すること.
+  template<class T>
+  ModelData CreateSimpleModel(const std::vector<T>& vertices, const std::vector<uint32_t>& indices,
+    VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+  {
+    if (!m_isMeshOptimizationEnabled || topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || indices.size() < 3)
+    {
+      return UploadModel(vertices.data(), uint32_t(sizeof(T)), uint32_t(vertices.size()), indices.data(), uint32_t(indices.size()));
+    }
+    auto optimizedVertices = vertices;
+    auto optimizedIndices = indices;
+    m_meshOptimizationResults.push_back(book_util::OptimizeMesh(optimizedVertices, optimizedIndices));
+    return UploadModel(optimizedVertices.data(), uint32_t(sizeof(T)), uint32_t(optimizedVertices.size()),
+      optimizedIndices.data(), uint32_t(optimizedIndices.size()));
+  }
+  // 位置と法線を持つ三角形リストのモデルを、CompactVertex と(頂点数が収まれば) 16bit インデックスに圧縮して転送する.
+  // 位置(float × 3)は各頂点の先頭、法線(float × 3)は normalOffset にあること.
+  // パイプラインの作成には結果の vertexLayout と、頂点シェーダーの特殊化定数として decodeConstants を使う.
+  // flags に ModelFlag_Meshlets を含めれば、並べ替えた後のインデックスの順にメッシュレット(meshlets、resMeshletBuffer)も作成する.
+  // ModelFlag_Lods を含めれば簡略化した詳細度(lods)も作成し、インデックスバッファの LOD 0 の後ろへ続けて格納する.
+  template<class T>
+  ModelData CreateCompactModel(const std::vector<T>& vertices, const std::vector<uint32_t>& indices, uint32_t normalOffset, uint32_t flags = 0)
+  {
+    auto srcVertices = vertices;
+    auto srcIndices = indices;
+    if (m_isMeshOptimizationEnabled && srcIndices.size() >= 3)
+    {
+      m_meshOptimizationResults.push_back(book_util::OptimizeMesh(srcVertices, srcIndices));
+    }
+    return UploadCompactModel(srcVertices.data(), uint32_t(sizeof(T)), uint32_t(srcVertices.size()), normalOffset,
+      srcIndices.data(), uint32_t(srcIndices.size()), flags);
+  }
+  // 頂点とインデックスをデバイスローカルのバッファへ転送する.
+  ModelData UploadModel(const void* vertices, uint32_t vertexStride, uint32_t vertexCount,
+    const void* indices, uint32_t indexCount, VkIndexType indexType = VK_INDEX_TYPE_UINT32);
+  ModelData UploadCompactModel(const void* vertices, uint32_t vertexStride, uint32_t vertexCount, uint32_t normalOffset,
+    const uint32_t* indices, uint32_t indexCount, uint32_t flags = 0);
+  // MeshCooker で作成したメッシュファイルが読み込めるか.
+  // 頂点形式、並べ替えの有無が SetCompactVertex、SetMeshOptimization の指定と異なる場合も false とし、元のモデルから作成させる.
+  bool CanLoadModelFromMeshFile(const std::string& fileName);
+  // メッシュファイルをマップし、頂点とインデックスをそのままステージングバッファへ書き込んで転送する.
+  // vertexLayout、decodeConstants はファイルの頂点形式に合わせて設定される.
+  // メッシュレット、詳細度は flags で指定し、ファイルに含まれている場合のみ設定される.
+  // 詳細度を指定しない場合は LOD 0 のインデックスのみを転送する.
+  ModelData LoadModelFromMeshFile(const std::string& fileName, uint32_t flags = 0);
+  // model.meshlets をデバイスローカルのストレージバッファ(resMeshletBuffer)へ転送する.
+  void UploadMeshlets(ModelData& model);
+  // メッシュレット単位のカリングを行うサンプルが、描画したビューごとに加算する.
+  void AddClusterCullingStatistics(uint32_t views, uint64_t triangles, uint64_t monolithicTriangles)
+  {
+    m_clusterCullingStatistics.views += views;
+    m_clusterCullingStatistics.triangles += triangles;
+    m_clusterCullingStatistics.monolithicTriangles += monolithicTriangles;
+  }
+
+ private:
+  void CreateInstance();
+  void SelectGraphicsQueue();
+  void CreateDevice();
+  void CreateCommandPool();
+
+  // デバッグレポート有効化.
+  void EnableDebugReport();
+  void DisableDebugReport();
+  PFN_vkCreateDebugReportCallbackEXT	m_vkCreateDebugReportCallbackEXT;
+  PFN_vkDebugReportMessageEXT	m_vkDebugReportMessageEXT;
+  PFN_vkDestroyDebugReportCallbackEXT m_vkDestroyDebugReportCallbackEXT;
+  VkDebugReportCallbackEXT  m_debugReport;
+
+  void CreateDescriptorPool();
+
+  // ImGui
+  void PrepareImGui();
+  void CleanupImGui();
+  // スワップチェインの作り直し.
+  void RecreateSwapchain();
+  // 送信済みコマンドの完了状況を更新し、遅延破棄を処理する.
+  void ProcessDeferredDestroy();
+
+protected:
+  // テクスチャの読み込みは、ステージングバッファとイメージの準備(別スレッドで実行可能)と
+  // コマンドの記録に分けて行う. 同期で読み込む場合は FinishTextureUpload(Prepare*TextureUpload(...)) とする.
+  struct TextureUpload
+  {
+    ImageObject image;
+    BufferObject staging;
+    VkFormat format;
+    uint32_t width, height;
+    uint32_t levelCount, layerCount;
+    std::vector<VkBufferImageCopy> regions;
+    bool isGpuMipmap;
+    VkImageLayout layout;   // 転送後のレイアウト.
+    std::string name;
+    std::chrono::high_resolution_clock::time_point startTime;
+  };
+  TextureUpload PrepareCubeTextureUpload(const std::vector<std::string>& faceFiles, MipmapGeneration mipmaps);
+  TextureUpload PrepareKtxTextureUpload(const std::string& fileName, VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps);
+  TextureUpload Prepare2DTextureUpload(const std::string& fileName, VkImageUsageFlags usage, VkImageLayout layout, MipmapGeneration mipmaps);
+  void RecordTextureUpload(VkCommandBuffer command, const TextureUpload& upload);
+  // 転送の完了を待ち、ステージングバッファを破棄する.
+  ImageObject FinishTextureUpload(const TextureUpload& upload);
+
+private:
+  ImageObject CreatePlaceholderTexture(VkImageViewType viewType, VkImageUsageFlags usage, VkImageLayout layout);
+  ImageObject StartAsyncTexture(VkImageViewType viewType, VkImageUsageFlags usage, VkImageLayout layout,
+    const std::string& name, std::function<TextureUpload()> prepare, TextureReadyCallback onReady);
+  // 準備の終わった読み込みを送信し、転送の完了したものについて onReady を呼ぶ.
+  void ProcessAsyncTextures();
+protected:
+  // スワップチェインが作り直された後に呼ばれる.サイズ依存のリソースをここで再生成する.
+  virtual void OnSwapchainRecreated() { }
+  // 記録・再生の対象となるカメラ.
+  virtual Camera* GetCamera() { return nullptr; }
+
+  VkDeviceMemory AllocateMemory(VkBuffer image, VkMemoryPropertyFlags memProps);
+  VkDeviceMemory AllocateMemory(VkImage image, VkMemoryPropertyFlags memProps);
+  // SetMipmapGenerationOverride の指定を反映した作成方法.
+  MipmapGeneration ResolveMipmapGeneration(MipmapGeneration requested) const
+  {
+    return m_isMipmapOverridden ? m_mipmapOverride : requested;
+  }
+  void RecordTextureLoadTime(const std::string& name, std::chrono::high_resolution_clock::time_point startTime);
+  // GetDepthMode に合わせた深度のクリア値、比較方法、透視投影(ReverseZ では zFar を使わない).
+  float GetDepthClearValue() const { return m_depthMode == DepthMode::ReverseZ ? 0.0f : 1.0f; }
+  VkCompareOp GetDepthCompareOp() const
+  {
+    return m_depthMode == DepthMode::ReverseZ ? VK_COMPARE_OP_GREATER_OR_EQUAL : VK_COMPARE_OP_LESS_OR_EQUAL;
+  }
+  glm::mat4 CreatePerspective(float fovy, float aspect, float zNear, float zFar) const;
+  // 最小化メッセージループ.
+  void MsgLoopMinimizedWindow();
+
+  VkDevice  m_device;
+  VkPhysicalDevice m_physicalDevice;
+  VkInstance m_vkInstance;
+
+  VkPhysicalDeviceMemoryProperties m_physicalMemProps;
+  VkQueue m_deviceQueue;
+  uint32_t  m_gfxQueueIndex;
+  VkCommandPool m_commandPool;
+
+  VkSemaphore m_renderCompletedSem, m_presentCompletedSem;
+
+  VkDescriptorPool m_descriptorPool;
+
+  bool m_isMinimizedWindow;
+  bool m_isFullscreen;
+  bool m_isSwapchainDirty;
+  std::unique_ptr<Swapchain> m_swapchain;
+  GLFWwindow* m_window;
+  std::unique_ptr<FrameCapture> m_frameCapture;
+  bool m_isHeadless;
+  VkPresentModeKHR m_presentMode;
+
+  using RenderPassRegistry = VulkanObjectStore<VkRenderPass>;
+  using PipelineLayoutManager = VulkanObjectStore<VkPipelineLayout>;
+  using DescriptorSetLayoutManager = VulkanObjectStore<VkDescriptorSetLayout>;
+  std::unique_ptr<RenderPassRegistry> m_renderPassStore;
+  std::unique_ptr<PipelineLayoutManager> m_pipelineLayoutStore;
+  std::unique_ptr<DescriptorSetLayoutManager> m_descriptorSetLayoutStore;
+
+private:
+  // フェンスと送信番号の対応で GPU の完了位置を追跡する.
+  struct SubmitRecord
+  {
+    uint64_t serial;
+    VkFence fence;
+  };
+  struct DeferredObject
+  {
+    uint64_t serial;
+    std::function<void()> disposer;
+  };
+  GpuProfiler m_gpuProfiler;
+  TextureCache m_textureCache;
+  uint32_t m_currentImageIndex;
+  uint64_t m_profiledSerial;
+  StartupTimes m_startupTimes;
+  TextureLoadTimes m_textureLoadTimes;
+  MipmapGeneration m_mipmapOverride;
+  bool m_isMipmapOverridden;
+  DepthMode m_depthMode;
+  bool m_isMeshOptimizationEnabled;
+  bool m_isCompactVertexEnabled;
+  bool m_isClusterCullingEnabled;
+  bool m_isLodSelectionEnabled;
+  ClusterCullingStatistics m_clusterCullingStatistics;
+  MeshOptimizationResults m_meshOptimizationResults;
+
+  enum class CameraTrackMode
+  {
+    None,
+    Playback,
+    Recording,
+  };
+  CameraTrackMode m_cameraTrackMode;
+  CameraPath m_cameraPath;
+  uint32_t m_cameraTrackFrame;
+
+  uint64_t m_submitSerial;
+  uint64_t m_completedSerial;
+  std::deque<SubmitRecord> m_inflightSubmits;
+  std::unordered_map<VkFence, uint64_t> m_fenceSerials;
+  std::deque<DeferredObject> m_deferredObjects;
+
+  struct AsyncTexture
+  {
+    std::future<TextureUpload> upload;
+    ImageObject placeholder;
+    ImageObject image;
+    TextureReadyCallback onReady;
+    std::string name;
+    std::chrono::high_resolution_clock::time_point startTime;
+    bool isSubmitted;
+    bool isFailed;          // 読み込みに失敗し、仮テクスチャを image として渡す.
+    bool isUploaded;        // 転送の完了を確認した.
+    uint64_t uploadSerial;  // 転送コマンドの送信番号.
+    uint64_t frameSerial;   // 転送の完了を確認した時点の送信番号. この番号まで完了すれば onReady を呼ぶ.
+  };
+  std::list<AsyncTexture> m_asyncTextures;
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+サンプルで使うモデルを MeshCooker で調理済みのメッシュファイル(.mesh)へ変換する.
+変換後のファイルは各サンプルのディレクトリへ出力され、実行時は組み込みのモデルより優先して読み込まれる.
+
+  cook_meshes.py [--cooker path/to/MeshCooker] [--force] [--format compact|float]
+
+出力ファイルが MeshCooker の実行ファイルより新しい場合は変換を省略する(組み込みのモデルは実行ファイルに含まれるため).
+--format を変更した場合は --force を指定すること.
+標準ライブラリのみで動作する.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+# (出力ファイル, 入力の引数)
+MESHES = [
+    ('03_HelloGeometryShader/teapot.mesh', ['--teapot']),
+    ('04_CubemapRendering/teapot.mesh', ['--teapot']),
+]
+
+
+def find_cooker():
+    candidates = [
+        os.path.join(ROOT, 'MeshCooker', 'x64', 'Release', 'MeshCooker.exe'),
+        os.path.join(ROOT, 'MeshCooker', 'x64', 'Debug', 'MeshCooker.exe'),
+    ]
+    for path in candidates:
+        if os.path.isfile(path):
+            return path
+    return None
+
+
+def is_up_to_date(output, inputs):
+    if not os.path.isfile(output):
+        return False
+    time = os.path.getmtime(output)
+    return all(os.path.getmtime(path) <= time for path in inputs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='サンプルのモデルのメッシュファイル変換')
+    parser.add_argument('--cooker', help='MeshCooker の実行ファイル')
+    parser.add_argument('--force', action='store_true', help='更新の有無にかかわらず変換する')
+    parser.add_argument('--format', choices=['compact', 'float'], default='compact', help='頂点の形式')
+    args = parser.parse_args()
+
+    cooker = args.cooker or find_cooker()
+    if cooker is None:
+        print('error: MeshCooker not found. build MeshCooker or specify --cooker.', file=sys.stderr)
+        return 2
+
+    failed = 0
+    for output, inputs in MESHES:
+        output = os.path.join(ROOT, output)
+        files = [os.path.join(ROOT, path) for path in inputs if not path.startswith('--')]
+        if not args.force and is_up_to_date(output, files + [cooker]):
+            print('%s: up to date' % os.path.relpath(output, ROOT))
+            continue
+        command = [cooker] + inputs + ['--format', args.format, '-o', output]
+        if subprocess.call(command) != 0:
+            print('error: failed to cook %s' % os.path.relpath(output, ROOT), file=sys.stderr)
+            failed += 1
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+サンプルに同梱している画像を TextureCooker で KTX2 形式へ変換する.
+変換後のファイルは各サンプルのディレクトリへ出力され、実行時は元の画像より優先して読み込まれる.
+BC 圧縮形式に対応していないデバイスでは元の画像が使われる.
+
+  cook_textures.py [--cooker path/to/TextureCooker] [--force] [--virtual]
+
+--virtual を指定すると、07_TessellateGround の仮想テクスチャ用のハイトマップ(heightmap.vtex)も作成する.
+入力を 32 倍に拡大した 16384x16384 の R16 で、ファイルは約 700MB になる.
+
+出力ファイルが元の画像より新しい場合は変換を省略する.
+標準ライブラリのみで動作する.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+# (出力ファイル, 入力ファイル, 追加の引数)
+TEXTURES = [
+    ('04_CubemapRendering/cubemap.ktx2',
+     ['04_CubemapRendering/posx.jpg', '04_CubemapRendering/negx.jpg',
+      '04_CubemapRendering/posy.jpg', '04_CubemapRendering/negy.jpg',
+      '04_CubemapRendering/posz.jpg', '04_CubemapRendering/negz.jpg'],
+     ['--cube', '--format', 'bc7', '--mips', '--mip-filter', 'kaiser']),
+    # ハイトマップは 16 ビットの R のみ、法線マップは X(R) と Z(B) のみを格納する.
+    # ハイトマップのミップマップは実行時に GPU で作成する(高さの段差を避けるため BC4 にはしない).
+    ('07_TessellateGround/heightmap.ktx2', ['07_TessellateGround/heightmap.png'],
+     ['--format', 'r16']),
+    ('07_TessellateGround/normalmap.ktx2', ['07_TessellateGround/normalmap.png'],
+     ['--format', 'bc5', '--swizzle', 'rb01', '--mips', '--mip-filter', 'kaiser']),
+    # ストレージイメージとしても使うため圧縮しない.
+    ('09_ComputeFilter/image.ktx2', ['09_ComputeFilter/image.png'], []),
+]
+
+# --virtual の場合のみ作成する.
+VIRTUAL_TEXTURES = [
+    ('07_TessellateGround/heightmap.vtex', ['07_TessellateGround/heightmap.png'],
+     ['--virtual', '128', '--upscale', '32']),
+]
+
+
+def find_cooker():
+    candidates = [
+        os.path.join(ROOT, 'TextureCooker', 'x64', 'Release', 'TextureCooker.exe'),
+        os.path.join(ROOT, 'TextureCooker', 'x64', 'Debug', 'TextureCooker.exe'),
+    ]
+    for path in candidates:
+        if os.path.isfile(path):
+            return path
+    return None
+
+
+def is_up_to_date(output, inputs):
+    if not os.path.isfile(output):
+        return False
+    time = os.path.getmtime(output)
+    return all(os.path.getmtime(path) <= time for path in inputs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='同梱画像の KTX2 変換')
+    parser.add_argument('--cooker', help='TextureCooker の実行ファイル')
+    parser.add_argument('--force', action='store_true', help='更新の有無にかかわらず変換する')
+    parser.add_argument('--virtual', action='store_true', help='仮想テクスチャのハイトマップも作成する')
+    args = parser.parse_args()
+
+    cooker = args.cooker or find_cooker()
+    if cooker is None:
+        print('error: TextureCooker not found. build TextureCooker or specify --cooker.', file=sys.stderr)
+        return 2
+
+    failed = 0
+    textures = TEXTURES + (VIRTUAL_TEXTURES if args.virtual else [])
+    for output, inputs, options in textures:
+        output = os.path.join(ROOT, output)
+        inputs = [os.path.join(ROOT, path) for path in inputs]
+        if not args.force and is_up_to_date(output, inputs):
+            print('%s: up to date' % os.path.relpath(output, ROOT))
+            continue
+        command = [cooker] + options + inputs + ['-o', output]
+        if subprocess.call(command) != 0:
+            print('error: failed to cook %s' % os.path.relpath(output, ROOT), file=sys.stderr)
+            failed += 1
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
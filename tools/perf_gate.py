@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+SampleRunner (--summary) および Benchmark (--json) の出力をベースラインと比較し、
+統計的に有意な性能低下があれば 0 以外の終了コードを返す.
+
+  perf_gate.py --baseline base1.json base2.json --current cur1.json cur2.json
+               [--config perf_thresholds.json] [--method mannwhitney|bootstrap]
+               [--threshold 5.0] [--alpha 0.01] [--report report.json]
+
+同じ計測を複数回行ったファイルを並べて渡せる. 分布を持つ値(フレーム時間や GPU のパス時間、
+ベンチマークのサンプル)は全ファイルのサンプルを連結し、起動時間やテクスチャの読み込み時間のような 1 回の実行で
+1 つしか得られない値はファイルごとの値をサンプルとして扱う.
+
+終了コード: 0 = 性能低下なし, 1 = 性能低下あり, 2 = 入力の誤り
+標準ライブラリのみで動作する.
+"""
+
+import argparse
+import fnmatch
+import json
+import math
+import random
+import sys
+
+
+def load_metrics(paths):
+    """JSON ファイル群から 指標名 -> サンプル列 の辞書を作る. 値は全て小さいほど良い."""
+    metrics = {}
+
+    def add(name, values):
+        metrics.setdefault(name, []).extend(float(v) for v in values)
+
+    for path in paths:
+        with open(path, encoding='utf-8') as f:
+            data = json.load(f)
+        if 'benchmarks' in data:
+            # Benchmark の出力.
+            for name, result in data['benchmarks'].items():
+                stats = result['ns']
+                add('bench/' + name, stats.get('samples') or [stats['p50']])
+        elif 'frameTimeMs' in data:
+            # SampleRunner の出力.
+            sample = data.get('sample', 'sample')
+            stats = data['frameTimeMs']
+            add(sample + '/frameTimeMs', stats.get('samples') or [stats['p50']])
+            for name, stats in data.get('gpuPassMs', {}).items():
+                add(sample + '/gpu/' + name, stats.get('samples') or [stats['p50']])
+            for name, value in data.get('startupMs', {}).items():
+                add(sample + '/startup/' + name, [value])
+            for name, value in data.get('textureLoadMs', {}).items():
+                add(sample + '/texture/' + name, [value])
+        else:
+            raise ValueError('unknown result format: ' + path)
+    return metrics
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    if n == 0:
+        return 0.0
+    if n % 2 == 1:
+        return s[n // 2]
+    return (s[n // 2 - 1] + s[n // 2]) * 0.5
+
+
+def mann_whitney(a, b):
+    """Mann-Whitney の U 検定(両側). 同順位補正と連続性補正付きの正規近似で p 値を返す."""
+    n1, n2 = len(a), len(b)
+    combined = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(combined)
+    tie_sum = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        # 同じ値には平均順位を与える.
+        rank = (i + j) * 0.5 + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        t = j - i + 1
+        tie_sum += t * t * t - t
+        i = j + 1
+    r1 = sum(r for r, (_, g) in zip(ranks, combined) if g == 0)
+    u1 = r1 - n1 * (n1 + 1) * 0.5
+    mean = n1 * n2 * 0.5
+    n = n1 + n2
+    var = n1 * n2 / 12.0 * ((n + 1) - tie_sum / (n * (n - 1)))
+    if var <= 0.0:
+        return 1.0
+    diff = abs(u1 - mean) - 0.5
+    z = max(diff, 0.0) / math.sqrt(var)
+    return math.erfc(z / math.sqrt(2.0))
+
+
+def bootstrap_ratio(a, b, resamples, confidence, seed):
+    """中央値の比 (b / a) の信頼区間をブートストラップで求める. 乱数の種は固定して再現性を持たせる."""
+    rng = random.Random(seed)
+    ratios = []
+    for _ in range(resamples):
+        ma = median([a[rng.randrange(len(a))] for _ in a])
+        mb = median([b[rng.randrange(len(b))] for _ in b])
+        if ma > 0.0:
+            ratios.append(mb / ma)
+    if not ratios:
+        return (1.0, 1.0)
+    ratios.sort()
+    lo = ratios[int((1.0 - confidence) * 0.5 * (len(ratios) - 1))]
+    hi = ratios[int((1.0 - (1.0 - confidence) * 0.5) * (len(ratios) - 1))]
+    return (lo, hi)
+
+
+def threshold_for(name, config, default):
+    for pattern, value in config.get('metrics', {}).items():
+        if fnmatch.fnmatchcase(name, pattern):
+            return float(value)
+    return default
+
+
+def compare(baseline, current, args, config):
+    results = []
+    for name in sorted(set(baseline) | set(current)):
+        base = baseline.get(name, [])
+        cur = current.get(name, [])
+        entry = {'metric': name, 'baselineCount': len(base), 'currentCount': len(cur)}
+        if not base or not cur:
+            entry['status'] = 'missing'
+            results.append(entry)
+            continue
+
+        threshold = threshold_for(name, config, args.threshold)
+        base_median = median(base)
+        cur_median = median(cur)
+        change = (cur_median / base_median - 1.0) * 100.0 if base_median > 0.0 else 0.0
+        entry.update({
+            'baselineMedian': base_median,
+            'currentMedian': cur_median,
+            'changePercent': change,
+            'thresholdPercent': threshold,
+        })
+
+        if len(base) < args.min_samples or len(cur) < args.min_samples:
+            # サンプルが少なすぎるものは検定せず、変化量のみ報告する.
+            entry['status'] = 'insufficient'
+            results.append(entry)
+            continue
+
+        if args.method == 'bootstrap':
+            lo, hi = bootstrap_ratio(base, cur, args.resamples, 1.0 - args.alpha, args.seed)
+            entry['ratioInterval'] = [lo, hi]
+            significant = lo > 1.0 or hi < 1.0
+        else:
+            p = mann_whitney(base, cur)
+            entry['pValue'] = p
+            significant = p < args.alpha
+
+        if significant and change > threshold:
+            entry['status'] = 'regression'
+        elif significant and change < -threshold:
+            entry['status'] = 'improvement'
+        else:
+            entry['status'] = 'unchanged'
+        results.append(entry)
+    return results
+
+
+def print_table(results, method):
+    label = 'ratio CI' if method == 'bootstrap' else 'p'
+    print('%-56s %14s %14s %9s %19s  %s' % ('metric', 'baseline', 'current', 'change', label, 'status'))
+    for r in results:
+        if 'baselineMedian' not in r:
+            print('%-56s %14s %14s %9s %19s  %s' % (r['metric'], '-', '-', '-', '-', r['status']))
+            continue
+        if 'pValue' in r:
+            test = '%.2e' % r['pValue']
+        elif 'ratioInterval' in r:
+            test = '[%.3f, %.3f]' % tuple(r['ratioInterval'])
+        else:
+            test = '-'
+        print('%-56s %14.4f %14.4f %+8.2f%% %19s  %s' % (
+            r['metric'], r['baselineMedian'], r['currentMedian'], r['changePercent'], test, r['status']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='性能の回帰判定')
+    parser.add_argument('--baseline', nargs='+', required=True, help='ベースラインの JSON (複数可)')
+    parser.add_argument('--current', nargs='+', required=True, help='比較対象の JSON (複数可)')
+    parser.add_argument('--config', help='指標ごとの閾値を記述した JSON')
+    parser.add_argument('--method', choices=['mannwhitney', 'bootstrap'], default=None)
+    parser.add_argument('--threshold', type=float, default=None, help='性能低下とみなす中央値の変化率(%%)')
+    parser.add_argument('--alpha', type=float, default=None, help='有意水準')
+    parser.add_argument('--min-samples', type=int, default=None, help='検定に必要な最小サンプル数')
+    parser.add_argument('--resamples', type=int, default=2000, help='ブートストラップの再標本化回数')
+    parser.add_argument('--seed', type=int, default=1, help='ブートストラップの乱数の種')
+    parser.add_argument('--fail-on-missing', action='store_true', help='片方にしかない指標も失敗とする')
+    parser.add_argument('--report', help='判定結果の JSON 出力先')
+    args = parser.parse_args()
+
+    try:
+        config = {}
+        if args.config:
+            with open(args.config, encoding='utf-8') as f:
+                config = json.load(f)
+        # コマンドライン引数 > 設定ファイル > 既定値 の順で採用する.
+        if args.method is None:
+            args.method = config.get('method', 'mannwhitney')
+        if args.threshold is None:
+            args.threshold = float(config.get('threshold', 5.0))
+        if args.alpha is None:
+            args.alpha = float(config.get('alpha', 0.01))
+        if args.min_samples is None:
+            args.min_samples = int(config.get('minSamples', 5))
+
+        baseline = load_metrics(args.baseline)
+        current = load_metrics(args.current)
+    except (OSError, ValueError, KeyError) as e:
+        print('error: %s' % e, file=sys.stderr)
+        return 2
+
+    results = compare(baseline, current, args, config)
+    print_table(results, args.method)
+
+    if args.report:
+        with open(args.report, 'w', encoding='utf-8') as f:
+            json.dump({'method': args.method, 'alpha': args.alpha, 'results': results}, f, indent=2)
+
+    failed = [r for r in results if r['status'] == 'regression']
+    if args.fail_on_missing:
+        failed += [r for r in results if r['status'] == 'missing']
+    regressions = sum(1 for r in results if r['status'] == 'regression')
+    improvements = sum(1 for r in results if r['status'] == 'improvement')
+    print('\n%d regression(s), %d improvement(s), %d metric(s)' % (regressions, improvements, len(results)))
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())